@@ -74,6 +74,9 @@ HISTORY:
 
    30 Nov 09   v2.3     round() function is now round_fx().
                         saturate() is not referencable from outside application
+
+   17.Oct.26  v2.4      The operators are not compiled when BASOP_INLINE is
+                        defined: they are then defined in basop_inline.h.
   =============================================================================
 */
 
@@ -127,8 +130,8 @@ HISTORY:
 
 
 #if (WMOPS)
-extern BASIC_OP multiCounter[MAXCOUNTERS];
-extern int currCounter;
+extern BASOP_TLS BASIC_OP multiCounter[MAXCOUNTERS];
+extern BASOP_TLS int currCounter;
 #endif
 
 
@@ -137,7 +140,9 @@ extern int currCounter;
  |   Local Functions                                                         |
  |___________________________________________________________________________|
 */
+#ifndef BASOP_INLINE
 static Word16 saturate (Word32 L_var1);
+#endif /* ifndef BASOP_INLINE */
 
 
 /*___________________________________________________________________________
@@ -145,8 +150,8 @@ static Word16 saturate (Word32 L_var1);
  |   Constants and Globals                                                   |
  |___________________________________________________________________________|
 */
-Flag Overflow = 0;
-Flag Carry = 0;
+BASOP_TLS Flag Overflow = 0;
+BASOP_TLS Flag Carry = 0;
 
 
 /*___________________________________________________________________________
@@ -154,6 +159,11 @@ Flag Carry = 0;
  |   Functions                                                               |
  |___________________________________________________________________________|
 */
+/*
+ * With BASOP_INLINE, the operators are the static inline functions of
+ * basop_inline.h (included by basop32.h) and are not compiled here.
+ */
+#ifndef BASOP_INLINE
 
 /*___________________________________________________________________________
  |                                                                           |
@@ -193,7 +203,7 @@ static Word16 saturate (Word32 L_var1) {
   } else {
     var_out = extract_l (L_var1);
 #if (WMOPS)
-    multiCounter[currCounter].extract_l--;
+    BASOP_CNT.extract_l--;
 #endif
   }
 
@@ -242,7 +252,7 @@ Word16 add (Word16 var1, Word16 var2) {
   var_out = saturate (L_sum);
 
 #if (WMOPS)
-  multiCounter[currCounter].add++;
+  BASOP_CNT.add++;
 #endif
   return (var_out);
 }
@@ -289,7 +299,7 @@ Word16 sub (Word16 var1, Word16 var2) {
   var_out = saturate (L_diff);
 
 #if (WMOPS)
-  multiCounter[currCounter].sub++;
+  BASOP_CNT.sub++;
 #endif
   return (var_out);
 }
@@ -336,7 +346,7 @@ Word16 abs_s (Word16 var1) {
   }
 
 #if (WMOPS)
-  multiCounter[currCounter].abs_s++;
+  BASOP_CNT.abs_s++;
 #endif
   return (var_out);
 }
@@ -387,7 +397,7 @@ Word16 shl (Word16 var1, Word16 var2) {
     var_out = shr (var1, var2);
 
 #if (WMOPS)
-    multiCounter[currCounter].shr--;
+    BASOP_CNT.shr--;
 #endif
   } else {
     result = (Word32) var1 *((Word32) 1 << var2);
@@ -399,13 +409,13 @@ Word16 shl (Word16 var1, Word16 var2) {
       var_out = extract_l (result);
 
 #if (WMOPS)
-      multiCounter[currCounter].extract_l--;
+      BASOP_CNT.extract_l--;
 #endif
     }
   }
 
 #if (WMOPS)
-  multiCounter[currCounter].shl++;
+  BASOP_CNT.shl++;
 #endif
   return (var_out);
 }
@@ -455,7 +465,7 @@ Word16 shr (Word16 var1, Word16 var2) {
     var_out = shl (var1, var2);
 
 #if (WMOPS)
-    multiCounter[currCounter].shl--;
+    BASOP_CNT.shl--;
 #endif
   } else {
     if (var2 >= 15) {
@@ -470,7 +480,7 @@ Word16 shr (Word16 var1, Word16 var2) {
   }
 
 #if (WMOPS)
-  multiCounter[currCounter].shr++;
+  BASOP_CNT.shr++;
 #endif
   return (var_out);
 }
@@ -524,7 +534,7 @@ Word16 mult (Word16 var1, Word16 var2) {
   var_out = saturate (L_product);
 
 #if (WMOPS)
-  multiCounter[currCounter].mult++;
+  BASOP_CNT.mult++;
 #endif
   return (var_out);
 }
@@ -577,7 +587,7 @@ Word32 L_mult (Word16 var1, Word16 var2) {
   }
 
 #if (WMOPS)
-  multiCounter[currCounter].L_mult++;
+  BASOP_CNT.L_mult++;
 #endif
   return (L_var_out);
 }
@@ -617,7 +627,7 @@ Word16 negate (Word16 var1) {
   var_out = (var1 == MIN_16) ? MAX_16 : -var1;
 
 #if (WMOPS)
-  multiCounter[currCounter].negate++;
+  BASOP_CNT.negate++;
 #endif
   return (var_out);
 }
@@ -656,7 +666,7 @@ Word16 extract_h (Word32 L_var1) {
   var_out = (Word16) (L_var1 >> 16);
 
 #if (WMOPS)
-  multiCounter[currCounter].extract_h++;
+  BASOP_CNT.extract_h++;
 #endif
   return (var_out);
 }
@@ -695,7 +705,7 @@ Word16 extract_l (Word32 L_var1) {
   var_out = (Word16) L_var1;
 
 #if (WMOPS)
-  multiCounter[currCounter].extract_l++;
+  BASOP_CNT.extract_l++;
 #endif
   return (var_out);
 }
@@ -739,9 +749,9 @@ Word16 round_fx (Word32 L_var1) {
   var_out = extract_h (L_rounded);
 
 #if (WMOPS)
-  multiCounter[currCounter].L_add--;
-  multiCounter[currCounter].extract_h--;
-  multiCounter[currCounter].round++;
+  BASOP_CNT.L_add--;
+  BASOP_CNT.extract_h--;
+  BASOP_CNT.round++;
 #endif
   return (var_out);
 }
@@ -791,9 +801,9 @@ Word32 L_mac (Word32 L_var3, Word16 var1, Word16 var2) {
   L_var_out = L_add (L_var3, L_product);
 
 #if (WMOPS)
-  multiCounter[currCounter].L_mult--;
-  multiCounter[currCounter].L_add--;
-  multiCounter[currCounter].L_mac++;
+  BASOP_CNT.L_mult--;
+  BASOP_CNT.L_add--;
+  BASOP_CNT.L_mac++;
 #endif
   return (L_var_out);
 }
@@ -843,9 +853,9 @@ Word32 L_msu (Word32 L_var3, Word16 var1, Word16 var2) {
   L_var_out = L_sub (L_var3, L_product);
 
 #if (WMOPS)
-  multiCounter[currCounter].L_mult--;
-  multiCounter[currCounter].L_sub--;
-  multiCounter[currCounter].L_msu++;
+  BASOP_CNT.L_mult--;
+  BASOP_CNT.L_sub--;
+  BASOP_CNT.L_msu++;
 #endif
   return (L_var_out);
 }
@@ -900,9 +910,9 @@ Word32 L_macNs (Word32 L_var3, Word16 var1, Word16 var2) {
   L_var_out = L_add_c (L_var3, L_var_out);
 
 #if (WMOPS)
-  multiCounter[currCounter].L_mult--;
-  multiCounter[currCounter].L_add_c--;
-  multiCounter[currCounter].L_macNs++;
+  BASOP_CNT.L_mult--;
+  BASOP_CNT.L_add_c--;
+  BASOP_CNT.L_macNs++;
 #endif
   return (L_var_out);
 }
@@ -957,9 +967,9 @@ Word32 L_msuNs (Word32 L_var3, Word16 var1, Word16 var2) {
   L_var_out = L_sub_c (L_var3, L_var_out);
 
 #if (WMOPS)
-  multiCounter[currCounter].L_mult--;
-  multiCounter[currCounter].L_sub_c--;
-  multiCounter[currCounter].L_msuNs++;
+  BASOP_CNT.L_mult--;
+  BASOP_CNT.L_sub_c--;
+  BASOP_CNT.L_msuNs++;
 
 #endif
   return (L_var_out);
@@ -1009,7 +1019,7 @@ Word32 L_add (Word32 L_var1, Word32 L_var2) {
     }
   }
 #if (WMOPS)
-  multiCounter[currCounter].L_add++;
+  BASOP_CNT.L_add++;
 #endif
   return (L_var_out);
 }
@@ -1058,7 +1068,7 @@ Word32 L_sub (Word32 L_var1, Word32 L_var2) {
     }
   }
 #if (WMOPS)
-  multiCounter[currCounter].L_sub++;
+  BASOP_CNT.L_sub++;
 #endif
   return (L_var_out);
 }
@@ -1149,7 +1159,7 @@ Word32 L_add_c (Word32 L_var1, Word32 L_var2) {
   }
 
 #if (WMOPS)
-  multiCounter[currCounter].L_add_c++;
+  BASOP_CNT.L_add_c++;
 #endif
   return (L_var_out);
 }
@@ -1202,7 +1212,7 @@ Word32 L_sub_c (Word32 L_var1, Word32 L_var2) {
     if (L_var2 != MIN_32) {
       L_var_out = L_add_c (L_var1, -L_var2);
 #if (WMOPS)
-      multiCounter[currCounter].L_add_c--;
+      BASOP_CNT.L_add_c--;
 #endif
     } else {
       L_var_out = L_var1 - L_var2;
@@ -1234,7 +1244,7 @@ Word32 L_sub_c (Word32 L_var1, Word32 L_var2) {
   }
 
 #if (WMOPS)
-  multiCounter[currCounter].L_sub_c++;
+  BASOP_CNT.L_sub_c++;
 #endif
   return (L_var_out);
 }
@@ -1273,7 +1283,7 @@ Word32 L_negate (Word32 L_var1) {
   L_var_out = (L_var1 == MIN_32) ? MAX_32 : -L_var1;
 
 #if (WMOPS)
-  multiCounter[currCounter].L_negate++;
+  BASOP_CNT.L_negate++;
 #endif
   return (L_var_out);
 }
@@ -1327,7 +1337,7 @@ Word16 mult_r (Word16 var1, Word16 var2) {
   var_out = saturate (L_product_arr);
 
 #if (WMOPS)
-  multiCounter[currCounter].mult_r++;
+  BASOP_CNT.mult_r++;
 #endif
   return (var_out);
 }
@@ -1376,7 +1386,7 @@ Word32 L_shl (Word32 L_var1, Word16 var2) {
     var2 = -var2;
     L_var_out = L_shr (L_var1, var2);
 #if (WMOPS)
-    multiCounter[currCounter].L_shr--;
+    BASOP_CNT.L_shr--;
 #endif
   } else {
     for (; var2 > 0; var2--) {
@@ -1396,7 +1406,7 @@ Word32 L_shl (Word32 L_var1, Word16 var2) {
     }
   }
 #if (WMOPS)
-  multiCounter[currCounter].L_shl++;
+  BASOP_CNT.L_shl++;
 #endif
   return (L_var_out);
 }
@@ -1444,7 +1454,7 @@ Word32 L_shr (Word32 L_var1, Word16 var2) {
     var2 = -var2;
     L_var_out = L_shl (L_var1, var2);
 #if (WMOPS)
-    multiCounter[currCounter].L_shl--;
+    BASOP_CNT.L_shl--;
 #endif
   } else {
     if (var2 >= 31) {
@@ -1458,7 +1468,7 @@ Word32 L_shr (Word32 L_var1, Word16 var2) {
     }
   }
 #if (WMOPS)
-  multiCounter[currCounter].L_shr++;
+  BASOP_CNT.L_shr++;
 #endif
   return (L_var_out);
 }
@@ -1514,7 +1524,7 @@ Word16 shr_r (Word16 var1, Word16 var2) {
     var_out = shr (var1, var2);
 
 #if (WMOPS)
-    multiCounter[currCounter].shr--;
+    BASOP_CNT.shr--;
 #endif
 
     if (var2 > 0) {
@@ -1525,7 +1535,7 @@ Word16 shr_r (Word16 var1, Word16 var2) {
   }
 
 #if (WMOPS)
-  multiCounter[currCounter].shr_r++;
+  BASOP_CNT.shr_r++;
 #endif
   return (var_out);
 }
@@ -1577,10 +1587,10 @@ Word16 mac_r (Word32 L_var3, Word16 var1, Word16 var2) {
   var_out = extract_h (L_var3);
 
 #if (WMOPS)
-  multiCounter[currCounter].L_mac--;
-  multiCounter[currCounter].L_add--;
-  multiCounter[currCounter].extract_h--;
-  multiCounter[currCounter].mac_r++;
+  BASOP_CNT.L_mac--;
+  BASOP_CNT.L_add--;
+  BASOP_CNT.extract_h--;
+  BASOP_CNT.mac_r++;
 #endif
   return (var_out);
 }
@@ -1632,10 +1642,10 @@ Word16 msu_r (Word32 L_var3, Word16 var1, Word16 var2) {
   var_out = extract_h (L_var3);
 
 #if (WMOPS)
-  multiCounter[currCounter].L_msu--;
-  multiCounter[currCounter].L_add--;
-  multiCounter[currCounter].extract_h--;
-  multiCounter[currCounter].msu_r++;
+  BASOP_CNT.L_msu--;
+  BASOP_CNT.L_add--;
+  BASOP_CNT.extract_h--;
+  BASOP_CNT.msu_r++;
 #endif
   return (var_out);
 }
@@ -1675,7 +1685,7 @@ Word32 L_deposit_h (Word16 var1) {
   L_var_out = (Word32) var1 << 16;
 
 #if (WMOPS)
-  multiCounter[currCounter].L_deposit_h++;
+  BASOP_CNT.L_deposit_h++;
 #endif
   return (L_var_out);
 }
@@ -1715,7 +1725,7 @@ Word32 L_deposit_l (Word16 var1) {
   L_var_out = (Word32) var1;
 
 #if (WMOPS)
-  multiCounter[currCounter].L_deposit_l++;
+  BASOP_CNT.L_deposit_l++;
 #endif
   return (L_var_out);
 }
@@ -1771,7 +1781,7 @@ Word32 L_shr_r (Word32 L_var1, Word16 var2) {
     L_var_out = L_shr (L_var1, var2);
 
 #if (WMOPS)
-    multiCounter[currCounter].L_shr--;
+    BASOP_CNT.L_shr--;
 #endif
     if (var2 > 0) {
       if ((L_var1 & ((Word32) 1 << (var2 - 1))) != 0) {
@@ -1781,7 +1791,7 @@ Word32 L_shr_r (Word32 L_var1, Word16 var2) {
   }
 
 #if (WMOPS)
-  multiCounter[currCounter].L_shr_r++;
+  BASOP_CNT.L_shr_r++;
 #endif
   return (L_var_out);
 }
@@ -1829,7 +1839,7 @@ Word32 L_abs (Word32 L_var1) {
   }
 
 #if (WMOPS)
-  multiCounter[currCounter].L_abs++;
+  BASOP_CNT.L_abs++;
 #endif
   return (L_var_out);
 }
@@ -1882,7 +1892,7 @@ Word32 L_sat (Word32 L_var1) {
     Overflow = 0;
   }
 #if (WMOPS)
-  multiCounter[currCounter].L_sat++;
+  BASOP_CNT.L_sat++;
 #endif
   return (L_var_out);
 }
@@ -1939,7 +1949,7 @@ Word16 norm_s (Word16 var1) {
   }
 
 #if (WMOPS)
-  multiCounter[currCounter].norm_s++;
+  BASOP_CNT.norm_s++;
 #endif
   return (var_out);
 }
@@ -2005,8 +2015,8 @@ Word16 div_s (Word16 var1, Word16 var2) {
       L_denom = L_deposit_l (var2);
 
 #if (WMOPS)
-      multiCounter[currCounter].L_deposit_l--;
-      multiCounter[currCounter].L_deposit_l--;
+      BASOP_CNT.L_deposit_l--;
+      BASOP_CNT.L_deposit_l--;
 #endif
 
       for (iteration = 0; iteration < 15; iteration++) {
@@ -2017,8 +2027,8 @@ Word16 div_s (Word16 var1, Word16 var2) {
           L_num = L_sub (L_num, L_denom);
           var_out = add (var_out, 1);
 #if (WMOPS)
-          multiCounter[currCounter].L_sub--;
-          multiCounter[currCounter].add--;
+          BASOP_CNT.L_sub--;
+          BASOP_CNT.add--;
 #endif
         }
       }
@@ -2026,7 +2036,7 @@ Word16 div_s (Word16 var1, Word16 var2) {
   }
 
 #if (WMOPS)
-  multiCounter[currCounter].div_s++;
+  BASOP_CNT.div_s++;
 #endif
   return (var_out);
 }
@@ -2083,7 +2093,7 @@ Word16 norm_l (Word32 L_var1) {
   }
 
 #if (WMOPS)
-  multiCounter[currCounter].norm_l++;
+  BASOP_CNT.norm_l++;
 #endif
   return (var_out);
 }
@@ -2143,10 +2153,10 @@ Word32 L_mls (Word32 Lv, Word16 v) {
   Temp = L_mac (Temp, v, extract_h (Lv));
 
 #if (WMOPS)
-  multiCounter[currCounter].L_shr--;
-  multiCounter[currCounter].L_mac--;
-  multiCounter[currCounter].extract_h--;
-  multiCounter[currCounter].L_mls++;
+  BASOP_CNT.L_shr--;
+  BASOP_CNT.L_mac--;
+  BASOP_CNT.extract_h--;
+  BASOP_CNT.L_mls++;
 #endif
 
   return Temp;
@@ -2197,7 +2207,7 @@ Word16 div_l (Word32 L_num, Word16 den) {
   Word16 iteration;
 
 #if (WMOPS)
-  multiCounter[currCounter].div_l++;
+  BASOP_CNT.div_l++;
 #endif
 
   if (den == (Word16) 0) {
@@ -2212,7 +2222,7 @@ Word16 div_l (Word32 L_num, Word16 den) {
 
   L_den = L_deposit_h (den);
 #if (WMOPS)
-  multiCounter[currCounter].L_deposit_h--;
+  BASOP_CNT.L_deposit_h--;
 #endif
 
   if (L_num >= L_den) {
@@ -2221,21 +2231,21 @@ Word16 div_l (Word32 L_num, Word16 den) {
     L_num = L_shr (L_num, (Word16) 1);
     L_den = L_shr (L_den, (Word16) 1);
 #if (WMOPS)
-    multiCounter[currCounter].L_shr -= 2;
+    BASOP_CNT.L_shr -= 2;
 #endif
     for (iteration = (Word16) 0; iteration < (Word16) 15; iteration++) {
       var_out = shl (var_out, (Word16) 1);
       L_num = L_shl (L_num, (Word16) 1);
 #if (WMOPS)
-      multiCounter[currCounter].shl--;
-      multiCounter[currCounter].L_shl--;
+      BASOP_CNT.shl--;
+      BASOP_CNT.L_shl--;
 #endif
       if (L_num >= L_den) {
         L_num = L_sub (L_num, L_den);
         var_out = add (var_out, (Word16) 1);
 #if (WMOPS)
-        multiCounter[currCounter].L_sub--;
-        multiCounter[currCounter].add--;
+        BASOP_CNT.L_sub--;
+        BASOP_CNT.add--;
 #endif
       }
     }
@@ -2281,7 +2291,7 @@ Word16 i_mult (Word16 a, Word16 b) {
 #else
   Word32 register c = a * b;
 #if (WMOPS)
-  multiCounter[currCounter].i_mult++;
+  BASOP_CNT.i_mult++;
 #endif
   return saturate (c);
 #endif
@@ -2328,7 +2338,7 @@ Word32 L_mult0 (Word16 var1, Word16 var2) {
   L_var_out = (Word32) var1 *(Word32) var2;
 
 #if (WMOPS)
-  multiCounter[currCounter].L_mult0++;
+  BASOP_CNT.L_mult0++;
 #endif
   return (L_var_out);
 }
@@ -2372,9 +2382,9 @@ Word32 L_mac0 (Word32 L_var3, Word16 var1, Word16 var2) {
   L_var_out = L_add (L_var3, L_product);
 
 #if (WMOPS)
-  multiCounter[currCounter].L_mac0++;
-  multiCounter[currCounter].L_mult0--;
-  multiCounter[currCounter].L_add--;
+  BASOP_CNT.L_mac0++;
+  BASOP_CNT.L_mult0--;
+  BASOP_CNT.L_add--;
 #endif
   return (L_var_out);
 }
@@ -2418,12 +2428,14 @@ Word32 L_msu0 (Word32 L_var3, Word16 var1, Word16 var2) {
   L_var_out = L_sub (L_var3, L_product);
 
 #if (WMOPS)
-  multiCounter[currCounter].L_msu0++;
-  multiCounter[currCounter].L_mult0--;
-  multiCounter[currCounter].L_sub--;
+  BASOP_CNT.L_msu0++;
+  BASOP_CNT.L_mult0--;
+  BASOP_CNT.L_sub--;
 #endif
   return (L_var_out);
 }
 
+#endif /* ifndef BASOP_INLINE */
+
 
 /* end of file */
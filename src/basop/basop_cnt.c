@@ -291,6 +291,14 @@ const char basops[][20] = {     /* all basicop commands */
   "Mpy_32_16_uu",
   "norm_ul",
   "UL_deposit_l",
+  /* vector basic operators */
+  "V_L_mac",
+  "V_L_mac0",
+  "V_L_mac0_2",
+  "V_shl",
+  "V_mult_r",
+  "V_norm_s",
+  "V_max_abs",
   /* new control code STL basic operators */
   "LT_16",
   "GT_16",
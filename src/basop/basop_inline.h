@@ -0,0 +1,970 @@
+/*
+  ===========================================================================
+   File: BASOP_INLINE.H                                  v.2.4 - 17.Oct.2026
+  ===========================================================================
+
+            ITU-T STL  BASIC OPERATORS
+
+            INLINE IMPLEMENTATION OF THE 16/32, ENH1632, ENH32 AND
+            ENH64 OPERATORS
+
+   History:
+   17.Oct.26  v2.4      Created. Header-only static inline version of the
+                        operators of basop32.c, enh1632.c, enh32.c and
+                        enh64.c for counting-free builds (BASOP_INLINE).
+
+  ============================================================================
+*/
+
+/*
+ * This file is included at the end of basop32.h when BASOP_INLINE is
+ * defined; it must not be included directly. In that case the prototypes
+ * of basop32.h, enh1632.h, enh32.h and enh64.h are declared "static
+ * __inline" (see BASOP_API in typedef.h) and the bodies of basop32.c,
+ * enh1632.c, enh32.c and enh64.c are compiled out. BASOP_INLINE implies
+ * BASOP_NOCOUNT: no complexity is counted.
+ *
+ * All operators are bit-exact with the reference versions, including the
+ * setting of the Overflow and Carry flags. With GCC and Clang, the
+ * saturating additions use the overflow-checking builtins and the
+ * normalisation operators use the count-leading-zeros builtins, which
+ * map onto the native add/jo and lzcnt/bsr (or clz) instructions; the
+ * other compilers get portable C versions of the same algorithms.
+ *
+ * Every function is defined before its first use, so that the file only
+ * depends on typedef.h and on the declarations of basop32.h, whichever
+ * operator header has been included first.
+ */
+
+#ifndef _BASOP_INLINE_H
+#define _BASOP_INLINE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#if defined(__GNUC__) && (__GNUC__ >= 5 || defined(__clang__))
+#define BASOP_BUILTIN_OVERFLOW
+#endif
+
+#if defined(__GNUC__)
+#define BASOP_BUILTIN_CLZ
+#endif
+
+
+/*___________________________________________________________________________
+ |                                                                           |
+ |   Basic 16/32 bit operators (basop32.c)                                   |
+ |___________________________________________________________________________|
+*/
+
+static __inline Word16 basop_saturate (Word32 L_var1) {
+  if (L_var1 > 0X00007fffL) {
+    Overflow = 1;
+    return MAX_16;
+  }
+  if (L_var1 < (Word32) 0xffff8000L) {
+    Overflow = 1;
+    return MIN_16;
+  }
+  return (Word16) L_var1;
+}
+
+BASOP_API Word16 add (Word16 var1, Word16 var2) {
+  return basop_saturate ((Word32) var1 + var2);
+}
+
+BASOP_API Word16 sub (Word16 var1, Word16 var2) {
+  return basop_saturate ((Word32) var1 - var2);
+}
+
+BASOP_API Word16 abs_s (Word16 var1) {
+  if (var1 == (Word16) MIN_16)
+    return MAX_16;
+  return (var1 < 0) ? -var1 : var1;
+}
+
+BASOP_API Word16 extract_h (Word32 L_var1) {
+  return (Word16) (L_var1 >> 16);
+}
+
+BASOP_API Word16 extract_l (Word32 L_var1) {
+  return (Word16) L_var1;
+}
+
+BASOP_API Word32 L_deposit_h (Word16 var1) {
+  return (Word32) var1 << 16;
+}
+
+BASOP_API Word32 L_deposit_l (Word16 var1) {
+  return (Word32) var1;
+}
+
+/* shl() and shr() call each other for negative shift counts */
+BASOP_API Word16 shl (Word16 var1, Word16 var2);
+
+BASOP_API Word16 shr (Word16 var1, Word16 var2) {
+  if (var2 < 0) {
+    if (var2 < -16)
+      var2 = -16;
+    return shl (var1, (Word16) - var2);
+  }
+  if (var2 >= 15)
+    return (var1 < 0) ? -1 : 0;
+  if (var1 < 0)
+    return ~((~var1) >> var2);
+  return var1 >> var2;
+}
+
+BASOP_API Word16 shl (Word16 var1, Word16 var2) {
+  Word32 result;
+
+  if (var2 < 0) {
+    if (var2 < -16)
+      var2 = -16;
+    return shr (var1, (Word16) - var2);
+  }
+  if (var2 > 15) {
+    if (var1 == 0)
+      return 0;
+    Overflow = 1;
+    return (var1 > 0) ? MAX_16 : MIN_16;
+  }
+  result = (Word32) var1 *((Word32) 1 << var2);
+  if (result != (Word32) ((Word16) result)) {
+    Overflow = 1;
+    return (var1 > 0) ? MAX_16 : MIN_16;
+  }
+  return (Word16) result;
+}
+
+BASOP_API Word16 mult (Word16 var1, Word16 var2) {
+  Word32 L_product;
+
+  L_product = (Word32) var1 *(Word32) var2;
+  L_product = (L_product & (Word32) 0xffff8000L) >> 15;
+  if (L_product & (Word32) 0x00010000L)
+    L_product = L_product | (Word32) 0xffff0000L;
+  return basop_saturate (L_product);
+}
+
+BASOP_API Word16 mult_r (Word16 var1, Word16 var2) {
+  Word32 L_product_arr;
+
+  L_product_arr = (Word32) var1 *(Word32) var2;
+  L_product_arr += (Word32) 0x00004000L;
+  L_product_arr &= (Word32) 0xffff8000L;
+  L_product_arr >>= 15;
+  if (L_product_arr & (Word32) 0x00010000L)
+    L_product_arr |= (Word32) 0xffff0000L;
+  return basop_saturate (L_product_arr);
+}
+
+BASOP_API Word32 L_mult (Word16 var1, Word16 var2) {
+  Word32 L_var_out;
+
+  L_var_out = (Word32) var1 *(Word32) var2;
+  if (L_var_out != (Word32) 0x40000000L)
+    return L_var_out * 2;
+  Overflow = 1;
+  return MAX_32;
+}
+
+BASOP_API Word16 negate (Word16 var1) {
+  return (var1 == MIN_16) ? MAX_16 : -var1;
+}
+
+BASOP_API Word32 L_negate (Word32 L_var1) {
+  return (L_var1 == MIN_32) ? MAX_32 : -L_var1;
+}
+
+BASOP_API Word32 L_abs (Word32 L_var1) {
+  if (L_var1 == MIN_32)
+    return MAX_32;
+  return (L_var1 < 0) ? -L_var1 : L_var1;
+}
+
+BASOP_API Word32 L_add (Word32 L_var1, Word32 L_var2) {
+  Word32 L_var_out;
+
+#ifdef BASOP_BUILTIN_OVERFLOW
+  if (__builtin_add_overflow (L_var1, L_var2, &L_var_out)) {
+    L_var_out = (L_var1 < 0) ? MIN_32 : MAX_32;
+    Overflow = 1;
+  }
+#else
+  L_var_out = L_var1 + L_var2;
+  if (((L_var1 ^ L_var2) & MIN_32) == 0) {
+    if ((L_var_out ^ L_var1) & MIN_32) {
+      L_var_out = (L_var1 < 0) ? MIN_32 : MAX_32;
+      Overflow = 1;
+    }
+  }
+#endif
+  return L_var_out;
+}
+
+BASOP_API Word32 L_sub (Word32 L_var1, Word32 L_var2) {
+  Word32 L_var_out;
+
+#ifdef BASOP_BUILTIN_OVERFLOW
+  if (__builtin_sub_overflow (L_var1, L_var2, &L_var_out)) {
+    L_var_out = (L_var1 < 0L) ? MIN_32 : MAX_32;
+    Overflow = 1;
+  }
+#else
+  L_var_out = L_var1 - L_var2;
+  if (((L_var1 ^ L_var2) & MIN_32) != 0) {
+    if ((L_var_out ^ L_var1) & MIN_32) {
+      L_var_out = (L_var1 < 0L) ? MIN_32 : MAX_32;
+      Overflow = 1;
+    }
+  }
+#endif
+  return L_var_out;
+}
+
+BASOP_API Word32 L_add_c (Word32 L_var1, Word32 L_var2) {
+  Word32 L_var_out;
+  Word32 L_test;
+  Flag carry_int = 0;
+
+  L_var_out = L_var1 + L_var2 + Carry;
+
+  L_test = L_var1 + L_var2;
+
+  if ((L_var1 > 0) && (L_var2 > 0) && (L_test < 0)) {
+    Overflow = 1;
+    carry_int = 0;
+  } else {
+    if ((L_var1 < 0) && (L_var2 < 0)) {
+      if (L_test >= 0) {
+        Overflow = 1;
+        carry_int = 1;
+      } else {
+        Overflow = 0;
+        carry_int = 1;
+      }
+    } else {
+      if (((L_var1 ^ L_var2) < 0) && (L_test >= 0)) {
+        Overflow = 0;
+        carry_int = 1;
+      } else {
+        Overflow = 0;
+        carry_int = 0;
+      }
+    }
+  }
+
+  if (Carry) {
+    if (L_test == MAX_32) {
+      Overflow = 1;
+      Carry = carry_int;
+    } else {
+      if (L_test == (Word32) 0xFFFFFFFFL) {
+        Carry = 1;
+      } else {
+        Carry = carry_int;
+      }
+    }
+  } else {
+    Carry = carry_int;
+  }
+
+  return L_var_out;
+}
+
+BASOP_API Word32 L_sub_c (Word32 L_var1, Word32 L_var2) {
+  Word32 L_var_out;
+  Word32 L_test;
+  Flag carry_int = 0;
+
+  if (Carry) {
+    Carry = 0;
+    if (L_var2 != MIN_32) {
+      L_var_out = L_add_c (L_var1, -L_var2);
+    } else {
+      L_var_out = L_var1 - L_var2;
+      if (L_var1 > 0L) {
+        Overflow = 1;
+        Carry = 0;
+      }
+    }
+  } else {
+    L_var_out = L_var1 - L_var2 - (Word32) 0X00000001L;
+    L_test = L_var1 - L_var2;
+
+    if ((L_test < 0) && (L_var1 > 0) && (L_var2 < 0)) {
+      Overflow = 1;
+      carry_int = 0;
+    } else if ((L_test > 0) && (L_var1 < 0) && (L_var2 > 0)) {
+      Overflow = 1;
+      carry_int = 1;
+    } else if ((L_test > 0) && ((L_var1 ^ L_var2) > 0)) {
+      Overflow = 0;
+      carry_int = 1;
+    }
+    if (L_test == MIN_32) {
+      Overflow = 1;
+      Carry = carry_int;
+    } else {
+      Carry = carry_int;
+    }
+  }
+
+  return L_var_out;
+}
+
+BASOP_API Word16 round_fx (Word32 L_var1) {
+  return extract_h (L_add (L_var1, (Word32) 0x00008000L));
+}
+
+/*
+ * The multiply-accumulate operators keep the two saturation points of
+ * the reference (L_mult, then L_add/L_sub): L_mac(L_var3, MIN_16, MIN_16)
+ * with L_var3 < 0 must not saturate, for instance.
+ */
+BASOP_API Word32 L_mac (Word32 L_var3, Word16 var1, Word16 var2) {
+  return L_add (L_var3, L_mult (var1, var2));
+}
+
+BASOP_API Word32 L_msu (Word32 L_var3, Word16 var1, Word16 var2) {
+  return L_sub (L_var3, L_mult (var1, var2));
+}
+
+BASOP_API Word32 L_macNs (Word32 L_var3, Word16 var1, Word16 var2) {
+  return L_add_c (L_var3, L_mult (var1, var2));
+}
+
+BASOP_API Word32 L_msuNs (Word32 L_var3, Word16 var1, Word16 var2) {
+  return L_sub_c (L_var3, L_mult (var1, var2));
+}
+
+BASOP_API Word16 mac_r (Word32 L_var3, Word16 var1, Word16 var2) {
+  L_var3 = L_mac (L_var3, var1, var2);
+  return extract_h (L_add (L_var3, (Word32) 0x00008000L));
+}
+
+BASOP_API Word16 msu_r (Word32 L_var3, Word16 var1, Word16 var2) {
+  L_var3 = L_msu (L_var3, var1, var2);
+  return extract_h (L_add (L_var3, (Word32) 0x00008000L));
+}
+
+/* L_shl() and L_shr() call each other for negative shift counts */
+BASOP_API Word32 L_shl (Word32 L_var1, Word16 var2);
+
+BASOP_API Word32 L_shr (Word32 L_var1, Word16 var2) {
+  if (var2 < 0) {
+    if (var2 < -32)
+      var2 = -32;
+    return L_shl (L_var1, (Word16) - var2);
+  }
+  if (var2 >= 31)
+    return (L_var1 < 0L) ? -1 : 0;
+  if (L_var1 < 0)
+    return ~((~L_var1) >> var2);
+  return L_var1 >> var2;
+}
+
+/*
+ * The reference doubles L_var1 var2 times, saturating as soon as it
+ * leaves [0xc0000000, 0x3fffffff]; this is the same as checking once
+ * that L_var1 * 2^var2 is representable on 32 bits.
+ */
+BASOP_API Word32 L_shl (Word32 L_var1, Word16 var2) {
+  if (var2 <= 0) {
+    if (var2 < -32)
+      var2 = -32;
+    return L_shr (L_var1, (Word16) - var2);
+  }
+  if (var2 > 31) {
+    if (L_var1 == 0)
+      return 0;
+    Overflow = 1;
+    return (L_var1 > 0) ? MAX_32 : MIN_32;
+  }
+  if (L_var1 > (MAX_32 >> var2)) {
+    Overflow = 1;
+    return MAX_32;
+  }
+  if (L_var1 < -(MAX_32 >> var2) - 1) {
+    Overflow = 1;
+    return MIN_32;
+  }
+  return (Word32) ((UWord32) L_var1 << var2);
+}
+
+BASOP_API Word16 shr_r (Word16 var1, Word16 var2) {
+  Word16 var_out;
+
+  if (var2 > 15)
+    return 0;
+  var_out = shr (var1, var2);
+  if (var2 > 0) {
+    if ((var1 & ((Word16) 1 << (var2 - 1))) != 0)
+      var_out++;
+  }
+  return var_out;
+}
+
+BASOP_API Word32 L_shr_r (Word32 L_var1, Word16 var2) {
+  Word32 L_var_out;
+
+  if (var2 > 31)
+    return 0;
+  L_var_out = L_shr (L_var1, var2);
+  if (var2 > 0) {
+    if ((L_var1 & ((Word32) 1 << (var2 - 1))) != 0)
+      L_var_out++;
+  }
+  return L_var_out;
+}
+
+BASOP_API Word32 L_sat (Word32 L_var1) {
+  Word32 L_var_out;
+
+  L_var_out = L_var1;
+  if (Overflow) {
+    L_var_out = (Carry) ? MIN_32 : MAX_32;
+    Carry = 0;
+    Overflow = 0;
+  }
+  return L_var_out;
+}
+
+BASOP_API Word16 norm_s (Word16 var1) {
+  Word16 var_out;
+
+  if (var1 == 0)
+    return 0;
+  if (var1 == (Word16) 0xffff)
+    return 15;
+  if (var1 < 0)
+    var1 = ~var1;
+#ifdef BASOP_BUILTIN_CLZ
+  var_out = (Word16) (__builtin_clz ((unsigned int) var1) - 17);
+#else
+  for (var_out = 0; var1 < 0x4000; var_out++)
+    var1 <<= 1;
+#endif
+  return var_out;
+}
+
+BASOP_API Word16 norm_l (Word32 L_var1) {
+  Word16 var_out;
+
+  if (L_var1 == 0)
+    return 0;
+  if (L_var1 == (Word32) 0xffffffffL)
+    return 31;
+  if (L_var1 < 0)
+    L_var1 = ~L_var1;
+#ifdef BASOP_BUILTIN_CLZ
+  var_out = (Word16) (__builtin_clz ((unsigned int) L_var1) - 1);
+#else
+  for (var_out = 0; L_var1 < (Word32) 0x40000000L; var_out++)
+    L_var1 <<= 1;
+#endif
+  return var_out;
+}
+
+BASOP_API Word16 div_s (Word16 var1, Word16 var2) {
+  Word16 var_out = 0;
+  Word16 iteration;
+  Word32 L_num;
+  Word32 L_denom;
+
+  if ((var1 > var2) || (var1 < 0) || (var2 < 0)) {
+    printf ("Division Error var1=%d  var2=%d\n", var1, var2);
+    abort ();                   /* exit (0); */
+  }
+  if (var2 == 0) {
+    printf ("Division by 0, Fatal error \n");
+    abort ();                   /* exit (0); */
+  }
+  if (var1 == 0)
+    return 0;
+  if (var1 == var2)
+    return MAX_16;
+
+  L_num = L_deposit_l (var1);
+  L_denom = L_deposit_l (var2);
+  for (iteration = 0; iteration < 15; iteration++) {
+    var_out <<= 1;
+    L_num <<= 1;
+    if (L_num >= L_denom) {
+      L_num = L_sub (L_num, L_denom);
+      var_out = add (var_out, 1);
+    }
+  }
+  return var_out;
+}
+
+BASOP_API Word32 L_mls (Word32 Lv, Word16 v) {
+  Word32 Temp;
+
+  Temp = Lv & (Word32) 0x0000ffff;
+  Temp = Temp * (Word32) v;
+  Temp = L_shr (Temp, (Word16) 15);
+  Temp = L_mac (Temp, v, extract_h (Lv));
+  return Temp;
+}
+
+BASOP_API Word16 div_l (Word32 L_num, Word16 den) {
+  Word16 var_out = (Word16) 0;
+  Word32 L_den;
+  Word16 iteration;
+
+  if (den == (Word16) 0) {
+    printf ("Division by 0 in div_l, Fatal error \n");
+    exit (0);
+  }
+  if ((L_num < (Word32) 0) || (den < (Word16) 0)) {
+    printf ("Division Error in div_l, Fatal error \n");
+    exit (0);
+  }
+
+  L_den = L_deposit_h (den);
+  if (L_num >= L_den)
+    return MAX_16;
+
+  L_num = L_shr (L_num, (Word16) 1);
+  L_den = L_shr (L_den, (Word16) 1);
+  for (iteration = (Word16) 0; iteration < (Word16) 15; iteration++) {
+    var_out = shl (var_out, (Word16) 1);
+    L_num = L_shl (L_num, (Word16) 1);
+    if (L_num >= L_den) {
+      L_num = L_sub (L_num, L_den);
+      var_out = add (var_out, (Word16) 1);
+    }
+  }
+  return var_out;
+}
+
+BASOP_API Word16 i_mult (Word16 a, Word16 b) {
+#ifdef ORIGINAL_G7231
+  return a * b;
+#else
+  return basop_saturate ((Word32) a * b);
+#endif
+}
+
+BASOP_API Word32 L_mult0 (Word16 var1, Word16 var2) {
+  return (Word32) var1 *(Word32) var2;
+}
+
+BASOP_API Word32 L_mac0 (Word32 L_var3, Word16 var1, Word16 var2) {
+  return L_add (L_var3, L_mult0 (var1, var2));
+}
+
+BASOP_API Word32 L_msu0 (Word32 L_var3, Word16 var1, Word16 var2) {
+  return L_sub (L_var3, L_mult0 (var1, var2));
+}
+
+
+/*___________________________________________________________________________
+ |                                                                           |
+ |   Enhanced 16/32 bit operators (enh1632.c)                                |
+ |___________________________________________________________________________|
+*/
+
+/* lshl() and lshr() call each other for negative shift counts */
+BASOP_API Word16 lshl (Word16 var1, Word16 var2);
+BASOP_API Word32 L_lshl (Word32 L_var1, Word16 var2);
+
+BASOP_API Word16 lshr (Word16 var1, Word16 var2) {
+  Word16 var_out;
+
+  if (var2 < 0)
+    return lshl (var1, (Word16) - var2);
+  if (var2 == 0 || var1 == 0)
+    return var1;
+  if (var2 >= 16)
+    return 0;
+  var_out = var1 >> 1;
+  var_out = var_out & 0x7fff;
+  var_out = var_out >> (var2 - 1);
+  return var_out;
+}
+
+BASOP_API Word16 lshl (Word16 var1, Word16 var2) {
+  if (var2 < 0)
+    return lshr (var1, (Word16) - var2);
+  if (var2 == 0 || var1 == 0)
+    return var1;
+  if (var2 >= 16)
+    return 0;
+  return var1 << var2;
+}
+
+BASOP_API Word32 L_lshr (Word32 L_var1, Word16 var2) {
+  Word32 L_var_out;
+
+  if (var2 < 0)
+    return L_lshl (L_var1, (Word16) - var2);
+  if (var2 == 0 || L_var1 == 0)
+    return L_var1;
+  if (var2 >= 32)
+    return 0;
+  L_var_out = L_var1 >> 1;
+  L_var_out = L_var_out & 0x7fffffff;
+  L_var_out = L_var_out >> (var2 - 1);
+  return L_var_out;
+}
+
+BASOP_API Word32 L_lshl (Word32 L_var1, Word16 var2) {
+  if (var2 < 0)
+    return L_lshr (L_var1, (Word16) - var2);
+  if (var2 == 0 || L_var1 == 0)
+    return L_var1;
+  if (var2 >= 32)
+    return 0;
+  return L_var1 << var2;
+}
+
+BASOP_API Word16 shl_r (Word16 var1, Word16 var2) {
+  if (var2 >= 0)
+    return shl (var1, var2);
+  return shr_r (var1, (Word16) - var2);
+}
+
+BASOP_API Word32 L_shl_r (Word32 L_var1, Word16 var2) {
+  if (var2 >= 0)
+    return L_shl (L_var1, var2);
+  return L_shr_r (L_var1, (Word16) - var2);
+}
+
+/* s_and(), s_or() and L_or() of enh1632.h are plain bitwise operators */
+BASOP_API Word16 rotr (Word16 var1, Word16 var2, Word16 * var3) {
+  *var3 = var1 & 0x1;
+  return lshr (var1, 1) | lshl (var2, 15);
+}
+
+BASOP_API Word16 rotl (Word16 var1, Word16 var2, Word16 * var3) {
+  *var3 = lshr (var1, 15);
+  return lshl (var1, 1) | (var2 & 0x1);
+}
+
+BASOP_API Word32 L_rotr (Word32 L_var1, Word16 var2, Word16 * var3) {
+  *var3 = extract_l (L_var1) & 0x1;
+  return L_lshr (L_var1, 1) | L_lshl (L_deposit_l (var2), 31);
+}
+
+BASOP_API Word32 L_rotl (Word32 L_var1, Word16 var2, Word16 * var3) {
+  *var3 = extract_l (L_lshr (L_var1, 31));
+  return L_lshl (L_var1, 1) | L_deposit_l (var2 & 0x1);
+}
+
+
+/*___________________________________________________________________________
+ |                                                                           |
+ |   Enhanced 64 bit operators (enh64.c)                                     |
+ |___________________________________________________________________________|
+*/
+/* Same definitions as in enh64.h, which may not have been read yet */
+#ifndef Word64
+#define Word64 long long int
+#endif
+
+#ifndef UWord64
+#define UWord64 unsigned long long int
+#endif
+
+#ifdef ENH_64_BIT_OPERATOR
+
+#define MAX_64 (Word64)0x7fffffffffffffffLL
+#define MIN_64 (Word64)0x8000000000000000LL
+
+BASOP_API Word64 W_add_nosat (Word64 L64_var1, Word64 L64_var2) {
+  return L64_var1 + L64_var2;
+}
+
+BASOP_API Word64 W_sub_nosat (Word64 L64_var1, Word64 L64_var2) {
+  return L64_var1 - L64_var2;
+}
+
+/* Same closed form as L_shl() for the saturating loop of the reference */
+BASOP_API Word64 W_shl (Word64 L64_var1, Word16 var2) {
+  if (var2 <= 0) {
+    if (var2 < -64)
+      var2 = -64;
+    var2 = -var2;
+    return L64_var1 >> var2;
+  }
+  if (var2 > 63) {
+    if (L64_var1 == 0)
+      return 0;
+    Overflow = 1;
+    return (L64_var1 > 0) ? MAX_64 : MIN_64;
+  }
+  if (L64_var1 > (MAX_64 >> var2)) {
+    Overflow = 1;
+    return MAX_64;
+  }
+  if (L64_var1 < -(MAX_64 >> var2) - 1) {
+    Overflow = 1;
+    return MIN_64;
+  }
+  return (Word64) ((UWord64) L64_var1 << var2);
+}
+
+BASOP_API Word64 W_shr (Word64 L64_var1, Word16 var2) {
+  if (var2 < 0)
+    return W_shl (L64_var1, (Word16) - var2);
+  return L64_var1 >> var2;
+}
+
+BASOP_API Word64 W_shl_nosat (Word64 L64_var1, Word16 var2) {
+  if (var2 <= 0)
+    return L64_var1 >> (-var2);
+  return L64_var1 << var2;
+}
+
+BASOP_API Word64 W_shr_nosat (Word64 L64_var1, Word16 var2) {
+  if (var2 < 0)
+    return L64_var1 << (-var2);
+  return L64_var1 >> var2;
+}
+
+BASOP_API Word64 W_mac_32_16 (Word64 L64_var1, Word32 L_var2, Word16 var3) {
+  return L64_var1 + (((Word64) L_var2 * var3) << 1);
+}
+
+BASOP_API Word64 W_msu_32_16 (Word64 L64_var1, Word32 L_var2, Word16 var3) {
+  return L64_var1 - (((Word64) L_var2 * var3) << 1);
+}
+
+BASOP_API Word64 W_mult_32_16 (Word32 L_var1, Word16 var2) {
+  return ((Word64) L_var1 * var2) << 1;
+}
+
+BASOP_API Word64 W_mult0_16_16 (Word16 var1, Word16 var2) {
+  return (Word64) var1 *var2;
+}
+
+BASOP_API Word64 W_mac0_16_16 (Word64 L64_var1, Word16 var2, Word16 var3) {
+  return L64_var1 + (Word64) var2 *var3;
+}
+
+BASOP_API Word64 W_msu0_16_16 (Word64 L64_var1, Word16 var2, Word16 var3) {
+  return L64_var1 - (Word64) var2 *var3;
+}
+
+BASOP_API Word32 W_sat_l (Word64 L64_var) {
+  if (L64_var > 0x7FFFFFFF)
+    return 0x7FFFFFFF;
+  if (L64_var < (int) 0x80000000)
+    return 0x80000000;
+  return (Word32) L64_var;
+}
+
+BASOP_API Word32 W_sat_m (Word64 L64_var) {
+  return W_sat_l (L64_var >> 16);
+}
+
+BASOP_API Word64 W_deposit32_l (Word32 L_var1) {
+  return (Word64) L_var1;
+}
+
+BASOP_API Word64 W_deposit32_h (Word32 L_var1) {
+  return (Word64) L_var1 << 32;
+}
+
+BASOP_API Word32 W_extract_l (Word64 L64_var1) {
+  return (Word32) L64_var1;
+}
+
+BASOP_API Word32 W_extract_h (Word64 L64_var1) {
+  return (Word32) (L64_var1 >> 32);
+}
+
+BASOP_API Word64 W_mult_16_16 (Word16 var1, Word16 var2) {
+  return ((Word64) var1 * var2) << 1;
+}
+
+BASOP_API Word64 W_mac_16_16 (Word64 L64_acc, Word16 var1, Word16 var2) {
+  return L64_acc + (((Word64) var1 * var2) << 1);
+}
+
+BASOP_API Word64 W_msu_16_16 (Word64 L64_var1, Word16 var2, Word16 var3) {
+  return L64_var1 - (((Word64) var2 * var3) << 1);
+}
+
+BASOP_API Word32 W_shl_sat_l (Word64 L64_var, Word32 n) {
+  return W_sat_l (W_shl (L64_var, (Word16) n));
+}
+
+BASOP_API Word64 W_add (Word64 L64_var1, Word64 L64_var2) {
+  Word64 L64_var_out;
+
+#ifdef BASOP_BUILTIN_OVERFLOW
+  if (__builtin_add_overflow (L64_var1, L64_var2, &L64_var_out)) {
+    L64_var_out = (L64_var1 < 0) ? MIN_64 : MAX_64;
+    Overflow = 1;
+  }
+#else
+  L64_var_out = L64_var1 + L64_var2;
+  if (((L64_var1 ^ L64_var2) & MIN_64) == 0) {
+    if ((L64_var_out ^ L64_var1) & MIN_64) {
+      L64_var_out = (L64_var1 < 0) ? MIN_64 : MAX_64;
+      Overflow = 1;
+    }
+  }
+#endif
+  return L64_var_out;
+}
+
+BASOP_API Word64 W_sub (Word64 L64_var1, Word64 L64_var2) {
+  Word64 L64_var_out;
+
+#ifdef BASOP_BUILTIN_OVERFLOW
+  if (__builtin_sub_overflow (L64_var1, L64_var2, &L64_var_out)) {
+    L64_var_out = (L64_var1 < 0) ? MIN_64 : MAX_64;
+    Overflow = 1;
+  }
+#else
+  L64_var_out = L64_var1 - L64_var2;
+  if (((L64_var1 ^ L64_var2) & MIN_64) != 0) {
+    if ((L64_var_out ^ L64_var1) & MIN_64) {
+      L64_var_out = (L64_var1 < 0) ? MIN_64 : MAX_64;
+      Overflow = 1;
+    }
+  }
+#endif
+  return L64_var_out;
+}
+
+/* W_round48_L() and W_round32_s() add the rounding bit with saturation */
+BASOP_API Word32 W_round48_L (Word64 L64_var1) {
+  return W_extract_h (W_add (W_shl (L64_var1, 16), (Word64) 0x80000000LL));
+}
+
+BASOP_API Word16 W_round32_s (Word64 L64_var1) {
+  return extract_h (W_extract_h (W_add (W_shl (L64_var1, 16), (Word64) 0x800000000000LL)));
+}
+
+BASOP_API Word16 W_norm (Word64 L64_var1) {
+  Word16 var_out;
+
+  if (L64_var1 == 0)
+    return 0;
+  if (L64_var1 == (Word64) 0xffffffffffffffffLL)
+    return 63;
+  if (L64_var1 < 0)
+    L64_var1 = ~L64_var1;
+#ifdef BASOP_BUILTIN_CLZ
+  var_out = (Word16) (__builtin_clzll ((unsigned long long) L64_var1) - 1);
+#else
+  for (var_out = 0; L64_var1 < (Word64) 0x4000000000000000LL; var_out++)
+    L64_var1 <<= 1;
+#endif
+  return var_out;
+}
+
+BASOP_API Word64 W_neg (Word64 L64_var1) {
+  if (L64_var1 == MIN_64) {
+    Overflow = 1;
+    return MAX_64;
+  }
+  return -L64_var1;
+}
+
+BASOP_API Word64 W_abs (Word64 L64_var1) {
+  if (L64_var1 == MIN_64) {
+    Overflow = 1;
+    return MAX_64;
+  }
+  return (L64_var1 < 0) ? -L64_var1 : L64_var1;
+}
+
+BASOP_API Word64 W_mult_32_32 (Word32 L_var1, Word32 L_var2) {
+  if ((L_var1 == MIN_32) && (L_var2 == MIN_32)) {
+    Overflow = 1;
+    return MAX_64;
+  }
+  return ((Word64) L_var1 * L_var2) << 1;
+}
+
+BASOP_API Word64 W_mult0_32_32 (Word32 L_var1, Word32 L_var2) {
+  return (Word64) L_var1 *L_var2;
+}
+
+BASOP_API UWord64 W_lshl (UWord64 L64_var1, Word16 var2) {
+  if (var2 < 0)
+    return L64_var1 >> (-var2);
+  return L64_var1 << var2;
+}
+
+BASOP_API UWord64 W_lshr (UWord64 L64_var1, Word16 var2) {
+  if (var2 < 0)
+    return L64_var1 << (-var2);
+  return L64_var1 >> var2;
+}
+
+BASOP_API Word32 W_round64_L (Word64 L64_var1) {
+  return W_extract_h (W_add (L64_var1, (Word64) 0x80000000));
+}
+
+#endif /* ifdef ENH_64_BIT_OPERATOR */
+
+
+/*___________________________________________________________________________
+ |                                                                           |
+ |   Enhanced 32 bit operators (enh32.c)                                     |
+ |___________________________________________________________________________|
+*/
+#ifdef ENH_32_BIT_OPERATOR
+
+BASOP_API Word32 Mpy_32_16_1 (Word32 L_var1, Word16 var2) {
+  return W_sat_m (W_mult_32_16 (L_var1, var2));
+}
+
+BASOP_API Word32 Mpy_32_16_r (Word32 L_var1, Word16 var2) {
+  return W_round48_L (W_mult_32_16 (L_var1, var2));
+}
+
+BASOP_API Word32 Mpy_32_32 (Word32 L_var1, Word32 L_var2) {
+  return W_extract_h (W_shl ((Word64) L_var1 * L_var2, 1));
+}
+
+BASOP_API Word32 Mpy_32_32_r (Word32 L_var1, Word32 L_var2) {
+  return W_round48_L (W_shr ((Word64) L_var1 * L_var2, 15));
+}
+
+BASOP_API Word32 Madd_32_16 (Word32 L_var3, Word32 L_var1, Word16 var2) {
+  return L_add (L_var3, Mpy_32_16_1 (L_var1, var2));
+}
+
+BASOP_API Word32 Madd_32_16_r (Word32 L_var3, Word32 L_var1, Word16 var2) {
+  return L_add (L_var3, Mpy_32_16_r (L_var1, var2));
+}
+
+BASOP_API Word32 Msub_32_16 (Word32 L_var3, Word32 L_var1, Word16 var2) {
+  return L_sub (L_var3, Mpy_32_16_1 (L_var1, var2));
+}
+
+BASOP_API Word32 Msub_32_16_r (Word32 L_var3, Word32 L_var1, Word16 var2) {
+  return L_sub (L_var3, Mpy_32_16_r (L_var1, var2));
+}
+
+BASOP_API Word32 Madd_32_32 (Word32 L_var3, Word32 L_var1, Word32 L_var2) {
+  return L_add (L_var3, Mpy_32_32 (L_var1, L_var2));
+}
+
+BASOP_API Word32 Madd_32_32_r (Word32 L_var3, Word32 L_var1, Word32 L_var2) {
+  return L_add (L_var3, Mpy_32_32_r (L_var1, L_var2));
+}
+
+BASOP_API Word32 Msub_32_32 (Word32 L_var3, Word32 L_var1, Word32 L_var2) {
+  return L_sub (L_var3, Mpy_32_32 (L_var1, L_var2));
+}
+
+BASOP_API Word32 Msub_32_32_r (Word32 L_var3, Word32 L_var1, Word32 L_var2) {
+  return L_sub (L_var3, Mpy_32_32_r (L_var1, L_var2));
+}
+
+#endif /* ifdef ENH_32_BIT_OPERATOR */
+
+#endif /* ifndef _BASOP_INLINE_H */
+
+
+/* end of file */
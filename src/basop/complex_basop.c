@@ -20,9 +20,9 @@
 
 #if (WMOPS)
 
-extern BASIC_OP multiCounter[MAXCOUNTERS];
+extern BASOP_TLS BASIC_OP multiCounter[MAXCOUNTERS];
 
-extern int currCounter;
+extern BASOP_TLS int currCounter;
 
 #endif /* if WMOPS */
 
@@ -37,9 +37,9 @@ cmplx CL_shr (cmplx inp, Word32 shift_val) {
   out.re = L_shr (inp.re, shift_val);
   out.im = L_shr (inp.im, shift_val);
 #if (WMOPS)
-  multiCounter[currCounter].CL_shr++;
-  multiCounter[currCounter].L_shr--;
-  multiCounter[currCounter].L_shr--;
+  BASOP_CNT.CL_shr++;
+  BASOP_CNT.L_shr--;
+  BASOP_CNT.L_shr--;
 #endif  
   return out;
 }
@@ -49,9 +49,9 @@ cmplx CL_shl (cmplx inp, Word32 shift_val) {
   out.re = L_shl (inp.re, shift_val);
   out.im = L_shl (inp.im, shift_val);
 #if (WMOPS)
-  multiCounter[currCounter].CL_shl++;
-  multiCounter[currCounter].L_shl--;
-  multiCounter[currCounter].L_shl--;
+  BASOP_CNT.CL_shl++;
+  BASOP_CNT.L_shl--;
+  BASOP_CNT.L_shl--;
 #endif
   return out;
 }
@@ -61,9 +61,9 @@ cmplx CL_add (cmplx inp1, cmplx inp2) {
   out.re = L_add (inp1.re, inp2.re);
   out.im = L_add (inp1.im, inp2.im);
 #if (WMOPS)
-  multiCounter[currCounter].CL_add++;
-  multiCounter[currCounter].L_add--;
-  multiCounter[currCounter].L_add--;
+  BASOP_CNT.CL_add++;
+  BASOP_CNT.L_add--;
+  BASOP_CNT.L_add--;
 #endif
   return out;
 }
@@ -73,9 +73,9 @@ cmplx CL_sub (cmplx inp1, cmplx inp2) {
   out.re = L_sub (inp1.re, inp2.re);
   out.im = L_sub (inp1.im, inp2.im);
 #if (WMOPS)
-  multiCounter[currCounter].CL_sub++;
-  multiCounter[currCounter].L_sub--;
-  multiCounter[currCounter].L_sub--;
+  BASOP_CNT.CL_sub++;
+  BASOP_CNT.L_sub--;
+  BASOP_CNT.L_sub--;
 #endif
   return out;
 }
@@ -85,9 +85,9 @@ cmplx CL_scale(cmplx x, Word16 y) {
   result.re = Mpy_32_16_r (x.re, y);
   result.im = Mpy_32_16_r (x.im, y);
 #if (WMOPS)
-  multiCounter[currCounter].Mpy_32_16_r--;
-  multiCounter[currCounter].Mpy_32_16_r--;
-  multiCounter[currCounter].CL_scale++;
+  BASOP_CNT.Mpy_32_16_r--;
+  BASOP_CNT.Mpy_32_16_r--;
+  BASOP_CNT.CL_scale++;
 #endif/* #if (WMOPS) */
   return (result);
 }
@@ -97,9 +97,9 @@ cmplx CL_dscale (cmplx x, Word16 y1, Word16 y2) {
   result.re = Mpy_32_16_r (x.re, y1);
   result.im = Mpy_32_16_r (x.im, y2);
 #if (WMOPS)
-  multiCounter[currCounter].Mpy_32_16_r--;
-  multiCounter[currCounter].Mpy_32_16_r--;
-  multiCounter[currCounter].CL_dscale++;
+  BASOP_CNT.Mpy_32_16_r--;
+  BASOP_CNT.Mpy_32_16_r--;
+  BASOP_CNT.CL_dscale++;
 #endif/* #if (WMOPS) */
   return (result);
 }
@@ -109,9 +109,9 @@ cmplx CL_msu_j (cmplx x, cmplx y) {
   result.re = L_add (x.re, y.im);
   result.im = L_sub (x.im, y.re);
 #if (WMOPS)
-  multiCounter[currCounter].CL_msu_j++;
-  multiCounter[currCounter].L_add--;
-  multiCounter[currCounter].L_sub--;
+  BASOP_CNT.CL_msu_j++;
+  BASOP_CNT.L_add--;
+  BASOP_CNT.L_sub--;
 #endif          
   return result;
 }
@@ -121,30 +121,30 @@ cmplx CL_mac_j (cmplx x, cmplx y) {
   result.re = L_sub (x.re, y.im );
   result.im = L_add (x.im, y.re );
 #if (WMOPS)
-  multiCounter[currCounter].CL_mac_j++;
-  multiCounter[currCounter].L_add--;
-  multiCounter[currCounter].L_sub--;
+  BASOP_CNT.CL_mac_j++;
+  BASOP_CNT.L_add--;
+  BASOP_CNT.L_sub--;
 #endif            
   return result;
 }
 
 cmplx CL_move (cmplx x) {
 #if (WMOPS)
-  multiCounter[currCounter].CL_move++;
+  BASOP_CNT.CL_move++;
 #endif            
   return x;
 }
 
 Word32 CL_Extract_real (cmplx x) {
 #if (WMOPS)
-  multiCounter[currCounter].CL_Extract_real++;
+  BASOP_CNT.CL_Extract_real++;
 #endif            
   return x.re;
 }
 
 Word32 CL_Extract_imag (cmplx x) {
 #if (WMOPS)
-  multiCounter[currCounter].CL_Extract_imag++;
+  BASOP_CNT.CL_Extract_imag++;
 #endif            
   return x.im;
 }
@@ -154,7 +154,7 @@ cmplx CL_form (Word32 re, Word32 im) {
   result.re = re;
   result.im = im;
 #if (WMOPS)
-  multiCounter[currCounter].CL_form++;
+  BASOP_CNT.CL_form++;
 #endif          
   return result;
 }
@@ -164,15 +164,15 @@ cmplx CL_multr_32x16 (cmplx input, cmplx_s coeff) {
   result.re = W_round48_L (W_sub_nosat (W_mult_32_16 (input.re, coeff.re), W_mult_32_16 (input.im, coeff.im) ) );
   result.im = W_round48_L (W_add_nosat (W_mult_32_16 (input.re, coeff.im), W_mult_32_16 (input.im, coeff.re) ) );
 #if (WMOPS)
-  multiCounter[currCounter].CL_multr_32x16++;
-  multiCounter[currCounter].W_mult_32_16--;
-  multiCounter[currCounter].W_mult_32_16--;
-  multiCounter[currCounter].W_mult_32_16--;
-  multiCounter[currCounter].W_mult_32_16--;
-  multiCounter[currCounter].W_sub_nosat--;
-  multiCounter[currCounter].W_add_nosat--;
-  multiCounter[currCounter].W_round48_L--;
-  multiCounter[currCounter].W_round48_L--;
+  BASOP_CNT.CL_multr_32x16++;
+  BASOP_CNT.W_mult_32_16--;
+  BASOP_CNT.W_mult_32_16--;
+  BASOP_CNT.W_mult_32_16--;
+  BASOP_CNT.W_mult_32_16--;
+  BASOP_CNT.W_sub_nosat--;
+  BASOP_CNT.W_add_nosat--;
+  BASOP_CNT.W_round48_L--;
+  BASOP_CNT.W_round48_L--;
 #endif          
   return result;
 }
@@ -182,9 +182,9 @@ cmplx CL_negate(cmplx x) {
   result.re = L_negate (x.re);
   result.im = L_negate (x.im);
 #if (WMOPS)
-  multiCounter[currCounter].CL_negate++;
-  multiCounter[currCounter].L_negate--;
-  multiCounter[currCounter].L_negate--;
+  BASOP_CNT.CL_negate++;
+  BASOP_CNT.L_negate--;
+  BASOP_CNT.L_negate--;
 #endif          
   return result;
 }
@@ -194,8 +194,8 @@ cmplx CL_conjugate (cmplx x) {
   result.re = x.re;
   result.im = L_negate (x.im);
 #if (WMOPS)
-  multiCounter[currCounter].CL_conjugate++;
-  multiCounter[currCounter].L_negate--;
+  BASOP_CNT.CL_conjugate++;
+  BASOP_CNT.L_negate--;
 #endif          
   return result;
 }
@@ -207,8 +207,8 @@ cmplx CL_mul_j (cmplx input) {
   result.re = temp.im;
   result.im = input.re;
 #if (WMOPS)
-  multiCounter[currCounter].CL_mul_j++;  
-  multiCounter[currCounter].CL_negate--;  
+  BASOP_CNT.CL_mul_j++;  
+  BASOP_CNT.CL_negate--;  
 #endif          
   return result;
 }
@@ -218,7 +218,7 @@ cmplx CL_swap_real_imag (cmplx input) {
   result.re = input.im;
   result.im = input.re;
 #if (WMOPS)
-  multiCounter[currCounter].CL_swap_real_imag++;  
+  BASOP_CNT.CL_swap_real_imag++;  
 #endif            
   return result;
 }
@@ -229,9 +229,9 @@ cmplx_s C_add (cmplx_s inp1, cmplx_s inp2) {
   out.im = add (inp1.im, inp2.im);
 
 #if (WMOPS)
-  multiCounter[currCounter].C_add++;
-  multiCounter[currCounter].add--;
-  multiCounter[currCounter].add--;
+  BASOP_CNT.C_add++;
+  BASOP_CNT.add--;
+  BASOP_CNT.add--;
 #endif    
   return out;
 }
@@ -242,9 +242,9 @@ cmplx_s C_sub (cmplx_s inp1, cmplx_s inp2) {
   out.im = sub (inp1.im, inp2.im);
 
 #if (WMOPS)
-  multiCounter[currCounter].C_sub++;
-  multiCounter[currCounter].sub--;
-  multiCounter[currCounter].sub--;
+  BASOP_CNT.C_sub++;
+  BASOP_CNT.sub--;
+  BASOP_CNT.sub--;
 #endif      
   return out;
 }
@@ -257,8 +257,8 @@ cmplx_s C_mul_j (cmplx_s input) {
   result.im = input.re;
 
 #if (WMOPS)
-  multiCounter[currCounter].C_mul_j++;
-  multiCounter[currCounter].negate--;
+  BASOP_CNT.C_mul_j++;
+  BASOP_CNT.negate--;
 #endif      
   return result;
 }
@@ -269,17 +269,17 @@ cmplx_s C_multr (cmplx_s x, cmplx_s c) {
   result.im = round_fx (W_sat_l (W_add_nosat (W_mult_16_16 (x.im, c.re), W_mult_16_16 (x.re, c.im) ) ) );
 
 #if (WMOPS)
-  multiCounter[currCounter].C_multr++;
-  multiCounter[currCounter].W_mult_16_16--;
-  multiCounter[currCounter].W_mult_16_16--;
-  multiCounter[currCounter].W_mult_16_16--;
-  multiCounter[currCounter].W_mult_16_16--;
-  multiCounter[currCounter].W_sub_nosat--;
-  multiCounter[currCounter].W_add_nosat--;
-  multiCounter[currCounter].W_sat_l--;
-  multiCounter[currCounter].W_sat_l--;  
-  multiCounter[currCounter].round--;
-  multiCounter[currCounter].round--;
+  BASOP_CNT.C_multr++;
+  BASOP_CNT.W_mult_16_16--;
+  BASOP_CNT.W_mult_16_16--;
+  BASOP_CNT.W_mult_16_16--;
+  BASOP_CNT.W_mult_16_16--;
+  BASOP_CNT.W_sub_nosat--;
+  BASOP_CNT.W_add_nosat--;
+  BASOP_CNT.W_sat_l--;
+  BASOP_CNT.W_sat_l--;  
+  BASOP_CNT.round--;
+  BASOP_CNT.round--;
 #endif      
   return result;
 }
@@ -289,7 +289,7 @@ cmplx_s C_form ( Word16 re, Word16 im) {
   result.re = re;
   result.im = im;
 #if (WMOPS)
-  multiCounter[currCounter].C_form++;
+  BASOP_CNT.C_form++;
 #endif          
   return result;
 }
@@ -299,9 +299,9 @@ cmplx C_scale(cmplx_s x, Word16 y) {
   result.re = L_mult(x.re, y);
   result.im = L_mult(x.im, y);
 #if (WMOPS)
-  multiCounter[currCounter].L_mult--;
-  multiCounter[currCounter].L_mult--;
-  multiCounter[currCounter].C_scale++;
+  BASOP_CNT.L_mult--;
+  BASOP_CNT.L_mult--;
+  BASOP_CNT.C_scale++;
 #endif/* #if (WMOPS) */
   return (result);
 }
@@ -312,9 +312,9 @@ cmplx_s CL_round32_16 (cmplx x) {
   result.im = round_fx (x.im);
 
 #if (WMOPS)
-  multiCounter[currCounter].CL_round32_16++;
-  multiCounter[currCounter].round--;
-  multiCounter[currCounter].round--;
+  BASOP_CNT.CL_round32_16++;
+  BASOP_CNT.round--;
+  BASOP_CNT.round--;
 #endif      
   return result;
 }
@@ -324,9 +324,9 @@ cmplx CL_scale_32 (cmplx x, Word32 y) {
   result.re = Mpy_32_32_r (x.re, y);
   result.im = Mpy_32_32_r (x.im, y);
 #if (WMOPS)
-  multiCounter[currCounter].Mpy_32_32_r--;
-  multiCounter[currCounter].Mpy_32_32_r--;
-  multiCounter[currCounter].CL_scale_32++;
+  BASOP_CNT.Mpy_32_32_r--;
+  BASOP_CNT.Mpy_32_32_r--;
+  BASOP_CNT.CL_scale_32++;
 #endif/* #if (WMOPS) */
   return (result);
 }
@@ -336,9 +336,9 @@ cmplx CL_dscale_32 (cmplx x, Word32 y1, Word32 y2) {
   result.re = Mpy_32_32_r (x.re, y1);
   result.im = Mpy_32_32_r (x.im, y2);
 #if (WMOPS)
-  multiCounter[currCounter].Mpy_32_32_r--;
-  multiCounter[currCounter].Mpy_32_32_r--;
-  multiCounter[currCounter].CL_dscale_32++;
+  BASOP_CNT.Mpy_32_32_r--;
+  BASOP_CNT.Mpy_32_32_r--;
+  BASOP_CNT.CL_dscale_32++;
 #endif/* #if (WMOPS) */
   return (result);
 }
@@ -349,15 +349,15 @@ cmplx CL_multr_32x32 (cmplx x, cmplx y) {
   result.im = W_round64_L (W_add (W_mult_32_32 (x.im, y.re), W_mult_32_32(x.re, y.im) ) ) ;
 
 #if (WMOPS)
-  multiCounter[currCounter].CL_multr_32x32++;
-  multiCounter[currCounter].W_mult_32_32--;
-  multiCounter[currCounter].W_mult_32_32--;
-  multiCounter[currCounter].W_mult_32_32--;
-  multiCounter[currCounter].W_mult_32_32--;
-  multiCounter[currCounter].W_round64_L--;
-  multiCounter[currCounter].W_round64_L--;
-  multiCounter[currCounter].W_sub--;
-  multiCounter[currCounter].W_add--;  
+  BASOP_CNT.CL_multr_32x32++;
+  BASOP_CNT.W_mult_32_32--;
+  BASOP_CNT.W_mult_32_32--;
+  BASOP_CNT.W_mult_32_32--;
+  BASOP_CNT.W_mult_32_32--;
+  BASOP_CNT.W_round64_L--;
+  BASOP_CNT.W_round64_L--;
+  BASOP_CNT.W_sub--;
+  BASOP_CNT.W_add--;  
 #endif      
   return result;
 }
@@ -368,10 +368,10 @@ cmplx_s C_mac_r (cmplx x, cmplx_s y, Word16 c) {
   result = CL_round32_16 (temp);
 
 #if (WMOPS)
-  multiCounter[currCounter].C_mac_r++;
-  multiCounter[currCounter].CL_add--;
-  multiCounter[currCounter].C_scale--;
-  multiCounter[currCounter].CL_round32_16--;  
+  BASOP_CNT.C_mac_r++;
+  BASOP_CNT.CL_add--;
+  BASOP_CNT.C_scale--;
+  BASOP_CNT.CL_round32_16--;  
 #endif      
   return result;
 }
@@ -382,24 +382,24 @@ cmplx_s C_msu_r (cmplx x, cmplx_s y, Word16 c) {
   result = CL_round32_16 (temp);
 
 #if (WMOPS)
-  multiCounter[currCounter].C_msu_r++;
-  multiCounter[currCounter].CL_sub--;
-  multiCounter[currCounter].C_scale--;
-  multiCounter[currCounter].CL_round32_16--;  
+  BASOP_CNT.C_msu_r++;
+  BASOP_CNT.CL_sub--;
+  BASOP_CNT.C_scale--;
+  BASOP_CNT.CL_round32_16--;  
 #endif      
   return result;
 }
 
 Word16 C_Extract_real (cmplx_s x) {
 #if (WMOPS)
-  multiCounter[currCounter].C_Extract_real++;
+  BASOP_CNT.C_Extract_real++;
 #endif            
   return x.re;
 }
 
 Word16 C_Extract_imag (cmplx_s x) {
 #if (WMOPS)
-  multiCounter[currCounter].C_Extract_imag++;
+  BASOP_CNT.C_Extract_imag++;
 #endif            
   return x.im;
 }
@@ -409,9 +409,9 @@ cmplx_s C_negate (cmplx_s x) {
   result.re = negate (x.re);
   result.im = negate (x.im);
 #if (WMOPS)
-  multiCounter[currCounter].C_negate++;
-  multiCounter[currCounter].negate--;
-  multiCounter[currCounter].negate--;
+  BASOP_CNT.C_negate++;
+  BASOP_CNT.negate--;
+  BASOP_CNT.negate--;
 #endif          
   return result;
 }
@@ -421,8 +421,8 @@ cmplx_s C_conjugate (cmplx_s x) {
   result.re = x.re;
   result.im = negate (x.im);
 #if (WMOPS)
-  multiCounter[currCounter].C_conjugate++;
-  multiCounter[currCounter].negate--;
+  BASOP_CNT.C_conjugate++;
+  BASOP_CNT.negate--;
 #endif          
   return result;
 }
@@ -432,9 +432,9 @@ cmplx_s C_shr (cmplx_s inp, Word16 shift_val) {
   out.re = shr (inp.re, shift_val);
   out.im = shr (inp.im, shift_val);
 #if (WMOPS)
-  multiCounter[currCounter].C_shr++;
-  multiCounter[currCounter].shr--;
-  multiCounter[currCounter].shr--;
+  BASOP_CNT.C_shr++;
+  BASOP_CNT.shr--;
+  BASOP_CNT.shr--;
 #endif  
   return out;
 }
@@ -444,9 +444,9 @@ cmplx_s C_shl (cmplx_s inp, Word16 shift_val) {
   out.re = shl (inp.re, shift_val);
   out.im = shl (inp.im, shift_val);
 #if (WMOPS)
-  multiCounter[currCounter].C_shl++;
-  multiCounter[currCounter].shl--;
-  multiCounter[currCounter].shl--;
+  BASOP_CNT.C_shl++;
+  BASOP_CNT.shl--;
+  BASOP_CNT.shl--;
 #endif  
   return out;
 }
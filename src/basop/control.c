@@ -21,9 +21,9 @@
 #include "stl.h"
 
 #ifdef WMOPS
-int funcId_where_last_call_to_else_occurred;
-long funcid_total_wmops_at_last_call_to_else;
-int call_occurred = 1;
+BASOP_TLS int funcId_where_last_call_to_else_occurred;
+BASOP_TLS long funcid_total_wmops_at_last_call_to_else;
+BASOP_TLS int call_occurred = 1;
 #endif
 
 #ifdef CONTROL_CODE_OPS
@@ -36,7 +36,7 @@ Flag LT_16 (Word16 var1, Word16 var2) {
     F_ret = 1;
   }
 #if (WMOPS)
-  multiCounter[currCounter].LT_16++;
+  BASOP_CNT.LT_16++;
 #endif
   return F_ret;
 }
@@ -49,7 +49,7 @@ Flag GT_16 (Word16 var1, Word16 var2) {
     F_ret = 1;
   }
 #if (WMOPS)
-  multiCounter[currCounter].GT_16++;
+  BASOP_CNT.GT_16++;
 #endif  
   return F_ret;
 }
@@ -61,7 +61,7 @@ Flag LE_16 (Word16 var1, Word16 var2) {
     F_ret = 1;
   }
 #if (WMOPS)
-  multiCounter[currCounter].LE_16++;
+  BASOP_CNT.LE_16++;
 #endif  
   return F_ret;
 }
@@ -73,7 +73,7 @@ Flag GE_16 (Word16 var1, Word16 var2) {
     F_ret = 1;
   }
 #if (WMOPS)
-  multiCounter[currCounter].GE_16++;
+  BASOP_CNT.GE_16++;
 #endif  
   return F_ret;
 }
@@ -85,7 +85,7 @@ Flag EQ_16 (Word16 var1, Word16 var2) {
     F_ret = 1;
   }
 #if (WMOPS)
-  multiCounter[currCounter].EQ_16++;
+  BASOP_CNT.EQ_16++;
 #endif  
   return F_ret;
 }
@@ -97,7 +97,7 @@ Flag NE_16 (Word16 var1, Word16 var2) {
     F_ret = 1;
   }
 #if (WMOPS)
-  multiCounter[currCounter].NE_16++;
+  BASOP_CNT.NE_16++;
 #endif  
   return F_ret;
 }
@@ -109,7 +109,7 @@ Flag LT_32 (Word32 L_var1, Word32 L_var2) {
     F_ret = 1;
   }
 #if (WMOPS)
-  multiCounter[currCounter].LT_32++;
+  BASOP_CNT.LT_32++;
 #endif  
   return F_ret;
 }
@@ -121,7 +121,7 @@ Flag GT_32 (Word32 L_var1, Word32 L_var2) {
     F_ret = 1;
   }
 #if (WMOPS)
-  multiCounter[currCounter].GT_32++;
+  BASOP_CNT.GT_32++;
 #endif  
   return F_ret;
 }
@@ -133,7 +133,7 @@ Flag LE_32 (Word32 L_var1, Word32 L_var2) {
     F_ret = 1;
   }
 #if (WMOPS)
-  multiCounter[currCounter].LE_32++;
+  BASOP_CNT.LE_32++;
 #endif
   return F_ret;
 }
@@ -145,7 +145,7 @@ Flag GE_32 (Word32 L_var1, Word32 L_var2) {
     F_ret = 1;
   }
 #if (WMOPS)
-  multiCounter[currCounter].GE_32++;
+  BASOP_CNT.GE_32++;
 #endif  
   return F_ret;
 }
@@ -157,7 +157,7 @@ Flag EQ_32 (Word32 L_var1, Word32 L_var2) {
     F_ret = 1;
   }
 #if (WMOPS)
-  multiCounter[currCounter].EQ_32++;
+  BASOP_CNT.EQ_32++;
 #endif
   return F_ret;
 }
@@ -169,7 +169,7 @@ Flag NE_32 (Word32 L_var1, Word32 L_var2) {
     F_ret = 1;
   }
 #if (WMOPS)
-  multiCounter[currCounter].NE_32++;
+  BASOP_CNT.NE_32++;
 #endif  
   return F_ret;
 }
@@ -181,7 +181,7 @@ Flag LT_64 (Word64 L64_var1, Word64 L64_var2) {
     F_ret = 1;
   }
 #if (WMOPS)
-  multiCounter[currCounter].LT_64++;
+  BASOP_CNT.LT_64++;
 #endif  
   return F_ret;
 }
@@ -193,7 +193,7 @@ Flag GT_64 (Word64 L64_var1, Word64 L64_var2) {
     F_ret = 1;
   }
 #if (WMOPS)
-  multiCounter[currCounter].GT_64++;
+  BASOP_CNT.GT_64++;
 #endif  
   return F_ret;
 }
@@ -205,7 +205,7 @@ Flag LE_64 (Word64 L64_var1, Word64 L64_var2) {
     F_ret = 1;
   }
 #if (WMOPS)
-  multiCounter[currCounter].LE_64++;
+  BASOP_CNT.LE_64++;
 #endif  
   return F_ret;
 }
@@ -216,7 +216,7 @@ Flag GE_64 (Word64 L64_var1, Word64 L64_var2) {
     F_ret = 1;
   }
 #if (WMOPS)
-  multiCounter[currCounter].GE_64++;
+  BASOP_CNT.GE_64++;
 #endif  
   return F_ret;
 }
@@ -228,7 +228,7 @@ Flag EQ_64 (Word64 L64_var1, Word64 L64_var2) {
     F_ret = 1;
   }
 #if (WMOPS)
-  multiCounter[currCounter].EQ_64++;
+  BASOP_CNT.EQ_64++;
 #endif  
   return F_ret;
 }
@@ -239,7 +239,7 @@ Flag NE_64 (Word64 L64_var1, Word64 L64_var2) {
     F_ret = 1;
   }
 #if (WMOPS)
-  multiCounter[currCounter].NE_64++;
+  BASOP_CNT.NE_64++;
 #endif  
   return F_ret;
 }
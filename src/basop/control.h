@@ -29,8 +29,8 @@
  *
  *****************************************************************************/
 #if (WMOPS)
-extern BASIC_OP multiCounter[MAXCOUNTERS];
-extern int currCounter;
+extern BASOP_TLS BASIC_OP multiCounter[MAXCOUNTERS];
+extern BASOP_TLS int currCounter;
 
   /* Technical note :
    * The following 3 variables are only used for correct complexity
@@ -47,9 +47,9 @@ extern int currCounter;
    *     ...
    *   }
    */
-extern int funcId_where_last_call_to_else_occurred;
-extern long funcid_total_wmops_at_last_call_to_else;
-extern int call_occurred;
+extern BASOP_TLS int funcId_where_last_call_to_else_occurred;
+extern BASOP_TLS long funcid_total_wmops_at_last_call_to_else;
+extern BASOP_TLS int call_occurred;
 #endif /* ifdef WMOPS */
 
 
@@ -79,7 +79,7 @@ extern int call_occurred;
 #define FOR( a) if( incrFor(), 0); else for( a)
 
 static __inline void incrFor (void) {
-  multiCounter[currCounter].For++;
+  BASOP_CNT.For++;
 }
 #endif /* ifndef WMOPS */
 
@@ -104,7 +104,7 @@ static __inline void incrFor (void) {
 #define WHILE(a) while (incrWhile(), a)
 
 static __inline void incrWhile (void) {
-  multiCounter[currCounter].While++;
+  BASOP_CNT.While++;
 }
 #endif /* ifndef WMOPS */
 
@@ -163,7 +163,7 @@ static __inline void incrIf (void) {
   if ((currCounter != funcId_where_last_call_to_else_occurred)
       || (TotalWeightedOperation () != funcid_total_wmops_at_last_call_to_else)
       || (call_occurred == 1))
-    multiCounter[currCounter].If++;
+    BASOP_CNT.If++;
 
   call_occurred = 0;
   funcId_where_last_call_to_else_occurred = MAXCOUNTERS;
@@ -189,7 +189,7 @@ static __inline void incrIf (void) {
 #define ELSE else if (incrElse (), 0) ; else
 
 static __inline void incrElse (void) {
-  multiCounter[currCounter].If++;
+  BASOP_CNT.If++;
 
   /* We keep track of the funcId of the last function which used ELSE {...} structure. */
   funcId_where_last_call_to_else_occurred = currCounter;
@@ -221,7 +221,7 @@ static __inline void incrElse (void) {
 #define SWITCH(a) switch (incrSwitch (), a)
 
 static __inline void incrSwitch (void) {
-  multiCounter[currCounter].Switch++;
+  BASOP_CNT.Switch++;
 }
 #endif /* ifndef WMOPS */
 
@@ -244,7 +244,7 @@ static __inline void incrSwitch (void) {
 #define CONTINUE if (incrContinue (), 0); else continue
 
 static __inline void incrContinue (void) {
-  multiCounter[currCounter].Continue++;
+  BASOP_CNT.Continue++;
 }
 #endif /* ifndef WMOPS */
 
@@ -267,7 +267,7 @@ static __inline void incrContinue (void) {
 #define BREAK if (incrBreak (), 0); else break
 
 static __inline void incrBreak (void) {
-  multiCounter[currCounter].Break++;
+  BASOP_CNT.Break++;
 }
 #endif /* ifndef WMOPS */
 
@@ -290,7 +290,7 @@ static __inline void incrBreak (void) {
 #define GOTO if (incrGoto (), 0); else goto
 
 static __inline void incrGoto (void) {
-  multiCounter[currCounter].Goto++;
+  BASOP_CNT.Goto++;
 }
 #endif /* ifndef WMOPS */
 
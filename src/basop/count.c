@@ -32,6 +32,20 @@
                         L_mls() weight of 5.
                         div_l() weight of 32.
                         i_mult() weight of 3.
+   17.Oct.26   v2.4     Counters in thread-local storage when compiled with
+                        BASOP_THREAD_SAFE; added WMOPS_aggregate(),
+                        WMOPS_output_aggregate() and WMOPS_clear_aggregate()
+                        to merge the statistics of several threads.
+                        Vector operators (ENH_VEC_OPERATOR) counted once
+                        per element.
+                        BASOP_TALLY counting mode: the operators increment
+                        one tally, added to the counter group at setCounter()
+                        and whenever the counters are read; per-frame
+                        operations kept for WMOPS_export_csv() and
+                        WMOPS_export_json(). TotalWeightedOperation()
+                        with SSE2.
+   17.Oct.26   v2.5     fwc() adds the BASOP_TALLY tally to the counter
+                        group, as documented in count.h.
   ============================================================================
 */
 
@@ -48,16 +62,44 @@
 #include <string.h>
 #include "stl.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define COUNT_HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
+#ifdef BASOP_THREAD_SAFE
+#if defined(_WIN32)
+#include <windows.h>
+static SRWLOCK aggregateLock = SRWLOCK_INIT;
+#define AGGREGATE_LOCK()   AcquireSRWLockExclusive (&aggregateLock)
+#define AGGREGATE_UNLOCK() ReleaseSRWLockExclusive (&aggregateLock)
+#else /* if defined(_WIN32) */
+#include <pthread.h>
+static pthread_mutex_t aggregateLock = PTHREAD_MUTEX_INITIALIZER;
+#define AGGREGATE_LOCK()   pthread_mutex_lock (&aggregateLock)
+#define AGGREGATE_UNLOCK() pthread_mutex_unlock (&aggregateLock)
+#endif /* if defined(_WIN32) */
+#else /* ifdef BASOP_THREAD_SAFE */
+#define AGGREGATE_LOCK()
+#define AGGREGATE_UNLOCK()
+#endif /* ifdef BASOP_THREAD_SAFE */
+
 #ifdef WMOPS
-static double frameRate = FRAME_RATE;   /* default value : 10 ms */
+static BASOP_TLS double frameRate = FRAME_RATE;   /* default value : 10 ms */
 #endif /* ifdef WMOPS */
 
 #ifdef WMOPS
 /* Global counter variable for calculation of complexity weight */
-BASIC_OP multiCounter[MAXCOUNTERS];
-int currCounter = 0;            /* Zero equals global counter */
+BASOP_TLS BASIC_OP multiCounter[MAXCOUNTERS];
+BASOP_TLS int currCounter = 0;            /* Zero equals global counter */
 #endif /* ifdef WMOPS */
 
+#if defined(WMOPS) && defined(BASOP_TALLY)
+/* Counters incremented by the operators in BASOP_TALLY builds (see count.h),
+   added to multiCounter[currCounter] by WMOPS_foldTally() */
+BASOP_TLS BASIC_OP opTally;
+#endif /* if defined(WMOPS) && defined(BASOP_TALLY) */
+
 #ifdef WMOPS
 void setFrameRate (int samplingFreq, int frameLength) {
   if (frameLength > 0) {
@@ -170,6 +212,16 @@ char *BasicOperationList[] = {
   , "UL_deposit_l"  
 #endif /* #ifdef ENH_U_32_BIT_OPERATOR */
 
+#ifdef ENH_VEC_OPERATOR
+  , "V_L_mac"
+  , "V_L_mac0"
+  , "V_L_mac0_2"
+  , "V_shl"
+  , "V_mult_r"
+  , "V_norm_s"
+  , "V_max_abs"
+#endif /* #ifdef ENH_VEC_OPERATOR */
+
 #ifdef CONTROL_CODE_OPS
   , "LT_16"   
   , "GT_16"   
@@ -289,6 +341,16 @@ const BASIC_OP op_weight = {
   , 1
 #endif /* #ifdef ENH_U_32_BIT_OPERATOR */
 
+#ifdef ENH_VEC_OPERATOR
+  , 1
+  , 1
+  , 1
+  , 1
+  , 1
+  , 2
+  , 2
+#endif /* #ifdef ENH_VEC_OPERATOR */
+
 #ifdef CONTROL_CODE_OPS
   , 1   
   , 1   
@@ -321,19 +383,93 @@ Word32 DeltaWeightedOperation (void);
 /* Counters for separating counting for different objects */
 
 
-static int maxCounter = 0;
-static char *objectName[MAXCOUNTERS + 1];
+static BASOP_TLS int maxCounter = 0;
+static BASOP_TLS char *objectName[MAXCOUNTERS + 1];
 
-static Word16 fwc_corr[MAXCOUNTERS + 1];
-static long int nbTimeObjectIsCalled[MAXCOUNTERS + 1];
+static BASOP_TLS Word16 fwc_corr[MAXCOUNTERS + 1];
+static BASOP_TLS long int nbTimeObjectIsCalled[MAXCOUNTERS + 1];
 
 #define NbFuncMax  1024
 
-static Word16 funcid[MAXCOUNTERS], nbframe[MAXCOUNTERS];
-static Word32 glob_wc[MAXCOUNTERS], wc[MAXCOUNTERS][NbFuncMax];
-static float total_wmops[MAXCOUNTERS];
+static BASOP_TLS Word16 funcid[MAXCOUNTERS], nbframe[MAXCOUNTERS];
+static BASOP_TLS Word32 glob_wc[MAXCOUNTERS], wc[MAXCOUNTERS][NbFuncMax];
+static BASOP_TLS float total_wmops[MAXCOUNTERS];
+
+static BASOP_TLS Word32 LastWOper[MAXCOUNTERS];
+
+/* Process-wide aggregate of the counter groups of several threads (see
+   WMOPS_aggregate()); groups are matched by name. Protected by aggregateLock. */
+static int aggCounters = 0, aggThreads = 0;
+static char *aggName[MAXCOUNTERS];
+static long aggNbframe[MAXCOUNTERS];
+static Word16 aggFuncid[MAXCOUNTERS];
+static double aggTotal[MAXCOUNTERS], aggCurrent[MAXCOUNTERS];
+static Word32 aggGlob_wc[MAXCOUNTERS], aggWc[MAXCOUNTERS][NbFuncMax];
+
+/* Weighted operations of every completed frame, for WMOPS_export_csv()
+   and WMOPS_export_json() */
+static BASOP_TLS Word32 *frameOps[MAXCOUNTERS + 1];
+static BASOP_TLS long nbFrameOps[MAXCOUNTERS + 1], sizeFrameOps[MAXCOUNTERS + 1];
+#endif /* ifdef WMOPS */
+
+
+#ifdef WMOPS
+#ifdef BASOP_TALLY
+static void WMOPS_foldTally (void) {
+/* add the operations counted since the last call to the current group */
+  Word16 i;
+  UWord32 *ptr = (UWord32 *) & multiCounter[currCounter];
+  UWord32 *tally = (UWord32 *) & opTally;
+
+  for (i = 0; i < (sizeof (opTally) / sizeof (UWord32)); i++) {
+    *ptr++ += *tally;
+    *tally++ = 0;
+  }
+}
+#else /* ifdef BASOP_TALLY */
+#define WMOPS_foldTally()
+#endif /* ifdef BASOP_TALLY */
+#endif /* ifdef WMOPS */
+
 
-static Word32 LastWOper[MAXCOUNTERS];
+#ifdef WMOPS
+static void WMOPS_recordFrame (Word32 tot) {
+/* append the operations of one frame to the list of the current group */
+  Word32 *ops;
+  long size;
+
+  if (nbFrameOps[currCounter] >= sizeFrameOps[currCounter]) {
+    size = (sizeFrameOps[currCounter] == 0) ? 1024 : 2 * sizeFrameOps[currCounter];
+    if ((ops = (Word32 *) realloc (frameOps[currCounter], size * sizeof (Word32))) == NULL)
+      return;                   /* the frame is left out of the exports */
+    frameOps[currCounter] = ops;
+    sizeFrameOps[currCounter] = size;
+  }
+  frameOps[currCounter][nbFrameOps[currCounter]++] = tot;
+}
+
+
+static long WMOPS_frameList (Word32 ** ops, Word32 * current) {
+/* frames of the current group: the completed ones and, if a frame was
+   started, the one in progress; returns their number */
+  *ops = frameOps[currCounter];
+  *current = TotalWeightedOperation ();
+  return nbFrameOps[currCounter] + ((nbframe[currCounter] > 0) ? 1 : 0);
+}
+
+
+static void WMOPS_printName (FILE * f, const char *name, char quote) {
+/* group name as a quoted CSV field (quote '"' doubled) or JSON string */
+  fputc ('"', f);
+  for (; name != NULL && *name != '\0'; name++) {
+    if (*name == '"')
+      fputc (quote, f);
+    else if (*name == '\\' && quote == '\\')
+      fputc ('\\', f);
+    fputc (*name, f);
+  }
+  fputc ('"', f);
+}
 #endif /* ifdef WMOPS */
 
 
@@ -391,6 +527,7 @@ char *readCounterIdName () {
 
 void setCounter (int counterId) {
 #if WMOPS
+  WMOPS_foldTally ();
   if ((counterId > maxCounter)
       || (counterId < 0)) {
     currCounter = 0;
@@ -445,6 +582,8 @@ static void WMOPS_clearMultiCounter () {
   Word16 i;
 
   Word32 *ptr = (Word32 *) & multiCounter[currCounter];
+
+  WMOPS_foldTally ();
   for (i = 0; i < (sizeof (multiCounter[currCounter]) / sizeof (Word32)); i++) {
     *ptr++ = 0;
   }
@@ -462,19 +601,51 @@ void ClearNbTimeObjectsAreCalled () {
 #endif /* ifdef WMOPS */
 }
 
-Word32 TotalWeightedOperation () {
-#if WMOPS
-  Word16 i;
-  Word32 tot, *ptr, *ptr2;
-
-  tot = 0;
-  ptr = (Word32 *) & multiCounter[currCounter];
-  ptr2 = (Word32 *) & op_weight;
-  for (i = 0; i < (sizeof (multiCounter[currCounter]) / sizeof (Word32)); i++) {
-    tot += ((*ptr++) * (*ptr2++));
+#ifdef WMOPS
+/* Weighted sum of the counters of the current group, plus the tally in
+   BASOP_TALLY builds. Called by every ELSE and by an IF that follows it
+   (see control.h), hence two products per 64-bit lane with SSE2: the
+   low 32 bits of the sum are those of the scalar loop. */
+static UWord32 WMOPS_weightedSum (void) {
+  int i = 0, n = (int) (sizeof (BASIC_OP) / sizeof (UWord32));
+  UWord32 tot = 0;
+  const UWord32 *ptr = (const UWord32 *) & multiCounter[currCounter];
+  const UWord32 *ptr2 = (const UWord32 *) & op_weight;
+#ifdef BASOP_TALLY
+  const UWord32 *tally = (const UWord32 *) & opTally;
+#endif
+
+#ifdef COUNT_HAVE_SSE2
+  if (sizeof (UWord32) == 4) {
+    __m128i acc = _mm_setzero_si128 (), c, w;
+
+    for (; i + 4 <= n; i += 4) {
+      c = _mm_loadu_si128 ((const __m128i *) (ptr + i));
+#ifdef BASOP_TALLY
+      c = _mm_add_epi32 (c, _mm_loadu_si128 ((const __m128i *) (tally + i)));
+#endif
+      w = _mm_loadu_si128 ((const __m128i *) (ptr2 + i));
+      acc = _mm_add_epi64 (acc, _mm_mul_epu32 (c, w));
+      acc = _mm_add_epi64 (acc, _mm_mul_epu32 (_mm_srli_epi64 (c, 32), _mm_srli_epi64 (w, 32)));
+    }
+    acc = _mm_add_epi64 (acc, _mm_srli_si128 (acc, 8));
+    tot = (UWord32) _mm_cvtsi128_si32 (acc);
+  }
+#endif /* ifdef COUNT_HAVE_SSE2 */
+  for (; i < n; i++) {
+#ifdef BASOP_TALLY
+    tot += (ptr[i] + tally[i]) * ptr2[i];
+#else
+    tot += ptr[i] * ptr2[i];
+#endif
   }
+  return (tot);
+}
+#endif /* ifdef WMOPS */
 
-  return ((Word32) tot);
+Word32 TotalWeightedOperation () {
+#if WMOPS
+  return ((Word32) WMOPS_weightedSum ());
 
 #else /* ifdef WMOPS */
   return 0;                     /* Dummy */
@@ -510,6 +681,7 @@ void Init_WMOPS_counter (void) {
   glob_wc[currCounter] = 0;
   nbframe[currCounter] = 0;
   total_wmops[currCounter] = 0.0;
+  nbFrameOps[currCounter] = 0;
 
   /* initially clear all counters */
   WMOPS_clearMultiCounter ();
@@ -527,6 +699,10 @@ void Reset_WMOPS_counter (void) {
 #if WMOPS
   Word32 tot = WMOPS_frameStat ();
 
+  /* keep the operations of the frame that ends here */
+  if (nbframe[currCounter] > 0)
+    WMOPS_recordFrame (tot);
+
   /* increase the frame counter --> a frame is counted WHEN IT BEGINS */
   nbframe[currCounter]++;
   
@@ -546,6 +722,8 @@ Word32 fwc (void) {
 #if WMOPS
   Word32 tot;
 
+  /* counters complete for code that reads multiCounter[] directly */
+  WMOPS_foldTally ();
   tot = DeltaWeightedOperation ();
   if (tot > wc[currCounter][funcid[currCounter]])
     wc[currCounter][funcid[currCounter]] = tot;
@@ -621,6 +799,195 @@ void WMOPS_output_avg (Word16 dtx_mode, Word32 * tot_wm, Word16 * num_frames) {
 #endif /* ifdef WMOPS */
 }
 
+void WMOPS_aggregate (void) {
+#if WMOPS
+  int saved_value, k;
+  Word16 i;
+  Word32 tot;
+  char *name;
+
+  WMOPS_foldTally ();
+  saved_value = currCounter;
+
+  AGGREGATE_LOCK ();
+  for (currCounter = 0; currCounter <= maxCounter; currCounter++) {
+    /* close the current frame as WMOPS_output() does */
+    tot = WMOPS_frameStat ();
+    name = objectName[currCounter] ? objectName[currCounter] : "";
+
+    /* find the group with the same name, or create it */
+    for (k = 0; k < aggCounters; k++)
+      if (strcmp (aggName[k], name) == 0)
+        break;
+    if (k == aggCounters) {
+      if (aggCounters >= MAXCOUNTERS || (aggName[k] = my_strdup (name)) == NULL) {
+        fprintf (stderr, "count: no room to aggregate the counter group '%s'\n", name);
+        continue;
+      }
+      aggCounters++;
+    }
+
+    aggNbframe[k] += nbframe[currCounter];
+    aggTotal[k] += total_wmops[currCounter] + ((float) tot) * frameRate;
+    aggCurrent[k] += ((float) tot) * frameRate;
+    if (glob_wc[currCounter] > aggGlob_wc[k])
+      aggGlob_wc[k] = glob_wc[currCounter];
+    /* funcid[] is back to zero after Reset_WMOPS_counter(): take all the
+       parts seen in any frame */
+    for (i = 0; i < NbFuncMax; i++) {
+      if (wc[currCounter][i] > aggWc[k][i])
+        aggWc[k][i] = wc[currCounter][i];
+      if (wc[currCounter][i] != 0 && i >= aggFuncid[k])
+        aggFuncid[k] = i + 1;
+    }
+  }
+  aggThreads++;
+  AGGREGATE_UNLOCK ();
+
+  currCounter = saved_value;
+#endif /* ifdef WMOPS */
+}
+
+
+void WMOPS_output_aggregate (Word16 dtx_mode) {
+#if WMOPS
+  int k;
+  Word16 i;
+  Word32 tot_wc;
+
+  AGGREGATE_LOCK ();
+  for (k = 0; k < aggCounters; k++) {
+    fprintf (stdout, "%10s:WMOPS=%.3f", aggName[k], aggCurrent[k]);
+
+    if (aggNbframe[k] != 0) {
+      fprintf (stdout, "  Average=%.3f", aggTotal[k] / (double) aggNbframe[k]);
+    }
+    fprintf (stdout, "  WorstCase=%.3f", ((float) aggGlob_wc[k]) * frameRate);
+
+    /* Worst worst case printed only when not in DTX mode */
+    if (dtx_mode == 0) {
+      tot_wc = 0L;
+      for (i = 0; i < aggFuncid[k]; i++)
+        tot_wc += aggWc[k][i];
+      fprintf (stdout, "  WorstWC=%.3f", ((float) tot_wc) * frameRate);
+    }
+    fprintf (stdout, " (%ld frames, %d threads)\n", aggNbframe[k], aggThreads);
+  }
+  AGGREGATE_UNLOCK ();
+#endif /* ifdef WMOPS */
+}
+
+
+void WMOPS_clear_aggregate (void) {
+#if WMOPS
+  int k;
+
+  AGGREGATE_LOCK ();
+  for (k = 0; k < aggCounters; k++) {
+    free (aggName[k]);
+    aggName[k] = NULL;
+    aggNbframe[k] = 0;
+    aggFuncid[k] = 0;
+    aggTotal[k] = aggCurrent[k] = 0.0;
+    aggGlob_wc[k] = 0;
+    memset (aggWc[k], 0, sizeof (aggWc[k]));
+  }
+  aggCounters = aggThreads = 0;
+  AGGREGATE_UNLOCK ();
+#endif /* ifdef WMOPS */
+}
+
+
+void WMOPS_export_csv (const char *filename) {
+#if WMOPS
+  int saved_value;
+  long i, n;
+  Word32 *ops, current, tot;
+  FILE *f;
+
+  if ((f = fopen (filename, "w")) == NULL) {
+    fprintf (stderr, "count: can not open file %s for the WMOPS export\n", filename);
+    return;
+  }
+
+  WMOPS_foldTally ();
+  saved_value = currCounter;
+
+  fprintf (f, "group,frame,operations,wmops\n");
+  for (currCounter = 0; currCounter <= maxCounter; currCounter++) {
+    n = WMOPS_frameList (&ops, &current);
+    for (i = 0; i < n; i++) {
+      tot = (i < nbFrameOps[currCounter]) ? ops[i] : current;
+      WMOPS_printName (f, objectName[currCounter], '"');
+      fprintf (f, ",%ld,%ld,%.6f\n", i, (long) tot, tot * frameRate);
+    }
+  }
+  fclose (f);
+
+  currCounter = saved_value;
+#endif /* ifdef WMOPS */
+}
+
+
+void WMOPS_export_json (const char *filename) {
+#if WMOPS
+  int saved_value, first = 1;
+  long i, n, k, hist[WMOPS_HIST_BINS];
+  Word32 *ops, current, tot, worst;
+  double sum, width;
+  FILE *f;
+
+  if ((f = fopen (filename, "w")) == NULL) {
+    fprintf (stderr, "count: can not open file %s for the WMOPS export\n", filename);
+    return;
+  }
+
+  WMOPS_foldTally ();
+  saved_value = currCounter;
+
+  fprintf (f, "{\n  \"groups\": [");
+  for (currCounter = 0; currCounter <= maxCounter; currCounter++) {
+    if ((n = WMOPS_frameList (&ops, &current)) == 0)
+      continue;
+
+    sum = 0.0;
+    worst = 0;
+    for (i = 0; i < n; i++) {
+      tot = (i < nbFrameOps[currCounter]) ? ops[i] : current;
+      sum += tot;
+      if (tot > worst)
+        worst = tot;
+    }
+
+    /* histogram of the per-frame WMOPS between 0 and the worst case */
+    width = worst * frameRate / WMOPS_HIST_BINS;
+    for (k = 0; k < WMOPS_HIST_BINS; k++)
+      hist[k] = 0;
+    for (i = 0; i < n; i++) {
+      tot = (i < nbFrameOps[currCounter]) ? ops[i] : current;
+      k = (worst > 0) ? (long) ((double) tot * WMOPS_HIST_BINS / worst) : 0;
+      hist[(k < WMOPS_HIST_BINS) ? k : WMOPS_HIST_BINS - 1]++;
+    }
+
+    fprintf (f, "%s\n    {\n      \"name\": ", first ? "" : ",");
+    WMOPS_printName (f, objectName[currCounter], '\\');
+    fprintf (f, ",\n      \"frames\": %ld,\n", n);
+    fprintf (f, "      \"average_wmops\": %.6f,\n", sum / n * frameRate);
+    fprintf (f, "      \"worst_case_wmops\": %.6f,\n", worst * frameRate);
+    fprintf (f, "      \"histogram\": {\n        \"bin_width_wmops\": %.6f,\n        \"frames\": [", width);
+    for (k = 0; k < WMOPS_HIST_BINS; k++)
+      fprintf (f, "%s%ld", (k == 0) ? "" : ", ", hist[k]);
+    fprintf (f, "]\n      }\n    }");
+    first = 0;
+  }
+  fprintf (f, "\n  ]\n}\n");
+  fclose (f);
+
+  currCounter = saved_value;
+#endif /* ifdef WMOPS */
+}
+
+
 void generic_WMOPS_output (Word16 dtx_mode, char *test_file_name) {
 #if WMOPS
   int saved_value;
@@ -629,6 +996,7 @@ void generic_WMOPS_output (Word16 dtx_mode, char *test_file_name) {
   Word40 grand_total;
   FILE *WMOPS_file;
 
+  WMOPS_foldTally ();
   saved_value = currCounter;
 
   /* Count the grand_total WMOPS so that % ratio per function group can be displayed. */
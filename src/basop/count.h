@@ -27,6 +27,14 @@
                         L_mls() weight of 5.
                         div_l() weight of 32.
                         i_mult() weight of 3.
+   17.Oct.26   v2.4     Per-thread counters in BASOP_THREAD_SAFE builds;
+                        added WMOPS_aggregate(), WMOPS_output_aggregate()
+                        and WMOPS_clear_aggregate().
+                        WMOPS is left undefined when BASOP_NOCOUNT is
+                        defined (counting-free builds).
+                        Counters of the vector operators (ENH_VEC_OPERATOR).
+                        BASOP_TALLY counting mode (BASOP_CNT); added
+                        WMOPS_export_csv() and WMOPS_export_json().
   ============================================================================
 */
 
@@ -59,8 +67,18 @@
 
 #ifndef _COUNT_H
 #define _COUNT_H "$Id$"
+#ifndef BASOP_NOCOUNT
 #define WMOPS 1                 /* enable WMOPS profiling features */
+#endif
 // #undef WMOPS /* disable WMOPS profiling features */
+/* Compile with BASOP_NOCOUNT defined for a build without any counting */
+/* Compile with BASOP_TALLY defined for cheaper counting: the operators
+   increment one flat tally (BASOP_CNT below) instead of the counter group
+   multiCounter[currCounter], and the tally is added to the counter group
+   by setCounter(), fwc(), Reset_WMOPS_counter() and by every function of
+   this file that reads the counters. The functions of this file give the
+   same results in both modes; only code reading multiCounter[] directly
+   must call fwc() first. */
 
 #define MAXCOUNTERS (256)
 
@@ -135,6 +153,50 @@ void WMOPS_output_avg (Word16 dtx_mode, Word32 * tot_wm, Word16 * num_frames);
  *
  */
 
+void WMOPS_aggregate (void);
+/*
+ * Merges the statistics of all the counter groups of the calling thread
+ * into a process-wide aggregate, in which the groups of different threads
+ * having the same name are combined: the frames and the total WMOPS are
+ * summed, the worst cases are the maxima over the threads. It is meant to
+ * be called once by each thread after its last frame (in BASOP_THREAD_SAFE
+ * builds every thread has its own counters, see typedef.h), and may be
+ * called by several threads at the same time.
+ */
+
+void WMOPS_output_aggregate (Word16 dtx_mode);
+/*
+ * Prints the aggregated statistics, one line per counter group, in the
+ * format of WMOPS_output(). The average is per frame of one thread.
+ */
+
+void WMOPS_clear_aggregate (void);
+/*
+ * Clears the process-wide aggregate.
+ */
+
+void WMOPS_export_csv (const char *filename);
+/*
+ * Writes the complexity of every frame of every counter group of the
+ * calling thread to a CSV file, one line per frame:
+ *
+ *   group,frame,operations,wmops
+ *
+ * A frame ends at each Reset_WMOPS_counter(); the frame in progress is
+ * included. Returns silently if the file cannot be written (a message
+ * is printed on stderr).
+ */
+
+void WMOPS_export_json (const char *filename);
+/*
+ * Writes a JSON summary of the counter groups of the calling thread:
+ * name, number of frames, average and worst-case WMOPS, and a histogram
+ * of the per-frame WMOPS in WMOPS_HIST_BINS bins of equal width between
+ * 0 and the worst case.
+ */
+
+#define WMOPS_HIST_BINS 20
+
 
 Word32 fwc (void);
 /*
@@ -421,6 +483,16 @@ typedef struct {
   UWord32 UL_deposit_l;            /* Complexity Weight of 1 */
 #endif /* #ifdef ENH_U_32_BIT_OPERATOR */
 
+#ifdef ENH_VEC_OPERATOR            /* counted once per element */
+  UWord32 V_L_mac;                 /* Complexity Weight of 1 */
+  UWord32 V_L_mac0;                /* Complexity Weight of 1 */
+  UWord32 V_L_mac0_2;              /* Complexity Weight of 1 */
+  UWord32 V_shl;                   /* Complexity Weight of 1 */
+  UWord32 V_mult_r;                /* Complexity Weight of 1 */
+  UWord32 V_norm_s;                /* Complexity Weight of 2 */
+  UWord32 V_max_abs;               /* Complexity Weight of 2 */
+#endif /* #ifdef ENH_VEC_OPERATOR */
+
 #ifdef CONTROL_CODE_OPS
   UWord32 LT_16;                   /* Complexity Weight of 1 */
   UWord32 GT_16;                   /* Complexity Weight of 1 */
@@ -444,6 +516,18 @@ typedef struct {
 #endif /* #ifdef CONTROL_CODE_OPS */
 } BASIC_OP;
 
+#ifdef WMOPS
+#ifdef BASOP_TALLY
+extern BASOP_TLS BASIC_OP opTally;
+#define BASOP_CNT opTally
+#else /* ifdef BASOP_TALLY */
+#define BASOP_CNT multiCounter[currCounter]
+#endif /* ifdef BASOP_TALLY */
+#endif /* ifdef WMOPS */
+/*
+ * BASOP_CNT is the set of counters incremented by the operators.
+ */
+
 
 Word32 TotalWeightedOperation (void);
 Word32 DeltaWeightedOperation (void);
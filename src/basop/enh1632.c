@@ -13,6 +13,8 @@
                         described in Geneva, 20-30 January 2004 WP 3/16 Q10/16
                         TD 11 document and subsequent discussions on the
                         wp3audio@yahoogroups.com email reflector.
+   17.Oct.26  v2.4      Not compiled when BASOP_INLINE is defined (see
+                        basop_inline.h).
 
   ============================================================================
 */
@@ -57,8 +59,8 @@
 #include "stl.h"
 
 #if (WMOPS)
-extern BASIC_OP multiCounter[MAXCOUNTERS];
-extern int currCounter;
+extern BASOP_TLS BASIC_OP multiCounter[MAXCOUNTERS];
+extern BASOP_TLS int currCounter;
 #endif /* ifdef WMOPS */
 
 
@@ -70,6 +72,12 @@ extern int currCounter;
  *****************************************************************************/
 
 
+/*
+ * With BASOP_INLINE, the operators are the static inline functions of
+ * basop_inline.h (included by basop32.h) and are not compiled here.
+ */
+#ifndef BASOP_INLINE
+
 /*****************************************************************************
  *
  *   Functions
@@ -117,7 +125,7 @@ Word16 lshl (Word16 var1, Word16 var2) {
     var_out = lshr (var1, var2);
 
 #if (WMOPS)
-    multiCounter[currCounter].lshr--;
+    BASOP_CNT.lshr--;
 #endif /* ifdef WMOPS */
 
   } else {
@@ -130,7 +138,7 @@ Word16 lshl (Word16 var1, Word16 var2) {
     }
   }
 #if (WMOPS)
-  multiCounter[currCounter].lshl++;
+  BASOP_CNT.lshl++;
 #endif /* ifdef WMOPS */
 
   return (var_out);
@@ -176,7 +184,7 @@ Word16 lshr (Word16 var1, Word16 var2) {
     var_out = lshl (var1, var2);
 
 #if (WMOPS)
-    multiCounter[currCounter].lshl--;
+    BASOP_CNT.lshl--;
 #endif /* ifdef WMOPS */
 
   } else {
@@ -191,7 +199,7 @@ Word16 lshr (Word16 var1, Word16 var2) {
     }
   }
 #if (WMOPS)
-  multiCounter[currCounter].lshr++;
+  BASOP_CNT.lshr++;
 #endif /* ifdef WMOPS */
 
   return (var_out);
@@ -238,7 +246,7 @@ Word32 L_lshl (Word32 L_var1, Word16 var2) {
     L_var_out = L_lshr (L_var1, var2);
 
 #if (WMOPS)
-    multiCounter[currCounter].L_lshr--;
+    BASOP_CNT.L_lshr--;
 #endif /* ifdef WMOPS */
 
   } else {
@@ -251,7 +259,7 @@ Word32 L_lshl (Word32 L_var1, Word16 var2) {
     }
   }
 #if (WMOPS)
-  multiCounter[currCounter].L_lshl++;
+  BASOP_CNT.L_lshl++;
 #endif /* ifdef WMOPS */
 
   return (L_var_out);
@@ -298,7 +306,7 @@ Word32 L_lshr (Word32 L_var1, Word16 var2) {
     L_var_out = L_lshl (L_var1, var2);
 
 #if (WMOPS)
-    multiCounter[currCounter].L_lshl--;
+    BASOP_CNT.L_lshl--;
 #endif /* ifdef WMOPS */
 
   } else {
@@ -313,7 +321,7 @@ Word32 L_lshr (Word32 L_var1, Word16 var2) {
     }
   }
 #if (WMOPS)
-  multiCounter[currCounter].L_lshr++;
+  BASOP_CNT.L_lshr++;
 #endif /* ifdef WMOPS */
 
   return (L_var_out);
@@ -356,7 +364,7 @@ Word16 shl_r (Word16 var1, Word16 var2) {
     var_out = shl (var1, var2);
 
 #if (WMOPS)
-    multiCounter[currCounter].shl--;
+    BASOP_CNT.shl--;
 #endif /* ifdef WMOPS */
 
   } else {
@@ -364,12 +372,12 @@ Word16 shl_r (Word16 var1, Word16 var2) {
     var_out = shr_r (var1, var2);
 
 #if (WMOPS)
-    multiCounter[currCounter].shr_r--;
+    BASOP_CNT.shr_r--;
 #endif /* ifdef WMOPS */
   }
 
 #if (WMOPS)
-  multiCounter[currCounter].shl_r++;
+  BASOP_CNT.shl_r++;
 #endif /* ifdef WMOPS */
 
   return (var_out);
@@ -412,7 +420,7 @@ Word32 L_shl_r (Word32 L_var1, Word16 var2) {
     var_out = L_shl (L_var1, var2);
 
 #if (WMOPS)
-    multiCounter[currCounter].L_shl--;
+    BASOP_CNT.L_shl--;
 #endif /* ifdef WMOPS */
 
   } else {
@@ -420,12 +428,12 @@ Word32 L_shl_r (Word32 L_var1, Word16 var2) {
     var_out = L_shr_r (L_var1, var2);
 
 #if (WMOPS)
-    multiCounter[currCounter].L_shr_r--;
+    BASOP_CNT.L_shr_r--;
 #endif /* ifdef WMOPS */
   }
 
 #if (WMOPS)
-  multiCounter[currCounter].L_shl_r++;
+  BASOP_CNT.L_shl_r++;
 #endif /* ifdef WMOPS */
 
   return (var_out);
@@ -469,11 +477,11 @@ Word16 rotr (Word16 var1, Word16 var2, Word16 * var3) {
   var_out = s_or (lshr (var1, 1), lshl (var2, 15));
 
 #if (WMOPS)
-  multiCounter[currCounter].s_and--;
-  multiCounter[currCounter].lshl--;
-  multiCounter[currCounter].lshr--;
-  multiCounter[currCounter].s_or--;
-  multiCounter[currCounter].rotr++;
+  BASOP_CNT.s_and--;
+  BASOP_CNT.lshl--;
+  BASOP_CNT.lshr--;
+  BASOP_CNT.s_or--;
+  BASOP_CNT.rotr++;
 #endif /* ifdef WMOPS */
 
   return (var_out);
@@ -518,11 +526,11 @@ Word16 rotl (Word16 var1, Word16 var2, Word16 * var3) {
   var_out = s_or (lshl (var1, 1), s_and (var2, 0x1));
 
 #if (WMOPS)
-  multiCounter[currCounter].lshr--;
-  multiCounter[currCounter].s_and--;
-  multiCounter[currCounter].lshl--;
-  multiCounter[currCounter].s_or--;
-  multiCounter[currCounter].rotl++;
+  BASOP_CNT.lshr--;
+  BASOP_CNT.s_and--;
+  BASOP_CNT.lshl--;
+  BASOP_CNT.s_or--;
+  BASOP_CNT.rotl++;
 #endif /* ifdef WMOPS */
 
   return (var_out);
@@ -567,13 +575,13 @@ Word32 L_rotr (Word32 L_var1, Word16 var2, Word16 * var3) {
   L_var_out = L_or (L_lshr (L_var1, 1), L_lshl (L_deposit_l (var2), 31));
 
 #if (WMOPS)
-  multiCounter[currCounter].extract_l--;
-  multiCounter[currCounter].s_and--;
-  multiCounter[currCounter].L_deposit_l--;
-  multiCounter[currCounter].L_lshl--;
-  multiCounter[currCounter].L_lshr--;
-  multiCounter[currCounter].L_or--;
-  multiCounter[currCounter].L_rotr++;
+  BASOP_CNT.extract_l--;
+  BASOP_CNT.s_and--;
+  BASOP_CNT.L_deposit_l--;
+  BASOP_CNT.L_lshl--;
+  BASOP_CNT.L_lshr--;
+  BASOP_CNT.L_or--;
+  BASOP_CNT.L_rotr++;
 #endif /* ifdef WMOPS */
 
   return (L_var_out);
@@ -618,47 +626,19 @@ Word32 L_rotl (Word32 L_var1, Word16 var2, Word16 * var3) {
   L_var_out = L_or (L_lshl (L_var1, 1), L_deposit_l (s_and (var2, 0x1)));
 
 #if (WMOPS)
-  multiCounter[currCounter].L_lshr--;
-  multiCounter[currCounter].extract_l--;
-  multiCounter[currCounter].s_and--;
-  multiCounter[currCounter].L_deposit_l--;
-  multiCounter[currCounter].L_lshl--;
-  multiCounter[currCounter].L_or--;
-  multiCounter[currCounter].L_rotl++;
+  BASOP_CNT.L_lshr--;
+  BASOP_CNT.extract_l--;
+  BASOP_CNT.s_and--;
+  BASOP_CNT.L_deposit_l--;
+  BASOP_CNT.L_lshl--;
+  BASOP_CNT.L_or--;
+  BASOP_CNT.L_rotl++;
 #endif /* ifdef WMOPS */
 
   return (L_var_out);
 }
 
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
+#endif /* ifndef BASOP_INLINE */
 
 
 /* end of file */
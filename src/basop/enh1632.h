@@ -17,6 +17,7 @@
                         Some counters incrementations were missing (s_and, 
                         s_or, s_xor).                        
    30 Nov 09   v2.3     saturate() removed
+   17.Oct.26  v2.4      Prototypes declared with BASOP_API.
 
   ============================================================================
 */
@@ -38,8 +39,8 @@
 
 #if (WMOPS)
 #include "count.h"
-extern BASIC_OP multiCounter[MAXCOUNTERS];
-extern int currCounter;
+extern BASOP_TLS BASIC_OP multiCounter[MAXCOUNTERS];
+extern BASOP_TLS int currCounter;
 #endif /* ifdef WMOPS */
 
 
@@ -48,19 +49,19 @@ extern int currCounter;
  *  Prototypes for enhanced 16/32 bit arithmetic operators
  *
  *****************************************************************************/
-Word16 shl_r (Word16 var1, Word16 var2);
-Word32 L_shl_r (Word32 L_var1, Word16 var2);
+BASOP_API Word16 shl_r (Word16 var1, Word16 var2);
+BASOP_API Word32 L_shl_r (Word32 L_var1, Word16 var2);
 
 
-Word16 lshl (Word16 var1, Word16 var2);
-Word16 lshr (Word16 var1, Word16 var2);
-Word32 L_lshl (Word32 L_var1, Word16 var2);
-Word32 L_lshr (Word32 L_var1, Word16 var2);
+BASOP_API Word16 lshl (Word16 var1, Word16 var2);
+BASOP_API Word16 lshr (Word16 var1, Word16 var2);
+BASOP_API Word32 L_lshl (Word32 L_var1, Word16 var2);
+BASOP_API Word32 L_lshr (Word32 L_var1, Word16 var2);
 
-Word16 rotr (Word16 var1, Word16 var2, Word16 * var3);
-Word16 rotl (Word16 var1, Word16 var2, Word16 * var3);
-Word32 L_rotr (Word32 var1, Word16 var2, Word16 * var3);
-Word32 L_rotl (Word32 var1, Word16 var2, Word16 * var3);
+BASOP_API Word16 rotr (Word16 var1, Word16 var2, Word16 * var3);
+BASOP_API Word16 rotl (Word16 var1, Word16 var2, Word16 * var3);
+BASOP_API Word32 L_rotr (Word32 var1, Word16 var2, Word16 * var3);
+BASOP_API Word32 L_rotl (Word32 var1, Word16 var2, Word16 * var3);
 
 
 
@@ -107,7 +108,7 @@ static __inline Word16 s_max (Word16 var1, Word16 var2) {
     var_out = var2;
 
 #if (WMOPS)
-  multiCounter[currCounter].s_max++;
+  BASOP_CNT.s_max++;
 #endif /* ifdef WMOPS */
 
   return (var_out);
@@ -151,7 +152,7 @@ static __inline Word16 s_min (Word16 var1, Word16 var2) {
     var_out = var2;
 
 #if (WMOPS)
-  multiCounter[currCounter].s_min++;
+  BASOP_CNT.s_min++;
 #endif /* ifdef WMOPS */
 
   return (var_out);
@@ -195,7 +196,7 @@ static __inline Word32 L_max (Word32 L_var1, Word32 L_var2) {
     L_var_out = L_var2;
 
 #if (WMOPS)
-  multiCounter[currCounter].L_max++;
+  BASOP_CNT.L_max++;
 #endif /* ifdef WMOPS */
 
   return (L_var_out);
@@ -239,7 +240,7 @@ static __inline Word32 L_min (Word32 L_var1, Word32 L_var2) {
     L_var_out = L_var2;
 
 #if (WMOPS)
-  multiCounter[currCounter].L_min++;
+  BASOP_CNT.L_min++;
 #endif /* ifdef WMOPS */
 
   return (L_var_out);
@@ -289,7 +290,7 @@ static __inline Word16 s_and (Word16 var1, Word16 var2) {
   var_out = var1 & var2;
 
 #if (WMOPS)
-  multiCounter[currCounter].s_and++;
+  BASOP_CNT.s_and++;
 #endif /* ifdef WMOPS */
 
   return (var_out);
@@ -331,7 +332,7 @@ static __inline Word32 L_and (Word32 L_var1, Word32 L_var2) {
   L_var_out = L_var1 & L_var2;
 
 #if (WMOPS)
-  multiCounter[currCounter].L_and++;
+  BASOP_CNT.L_and++;
 #endif /* ifdef WMOPS */
 
   return (L_var_out);
@@ -373,7 +374,7 @@ static __inline Word16 s_or (Word16 var1, Word16 var2) {
   var_out = var1 | var2;
 
 #if (WMOPS)
-  multiCounter[currCounter].s_or++;
+  BASOP_CNT.s_or++;
 #endif /* ifdef WMOPS */
 
   return (var_out);
@@ -416,7 +417,7 @@ static __inline Word32 L_or (Word32 L_var1, Word32 L_var2) {
   L_var_out = L_var1 | L_var2;
 
 #if (WMOPS)
-  multiCounter[currCounter].L_or++;
+  BASOP_CNT.L_or++;
 #endif /* ifdef WMOPS */
 
   return (L_var_out);
@@ -458,7 +459,7 @@ static __inline Word16 s_xor (Word16 var1, Word16 var2) {
   var_out = var1 ^ var2;
 
 #if (WMOPS)
-  multiCounter[currCounter].s_xor++;
+  BASOP_CNT.s_xor++;
 #endif /* ifdef WMOPS */
 
   return (var_out);
@@ -500,7 +501,7 @@ static __inline Word32 L_xor (Word32 L_var1, Word32 L_var2) {
   L_var_out = L_var1 ^ L_var2;
 
 #if (WMOPS)
-  multiCounter[currCounter].L_xor++;
+  BASOP_CNT.L_xor++;
 #endif /* ifdef WMOPS */
 
   return (L_var_out);
@@ -24,11 +24,12 @@
 #include "enh32.h"
 
 #if (WMOPS)
-extern BASIC_OP multiCounter[MAXCOUNTERS];
-extern int currCounter;
+extern BASOP_TLS BASIC_OP multiCounter[MAXCOUNTERS];
+extern BASOP_TLS int currCounter;
 #endif /* if WMOPS */
 
-#ifdef ENH_32_BIT_OPERATOR
+/* With BASOP_INLINE, the operators are defined in basop_inline.h */
+#if defined(ENH_32_BIT_OPERATOR) && !defined(BASOP_INLINE)
 /*****************************************************************************
  *
  *  Local Functions
@@ -51,9 +52,9 @@ extern int currCounter;
 Word32 Mpy_32_16_1 (Word32 L_var1, Word16 var2) {
   Word32 L_var_out = W_sat_m (W_mult_32_16 (L_var1, var2) );
 #if (WMOPS)
-  multiCounter[currCounter].Mpy_32_16_1++;
-  multiCounter[currCounter].W_mult_32_16--;
-  multiCounter[currCounter].W_sat_m--;
+  BASOP_CNT.Mpy_32_16_1++;
+  BASOP_CNT.W_mult_32_16--;
+  BASOP_CNT.W_sat_m--;
 #endif /* if WMOPS */ 
     return L_var_out;
 }
@@ -61,9 +62,9 @@ Word32 Mpy_32_16_1 (Word32 L_var1, Word16 var2) {
 Word32 Mpy_32_16_r (Word32 L_var1, Word16 var2) {
   Word32 L_var_out = W_round48_L (W_mult_32_16 (L_var1, var2 ) );
 #if (WMOPS)
-  multiCounter[currCounter].Mpy_32_16_r++;
-  multiCounter[currCounter].W_mult_32_16--;
-  multiCounter[currCounter].W_round48_L--;
+  BASOP_CNT.Mpy_32_16_r++;
+  BASOP_CNT.W_mult_32_16--;
+  BASOP_CNT.W_round48_L--;
 #endif /* if WMOPS */ 
   return L_var_out;
 }
@@ -76,9 +77,9 @@ Word32 Mpy_32_32 (Word32 L_var1, Word32 L_var2) {
   L64_var1 = W_shl (L64_var1, 1);
   L_var_out = W_extract_h (L64_var1 );
 #if (WMOPS)
-    multiCounter[currCounter].Mpy_32_32++;
-  multiCounter[currCounter].W_shl--;
-  multiCounter[currCounter].W_extract_h--;
+    BASOP_CNT.Mpy_32_32++;
+  BASOP_CNT.W_shl--;
+  BASOP_CNT.W_extract_h--;
 #endif /* if WMOPS */ 
     return L_var_out;
 }
@@ -91,9 +92,9 @@ Word32 Mpy_32_32_r (Word32 L_var1, Word32 L_var2) {
   L64_var1 = W_shr (L64_var1, 15);
   L_var_out = W_round48_L (L64_var1 );
 #if (WMOPS)
-    multiCounter[currCounter].Mpy_32_32_r++;
-  multiCounter[currCounter].W_shr--;
-  multiCounter[currCounter].W_round48_L--;
+    BASOP_CNT.Mpy_32_32_r++;
+  BASOP_CNT.W_shr--;
+  BASOP_CNT.W_round48_L--;
 #endif /* if WMOPS */ 
     return L_var_out;
 }
@@ -105,9 +106,9 @@ Word32 Madd_32_16 (Word32 L_var3, Word32 L_var1, Word16 var2) {
   L_var_out = L_add (L_var3, L_var_out);
   
 #if (WMOPS)
-  multiCounter[currCounter].Mpy_32_16_1--;
-  multiCounter[currCounter].L_add--; 
-  multiCounter[currCounter].Madd_32_16++; 
+  BASOP_CNT.Mpy_32_16_1--;
+  BASOP_CNT.L_add--; 
+  BASOP_CNT.Madd_32_16++; 
 #endif /* if WMOPS */	 
   return L_var_out;
 }
@@ -119,9 +120,9 @@ Word32 Madd_32_16_r (Word32 L_var3, Word32 L_var1, Word16 var2) {
   L_var_out = L_add (L_var3, L_var_out);
   
 #if (WMOPS)
-  multiCounter[currCounter].Mpy_32_16_r--;
-  multiCounter[currCounter].L_add--;
-  multiCounter[currCounter].Madd_32_16_r++; 
+  BASOP_CNT.Mpy_32_16_r--;
+  BASOP_CNT.L_add--;
+  BASOP_CNT.Madd_32_16_r++; 
 #endif /* if WMOPS */	 
     return L_var_out;
 }
@@ -133,9 +134,9 @@ Word32 Msub_32_16 (Word32 L_var3, Word32 L_var1, Word16 var2) {
   L_var_out = L_sub(L_var3, L_var_out);
   
 #if (WMOPS)
-  multiCounter[currCounter].Mpy_32_16_1--;
-  multiCounter[currCounter].L_sub--;
-  multiCounter[currCounter].Msub_32_16++; 
+  BASOP_CNT.Mpy_32_16_1--;
+  BASOP_CNT.L_sub--;
+  BASOP_CNT.Msub_32_16++; 
 #endif /* if WMOPS */	 
   return L_var_out;
 }
@@ -147,9 +148,9 @@ Word32 Msub_32_16_r (Word32 L_var3, Word32 L_var1, Word16 var2) {
   L_var_out = L_sub (L_var3, L_var_out);
   
 #if (WMOPS)
-  multiCounter[currCounter].Mpy_32_16_r--;
-  multiCounter[currCounter].L_sub--;
-  multiCounter[currCounter].Msub_32_16_r++; 
+  BASOP_CNT.Mpy_32_16_r--;
+  BASOP_CNT.L_sub--;
+  BASOP_CNT.Msub_32_16_r++; 
 #endif /* if WMOPS */	 
   return L_var_out;
 }
@@ -161,9 +162,9 @@ Word32 Madd_32_32 (Word32 L_var3, Word32 L_var1, Word32 L_var2) {
   L_var_out = L_add (L_var3, L_var_out);
   
 #if (WMOPS)
-  multiCounter[currCounter].Mpy_32_32--;
-  multiCounter[currCounter].L_add--;
-  multiCounter[currCounter].Madd_32_32++; 
+  BASOP_CNT.Mpy_32_32--;
+  BASOP_CNT.L_add--;
+  BASOP_CNT.Madd_32_32++; 
 #endif /* if WMOPS */	 
   return L_var_out;
 }
@@ -175,9 +176,9 @@ Word32 Madd_32_32_r (Word32 L_var3, Word32 L_var1, Word32 L_var2) {
   L_var_out = L_add (L_var3, L_var_out);
   
 #if (WMOPS)
-  multiCounter[currCounter].Mpy_32_32_r--;
-  multiCounter[currCounter].L_add--;
-  multiCounter[currCounter].Madd_32_32_r++; 
+  BASOP_CNT.Mpy_32_32_r--;
+  BASOP_CNT.L_add--;
+  BASOP_CNT.Madd_32_32_r++; 
 #endif /* if WMOPS */	 
   return L_var_out;
 }
@@ -189,9 +190,9 @@ Word32 Msub_32_32 (Word32 L_var3, Word32 L_var1, Word32 L_var2) {
   L_var_out = L_sub (L_var3, L_var_out);
   
 #if (WMOPS)
-  multiCounter[currCounter].Mpy_32_32--;
-  multiCounter[currCounter].L_sub--;
-  multiCounter[currCounter].Msub_32_32++; 
+  BASOP_CNT.Mpy_32_32--;
+  BASOP_CNT.L_sub--;
+  BASOP_CNT.Msub_32_32++; 
 #endif /* if WMOPS */	 
   return L_var_out;
 }
@@ -203,13 +204,13 @@ Word32 Msub_32_32_r (Word32 L_var3, Word32 L_var1, Word32 L_var2) {
   L_var_out = L_sub (L_var3, L_var_out);
   
 #if (WMOPS)
-  multiCounter[currCounter].Mpy_32_32_r--;
-  multiCounter[currCounter].L_sub--;
-  multiCounter[currCounter].Msub_32_32_r++; 
+  BASOP_CNT.Mpy_32_32_r--;
+  BASOP_CNT.L_sub--;
+  BASOP_CNT.Msub_32_32_r++; 
 #endif /* if WMOPS */	 
   return L_var_out;
 }
 
-#endif /* #ifdef ENH_32_BIT_OPERATOR */
+#endif /* #if defined(ENH_32_BIT_OPERATOR) && !defined(BASOP_INLINE) */
  
 /* end of file */
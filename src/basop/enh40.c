@@ -65,8 +65,8 @@
 #include "stl.h"
 
 #if (WMOPS)
-extern BASIC_OP multiCounter[MAXCOUNTERS];
-extern int currCounter;
+extern BASOP_TLS BASIC_OP multiCounter[MAXCOUNTERS];
+extern BASOP_TLS int currCounter;
 #endif /* ifdef WMOPS */
 
 
@@ -134,7 +134,7 @@ Word40 L40_shl (Word40 L40_var1, Word16 var2) {
     L40_var_out = L40_shr (L40_var1, var2);
 
 #if (WMOPS)
-    multiCounter[currCounter].L40_shr--;
+    BASOP_CNT.L40_shr--;
 #endif /* ifdef WMOPS */
   }
 
@@ -159,8 +159,8 @@ Word40 L40_shl (Word40 L40_var1, Word16 var2) {
   }
 
 #if (WMOPS)
-  multiCounter[currCounter].L40_set--;
-  multiCounter[currCounter].L40_shl++;
+  BASOP_CNT.L40_set--;
+  BASOP_CNT.L40_shl++;
 #endif /* ifdef WMOPS */
 
   return (L40_var_out);
@@ -209,7 +209,7 @@ Word40 L40_shr (Word40 L40_var1, Word16 var2) {
     L40_var_out = L40_shl (L40_var1, var2);
 
 #if (WMOPS)
-    multiCounter[currCounter].L40_shl--;
+    BASOP_CNT.L40_shl--;
 #endif /* ifdef WMOPS */
 
   } else {
@@ -217,7 +217,7 @@ Word40 L40_shr (Word40 L40_var1, Word16 var2) {
   }
 
 #if (WMOPS)
-  multiCounter[currCounter].L40_shr++;
+  BASOP_CNT.L40_shr++;
 #endif /* ifdef WMOPS */
 
   return (L40_var_out);
@@ -257,8 +257,8 @@ Word40 L40_negate (Word40 L40_var1) {
   L40_var_out = L40_add (~L40_var1, 0x01);
 
 #if (WMOPS)
-  multiCounter[currCounter].L40_add--;
-  multiCounter[currCounter].L40_negate++;
+  BASOP_CNT.L40_add--;
+  BASOP_CNT.L40_negate++;
 #endif /* ifdef WMOPS */
 
   return (L40_var_out);
@@ -311,7 +311,7 @@ Word40 L40_add (Word40 L40_var1, Word40 L40_var2) {
     L40_var_out = L40_OVERFLOW_OCCURED (L40_var_out);
   }
 #if (WMOPS)
-  multiCounter[currCounter].L40_add++;
+  BASOP_CNT.L40_add++;
 #endif /* ifdef WMOPS */
 
   return (L40_var_out);
@@ -364,7 +364,7 @@ Word40 L40_sub (Word40 L40_var1, Word40 L40_var2) {
     L40_var_out = L40_OVERFLOW_OCCURED (L40_var_out);
   }
 #if (WMOPS)
-  multiCounter[currCounter].L40_sub++;
+  BASOP_CNT.L40_sub++;
 #endif /* ifdef WMOPS */
 
   return (L40_var_out);
@@ -405,7 +405,7 @@ Word40 L40_abs (Word40 L40_var1) {
     L40_var_out = L40_negate (L40_var1);
 
 #if (WMOPS)
-    multiCounter[currCounter].L40_negate--;
+    BASOP_CNT.L40_negate--;
 #endif /* ifdef WMOPS */
 
   } else {
@@ -413,7 +413,7 @@ Word40 L40_abs (Word40 L40_var1) {
   }
 
 #if (WMOPS)
-  multiCounter[currCounter].L40_abs++;
+  BASOP_CNT.L40_abs++;
 #endif /* ifdef WMOPS */
 
   return (L40_var_out);
@@ -458,7 +458,7 @@ Word40 L40_max (Word40 L40_var1, Word40 L40_var2) {
     L40_var_out = L40_var1;
 
 #if (WMOPS)
-  multiCounter[currCounter].L40_max++;
+  BASOP_CNT.L40_max++;
 #endif /* ifdef WMOPS */
 
   return (L40_var_out);
@@ -503,7 +503,7 @@ Word40 L40_min (Word40 L40_var1, Word40 L40_var2) {
     L40_var_out = L40_var2;
 
 #if (WMOPS)
-  multiCounter[currCounter].L40_min++;
+  BASOP_CNT.L40_min++;
 #endif /* ifdef WMOPS */
 
   return (L40_var_out);
@@ -556,8 +556,8 @@ Word32 L_saturate40 (Word40 L40_var1) {
   L_var_out = L_Extract40 (L40_var1);
 
 #if (WMOPS)
-  multiCounter[currCounter].L_Extract40--;
-  multiCounter[currCounter].L_saturate40++;
+  BASOP_CNT.L_Extract40--;
+  BASOP_CNT.L_saturate40++;
 #endif /* ifdef WMOPS */
 
   return (L_var_out);
@@ -625,17 +625,17 @@ void Mpy_32_16_ss (Word32 L_var1, Word16 var2, Word32 * L_varout_h, UWord16 * va
     *L_varout_h = L_Extract40 (L40_var1);
 
 #if(WMOPS)
-    multiCounter[currCounter].extract_l--;
-    multiCounter[currCounter].extract_h--;
-    multiCounter[currCounter].Extract40_L--;
-    multiCounter[currCounter].L40_shr--;
-    multiCounter[currCounter].L40_mac--;
-    multiCounter[currCounter].L_Extract40--;
+    BASOP_CNT.extract_l--;
+    BASOP_CNT.extract_h--;
+    BASOP_CNT.Extract40_L--;
+    BASOP_CNT.L40_shr--;
+    BASOP_CNT.L40_mac--;
+    BASOP_CNT.L_Extract40--;
 #endif /* ifdef WMOPS */
   }
 
 #if (WMOPS)
-  multiCounter[currCounter].Mpy_32_16_ss++;
+  BASOP_CNT.Mpy_32_16_ss++;
 #endif /* ifdef WMOPS */
 
   return;
@@ -711,17 +711,17 @@ void Mpy_32_32_ss (Word32 L_var1, Word32 L_var2, Word32 * L_varout_h, UWord32 *
     *L_varout_h = L_Extract40 (L40_var1);
 
 #if (WMOPS)
-    multiCounter[currCounter].extract_l -= 2;
-    multiCounter[currCounter].extract_h -= 2;
-    multiCounter[currCounter].L_Extract40 -= 3;
-    multiCounter[currCounter].L40_shr -= 2;
-    multiCounter[currCounter].L40_add -= 2;
-    multiCounter[currCounter].L40_mac--;
+    BASOP_CNT.extract_l -= 2;
+    BASOP_CNT.extract_h -= 2;
+    BASOP_CNT.L_Extract40 -= 3;
+    BASOP_CNT.L40_shr -= 2;
+    BASOP_CNT.L40_add -= 2;
+    BASOP_CNT.L40_mac--;
 #endif /* ifdef WMOPS */
   }
 
 #if (WMOPS)
-  multiCounter[currCounter].Mpy_32_32_ss++;
+  BASOP_CNT.Mpy_32_32_ss++;
 #endif /* ifdef WMOPS */
 
   return;
@@ -768,7 +768,7 @@ Word40 L40_lshl (Word40 L40_var1, Word16 var2) {
     L40_var_out = L40_lshr (L40_var1, var2);
 
 #if (WMOPS)
-    multiCounter[currCounter].L40_lshr--;
+    BASOP_CNT.L40_lshr--;
 #endif /* ifdef WMOPS */
 
   } else {
@@ -780,12 +780,12 @@ Word40 L40_lshl (Word40 L40_var1, Word16 var2) {
     L40_var_out = L40_set (L40_var_out);
 
 #if (WMOPS)
-    multiCounter[currCounter].L40_set--;
+    BASOP_CNT.L40_set--;
 #endif /* ifdef WMOPS */
   }
 
 #if (WMOPS)
-  multiCounter[currCounter].L40_lshl++;
+  BASOP_CNT.L40_lshl++;
 #endif /* ifdef WMOPS */
 
   return (L40_var_out);
@@ -832,7 +832,7 @@ Word40 L40_lshr (Word40 L40_var1, Word16 var2) {
     L40_var_out = L40_lshl (L40_var1, var2);
 
 #if (WMOPS)
-    multiCounter[currCounter].L40_lshl--;
+    BASOP_CNT.L40_lshl--;
 #endif /* ifdef WMOPS */
   } else {
     if (var2 >= 40)
@@ -842,7 +842,7 @@ Word40 L40_lshr (Word40 L40_var1, Word16 var2) {
   }
 
 #if (WMOPS)
-  multiCounter[currCounter].L40_lshr++;
+  BASOP_CNT.L40_lshr++;
 #endif /* ifdef WMOPS */
 
   return (L40_var_out);
@@ -894,7 +894,7 @@ Word16 norm_L40 (Word40 L40_var1) {
       var_out++;
 
 #ifdef WMOPS
-      multiCounter[currCounter].L40_shl--;
+      BASOP_CNT.L40_shl--;
 #endif /* ifdef WMOPS */
     }
 
@@ -905,12 +905,12 @@ Word16 norm_L40 (Word40 L40_var1) {
       var_out--;
 
 #ifdef WMOPS
-      multiCounter[currCounter].L40_shl--;
+      BASOP_CNT.L40_shl--;
 #endif /* ifdef WMOPS */
     }
   }
 #ifdef WMOPS
-  multiCounter[currCounter].norm_L40++;
+  BASOP_CNT.norm_L40++;
 #endif /* ifdef WMOPS */
 
   return (var_out);
@@ -964,7 +964,7 @@ Word40 L40_shr_r (Word40 L40_var1, Word16 var2) {
     L40_var_out = L40_shr (L40_var1, var2);
 
 #if (WMOPS)
-    multiCounter[currCounter].L40_shr--;
+    BASOP_CNT.L40_shr--;
 #endif /* ifdef WMOPS */
 
     if (var2 > 0) {
@@ -976,7 +976,7 @@ Word40 L40_shr_r (Word40 L40_var1, Word16 var2) {
   }
 
 #if (WMOPS)
-  multiCounter[currCounter].L40_shr_r++;
+  BASOP_CNT.L40_shr_r++;
 #endif /* ifdef WMOPS */
 
   return (L40_var_out);
@@ -1023,7 +1023,7 @@ Word40 L40_shl_r (Word40 L40_var1, Word16 var2) {
     L40_var_out = L40_shl (L40_var1, var2);
 
 #if (WMOPS)
-    multiCounter[currCounter].L40_shl--;
+    BASOP_CNT.L40_shl--;
 #endif /* ifdef WMOPS */
 
   } else {
@@ -1031,11 +1031,11 @@ Word40 L40_shl_r (Word40 L40_var1, Word16 var2) {
     L40_var_out = L40_shr_r (L40_var1, var2);
 
 #if (WMOPS)
-    multiCounter[currCounter].L40_shr_r--;
+    BASOP_CNT.L40_shr_r--;
 #endif /* ifdef WMOPS */
   }
 #if (WMOPS)
-  multiCounter[currCounter].L40_shl_r++;
+  BASOP_CNT.L40_shl_r++;
 #endif /* ifdef WMOPS */
 
   return (L40_var_out);
@@ -27,8 +27,8 @@
 
 
 #ifdef WMOPS
-extern BASIC_OP multiCounter[MAXCOUNTERS];
-extern int currCounter;
+extern BASOP_TLS BASIC_OP multiCounter[MAXCOUNTERS];
+extern BASOP_TLS int currCounter;
 #endif /* ifdef WMOPS */
 
 
@@ -148,7 +148,7 @@ static __inline Word40 L40_set (Word40 L40_var1) {
     L40_var_out = L40_var_out | 0xffffff0000000000;
 
 #ifdef WMOPS
-  multiCounter[currCounter].L40_set++;
+  BASOP_CNT.L40_set++;
 #endif /* ifdef WMOPS */
 
   return (L40_var_out);
@@ -189,7 +189,7 @@ static __inline UWord16 Extract40_H (Word40 L40_var1) {
   var_out = (UWord16) (L40_var1 >> 16);
 
 #if (WMOPS)
-  multiCounter[currCounter].Extract40_H++;
+  BASOP_CNT.Extract40_H++;
 #endif /* ifdef WMOPS */
 
   return (var_out);
@@ -227,7 +227,7 @@ static __inline UWord16 Extract40_L (Word40 L40_var1) {
   var_out = (UWord16) (L40_var1);
 
 #if (WMOPS)
-  multiCounter[currCounter].Extract40_L++;
+  BASOP_CNT.Extract40_L++;
 #endif /* ifdef WMOPS */
 
   return (var_out);
@@ -265,7 +265,7 @@ static __inline UWord32 L_Extract40 (Word40 L40_var1) {
   L_var_out = (UWord32) L40_var1;
 
 #if (WMOPS)
-  multiCounter[currCounter].L_Extract40++;
+  BASOP_CNT.L_Extract40++;
 #endif /* ifdef WMOPS */
 
   return (L_var_out);
@@ -307,11 +307,11 @@ static __inline Word40 L40_deposit_h (Word16 var1) {
     L40_var_out = L40_set (L40_var_out | 0xff00000000);
 
 #if (WMOPS)
-    multiCounter[currCounter].L40_set--;
+    BASOP_CNT.L40_set--;
 #endif /* ifdef WMOPS */
   }
 #if (WMOPS)
-  multiCounter[currCounter].L40_deposit_h++;
+  BASOP_CNT.L40_deposit_h++;
 #endif /* ifdef WMOPS */
 
   return (L40_var_out);
@@ -353,11 +353,11 @@ static __inline Word40 L40_deposit_l (Word16 var1) {
     L40_var_out = L40_set (L40_var_out | 0xffffff0000);
 
 #if (WMOPS)
-    multiCounter[currCounter].L40_set--;
+    BASOP_CNT.L40_set--;
 #endif /* ifdef WMOPS */
   }
 #if (WMOPS)
-  multiCounter[currCounter].L40_deposit_l++;
+  BASOP_CNT.L40_deposit_l++;
 #endif /* ifdef WMOPS */
 
   return (L40_var_out);
@@ -399,11 +399,11 @@ static __inline Word40 L40_deposit32 (Word32 L_var1) {
     L40_var_out = L40_set (L40_var_out | 0xff00000000);
 
 #if (WMOPS)
-    multiCounter[currCounter].L40_set--;
+    BASOP_CNT.L40_set--;
 #endif /* ifdef WMOPS */
   }
 #if (WMOPS)
-  multiCounter[currCounter].L40_deposit32++;
+  BASOP_CNT.L40_deposit32++;
 #endif /* ifdef WMOPS */
 
   return (L40_var_out);
@@ -454,9 +454,9 @@ static __inline Word40 L40_round (Word40 L40_var1) {
   L40_var_out = L40_var_out & L40_constant;
 
 #if (WMOPS)
-  multiCounter[currCounter].L40_set--;
-  multiCounter[currCounter].L40_add--;
-  multiCounter[currCounter].L40_round++;
+  BASOP_CNT.L40_set--;
+  BASOP_CNT.L40_add--;
+  BASOP_CNT.L40_round++;
 #endif /* ifdef WMOPS */
 
   return (L40_var_out);
@@ -500,10 +500,10 @@ static __inline Word16 round40 (Word40 L40_var1) {
   var_out = extract_h (L_saturate40 (L40_round (L40_var1)));
 
 #if (WMOPS)
-  multiCounter[currCounter].L40_round--;
-  multiCounter[currCounter].L_saturate40--;
-  multiCounter[currCounter].extract_h--;
-  multiCounter[currCounter].round40++;
+  BASOP_CNT.L40_round--;
+  BASOP_CNT.L_saturate40--;
+  BASOP_CNT.extract_h--;
+  BASOP_CNT.round40++;
 #endif /* ifdef WMOPS */
 
   return (var_out);
@@ -551,7 +551,7 @@ static __inline Word40 L40_mult (Word16 var1, Word16 var2) {
   L40_var_out = L40_var_out << 1;
 
 #if (WMOPS)
-  multiCounter[currCounter].L40_mult++;
+  BASOP_CNT.L40_mult++;
 #endif /* ifdef WMOPS */
 
   return (L40_var_out);
@@ -611,9 +611,9 @@ static __inline Word40 L40_mac (Word40 L40_var1, Word16 var2, Word16 var3) {
   L40_var_out = L40_add (L40_var1, L40_var_out);
 
 #if (WMOPS)
-  multiCounter[currCounter].L40_mult--;
-  multiCounter[currCounter].L40_add--;
-  multiCounter[currCounter].L40_mac++;
+  BASOP_CNT.L40_mult--;
+  BASOP_CNT.L40_add--;
+  BASOP_CNT.L40_mac++;
 #endif /* ifdef WMOPS */
 
   return (L40_var_out);
@@ -670,9 +670,9 @@ static __inline Word16 mac_r40 (Word40 L40_var1, Word16 var2, Word16 var3) {
   var_out = round40 (L40_var_out);
 
 #if (WMOPS)
-  multiCounter[currCounter].L40_mac--;
-  multiCounter[currCounter].round40--;
-  multiCounter[currCounter].mac_r40++;
+  BASOP_CNT.L40_mac--;
+  BASOP_CNT.round40--;
+  BASOP_CNT.mac_r40++;
 #endif /* ifdef WMOPS */
 
   return (var_out);
@@ -726,9 +726,9 @@ static __inline Word40 L40_msu (Word40 L40_var1, Word16 var2, Word16 var3) {
   L40_var_out = L40_sub (L40_var1, L40_var_out);
 
 #if (WMOPS)
-  multiCounter[currCounter].L40_mult--;
-  multiCounter[currCounter].L40_sub--;
-  multiCounter[currCounter].L40_msu++;
+  BASOP_CNT.L40_mult--;
+  BASOP_CNT.L40_sub--;
+  BASOP_CNT.L40_msu++;
 #endif /* ifdef WMOPS */
 
   return (L40_var_out);
@@ -785,9 +785,9 @@ static __inline Word16 msu_r40 (Word40 L40_var1, Word16 var2, Word16 var3) {
   var_out = round40 (L40_var_out);
 
 #if (WMOPS)
-  multiCounter[currCounter].L40_msu--;
-  multiCounter[currCounter].round40--;
-  multiCounter[currCounter].msu_r40++;
+  BASOP_CNT.L40_msu--;
+  BASOP_CNT.round40--;
+  BASOP_CNT.msu_r40++;
 #endif /* ifdef WMOPS */
 
   return (var_out);
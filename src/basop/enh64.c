@@ -19,8 +19,8 @@
 #include "enh64.h"
 
 #if (WMOPS)
-extern BASIC_OP multiCounter[MAXCOUNTERS];
-extern int currCounter;
+extern BASOP_TLS BASIC_OP multiCounter[MAXCOUNTERS];
+extern BASOP_TLS int currCounter;
 #endif /* if WMOPS */
 
 
@@ -43,7 +43,8 @@ extern int currCounter;
 *
 *****************************************************************************/
 
-#ifdef ENH_64_BIT_OPERATOR
+/* With BASOP_INLINE, the operators are defined in basop_inline.h */
+#if defined(ENH_64_BIT_OPERATOR) && !defined(BASOP_INLINE)
 
 
 /*___________________________________________________________________________
@@ -81,7 +82,7 @@ Word64 W_add_nosat (Word64 L64_var1, Word64 L64_var2) {
   L64_var_out = L64_var1 + L64_var2;
 
 #if (WMOPS) 
-  multiCounter[currCounter].W_add_nosat++;
+  BASOP_CNT.W_add_nosat++;
 #endif
  
   return L64_var_out;
@@ -123,7 +124,7 @@ Word64 W_sub_nosat (Word64 L64_var1, Word64 L64_var2) {
   L64_var_out = L64_var1 - L64_var2;
 
 #if (WMOPS) 
-  multiCounter[currCounter].W_sub_nosat++;
+  BASOP_CNT.W_sub_nosat++;
 #endif
  
   return L64_var_out;
@@ -192,7 +193,7 @@ Word64 W_shl (Word64 L64_var1, Word16 var2) {
     } 
   }
 #if (WMOPS) 
-  multiCounter[currCounter].W_shl++;
+  BASOP_CNT.W_shl++;
 #endif
  
 //  BASOP_CHECK();
@@ -242,7 +243,7 @@ Word64 W_shr (Word64 L64_var1, Word16 var2) {
     L64_var_out  = W_shl (L64_var1, var2);
 
 #if (WMOPS) 
-    multiCounter[currCounter].W_shl--;
+    BASOP_CNT.W_shl--;
 #endif /* if WMOPS */
  
   } else { 
@@ -250,7 +251,7 @@ Word64 W_shr (Word64 L64_var1, Word16 var2) {
   }
 
 #if (WMOPS) 
-  multiCounter[currCounter].W_shr++;
+  BASOP_CNT.W_shr++;
 #endif /* if WMOPS */
  
   return (L64_var_out);
@@ -303,7 +304,7 @@ Word64 W_shl_nosat (Word64 L64_var1, Word16 var2) {
     L64_var_out = L64_var1 << var2; 
   }
 #if (WMOPS) 
-  multiCounter[currCounter].W_shl_nosat++;
+  BASOP_CNT.W_shl_nosat++;
 #endif
  
 //  BASOP_CHECK ();
@@ -358,7 +359,7 @@ Word64 W_shr_nosat (Word64 L64_var1, Word16 var2) {
   }
 
 #if (WMOPS) 
-  multiCounter[currCounter].W_shr_nosat++;
+  BASOP_CNT.W_shr_nosat++;
 #endif /* if WMOPS */
  
   return (L64_var_out);
@@ -405,7 +406,7 @@ Word64 W_mac_32_16 (Word64  L64_var1, Word32 L_var2, Word16 var3) {
   Word64  L64_var_out = ((Word64) L_var2*var3) << 1; 
   L64_var_out += L64_var1;
 #if (WMOPS) 
-  multiCounter[currCounter].W_mac_32_16++;
+  BASOP_CNT.W_mac_32_16++;
 #endif /* if WMOPS */ 
   return L64_var_out;
 } 
@@ -451,7 +452,7 @@ Word64 W_msu_32_16(Word64  L64_var1, Word32 L_var2, Word16 var3) {
   Word64  L64_var_out = ((Word64 )L_var2*var3) << 1; 
   L64_var_out = L64_var1 - L64_var_out;
 #if (WMOPS) 
-  multiCounter[currCounter].W_msu_32_16++;
+  BASOP_CNT.W_msu_32_16++;
 #endif /* if WMOPS */
   return L64_var_out;
 } 
@@ -491,7 +492,7 @@ Word64 W_msu_32_16(Word64  L64_var1, Word32 L_var2, Word16 var3) {
 Word64 W_mult_32_16(Word32 L_var1, Word16 var2) { 
   Word64  L64_var_out = ((Word64 )L_var1*var2) << 1;
 #if (WMOPS) 
-  multiCounter[currCounter].W_mult_32_16++;
+  BASOP_CNT.W_mult_32_16++;
 #endif /* if WMOPS */
   return L64_var_out;
 } 
@@ -530,7 +531,7 @@ Word64 W_mult_32_16(Word32 L_var1, Word16 var2) {
 Word64 W_mult0_16_16(Word16 var1, Word16 var2) { 
   Word64  L64_var_out = (Word64 )var1*var2;
 #if (WMOPS) 
-  multiCounter[currCounter].W_mult0_16_16++;
+  BASOP_CNT.W_mult0_16_16++;
 #endif /* if WMOPS */
   return L64_var_out;
 } 
@@ -574,7 +575,7 @@ Word64 W_mac0_16_16(Word64 L64_var1, Word16 var2, Word16 var3) {
   Word64  L64_var_out = (Word64 )var2*var3; 
   L64_var_out += L64_var1;
 #if (WMOPS) 
-  multiCounter[currCounter].W_mac0_16_16++;
+  BASOP_CNT.W_mac0_16_16++;
 #endif /* if WMOPS */
   return L64_var_out;
 } 
@@ -619,7 +620,7 @@ Word64 W_msu0_16_16 (Word64 L64_var1, Word16 var2, Word16 var3) {
   Word64  L64_var_out = (Word64) var2*var3; 
   L64_var_out = L64_var1 - L64_var_out;
 #if (WMOPS) 
-  multiCounter[currCounter].W_msu0_16_16++;
+  BASOP_CNT.W_msu0_16_16++;
 #endif /* if WMOPS */
   return L64_var_out;
 } 
@@ -667,7 +668,7 @@ Word32 W_sat_l (Word64 L64_var) {
   }
 
 #if (WMOPS) 
-  multiCounter[currCounter].W_sat_l++;
+  BASOP_CNT.W_sat_l++;
 #endif /* if WMOPS */
  
   return L_var_out;
@@ -710,8 +711,8 @@ Word32 W_sat_m (Word64 L64_var) {
   L_var_out = W_sat_l (L64_var);
 
 #if (WMOPS) 
-  multiCounter[currCounter].W_sat_l--; 
-  multiCounter[currCounter].W_sat_m++;
+  BASOP_CNT.W_sat_l--; 
+  BASOP_CNT.W_sat_m++;
 #endif /* if WMOPS */
  
   return L_var_out;
@@ -751,7 +752,7 @@ Word64 W_deposit32_l (Word32 L_var1) {
   L64_var_out = (Word64) L_var1;
 
 #if (WMOPS) 
-  multiCounter[currCounter].W_deposit32_l++;
+  BASOP_CNT.W_deposit32_l++;
 #endif
  
   return (L64_var_out);
@@ -791,7 +792,7 @@ Word64 W_deposit32_h (Word32 L_var1) {
   L64_var_out = (Word64) L_var1 << 32;
 
 #if (WMOPS) 
-  multiCounter[currCounter].W_deposit32_h++;
+  BASOP_CNT.W_deposit32_h++;
 #endif
  
   return (L64_var_out);
@@ -831,7 +832,7 @@ Word32 W_extract_l (Word64 L64_var1) {
   L_var_out = (Word32) L64_var1;
 
 #if (WMOPS) 
-  multiCounter[currCounter].W_extract_l++;
+  BASOP_CNT.W_extract_l++;
 #endif /* if WMOPS */
  
   return (L_var_out);
@@ -872,7 +873,7 @@ Word32 W_extract_h (Word64 L64_var1) {
   L_var_out = (Word32) (L64_var1 >> 32);
 
 #if (WMOPS) 
-  multiCounter[currCounter].W_extract_h++;
+  BASOP_CNT.W_extract_h++;
 #endif /* if WMOPS */
  
   return (L_var_out);
@@ -914,7 +915,7 @@ Word32 W_extract_h (Word64 L64_var1) {
 Word64 W_mult_16_16 (Word16 var1, Word16 var2) { 
   Word64  L64_var_out = ((Word64) var1*var2) << 1;
 #if (WMOPS) 
-  multiCounter[currCounter].W_mult_16_16++;
+  BASOP_CNT.W_mult_16_16++;
 #endif /* if WMOPS */
   return L64_var_out;
 } 
@@ -959,7 +960,7 @@ Word64 W_mac_16_16 (Word64 L64_acc, Word16 var1, Word16 var2) {
   L64_acc = L64_acc + L64_var_out;
 
 #if (WMOPS) 
-  multiCounter[currCounter].W_mac_16_16++;
+  BASOP_CNT.W_mac_16_16++;
 #endif /* if WMOPS */
   return L64_acc;
 } 
@@ -1006,7 +1007,7 @@ Word64 W_msu_16_16 (Word64 L64_var1, Word16 var2, Word16 var3) {
   Word64  L64_var_out = ((Word64)var2*var3) << 1; 
   L64_var_out = L64_var1 - L64_var_out;
 #if (WMOPS) 
-  multiCounter[currCounter].W_msu_16_16++;
+  BASOP_CNT.W_msu_16_16++;
 #endif /* if WMOPS */
   return L64_var_out;
 } 
@@ -1052,9 +1053,9 @@ Word32 W_shl_sat_l (Word64 L64_var, Word32 n) {
   L_result = W_sat_l (d_var_64);
 
 #if (WMOPS) 
-  multiCounter[currCounter].W_shl_sat_l++; 
-  multiCounter[currCounter].W_shl--; 
-  multiCounter[currCounter].W_sat_l--;
+  BASOP_CNT.W_shl_sat_l++; 
+  BASOP_CNT.W_shl--; 
+  BASOP_CNT.W_sat_l--;
 #endif /* if WMOPS */
  
   return L_result;
@@ -1108,9 +1109,9 @@ Word32 W_round48_L (Word64 L64_var1) {
   }
   L_result = W_extract_h (L64_var_out);
 #if (WMOPS) 
-  multiCounter[currCounter].W_round48_L++; 
-  multiCounter[currCounter].W_extract_h--; 
-  multiCounter[currCounter].W_shl--;
+  BASOP_CNT.W_round48_L++; 
+  BASOP_CNT.W_extract_h--; 
+  BASOP_CNT.W_shl--;
 #endif /* if WMOPS */
  
   return (L_result);
@@ -1165,10 +1166,10 @@ Word16 W_round32_s (Word64 L64_var1) {
   L_var = W_extract_h (L64_var_out); 
   var_out = extract_h (L_var);
 #if (WMOPS) 
-  multiCounter[currCounter].W_round32_s ++; 
-  multiCounter[currCounter].W_extract_h--; 
-  multiCounter[currCounter].extract_h--; 
-  multiCounter[currCounter].W_shl--;
+  BASOP_CNT.W_round32_s ++; 
+  BASOP_CNT.W_extract_h--; 
+  BASOP_CNT.extract_h--; 
+  BASOP_CNT.W_shl--;
 #endif /* if WMOPS */
  
   return (var_out);
@@ -1220,7 +1221,7 @@ Word16 W_norm (Word64 L64_var1) {
     } 
   }
 #if (WMOPS) 
-  multiCounter[currCounter].W_norm ++;
+  BASOP_CNT.W_norm ++;
 #endif /* if WMOPS */
   return (var_out);
 }
@@ -1271,7 +1272,7 @@ Word64 W_add (Word64 L64_var1, Word64 L64_var2) {
     }
 
 #if (WMOPS) 
-  multiCounter[currCounter].W_add++;
+  BASOP_CNT.W_add++;
 #endif 
   return L64_var_out;
 }
@@ -1320,7 +1321,7 @@ Word64 W_sub (Word64 L64_var1, Word64 L64_var2) {
     }
 
 #if (WMOPS) 
-  multiCounter[currCounter].W_add++;
+  BASOP_CNT.W_add++;
 #endif 
   return L64_var_out;
 }
@@ -1365,7 +1366,7 @@ Word64 W_neg (Word64 L64_var1) {
   }
 
 #if (WMOPS)
-    multiCounter[currCounter].W_neg++;
+    BASOP_CNT.W_neg++;
 #endif
     
     return (L64_var_out);
@@ -1417,7 +1418,7 @@ Word64 W_abs (Word64 L64_var1) {
     }
 
 #if (WMOPS)
-    multiCounter[currCounter].W_abs++;
+    BASOP_CNT.W_abs++;
 #endif
 
     return (L64_var_out);
@@ -1467,7 +1468,7 @@ Word64 W_mult_32_32(Word32 L_var1, Word32 L_var2) {
   }
 
 #if (WMOPS) 
-  multiCounter[currCounter].W_mult_32_32++;
+  BASOP_CNT.W_mult_32_32++;
 #endif /* if WMOPS */ 
   return L64_var_out;
 }
@@ -1510,7 +1511,7 @@ Word64 W_mult0_32_32 (Word32 L_var1, Word32 L_var2) {
 
 
 #if (WMOPS) 
-  multiCounter[currCounter].W_mult0_32_32++;
+  BASOP_CNT.W_mult0_32_32++;
 #endif /* if WMOPS */
   return L64_var_out;
 }
@@ -1559,7 +1560,7 @@ UWord64 W_lshl (UWord64 L64_var1, Word16 var2) {
     L64_var_out = L64_var1 << var2 ; 
   }
 #if (WMOPS) 
-  multiCounter[currCounter].W_lshl++;
+  BASOP_CNT.W_lshl++;
 #endif
  
   return (L64_var_out);
@@ -1608,7 +1609,7 @@ UWord64 W_lshr (UWord64 L64_var1, Word16 var2) {
     L64_var_out = L64_var1 >> var2 ; 
   }
 #if (WMOPS) 
-  multiCounter[currCounter].W_lshr++;
+  BASOP_CNT.W_lshr++;
 #endif
  
   return (L64_var_out);
@@ -1652,14 +1653,14 @@ Word32 W_round64_L (Word64 L64_var1) {
   L_result = W_extract_h (L64_var_out);
 
 #if (WMOPS) 
-  multiCounter[currCounter].W_round64_L++; 
-  multiCounter[currCounter].W_extract_h--; 
-  multiCounter[currCounter].W_add--;
+  BASOP_CNT.W_round64_L++; 
+  BASOP_CNT.W_extract_h--; 
+  BASOP_CNT.W_add--;
 #endif /* if WMOPS */
  
   return (L_result);
 }
 
-#endif /* #ifdef ENH_64_BIT_OPERATOR */
+#endif /* #if defined(ENH_64_BIT_OPERATOR) && !defined(BASOP_INLINE) */
 
 /* end of file */
@@ -28,8 +28,8 @@
 #include "enhUL32.h"
 
 #if (WMOPS)
-extern BASIC_OP multiCounter[MAXCOUNTERS];
-extern int currCounter;
+extern BASOP_TLS BASIC_OP multiCounter[MAXCOUNTERS];
+extern BASOP_TLS int currCounter;
 #endif /* if WMOPS */
 
 
@@ -62,7 +62,7 @@ UWord32 UL_deposit_l (UWord16 uvar) {
   UWord32 UL_result;
   UL_result = (UWord32) uvar;   /* no sign extension*/
 #if (WMOPS)
-  multiCounter[currCounter].UL_deposit_l++;
+  BASOP_CNT.UL_deposit_l++;
 #endif
   return (UL_result);
 }
@@ -113,7 +113,7 @@ Word16 norm_ul (UWord32 UL_var1) {
   }
 
 #if (WMOPS)
-  multiCounter[currCounter].norm_ul++;
+  BASOP_CNT.norm_ul++;
 #endif
 
   return (var_out);
@@ -152,7 +152,7 @@ UWord32 UL_addNs (UWord32 UL_var1, UWord32 UL_var2, UWord16 * wrap) {
   }
 
 #if WMOPS
-  multiCounter[currCounter].UL_addNs++;
+  BASOP_CNT.UL_addNs++;
 #endif
 
   return UL_var3;
@@ -189,7 +189,7 @@ UWord32 UL_subNs (UWord32 UL_var1, UWord32 UL_var2, UWord16 * sgn) {
   }
 
 #if WMOPS
-  multiCounter[currCounter].UL_subNs++;
+  BASOP_CNT.UL_subNs++;
 #endif
   return UL_var3;
 }
@@ -240,7 +240,7 @@ void Mpy_32_16_uu (UWord32 UL_var1, UWord16 uvar2, UWord32 *UL_varout_h, UWord16
   *UL_varout_h = (UWord32) (UL64_var1>>16);
 
 #if (WMOPS)
-  multiCounter[currCounter].Mpy_32_16_uu++;
+  BASOP_CNT.Mpy_32_16_uu++;
 #endif /* if WMOPS */
 
   return;
@@ -289,7 +289,7 @@ void Mpy_32_32_uu (UWord32 UL_var1, UWord32 UL_var2, UWord32 *UL_varout_h, UWord
   *UL_varout_l = (UWord32)(UL64_var1);
   
 #if (WMOPS)
-  multiCounter[currCounter].Mpy_32_32_uu++;
+  BASOP_CNT.Mpy_32_32_uu++;
 #endif /* if WMOPS */
 
   return;
@@ -341,7 +341,7 @@ UWord32 UL_Mpy_32_32 (UWord32 UL_var1, UWord32 UL_var2) {
 #undef MASK32
 
 #if (WMOPS)
-  multiCounter[currCounter].UL_Mpy_32_32++;
+  BASOP_CNT.UL_Mpy_32_32++;
 #endif /* if WMOPS */
 
   return UL_varout_l;
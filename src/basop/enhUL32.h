@@ -23,8 +23,8 @@
 
 #if (WMOPS)
 #include "count.h"
-extern BASIC_OP multiCounter[MAXCOUNTERS];  /* existing signed counters are reused for unsigedn operators */
-extern int currCounter;
+extern BASOP_TLS BASIC_OP multiCounter[MAXCOUNTERS];  /* existing signed counters are reused for unsigedn operators */
+extern BASOP_TLS int currCounter;
 #endif /* if WMOPS */
 
 /*****************************************************************************
@@ -0,0 +1,503 @@
+/*
+  ============================================================================
+   File: ENHVEC.C                                        v.1.0 - 17.Oct.2026
+  ============================================================================
+
+            ITU-T STL  BASIC OPERATORS
+
+            VECTOR (BLOCK) OPERATORS
+
+   History:
+   17.Oct.2026 v1.0   Created.
+
+  ============================================================================
+*/
+
+ /*****************************************************************************
+ *
+ *  Vector operators :
+ *    see complete list in .h file
+ *
+ *  The operators work on blocks of 8 Word16 with SSE2 when the compiler
+ *  targets it (always the case on x86-64), and element by element
+ *  otherwise. The results and the Overflow flag are those of the loops of
+ *  scalar operators given in enhvec.h:
+ *  - the dot products accumulate the positive and the negative products
+ *    separately; when neither bound of the partial sums leaves the 32-bit
+ *    range, no L_add of the scalar loop can saturate and the exact sum is
+ *    returned, otherwise the scalar loop is run;
+ *  - the shifts and the scaling saturate per element as shl() and
+ *    mult_r() do, and set Overflow if any element saturates.
+ *
+ *****************************************************************************/
+
+/*****************************************************************************
+ *
+ *  Include-Files
+ *
+ *****************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include "stl.h"
+#include "enhvec.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define VEC_HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
+#if (WMOPS)
+extern BASOP_TLS BASIC_OP multiCounter[MAXCOUNTERS];
+extern BASOP_TLS int currCounter;
+#endif /* if WMOPS */
+
+
+/*****************************************************************************
+ *
+ *   Constants and Globals
+ *
+ *****************************************************************************/
+#ifndef Word64
+#define Word64 long long int
+#endif
+
+
+/*****************************************************************************
+ *
+ *   Functions
+ *
+ *****************************************************************************/
+#ifdef ENH_VEC_OPERATOR
+
+/*___________________________________________________________________________
+ |                                                                           |
+ |   Function Name : vec_dot_pn                                              |
+ |                                                                           |
+ |   Purpose :                                                               |
+ |                                                                           |
+ |   Sums of the positive products x[i]*y[i] (P) and of the magnitudes of    |
+ |   the negative ones (N), separately for the even (index 0) and the odd    |
+ |   (index 1) elements. Returns 1 if some x[i] and y[i] are both MIN_16.    |
+ |   Not counted.                                                            |
+ |___________________________________________________________________________|
+*/
+static int vec_dot_pn (const Word16 x[], const Word16 y[], Word16 len, Word64 P[2], Word64 N[2]) {
+  Word16 i = 0;
+  Word32 L_prod;
+  int min_pair = 0;
+
+  P[0] = P[1] = 0;
+  N[0] = N[1] = 0;
+
+#ifdef VEC_HAVE_SSE2
+  if (len >= 8) {
+    __m128i accP = _mm_setzero_si128 ();
+    __m128i accN = _mm_setzero_si128 ();
+    __m128i mins = _mm_setzero_si128 ();
+    __m128i vmin = _mm_set1_epi16 (MIN_16);
+    __m128i zero = _mm_setzero_si128 ();
+    Word64 tmp[2];
+
+    for (; i + 8 <= len; i += 8) {
+      __m128i vx = _mm_loadu_si128 ((const __m128i *) &x[i]);
+      __m128i vy = _mm_loadu_si128 ((const __m128i *) &y[i]);
+      __m128i lo = _mm_mullo_epi16 (vx, vy);
+      __m128i hi = _mm_mulhi_epi16 (vx, vy);
+      __m128i p0 = _mm_unpacklo_epi16 (lo, hi);       /* elements i .. i+3 */
+      __m128i p1 = _mm_unpackhi_epi16 (lo, hi);       /* elements i+4 .. i+7 */
+      __m128i pos0 = _mm_andnot_si128 (_mm_srai_epi32 (p0, 31), p0);
+      __m128i pos1 = _mm_andnot_si128 (_mm_srai_epi32 (p1, 31), p1);
+      __m128i neg0 = _mm_sub_epi32 (pos0, p0);
+      __m128i neg1 = _mm_sub_epi32 (pos1, p1);
+      /* lanes 0 and 2 hold even elements, 1 and 3 odd ones; each term is
+         at most 2^30, so the sum of two fits an unsigned 32-bit lane */
+      __m128i pos = _mm_add_epi32 (pos0, pos1);
+      __m128i neg = _mm_add_epi32 (neg0, neg1);
+
+      accP = _mm_add_epi64 (accP, _mm_unpacklo_epi32 (pos, zero));
+      accP = _mm_add_epi64 (accP, _mm_unpackhi_epi32 (pos, zero));
+      accN = _mm_add_epi64 (accN, _mm_unpacklo_epi32 (neg, zero));
+      accN = _mm_add_epi64 (accN, _mm_unpackhi_epi32 (neg, zero));
+      mins = _mm_or_si128 (mins, _mm_and_si128 (_mm_cmpeq_epi16 (vx, vmin), _mm_cmpeq_epi16 (vy, vmin)));
+    }
+    _mm_storeu_si128 ((__m128i *) tmp, accP);
+    P[0] = tmp[0];
+    P[1] = tmp[1];
+    _mm_storeu_si128 ((__m128i *) tmp, accN);
+    N[0] = tmp[0];
+    N[1] = tmp[1];
+    min_pair = (_mm_movemask_epi8 (mins) != 0);
+  }
+#endif
+
+  for (; i < len; i++) {
+    L_prod = (Word32) x[i] * (Word32) y[i];
+    if (L_prod >= 0)
+      P[i & 1] += L_prod;
+    else
+      N[i & 1] -= L_prod;
+    if (x[i] == (Word16) MIN_16 && y[i] == (Word16) MIN_16)
+      min_pair = 1;
+  }
+
+  return min_pair;
+}
+
+
+/*___________________________________________________________________________
+ |                                                                           |
+ |   Function Name : V_L_mac                                                 |
+ |                                                                           |
+ |   Purpose :                                                               |
+ |                                                                           |
+ |   Multiply-accumulate of two vectors with saturation, as a chain of len   |
+ |   L_mac() on L_var3.                                                      |
+ |                                                                           |
+ |   Complexity weight : 1 per element                                       |
+ |                                                                           |
+ |   Inputs :                                                                |
+ |                                                                           |
+ |    L_var3   32 bit long signed integer (Word32), initial accumulator.     |
+ |                                                                           |
+ |    x[], y[] len 16 bit short signed integers (Word16).                    |
+ |                                                                           |
+ |    len      number of elements.                                           |
+ |                                                                           |
+ |   Return Value :                                                          |
+ |                                                                           |
+ |    L_var_out                                                              |
+ |             32 bit long signed integer (Word32), accumulator after the    |
+ |             last L_mac().                                                 |
+ |___________________________________________________________________________|
+*/
+Word32 V_L_mac (Word32 L_var3, const Word16 x[], const Word16 y[], Word16 len) {
+  Word32 L_var_out;
+  Word64 P[2], N[2];
+  Word16 i;
+
+  if (len <= 0)
+    return (L_var3);
+
+  if (!vec_dot_pn (x, y, len, P, N)
+      && (Word64) L_var3 + 2 * (P[0] + P[1]) <= (Word64) MAX_32
+      && (Word64) L_var3 - 2 * (N[0] + N[1]) >= (Word64) MIN_32) {
+    L_var_out = (Word32) ((Word64) L_var3 + 2 * (P[0] + P[1] - N[0] - N[1]));
+  } else {
+    L_var_out = L_var3;
+    for (i = 0; i < len; i++)
+      L_var_out = L_mac (L_var_out, x[i], y[i]);
+#if (WMOPS)
+    BASOP_CNT.L_mac -= len;
+#endif
+  }
+
+#if (WMOPS)
+  BASOP_CNT.V_L_mac += len;
+#endif
+  return (L_var_out);
+}
+
+
+/*___________________________________________________________________________
+ |                                                                           |
+ |   Function Name : V_L_mac0                                                |
+ |                                                                           |
+ |   Purpose :                                                               |
+ |                                                                           |
+ |   Multiply-accumulate of two vectors without left shift of the products,  |
+ |   as a chain of len L_mac0() on L_var3.                                   |
+ |                                                                           |
+ |   Complexity weight : 1 per element                                       |
+ |___________________________________________________________________________|
+*/
+Word32 V_L_mac0 (Word32 L_var3, const Word16 x[], const Word16 y[], Word16 len) {
+  Word32 L_var_out;
+  Word64 P[2], N[2];
+  Word16 i;
+
+  if (len <= 0)
+    return (L_var3);
+
+  vec_dot_pn (x, y, len, P, N);
+  if ((Word64) L_var3 + P[0] + P[1] <= (Word64) MAX_32 && (Word64) L_var3 - N[0] - N[1] >= (Word64) MIN_32) {
+    L_var_out = (Word32) ((Word64) L_var3 + P[0] + P[1] - N[0] - N[1]);
+  } else {
+    L_var_out = L_var3;
+    for (i = 0; i < len; i++)
+      L_var_out = L_mac0 (L_var_out, x[i], y[i]);
+#if (WMOPS)
+    BASOP_CNT.L_mac0 -= len;
+#endif
+  }
+
+#if (WMOPS)
+  BASOP_CNT.V_L_mac0 += len;
+#endif
+  return (L_var_out);
+}
+
+
+/*___________________________________________________________________________
+ |                                                                           |
+ |   Function Name : V_L_mac0_2                                              |
+ |                                                                           |
+ |   Purpose :                                                               |
+ |                                                                           |
+ |   Two interleaved chains of L_mac0(): the even elements of x[] and y[]    |
+ |   are accumulated on L_acc[0], the odd ones on L_acc[1] (polyphase and    |
+ |   QMF filters).                                                           |
+ |                                                                           |
+ |   Complexity weight : 1 per element                                       |
+ |___________________________________________________________________________|
+*/
+void V_L_mac0_2 (Word32 L_acc[2], const Word16 x[], const Word16 y[], Word16 len) {
+  Word64 P[2], N[2];
+  Word16 i, k;
+
+  if (len <= 0)
+    return;
+
+  vec_dot_pn (x, y, len, P, N);
+  for (k = 0; k < 2; k++) {
+    if ((Word64) L_acc[k] + P[k] <= (Word64) MAX_32 && (Word64) L_acc[k] - N[k] >= (Word64) MIN_32) {
+      L_acc[k] = (Word32) ((Word64) L_acc[k] + P[k] - N[k]);
+    } else {
+      for (i = k; i < len; i += 2)
+        L_acc[k] = L_mac0 (L_acc[k], x[i], y[i]);
+#if (WMOPS)
+      BASOP_CNT.L_mac0 -= (len - k + 1) / 2;
+#endif
+    }
+  }
+
+#if (WMOPS)
+  BASOP_CNT.V_L_mac0_2 += len;
+#endif
+}
+
+
+/*___________________________________________________________________________
+ |                                                                           |
+ |   Function Name : V_shl                                                   |
+ |                                                                           |
+ |   Purpose :                                                               |
+ |                                                                           |
+ |   Arithmetically shift the len elements of x[] left by var2 positions     |
+ |   with saturation, as shl(); if var2 is negative, shift right by -var2    |
+ |   with sign extension. y[] may be the same array as x[].                  |
+ |                                                                           |
+ |   Complexity weight : 1 per element                                       |
+ |___________________________________________________________________________|
+*/
+void V_shl (Word16 y[], const Word16 x[], Word16 var2, Word16 len) {
+  Word16 i = 0;
+
+  if (len <= 0)
+    return;
+
+#ifdef VEC_HAVE_SSE2
+  if (var2 < 0) {
+    __m128i cnt = _mm_cvtsi32_si128 ((var2 < -16) ? 16 : -var2);
+
+    for (; i + 8 <= len; i += 8)
+      _mm_storeu_si128 ((__m128i *) & y[i], _mm_sra_epi16 (_mm_loadu_si128 ((const __m128i *) &x[i]), cnt));
+  } else {
+    __m128i cnt = _mm_cvtsi32_si128 ((var2 > 16) ? 16 : var2);
+    __m128i vmax = _mm_set1_epi16 (MAX_16);
+    __m128i vmin = _mm_set1_epi16 (MIN_16);
+    /* largest and smallest inputs that do not saturate */
+    __m128i thr_hi = _mm_set1_epi16 ((Word16) ((var2 > 15) ? 0 : (MAX_16 >> var2)));
+    __m128i thr_lo = _mm_set1_epi16 ((Word16) ((var2 > 15) ? 0 : -(MAX_16 >> var2) - 1));
+    __m128i sat = _mm_setzero_si128 ();
+
+    for (; i + 8 <= len; i += 8) {
+      __m128i vx = _mm_loadu_si128 ((const __m128i *) &x[i]);
+      __m128i hi = _mm_cmpgt_epi16 (vx, thr_hi);
+      __m128i lo = _mm_cmplt_epi16 (vx, thr_lo);
+      __m128i hilo = _mm_or_si128 (hi, lo);
+      __m128i res = _mm_andnot_si128 (hilo, _mm_sll_epi16 (vx, cnt));
+
+      res = _mm_or_si128 (res, _mm_or_si128 (_mm_and_si128 (hi, vmax), _mm_and_si128 (lo, vmin)));
+      _mm_storeu_si128 ((__m128i *) & y[i], res);
+      sat = _mm_or_si128 (sat, hilo);
+    }
+    if (_mm_movemask_epi8 (sat) != 0)
+      Overflow = 1;
+  }
+#endif
+
+  /* remaining elements */
+  for (; i < len; i++) {
+    y[i] = shl (x[i], var2);
+#if (WMOPS)
+    BASOP_CNT.shl--;
+#endif
+  }
+
+#if (WMOPS)
+  BASOP_CNT.V_shl += len;
+#endif
+}
+
+
+/*___________________________________________________________________________
+ |                                                                           |
+ |   Function Name : V_mult_r                                                |
+ |                                                                           |
+ |   Purpose :                                                               |
+ |                                                                           |
+ |   Multiply the len elements of x[] by var2 with rounding, as mult_r().    |
+ |   y[] may be the same array as x[].                                       |
+ |                                                                           |
+ |   Complexity weight : 1 per element                                       |
+ |___________________________________________________________________________|
+*/
+void V_mult_r (Word16 y[], const Word16 x[], Word16 var2, Word16 len) {
+  Word16 i = 0;
+
+  if (len <= 0)
+    return;
+
+#ifdef VEC_HAVE_SSE2
+  {
+    __m128i v2 = _mm_set1_epi16 (var2);
+    __m128i rnd = _mm_set1_epi32 (0x00004000L);
+    __m128i vmin = _mm_set1_epi16 (MIN_16);
+    __m128i sat = _mm_setzero_si128 ();
+
+    for (; i + 8 <= len; i += 8) {
+      __m128i vx = _mm_loadu_si128 ((const __m128i *) &x[i]);
+      __m128i lo = _mm_mullo_epi16 (vx, v2);
+      __m128i hi = _mm_mulhi_epi16 (vx, v2);
+      __m128i p0 = _mm_srai_epi32 (_mm_add_epi32 (_mm_unpacklo_epi16 (lo, hi), rnd), 15);
+      __m128i p1 = _mm_srai_epi32 (_mm_add_epi32 (_mm_unpackhi_epi16 (lo, hi), rnd), 15);
+
+      /* only MIN_16 * MIN_16 saturates */
+      _mm_storeu_si128 ((__m128i *) & y[i], _mm_packs_epi32 (p0, p1));
+      sat = _mm_or_si128 (sat, _mm_cmpeq_epi16 (vx, vmin));
+    }
+    if (var2 == (Word16) MIN_16 && _mm_movemask_epi8 (sat) != 0)
+      Overflow = 1;
+  }
+#endif
+
+  /* remaining elements */
+  for (; i < len; i++) {
+    y[i] = mult_r (x[i], var2);
+#if (WMOPS)
+    BASOP_CNT.mult_r--;
+#endif
+  }
+
+#if (WMOPS)
+  BASOP_CNT.V_mult_r += len;
+#endif
+}
+
+
+/*___________________________________________________________________________
+ |                                                                           |
+ |   Function Name : V_norm_s                                                |
+ |                                                                           |
+ |   Purpose :                                                               |
+ |                                                                           |
+ |   Number of left shifts that normalize the block x[] without saturating   |
+ |   any of its elements: the smallest norm_s() of the non-zero elements,    |
+ |   15 if all of them are zero.                                             |
+ |                                                                           |
+ |   Complexity weight : 2 per element (norm_s() and s_min())                |
+ |                                                                           |
+ |   Return Value :                                                          |
+ |                                                                           |
+ |    var_out  16 bit short signed integer (Word16) whose value falls in the |
+ |             range : 0x0000 0000 <= var_out <= 0x0000 000f.                |
+ |___________________________________________________________________________|
+*/
+Word16 V_norm_s (const Word16 x[], Word16 len) {
+  Word16 i = 0, var_out;
+  Word16 m = 0;
+
+  /* norm_s(x) counts the leading zeros of x, or of ~x if x < 0, so the
+     smallest norm is that of the OR of these magnitudes */
+#ifdef VEC_HAVE_SSE2
+  if (len >= 8) {
+    __m128i acc = _mm_setzero_si128 ();
+    Word16 tmp[8];
+    int k;
+
+    for (; i + 8 <= len; i += 8) {
+      __m128i vx = _mm_loadu_si128 ((const __m128i *) &x[i]);
+      acc = _mm_or_si128 (acc, _mm_xor_si128 (vx, _mm_srai_epi16 (vx, 15)));
+    }
+    _mm_storeu_si128 ((__m128i *) tmp, acc);
+    for (k = 0; k < 8; k++)
+      m |= tmp[k];
+  }
+#endif
+
+  for (; i < len; i++)
+    m |= (x[i] < 0) ? ~x[i] : x[i];
+
+  for (var_out = 0; m != 0 && m < 0x4000; var_out++)
+    m <<= 1;
+  if (m == 0)
+    var_out = 15;
+
+#if (WMOPS)
+  if (len > 0)
+    BASOP_CNT.V_norm_s += len;
+#endif
+  return (var_out);
+}
+
+
+/*___________________________________________________________________________
+ |                                                                           |
+ |   Function Name : V_max_abs                                               |
+ |                                                                           |
+ |   Purpose :                                                               |
+ |                                                                           |
+ |   Largest abs_s() of the len elements of x[] (MAX_16 for MIN_16), 0 if    |
+ |   len is 0.                                                               |
+ |                                                                           |
+ |   Complexity weight : 2 per element (abs_s() and s_max())                 |
+ |___________________________________________________________________________|
+*/
+Word16 V_max_abs (const Word16 x[], Word16 len) {
+  Word16 i = 0, var_out = 0;
+
+#ifdef VEC_HAVE_SSE2
+  if (len >= 8) {
+    __m128i acc = _mm_setzero_si128 ();
+    __m128i zero = _mm_setzero_si128 ();
+    Word16 tmp[8];
+    int k;
+
+    for (; i + 8 <= len; i += 8) {
+      __m128i vx = _mm_loadu_si128 ((const __m128i *) &x[i]);
+      acc = _mm_max_epi16 (acc, _mm_max_epi16 (vx, _mm_subs_epi16 (zero, vx)));
+    }
+    _mm_storeu_si128 ((__m128i *) tmp, acc);
+    for (k = 0; k < 8; k++)
+      if (tmp[k] > var_out)
+        var_out = tmp[k];
+  }
+#endif
+
+  for (; i < len; i++) {
+    Word16 a = (x[i] == (Word16) MIN_16) ? MAX_16 : ((x[i] < 0) ? -x[i] : x[i]);
+
+    if (a > var_out)
+      var_out = a;
+  }
+
+#if (WMOPS)
+  if (len > 0)
+    BASOP_CNT.V_max_abs += len;
+#endif
+  return (var_out);
+}
+
+#endif /* ENH_VEC_OPERATOR */
+
+/* end of file */
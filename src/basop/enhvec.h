@@ -0,0 +1,71 @@
+/*
+  ============================================================================
+   File: ENHVEC.H                                        v.1.0 - 17.Oct.2026
+  ============================================================================
+
+            ITU-T STL  BASIC OPERATORS
+
+            VECTOR (BLOCK) OPERATORS
+
+   History:
+   17.Oct.2026 v1.0   Created: dot products, vector scaling and shifting,
+                      block normalization and block maximum, bit-exact with
+                      the chains of scalar operators they replace.
+
+  ============================================================================
+*/
+
+#ifndef _ENHVEC_H
+#define _ENHVEC_H
+
+/*****************************************************************************
+ *
+ *  Constants and Globals
+ *
+ *****************************************************************************/
+#include "stl.h"
+
+#if (WMOPS)
+#include "count.h"
+extern BASOP_TLS BASIC_OP multiCounter[MAXCOUNTERS];
+extern BASOP_TLS int currCounter;
+#endif /* if WMOPS */
+
+/*****************************************************************************
+ *
+ *  Prototypes for vector operators
+ *
+ *  Each operator gives the same result, and the same value of Overflow, as
+ *  the loop of scalar operators given in the comment. The counters are
+ *  incremented once per element, with the weight of the scalar loop body.
+ *
+ *****************************************************************************/
+#ifdef ENH_VEC_OPERATOR
+/* for (i = 0; i < len; i++) L_var3 = L_mac (L_var3, x[i], y[i]); */
+Word32 V_L_mac (Word32 L_var3, const Word16 x[], const Word16 y[], Word16 len);
+
+/* for (i = 0; i < len; i++) L_var3 = L_mac0 (L_var3, x[i], y[i]); */
+Word32 V_L_mac0 (Word32 L_var3, const Word16 x[], const Word16 y[], Word16 len);
+
+/* for (i = 0; i < len; i += 2) {
+ *   L_acc[0] = L_mac0 (L_acc[0], x[i], y[i]);
+ *   L_acc[1] = L_mac0 (L_acc[1], x[i + 1], y[i + 1]);
+ * }                                                   (len even) */
+void V_L_mac0_2 (Word32 L_acc[2], const Word16 x[], const Word16 y[], Word16 len);
+
+/* for (i = 0; i < len; i++) y[i] = shl (x[i], var2); */
+void V_shl (Word16 y[], const Word16 x[], Word16 var2, Word16 len);
+
+/* for (i = 0; i < len; i++) y[i] = mult_r (x[i], var2); */
+void V_mult_r (Word16 y[], const Word16 x[], Word16 var2, Word16 len);
+
+/* n = 15; for (i = 0; i < len; i++) if (x[i] != 0) n = s_min (n, norm_s (x[i])); */
+Word16 V_norm_s (const Word16 x[], Word16 len);
+
+/* m = 0; for (i = 0; i < len; i++) m = s_max (m, abs_s (x[i])); */
+Word16 V_max_abs (const Word16 x[], Word16 len);
+#endif /* ENH_VEC_OPERATOR */
+
+#endif /*_ENHVEC_H*/
+
+/* end of file */
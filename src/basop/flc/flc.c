@@ -1,4 +1,4 @@
-/*                                  v1.0 (part of basop V.2.3) - Sep/2009 */
+/*                                  v1.1 (part of basop V.2.4) - Oct/2026 */
 /*===================================================================*
 *  ITU-T Floating point operation counter STL 2009 tool
 *  Software Release 1.0 (2009-09)
@@ -13,6 +13,12 @@
 * representation nor warranty in regard to the accuracy, completeness or
 * sufficiency of The Software, nor shall VoiceAge Corp. be held liable
 * for any damages whatsoever relating to use of said Software.
+*
+* History:
+* 17.Oct.2026 v1.1  Call tree with inclusive and exclusive ops and
+*                   per-frame peaks, FLC_export_folded(), FLC_enable(),
+*                   FLC_thread_name(); per-thread state when compiled
+*                   with FLC_THREAD_SAFE.
 *===================================================================*/
 
 #include <stdio.h>
@@ -23,6 +29,24 @@
 
 #ifndef DONT_COUNT
 
+/* The program memory list is shared by all the threads */
+#ifdef FLC_THREAD_SAFE
+#if defined(_WIN32)
+#include <windows.h>
+static SRWLOCK flcLock = SRWLOCK_INIT;
+#define FLC_LOCK()   AcquireSRWLockExclusive (&flcLock)
+#define FLC_UNLOCK() ReleaseSRWLockExclusive (&flcLock)
+#else /* if defined(_WIN32) */
+#include <pthread.h>
+static pthread_mutex_t flcLock = PTHREAD_MUTEX_INITIALIZER;
+#define FLC_LOCK()   pthread_mutex_lock (&flcLock)
+#define FLC_UNLOCK() pthread_mutex_unlock (&flcLock)
+#endif /* if defined(_WIN32) */
+#else /* ifdef FLC_THREAD_SAFE */
+#define FLC_LOCK()
+#define FLC_UNLOCK()
+#endif /* ifdef FLC_THREAD_SAFE */
+
 /* printing behavioral defines */
 #define FLC_MAXPREFIXLEN  8
 #define FLC_MAXTAGLEN     17
@@ -44,6 +68,12 @@ struct FLC_Ops_Data {
   unsigned long fn_max;
   unsigned long op_cnt;
   unsigned long optable[FLC_OPEND];
+  /* call tree data fields, updated by FLC_frame_update() */
+  unsigned long frame_cnt;      /* exclusive ops of the current frame */
+  double excl_total;            /* ops of this node alone */
+  double incl_total;            /* ops of this node and of its callees */
+  unsigned long excl_peak;      /* maxima over the frames */
+  unsigned long incl_peak;
 };
 
 struct FLC_Mem_Data {
@@ -51,7 +81,7 @@ struct FLC_Mem_Data {
   int ref;
   int type;
   int count;
-  char *context;
+  char context[FLC_MAXTAGLEN + 1];
 };
 
 typedef struct FLC_Ops_Data FLC_Ops_Data;
@@ -99,13 +129,17 @@ struct FLC_Mem_Summaries {
 typedef struct FLC_Mem_Summaries FLC_Mem_Summaries;
 static FLC_Mem_Summaries *FLC_Mem_find_function (FLC_Mem_Summaries * top, char *name);
 
-/* global variables */
-FLC_Ops_Data *ops_top;
-FLC_Ops_Data *ops_current;
-FLC_Ops_Data *ops_total;
-FLC_Mem_Data *mem_top;
-FILE *FLC_output;
-unsigned long totals[FLC_OPEND];
+/* global variables, one set per thread with FLC_THREAD_SAFE */
+FLC_TLS int FLC_active = 0;
+static FLC_TLS FLC_Ops_Data *ops_top;
+static FLC_TLS FLC_Ops_Data *ops_current;
+static FLC_TLS FLC_Ops_Data *ops_total;
+static FLC_TLS FILE *FLC_output;
+static FLC_TLS unsigned long totals[FLC_OPEND];
+static FLC_TLS int skip_depth;  /* FLC_sub_start() calls while switched off */
+
+/* program memory list, one per process */
+static FLC_Mem_Data *mem_top = NULL;
 
 static FLC_Ops_Data *search_Ops_list (FLC_Ops_Data * top, char *name);
 
@@ -118,6 +152,11 @@ static void FLC_Mem_print ();
 static void FLC_print_sum ();
 static void FLC_print_frame_sum ();
 
+static unsigned long FLC_tree_update (FLC_Ops_Data * pL, int peaks);
+static void FLC_tree_header ();
+static void FLC_tree_print (char *prefix, FLC_Ops_Data * pL);
+static void FLC_folded_print (FILE * f, char *stack, size_t len, FLC_Ops_Data * pL);
+
 /*
  * FLC initialisation. Must be called at start, sets up all the
  * structures and resets counters.
@@ -144,8 +183,8 @@ void FLC_init () {
   strcpy (ops_total->name, "TOTAL");
   ops_total->invocations = 0;   /* this field is actually the frame count */
 
-  /* the mem count structure is initialised a NULL pointer */
-  mem_top = NULL;
+  skip_depth = 0;
+  FLC_active = 1;
 }
 
 /*
@@ -166,10 +205,22 @@ static void FLC_free_node (FLC_Ops_Data * node) {
 }
 
 void FLC_end () {
+  if (ops_top == NULL)
+    return;
+
+  /* ops after the last FLC_frame_update() */
+  FLC_tree_update (ops_top, 0);
+
+  /* the reports of several threads are not mixed */
+  FLC_LOCK ();
   fprintf (FLC_output, "\n===== Call Graph and total ops per function =====\n\n");
   FLC_Ops_header ();
   FLC_Ops_print ("", ops_top);
 
+  fprintf (FLC_output, "\n===== Call Tree (inclusive and exclusive ops) =====\n\n");
+  FLC_tree_header ();
+  FLC_tree_print ("", ops_top);
+
   fprintf (FLC_output, "\n===== Program Memory Usage by Function =====\n\n");
   FLC_Mem_print ();
 
@@ -177,10 +228,13 @@ void FLC_end () {
   if (ops_total->invocations != 0) {
     FLC_print_frame_sum ();
   }
+  FLC_UNLOCK ();
 
+  FLC_active = 0;
   FLC_free_node (ops_top);
   free (ops_total);
   free (ops_top);
+  ops_top = ops_current = ops_total = NULL;
 }
 
 /*
@@ -194,6 +248,11 @@ void FLC_sub_start (char *name) {
   FLC_Ops_Data *newleaf;
   FLC_Ops_Data *temp;
 
+  if (!FLC_active) {
+    skip_depth++;
+    return;
+  }
+
   temp = search_Ops_list (ops_current->subfirst, name);
 
   if (!temp) {
@@ -246,7 +305,11 @@ void FLC_sub_start (char *name) {
  */
 
 void FLC_sub_end () {
-  if (ops_current->parent == NULL) {
+  if (skip_depth > 0) {
+    skip_depth--;
+    return;
+  }
+  if (ops_current == NULL || ops_current->parent == NULL) {
     fprintf (stderr, "ERROR: fell off stack in FLC_sub_end!\n");
   } else {
     /* Handle max counts per subroutine */
@@ -268,6 +331,11 @@ void FLC_sub_end () {
 }
 
 void FLC_frame_update () {
+  if (!FLC_active)
+    return;
+
+  FLC_tree_update (ops_top, 1);
+
   ops_total->invocations++;
 
   if (ops_total->op_cnt > ops_total->fn_max)
@@ -280,14 +348,18 @@ void FLC_frame_update () {
 
 /* the ops count routine */
 void FLC_ops (int op, int c) {
+  unsigned long n;
+
   if (op == FLC_FUNC) {
     /* the "FUNC" opcode is special in the handling of the argument */
-    ops_current->op_cnt += Ops_Weights[op] + c;
+    n = Ops_Weights[op] + c;
     ops_current->optable[op]++;
   } else {
-    ops_current->op_cnt += Ops_Weights[op] * c;
+    n = Ops_Weights[op] * c;
     ops_current->optable[op] += c;
   }
+  ops_current->op_cnt += n;
+  ops_current->frame_cnt += n;
 }
 
 /* the memory count routine */
@@ -303,16 +375,63 @@ void FLC_mem (int op, int c) {
     perror ("Allocating memory for mem counter");
     exit (1);
   }
-  temp->next = mem_top;
   temp->count = c;
   temp->type = op;
-  temp->context = ops_current->name;
+  strcpy (temp->context, ops_current->name);
 
+  FLC_LOCK ();
+  temp->next = mem_top;
   mem_top = temp;
+  FLC_UNLOCK ();
 
   return;
 }
 
+/* memory count of one instrumented line, *f is its "already counted" flag;
+   with several threads only the first one to run the line counts it */
+void FLC_mem_site (int *f, int op, int c) {
+  int first;
+
+  FLC_LOCK ();
+  first = !*f;
+  *f = 1;
+  FLC_UNLOCK ();
+
+  if (first)
+    FLC_mem (op, c);
+}
+
+void FLC_enable (int on) {
+  if (ops_top == NULL)
+    return;                     /* FLC_init() not called by this thread */
+  if (skip_depth > 0 || ops_current != ops_top)
+    fprintf (stderr, "WARNING: FLC_enable() called inside a subsection\n");
+  FLC_active = (on != 0);
+}
+
+void FLC_thread_name (char *name) {
+  if (ops_top == NULL)
+    return;
+  if (strlen (name) > FLC_MAXTAGLEN) {
+    perror ("The counter name is too long");
+    exit (1);
+  }
+  strncpy (ops_top->name, name, FLC_MAXTAGLEN);
+}
+
+void FLC_export_folded (FILE * f) {
+  char stack[FLC_MAXDEPTH * (FLC_MAXTAGLEN + 1) + 1];
+
+  if (ops_top == NULL)
+    return;
+
+  FLC_tree_update (ops_top, 0);
+  FLC_LOCK ();
+  FLC_folded_print (f, stack, 0, ops_top);
+  fflush (f);
+  FLC_UNLOCK ();
+}
+
 
 /**************************************************************************
  * From here, there are only internal (static) functions                  *
@@ -400,6 +519,113 @@ static void FLC_Ops_line (char *pre, FLC_Ops_Data * pL) {
   fputc ('\n', FLC_output);
 }
 
+/****** Call tree: inclusive and exclusive ops *************/
+
+/*
+ * adds the ops of the current frame to the totals of the nodes of a list
+ * and of their sublists, and returns the inclusive ops of the list
+ */
+static unsigned long FLC_tree_update (FLC_Ops_Data * pL, int peaks) {
+  unsigned long incl, sum = 0;
+
+  for (; pL; pL = pL->next) {
+    incl = pL->frame_cnt;
+    if (pL->subfirst != NULL)
+      incl += FLC_tree_update (pL->subfirst, peaks);
+
+    pL->excl_total += pL->frame_cnt;
+    pL->incl_total += incl;
+    if (peaks) {
+      if (pL->frame_cnt > pL->excl_peak)
+        pL->excl_peak = pL->frame_cnt;
+      if (incl > pL->incl_peak)
+        pL->incl_peak = incl;
+    }
+    pL->frame_cnt = 0;
+    sum += incl;
+  }
+  return sum;
+}
+
+#define FLC_TFIELDS 5
+static char *FLC_tfields[FLC_TFIELDS] = {
+  "Incl. Ops", "Excl. Ops", "Incl. %", "Peak/frame", "Peak WMOPS"
+};
+
+static void FLC_tree_header () {
+  char formatstring[10];
+  int n;
+
+  sprintf (formatstring, "%%-%ds", FLC_MAXTAGLEN);
+  fprintf (FLC_output, formatstring, "Function");
+  sprintf (formatstring, "%%%ds", FLC_OPSCNT_LEN - 4);
+  for (n = 0; n < FLC_TFIELDS; n++) {
+    fprintf (FLC_output, formatstring, FLC_tfields[n]);
+  }
+  fputs ("\n-----------\n", FLC_output);
+}
+
+/* the peaks are those of the inclusive ops */
+static void FLC_tree_print (char *prefix, FLC_Ops_Data * pL) {
+  char namestr[FLC_MAXTAGLEN + 1] = { 0 };
+  char newprefix[FLC_MAXPREFIXLEN + 1] = { 0 };
+  char formatstring[10];
+  double all = (ops_top->incl_total > 0) ? ops_top->incl_total : 1.0;
+
+  do {
+    strncpy (namestr, prefix, FLC_MAXPREFIXLEN);
+    strncat (namestr, pL->name, FLC_MAXTAGLEN - strlen (namestr));
+
+    sprintf (formatstring, "%%-%ds", FLC_MAXTAGLEN);
+    fprintf (FLC_output, formatstring, namestr);
+    sprintf (formatstring, "%%%d.0f", FLC_OPSCNT_LEN - 4);
+    fprintf (FLC_output, formatstring, pL->incl_total);
+    fprintf (FLC_output, formatstring, pL->excl_total);
+    sprintf (formatstring, "%%%d.1f", FLC_OPSCNT_LEN - 4);
+    fprintf (FLC_output, formatstring, 100.0 * pL->incl_total / all);
+    sprintf (formatstring, "%%%dlu", FLC_OPSCNT_LEN - 4);
+    fprintf (FLC_output, formatstring, pL->incl_peak);
+    sprintf (formatstring, "%%%d.4f", FLC_OPSCNT_LEN - 4);
+    fprintf (FLC_output, formatstring, pL->incl_peak / (1000.0 * FLC_FRAMELEN));
+    fputc ('\n', FLC_output);
+
+    if (pL->subfirst != NULL) {
+      strncpy (newprefix, prefix, FLC_MAXPREFIXLEN - 1);
+      strcat (newprefix, "-");
+      FLC_tree_print (newprefix, pL->subfirst);
+    }
+
+    pL = pL->next;
+  }
+  while (pL != NULL);
+}
+
+/*
+ * one line "parent;child;... ops" per node with exclusive ops; stack holds
+ * the path of the parent, len its length
+ */
+static void FLC_folded_print (FILE * f, char *stack, size_t len, FLC_Ops_Data * pL) {
+  size_t n;
+
+  for (; pL; pL = pL->next) {
+    if (len >= (FLC_MAXDEPTH - 1) * (FLC_MAXTAGLEN + 1)) {
+      fprintf (stderr, "ERROR: call tree deeper than FLC_MAXDEPTH in FLC_export_folded!\n");
+      return;
+    }
+    n = len;
+    if (n > 0)
+      stack[n++] = ';';
+    strcpy (stack + n, pL->name);
+    n += strlen (pL->name);
+
+    if (pL->excl_total > 0)
+      fprintf (f, "%s %.0f\n", stack, pL->excl_total);
+    if (pL->subfirst != NULL)
+      FLC_folded_print (f, stack, n, pL->subfirst);
+    stack[len] = '\0';
+  }
+}
+
 /****** Memory usage printing *************/
 
 static void FLC_Mem_print () {
@@ -497,7 +723,7 @@ static FLC_Mem_Summaries *FLC_Mem_find_function (FLC_Mem_Summaries * top, char *
   FLC_Mem_Summaries *pL;
 
   for (pL = top; pL; pL = pL->next)
-    if (pL->name == name)
+    if (!strcmp (pL->name, name))
       return pL;
 
   return pL;
@@ -546,5 +772,11 @@ void FLC_sub_end () {
 }
 void FLC_frame_update () {
 }
+void FLC_enable (int on) {
+}
+void FLC_thread_name (char *name) {
+}
+void FLC_export_folded (FILE * f) {
+}
 
 #endif /* end of DONT_COUNT */
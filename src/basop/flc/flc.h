@@ -1,4 +1,4 @@
-/*                                  v1.0 (part of basop V.2.3) - Sep/2009 */
+/*                                  v1.1 (part of basop V.2.4) - Oct/2026 */
 /*===================================================================*
 *  ITU-T Floating point operation counter STL 2009 tool
 *  Software Release 1.0 (2009-09)
@@ -13,6 +13,12 @@
 * representation nor warranty in regard to the accuracy, completeness or
 * sufficiency of The Software, nor shall VoiceAge Corp. be held liable
 * for any damages whatsoever relating to use of said Software.
+*
+* History:
+* 17.Oct.2026 v1.1  Inclusive and exclusive ops and per-frame peaks in the
+*                   call tree, folded-stack export, run-time switch
+*                   FLC_enable(), one call tree per thread when compiled
+*                   with FLC_THREAD_SAFE.
 *===================================================================*/
 
 #ifndef FLC_H
@@ -31,6 +37,24 @@
 /* Scaling factor to estimate corresponding complexity in fixed point implementation */
 #define FLC_SCALEFAC 1.1F
 
+/* define FLC_THREAD_SAFE to keep one call tree per thread (thread-local
+   storage): each thread calls FLC_init(), counts its own ops and prints its
+   own report with FLC_end(). The program ROM is counted once per process. */
+#ifdef FLC_THREAD_SAFE
+#if defined(_MSC_VER)
+#define FLC_TLS __declspec(thread)
+#elif defined(__GNUC__) || defined(__SUNPRO_C) || defined(__xlC__)
+#define FLC_TLS __thread
+#else
+#define FLC_TLS _Thread_local
+#endif
+#else
+#define FLC_TLS
+#endif
+
+/* maximum depth of the call tree for FLC_export_folded() */
+#define FLC_MAXDEPTH 64
+
 /* opcodes - this list must match the names in flc.c */
 enum flc_fields {
   FLC_NOP = 0,
@@ -61,8 +85,13 @@ enum flc_fields {
 /* the most important fn */
 void FLC_ops (int op, int count);
 void FLC_mem (int op, int count);
+void FLC_mem_site (int *f, int op, int count);
+
+/* non-zero between FLC_init() and FLC_end() unless switched off with
+   FLC_enable(0): the macros below then cost one test */
+extern FLC_TLS int FLC_active;
 
-#define _FLC(o,c)  {static int f=0; FLC_ops((o),(c)); if (!f) {f=1;FLC_mem((o),(c));}}
+#define _FLC(o,c)  {static int f=0; if (FLC_active) {FLC_ops((o),(c)); if (!f) FLC_mem_site(&f,(o),(c));}}
 #define ADD(c)          _FLC( FLC_ADD,      (c) )
 #define MULT(c)         _FLC( FLC_MULT,     (c) )
 #define MAC(c)          _FLC( FLC_MAC,      (c) )
@@ -84,7 +113,7 @@ void FLC_mem (int op, int count);
 #define TEST(c)         _FLC( FLC_TEST,     (c) )
 
 /* Double Ops count as double the operations but same memory */
-#define _FLCD(o,c)  {static int f=0; FLC_ops((o),2*(c)); if (!f) {f=1;FLC_mem((o),(c));}}
+#define _FLCD(o,c)  {static int f=0; if (FLC_active) {FLC_ops((o),2*(c)); if (!f) FLC_mem_site(&f,(o),(c));}}
 #define DADD(c)         _FLCD( FLC_ADD,     (c) )
 #define DMULT(c)        _FLCD( FLC_MULT,    (c) )
 #define DMOVE(c)        _FLCD( FLC_MOVE,    (c) )
@@ -126,4 +155,17 @@ void FLC_sub_start (char *name);
 void FLC_sub_end ();
 void FLC_frame_update ();
 
+/* switch the counting of the calling thread off (0) and on again; call it
+   between frames, outside of any FLC_sub_start()/FLC_sub_end() pair */
+void FLC_enable (int on);
+
+/* name of the root of the call tree of the calling thread (default "ROOT") */
+void FLC_thread_name (char *name);
+
+/* write the exclusive ops of every path of the call tree of the calling
+   thread in the folded-stack format of flame graph tools
+   ("ROOT;Autocorr;Set_Zero 4100"); the trees of several threads can be
+   written to the same file */
+void FLC_export_folded (FILE * f);
+
 #endif
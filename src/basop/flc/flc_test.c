@@ -0,0 +1,185 @@
+/*                                                           17.Oct.2026 v1.0
+  ===========================================================================
+
+  FLC_TEST.C
+  ~~~~~~~~~~
+
+  Description:
+  ~~~~~~~~~~~~
+
+  Test of the call tree of the floating-point complexity tool, built with
+  FLC_THREAD_SAFE. Every thread names its tree after its channel, runs
+  frames of a two-level instrumented workload whose ops depend on the
+  channel and the frame, switches the counting off for some frames with
+  FLC_enable(), and exports its tree with FLC_export_folded(). The
+  exclusive ops of every path are read back and compared with the ops
+  computed from the workload; the trees of all the threads are also
+  written to one folded-stack file.
+
+  Usage:
+  ~~~~~~
+  $ flc_test [threads] [file.folded]
+
+  History:
+  ~~~~~~~~
+  17.Oct.2026 v1.0 Created.
+
+  ===========================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "flc.h"
+
+#ifndef FLC_THREAD_SAFE
+#error "flc_test must be compiled with FLC_THREAD_SAFE defined"
+#endif
+
+#define MAX_THREADS 16
+#define N_FRAMES    20
+
+static FILE *folded = NULL;
+
+/* 5 * (ch + 1) ops */
+static void kernel (int ch) {
+  FLC_sub_start ("Kernel");
+  MULT (5 * (ch + 1));
+  FLC_sub_end ();
+}
+
+/* 10 + frame ops, 2 * 3 ops for the calls, and the kernel twice */
+static void filter (int ch, int frame) {
+  FLC_sub_start ("Filter");
+  ADD (10 + frame);
+  kernel (ch);
+  FUNC (1);
+  kernel (ch);
+  FUNC (1);
+  FLC_sub_end ();
+}
+
+/* frames 3 and 4 are not counted */
+static int counted (int frame) {
+  return frame != 3 && frame != 4;
+}
+
+typedef struct {
+  int ch;
+  long n_err;
+} THREAD_ARG;
+
+static long check_line (const char *path, double ops, double expected) {
+  if (ops == expected)
+    return 0;
+  fprintf (stderr, "%s: %.0f ops, expected %.0f\n", path, ops, expected);
+  return 1;
+}
+
+static void *channel (void *p) {
+  THREAD_ARG *arg = (THREAD_ARG *) p;
+  char name[32], line[256], path[200];
+  double ops, e_root = 0, e_filter = 0, e_kernel = 0;
+  int frame, n_lines = 0;
+  FILE *f;
+
+  FLC_init ();
+  sprintf (name, "ch%d", arg->ch);
+  FLC_thread_name (name);
+
+  for (frame = 0; frame < N_FRAMES; frame++) {
+    FLC_enable (counted (frame));
+    filter (arg->ch, frame);
+    FUNC (2);
+    FLC_frame_update ();
+    if (counted (frame)) {
+      e_root += 2 + 2;
+      e_filter += 10 + frame + 2 * 3;
+      e_kernel += 2 * 5 * (arg->ch + 1);
+    }
+  }
+  FLC_enable (1);
+
+  /* own tree, read back */
+  if ((f = tmpfile ()) == NULL) {
+    arg->n_err++;
+    return NULL;
+  }
+  FLC_export_folded (f);
+  rewind (f);
+  while (fgets (line, sizeof (line), f) != NULL) {
+    if (sscanf (line, "%199s %lf", path, &ops) != 2) {
+      arg->n_err++;
+      continue;
+    }
+    n_lines++;
+    if (strcmp (path, name) == 0)
+      arg->n_err += check_line (path, ops, e_root);
+    else if (strcmp (path + strlen (name), ";Filter") == 0)
+      arg->n_err += check_line (path, ops, e_filter);
+    else if (strcmp (path + strlen (name), ";Filter;Kernel") == 0)
+      arg->n_err += check_line (path, ops, e_kernel);
+    else {
+      fprintf (stderr, "unexpected path %s\n", path);
+      arg->n_err++;
+    }
+  }
+  fclose (f);
+  if (n_lines != 3) {
+    fprintf (stderr, "%s: %d paths exported, expected 3\n", name, n_lines);
+    arg->n_err++;
+  }
+
+  /* all the trees in one file */
+  if (folded != NULL)
+    FLC_export_folded (folded);
+
+  FLC_end ();
+  return NULL;
+}
+
+
+int main (int argc, char *argv[]) {
+  pthread_t thread[MAX_THREADS];
+  THREAD_ARG arg[MAX_THREADS];
+  int k, n_threads = 4;
+  long n_err = 0;
+
+  if (argc > 1)
+    n_threads = atoi (argv[1]);
+  if (n_threads < 1 || n_threads > MAX_THREADS) {
+    fprintf (stderr, "Usage: flc_test [threads] [file.folded]\n");
+    return 1;
+  }
+  if (argc > 2 && (folded = fopen (argv[2], "w")) == NULL) {
+    fprintf (stderr, "flc_test: can not open %s\n", argv[2]);
+    return 1;
+  }
+
+  /* the counting macros do nothing in a thread without FLC_init() */
+  ADD (1);
+  FLC_sub_start ("None");
+  MULT (1);
+  FLC_sub_end ();
+
+  for (k = 0; k < n_threads; k++) {
+    arg[k].ch = k;
+    arg[k].n_err = 0;
+    if (pthread_create (&thread[k], NULL, channel, &arg[k]) != 0) {
+      fprintf (stderr, "flc_test: can not create thread %d\n", k);
+      return 1;
+    }
+  }
+  for (k = 0; k < n_threads; k++) {
+    pthread_join (thread[k], NULL);
+    n_err += arg[k].n_err;
+  }
+  if (folded != NULL)
+    fclose (folded);
+
+  printf ("flc_test: %d threads, %ld errors\n", n_threads, n_err);
+  return (n_err == 0) ? 0 : 1;
+}
+
+/* end of file */
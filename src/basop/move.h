@@ -26,14 +26,14 @@
 #include "stl.h"
 
 #if (WMOPS)
-extern BASIC_OP multiCounter[MAXCOUNTERS];
-extern int currCounter;
+extern BASOP_TLS BASIC_OP multiCounter[MAXCOUNTERS];
+extern BASOP_TLS int currCounter;
 #endif /* ifdef WMOPS */
 
 
 static __inline void move16 (void) {
 #if WMOPS
-  multiCounter[currCounter].move16++;
+  BASOP_CNT.move16++;
 #endif /* ifdef WMOPS */
 }
 
@@ -44,7 +44,7 @@ static __inline void move16 (void) {
 
 static __inline void move32 (void) {
 #if WMOPS
-  multiCounter[currCounter].move32++;
+  BASOP_CNT.move32++;
 #endif /* ifdef WMOPS */
 }
 
@@ -52,7 +52,7 @@ static __inline void move32 (void) {
 #ifdef ENH_64_BIT_OPERATOR
 static __inline void move64 (void) {
 #if WMOPS
-  multiCounter[currCounter].move64++;
+  BASOP_CNT.move64++;
 #endif /* if WMOPS */
 }
 #endif /* #ifdef ENH_64_BIT_OPERATOR */
@@ -62,21 +62,21 @@ static __inline void move64 (void) {
 
 static __inline void test (void) {
 #if WMOPS
-  multiCounter[currCounter].Test++;
+  BASOP_CNT.Test++;
 #endif /* ifdef WMOPS */
 }
 
 
 static __inline void logic16 (void) {
 #if WMOPS
-  multiCounter[currCounter].Logic16++;
+  BASOP_CNT.Logic16++;
 #endif /* ifdef WMOPS */
 }
 
 
 static __inline void logic32 (void) {
 #if WMOPS
-  multiCounter[currCounter].Logic32++;
+  BASOP_CNT.Logic32++;
 #endif /* ifdef WMOPS */
 }
 
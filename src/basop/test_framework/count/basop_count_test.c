@@ -0,0 +1,172 @@
+/*                                                           17.Oct.2026 v1.1
+  ===========================================================================
+
+  BASOP_COUNT_TEST.C
+  ~~~~~~~~~~~~~~~~~~
+
+  Description:
+  ~~~~~~~~~~~~
+
+  Test of the complexity counters of count.c, built once in the default
+  counting mode and once with BASOP_TALLY defined (see count.h). Two
+  counter groups process frames of varying length, with the counter group
+  switched in the middle of each frame. The per-frame statistics are
+  exported with WMOPS_export_csv() and WMOPS_export_json(); the CSV file
+  is read back and every frame must have the number of operations
+  computed from the workload. The exports of the two builds are then
+  compared by ctest. Last, the counters of a group are read directly
+  from multiCounter[] after fwc(), which must include the tally.
+
+  Usage:
+  ~~~~~~
+  $ basop_count_test file.csv file.json
+
+  History:
+  ~~~~~~~~
+  17.Oct.2026 v1.0 Created.
+  17.Oct.2026 v1.1 Direct read of multiCounter[] after fwc().
+
+  ===========================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "stl.h"
+
+#define N_FRAMES  60
+#define L_MAX     128
+
+static Word16 x[L_MAX], y[L_MAX];
+static Word32 acc = 0;
+static Word16 sum = 0;
+
+/* 3 weighted operations per sample */
+static void kernel (Word16 len) {
+  Word16 i;
+
+  for (i = 0; i < len; i++) {
+    acc = L_mac (acc, x[i], y[i]);
+    sum = add (sum, x[i]);
+    move16 ();
+  }
+}
+
+/* 2 weighted operations per sample */
+static void kernel2 (Word16 len) {
+  Word16 i;
+
+  for (i = 0; i < len; i++) {
+    acc = L_mac (acc, shl (x[i], 1), y[i]);
+  }
+}
+
+/* Number of operations of each frame in the analysis and synthesis groups */
+static long ops_analysis (int frame) {
+  return 3 * (40 + (7 * frame) % 50) + 2 * 5;
+}
+
+static long ops_synthesis (int frame) {
+  return 2 * 3 * (20 + (13 * frame) % 30);
+}
+
+
+int main (int argc, char *argv[]) {
+  int ana, syn, frame, n_err = 0, n_lines = 0;
+  long f, ops, expected;
+  double wmops;
+  char name[64], line[256];
+  FILE *csv;
+  Word16 i;
+
+  if (argc != 3) {
+    fprintf (stderr, "Usage: basop_count_test file.csv file.json\n");
+    return 1;
+  }
+
+  for (i = 0; i < L_MAX; i++) {
+    x[i] = (Word16) (i * 257 - 16000);
+    y[i] = (Word16) (i * 31 - 2000);
+  }
+
+  setFrameRate (16000, 160);
+  ana = getCounterId ("Analysis");
+  syn = getCounterId ("Synthesis");
+  setCounter (ana);
+  Init_WMOPS_counter ();
+  setCounter (syn);
+  Init_WMOPS_counter ();
+
+  for (frame = 0; frame < N_FRAMES; frame++) {
+    setCounter (ana);
+    fwc ();
+    Reset_WMOPS_counter ();
+    kernel ((Word16) (40 + (7 * frame) % 50));
+
+    setCounter (syn);
+    fwc ();
+    Reset_WMOPS_counter ();
+    kernel ((Word16) (20 + (13 * frame) % 30));
+
+    /* back to the analysis group within the same frame */
+    setCounter (ana);
+    kernel2 (5);
+
+    setCounter (syn);
+    kernel ((Word16) (20 + (13 * frame) % 30));
+  }
+
+  setCounter (ana);
+  fwc ();
+  WMOPS_output (0);
+  setCounter (syn);
+  fwc ();
+  WMOPS_output (0);
+
+  WMOPS_export_csv (argv[1]);
+  WMOPS_export_json (argv[2]);
+
+  /* read the per-frame operations back */
+  if ((csv = fopen (argv[1], "r")) == NULL || fgets (line, sizeof (line), csv) == NULL) {
+    fprintf (stderr, "basop_count_test: can not read %s\n", argv[1]);
+    return 1;
+  }
+  while (fgets (line, sizeof (line), csv) != NULL) {
+    if (sscanf (line, "\"%63[^\"]\",%ld,%ld,%lf", name, &f, &ops, &wmops) != 4) {
+      fprintf (stderr, "basop_count_test: bad line %s", line);
+      n_err++;
+      continue;
+    }
+    expected = (strcmp (name, "Analysis") == 0) ? ops_analysis ((int) f) : ops_synthesis ((int) f);
+    if (ops != expected) {
+      if (n_err < 5)
+        fprintf (stderr, "%s frame %ld: %ld operations, expected %ld\n", name, f, ops, expected);
+      n_err++;
+    }
+    n_lines++;
+  }
+  fclose (csv);
+
+  if (n_lines != 2 * N_FRAMES) {
+    fprintf (stderr, "basop_count_test: %d frames exported, expected %d\n", n_lines, 2 * N_FRAMES);
+    n_err++;
+  }
+
+  /* code reading multiCounter[] directly only needs fwc() first, also
+     in BASOP_TALLY builds */
+  setCounter (ana);
+  fwc ();
+  Reset_WMOPS_counter ();
+  kernel2 (7);
+  fwc ();
+  if (multiCounter[currCounter].L_mac != 7 || multiCounter[currCounter].shl != 7) {
+    fprintf (stderr, "basop_count_test: %lu L_mac and %lu shl counted after fwc(), expected 7\n",
+             (unsigned long) multiCounter[currCounter].L_mac, (unsigned long) multiCounter[currCounter].shl);
+    n_err++;
+  }
+
+  printf ("basop_count_test: %d frames, %d errors (checksum %ld %d)\n", n_lines, n_err, (long) acc, sum);
+  return (n_err == 0) ? 0 : 1;
+}
+
+/* end of file */
@@ -0,0 +1,123 @@
+/*                                                           17.Oct.2026 v1.0
+  ===========================================================================
+
+  BASOP_INLINE_OPS.H
+  ~~~~~~~~~~~~~~~~~~
+
+  List of the operators checked by basop_inline_test, expanded with the
+  OP1() .. OP3() macros defined by the including file:
+
+    OPn (return type, name, type of argument 1, generator of argument 1,
+         ..., type of argument n, generator of argument n)
+
+  The generators are the argument classes of basop_inline_test.c (A16,
+  A32 and A64 for any value, S16, S32, S64, S64L and S64R for shift
+  counts). The operators with pointer outputs (rotations) and with
+  restricted input ranges (divisions) are checked separately.
+
+  History:
+  ~~~~~~~~
+  17.Oct.2026 v1.0 Created.
+
+  ===========================================================================
+*/
+
+/* basop32 */
+OP2 (Word16, add, Word16, A16, Word16, A16)
+OP2 (Word16, sub, Word16, A16, Word16, A16)
+OP1 (Word16, abs_s, Word16, A16)
+OP2 (Word16, shl, Word16, A16, Word16, S16)
+OP2 (Word16, shr, Word16, A16, Word16, S16)
+OP2 (Word16, mult, Word16, A16, Word16, A16)
+OP2 (Word32, L_mult, Word16, A16, Word16, A16)
+OP1 (Word16, negate, Word16, A16)
+OP1 (Word16, extract_h, Word32, A32)
+OP1 (Word16, extract_l, Word32, A32)
+OP1 (Word16, round_fx, Word32, A32)
+OP3 (Word32, L_mac, Word32, A32, Word16, A16, Word16, A16)
+OP3 (Word32, L_msu, Word32, A32, Word16, A16, Word16, A16)
+OP3 (Word32, L_macNs, Word32, A32, Word16, A16, Word16, A16)
+OP3 (Word32, L_msuNs, Word32, A32, Word16, A16, Word16, A16)
+OP2 (Word32, L_add, Word32, A32, Word32, A32)
+OP2 (Word32, L_sub, Word32, A32, Word32, A32)
+OP2 (Word32, L_add_c, Word32, A32, Word32, A32)
+OP2 (Word32, L_sub_c, Word32, A32, Word32, A32)
+OP1 (Word32, L_negate, Word32, A32)
+OP2 (Word16, mult_r, Word16, A16, Word16, A16)
+OP2 (Word32, L_shl, Word32, A32, Word16, S32)
+OP2 (Word32, L_shr, Word32, A32, Word16, S32)
+OP2 (Word16, shr_r, Word16, A16, Word16, S16)
+OP3 (Word16, mac_r, Word32, A32, Word16, A16, Word16, A16)
+OP3 (Word16, msu_r, Word32, A32, Word16, A16, Word16, A16)
+OP1 (Word32, L_deposit_h, Word16, A16)
+OP1 (Word32, L_deposit_l, Word16, A16)
+OP2 (Word32, L_shr_r, Word32, A32, Word16, S32)
+OP1 (Word32, L_abs, Word32, A32)
+OP1 (Word32, L_sat, Word32, A32)
+OP1 (Word16, norm_s, Word16, A16)
+OP1 (Word16, norm_l, Word32, A32)
+OP2 (Word32, L_mls, Word32, A32, Word16, A16)
+OP2 (Word16, i_mult, Word16, A16, Word16, A16)
+OP2 (Word32, L_mult0, Word16, A16, Word16, A16)
+OP3 (Word32, L_mac0, Word32, A32, Word16, A16, Word16, A16)
+OP3 (Word32, L_msu0, Word32, A32, Word16, A16, Word16, A16)
+
+/* enh1632 */
+OP2 (Word16, shl_r, Word16, A16, Word16, S16)
+OP2 (Word32, L_shl_r, Word32, A32, Word16, S32)
+OP2 (Word16, lshl, Word16, A16, Word16, S16)
+OP2 (Word16, lshr, Word16, A16, Word16, S16)
+OP2 (Word32, L_lshl, Word32, A32, Word16, S32)
+OP2 (Word32, L_lshr, Word32, A32, Word16, S32)
+
+/* enh64 */
+OP2 (Word64, W_add_nosat, Word64, A64, Word64, A64)
+OP2 (Word64, W_sub_nosat, Word64, A64, Word64, A64)
+OP2 (Word64, W_shl, Word64, A64, Word16, S64L)
+OP2 (Word64, W_shr, Word64, A64, Word16, S64R)
+OP2 (Word64, W_shl_nosat, Word64, A64, Word16, S64)
+OP2 (Word64, W_shr_nosat, Word64, A64, Word16, S64)
+OP2 (Word64, W_mult_32_16, Word32, A32, Word16, A16)
+OP3 (Word64, W_mac_32_16, Word64, A64, Word32, A32, Word16, A16)
+OP3 (Word64, W_msu_32_16, Word64, A64, Word32, A32, Word16, A16)
+OP2 (Word64, W_mult0_16_16, Word16, A16, Word16, A16)
+OP3 (Word64, W_mac0_16_16, Word64, A64, Word16, A16, Word16, A16)
+OP3 (Word64, W_msu0_16_16, Word64, A64, Word16, A16, Word16, A16)
+OP2 (Word64, W_mult_16_16, Word16, A16, Word16, A16)
+OP3 (Word64, W_mac_16_16, Word64, A64, Word16, A16, Word16, A16)
+OP3 (Word64, W_msu_16_16, Word64, A64, Word16, A16, Word16, A16)
+OP1 (Word64, W_deposit32_l, Word32, A32)
+OP1 (Word64, W_deposit32_h, Word32, A32)
+OP1 (Word32, W_sat_l, Word64, A64)
+OP1 (Word32, W_sat_m, Word64, A64)
+OP2 (Word32, W_shl_sat_l, Word64, A64, Word32, S64L)
+OP1 (Word32, W_extract_l, Word64, A64)
+OP1 (Word32, W_extract_h, Word64, A64)
+OP1 (Word32, W_round48_L, Word64, A64)
+OP1 (Word16, W_round32_s, Word64, A64)
+OP1 (Word16, W_norm, Word64, A64)
+OP2 (Word64, W_add, Word64, A64, Word64, A64)
+OP2 (Word64, W_sub, Word64, A64, Word64, A64)
+OP1 (Word64, W_neg, Word64, A64)
+OP1 (Word64, W_abs, Word64, A64)
+OP2 (Word64, W_mult_32_32, Word32, A32, Word32, A32)
+OP2 (Word64, W_mult0_32_32, Word32, A32, Word32, A32)
+OP2 (UWord64, W_lshl, UWord64, A64, Word16, S64)
+OP2 (UWord64, W_lshr, UWord64, A64, Word16, S64)
+OP1 (Word32, W_round64_L, Word64, A64)
+
+/* enh32 */
+OP2 (Word32, Mpy_32_16_1, Word32, A32, Word16, A16)
+OP2 (Word32, Mpy_32_16_r, Word32, A32, Word16, A16)
+OP2 (Word32, Mpy_32_32, Word32, A32, Word32, A32)
+OP2 (Word32, Mpy_32_32_r, Word32, A32, Word32, A32)
+OP3 (Word32, Madd_32_16, Word32, A32, Word32, A32, Word16, A16)
+OP3 (Word32, Madd_32_16_r, Word32, A32, Word32, A32, Word16, A16)
+OP3 (Word32, Msub_32_16, Word32, A32, Word32, A32, Word16, A16)
+OP3 (Word32, Msub_32_16_r, Word32, A32, Word32, A32, Word16, A16)
+OP3 (Word32, Madd_32_32, Word32, A32, Word32, A32, Word32, A32)
+OP3 (Word32, Madd_32_32_r, Word32, A32, Word32, A32, Word32, A32)
+OP3 (Word32, Msub_32_32, Word32, A32, Word32, A32, Word32, A32)
+OP3 (Word32, Msub_32_32_r, Word32, A32, Word32, A32, Word32, A32)
+
+/* end of file */
@@ -0,0 +1,347 @@
+/*                                                           17.Oct.2026 v1.0
+  ===========================================================================
+
+  BASOP_INLINE_TEST.C
+  ~~~~~~~~~~~~~~~~~~~
+
+  Description:
+  ~~~~~~~~~~~~
+
+  Bit-exactness test of the inline implementation of the basic operators
+  (BASOP_INLINE, see basop_inline.h). This file is compiled with
+  BASOP_INLINE defined and every operator of basop32, enh1632, enh32 and
+  enh64 is called here with the same inputs as its reference version,
+  reached through the ref_<name>() wrappers of basop_ref.c.
+
+  The inputs are random, with a bias towards the edge values (0, +-1,
+  the extreme values and the powers of two around the saturation points)
+  and towards the shift counts around the word lengths. The Overflow and
+  Carry flags are set to random values before each call. The test fails
+  if any result, or the value of any flag after the call, differs.
+
+  Usage:
+  ~~~~~~
+  $ basop_inline_test [trials]
+
+  where trials is the number of calls per operator [default: 100000].
+
+  History:
+  ~~~~~~~~
+  17.Oct.2026 v1.0 Created.
+
+  ===========================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "stl.h"
+
+#ifndef BASOP_INLINE
+#error "basop_inline_test must be compiled with BASOP_INLINE defined"
+#endif
+
+/* Reference operators of basop_ref.c */
+#define OP1(r, n, t1, g1) \
+  r ref_##n (t1 a);
+#define OP2(r, n, t1, g1, t2, g2) \
+  r ref_##n (t1 a, t2 b);
+#define OP3(r, n, t1, g1, t2, g2, t3, g3) \
+  r ref_##n (t1 a, t2 b, t3 c);
+#include "basop_inline_ops.h"
+#undef OP1
+#undef OP2
+#undef OP3
+
+Word16 ref_rotr (Word16 a, Word16 b, Word16 * c);
+Word16 ref_rotl (Word16 a, Word16 b, Word16 * c);
+Word32 ref_L_rotr (Word32 a, Word16 b, Word16 * c);
+Word32 ref_L_rotl (Word32 a, Word16 b, Word16 * c);
+Word16 ref_div_s (Word16 a, Word16 b);
+Word16 ref_div_l (Word32 a, Word16 b);
+
+#define MAX_REPORT 5
+
+static long n_trials = 100000;
+
+
+/*
+  -------------------------------------------------------------------------
+  Input generators
+  -------------------------------------------------------------------------
+*/
+static unsigned long seed = 12345;
+
+static long rnd31 (void) {
+  seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF;
+  return (long) seed;
+}
+
+static long long rnd64 (void) {
+  unsigned long long x;
+
+  x = (unsigned long long) rnd31 ();
+  x = (x << 31) ^ (unsigned long long) rnd31 ();
+  x = (x << 31) ^ (unsigned long long) rnd31 ();
+  return (long long) x;
+}
+
+/* Random value of nbits bits, an edge value in one draw out of four */
+static long long edge_or_random (int nbits) {
+  long long max = (long long) (((unsigned long long) 1 << (nbits - 1)) - 1);
+  long long min = -max - 1;
+  long long x;
+
+  if ((rnd31 () & 3) != 0) {
+    x = rnd64 ();
+    /* also vary the magnitude, so that all norm values occur */
+    x >>= rnd31 () % nbits;
+    return (nbits == 64) ? x : ((long long) ((unsigned long long) x << (64 - nbits))) >> (64 - nbits);
+  }
+
+  switch (rnd31 () % 12) {
+  case 0:
+    return 0;
+  case 1:
+    return 1;
+  case 2:
+    return -1;
+  case 3:
+    return max;
+  case 4:
+    return min;
+  case 5:
+    return max - 1;
+  case 6:
+    return min + 1;
+  case 7:
+    return (long long) 1 << (nbits - 2);
+  case 8:
+    return -((long long) 1 << (nbits - 2));
+  case 9:
+    return ((long long) 1 << (nbits - 2)) - 1;
+  case 10:
+    return (long long) 1 << (rnd31 () % (nbits - 1));
+  default:
+    return -((long long) 1 << (rnd31 () % (nbits - 1)));
+  }
+}
+
+static long long shift_range (int lo, int hi) {
+  return lo + rnd31 () % (hi - lo + 1);
+}
+
+#define A16()  edge_or_random (16)
+#define A32()  edge_or_random (32)
+#define A64()  edge_or_random (64)
+#define S16()  shift_range (-20, 20)
+#define S32()  shift_range (-40, 40)
+#define S64()  shift_range (-63, 63)
+#define S64L() shift_range (-63, 80)
+#define S64R() shift_range (-80, 63)
+
+
+/*
+  -------------------------------------------------------------------------
+  Comparison of one call
+  -------------------------------------------------------------------------
+*/
+static long n_errors = 0;
+
+static int check_result (const char *name, long long ref, long long inl, Flag ref_ovf, Flag ref_carry, long long a, long long b, long long c) {
+  if (ref == inl && ref_ovf == Overflow && ref_carry == Carry)
+    return 0;
+  if (n_errors++ < MAX_REPORT)
+    fprintf (stderr, "%s(%lld, %lld, %lld): reference %lld (O=%d C=%d), inline %lld (O=%d C=%d)\n",
+             name, a, b, c, ref, ref_ovf, ref_carry, inl, Overflow, Carry);
+  return 1;
+}
+
+/* Sets both flags at random and saves them for the second call */
+#define SET_FLAGS() \
+  o0 = (Flag) (rnd31 () & 1); c0 = (Flag) (rnd31 () & 1); \
+  Overflow = o0; Carry = c0
+
+#define RESET_FLAGS() \
+  ref_ovf = Overflow; ref_carry = Carry; \
+  Overflow = o0; Carry = c0
+
+
+/*
+  -------------------------------------------------------------------------
+  One check function per operator
+  -------------------------------------------------------------------------
+*/
+#define OP1(r, n, t1, g1) \
+static long check_##n (void) { \
+  long i, err = 0; \
+  Flag o0, c0, ref_ovf, ref_carry; \
+  for (i = 0; i < n_trials; i++) { \
+    t1 a = (t1) g1 (); \
+    r x, y; \
+    SET_FLAGS (); \
+    x = ref_##n (a); \
+    RESET_FLAGS (); \
+    y = n (a); \
+    err += check_result (#n, (long long) x, (long long) y, ref_ovf, ref_carry, (long long) a, 0, 0); \
+  } \
+  return err; \
+}
+
+#define OP2(r, n, t1, g1, t2, g2) \
+static long check_##n (void) { \
+  long i, err = 0; \
+  Flag o0, c0, ref_ovf, ref_carry; \
+  for (i = 0; i < n_trials; i++) { \
+    t1 a = (t1) g1 (); \
+    t2 b = (t2) g2 (); \
+    r x, y; \
+    SET_FLAGS (); \
+    x = ref_##n (a, b); \
+    RESET_FLAGS (); \
+    y = n (a, b); \
+    err += check_result (#n, (long long) x, (long long) y, ref_ovf, ref_carry, (long long) a, (long long) b, 0); \
+  } \
+  return err; \
+}
+
+#define OP3(r, n, t1, g1, t2, g2, t3, g3) \
+static long check_##n (void) { \
+  long i, err = 0; \
+  Flag o0, c0, ref_ovf, ref_carry; \
+  for (i = 0; i < n_trials; i++) { \
+    t1 a = (t1) g1 (); \
+    t2 b = (t2) g2 (); \
+    t3 c = (t3) g3 (); \
+    r x, y; \
+    SET_FLAGS (); \
+    x = ref_##n (a, b, c); \
+    RESET_FLAGS (); \
+    y = n (a, b, c); \
+    err += check_result (#n, (long long) x, (long long) y, ref_ovf, ref_carry, (long long) a, (long long) b, (long long) c); \
+  } \
+  return err; \
+}
+
+#include "basop_inline_ops.h"
+#undef OP1
+#undef OP2
+#undef OP3
+
+/* Rotations: the bit shifted out is returned through a pointer */
+#define ROT(r, n, t1, g1) \
+static long check_##n (void) { \
+  long i, err = 0; \
+  Flag o0, c0, ref_ovf, ref_carry; \
+  for (i = 0; i < n_trials; i++) { \
+    t1 a = (t1) g1 (); \
+    Word16 b = (Word16) (rnd31 () & 1); \
+    Word16 bx, by; \
+    r x, y; \
+    SET_FLAGS (); \
+    x = ref_##n (a, b, &bx); \
+    RESET_FLAGS (); \
+    y = n (a, b, &by); \
+    err += check_result (#n, (long long) x, (long long) y, ref_ovf, ref_carry, (long long) a, (long long) b, 0); \
+    err += check_result (#n "[bit]", (long long) bx, (long long) by, Overflow, Carry, (long long) a, (long long) b, 0); \
+  } \
+  return err; \
+}
+
+ROT (Word16, rotr, Word16, A16)
+ROT (Word16, rotl, Word16, A16)
+ROT (Word32, L_rotr, Word32, A32)
+ROT (Word32, L_rotl, Word32, A32)
+
+/* Divisions: only the valid input ranges, 0 <= num <= den */
+static long check_div_s (void) {
+  long i, err = 0;
+  Flag o0, c0, ref_ovf, ref_carry;
+
+  for (i = 0; i < n_trials; i++) {
+    Word16 den = (Word16) (1 + rnd31 () % MAX_16);
+    Word16 num = (Word16) (rnd31 () % (den + 1));
+    Word16 x, y;
+
+    SET_FLAGS ();
+    x = ref_div_s (num, den);
+    RESET_FLAGS ();
+    y = div_s (num, den);
+    err += check_result ("div_s", x, y, ref_ovf, ref_carry, num, den, 0);
+  }
+  return err;
+}
+
+static long check_div_l (void) {
+  long i, err = 0;
+  Flag o0, c0, ref_ovf, ref_carry;
+
+  for (i = 0; i < n_trials; i++) {
+    Word16 den = (Word16) (1 + rnd31 () % MAX_16);
+    Word32 num = (Word32) (rnd31 () % ((long) den * 65536 + 1));
+    Word16 x, y;
+
+    SET_FLAGS ();
+    x = ref_div_l (num, den);
+    RESET_FLAGS ();
+    y = div_l (num, den);
+    err += check_result ("div_l", x, y, ref_ovf, ref_carry, num, den, 0);
+  }
+  return err;
+}
+
+
+/*
+  -------------------------------------------------------------------------
+  Table of all the checks
+  -------------------------------------------------------------------------
+*/
+typedef struct {
+  const char *name;
+  long (*check) (void);
+} OP_CHECK;
+
+#define OP1(r, n, t1, g1) { #n, check_##n },
+#define OP2(r, n, t1, g1, t2, g2) { #n, check_##n },
+#define OP3(r, n, t1, g1, t2, g2, t3, g3) { #n, check_##n },
+
+static const OP_CHECK op_checks[] = {
+#include "basop_inline_ops.h"
+  {"rotr", check_rotr},
+  {"rotl", check_rotl},
+  {"L_rotr", check_L_rotr},
+  {"L_rotl", check_L_rotl},
+  {"div_s", check_div_s},
+  {"div_l", check_div_l},
+};
+
+#undef OP1
+#undef OP2
+#undef OP3
+
+
+int main (int argc, char *argv[]) {
+  int k, n_ops = (int) (sizeof (op_checks) / sizeof (op_checks[0]));
+  int n_failed = 0;
+  long err;
+
+  if (argc > 1) {
+    n_trials = atol (argv[1]);
+    if (n_trials <= 0) {
+      fprintf (stderr, "Usage: basop_inline_test [trials]\n");
+      return 1;
+    }
+  }
+
+  for (k = 0; k < n_ops; k++) {
+    err = op_checks[k].check ();
+    if (err != 0) {
+      fprintf (stderr, "%-14s %ld mismatches\n", op_checks[k].name, err);
+      n_failed++;
+    }
+  }
+
+  printf ("basop_inline_test: %d operators, %ld calls each, %d failed\n", n_ops, n_trials, n_failed);
+  return (n_failed == 0) ? 0 : 1;
+}
+
+/* end of file */
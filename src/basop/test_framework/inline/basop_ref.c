@@ -0,0 +1,45 @@
+/*                                                           17.Oct.2026 v1.0
+  ===========================================================================
+
+  BASOP_REF.C
+  ~~~~~~~~~~~
+
+  Description:
+  ~~~~~~~~~~~~
+
+  Reference side of basop_inline_test. This file is compiled without
+  BASOP_INLINE, so that the operators called here are the external
+  functions of basop32.c, enh1632.c, enh32.c and enh64.c; each of them is
+  exported as ref_<name>() for the inline side, which cannot reference
+  them by their own names.
+
+  History:
+  ~~~~~~~~
+  17.Oct.2026 v1.0 Created.
+
+  ===========================================================================
+*/
+
+#include "stl.h"
+
+#ifdef BASOP_INLINE
+#error "basop_ref.c must be compiled without BASOP_INLINE"
+#endif
+
+#define OP1(r, n, t1, g1) \
+  r ref_##n (t1 a) { return n (a); }
+#define OP2(r, n, t1, g1, t2, g2) \
+  r ref_##n (t1 a, t2 b) { return n (a, b); }
+#define OP3(r, n, t1, g1, t2, g2, t3, g3) \
+  r ref_##n (t1 a, t2 b, t3 c) { return n (a, b, c); }
+
+#include "basop_inline_ops.h"
+
+Word16 ref_rotr (Word16 a, Word16 b, Word16 * c) { return rotr (a, b, c); }
+Word16 ref_rotl (Word16 a, Word16 b, Word16 * c) { return rotl (a, b, c); }
+Word32 ref_L_rotr (Word32 a, Word16 b, Word16 * c) { return L_rotr (a, b, c); }
+Word32 ref_L_rotl (Word32 a, Word16 b, Word16 * c) { return L_rotl (a, b, c); }
+Word16 ref_div_s (Word16 a, Word16 b) { return div_s (a, b); }
+Word16 ref_div_l (Word32 a, Word16 b) { return div_l (a, b); }
+
+/* end of file */
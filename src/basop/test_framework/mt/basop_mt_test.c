@@ -0,0 +1,215 @@
+/*                                                           17.Oct.2026 v1.0
+  ===========================================================================
+
+  BASOP_MT_TEST.C
+  ~~~~~~~~~~~~~~~
+
+  Description:
+  ~~~~~~~~~~~~
+
+  Regression test of the thread-safe build of the basic operators
+  (BASOP_THREAD_SAFE, see typedef.h). A small fixed-point workload, which
+  saturates on purpose so that the Overflow flag is exercised, is run for
+  a number of channels with two WMOPS counter groups per channel:
+
+  - first all the channels one after the other in the main thread;
+  - then every channel in its own thread, all threads running at the same
+    time and each repeating its channel several times.
+
+  For every frame the output checksum, the Overflow flag and the weighted
+  operation count of each counter group are recorded; the test fails if
+  any thread result differs from the single-threaded one. At the end the
+  counters of all threads are merged with WMOPS_aggregate() and printed.
+
+  Usage:
+  ~~~~~~
+  $ basop_mt_test [threads]
+
+  where threads is the number of channels/threads [default: 8].
+
+  History:
+  ~~~~~~~~
+  17.Oct.2026 v1.0 Created.
+
+  ===========================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "stl.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#include <process.h>
+#else
+#include <pthread.h>
+#endif
+
+#ifndef BASOP_THREAD_SAFE
+#error "basop_mt_test must be compiled with BASOP_THREAD_SAFE defined"
+#endif
+
+#define MAX_CHANNELS 64
+#define N_FRAMES     100
+#define L_FRAME      160
+#define N_REPEAT     5
+
+/* Per-frame record of one channel */
+typedef struct {
+  Word32 checksum;
+  Flag overflow;
+  Word32 ops_analysis;
+  Word32 ops_synthesis;
+} FRAME_RESULT;
+
+typedef struct {
+  long seed;
+  FRAME_RESULT result[N_FRAMES];
+  int mismatch;
+  const FRAME_RESULT *reference;
+} CHANNEL;
+
+
+/*
+ * Fixed-point workload of one channel: energy and normalization of a
+ * pseudo-random frame (group "Analysis"), then gain scaling and a
+ * first-order recursion (group "Synthesis").
+ */
+static void run_channel (long seed, FRAME_RESULT * res) {
+  Word16 x[L_FRAME], y[L_FRAME], mem = 0, gain, exp_e, i;
+  Word32 L_acc;
+  int ana, syn, frame;
+  unsigned long lcg = (unsigned long) seed;
+
+  ana = getCounterId ("Analysis");
+  syn = getCounterId ("Synthesis");
+  setCounter (ana);
+  Init_WMOPS_counter ();
+  setCounter (syn);
+  Init_WMOPS_counter ();
+
+  for (frame = 0; frame < N_FRAMES; frame++) {
+    for (i = 0; i < L_FRAME; i++) {
+      lcg = (lcg * 1103515245UL + 12345UL) & 0x7FFFFFFFUL;
+      /* every 4th frame is loud enough to saturate the energy */
+      x[i] = (Word16) ((long) (lcg >> 15) - 32768) >> ((frame & 3) ? 4 : 0);
+    }
+
+    setCounter (ana);
+    Overflow = 0;
+    L_acc = 0;
+    for (i = 0; i < L_FRAME; i++)
+      L_acc = L_mac (L_acc, x[i], x[i]);
+    exp_e = norm_l (L_acc);
+    gain = extract_h (L_shl (L_acc, exp_e));
+    gain = div_s (shr (gain, 1), MAX_16);
+    res[frame].overflow = Overflow;
+    fwc ();
+
+    setCounter (syn);
+    for (i = 0; i < L_FRAME; i++) {
+      L_acc = L_mult (mult_r (x[i], gain), 16384);
+      L_acc = L_mac (L_acc, mem, 29491);
+      y[i] = mem = round_fx (L_acc);
+    }
+    fwc ();
+
+    res[frame].checksum = 0;
+    for (i = 0; i < L_FRAME; i++)
+      res[frame].checksum = res[frame].checksum * 31 + y[i];
+
+    setCounter (ana);
+    res[frame].ops_analysis = TotalWeightedOperation ();
+    Reset_WMOPS_counter ();
+    setCounter (syn);
+    res[frame].ops_synthesis = TotalWeightedOperation ();
+    Reset_WMOPS_counter ();
+  }
+  setCounter (0);
+}
+
+
+#ifdef _WIN32
+static unsigned __stdcall channel_thread (void *arg)
+#else
+static void *channel_thread (void *arg)
+#endif
+{
+  CHANNEL *ch = (CHANNEL *) arg;
+  int k;
+
+  /* Repeat, so that the threads overlap in time */
+  for (k = 0; k < N_REPEAT; k++) {
+    run_channel (ch->seed, ch->result);
+    if (memcmp (ch->result, ch->reference, sizeof (ch->result)) != 0)
+      ch->mismatch++;
+  }
+  WMOPS_aggregate ();
+  return 0;
+}
+
+
+int main (int argc, char *argv[]) {
+  static CHANNEL ch[MAX_CHANNELS];
+  static FRAME_RESULT reference[MAX_CHANNELS][N_FRAMES];
+  int n = 8, c, fail = 0, overflows = 0, frame;
+#ifdef _WIN32
+  HANDLE tid[MAX_CHANNELS];
+#else
+  pthread_t tid[MAX_CHANNELS];
+#endif
+
+  if (argc > 1)
+    n = atoi (argv[1]);
+  if (n < 1 || n > MAX_CHANNELS) {
+    fprintf (stderr, "Number of threads must be between 1 and %d\n", MAX_CHANNELS);
+    return 2;
+  }
+
+  /* Single-threaded reference, all channels in the main thread */
+  for (c = 0; c < n; c++) {
+    run_channel (4711 + 97 * c, reference[c]);
+    for (frame = 0; frame < N_FRAMES; frame++)
+      overflows += reference[c][frame].overflow;
+  }
+  if (overflows == 0) {
+    fprintf (stderr, "The workload did not exercise the Overflow flag\n");
+    return 1;
+  }
+
+  /* Multi-threaded run */
+  WMOPS_clear_aggregate ();
+  for (c = 0; c < n; c++) {
+    ch[c].seed = 4711 + 97 * c;
+    ch[c].reference = reference[c];
+    ch[c].mismatch = 0;
+#ifdef _WIN32
+    tid[c] = (HANDLE) _beginthreadex (NULL, 0, channel_thread, &ch[c], 0, NULL);
+    if (tid[c] == 0) {
+#else
+    if (pthread_create (&tid[c], NULL, channel_thread, &ch[c]) != 0) {
+#endif
+      fprintf (stderr, "Unable to create thread %d\n", c);
+      return 2;
+    }
+  }
+  for (c = 0; c < n; c++) {
+#ifdef _WIN32
+    WaitForSingleObject (tid[c], INFINITE);
+    CloseHandle (tid[c]);
+#else
+    pthread_join (tid[c], NULL);
+#endif
+    if (ch[c].mismatch) {
+      fprintf (stderr, "Channel %d: %d of %d runs differ from the single-threaded run\n", c, ch[c].mismatch, N_REPEAT);
+      fail++;
+    }
+  }
+
+  printf ("Aggregated complexity of %d threads:\n", n);
+  WMOPS_output_aggregate (0);
+
+  printf ("%d channels, %d frames with overflow: %s\n", n, overflows, fail ? "FAILED" : "identical results");
+  return fail ? 1 : 0;
+}
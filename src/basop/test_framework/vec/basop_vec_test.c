@@ -0,0 +1,355 @@
+/*                                                           17.Oct.2026 v1.0
+  ===========================================================================
+
+  BASOP_VEC_TEST.C
+  ~~~~~~~~~~~~~~~~
+
+  Description:
+  ~~~~~~~~~~~~
+
+  Bit-exactness test of the vector operators (ENH_VEC_OPERATOR, see
+  enhvec.h). Every vector operator is called on random vectors and
+  compared with the loop of scalar operators it replaces: the result, the
+  output vector, the Overflow flag after the call and the weighted
+  operation count must all be identical.
+
+  The lengths cover the empty vector, the remainders after the blocks of
+  8 elements and several blocks. The elements are drawn from the full
+  range, from small ranges, or are edge values (0, +-1, MAX_16, MIN_16),
+  and the accumulators are often close to the saturation points, so that
+  both the exact path and the saturating path of the dot products run.
+
+  Usage:
+  ~~~~~~
+  $ basop_vec_test [trials]
+
+  where trials is the number of calls per operator [default: 20000].
+
+  History:
+  ~~~~~~~~
+  17.Oct.2026 v1.0 Created.
+
+  ===========================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "stl.h"
+
+#ifndef ENH_VEC_OPERATOR
+#error "basop_vec_test must be compiled with ENH_VEC_OPERATOR defined"
+#endif
+
+#define MAX_LEN    67
+#define MAX_REPORT 5
+
+static long n_trials = 20000;
+static long n_errors = 0;
+
+
+/*
+  -------------------------------------------------------------------------
+  Input generators
+  -------------------------------------------------------------------------
+*/
+static unsigned long seed = 4321;
+
+static long rnd31 (void) {
+  seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF;
+  return (long) seed;
+}
+
+static Word16 rnd16 (int mode) {
+  switch (mode) {
+  case 0:                      /* full range */
+    return (Word16) (rnd31 () >> 8);
+  case 1:                      /* small values */
+    return (Word16) ((rnd31 () % 2001) - 1000);
+  default:                     /* edge values */
+    switch (rnd31 () % 6) {
+    case 0:
+      return 0;
+    case 1:
+      return 1;
+    case 2:
+      return -1;
+    case 3:
+      return MAX_16;
+    case 4:
+      return MIN_16;
+    default:
+      return (Word16) (rnd31 () >> 8);
+    }
+  }
+}
+
+static Word16 rnd_len (void) {
+  return (Word16) (rnd31 () % (MAX_LEN + 1));
+}
+
+static void rnd_vector (Word16 x[], Word16 len) {
+  int mode = (int) (rnd31 () % 3);
+  Word16 i;
+
+  for (i = 0; i < len; i++)
+    x[i] = rnd16 (mode);
+}
+
+static Word32 rnd_acc (void) {
+  switch (rnd31 () % 4) {
+  case 0:
+    return 0;
+  case 1:
+    return MAX_32 - (Word32) (rnd31 () % 0x1000000);
+  case 2:
+    return MIN_32 + (Word32) (rnd31 () % 0x1000000);
+  default:
+    return (Word32) ((unsigned long) rnd31 () << 1);
+  }
+}
+
+/* Overflow set at random before the vector call and the reference loop */
+static Flag set_overflow (void) {
+  Overflow = (Flag) (rnd31 () & 1);
+  return Overflow;
+}
+
+
+/*
+  -------------------------------------------------------------------------
+  Comparison
+  -------------------------------------------------------------------------
+*/
+static int check (const char *name, Word16 len, long ref, long vec, Flag ref_ovf, Flag vec_ovf, Word32 ref_ops, Word32 vec_ops) {
+  if (ref == vec && ref_ovf == vec_ovf && ref_ops == vec_ops)
+    return 0;
+  if (n_errors++ < MAX_REPORT)
+    fprintf (stderr, "%s (len %d): reference %ld (O=%d, %ld ops), vector %ld (O=%d, %ld ops)\n",
+             name, len, ref, ref_ovf, (long) ref_ops, vec, vec_ovf, (long) vec_ops);
+  return 1;
+}
+
+static long vec_diff (const Word16 a[], const Word16 b[], Word16 len) {
+  Word16 i;
+
+  for (i = 0; i < len; i++)
+    if (a[i] != b[i])
+      return (long) i + 1;
+  return 0;
+}
+
+
+/*
+  -------------------------------------------------------------------------
+  One check function per operator
+  -------------------------------------------------------------------------
+*/
+static long check_V_L_mac (int shift0) {
+  Word16 x[MAX_LEN], y[MAX_LEN], len, i;
+  Word32 acc, ref, vec, ref_ops, vec_ops;
+  Flag o0, ref_ovf;
+  long t, err = 0;
+
+  for (t = 0; t < n_trials; t++) {
+    len = rnd_len ();
+    rnd_vector (x, len);
+    rnd_vector (y, len);
+    acc = rnd_acc ();
+
+    o0 = set_overflow ();
+    DeltaWeightedOperation ();
+    ref = acc;
+    for (i = 0; i < len; i++)
+      ref = shift0 ? L_mac0 (ref, x[i], y[i]) : L_mac (ref, x[i], y[i]);
+    ref_ops = DeltaWeightedOperation ();
+    ref_ovf = Overflow;
+
+    Overflow = o0;
+    vec = shift0 ? V_L_mac0 (acc, x, y, len) : V_L_mac (acc, x, y, len);
+    vec_ops = DeltaWeightedOperation ();
+    err += check (shift0 ? "V_L_mac0" : "V_L_mac", len, ref, vec, ref_ovf, Overflow, ref_ops, vec_ops);
+  }
+  return err;
+}
+
+static long check_V_L_mac0 (void) {
+  return check_V_L_mac (1);
+}
+
+static long check_V_L_mac_ (void) {
+  return check_V_L_mac (0);
+}
+
+static long check_V_L_mac0_2 (void) {
+  Word16 x[MAX_LEN], y[MAX_LEN], len, i;
+  Word32 ref[2], vec[2], ref_ops, vec_ops;
+  Flag o0, ref_ovf;
+  long t, err = 0;
+
+  for (t = 0; t < n_trials; t++) {
+    len = (Word16) (rnd_len () & ~1);
+    rnd_vector (x, len);
+    rnd_vector (y, len);
+    ref[0] = vec[0] = rnd_acc ();
+    ref[1] = vec[1] = rnd_acc ();
+
+    o0 = set_overflow ();
+    DeltaWeightedOperation ();
+    for (i = 0; i < len; i += 2) {
+      ref[0] = L_mac0 (ref[0], x[i], y[i]);
+      ref[1] = L_mac0 (ref[1], x[i + 1], y[i + 1]);
+    }
+    ref_ops = DeltaWeightedOperation ();
+    ref_ovf = Overflow;
+
+    Overflow = o0;
+    V_L_mac0_2 (vec, x, y, len);
+    vec_ops = DeltaWeightedOperation ();
+    err += check ("V_L_mac0_2[0]", len, ref[0], vec[0], ref_ovf, Overflow, ref_ops, vec_ops);
+    err += check ("V_L_mac0_2[1]", len, ref[1], vec[1], ref_ovf, Overflow, ref_ops, vec_ops);
+  }
+  return err;
+}
+
+/* Vector in, vector out: V_shl and V_mult_r, also in place */
+static long check_vector_op (int op) {
+  Word16 x[MAX_LEN], ref[MAX_LEN], vec[MAX_LEN], len, var2, i;
+  Word32 ref_ops, vec_ops;
+  Flag o0, ref_ovf;
+  long t, err = 0;
+  const char *name = (op == 0) ? "V_shl" : "V_mult_r";
+
+  for (t = 0; t < n_trials; t++) {
+    len = rnd_len ();
+    rnd_vector (x, len);
+    var2 = (op == 0) ? (Word16) ((rnd31 () % 41) - 20) : rnd16 ((int) (rnd31 () % 3));
+
+    o0 = set_overflow ();
+    DeltaWeightedOperation ();
+    for (i = 0; i < len; i++)
+      ref[i] = (op == 0) ? shl (x[i], var2) : mult_r (x[i], var2);
+    ref_ops = DeltaWeightedOperation ();
+    ref_ovf = Overflow;
+
+    Overflow = o0;
+    if ((t & 1) == 0) {
+      if (op == 0)
+        V_shl (vec, x, var2, len);
+      else
+        V_mult_r (vec, x, var2, len);
+    } else {
+      memcpy (vec, x, len * sizeof (Word16));
+      if (op == 0)
+        V_shl (vec, vec, var2, len);
+      else
+        V_mult_r (vec, vec, var2, len);
+    }
+    vec_ops = DeltaWeightedOperation ();
+    err += check (name, len, 0, vec_diff (ref, vec, len), ref_ovf, Overflow, ref_ops, vec_ops);
+  }
+  return err;
+}
+
+static long check_V_shl (void) {
+  return check_vector_op (0);
+}
+
+static long check_V_mult_r (void) {
+  return check_vector_op (1);
+}
+
+/* Block reductions: V_norm_s and V_max_abs, weight 2 per element */
+static long check_reduction (int op) {
+  Word16 x[MAX_LEN], len, i, ref, vec;
+  Word32 vec_ops;
+  Flag o0, ref_ovf;
+  long t, err = 0;
+  const char *name = (op == 0) ? "V_norm_s" : "V_max_abs";
+
+  for (t = 0; t < n_trials; t++) {
+    len = rnd_len ();
+    rnd_vector (x, len);
+    if ((rnd31 () & 7) == 0)
+      for (i = 0; i < len; i++)
+        x[i] = (Word16) (x[i] >> (rnd31 () % 16));
+
+    o0 = set_overflow ();
+    ref = (op == 0) ? 15 : 0;
+    for (i = 0; i < len; i++) {
+      if (op == 0) {
+        if (x[i] != 0)
+          ref = s_min (ref, norm_s (x[i]));
+      } else
+        ref = s_max (ref, abs_s (x[i]));
+    }
+    ref_ovf = Overflow;
+
+    Overflow = o0;
+    DeltaWeightedOperation ();
+    vec = (op == 0) ? V_norm_s (x, len) : V_max_abs (x, len);
+    vec_ops = DeltaWeightedOperation ();
+    err += check (name, len, ref, vec, ref_ovf, Overflow, 2 * len, vec_ops);
+  }
+  return err;
+}
+
+static long check_V_norm_s (void) {
+  return check_reduction (0);
+}
+
+static long check_V_max_abs (void) {
+  return check_reduction (1);
+}
+
+
+/*
+  -------------------------------------------------------------------------
+  Table of all the checks
+  -------------------------------------------------------------------------
+*/
+typedef struct {
+  const char *name;
+  long (*check) (void);
+} OP_CHECK;
+
+static const OP_CHECK op_checks[] = {
+  {"V_L_mac", check_V_L_mac_},
+  {"V_L_mac0", check_V_L_mac0},
+  {"V_L_mac0_2", check_V_L_mac0_2},
+  {"V_shl", check_V_shl},
+  {"V_mult_r", check_V_mult_r},
+  {"V_norm_s", check_V_norm_s},
+  {"V_max_abs", check_V_max_abs},
+};
+
+
+int main (int argc, char *argv[]) {
+  int k, n_ops = (int) (sizeof (op_checks) / sizeof (op_checks[0]));
+  int n_failed = 0;
+  long err;
+
+  if (argc > 1) {
+    n_trials = atol (argv[1]);
+    if (n_trials <= 0) {
+      fprintf (stderr, "Usage: basop_vec_test [trials]\n");
+      return 1;
+    }
+  }
+
+  setCounter (getCounterId ("Vector operators"));
+  Init_WMOPS_counter ();
+
+  for (k = 0; k < n_ops; k++) {
+    err = op_checks[k].check ();
+    if (err != 0) {
+      fprintf (stderr, "%-14s %ld mismatches\n", op_checks[k].name, err);
+      n_failed++;
+    }
+  }
+
+  printf ("basop_vec_test: %d operators, %ld calls each, %d failed\n", n_ops, n_trials, n_failed);
+  return (n_failed == 0) ? 0 : 1;
+}
+
+/* end of file */
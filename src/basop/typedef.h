@@ -17,6 +17,10 @@
                         TD 11 document and subsequent discussions on the
                         wp3audio@yahoogroups.com email reflector.
    March 06   v2.1      Changed to improve portability.
+   17.Oct.26  v2.4      Added BASOP_TLS storage class for the operator flags
+                        and complexity counters (BASOP_THREAD_SAFE builds).
+   17.Oct.26  v2.4      Added BASOP_API storage class for the operators, for
+                        the inline implementation (BASOP_INLINE builds).
 
   ============================================================================
 */
@@ -96,6 +100,57 @@ typedef int Flag;
 #endif /* ifdef ORIGINAL_TYPEDEF_H */
 
 
+/*_____________________
+ |                     |
+ | Storage class of    |
+ | the global state.   |
+ |_____________________|
+*/
+
+/*
+ * The Overflow and Carry flags and all the complexity counters of count.c
+ * are declared with BASOP_TLS. When compiled with BASOP_THREAD_SAFE defined,
+ * each thread gets its own copy of them, so that several codec instances
+ * can run in parallel threads of the same process; otherwise they are
+ * ordinary process-wide globals, as in the previous versions.
+ */
+#ifdef BASOP_THREAD_SAFE
+#if defined(_MSC_VER)
+#define BASOP_TLS __declspec(thread)
+#elif defined(__GNUC__) || defined(__SUNPRO_C) || defined(__xlC__)
+#define BASOP_TLS __thread
+#else
+#define BASOP_TLS _Thread_local
+#endif
+#else /* ifdef BASOP_THREAD_SAFE */
+#define BASOP_TLS
+#endif /* ifdef BASOP_THREAD_SAFE */
+
+
+/*_____________________
+ |                     |
+ | Storage class of    |
+ | the operators.      |
+ |_____________________|
+*/
+
+/*
+ * The operators of basop32.h, enh1632.h, enh32.h and enh64.h are declared
+ * with BASOP_API. When compiled with BASOP_INLINE defined, they are static
+ * inline functions defined in basop_inline.h and no complexity is counted
+ * (BASOP_INLINE implies BASOP_NOCOUNT); otherwise they are the ordinary
+ * external functions of basop32.c, enh1632.c, enh32.c and enh64.c.
+ */
+#ifdef BASOP_INLINE
+#define BASOP_API static __inline
+#ifndef BASOP_NOCOUNT
+#define BASOP_NOCOUNT
+#endif
+#else /* ifdef BASOP_INLINE */
+#define BASOP_API
+#endif /* ifdef BASOP_INLINE */
+
+
 #endif /* ifndef _TYPEDEF_H */
 
 
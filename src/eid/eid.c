@@ -80,6 +80,27 @@ FUNCTIONS       : - open_eid (double ber, double gamma)
                                       in one call.
                      Output: EPbuff = array, containing the error pattern
 
+                  - BER_generator_fast (SCD_EID *EID, long lseg,
+                                        short *EPbuff)
+                     Same as BER_generator, with identical output, but
+                     faster for the 2-state model.
+
+                  - BER_generator_chunk (SCD_EID *EID, long start,
+                                         long lseg, short *EPbuff)
+                    BER_join_chunk (SCD_EID *EID, BER_CHUNK *chunk,
+                                    short *EPbuff)
+                     Generation of the pattern in independent chunks
+                     (e.g. in parallel), joined in order afterwards into
+                     the same pattern as BER_generator.
+
+                  - BER_generator_geometric (SCD_EID *EID, long lseg,
+                                             short *EPbuff)
+                     Statistically equivalent pattern, generated by
+                     drawing run lengths between state changes/errors.
+
+                  - EID_skip_ahead (unsigned long *seed, unsigned long n)
+                     Advances the RNG seed by n steps.
+
                   - BER_insertion (long lseg, short *ibuff,
                                               short *obuff, short *EPbuff)
                      Disturbes the input data bits according the error
@@ -142,6 +163,9 @@ FUNCTIONS       : - open_eid (double ber, double gamma)
                  to extend Bellcore burst model resolution and operating
                  range to [0.5-30%]. <J.Sv. Ericsson>
   02.Feb.10 v2.7 Modified maximum string lenght for filenames (y.hiwasaki)
+  17.Oct.26 v2.8 Added BER_generator_fast(), EID_skip_ahead(), the chunked
+                 generation BER_generator_chunk()/BER_join_chunk() and
+                 the run-length mode BER_generator_geometric().
   =============================================================================
 */
 
@@ -467,6 +491,7 @@ int PORTABILITY_TEST_OPERATION = 1;
 #include <stdlib.h>
 #include <ctype.h>
 #include <stdio.h>
+#include <string.h>
 
 /* ......... Include of EID prototypes and definitions .........*/
 #include "eid.h"
@@ -541,6 +566,10 @@ SCD_EID *open_eid (double ber, double gamma) {
   EID->usrber = ber;            /* user defined bit error rate */
   EID->usrgamma = gamma;        /* user defined correlation factor */
 
+  /* No run of BER_generator_geometric() started yet */
+  EID->geo_state = -1;
+  EID->geo_run = EID->geo_gap = 0.0;
+
   /* Return initialized structure */
   return (EID);
 }
@@ -684,6 +713,460 @@ double BER_generator (EID, lseg, EPbuff)
 /* ....................... End of BER_generator() ....................... */
 
 
+
+/*
+  ============================================================================
+
+        void EID_skip_ahead (unsigned long *seed, unsigned long n);
+        ~~~~~~~~~~~~~~~~~~~
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Advances the seed of the EID random number generator by n steps,
+        i.e. leaves it as n calls of EID_random() would do, in O(log n)
+        operations. The n-fold composition of the LCG x -> a*x+c is the
+        affine map x -> A*x+C, which is obtained by repeated squaring of
+        (a, c) (all arithmetics modulo the size of unsigned long, as in
+        EID_random()).
+
+        Since BER_generator() draws two random numbers per bit, the seed
+        for bit k of a pattern is obtained with n = 2*k.
+
+        Parameters:
+        ~~~~~~~~~~~
+        seed: ... (In/Out) RNG seed
+        n: ...... (In)     number of steps
+
+        Return value:
+        ~~~~~~~~~~~~~
+        None.
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0 Created.
+
+ ============================================================================
+*/
+void EID_skip_ahead (seed, n)
+     unsigned long *seed;
+     unsigned long n;
+{
+  unsigned long a = 69069L, c = 1L;     /* map of 2^k steps */
+  unsigned long A = 1L, C = 0L; /* map accumulated so far */
+
+  while (n) {
+    if (n & 1) {
+      A = a * A;
+      C = a * C + c;
+    }
+    c = (a + 1) * c;
+    a = a * a;
+    n >>= 1;
+  }
+  *seed = A * (*seed) + C;
+}
+
+/* ....................... End of EID_skip_ahead() ....................... */
+
+
+/*
+ * Thresholds of a 2-state model, scaled to the range of the RNG seed:
+ * since EID_random() returns 2^-bits_in_long times the seed, and the
+ * scaling by a power of 2 is exact, "EID_random() < t" is the same as
+ * "(double)seed < t*2^bits_in_long". This removes the call to pow() and
+ * the multiplication from the inner loop without changing any decision.
+ */
+typedef struct {
+  double trans[2][2];           /* scaled GEC matrix */
+  double ber[2];                /* scaled bit error rates */
+} EID_THRESHOLDS;
+
+static void EID_scale_thresholds (EID, T)
+     SCD_EID *EID;
+     EID_THRESHOLDS *T;
+{
+  int bits_in_long = sizeof (long) * 8;
+  int i, j;
+
+  for (i = 0; i < 2; i++) {
+    for (j = 0; j < 2; j++)
+      T->trans[i][j] = ldexp (EID->matrix[i][j], bits_in_long);
+    T->ber[i] = ldexp (EID->ber[i], bits_in_long);
+  }
+}
+
+
+/*
+ * Generate lseg bits of a 2-state model from the given seed and state,
+ * exactly as BER_generator() does; updates seed and state, and returns
+ * the number of errors. If alt is not NULL, a second trajectory, starting
+ * in the other state and driven by the same random numbers, is followed
+ * (its bits go to alt[]) until both trajectories are in the same state;
+ * the number of such bits is returned in *nalt, together with the end
+ * state and the number of errors of the second trajectory.
+ */
+static double EID_run_2state (T, seed, state, lseg, EPbuff, alt, nalt, alt_state, alt_err)
+     EID_THRESHOLDS *T;
+     unsigned long *seed;
+     long *state;
+     long lseg;
+     short *EPbuff;
+     short *alt;
+     long *nalt;
+     long *alt_state;
+     double *alt_err;
+{
+  unsigned long x = *seed;
+  long s = *state, s2 = 1 - s, i = 0;
+  double ber = 0.0, ber2 = 0.0;
+
+  /* Two trajectories, until they meet */
+  if (alt != NULL) {
+    for (; i < lseg && s != s2; i++) {
+      x = (unsigned long) 69069L *x + 1L;
+      if ((double) x < T->trans[s][0])
+        s = 0;
+      else if ((double) x < T->trans[s][1])
+        s = 1;
+      if ((double) x < T->trans[s2][0])
+        s2 = 0;
+      else if ((double) x < T->trans[s2][1])
+        s2 = 1;
+
+      x = (unsigned long) 69069L *x + 1L;
+      if ((double) x < T->ber[s]) {
+        EPbuff[i] = (short) 0x0081;
+        ber += 1.0;
+      } else
+        EPbuff[i] = (short) 0x007F;
+      if ((double) x < T->ber[s2]) {
+        alt[i] = (short) 0x0081;
+        ber2 += 1.0;
+      } else
+        alt[i] = (short) 0x007F;
+    }
+    *nalt = i;
+  }
+
+  /* Single trajectory */
+  for (; i < lseg; i++) {
+    x = (unsigned long) 69069L *x + 1L;
+    if ((double) x < T->trans[s][0])
+      s = 0;
+    else if ((double) x < T->trans[s][1])
+      s = 1;
+
+    x = (unsigned long) 69069L *x + 1L;
+    if ((double) x < T->ber[s]) {
+      EPbuff[i] = (short) 0x0081;
+      ber += 1.0;
+    } else
+      EPbuff[i] = (short) 0x007F;
+  }
+
+  if (alt != NULL) {
+    /* after the meeting point both trajectories share the bits */
+    *alt_err = ber2 + ber;
+    for (i = 0; i < *nalt; i++)
+      *alt_err -= EPbuff[i] == (short) 0x0081;
+    *alt_state = (*nalt < lseg || s == s2) ? s : s2;
+  }
+
+  *seed = x;
+  *state = s;
+  return (ber);
+}
+
+
+/*
+  ============================================================================
+
+        double BER_generator_fast (SCD_EID *EID, long lseg, short *EPbuff);
+        ~~~~~~~~~~~~~~~~~~~~~~~~~
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Same as BER_generator(), with identical output and final state,
+        but faster for the 2-state Gilbert-Elliot channel set up by
+        open_eid(): the probabilities are compared directly with the RNG
+        seed (see EID_scale_thresholds()), and the state transition is
+        unrolled for two states. Models with other number of states are
+        passed to BER_generator().
+
+        The fast and the reference generator can be mixed freely on the
+        same EID struct, and FER_generator_random() corresponds to a call
+        with lseg=1.
+
+        Parameters:
+        ~~~~~~~~~~~
+        EID: ...... (In/Out) struct with channel model
+        lseg: ..... (In)     length of current frame
+        EPbuff: ... (Out)    bit error pattern (softbits)
+
+        Return value:
+        ~~~~~~~~~~~~~
+        Returns the number of bit errors in the current frame.
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0 Created.
+
+ ============================================================================
+*/
+double BER_generator_fast (EID, lseg, EPbuff)
+     SCD_EID *EID;
+     long lseg;
+     short *EPbuff;
+{
+  EID_THRESHOLDS T;
+
+  if (EID->nstates != 2)
+    return (BER_generator (EID, lseg, EPbuff));
+  if (lseg <= 0)
+    return (0.0);
+
+  EID_scale_thresholds (EID, &T);
+  return (EID_run_2state (&T, &(EID->seed), &(EID->current_state), lseg, EPbuff, (short *) NULL, (long *) NULL, (long *) NULL, (double *) NULL));
+}
+
+/* ..................... End of BER_generator_fast() ..................... */
+
+
+/*
+  ============================================================================
+
+        BER_CHUNK *BER_generator_chunk (SCD_EID *EID, long start,
+        ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~   long lseg, short *EPbuff);
+
+        double BER_join_chunk (SCD_EID *EID, BER_CHUNK *chunk,
+        ~~~~~~~~~~~~~~~~~~~~~  short *EPbuff);
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Generation of a long error pattern in independent chunks (e.g. by
+        several threads), such that the concatenated chunks are identical
+        to the output of BER_generator()/BER_generator_fast() for the
+        whole pattern.
+
+        BER_generator_chunk() generates bits start..start+lseg-1 of the
+        pattern that would follow from the present state of EID, into
+        EPbuff[0..lseg-1]. The EID struct is only read, so any number of
+        chunks can be generated at the same time. The seed at the start
+        of the chunk is found with EID_skip_ahead(); the channel state at
+        the start of the chunk, which depends on the previous chunks, is
+        not known yet, so the chunk is generated for both states of the
+        GEC model driven by the same random numbers. The two trajectories
+        usually meet after a few bits, and only the bits of the second
+        one up to that point are kept in the returned BER_CHUNK.
+
+        BER_join_chunk() must then be called for the chunks in their
+        order, starting with start=0: it selects the trajectory given by
+        the current state of EID (fixing the first bits in EPbuff if
+        needed), advances the seed and state of EID past the chunk,
+        releases the chunk and returns its number of bit errors.
+
+        Only the 2-state model is supported; BER_generator_chunk()
+        returns NULL for other models or when out of memory.
+
+        Parameters:
+        ~~~~~~~~~~~
+        EID: ...... (In/Out) struct with channel model
+        start: .... (In)     position of the chunk in the pattern
+        lseg: ..... (In)     length of the chunk
+        EPbuff: ... (Out)    bit error pattern of the chunk (softbits)
+        chunk: .... (In)     value returned by BER_generator_chunk()
+
+        Return value:
+        ~~~~~~~~~~~~~
+        See above.
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0 Created.
+
+ ============================================================================
+*/
+BER_CHUNK *BER_generator_chunk (EID, start, lseg, EPbuff)
+     SCD_EID *EID;
+     long start;
+     long lseg;
+     short *EPbuff;
+{
+  BER_CHUNK *chunk;
+  EID_THRESHOLDS T;
+
+  if (EID->nstates != 2 || lseg < 0)
+    return ((BER_CHUNK *) NULL);
+  if ((chunk = (BER_CHUNK *) malloc (sizeof (BER_CHUNK))) == NULL)
+    return ((BER_CHUNK *) NULL);
+  if ((chunk->alt = (short *) malloc ((lseg + 1) * sizeof (short))) == NULL) {
+    free ((char *) chunk);
+    return ((BER_CHUNK *) NULL);
+  }
+
+  chunk->lseg = lseg;
+  chunk->seed = EID->seed;
+  EID_skip_ahead (&(chunk->seed), 2 * (unsigned long) start);
+  chunk->end_state[0] = 0;
+  chunk->nalt = 0;
+  chunk->end_state[1] = 1;
+  chunk->nerr[1] = 0.0;
+
+  EID_scale_thresholds (EID, &T);
+  chunk->nerr[0] = EID_run_2state (&T, &(chunk->seed), &(chunk->end_state[0]), lseg, EPbuff, chunk->alt, &(chunk->nalt), &(chunk->end_state[1]), &(chunk->nerr[1]));
+
+  return (chunk);
+}
+
+
+double BER_join_chunk (EID, chunk, EPbuff)
+     SCD_EID *EID;
+     BER_CHUNK *chunk;
+     short *EPbuff;
+{
+  long s = EID->current_state != 0;
+  double ber;
+
+  if (s)
+    memcpy (EPbuff, chunk->alt, chunk->nalt * sizeof (short));
+  EID->current_state = chunk->end_state[s];
+  EID->seed = chunk->seed;
+  ber = chunk->nerr[s];
+
+  free ((char *) chunk->alt);
+  free ((char *) chunk);
+  return (ber);
+}
+
+/* ...................... End of BER_join_chunk() ...................... */
+
+
+/*
+  ============================================================================
+
+        double BER_generator_geometric (SCD_EID *EID, long lseg,
+        ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  short *EPbuff);
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Fast mode of the bit error generator for the 2-state GEC model:
+        instead of drawing two random numbers per bit, the length of the
+        stay in each channel state and the distance between bit errors
+        inside it are drawn directly from their geometric distributions:
+        for a uniform U and a probability p of staying in the state (or
+        of a correct bit), floor(log(U)/log(p)) is the number of further
+        bits in the state (or of correct bits before the next error).
+        As in BER_generator(), the state transition is made before each
+        bit, so a run entered by a state change has 1+floor(log(U)/log(p))
+        bits, while the run in progress at the start may end at once.
+        The cost then grows with the number of state changes and errors,
+        not with the number of bits, which makes long patterns with low
+        error rates very cheap.
+
+        The generated process has the same statistics as the one of
+        BER_generator() (same Markov chain and error probabilities), but
+        it is a different realization: the patterns are not identical to
+        those of BER_generator() for the same seed. The run lengths are
+        kept in the EID struct between calls, so the pattern does not
+        depend on how it is split into calls, and a call of
+        set_GEC_current_state() restarts the runs in the new state.
+
+        Parameters:
+        ~~~~~~~~~~~
+        EID: ...... (In/Out) struct with channel model
+        lseg: ..... (In)     length of current frame
+        EPbuff: ... (Out)    bit error pattern (softbits)
+
+        Return value:
+        ~~~~~~~~~~~~~
+        Returns the number of bit errors in the current frame.
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0 Created.
+        17.Oct.26 v1.1 Corrected description of the run lengths; no change
+                       in the function.
+
+ ============================================================================
+*/
+
+/* Number of failures before the first success of a Bernoulli process
+ * with probability of failure p (huge values returned as doubles) */
+static double EID_geometric (seed, p)
+     unsigned long *seed;
+     double p;
+{
+  double U;
+
+  if (p <= 0.0)
+    return (0.0);
+  if (p >= 1.0)
+    return (HUGE_VAL);
+  U = 1.0 - EID_random (seed);  /* in (0,1] */
+  return (floor (log (U) / log (p)));
+}
+
+
+double BER_generator_geometric (EID, lseg, EPbuff)
+     SCD_EID *EID;
+     long lseg;
+     short *EPbuff;
+{
+  double stay[2], ber = 0.0;
+  long i, j, n, s;
+
+  if (EID->nstates != 2)
+    return (BER_generator (EID, lseg, EPbuff));
+  if (lseg <= 0)
+    return (0.0);
+
+  /* probability of staying in each state, and of a correct bit */
+  stay[0] = EID->matrix[0][0];
+  stay[1] = 1.0 - EID->matrix[1][0];
+  s = EID->current_state;
+
+  /* Start the runs of the current state, if not running yet */
+  if (EID->geo_state != s) {
+    EID->geo_state = s;
+    EID->geo_run = EID_geometric (&(EID->seed), stay[s]);
+    EID->geo_gap = EID_geometric (&(EID->seed), 1.0 - EID->ber[s]);
+  }
+
+  for (i = 0; i < lseg; i += n) {
+    /* State change: start a run in the other state */
+    if (EID->geo_run <= 0.0) {
+      s = EID->geo_state = 1 - s;
+      EID->geo_run = 1.0 + EID_geometric (&(EID->seed), stay[s]);
+      EID->geo_gap = EID_geometric (&(EID->seed), 1.0 - EID->ber[s]);
+    }
+
+    /* Bits until the end of the run or of the frame */
+    n = EID->geo_run < (double) (lseg - i) ? (long) EID->geo_run : lseg - i;
+    for (j = 0; j < n; j++)
+      EPbuff[i + j] = (short) 0x007F;
+
+    /* Errors inside them */
+    for (j = 0; EID->geo_gap < (double) (n - j); j++) {
+      j += (long) EID->geo_gap;
+      EPbuff[i + j] = (short) 0x0081;
+      ber += 1.0;
+      EID->geo_gap = EID_geometric (&(EID->seed), 1.0 - EID->ber[s]);
+    }
+    EID->geo_gap -= (double) (n - j);
+    EID->geo_run -= (double) n;
+  }
+
+  EID->current_state = s;
+  return (ber);
+}
+
+/* ................... End of BER_generator_geometric() ................... */
+
+
 /*
   ============================================================================
 
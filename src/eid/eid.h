@@ -16,6 +16,9 @@
                         <Morgan.Lindqvist@era-t.ericsson.se> comments for the
 		        cc compiler in a DEC Alpha Unix machine.
    10.Oct.97    v2.4    Added prototype for reset_burst_eid() <simao>   
+   17.Oct.26    v2.5    Added fast, chunked and geometric generators and
+                        EID_skip_ahead()
+   17.Oct.26    v2.51   Added prototype for close_eid()
   ============================================================================
 */
 
@@ -57,8 +60,21 @@ typedef struct {
   /* another one */
   double usrber;                /* user defined bit error rate */
   double usrgamma;              /* user defined correlation factor */
+  long geo_state;               /* state of the runs below (-1: none) */
+  double geo_run;               /* bits left in the current state */
+  double geo_gap;               /* correct bits left before next error */
 } SCD_EID;
 
+/* Chunk of a pattern generated by BER_generator_chunk() */
+typedef struct {
+  long lseg;                    /* length of the chunk */
+  long nalt;                    /* bits that depend on the start state */
+  short *alt;                   /* those bits when starting in state 1 */
+  long end_state[2];            /* final state for start states 0/1 */
+  double nerr[2];               /* bit errors for start states 0/1 */
+  unsigned long seed;           /* RNG seed at the end of the chunk */
+} BER_CHUNK;
+
 typedef struct {
   unsigned long seedptr;
   long internal[MODEL_SIZE];
@@ -82,6 +98,7 @@ typedef struct {
  * ......... Global function prototypes ......... 
  */
 SCD_EID *open_eid ARGS ((double ber, double gamma));
+void close_eid ARGS ((SCD_EID * EID));
 BURST_EID *open_burst_eid ARGS ((long index));
 void set_RAN_seed ARGS ((SCD_EID * EID, unsigned long seed));
 unsigned long get_RAN_seed ARGS ((SCD_EID * EID));
@@ -92,6 +109,11 @@ void set_GEC_current_state ARGS ((SCD_EID * EID, int /* char */ current_state));
 char get_GEC_current_state ARGS ((SCD_EID * EID));
 void BER_insertion ARGS ((long lseg, short *xbuff, short *ybuff, short *error_pattern));
 double BER_generator ARGS ((SCD_EID * EID, long lseg, short *EPbuff));
+double BER_generator_fast ARGS ((SCD_EID * EID, long lseg, short *EPbuff));
+BER_CHUNK *BER_generator_chunk ARGS ((SCD_EID * EID, long start, long lseg, short *EPbuff));
+double BER_join_chunk ARGS ((SCD_EID * EID, BER_CHUNK * chunk, short *EPbuff));
+double BER_generator_geometric ARGS ((SCD_EID * EID, long lseg, short *EPbuff));
+void EID_skip_ahead ARGS ((unsigned long *seed, unsigned long n));
 double FER_generator_random ARGS ((SCD_EID * EID));
 double FER_generator_burst ARGS ((BURST_EID * state));
 double FER_module ARGS ((SCD_EID * EID, long lseg, short *xbuff, short *ybuff));
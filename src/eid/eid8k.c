@@ -58,6 +58,8 @@
                     mode <simao.campos@labs.comsat.com>
   02.Feb.2010 v3.3  Modified maximum string length for filenames to avoid
                     buffer overruns (y.hiwasaki)
+  17.Oct.2026 v3.4  Random bit errors generated with BER_generator_fast(),
+                    which produces the same pattern as BER_generator().
   ============================================================================
 */
 
@@ -94,7 +96,7 @@
  -------------------------------------------------------------------------
 */
 void display_usage () {
-  printf ("eid8k.c: Version 3.3 of 02.Feb.2010 \n\n");
+  printf ("eid8k.c: Version 3.4 of 17.Oct.2026 \n\n");
 
   printf ("  This example program produces the files which are necessary to \n");
   printf ("  generate all error pattern for performing the Experiment 1 and 3 of\n");
@@ -341,7 +343,7 @@ int main (int argc, char *argv[]) {
       }
       for (i = start_frame; i <= number_of_frames; i++) {
         for (j = 0; j <= 1; j++) {
-          ber1 = BER_generator (BEReid, EID_BUFFER_LENGTH, EPbuff);
+          ber1 = BER_generator_fast (BEReid, EID_BUFFER_LENGTH, EPbuff);
           dstbits += ber1;
           prcbits += (double) EID_BUFFER_LENGTH;
           genbits += (double) EID_BUFFER_LENGTH;
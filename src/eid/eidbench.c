@@ -0,0 +1,274 @@
+/*                                                           17.Oct.2026 v1.0
+  ===========================================================================
+
+  EIDBENCH.C
+  ~~~~~~~~~~
+
+  Description:
+  ~~~~~~~~~~~~
+
+  Benchmark and equivalence check of the bit error generators of the EID
+  module. For a set of bit error rates and burst factors (gamma), an error
+  pattern is generated by:
+
+  - BER_generator() (reference);
+  - BER_generator_fast(), which must give the same pattern, final state
+    and seed;
+  - BER_generator_chunk()/BER_join_chunk(), with chunks of varying
+    length generated in reverse order, which must also give the same
+    pattern;
+  - BER_generator_geometric(), which gives a different pattern with the
+    same statistics: its bit error rate and its probability of an error
+    following an error must be within a tolerance of those of the
+    reference pattern.
+
+  EID_skip_ahead() is also compared with stepping the RNG one step at a
+  time. The throughput (Mbits per second of CPU time) of each generator
+  is reported.
+
+  Usage:
+  ~~~~~~
+  $ eidbench [-options]
+
+  Options:
+  -n N ......... number of bits per pattern [default: 20000000]
+  -check ....... only check the generators (shorter patterns, no timing),
+                 and return a non-zero exit code if any check fails
+
+  Original author:
+  ~~~~~~~~~~~~~~~~
+  ITU-T STL contributors
+
+  History:
+  ~~~~~~~~
+  17.Oct.2026 v1.0 Created.
+
+  ===========================================================================
+*/
+
+#include "ugstdemo.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "eid.h"
+
+/* Channel models */
+static double ber_list[] = { 0.001, 0.01, 0.05, 0.2 };
+static double gamma_list[] = { 0.0, 0.5, 0.9 };
+
+#define N_BER (sizeof (ber_list) / sizeof (ber_list[0]))
+#define N_GAMMA (sizeof (gamma_list) / sizeof (gamma_list[0]))
+
+/* Segment lengths cycled through when generating a pattern */
+static long seg_len[] = { 256, 1, 37, 1024, 2, 160, 3, 4096, 641 };
+
+#define N_SEG (sizeof (seg_len) / sizeof (seg_len[0]))
+
+/* Generator functions with the signature of BER_generator() */
+typedef double (*BER_FUNC) ARGS ((SCD_EID * EID, long lseg, short *EPbuff));
+
+
+/*
+ * Generate the pattern y[0..n-1] in segments of varying length; returns
+ * the number of errors and the CPU time in *cpu.
+ */
+double run_generator (BER_FUNC gen, SCD_EID * EID, short *y, long n, double *cpu) {
+  long i, k, l;
+  double nerr = 0;
+  clock_t t0;
+
+  t0 = clock ();
+  for (i = 0, k = 0; i < n; i += l, k++) {
+    l = seg_len[k % N_SEG];
+    if (l > n - i)
+      l = n - i;
+    nerr += gen (EID, l, y + i);
+  }
+  *cpu = (double) (clock () - t0) / CLOCKS_PER_SEC;
+  return nerr;
+}
+
+
+/*
+ * Generate the pattern in nch chunks, generated last to first and joined
+ * in order; returns the number of errors, or -1 on failure.
+ */
+double run_chunks (SCD_EID * EID, short *y, long n, long nch, double *cpu) {
+  BER_CHUNK **chunk;
+  long *start, c;
+  double nerr = 0;
+  clock_t t0;
+
+  chunk = (BER_CHUNK **) malloc (nch * sizeof (BER_CHUNK *));
+  start = (long *) malloc ((nch + 1) * sizeof (long));
+  if (chunk == NULL || start == NULL)
+    HARAKIRI ("Error allocating memory for chunks\n", 3);
+
+  /* unequal chunk boundaries */
+  for (c = 0; c < nch; c++)
+    start[c] = (long) ((double) n * c * c / ((double) nch * nch));
+  start[nch] = n;
+
+  t0 = clock ();
+  for (c = nch - 1; c >= 0; c--)
+    if ((chunk[c] = BER_generator_chunk (EID, start[c], start[c + 1] - start[c], y + start[c])) == NULL)
+      return -1;
+  for (c = 0; c < nch; c++)
+    nerr += BER_join_chunk (EID, chunk[c], y + start[c]);
+  *cpu = (double) (clock () - t0) / CLOCKS_PER_SEC;
+
+  free (chunk);
+  free (start);
+  return nerr;
+}
+
+
+/*
+ * Variance of the number of errors in y[0..n-1], estimated from the
+ * spread of the counts in 100 blocks (the errors are correlated)
+ */
+double count_var (short *y, long n) {
+  long i, k, l = n / 100;
+  double c, s = 0, s2 = 0;
+
+  for (k = 0; k < 100; k++) {
+    for (c = 0, i = k * l; i < (k + 1) * l; i++)
+      c += y[i] == (short) 0x0081;
+    s += c;
+    s2 += c * c;
+  }
+  return (s2 - s * s / 100) / 99 * 100;
+}
+
+
+/* Probability of an error following an error */
+double burst_prob (short *y, long n) {
+  long i, e = 0, ee = 0;
+
+  for (i = 1; i < n; i++)
+    if (y[i - 1] == (short) 0x0081) {
+      e++;
+      ee += y[i] == (short) 0x0081;
+    }
+  return e ? (double) ee / e : 0.0;
+}
+
+
+void display_usage () {
+  printf ("EIDBENCH.C - Version 1.0 of 17.Oct.2026\n\n");
+  printf (" Benchmark and equivalence check of the EID bit error generators.\n\n");
+  printf (" Usage:\n");
+  printf (" $ eidbench [-options]\n\n");
+  printf (" Options:\n");
+  printf ("  -n N ....... number of bits per pattern [default: 20000000]\n");
+  printf ("  -check ..... only check the generators, no timing\n");
+  exit (-128);
+}
+
+
+int main (int argc, char *argv[]) {
+  long n = 20000000L, i, fail = 0;
+  unsigned b, g;
+  int check = 0, exact, chunked, stats;
+  unsigned long seed, s1, s2, steps;
+  double cpu_ref, cpu_fast, cpu_chunk, cpu_geom, e_ref, e_fast, e_chunk, e_geom, p_ref, p_geom, tol;
+  short *y_ref, *y;
+  SCD_EID *ref, *eid;
+
+  /* Get options */
+  while (argc > 1 && argv[1][0] == '-')
+    if (strcmp (argv[1], "-n") == 0) {
+      n = atol (argv[2]);
+      argc -= 2;
+      argv += 2;
+    } else if (strcmp (argv[1], "-check") == 0) {
+      check = 1;
+      argc--;
+      argv++;
+    } else if (strcmp (argv[1], "-h") == 0 || strcmp (argv[1], "-?") == 0) {
+      display_usage ();
+    } else {
+      fprintf (stderr, "ERROR! Invalid option \"%s\" in command line\n\n", argv[1]);
+      display_usage ();
+    }
+
+  if (check)
+    n = 2000000L;
+  if (n < 1000)
+    n = 1000;
+  if ((y_ref = (short *) malloc (n * sizeof (short))) == NULL || (y = (short *) malloc (n * sizeof (short))) == NULL)
+    HARAKIRI ("Error allocating memory for patterns\n", 3);
+
+  /* Skip-ahead against stepping the LCG of EID_random() */
+  for (steps = 0, seed = 4711; steps < 3000; steps += 1 + steps / 3) {
+    for (s1 = seed, i = 0; i < (long) steps; i++)
+      s1 = (unsigned long) 69069L *s1 + 1L;
+    s2 = seed;
+    EID_skip_ahead (&s2, steps);
+    if (s1 != s2) {
+      fprintf (stderr, "EID_skip_ahead() differs after %lu steps\n", steps);
+      fail++;
+    }
+  }
+
+  printf ("%-6s %-5s %10s %10s %10s %10s %6s %6s %9s %9s\n", "ber", "gamma", "ref[Mb/s]", "fast[Mb/s]", "chnk[Mb/s]", "geom[Mb/s]", "exact", "chunk", "ber-geom", "burst-geo");
+  for (b = 0; b < N_BER; b++)
+    for (g = 0; g < N_GAMMA; g++) {
+      if ((ref = open_eid (ber_list[b], gamma_list[g])) == NULL || (eid = open_eid (ber_list[b], gamma_list[g])) == NULL)
+        HARAKIRI ("Could not create EID\n", 1);
+      seed = 314159265UL + 1000 * b + g;
+
+      /* Reference */
+      set_RAN_seed (ref, seed);
+      set_GEC_current_state (ref, 0);
+      e_ref = run_generator (BER_generator, ref, y_ref, n, &cpu_ref);
+      p_ref = burst_prob (y_ref, n);
+
+      /* Fast generator: same pattern, state and seed */
+      set_RAN_seed (eid, seed);
+      set_GEC_current_state (eid, 0);
+      e_fast = run_generator (BER_generator_fast, eid, y, n, &cpu_fast);
+      exact = e_fast == e_ref && memcmp (y, y_ref, n * sizeof (short)) == 0 && get_RAN_seed (eid) == get_RAN_seed (ref) && get_GEC_current_state (eid) == get_GEC_current_state (ref);
+
+      /* Chunked generation */
+      set_RAN_seed (eid, seed);
+      set_GEC_current_state (eid, 0);
+      e_chunk = run_chunks (eid, y, n, 16, &cpu_chunk);
+      chunked = e_chunk == e_ref && memcmp (y, y_ref, n * sizeof (short)) == 0 && get_RAN_seed (eid) == get_RAN_seed (ref) && get_GEC_current_state (eid) == get_GEC_current_state (ref);
+
+      /* Geometric generator: same statistics */
+      set_RAN_seed (eid, seed + 1);
+      set_GEC_current_state (eid, 0);
+      e_geom = run_generator (BER_generator_geometric, eid, y, n, &cpu_geom);
+      p_geom = burst_prob (y, n);
+
+      /* Tolerance: 5 standard deviations of the difference of the error counts */
+      tol = 5 * sqrt (2 * count_var (y_ref, n)) + 5;
+      stats = fabs (e_geom - e_ref) < tol && fabs (p_geom - p_ref) < 0.02 + 5 * sqrt (p_ref * (1 - p_ref) / (e_ref + 1) * 2);
+
+      if (!exact || !chunked || !stats)
+        fail++;
+
+      printf ("%-6.3f %-5.2f", ber_list[b], gamma_list[g]);
+      if (check)
+        printf (" %10s %10s %10s %10s", "-", "-", "-", "-");
+      else
+        printf (" %10.1f %10.1f %10.1f %10.1f", n / (cpu_ref + 1e-9) / 1e6, n / (cpu_fast + 1e-9) / 1e6, n / (cpu_chunk + 1e-9) / 1e6, n / (cpu_geom + 1e-9) / 1e6);
+      printf (" %6s %6s %9.5f %9.4f\n", exact ? "yes" : "NO", chunked ? "yes" : "NO", e_geom / n, p_geom);
+      if (!stats)
+        fprintf (stderr, "  reference: ber %.5f, burst %.4f\n", e_ref / n, p_ref);
+
+      close_eid (ref);
+      close_eid (eid);
+    }
+
+  free (y_ref);
+  free (y);
+
+  if (fail)
+    fprintf (stderr, "%ld check(s) failed\n", fail);
+  return fail ? 1 : 0;
+}
@@ -1,4 +1,4 @@
-/*                                                          02.Feb.2010 v1.7
+/*                                                          17.Oct.2026 v1.10
    =========================================================================
 
    gen-patt.c
@@ -108,8 +108,14 @@
    -compact . Save error pattern in compact binary format (same as -bit)
    -reset ... Reset EID state in between iteractions
    -max # ... Maximum number of iteractions
-   -tol # ... Max deviation of specified BER/FER/BFER
+   -tol # ... Max deviation of specified BER/FER/BFER; the exit code is
+              2 if it is not met after the maximum number of iteractions
    -q ....... Quiet operation mode
+   -geom .... Generate the BER/FER pattern by drawing run lengths
+              (BER_generator_geometric); statistically equivalent, but
+              not the same pattern as the default generator
+   -threads # Number of threads for the BER mode [default: 1]; the
+              pattern is the same for any number of threads
 
    Original Author:
    ~~~~~~~~~~~~~~~~
@@ -152,6 +158,13 @@
                        (preamble part may now be excluded for teh iteration target) <Ericsson>
    02.Feb.2010,v1.7  Modified maximum string length for filenames to avoid
                      buffer overruns (y.hiwasaki)
+   17.Oct.2026 v1.8  BER and FER patterns generated with BER_generator_fast()
+                     (same patterns as before); added options -geom and
+                     -threads.
+   17.Oct.2026 v1.9  Terminated the name of the state file, which could get
+                     trailing garbage when taken from the command line.
+   17.Oct.2026 v1.10 Exit code 2 when the -tol tolerance is not met after
+                     the maximum number of iteractions.
 
   ========================================================================= */
 
@@ -168,6 +181,13 @@
 #include "eid_io.h"             /* EID state variable I/O functions */
 #include "softbit.h"            /* Soft bit definitions */
 
+#ifdef _WIN32
+#include <windows.h>
+#include <process.h>
+#else
+#include <pthread.h>
+#endif
+
 
 #define FER_FIX
 /* ..... Definitions used by the program ..... */
@@ -176,10 +196,24 @@
 #define EID_BUFFER_LENGTH 256
 #define OUT_RECORD_LENGTH 512
 
+/* Bits generated by each thread at a time in the multi-threaded BER mode */
+#define PAR_CHUNK_LENGTH 65536
+#define MAX_THREADS 64
+
+/* One chunk of the pattern, generated by one thread */
+typedef struct {
+  SCD_EID *eid;
+  long start;
+  long n;
+  short *patt;
+  BER_CHUNK *chunk;
+} CHUNK_JOB;
+
 /* Local function prototypes */
 char *mode_str ARGS ((int mode));
 char check_bellcore ARGS ((long index));
-long run_FER_generator_random ARGS ((short *patt, SCD_EID * state, long n));
+long run_FER_generator_random ARGS ((short *patt, SCD_EID * state, long n, int geom));
+double run_BER_generator ARGS ((short *patt, SCD_EID * state, long n, int geom, int threads));
 long run_FER_generator_burst ARGS ((short *patt, BURST_EID * state, long n));
 void display_usage ARGS ((void));
 
@@ -235,11 +269,16 @@ char check_bellcore (long index) {
    times & store the returned frame erasure results in G.192 format into
    an array. Used for improved I/O efficiency.
 
+   The erasure flags are generated in one call of BER_generator_fast(),
+   which gives the same flags as n calls of FER_generator_random(), or
+   of BER_generator_geometric() if geom is set.
+
    Parameter:
    ~~~~~~~~~~
    patt ....... short buffer to store the frame erasure information
    state ...... SCD_EID structure (previously initialized by open_eid)
    n .......... number of times FER_generator_random should be run
+   geom ....... use BER_generator_geometric()
 
    Return value:
    ~~~~~~~~~~~~~
@@ -251,23 +290,105 @@ char check_bellcore (long index) {
    History:
    ~~~~~~~~
    15.Aug.97  v.1.0  Created.
+   17.Oct.26  v.1.1  Flags generated by BER_generator_fast() or
+                     BER_generator_geometric().
    -------------------------------------------------------------------------
  */
-long run_FER_generator_random (short *patt, SCD_EID * state, long n) {
-  long fer, i, count;
+long run_FER_generator_random (short *patt, SCD_EID * state, long n, int geom) {
+  long i, count;
 
-  for (count = i = 0; i < n; i++) {
-    fer = (long) FER_generator_random (state);
-    if (fer)
-      count++;
-    *patt++ = fer ? G192_FER : G192_SYNC;
-  }
+  count = (long) (geom ? BER_generator_geometric (state, n, patt)
+                  : BER_generator_fast (state, n, patt));
+  for (i = 0; i < n; i++)
+    patt[i] = patt[i] == (short) 0x0081 ? G192_FER : G192_SYNC;
   return (count);
 }
 
 /* .................. End of run_FER_generator_random() .................. */
 
 
+/*
+   -------------------------------------------------------------------------
+   double run_BER_generator (short *patt, SCD_EID *state, long n,
+   ~~~~~~~~~~~~~~~~~~~~~~~~  int geom, int threads)
+
+   Generate n bits of the bit error pattern, with BER_generator_fast(),
+   or BER_generator_geometric() if geom is set. With threads>1, the bits
+   are split into as many chunks, generated at the same time with
+   BER_generator_chunk() and joined in order, which gives the same
+   pattern as BER_generator_fast().
+
+   Return value:
+   ~~~~~~~~~~~~~
+   The number of bit errors.
+
+   History:
+   ~~~~~~~~
+   17.Oct.26  v.1.0  Created.
+   -------------------------------------------------------------------------
+ */
+#ifdef _WIN32
+static unsigned __stdcall chunk_thread (void *arg)
+#else
+static void *chunk_thread (void *arg)
+#endif
+{
+  CHUNK_JOB *job = (CHUNK_JOB *) arg;
+
+  job->chunk = BER_generator_chunk (job->eid, job->start, job->n, job->patt);
+  return 0;
+}
+
+double run_BER_generator (short *patt, SCD_EID * state, long n, int geom, int threads) {
+  CHUNK_JOB job[MAX_THREADS];
+#ifdef _WIN32
+  HANDLE tid[MAX_THREADS];
+#else
+  pthread_t tid[MAX_THREADS];
+#endif
+  double ber = 0.0;
+  long len;
+  int t;
+
+  if (geom)
+    return (BER_generator_geometric (state, n, patt));
+  if (threads <= 1 || n < threads)
+    return (BER_generator_fast (state, n, patt));
+
+  len = (n + threads - 1) / threads;
+  for (t = 0; t < threads; t++) {
+    job[t].eid = state;
+    job[t].start = t * len;
+    job[t].n = t * len + len > n ? n - t * len : len;
+    job[t].patt = patt + t * len;
+#ifdef _WIN32
+    tid[t] = (HANDLE) _beginthreadex (NULL, 0, chunk_thread, &job[t], 0, NULL);
+    if (tid[t] == 0)
+#else
+    if (pthread_create (&tid[t], NULL, chunk_thread, &job[t]) != 0)
+#endif
+      HARAKIRI ("Unable to create thread\n", 1);
+  }
+  for (t = 0; t < threads; t++) {
+#ifdef _WIN32
+    WaitForSingleObject (tid[t], INFINITE);
+    CloseHandle (tid[t]);
+#else
+    pthread_join (tid[t], NULL);
+#endif
+    if (job[t].chunk == NULL)
+      HARAKIRI ("Error generating pattern chunk\n", 1);
+  }
+
+  /* The chunks must be joined in order */
+  for (t = 0; t < threads; t++)
+    ber += BER_join_chunk (state, job[t].chunk, job[t].patt);
+  return (ber);
+}
+
+/* ...................... End of run_BER_generator() ...................... */
+
+
 /*
    -------------------------------------------------------------------------
    long run_FER_generator_burst (short *patt, BURST_EID *state, long n)
@@ -322,7 +443,7 @@ long run_FER_generator_burst (short *patt, BURST_EID * state, long n) {
    --------------------------------------------------------------------------
  */
 void display_usage () {
-  printf ("gen-patt.c Version 1.7 of 02.Feb.2010\n");
+  printf ("gen-patt.c Version 1.10 of 17.Oct.2026\n");
 
   printf ("  This example program produces bit error pattern files for error\n");
   printf ("  insertion in G.192-compliant serial bitstreams encoded files. Error\n");
@@ -362,8 +483,11 @@ void display_usage () {
   printf ("   -compact . Save error pattern in compact binary format (same as -bit)\n");
   printf ("   -reset ... Reset EID state in between iteractions\n");
   printf ("   -max # ... Maximum number of iteractions\n");
-  printf ("   -tol # ... Max deviation of specified BER/FER/BFER\n");
+  printf ("   -tol # ... Max deviation of specified BER/FER/BFER; the exit code is\n");
+  printf ("              2 if it is not met after the maximum number of iteractions\n");
   printf ("   -q ....... Quiet operation mode\n");
+  printf ("   -geom .... Draw run lengths (statistically equivalent, different pattern)\n");
+  printf ("   -threads # Number of threads for the BER mode [default: 1]\n");
 
   /* Quit program */
   exit (-128);
@@ -382,7 +506,7 @@ int main (int argc, char *argv[]) {
   long number_of_frames = 0;    /* Total no.of frames in pattern */
   long start_frame = 1;         /* Start inserting error from 1st one */
   double ber_rate = -1;         /* Bit error rate: depend on the mode */
-  char state_file[MAX_STRLEN];  /* File for saving BER/FER/BFER state */
+  char state_file[MAX_STRLEN] = "";     /* File for saving BER/FER/BFER state */
 
   /* File I/O parameter */
   FILE *out_file_ptr;
@@ -411,6 +535,7 @@ int main (int argc, char *argv[]) {
   double generated;             /* # of generated bits/frames */
   double percentage_proc, percentage_gen, percentage_used;
   double tolerance = -1;        /* Tolerance for actual rates; disabled */
+  int tol_missed;               /* Tolerance not met in last iteraction */
   char percent = '%';
   long i, j, k, iteraction = 0;
   long items;                   /* Number of output elements */
@@ -421,6 +546,8 @@ int main (int argc, char *argv[]) {
 #endif
   long max_iteraction = 100;
   char quiet = 0, reset = 0, save_format = byte, tailstat = 0;
+  int geom = 0, threads = 1;
+  long gen_length = EID_BUFFER_LENGTH;  /* bits generated at a time */
   long (*save_data) () = save_byte;     /* Pointer to a function */
 
 #ifdef PORT_TEST
@@ -537,6 +664,22 @@ int main (int argc, char *argv[]) {
         /* Move arg{c,v} over the option to the next argument */
         argc--;
         argv++;
+      } else if (strcmp (argv[1], "-geom") == 0) {
+        /* Run-length (geometric) generator */
+        geom = 1;
+
+        /* Move arg{c,v} over the option to the next argument */
+        argc--;
+        argv++;
+      } else if (strcmp (argv[1], "-threads") == 0) {
+        /* Number of threads for the BER mode */
+        threads = atoi (argv[2]);
+        if (threads < 1 || threads > MAX_THREADS)
+          HARAKIRI ("Number of threads out of range\n", 1);
+
+        /* Move arg{c,v} over the option to the next argument */
+        argc -= 2;
+        argv += 2;
       } else if (strcmp (argv[1], "-tailstat") == 0) {
         /* Count statistics on tail excluting frames [1.. (start-1)] */
         tailstat = 1;
@@ -691,7 +834,9 @@ int main (int argc, char *argv[]) {
   /*
    **  Allocate memory for G.192 data buffer
    */
-  error_pat = (short *) calloc (EID_BUFFER_LENGTH, sizeof (short));
+  if (mode == 'R' && threads > 1 && !geom)
+    gen_length = (long) threads *PAR_CHUNK_LENGTH;
+  error_pat = (short *) calloc (gen_length, sizeof (short));
   if (error_pat == (short *) 0) {
     HARAKIRI ("Could not allocate memory for error pattern buffer\n", 1);
   }
@@ -755,12 +900,12 @@ int main (int argc, char *argv[]) {
         }
 
         /* Generate bits subject to disturbance */
-        for (i = start_frame; i < number_of_frames; i += EID_BUFFER_LENGTH) {
-          /* Checks how many frame erasures are necessary here. If this is not the last round of collections, then get EID_BUFFER_LENGTH frame erasure indications. If this is the last iteraction in the loop, get only the remainder of samples not all EID_BUFFER_LENGTH samples */
-          k = i + EID_BUFFER_LENGTH > number_of_frames ? number_of_frames - (long) generated : EID_BUFFER_LENGTH;
+        for (i = start_frame; i < number_of_frames; i += gen_length) {
+          /* Checks how many frame erasures are necessary here. If this is not the last round of collections, then get gen_length frame erasure indications. If this is the last iteraction in the loop, get only the remainder of samples not all gen_length samples */
+          k = i + gen_length > number_of_frames ? number_of_frames - (long) generated : gen_length;
 
           /* Run bit error generator */
-          ber1 = BER_generator (BEReid, k, error_pat);
+          ber1 = run_BER_generator (error_pat, BEReid, k, geom, threads);
 
           /* Save data to file according to the defined format */
           items = save_data (error_pat, k, out_file_ptr);
@@ -801,7 +946,7 @@ int main (int argc, char *argv[]) {
              k = i + EID_BUFFER_LENGTH > number_of_frames ? number_of_frames % EID_BUFFER_LENGTH : EID_BUFFER_LENGTH; */
 
           /* Run either Gilbert or Bellcore frame erasure model */
-          ber1 = mode == 'F' ? run_FER_generator_random (error_pat, FEReid, k)
+          ber1 = mode == 'F' ? run_FER_generator_random (error_pat, FEReid, k, geom)
             : run_FER_generator_burst (error_pat, burst_eid, k);
 
           /* Save intermediate data in buffer */
@@ -834,6 +979,7 @@ int main (int argc, char *argv[]) {
   }
 
   while (tolerance >= 0 && fabs (ber_rate - percentage_used) > tolerance && iteraction < max_iteraction);
+  tol_missed = tolerance >= 0 && fabs (ber_rate - percentage_used) > tolerance;
 
   /*
    ** .. Print some statistics ...
@@ -926,8 +1072,10 @@ int main (int argc, char *argv[]) {
    **  Close the output file and quit
    */
   fclose (out_file_ptr);
+  if (tol_missed)
+    fprintf (stderr, "*** Tolerance %.2e not met after %ld iteractions\n", tolerance, iteraction);
 
 #ifndef VMS                     /* return value to OS if not VMS */
-  return 0;
+  return tol_missed ? 2 : 0;
 #endif
 }
@@ -1,4 +1,4 @@
-/*                                                           02.Feb.2010 v3.5
+/*                                                           17.Oct.2026 v3.7
   ===========================================================================
 
   FILTER.C
@@ -40,6 +40,9 @@
                   asynchronous tandeming simulation. For d>0, null
                   samples are inserted in the begining of the file,
                   d<0 causes samples to be dropped. Default is d=0.
+  -engine e ..... FIR kernel engine: "ref" (original kernels), "poly"
+                  (polyphase, bit-identical to "ref") [default], or "fast"
+                  (polyphase with fused multiply-add, see firflt.h)
   -q ............ quiet processing (no progress flag)
 
   Valid filter specifications:
@@ -152,6 +155,10 @@
 
    02.Feb.2010 v3.5 - Modified maximum string length for filenames to avoid
                       buffer overruns (y.hiwasaki)
+   17.Oct.2026 v3.6 - Added option -engine to select the FIR kernel engine
+                      (reference, polyphase [default] or fast polyphase)
+   17.Oct.2026 v3.7 - File I/O with the ugst-io module (input file
+                      memory-mapped, output written in large blocks)
   ===========================================================================
 */
 
@@ -171,6 +178,7 @@
 #include "iirflt.h"
 #include "firflt.h"
 #include "ugst-utl.h"
+#include "ugst-io.h"
 
 /* LOCAL DEFINITIONS */
 #ifndef max
@@ -221,7 +229,7 @@ int valid_filter (char *F_type, char modified_IRS) {
  * Last update: 15.May.2007 <>
  */
 void display_usage () {
-  printf ("FILTER.C - Version 3.5 of 02.Feb.2010 \n\n");
+  printf ("FILTER.C - Version 3.7 of 17.Oct.2026 \n\n");
 
   printf (" Test program to process a given file by one of the possible filter\n");
   printf (" characteristics of the STL. Multiple filterings (as available\n");
@@ -254,6 +262,7 @@ void display_usage () {
   printf ("               asynchronous tandeming simulation. For d>0, null\n");
   printf ("               samples are inserted in the begining of the file,\n");
   printf ("               d<0 causes samples to be dropped. Default is d=0.\n");
+  printf ("  -engine e .. FIR kernel engine: ref, poly [default] or fast\n");
   printf ("  -q ......... quiet processing (no progress flag)\n");
   printf ("\n");
   printf (" Valid filter specifications:\n");
@@ -319,6 +328,7 @@ int main (int argc, char *argv[]) {
   long inp_size, out_size, factor, smpno;
   double fs = 8000;
   char kernel_type = 0;
+  int fir_engine = HQ_ENGINE_POLYPHASE;
   static char funny[9] = "|/-\\|/-\\";
 
   /* For asynchronous tandem simulation */
@@ -327,7 +337,7 @@ int main (int argc, char *argv[]) {
 
   /* File variables */
   char FileIn[MAX_STRLEN], FileOut[MAX_STRLEN];
-  FILE *Fi, *Fo;
+  UGST_IO *Fi, *Fo;
   long start_byte;
 #ifdef VMS
   char mrs[15];
@@ -389,6 +399,22 @@ int main (int argc, char *argv[]) {
         if (delay < 0)
           skip = -delay;
 
+        /* Move arg{c,v} over the option to the next argument */
+        argc -= 2;
+        argv += 2;
+      } else if (strcmp (argv[1], "-engine") == 0) {
+        /* FIR kernel engine */
+        if (argc < 3)
+          HARAKIRI ("Missing FIR engine (use ref, poly or fast)\n", 5);
+        if (strcmp (argv[2], "ref") == 0)
+          fir_engine = HQ_ENGINE_REFERENCE;
+        else if (strcmp (argv[2], "poly") == 0)
+          fir_engine = HQ_ENGINE_POLYPHASE;
+        else if (strcmp (argv[2], "fast") == 0)
+          fir_engine = HQ_ENGINE_FAST;
+        else
+          HARAKIRI ("Invalid FIR engine (use ref, poly or fast)\n", 5);
+
         /* Move arg{c,v} over the option to the next argument */
         argc -= 2;
         argv += 2;
@@ -692,6 +718,7 @@ int main (int argc, char *argv[]) {
   /* Calculate Output buffer size and rate change factor */
   switch (kernel_type) {
   case FIR:
+    hq_engine (fir_state, fir_engine);
     factor = fir_state->dwn_up;
     out_size = (fir_state->hswitch == 'U')
       ? inp_size * factor : ceil (inp_size / (double) factor);
@@ -759,15 +786,15 @@ int main (int argc, char *argv[]) {
 #endif
 
   /* Opening input file; abort if there's any problem */
-  if ((Fi = fopen (FileIn, RB)) == NULL)
+  if ((Fi = ugst_io_open_read (FileIn, UGST_IO_NATIVE)) == NULL)
     KILL (FileIn, 2);
 
   /* Creates output file */
-  if ((Fo = fopen (FileOut, WB)) == NULL)
+  if ((Fo = ugst_io_open_write (FileOut, UGST_IO_NATIVE)) == NULL)
     KILL (FileOut, 3);
 
   /* Move pointer to 1st block of interest */
-  if (fseek (Fi, start_byte, 0))
+  if (ugst_io_seek (Fi, start_byte / (long) sizeof (short)))
     KILL (FileIn, 4);
 
 
@@ -775,7 +802,7 @@ int main (int argc, char *argv[]) {
 
   /* One-time delay of output signal, if appropriate */
   if (async && delay > 0)
-    if ((smpno = fwrite (zero, sizeof (short), delay, Fo)) == 0 && ferror (Fo))
+    if ((smpno = ugst_io_write (Fo, zero, delay)) < 0)
       KILL (FileOut, 6);
 
   /* Process regular frames */
@@ -788,7 +815,7 @@ int main (int argc, char *argv[]) {
     memset (OutBuff, '\0', out_size * sizeof (float));
 
     /* Read a block of samples */
-    if ((smpno = fread (TmpBuff, sizeof (short), N, Fi)) == 0)
+    if ((smpno = ugst_io_read (Fi, TmpBuff, N)) == 0)
       KILL (FileIn, 5);
 
     /* ... and convert short to float, normalizing */
@@ -830,12 +857,12 @@ int main (int argc, char *argv[]) {
       skip -= smpno;
       continue;
     } else if (skip > 0) {
-      if ((smpno = fwrite (&TmpBuff[skip], sizeof (short), (smpno - skip), Fo)) == 0 && ferror (Fo))
+      if ((smpno = ugst_io_write (Fo, &TmpBuff[skip], (smpno - skip))) < 0)
         KILL (FileOut, 6);
       total += smpno;
       skip = 0;
     } else {
-      if ((smpno = fwrite (TmpBuff, sizeof (short), smpno, Fo)) == 0 && ferror (Fo))
+      if ((smpno = ugst_io_write (Fo, TmpBuff, smpno)) < 0)
         KILL (FileOut, 6);
       total += smpno;
     }
@@ -846,8 +873,9 @@ int main (int argc, char *argv[]) {
   fprintf (stderr, "\n");
 
   /* Close open files */
-  fclose (Fi);
-  fclose (Fo);
+  ugst_io_close (Fi);
+  if (ugst_io_close (Fo) < 0)
+    KILL (FileOut, 6);
 
   /* Release some memory */
   free (TmpBuff);
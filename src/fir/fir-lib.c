@@ -1,4 +1,4 @@
-/*                                                          v2.3 - 03/Dec/2004
+/*                                                          v2.4 - 17/Oct/2026
   =============================================================================
 
                           U    U   GGG    SSSS  TTTTT
@@ -46,6 +46,9 @@ FUNCTIONS:
                                     (needed only if another signal should
                                     be processed with the same filter)
          = hq_free(...)          :  deallocate FIR-filter memory
+         = hq_engine(...)        :  select kernel engine (reference,
+                                    polyphase or fast polyphase)
+         = hq_engine_name(...)   :  name of the engine in use
 
   Local (Used by other sub-units of this module, should not be needed by
          the user's program. Prototypes here and in the sub-units that use
@@ -57,6 +60,10 @@ FUNCTIONS:
                                    up-sampling procedures;
          = fir_downsampling_kernel(...) : kernel function for all FIR
                                    down-sampling procedures;
+         = fir_poly_upsampling_kernel(...) : polyphase engine for FIR
+                                   up-sampling procedures;
+         = fir_poly_downsampling_kernel(...) : polyphase engine for FIR
+                                   down-sampling procedures;
 
 HISTORY:
     16.Dec.91 v0.1 First beta-version <hf@pkinbg.uucp>
@@ -71,6 +78,13 @@ HISTORY:
 				   OpenVMS/AXP <simao@ctd.comsat.com>
     03.Dec.04 v2.3 Added correction in fir_downsampling_kernel() for sample-based
 				   operation.	<Cyril Guillaume & Stephane Ragot - stephane.ragot@francetelecom.com>
+    17.Oct.26 v2.4 Added polyphase engine: history and input are placed in
+                   one contiguous buffer (no transition phase), the input
+                   is split into its polyphase components and the dot
+                   products are computed for several output samples at
+                   once using SSE/AVX/NEON, selected at run time. The tap
+                   accumulation order is unchanged, so the output is
+                   bit-identical to the original kernels.
 
   =============================================================================
 */
@@ -81,9 +95,24 @@ HISTORY:
  */
 #include <stdio.h>
 #include <stdlib.h>             /* General utility definitions */
+#include <string.h>             /* memcpy() */
 
 #include "firflt.h"             /* Global definitions for FIR-FIR filter */
 
+/* SIMD instruction sets usable by the polyphase engine */
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define FIR_HAVE_SSE
+#include <xmmintrin.h>
+#if defined(__GNUC__) && !defined(__INTEL_COMPILER)
+#define FIR_HAVE_AVX            /* compiled with target attributes, selected by cpuid */
+#include <immintrin.h>
+#endif
+#endif
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define FIR_HAVE_NEON
+#include <arm_neon.h>
+#endif
+
 
 /*
  * ......... Local function prototypes .........
@@ -94,6 +123,11 @@ SCD_FIR *fir_initialization ARGS ((long lenh0, float h0[], double gain, long idw
 
 static long fir_upsampling_kernel ARGS ((long lenx, float *x_ptr, float *y_ptr, long lenh0, float *h0_ptr, float *T_ptr, long iupfac));
 static long fir_downsampling_kernel ARGS ((long lenx, float *x_ptr, float *y_ptr, long lenh0, float *h0_ptr, float *T_ptr, long downfac, long *k0_ptr));
+static long fir_poly_upsampling_kernel ARGS ((long lenx, float *x_ptr, float *y_ptr, SCD_FIR * fir_ptr));
+static long fir_poly_downsampling_kernel ARGS ((long lenx, float *x_ptr, float *y_ptr, SCD_FIR * fir_ptr));
+
+/* Computes nout dot products y[j*ystep] = sum_k src[offs[k]+j] * h[k*hstep], accumulating the taps k=0..ntaps-1 in increasing order */
+typedef void (*fir_lanes_fn) ARGS ((float *y, long ystep, long nout, float *src, long *offs, float *h, long hstep, long ntaps));
 
 
 /*
@@ -140,10 +174,22 @@ static long fir_downsampling_kernel ARGS ((long lenx, float *x_ptr, float *y_ptr
         History:
         ~~~~~~~~
         28.Feb.92 v1.0 Release of 1st version <hf@pkinbg.uucp>
+        17.Oct.26 v1.1 Dispatch to the polyphase engine selected by
+                       hq_engine().
 
  ============================================================================
 */
 long hq_kernel (long lseg, float *x_ptr, SCD_FIR * fir_ptr, float *y_ptr) {
+  long ky;
+
+  if (fir_ptr->engine != HQ_ENGINE_REFERENCE) {
+    /* polyphase engines; return -1 only if the work buffer can't be allocated, in which case the reference kernels are used */
+    ky = fir_ptr->hswitch == 'U' ? fir_poly_upsampling_kernel (lseg, x_ptr, y_ptr, fir_ptr)
+      : fir_poly_downsampling_kernel (lseg, x_ptr, y_ptr, fir_ptr);
+    if (ky >= 0)
+      return ky;
+  }
+
   if (fir_ptr->hswitch == 'U')  /* call up-sampling procedure */
     return fir_upsampling_kernel (      /* returns number of output samples */
                                    lseg,        /* In : length of input signal */
@@ -203,6 +249,8 @@ long hq_kernel (long lseg, float *x_ptr, SCD_FIR * fir_ptr, float *y_ptr) {
 */
 void hq_free (SCD_FIR * fir_ptr) {
 
+  free (fir_ptr->work);         /* free polyphase work buffers */
+  free (fir_ptr->offs);
   free (fir_ptr->T);            /* free state variables */
   free (fir_ptr->h0);           /* free state impulse response */
   free (fir_ptr);               /* free allocated struct */
@@ -251,6 +299,57 @@ void hq_reset (SCD_FIR * fir_ptr) {
 /* .......................... End of hq_reset() .......................... */
 
 
+/*
+  ============================================================================
+
+        int hq_engine (SCD_FIR *fir_ptr, int engine);
+        ~~~~~~~~~~~~~
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Select the kernel engine used by hq_kernel() for this filter:
+
+        HQ_ENGINE_REFERENCE ... original scalar kernels
+        HQ_ENGINE_POLYPHASE ... polyphase kernel, vectorized across output
+                                samples, bit-identical to the reference
+                                (default after initialization)
+        HQ_ENGINE_FAST ........ polyphase kernel using fused
+                                multiply-add, when available (see the
+                                tolerance documented in firflt.h)
+
+        The SIMD instruction set (SSE, AVX, NEON) is chosen at run time.
+        The engine may be changed between two calls of hq_kernel(), since
+        all engines share the delay line in the SCD_FIR struct.
+
+        Parameters:
+        ~~~~~~~~~~~
+        fir_ptr: (InOut) pointer to struct SCD_FIR;
+        engine:  (In)    one of HQ_ENGINE_xxx
+
+        Return value:
+        ~~~~~~~~~~~~~
+        The previously selected engine, or -1 if engine is invalid (in
+        which case the selection is left unchanged).
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0 Created.
+
+ ============================================================================
+*/
+int hq_engine (SCD_FIR * fir_ptr, int engine) {
+  int previous = fir_ptr->engine;
+
+  if (engine != HQ_ENGINE_REFERENCE && engine != HQ_ENGINE_POLYPHASE && engine != HQ_ENGINE_FAST)
+    return -1;
+  fir_ptr->engine = (char) engine;
+  return previous;
+}
+
+/* .......................... End of hq_engine() .......................... */
+
+
 
 /*
   ============================================================================
@@ -339,6 +438,12 @@ SCD_FIR *fir_initialization (long lenh0, float h0[], double gain, long idwnup, i
   /* NOTE: for down-sampling: if the number of input samples is not a multiple of the down-sampling factor, k0 points to the first sample in the next input segment to be processed */
   ptrFIR->k0 = 0;
 
+  /* Polyphase engine by default; work buffers are allocated on first use */
+  ptrFIR->engine = HQ_ENGINE_POLYPHASE;
+  ptrFIR->work = (float *) NULL;
+  ptrFIR->lwork = 0;
+  ptrFIR->offs = (long *) NULL;
+
   /* Return pointer to struct */
   return (ptrFIR);
 }
@@ -588,4 +693,406 @@ static long fir_upsampling_kernel (lenx, x, y, lenh0, h0, T, iupfac)
 /* ................. End of fir_upsampling_kernel() .................. */
 
 
+/*
+ * ......... Polyphase engine: multi-lane dot products .........
+ *
+ * Each output sample keeps its own accumulator and the taps are added in
+ * the same order as in the reference kernels, with separate (rounded)
+ * multiplication and addition; only the fused multiply-add variants,
+ * used by HQ_ENGINE_FAST, change the result.
+ */
+
+static void fir_lanes_scalar (float *y, long ystep, long nout, float *src, long *offs, float *h, long hstep, long ntaps) {
+  long j, k;
+  float acc;
+
+  for (j = 0; j < nout; j++) {
+    acc = src[offs[0] + j] * h[0];
+    for (k = 1; k < ntaps; k++)
+      acc += src[offs[k] + j] * h[k * hstep];
+    y[j * ystep] = acc;
+  }
+}
+
+#ifdef FIR_HAVE_SSE
+static void fir_lanes_sse (float *y, long ystep, long nout, float *src, long *offs, float *h, long hstep, long ntaps) {
+  long j, k, i;
+  float *p, tmp[8];
+  __m128 c, a0, a1;
+
+  for (j = 0; j + 8 <= nout; j += 8) {
+    p = src + j;
+    c = _mm_set1_ps (h[0]);
+    a0 = _mm_mul_ps (_mm_loadu_ps (p + offs[0]), c);
+    a1 = _mm_mul_ps (_mm_loadu_ps (p + offs[0] + 4), c);
+    for (k = 1; k < ntaps; k++) {
+      c = _mm_set1_ps (h[k * hstep]);
+      a0 = _mm_add_ps (a0, _mm_mul_ps (_mm_loadu_ps (p + offs[k]), c));
+      a1 = _mm_add_ps (a1, _mm_mul_ps (_mm_loadu_ps (p + offs[k] + 4), c));
+    }
+    if (ystep == 1) {
+      _mm_storeu_ps (y + j, a0);
+      _mm_storeu_ps (y + j + 4, a1);
+    } else {
+      _mm_storeu_ps (tmp, a0);
+      _mm_storeu_ps (tmp + 4, a1);
+      for (i = 0; i < 8; i++)
+        y[(j + i) * ystep] = tmp[i];
+    }
+  }
+  fir_lanes_scalar (y + j * ystep, ystep, nout - j, src + j, offs, h, hstep, ntaps);
+}
+#endif
+
+#ifdef FIR_HAVE_AVX
+__attribute__ ((target ("avx")))
+static void fir_lanes_avx (float *y, long ystep, long nout, float *src, long *offs, float *h, long hstep, long ntaps) {
+  long j, k, i;
+  float *p, tmp[16];
+  __m256 c, a0, a1;
+
+  for (j = 0; j + 16 <= nout; j += 16) {
+    p = src + j;
+    c = _mm256_set1_ps (h[0]);
+    a0 = _mm256_mul_ps (_mm256_loadu_ps (p + offs[0]), c);
+    a1 = _mm256_mul_ps (_mm256_loadu_ps (p + offs[0] + 8), c);
+    for (k = 1; k < ntaps; k++) {
+      c = _mm256_set1_ps (h[k * hstep]);
+      a0 = _mm256_add_ps (a0, _mm256_mul_ps (_mm256_loadu_ps (p + offs[k]), c));
+      a1 = _mm256_add_ps (a1, _mm256_mul_ps (_mm256_loadu_ps (p + offs[k] + 8), c));
+    }
+    if (ystep == 1) {
+      _mm256_storeu_ps (y + j, a0);
+      _mm256_storeu_ps (y + j + 8, a1);
+    } else {
+      _mm256_storeu_ps (tmp, a0);
+      _mm256_storeu_ps (tmp + 8, a1);
+      for (i = 0; i < 16; i++)
+        y[(j + i) * ystep] = tmp[i];
+    }
+  }
+  fir_lanes_sse (y + j * ystep, ystep, nout - j, src + j, offs, h, hstep, ntaps);
+}
+
+__attribute__ ((target ("avx2,fma")))
+static void fir_lanes_avx_fma (float *y, long ystep, long nout, float *src, long *offs, float *h, long hstep, long ntaps) {
+  long j, k, i;
+  float *p, tmp[16];
+  __m256 c, a0, a1;
+
+  for (j = 0; j + 16 <= nout; j += 16) {
+    p = src + j;
+    c = _mm256_set1_ps (h[0]);
+    a0 = _mm256_mul_ps (_mm256_loadu_ps (p + offs[0]), c);
+    a1 = _mm256_mul_ps (_mm256_loadu_ps (p + offs[0] + 8), c);
+    for (k = 1; k < ntaps; k++) {
+      c = _mm256_set1_ps (h[k * hstep]);
+      a0 = _mm256_fmadd_ps (_mm256_loadu_ps (p + offs[k]), c, a0);
+      a1 = _mm256_fmadd_ps (_mm256_loadu_ps (p + offs[k] + 8), c, a1);
+    }
+    if (ystep == 1) {
+      _mm256_storeu_ps (y + j, a0);
+      _mm256_storeu_ps (y + j + 8, a1);
+    } else {
+      _mm256_storeu_ps (tmp, a0);
+      _mm256_storeu_ps (tmp + 8, a1);
+      for (i = 0; i < 16; i++)
+        y[(j + i) * ystep] = tmp[i];
+    }
+  }
+  fir_lanes_sse (y + j * ystep, ystep, nout - j, src + j, offs, h, hstep, ntaps);
+}
+#endif
+
+#ifdef FIR_HAVE_NEON
+static void fir_lanes_neon (float *y, long ystep, long nout, float *src, long *offs, float *h, long hstep, long ntaps) {
+  long j, k, i;
+  float *p, tmp[8];
+  float32x4_t c, a0, a1;
+
+  for (j = 0; j + 8 <= nout; j += 8) {
+    p = src + j;
+    c = vdupq_n_f32 (h[0]);
+    a0 = vmulq_f32 (vld1q_f32 (p + offs[0]), c);
+    a1 = vmulq_f32 (vld1q_f32 (p + offs[0] + 4), c);
+    for (k = 1; k < ntaps; k++) {
+      c = vdupq_n_f32 (h[k * hstep]);
+      a0 = vaddq_f32 (a0, vmulq_f32 (vld1q_f32 (p + offs[k]), c));
+      a1 = vaddq_f32 (a1, vmulq_f32 (vld1q_f32 (p + offs[k] + 4), c));
+    }
+    vst1q_f32 (tmp, a0);
+    vst1q_f32 (tmp + 4, a1);
+    for (i = 0; i < 8; i++)
+      y[(j + i) * ystep] = tmp[i];
+  }
+  fir_lanes_scalar (y + j * ystep, ystep, nout - j, src + j, offs, h, hstep, ntaps);
+}
+
+#ifdef __ARM_FEATURE_FMA
+static void fir_lanes_neon_fma (float *y, long ystep, long nout, float *src, long *offs, float *h, long hstep, long ntaps) {
+  long j, k, i;
+  float *p, tmp[8];
+  float32x4_t c, a0, a1;
+
+  for (j = 0; j + 8 <= nout; j += 8) {
+    p = src + j;
+    c = vdupq_n_f32 (h[0]);
+    a0 = vmulq_f32 (vld1q_f32 (p + offs[0]), c);
+    a1 = vmulq_f32 (vld1q_f32 (p + offs[0] + 4), c);
+    for (k = 1; k < ntaps; k++) {
+      c = vdupq_n_f32 (h[k * hstep]);
+      a0 = vfmaq_f32 (a0, vld1q_f32 (p + offs[k]), c);
+      a1 = vfmaq_f32 (a1, vld1q_f32 (p + offs[k] + 4), c);
+    }
+    vst1q_f32 (tmp, a0);
+    vst1q_f32 (tmp + 4, a1);
+    for (i = 0; i < 8; i++)
+      y[(j + i) * ystep] = tmp[i];
+  }
+  fir_lanes_scalar (y + j * ystep, ystep, nout - j, src + j, offs, h, hstep, ntaps);
+}
+#endif
+#endif
+
+
+/*
+ * ......... Polyphase engine: run-time selection of the lanes kernel .........
+ *
+ * The selection only reads the cpuid bits that libgcc caches at start-up,
+ * so it is done on every call rather than kept in a static: filters of
+ * different threads never share mutable state.
+ */
+static fir_lanes_fn fir_select_lanes (int engine, char **name) {
+#ifdef FIR_HAVE_AVX
+  if (engine == HQ_ENGINE_FAST && __builtin_cpu_supports ("avx2") && __builtin_cpu_supports ("fma")) {
+    *name = "fast/avx2+fma";
+    return fir_lanes_avx_fma;
+  }
+  if (__builtin_cpu_supports ("avx")) {
+    *name = "polyphase/avx";
+    return fir_lanes_avx;
+  }
+#endif
+#if defined(FIR_HAVE_SSE)
+  *name = "polyphase/sse";
+  return fir_lanes_sse;
+#elif defined(FIR_HAVE_NEON)
+#ifdef __ARM_FEATURE_FMA
+  if (engine == HQ_ENGINE_FAST) {
+    *name = "fast/neon+fma";
+    return fir_lanes_neon_fma;
+  }
+#endif
+  *name = "polyphase/neon";
+  return fir_lanes_neon;
+#else
+  *name = "polyphase/scalar";
+  return fir_lanes_scalar;
+#endif
+}
+
+
+/*
+  ============================================================================
+
+        char *hq_engine_name (SCD_FIR *fir_ptr);
+        ~~~~~~~~~~~~~~~~~~~~
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Return a printable name for the kernel engine and, for the
+        polyphase engines, the instruction set selected at run time.
+
+        Parameters:
+        ~~~~~~~~~~~
+        fir_ptr: (In) pointer to struct SCD_FIR;
+
+        Return value:
+        ~~~~~~~~~~~~~
+        Pointer to a static string.
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0 Created.
+
+ ============================================================================
+*/
+char *hq_engine_name (SCD_FIR * fir_ptr) {
+  char *name;
+
+  if (fir_ptr->engine == HQ_ENGINE_REFERENCE)
+    return "reference";
+  fir_select_lanes (fir_ptr->engine, &name);
+  return name;
+}
+
+/* ....................... End of hq_engine_name() ....................... */
+
+
+/*
+ * ......... Polyphase engine: work buffer holding T[] followed by x[] .........
+ * Returns 0 if memory could not be allocated.
+ */
+static int fir_poly_work (SCD_FIR * fir, long nfloat) {
+  float *work;
+
+  if (fir->offs == (long *) NULL && (fir->offs = (long *) malloc (fir->lenh0 * sizeof (long))) == (long *) NULL)
+    return 0;
+  if (nfloat > fir->lwork) {
+    if ((work = (float *) realloc (fir->work, nfloat * sizeof (float))) == (float *) NULL)
+      return 0;
+    fir->work = work;
+    fir->lwork = nfloat;
+  }
+  return 1;
+}
+
+
+/*
+  ============================================================================
+
+        long fir_poly_downsampling_kernel (long lenx, float *x, float *y,
+        ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  SCD_FIR *fir_ptr);
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Polyphase version of fir_downsampling_kernel(). The delay line and
+        the input are copied into one contiguous buffer, so that every
+        output is a plain dot product without transition phase. For a
+        downsampling factor D>1 the buffer is split into its D polyphase
+        components, which makes the samples needed by consecutive outputs
+        contiguous for each tap. The same outputs, and the same value of
+        the offset k0, as with fir_downsampling_kernel() are produced.
+
+        Parameters:
+        ~~~~~~~~~~~
+        lenx: ..... (In)    length of input signal
+        x: ........ (In)    array with input samples
+        y: ........ (Out)   array with output samples
+        fir_ptr: .. (InOut) pointer to struct SCD_FIR
+
+        Return value:
+        ~~~~~~~~~~~~~
+        Number of filtered samples, or -1 if the work buffer could not be
+        allocated (nothing is changed in the state).
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0 Created.
+
+ ============================================================================
+*/
+static long fir_poly_downsampling_kernel (long lenx, float *x, float *y, SCD_FIR * fir) {
+  long lenh0 = fir->lenh0, downfac = fir->dwn_up, hist = lenh0 - 1;
+  long nbuf, nph, nout, kx, last, n0, n, k, r, m;
+  float *buf, *src;
+  char *name;
+
+  nbuf = hist + lenx;
+  nph = (nbuf + downfac - 1) / downfac;
+  if (!fir_poly_work (fir, downfac > 1 ? nbuf + downfac * nph : nbuf))
+    return -1;
+
+  buf = fir->work;
+  memcpy (buf, fir->T, hist * sizeof (float));
+  memcpy (buf + hist, x, lenx * sizeof (float));
+
+  /* Index (in x) of the first output sample; as in the reference kernel, the sample at k0 is skipped when k0 lies beyond the transition */
+  kx = fir->k0;
+  if (kx > lenh0 - 1)
+    kx += downfac;
+  nout = kx <= lenx - 1 ? (lenx - 1 - kx) / downfac + 1 : 0;
+
+  if (nout > 0) {
+    n0 = hist + kx;
+    if (downfac == 1) {
+      src = buf;
+      for (k = 0; k < lenh0; k++)
+        fir->offs[k] = n0 - k;
+    } else {
+      /* split into polyphase components: src[r*nph+m] = buf[m*downfac+r] */
+      src = buf + nbuf;
+      for (r = 0; r < downfac; r++)
+        for (m = 0, n = r; n < nbuf; m++, n += downfac)
+          src[r * nph + m] = buf[n];
+      for (k = 0; k < lenh0; k++)
+        fir->offs[k] = ((n0 - k) % downfac) * nph + (n0 - k) / downfac;
+    }
+    fir_select_lanes (fir->engine, &name) (y, 1, nout, src, fir->offs, fir->h0, 1, lenh0);
+  }
+
+  /* offset of the first sample to be processed in the next segment */
+  last = nout > 0 ? kx + (nout - 1) * downfac : fir->k0;
+  fir->k0 = last <= lenx - 1 ? last + downfac - lenx : last - lenx;
+
+  /* Update of delay line with the end of T[]+x[] */
+  memcpy (fir->T, buf + lenx, hist * sizeof (float));
+
+  return nout;
+}
+
+/* ................. End of fir_poly_downsampling_kernel() ................ */
+
+
+/*
+  ============================================================================
+
+        long fir_poly_upsampling_kernel (long lenx, float *x, float *y,
+        ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  SCD_FIR *fir_ptr);
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Polyphase version of fir_upsampling_kernel(). Each of the iupfac
+        output phases is a lenh0/iupfac-tap filter on the contiguous
+        buffer holding the delay line followed by the input, computed
+        for all input samples at once.
+
+        Parameters:
+        ~~~~~~~~~~~
+        lenx: ..... (In)    length of input signal
+        x: ........ (In)    array with input samples
+        y: ........ (Out)   array with output samples
+        fir_ptr: .. (InOut) pointer to struct SCD_FIR
+
+        Return value:
+        ~~~~~~~~~~~~~
+        Number of filtered samples, or -1 if the work buffer could not be
+        allocated (nothing is changed in the state).
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0 Created.
+
+ ============================================================================
+*/
+static long fir_poly_upsampling_kernel (long lenx, float *x, float *y, SCD_FIR * fir) {
+  long iupfac = fir->dwn_up, ntaps = fir->lenh0 / iupfac, hist = ntaps - 1;
+  long iup, k;
+  fir_lanes_fn lanes;
+  char *name;
+
+  if (!fir_poly_work (fir, hist + lenx))
+    return -1;
+
+  memcpy (fir->work, fir->T, hist * sizeof (float));
+  memcpy (fir->work + hist, x, lenx * sizeof (float));
+
+  for (k = 0; k < ntaps; k++)
+    fir->offs[k] = hist - k;
+  lanes = fir_select_lanes (fir->engine, &name);
+  for (iup = 0; iup < iupfac; iup++)
+    lanes (y + iup, iupfac, lenx, fir->work, fir->offs, fir->h0 + iup, iupfac, ntaps);
+
+  /* Update of delay line with the end of T[]+x[] */
+  memcpy (fir->T, fir->work + lenx, hist * sizeof (float));
+
+  return lenx * iupfac;
+}
+
+/* .................. End of fir_poly_upsampling_kernel() ................. */
+
+
 /* **************************** END OF FIR-LIB.C ************************** */
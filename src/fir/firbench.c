@@ -0,0 +1,242 @@
+/*                                                           17.Oct.2026 v1.0
+  ===========================================================================
+
+  FIRBENCH.C
+  ~~~~~~~~~~
+
+  Description:
+  ~~~~~~~~~~~~
+
+  Benchmark and equivalence check for the kernel engines of the FIR
+  module (see hq_engine() in fir-lib.c). Every filter of the module is
+  run on the same pseudo-random signal with the reference, the polyphase
+  and the fast polyphase engines; the input throughput (samples per
+  second of CPU time) of each engine is reported, together with a flag
+  telling whether the polyphase output is bit-identical to the reference
+  and the largest deviation of the fast engine.
+
+  The signal is processed in segments of varying length (including
+  segments shorter than the filter and of length 1), so that the handling
+  of the delay line and of the down-sampling offset between calls of
+  hq_kernel() is also verified.
+
+  Usage:
+  ~~~~~~
+  $ firbench [-options] [filter [filter ...]]
+
+  where filter is one of the names listed by "firbench -list"; by default
+  all filters are run.
+
+  Options:
+  -sec s ....... seconds of signal to process per filter [default: 10]
+  -check ....... only check the engines (short signal, no timing), and
+                 return a non-zero exit code if the polyphase engine is
+                 not bit-identical or the fast engine deviates by 1 or more
+                 (in 16-bit units)
+  -list ........ list the available filters
+  -q ........... quiet operation (print only the result table)
+
+  Original author:
+  ~~~~~~~~~~~~~~~~
+  ITU-T STL contributors
+
+  History:
+  ~~~~~~~~
+  17.Oct.2026 v1.0 Created.
+
+  ===========================================================================
+*/
+
+#include "ugstdemo.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "firflt.h"
+
+/* Filters available in the module */
+typedef struct {
+  char *name;
+  double fs;                    /* input sampling rate */
+  SCD_FIR *(*init) ARGS ((void));
+} FIR_ENTRY;
+
+static FIR_ENTRY fir_list[] = {
+  {"HQ2-down", 16000, hq_down_2_to_1_init},
+  {"HQ2-up", 8000, hq_up_1_to_2_init},
+  {"HQ3-down", 48000, hq_down_3_to_1_init},
+  {"HQ3-up", 16000, hq_up_1_to_3_init},
+  {"FLAT-down", 16000, linear_phase_pb_2_to_1_init},
+  {"FLAT-up", 8000, linear_phase_pb_1_to_2_init},
+  {"FLAT1", 16000, linear_phase_pb_1_to_1_init},
+  {"IRS8", 8000, irs_8khz_init},
+  {"IRS16", 16000, irs_16khz_init},
+  {"MIRS16", 16000, mod_irs_16khz_init},
+  {"MIRS48", 48000, mod_irs_48khz_init},
+  {"RXIRS8", 8000, rx_mod_irs_8khz_init},
+  {"RXIRS16", 16000, rx_mod_irs_16khz_init},
+  {"TIRS", 8000, tia_irs_8khz_init},
+  {"HIRS16", 16000, ht_irs_16khz_init},
+  {"DSM", 16000, delta_sm_16khz_init},
+  {"PSO", 8000, psophometric_8khz_init},
+  {"GSM1", 16000, msin_16khz_init},
+  {"P341", 16000, p341_16khz_init},
+  {"5KBP", 16000, bp5k_16khz_init},
+  {"100_5KBP", 16000, bp100_5k_16khz_init},
+  {"14KBP", 32000, bp14k_32khz_init},
+  {"20KBP", 48000, bp20k_48khz_init},
+  {"LP1p5", 48000, LP1p5_48kHz_init},
+  {"LP35", 48000, LP35_48kHz_init},
+  {"LP7", 48000, LP7_48kHz_init},
+  {"LP10", 48000, LP10_48kHz_init},
+  {"LP12", 48000, LP12_48kHz_init},
+  {"LP14", 48000, LP14_48kHz_init},
+  {"LP20", 48000, LP20_48kHz_init},
+};
+
+#define N_FILTERS (sizeof (fir_list) / sizeof (fir_list[0]))
+
+/* Segment lengths cycled through when processing the signal */
+static long seg_len[] = { 256, 1, 37, 1024, 2, 160, 3, 4096, 641 };
+
+#define N_SEG (sizeof (seg_len) / sizeof (seg_len[0]))
+#define MAX_SEG 4096
+
+
+/*
+ * Filter the whole signal x[0..n-1] with the given engine; output goes
+ * to y[], which must hold n*dwn_up samples in the up-sampling case.
+ * Returns the number of output samples and the CPU time in *cpu.
+ */
+long run_filter (FIR_ENTRY * flt, int engine, float *x, long n, float *y, double *cpu) {
+  SCD_FIR *fir;
+  long i, k, l, ny;
+  clock_t t0;
+
+  if ((fir = flt->init ()) == (SCD_FIR *) NULL)
+    HARAKIRI ("Error initializing filter\n", 5);
+  hq_engine (fir, engine);
+
+  t0 = clock ();
+  for (i = 0, k = 0, ny = 0; i < n; i += l, k++) {
+    l = seg_len[k % N_SEG];
+    if (l > n - i)
+      l = n - i;
+    ny += hq_kernel (l, x + i, fir, y + ny);
+  }
+  *cpu = (double) (clock () - t0) / CLOCKS_PER_SEC;
+
+  hq_free (fir);
+  return ny;
+}
+
+
+void display_usage () {
+  printf ("FIRBENCH.C - Version 1.0 of 17.Oct.2026\n\n");
+  printf (" Benchmark and equivalence check of the FIR kernel engines.\n\n");
+  printf (" Usage:\n");
+  printf (" $ firbench [-options] [filter [filter ...]]\n\n");
+  printf (" Options:\n");
+  printf ("  -sec s ..... seconds of signal per filter [default: 10]\n");
+  printf ("  -check ..... only check the engines, no timing\n");
+  printf ("  -list ...... list the available filters\n");
+  printf ("  -q ......... quiet operation\n");
+  exit (-128);
+}
+
+
+int main (int argc, char *argv[]) {
+  double sec = 10, cpu_ref, cpu_poly, cpu_fast, maxdev, d;
+  long n, ny_ref, ny_poly, ny_fast, i, k, lcg = 12345;
+  long fail = 0;
+  unsigned f;
+  int check = 0, quiet = 0, selected, exact;
+  float *x, *y_ref, *y_poly, *y_fast;
+  SCD_FIR *fir;
+
+  /* Get options */
+  while (argc > 1 && argv[1][0] == '-')
+    if (strcmp (argv[1], "-sec") == 0) {
+      sec = atof (argv[2]);
+      argc -= 2;
+      argv += 2;
+    } else if (strcmp (argv[1], "-check") == 0) {
+      check = 1;
+      argc--;
+      argv++;
+    } else if (strcmp (argv[1], "-q") == 0) {
+      quiet = 1;
+      argc--;
+      argv++;
+    } else if (strcmp (argv[1], "-list") == 0) {
+      for (f = 0; f < N_FILTERS; f++)
+        printf ("%s\n", fir_list[f].name);
+      exit (0);
+    } else if (strcmp (argv[1], "-h") == 0 || strcmp (argv[1], "-?") == 0) {
+      display_usage ();
+    } else {
+      fprintf (stderr, "ERROR! Invalid option \"%s\" in command line\n\n", argv[1]);
+      display_usage ();
+    }
+
+  if (check)
+    sec = 0.5;
+
+  if (!quiet) {
+    fir = hq_down_2_to_1_init ();
+    printf ("Polyphase engine: %s", hq_engine_name (fir));
+    hq_engine (fir, HQ_ENGINE_FAST);
+    printf (", fast engine: %s\n\n", hq_engine_name (fir));
+    hq_free (fir);
+  }
+  printf ("%-10s %5s %5s %12s %12s %12s %8s %6s %9s\n", "filter", "rate", "taps", "ref[Ms/s]", "poly[Ms/s]", "fast[Ms/s]", "speedup", "exact", "fast-dev");
+
+  for (f = 0; f < N_FILTERS; f++) {
+    /* Filter selected in the command line? */
+    for (selected = argc == 1, i = 1; i < argc; i++)
+      if (strcmp (argv[i], fir_list[f].name) == 0)
+        selected = 1;
+    if (!selected)
+      continue;
+
+    /* Pseudo-random signal at the filter's input rate */
+    n = (long) (sec * fir_list[f].fs);
+    if ((x = (float *) malloc (n * sizeof (float))) == NULL || (y_ref = (float *) malloc (3 * n * sizeof (float))) == NULL || (y_poly = (float *) malloc (3 * n * sizeof (float))) == NULL || (y_fast = (float *) malloc (3 * n * sizeof (float))) == NULL)
+      HARAKIRI ("Error allocating memory for signals\n", 3);
+    for (i = 0; i < n; i++) {
+      lcg = (lcg * 1103515245 + 12345) & 0x7FFFFFFF;
+      x[i] = (float) ((lcg >> 15) - 32768) / 2;
+    }
+
+    ny_ref = run_filter (&fir_list[f], HQ_ENGINE_REFERENCE, x, n, y_ref, &cpu_ref);
+    ny_poly = run_filter (&fir_list[f], HQ_ENGINE_POLYPHASE, x, n, y_poly, &cpu_poly);
+    ny_fast = run_filter (&fir_list[f], HQ_ENGINE_FAST, x, n, y_fast, &cpu_fast);
+
+    exact = ny_poly == ny_ref && memcmp (y_ref, y_poly, ny_ref * sizeof (float)) == 0;
+    for (maxdev = 0, k = 0; k < ny_ref && k < ny_fast; k++)
+      if ((d = fabs (y_fast[k] - y_ref[k])) > maxdev)
+        maxdev = d;
+    if (!exact || ny_fast != ny_ref || maxdev >= 1.0)
+      fail++;
+
+    fir = fir_list[f].init ();
+    printf ("%-10s %2ld:%-2ld %5ld", fir_list[f].name, fir->hswitch == 'U' ? 1 : fir->dwn_up, fir->hswitch == 'U' ? fir->dwn_up : 1, fir->lenh0);
+    hq_free (fir);
+    if (check)
+      printf (" %12s %12s %12s %8s", "-", "-", "-", "-");
+    else
+      printf (" %12.2f %12.2f %12.2f %7.2fx", n / (cpu_ref + 1e-9) / 1e6, n / (cpu_poly + 1e-9) / 1e6, n / (cpu_fast + 1e-9) / 1e6, (cpu_ref + 1e-9) / (cpu_poly + 1e-9));
+    printf (" %6s %9.2e\n", exact ? "yes" : "NO", maxdev);
+
+    free (x);
+    free (y_ref);
+    free (y_poly);
+    free (y_fast);
+  }
+
+  if (fail)
+    fprintf (stderr, "%ld filter(s) failed the engine equivalence check\n", fail);
+  return fail ? 1 : 0;
+}
@@ -1,4 +1,4 @@
-/*                                                            02.Feb.2010 v2.5
+/*                                                            17.Oct.2026 v2.6
   ============================================================================
 
         FIRDEMO.C
@@ -193,6 +193,8 @@
         06.Jul.99 v2.3 Inserted conditional compilation for CYGWIN and
                        MS Visual C compiler.
         02.Feb.10 v2.5 Modified maximum filename length (y.hiwasaki)
+        17.Oct.26 v2.6 File I/O with the ugst-io module (input file
+                       memory-mapped, output written in large blocks).
   ============================================================================
 */
 
@@ -206,6 +208,7 @@
 #include <string.h>             /* for str...() */
 #include "ugstdemo.h"           /* private defines for user interface */
 #include "ugst-utl.h"           /* conversion from float -> short */
+#include "ugst-io.h"            /* block I/O of sample files */
 #include "firflt.h"             /* definitions for high quality filter */
 
 
@@ -332,8 +335,7 @@ int main (int argc, char *argv[]) {
 
   /* ......... File related variables ......... */
   char inpfil[MAX_STRLEN], outfil[MAX_STRLEN];
-  FILE *inpfilptr, *outfilptr;
-  int inp, out;
+  UGST_IO *inpfilptr, *outfilptr;
 #if defined(VMS)
   char mrs[15];
 #endif
@@ -357,7 +359,7 @@ int main (int argc, char *argv[]) {
   * ......... PRINT INFOS .........
   */
 
-  printf ("%s%s", "*** v2.5 FIR-Up/Down-Sampling ", "and IRS Send Part Filter -  02.Feb.2010 ***\n");
+  printf ("%s%s", "*** v2.6 FIR-Up/Down-Sampling ", "and IRS Send Part Filter -  17.Oct.2026 ***\n");
 
 /*
  * ......... PARAMETERS FOR PROCESSING .........
@@ -416,14 +418,12 @@ int main (int argc, char *argv[]) {
 #endif
 
   GET_PAR_S (1, "_BIN-File to be filtered: ................ ", inpfil);
-  if ((inpfilptr = fopen (inpfil, RB)) == NULL)
+  if ((inpfilptr = ugst_io_open_read (inpfil, UGST_IO_NATIVE)) == NULL)
     HARAKIRI ("Error opening input file\n", 1);
-  inp = fileno (inpfilptr);
 
   GET_PAR_S (2, "_BIN-Output File: ........................ ", outfil);
-  if ((outfilptr = fopen (outfil, WB)) == NULL)
+  if ((outfilptr = ugst_io_open_write (outfil, UGST_IO_NATIVE)) == NULL)
     HARAKIRI ("Error opening output file\n", 1);
-  out = fileno (outfilptr);
 
   GET_PAR_L (3, "_IRS Filter       (0, 8, 16, 48): ........ ", irs);
   if ((irs != 0) && (irs != 8) && (irs != 16) && (irs != 48))
@@ -613,7 +613,7 @@ int main (int argc, char *argv[]) {
   lsegx = lseg;
   while (lsegx == lseg) {
     /* Read data from file in a short array ... */
-    lsegx = fread (sh_buff, sizeof (short), lseg, inpfilptr);
+    lsegx = ugst_io_read (inpfilptr, sh_buff, lseg);
 
     /* ... and convert short to float, normalizing */
     sh2fl_16bit (lsegx, sh_buff, fl_buff, 1);
@@ -744,7 +744,9 @@ int main (int argc, char *argv[]) {
 /*
   * ......... WRITE SAMPLES TO OUTPUT FILE .........
   */
-    nsam += fwrite (sh_buff, sizeof (short), lsegdown2, outfilptr);
+    if (ugst_io_write (outfilptr, sh_buff, lsegdown2) < 0)
+      HARAKIRI ("Error writing output file\n", 1);
+    nsam += lsegdown2;
   }
 
 
@@ -790,8 +792,9 @@ int main (int argc, char *argv[]) {
   free (sh_buff);
 
   /* Close files */
-  fclose (outfilptr);
-  fclose (inpfilptr);
+  if (ugst_io_close (outfilptr) < 0)
+    HARAKIRI ("Error writing output file\n", 1);
+  ugst_io_close (inpfilptr);
 
 #ifndef VMS
   return (0);
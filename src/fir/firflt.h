@@ -18,6 +18,7 @@
    15.May.07	v2.4+	Added protoype for the [20Hz-20kHz] filter 
 						and the 1.5kHz, 14kHz. 20kHz LP filters	<Ericsson>
    31.Dec.2008  v2.5    Added LP filters (12kHz) for fs=48kHz < huawei >
+   17.Oct.2026  v2.6    Added polyphase kernel engine selection (hq_engine)
 
   ============================================================================
 */
@@ -47,9 +48,33 @@ typedef struct {
   float *h0;                    /* pointer to array with FIR coeff.  */
   float *T;                     /* pointer to delay line */
   char hswitch;                 /* switch to FIR-kernel */
+  char engine;                  /* kernel engine, one of HQ_ENGINE_xxx */
+  float *work;                  /* contiguous history+input buffer (polyphase) */
+  long lwork;                   /* number of floats allocated in work[] */
+  long *offs;                   /* per-tap read offsets into work[] */
 } SCD_FIR;
 
 
+/* 
+ * ..... Kernel engines selectable with hq_engine() .....
+ *
+ * HQ_ENGINE_REFERENCE: original transition/steady-state scalar kernels
+ * HQ_ENGINE_POLYPHASE: polyphase kernel on a contiguous history+input
+ *                      buffer, vectorized across output samples; output
+ *                      is bit-identical to HQ_ENGINE_REFERENCE (default)
+ * HQ_ENGINE_FAST:      as HQ_ENGINE_POLYPHASE, but using fused
+ *                      multiply-add where the CPU provides it; both sums
+ *                      are within g * sum(|h[k]*x[n-k]|) of the exact one,
+ *                      g = lenh0*2^-24 / (1 - lenh0*2^-24), so each output
+ *                      differs from the reference by at most twice that.
+ *                      This is not bounded in LSBs of the 16-bit samples:
+ *                      outputs may convert to different samples
+ */
+#define HQ_ENGINE_REFERENCE 0
+#define HQ_ENGINE_POLYPHASE 1
+#define HQ_ENGINE_FAST      2
+
+
 /* 
  * ..... Global function prototypes ..... 
  */
@@ -89,6 +114,8 @@ SCD_FIR *LP12_48kHz_init ARGS ((void));
 // FILTER_12k48k_HW
 void hq_free ARGS ((SCD_FIR * fir_ptr));
 void hq_reset ARGS ((SCD_FIR * fir_ptr));
+int hq_engine ARGS ((SCD_FIR * fir_ptr, int engine));
+char *hq_engine_name ARGS ((SCD_FIR * fir_ptr));
 
 #endif /* FIRFLT_FIRstruct_defined */
 
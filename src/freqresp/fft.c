@@ -1,4 +1,4 @@
-/*                                                          15.Feb.2010 v1.3 */
+/*                                                          17.Oct.2026 v1.4 */
 /*=============================================================================
 
                           U    U   GGG    SSSS  TTTTT
@@ -32,6 +32,9 @@
                   -nfft : indicates the number of points used in FFT.
   15.Feb.10 v1.3  Modified maximum string length for filename, and
 	                removed some macros (OVERLAP, VAR_NFFT)
+  17.Oct.26 v1.4  Split-radix FFT always used (TUNED_FFT removed), with the
+                  twiddle tables cached per FFT size; the DFT is kept as
+                  rdft() for reference.
 
   AUTHORS :
 	Cyril Guillaume & Stephane Ragot -- stephane.ragot@francetelecom.com
@@ -40,11 +43,12 @@
   yusuke hiwasaki (v1.3) NTT
 */
 
+#include <stdio.h>
+#include <stdlib.h>
 #include <math.h>
 #include "fft.h"
 
 
-#ifndef TUNED_FFT
 /* This routine computes the positive part of the spectrum, using Real Discrete Fourier Transform */
 /*		  int m,		 number of coefficients of the fourier transform 
 		  float *x1,	 input real signal 
@@ -65,30 +69,35 @@ void rdft (int m, float *x1, float *x2, float *y2) {
   }
 }
 
-/* This routine generate a hanning window */
-/*			
-  int n,			number of coeffients of the hanning window 
-  float* hanning	        buffer containing the coefficients of the hanning window 
-*/
-void powSpect (float *real, float *imag, float *pwSpct, int n) {
-  int i;
-  for (i = 0; i < n / 2; i++)
-    pwSpct[i] = (real[i] * real[i] + imag[i] * imag[i]) / n;
-
-}
 
-#else
+/* Twiddle tables of actrdft(), one set per FFT size (2^k points), made on first use */
+#define FFT_LOG2_MAX 30
+static int *DFTip[FFT_LOG2_MAX + 1];
+static float *DFTw[FFT_LOG2_MAX + 1];
 
-int DFTip[128] = { 0 };
-float DFTw[NFFT_MAX >> 1] = { 0 };
+static int fftTables (int n) {
+  int k, nip;
 
+  for (k = 0; (1 << k) < n && k < FFT_LOG2_MAX; k++);
+  if (DFTip[k] == NULL) {
+    for (nip = 1; nip * nip < n / 2; nip++);
+    DFTip[k] = (int *) calloc (nip + 3, sizeof (int));  /* ip[0] = 0: computed by actrdft() */
+    DFTw[k] = (float *) calloc (n / 2 + 1, sizeof (float));
+    if (DFTip[k] == NULL || DFTw[k] == NULL) {
+      fprintf (stderr, "Error allocating memory for the FFT tables\n");
+      exit (-1);
+    }
+  }
+  return k;
+}
 
 
 void powSpect (int n, float *x1, float *x2) {
-  int i, j;
+  int i, j, k;
   float den = (float) (1.0 / (float) n);
-  void actrdft (int n0, int isgn, float *a, int *ip, float *w);
-  actrdft (n, 1, x1, DFTip, DFTw);
+
+  k = fftTables (n);
+  actrdft (n, 1, x1, DFTip[k], DFTw[k]);
   x2[0] = (x1[0] * x1[0]) * den;
 
   for (i = 2, j = 1; i < n; i += 2, j++)
@@ -673,7 +682,6 @@ void actrdft (int n, int isgn, float *a, int *ip, float *w) {
       a[i] *= xi;
   }
 }
-#endif
 
 void genHanning (int n, float *hanning) {
   int i;
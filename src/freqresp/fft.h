@@ -1,4 +1,4 @@
-/*                                                          15.Feb.2010 v1.3 */
+/*                                                          17.Oct.2026 v1.4 */
 /*=============================================================================
 
                           U    U   GGG    SSSS  TTTTT
@@ -32,6 +32,9 @@
                   -nfft : indicates the number of points used in FFT.
   15.Feb.10 v1.3  Modified maximum string length for filename, and
 	                removed some macros (OVERLAP, VAR_NFFT)
+  17.Oct.26 v1.4  Split-radix FFT always used (TUNED_FFT removed), with the
+                  twiddle tables cached per FFT size; the DFT is kept as
+                  rdft() for reference.
 
   AUTHORS :
 	Cyril Guillaume & Stephane Ragot -- stephane.ragot@francetelecom.com
@@ -40,8 +43,6 @@
   yusuke hiwasaki (v1.3) NTT
 */
 
-#define TUNED_FFT
-
 /* Number of points of the FFT */
 #define NFFT_MAX 8192
 #define pi 3.141592654
@@ -51,22 +52,15 @@ void genHanning (int n,         /* number of coeffients of the hanning window */
                  float *hanning /* buffer containing the coefficients of the hanning window */
   );
 
-#ifndef TUNED_FFT
-/* This routine computes the positive part of the spectrum, using Real Discrete Fourier Transform */
+/* This routine computes the positive part of the spectrum, using Real Discrete Fourier Transform (O(m^2), reference only) */
 void rdft (int m,               /* number of coefficients of the fourier transform */
            float *x1,           /* input real signal */
            float *x2,           /* output real part of the DFT */
            float *y2            /* output imaginary part of the DFT */
   );
 
+/* This routine computes the power spectrum (n/2+1 bins, up to fs/2) of the n-point frame x1, using the split-radix FFT; x1 is overwritten */
+void powSpect (int n, float *x1, float *x2);
 
-/* This routine compute the power spectrum of the DFT of a signal */
-void powSpect (float *real,     /* input buffer containing the real part of the DFT */
-               float *imag,     /* input buffer containing the imaginary part of the DFT */
-               float *pws,      /* output buffer containing the power spectrum */
-               int n            /* length of the input buffers */
-  );
-
-#else
-void powSpect (int m, float *x1, float *x2);
-#endif
+/* Split-radix real FFT (isgn=1) and its inverse (isgn=-1, scaled by 2/n); ip[0] must be zero on first use, ip[] needs 2+sqrt(n/2) and w[] n/2 elements */
+void actrdft (int n, int isgn, float *a, int *ip, float *w);
@@ -0,0 +1,333 @@
+/*                                                           17.Oct.2026 v1.0
+  ===========================================================================
+
+  FREQBENCH.C
+  ~~~~~~~~~~~
+
+  Description:
+  ~~~~~~~~~~~~
+
+  Benchmark and check of the spectrum analysis of freqresp. A pseudo-random
+  signal of several minutes is written to a temporary file, and its average
+  power spectrum is computed:
+
+  - with the O(N^2) DFT rdft() (timed over a few frames only, and
+    extrapolated to the whole file);
+  - as freqresp up to v1.3: full frames read from the file, the file pointer
+    being moved back by the overlap after each frame;
+  - in one streaming pass with welch_feed(), with 0%, 50% and 75% overlap,
+    and with Welch averaging (50% overlap).
+
+  The throughput (frames per second of CPU time) and the speed relative to
+  real time are reported.
+
+  With -check, no timing is done and the following is verified:
+  - the power spectrum of powSpect() (split-radix FFT, cached tables) is
+    within a tolerance of the one computed with rdft(), for all sizes from
+    16 to 2048, calling the sizes in an interleaved order;
+  - the streaming analysis gives exactly the same spectrum as the frame
+    by frame analysis of freqresp v1.3, whatever the block lengths, for
+    0%, 50% and 75% overlap;
+  - the Welch average of a white noise is independent of the window.
+
+  Usage:
+  ~~~~~~
+  $ freqbench [-options]
+
+  Options:
+  -sec S ....... length of the signal in seconds [default: 300]
+  -fs fs ....... sampling frequency [default: 16000]
+  -nfft N ...... number of samples in each FFT [default: 2048]
+  -check ....... only check the analysis (no timing), and return a
+                 non-zero exit code if any check fails
+
+  Original author:
+  ~~~~~~~~~~~~~~~~
+  ITU-T STL contributors
+
+  History:
+  ~~~~~~~~
+  17.Oct.2026 v1.0 Created.
+
+  ===========================================================================
+*/
+
+#include "ugstdemo.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "fft.h"
+#include "welch.h"
+#include "ugst-utl.h"
+
+#define BLOCK_LEN 4096
+
+/* Block lengths cycled through when feeding the streaming analysis */
+static long seg_len[] = { 160, 1, 4095, 17, 2048, 2, 641, 8192, 3 };
+
+#define N_SEG (sizeof (seg_len) / sizeof (seg_len[0]))
+
+static long lcg = 12345;
+
+
+/* Pseudo-random signal: noise plus a sweeping tone */
+void gen_signal (short *x, long n, long fs) {
+  long i;
+  double ph = 0;
+
+  for (i = 0; i < n; i++) {
+    lcg = (lcg * 1103515245 + 12345) & 0x7FFFFFFF;
+    ph += 2 * pi * (100 + (i % (10 * fs)) * 0.03) / fs;
+    x[i] = (short) (((lcg >> 16) - 16384) / 4 + 8000 * sin (ph));
+  }
+}
+
+
+/* Spectrum as freqresp v1.3: frame by frame from a file, moving back by the overlap */
+long seek_spectrum (FILE * fp, int nfft, int nb_samples_ov, float *avgPowSp) {
+  static short frame_sh[NFFT_MAX];
+  static float frame[NFFT_MAX], hanning[NFFT_MAX], powSp[NFFT_MAX];
+  long nbFrame = 0;
+  int i;
+
+  genHanning (nfft, hanning);
+  for (i = 0; i < nfft / 2; i++)
+    avgPowSp[i] = 0;
+  rewind (fp);
+  while (fread (frame_sh, sizeof (short), nfft, fp) == (size_t) nfft) {
+    nbFrame++;
+    sh2fl (nfft, frame_sh, frame, 16, 1);
+    for (i = 0; i < nfft; i++)
+      frame[i] = frame[i] * hanning[i];
+    powSpect (nfft, frame, powSp);
+    for (i = 0; i < nfft / 2; i++)
+      avgPowSp[i] = avgPowSp[i] + (powSp[i] - avgPowSp[i]) / nbFrame;
+    fseek (fp, -nb_samples_ov * 2, SEEK_CUR);
+  }
+  return nbFrame;
+}
+
+
+/* Spectrum with the DFT, over the first nmax frames */
+long dft_spectrum (FILE * fp, int nfft, long nmax, float *avgPowSp) {
+  static short frame_sh[NFFT_MAX];
+  static float frame[NFFT_MAX], hanning[NFFT_MAX], re[NFFT_MAX / 2], im[NFFT_MAX / 2];
+  long nbFrame = 0;
+  int i;
+
+  genHanning (nfft, hanning);
+  for (i = 0; i < nfft / 2; i++)
+    avgPowSp[i] = 0;
+  rewind (fp);
+  while (nbFrame < nmax && fread (frame_sh, sizeof (short), nfft, fp) == (size_t) nfft) {
+    nbFrame++;
+    sh2fl (nfft, frame_sh, frame, 16, 1);
+    for (i = 0; i < nfft; i++)
+      frame[i] = frame[i] * hanning[i];
+    rdft (nfft, frame, re, im);
+    for (i = 0; i < nfft / 2; i++)
+      avgPowSp[i] = avgPowSp[i] + ((re[i] * re[i] + im[i] * im[i]) / nfft - avgPowSp[i]) / nbFrame;
+  }
+  return nbFrame;
+}
+
+
+/* Streaming spectrum of a file, read in blocks */
+long stream_spectrum (FILE * fp, int nfft, int nb_samples_ov, int mode, float *avgPowSp) {
+  static short block[BLOCK_LEN];
+  WELCH_STATE *st;
+  long n, nbFrame;
+
+  if ((st = welch_init (nfft, nb_samples_ov, mode)) == NULL)
+    HARAKIRI ("Error allocating memory for the spectrum analysis\n", 3);
+  rewind (fp);
+  while ((n = (long) fread (block, sizeof (short), BLOCK_LEN, fp)) > 0)
+    welch_feed (st, block, n);
+  nbFrame = welch_result (st, avgPowSp);
+  welch_free (st);
+  return nbFrame;
+}
+
+
+/* Streaming spectrum of a buffer, fed in blocks of varying length */
+long stream_buffer (short *x, long n, int nfft, int nb_samples_ov, int mode, float *avgPowSp) {
+  WELCH_STATE *st;
+  long i, k, l, nbFrame;
+
+  if ((st = welch_init (nfft, nb_samples_ov, mode)) == NULL)
+    HARAKIRI ("Error allocating memory for the spectrum analysis\n", 3);
+  for (i = 0, k = 0; i < n; i += l, k++) {
+    l = seg_len[k % N_SEG];
+    if (l > n - i)
+      l = n - i;
+    welch_feed (st, x + i, l);
+  }
+  nbFrame = welch_result (st, avgPowSp);
+  welch_free (st);
+  return nbFrame;
+}
+
+
+/* FFT power spectra against the DFT; returns the number of failures */
+long check_fft () {
+  static int sizes[] = { 2048, 16, 256, 32, 1024, 64, 512, 128, 2048, 16 };
+  static float x[NFFT_MAX], y[NFFT_MAX], p[NFFT_MAX], re[NFFT_MAX / 2], im[NFFT_MAX / 2];
+  float pmax, err, d;
+  long fail = 0;
+  int k, i, n;
+
+  for (k = 0; k < (int) (sizeof (sizes) / sizeof (sizes[0])); k++) {
+    n = sizes[k];
+    for (i = 0; i < n; i++) {
+      lcg = (lcg * 1103515245 + 12345) & 0x7FFFFFFF;
+      x[i] = y[i] = (float) ((lcg >> 15) - 32768) / 32768;
+    }
+    powSpect (n, y, p);
+    rdft (n, x, re, im);
+    for (pmax = 0, err = 0, i = 0; i < n / 2; i++) {
+      d = (re[i] * re[i] + im[i] * im[i]) / n;
+      pmax = d > pmax ? d : pmax;
+      err = (float) fabs (d - p[i]) > err ? (float) fabs (d - p[i]) : err;
+    }
+    if (err > 1e-4 * pmax) {
+      fprintf (stderr, "powSpect(%d) differs from the DFT: max error %g (peak %g)\n", n, err, pmax);
+      fail++;
+    }
+  }
+  return fail;
+}
+
+
+void display_usage () {
+  printf ("FREQBENCH.C - Version 1.0 of 17.Oct.2026\n\n");
+  printf (" Benchmark and check of the spectrum analysis of freqresp.\n\n");
+  printf (" Usage:\n");
+  printf (" $ freqbench [-options]\n\n");
+  printf (" Options:\n");
+  printf ("  -sec S ..... length of the signal in seconds [default: 300]\n");
+  printf ("  -fs fs ..... sampling frequency [default: 16000]\n");
+  printf ("  -nfft N .... number of samples in each FFT [default: 2048]\n");
+  printf ("  -check ..... only check the analysis, no timing\n");
+  exit (-128);
+}
+
+
+int main (int argc, char *argv[]) {
+  static float ref[NFFT_MAX / 2], avg[NFFT_MAX / 2];
+  static int ov_list[] = { 0, 2, 3 };   /* overlap, in quarters of nfft */
+  long fs = 16000, n, nb, nb_ref, i, fail = 0;
+  double sec = 300, cpu, err;
+  int nfft = 2048, check = 0, k, ov, exact;
+  short *x;
+  FILE *fp;
+  clock_t t0;
+
+  /* Get options */
+  while (argc > 1 && argv[1][0] == '-')
+    if (strcmp (argv[1], "-sec") == 0) {
+      sec = atof (argv[2]);
+      argc -= 2;
+      argv += 2;
+    } else if (strcmp (argv[1], "-fs") == 0) {
+      fs = atol (argv[2]);
+      argc -= 2;
+      argv += 2;
+    } else if (strcmp (argv[1], "-nfft") == 0) {
+      nfft = atoi (argv[2]);
+      argc -= 2;
+      argv += 2;
+    } else if (strcmp (argv[1], "-check") == 0) {
+      check = 1;
+      argc--;
+      argv++;
+    } else if (strcmp (argv[1], "-h") == 0 || strcmp (argv[1], "-?") == 0) {
+      display_usage ();
+    } else {
+      fprintf (stderr, "ERROR! Invalid option \"%s\" in command line\n\n", argv[1]);
+      display_usage ();
+    }
+
+  if (nfft < 16 || nfft > NFFT_MAX || (nfft & (nfft - 1)) != 0)
+    HARAKIRI ("nfft must be a power of 2 between 16 and 8192\n", 1);
+  if (check) {
+    sec = 20;
+    nfft = 512;
+  }
+  n = (long) (sec * fs);
+  if (n < 2 * nfft)
+    n = 2 * nfft;
+  if ((x = (short *) malloc (n * sizeof (short))) == NULL)
+    HARAKIRI ("Error allocating memory for the signal\n", 3);
+  gen_signal (x, n, fs);
+  if ((fp = tmpfile ()) == NULL || fwrite (x, sizeof (short), n, fp) != (size_t) n)
+    HARAKIRI ("Error writing the temporary file\n", 2);
+
+  if (check) {
+    fail += check_fft ();
+
+    /* streaming against frame by frame */
+    for (k = 0; k < (int) (sizeof (ov_list) / sizeof (ov_list[0])); k++) {
+      ov = nfft * ov_list[k] / 4;
+      nb_ref = seek_spectrum (fp, nfft, ov, ref);
+      nb = stream_buffer (x, n, nfft, ov, WELCH_RUNNING, avg);
+      exact = nb == nb_ref && memcmp (avg, ref, nfft / 2 * sizeof (float)) == 0;
+      nb = stream_spectrum (fp, nfft, ov, WELCH_RUNNING, avg);
+      exact = exact && nb == nb_ref && memcmp (avg, ref, nfft / 2 * sizeof (float)) == 0;
+      printf ("overlap %3d%%: %ld frames, streaming %s\n", 25 * ov_list[k], nb_ref, exact ? "identical" : "DIFFERS");
+      if (!exact)
+        fail++;
+    }
+
+    /* Welch average of a white noise: about its variance (1/3 for the full scale uniform noise) */
+    for (i = 0; i < n; i++) {
+      lcg = (lcg * 1103515245 + 12345) & 0x7FFFFFFF;
+      x[i] = (short) ((lcg >> 15) - 32768);
+    }
+    stream_buffer (x, n, nfft, nfft / 2, WELCH_AVERAGE, avg);
+    for (err = 0, i = 1; i < nfft / 2; i++)
+      err += avg[i];
+    err = err / (nfft / 2 - 1) * 3;
+    printf ("Welch average of white noise: %.4f of its variance\n", err);
+    if (fabs (err - 1) > 0.02)
+      fail++;
+  } else {
+    printf ("%.0f s at %ld Hz, nfft %d\n\n", (double) n / fs, fs, nfft);
+    printf ("%-22s %10s %12s %10s\n", "analysis", "frames", "[frames/s]", "x realtime");
+
+    /* DFT over a few frames only */
+    t0 = clock ();
+    nb = dft_spectrum (fp, nfft, 4, avg);
+    cpu = (double) (clock () - t0) / CLOCKS_PER_SEC * (n / nfft) / nb;
+    printf ("%-22s %10ld %12.1f %10.2f (estimated)\n", "dft (rdft)", n / nfft, (n / nfft) / (cpu + 1e-9), n / (double) fs / (cpu + 1e-9));
+
+    for (k = 0; k < (int) (sizeof (ov_list) / sizeof (ov_list[0])); k++) {
+      ov = nfft * ov_list[k] / 4;
+      t0 = clock ();
+      nb = seek_spectrum (fp, nfft, ov, ref);
+      cpu = (double) (clock () - t0) / CLOCKS_PER_SEC;
+      printf ("fft, seek, ov %2d%%      %10ld %12.1f %10.2f\n", 25 * ov_list[k], nb, nb / (cpu + 1e-9), n / (double) fs / (cpu + 1e-9));
+
+      t0 = clock ();
+      nb = stream_spectrum (fp, nfft, ov, WELCH_RUNNING, avg);
+      cpu = (double) (clock () - t0) / CLOCKS_PER_SEC;
+      printf ("fft, stream, ov %2d%%    %10ld %12.1f %10.2f\n", 25 * ov_list[k], nb, nb / (cpu + 1e-9), n / (double) fs / (cpu + 1e-9));
+      if (memcmp (avg, ref, nfft / 2 * sizeof (float)) != 0)
+        fail++;
+    }
+
+    t0 = clock ();
+    nb = stream_spectrum (fp, nfft, nfft / 2, WELCH_AVERAGE, avg);
+    cpu = (double) (clock () - t0) / CLOCKS_PER_SEC;
+    printf ("%-22s %10ld %12.1f %10.2f\n", "fft, stream, welch 50%", nb, nb / (cpu + 1e-9), n / (double) fs / (cpu + 1e-9));
+  }
+
+  fclose (fp);
+  free (x);
+
+  if (fail)
+    fprintf (stderr, "%ld check(s) failed\n", fail);
+  return fail ? 1 : 0;
+}
@@ -1,4 +1,4 @@
-/*                                                          15.Feb.2010 v1.3 */
+/*                                                          17.Oct.2026 v1.4 */
 /*=============================================================================
 
                           U    U   GGG    SSSS  TTTTT
@@ -32,6 +32,10 @@
                   -nfft : indicates the number of points used in FFT.
   15.Feb.10 v1.3  Modified maximum string length for filename, and
 	                removed some macros (OVERLAP, VAR_NFFT)
+  17.Oct.26 v1.4  Both files are read in one streaming pass (bounded memory,
+                  no seeking), using the functions in welch.h.
+                  New option:
+                  -welch : Welch averaging (overlap 50% unless -ov is given).
 
   AUTHORS :
 	Cyril Guillaume & Stephane Ragot -- stephane.ragot@francetelecom.com
@@ -47,6 +51,7 @@
 #include <math.h>
 
 #include "fft.h"
+#include "welch.h"
 #include "export.h"
 #include "bmp_utils.h"
 
@@ -58,6 +63,9 @@
 #define max(a,b)    (((a) > (b)) ? (a) : (b))
 #endif
 
+/* Number of samples read at a time from each file */
+#define BLOCK_LEN 4096
+
 static int is_little_endian () {
   /* Hex version of the string ABCD */
   unsigned long tmp = 0x41424344;
@@ -67,7 +75,7 @@ static int is_little_endian () {
 }
 
 static void display_usage () {
-  printf ("FREQRESP.C - Version 1.3 of 15.Feb.2010 \n\n");
+  printf ("FREQRESP.C - Version 1.4 of 17.Oct.2026 \n\n");
 
   printf (" Frequency response measure program\n");
   printf (" This program computes the average power spectrum \n");
@@ -100,21 +108,22 @@ static void display_usage () {
   printf ("                  is 10dB);\n");
   printf ("  -ov    ov ..... ov is the overlap (%c) between two consecutive frames for\n", '%');
   printf ("                  computing the average power spectrum (default is 0%c);\n", '%');
-  printf ("  -nfft  nfft ... nfft is the number of samples in each FFT (default is 2048).\n\n");
+  printf ("  -nfft  nfft ... nfft is the number of samples in each FFT (default is 2048);\n");
+  printf ("  -welch ........ Welch averaging: the sum of the power spectra is normalized\n");
+  printf ("                  by the number of frames and the power of the window\n");
+  printf ("                  (default overlap is then 0.5).\n\n");
 }
 
 int main (int argc, char *argv[]) {
   /* .... DECLARATIONS ..... */
   /* buffers */
-  float frame[NFFT_MAX];        /* Frame of the input signal (float format) */
-  short frame_sh[NFFT_MAX];     /* Frame of the input signal (short format) */
-  float hanning[NFFT_MAX];      /* hanning window */
-  float powSp[NFFT_MAX];        /* Power spectrum of a frame */
+  short block[BLOCK_LEN];       /* Block of the input signal (short format) */
   float avg1PowSp[NFFT_MAX / 2];        /* Average Power spectrum vector for the first input file */
   float avg2PowSp[NFFT_MAX / 2];        /* Average Power spectrum vector for the second input file */
+  WELCH_STATE *st1, *st2;       /* spectrum analysis of each file */
 
   /* file variables */
-  FILE *fp;                     /* file pointer */
+  FILE *fp1, *fp2;              /* file pointers */
   char in1FileName[MAX_STRLEN]; /* name of the first input file (input of the codec) */
   char in2FileName[MAX_STRLEN]; /* name of the second input file (output of the codec) */
   char asciiFileName[MAX_STRLEN];       /* name of the output ASCII file */
@@ -126,8 +135,7 @@ int main (int argc, char *argv[]) {
   long fs = 16000;              /* sampling frequency */
   int little_endian;            /* flag =1 if little-endian, else =0 */
   int i, j;
-  int nbread;
-  long nbFrame = 0;
+  long nbread1, nbread2;
   int bmp_mode = 0;
   int border = 40;
   int im_wdth = nfft / 2 + border;
@@ -138,8 +146,9 @@ int main (int argc, char *argv[]) {
   float pmax = 0, pmin = -80;
   long fmax = fs / 2, fmin = 0;
   char *image;
-  float ov = 0;
+  float ov = -1;
   int nb_samples_ov = 0;
+  int mode = WELCH_RUNNING;
 
 
 
@@ -228,8 +237,6 @@ int main (int argc, char *argv[]) {
         if ((ov < 0) || (ov >= 1)) {
           fprintf (stderr, "ERROR! Bad overlap parameter.\n\n");
           exit (-1);
-        } else {
-          nb_samples_ov = (int) (ov * nfft);
         }
 
         /* Move arg{c,v} over the option to the next argument */
@@ -246,10 +253,16 @@ int main (int argc, char *argv[]) {
         /* 1064x851 was the original size (with nfft=2048), for lower nfft values, it is better to keep these dimensions for better visual quality. */
         im_wdth = max (nfft / 2 + border, 1064);
         im_hght = (int) (max ((nfft / 2 + border) / 1.25, 851));
-        nb_samples_ov = (int) (ov * nfft);
         /* Move arg{c,v} over the option to the next argument */
         argc -= 2;
         argv += 2;
+      } else if (strcmp (argv[1], "-welch") == 0) {
+        /* Welch averaging */
+        mode = WELCH_AVERAGE;
+
+        /* Move arg{c,v} over the option to the next argument */
+        argc--;
+        argv++;
       } else {
         fprintf (stderr, "ERROR! Invalid option \"%s\" in command line\n\n", argv[1]);
         display_usage ();
@@ -265,101 +278,51 @@ int main (int argc, char *argv[]) {
 
 
   /* ..... INITIALIZATIONS ..... */
-  /* initialize the average power spectrum vector */
-  for (i = 0; i < nfft / 2; i++) {
-    avg1PowSp[i] = 0;
-    avg2PowSp[i] = 0;
+  /* overlap between consecutive frames */
+  if (ov < 0)
+    ov = (mode == WELCH_AVERAGE) ? (float) 0.5 : 0;
+  nb_samples_ov = (int) (ov * nfft);
+
+  /* state of the spectrum analysis of each file */
+  st1 = welch_init (nfft, nb_samples_ov, mode);
+  st2 = welch_init (nfft, nb_samples_ov, mode);
+  if (st1 == NULL || st2 == NULL) {
+    fprintf (stderr, "Error allocating memory for the spectrum analysis\n");
+    exit (-1);
   }
 
-  /* generate a hanning window with nfft coefficients */
-  genHanning (nfft, hanning);
-
 
   /* ..... PROCESSING ..... */
 
-  /* ..... First File ..... */
-  /* open first input file */
-  fp = fopen (in1FileName, "rb");
-  if (fp == NULL) {
+  /* open input files */
+  fp1 = fopen (in1FileName, "rb");
+  if (fp1 == NULL) {
     fprintf (stderr, "Error: Can't open input file %s", in1FileName);
     exit (-1);
   }
-
-  /* loop over first input file */
-  while ((nbread = fread (frame_sh, sizeof (short), nfft, fp)) == nfft) {
-    /* increment the number of processed frames */
-    nbFrame++;
-
-    /* convert short format input, into 16 bit float */
-    sh2fl (nfft, frame_sh, frame, 16, 1);
-
-    /* Hanning Windowing */
-    for (i = 0; i < nfft; i++) {
-      frame[i] = frame[i] * hanning[i];
-    }
-
-#ifndef TUNED_FFT
-    /* Real Discret Fourier Transform */
-    rdft (nfft, frame, real, imag);
-    /* Power spectrum computation */
-    powSpect (real, imag, powSp, nfft);
-#else
-    powSpect (nfft, frame, powSp);
-#endif
-
-    /* average power spectrum computation */
-    for (i = 0; i < nfft / 2; i++) {
-      avg1PowSp[i] = avg1PowSp[i] + (powSp[i] - avg1PowSp[i]) / nbFrame;
-    }
-
-    /* For overlapping, reposition the file pointer nb_samples_ov samples before its current position */
-    fseek (fp, -nb_samples_ov * 2, SEEK_CUR);
-  }
-  /* close input file */
-  fclose (fp);
-
-
-  /* ..... Second File ..... */
-
-  /* open second input file */
-  fp = fopen (in2FileName, "rb");
-  if (fp == NULL) {
+  fp2 = fopen (in2FileName, "rb");
+  if (fp2 == NULL) {
     fprintf (stderr, "Error: Can't open input file %s", in2FileName);
     exit (-1);
   }
 
-  nbFrame = 0;
-  /* loop over first input file */
-  while ((nbread = fread (frame_sh, sizeof (short), nfft, fp)) == nfft) {
-    /* increment the number of processed frames */
-    nbFrame++;
-
-    /* convert short format input, into 16 bit float */
-    sh2fl (nfft, frame_sh, frame, 16, 1);
-
-    /* Hanning Windowing */
-    for (i = 0; i < nfft; i++) {
-      frame[i] = frame[i] * hanning[i];
-    }
-#ifndef TUNED_FFT
-    /* Real Discret Fourier Transform */
-    rdft (nfft, frame, real, imag);
-    /* Power spectrum computation */
-    powSpect (real, imag, powSp, nfft);
-#else
-    powSpect (nfft, frame, powSp);
-#endif
-
-    /* average power spectrum computation */
-    for (i = 0; i < nfft / 2; i++) {
-      avg2PowSp[i] = avg2PowSp[i] + (powSp[i] - avg2PowSp[i]) / nbFrame;
-    }
-
-    /* For overlapping, reposition the file pointer nb_samples_ov samples before its current position */
-    fseek (fp, -nb_samples_ov * 2, SEEK_CUR);
-  }
-  /* close input file */
-  fclose (fp);
+  /* loop over both input files, block by block */
+  do {
+    nbread1 = (long) fread (block, sizeof (short), BLOCK_LEN, fp1);
+    welch_feed (st1, block, nbread1);
+    nbread2 = (long) fread (block, sizeof (short), BLOCK_LEN, fp2);
+    welch_feed (st2, block, nbread2);
+  } while (nbread1 > 0 || nbread2 > 0);
+
+  /* close input files */
+  fclose (fp1);
+  fclose (fp2);
+
+  /* average power spectra */
+  welch_result (st1, avg1PowSp);
+  welch_result (st2, avg2PowSp);
+  welch_free (st1);
+  welch_free (st2);
 
 
   /* .... Save Average Power Spectrum .... */
@@ -0,0 +1,147 @@
+/*                                                          17.Oct.2026 v1.0 */
+/*=============================================================================
+
+                          U    U   GGG    SSSS  TTTTT
+                          U    U  G       S       T
+                          U    U  G  GG   SSSS    T
+                          U    U  G   G       S   T
+                           UUU     GG     SSS     T
+
+                   ========================================
+                    ITU-T - USER'S GROUP ON SOFTWARE TOOLS
+                   ========================================
+
+       =============================================================
+       COPYRIGHT NOTE: This source code, and all of its derivations,
+       is subject to the "ITU-T General Public License". Please have
+       it  read  in    the  distribution  disk,   or  in  the  ITU-T
+       Recommendation G.191 on "SOFTWARE TOOLS FOR SPEECH AND  AUDIO
+       CODING STANDARDS".
+       =============================================================
+
+  DESCRIPTION :
+	Streaming computation of the average power spectrum of a signal, with
+  overlapping Hanning-windowed frames (see welch.h).
+
+  HISTORY :
+	17.Oct.26 v1.0  Created.
+
+  AUTHORS :
+	ITU-T STL contributors
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fft.h"
+#include "welch.h"
+
+/* UGST modules */
+#include "ugstdemo.h"
+#include "ugst-utl.h"
+
+
+WELCH_STATE *welch_init (int nfft, int nb_samples_ov, int mode) {
+  WELCH_STATE *st;
+  int i;
+
+  if (nb_samples_ov < 0 || nb_samples_ov >= nfft)
+    return NULL;
+  if ((st = (WELCH_STATE *) calloc (1, sizeof (WELCH_STATE))) == NULL)
+    return NULL;
+  st->nfft = nfft;
+  st->hop = nfft - nb_samples_ov;
+  st->mode = mode;
+  st->buf = (short *) calloc (nfft, sizeof (short));
+  st->hanning = (float *) calloc (nfft, sizeof (float));
+  st->frame = (float *) calloc (nfft, sizeof (float));
+  st->powSp = (float *) calloc (nfft / 2 + 1, sizeof (float));
+  st->avgPowSp = (float *) calloc (nfft / 2, sizeof (float));
+  st->sumPowSp = (double *) calloc (nfft / 2, sizeof (double));
+  if (st->buf == NULL || st->hanning == NULL || st->frame == NULL || st->powSp == NULL || st->avgPowSp == NULL || st->sumPowSp == NULL) {
+    welch_free (st);
+    return NULL;
+  }
+
+  /* generate a hanning window with nfft coefficients, and its power */
+  genHanning (nfft, st->hanning);
+  for (st->winPow = 0, i = 0; i < nfft; i++)
+    st->winPow += (double) st->hanning[i] * st->hanning[i];
+  st->winPow /= nfft;
+
+  return st;
+}
+
+
+/* Analyse the frame in st->buf */
+static void welch_frame (WELCH_STATE * st) {
+  int i, n2 = st->nfft / 2;
+
+  /* increment the number of processed frames */
+  st->nbFrame++;
+
+  /* convert short format input, into 16 bit float */
+  sh2fl (st->nfft, st->buf, st->frame, 16, 1);
+
+  /* Hanning Windowing */
+  for (i = 0; i < st->nfft; i++)
+    st->frame[i] = st->frame[i] * st->hanning[i];
+
+  powSpect (st->nfft, st->frame, st->powSp);
+
+  /* average power spectrum computation */
+  if (st->mode == WELCH_AVERAGE)
+    for (i = 0; i < n2; i++)
+      st->sumPowSp[i] += st->powSp[i];
+  else
+    for (i = 0; i < n2; i++)
+      st->avgPowSp[i] = st->avgPowSp[i] + (st->powSp[i] - st->avgPowSp[i]) / st->nbFrame;
+}
+
+
+void welch_feed (WELCH_STATE * st, short *x, long n) {
+  long l;
+
+  while (n > 0) {
+    l = st->nfft - st->fill;
+    if (l > n)
+      l = n;
+    memcpy (st->buf + st->fill, x, l * sizeof (short));
+    st->fill += (int) l;
+    x += l;
+    n -= l;
+
+    if (st->fill == st->nfft) {
+      welch_frame (st);
+      /* keep the overlapping part for the next frame */
+      st->fill = st->nfft - st->hop;
+      memmove (st->buf, st->buf + st->hop, st->fill * sizeof (short));
+    }
+  }
+}
+
+
+long welch_result (WELCH_STATE * st, float *avgPowSp) {
+  int i;
+
+  if (st->mode == WELCH_AVERAGE)
+    for (i = 0; i < st->nfft / 2; i++)
+      avgPowSp[i] = st->nbFrame ? (float) (st->sumPowSp[i] / (st->nbFrame * st->winPow)) : 0;
+  else
+    memcpy (avgPowSp, st->avgPowSp, st->nfft / 2 * sizeof (float));
+  return st->nbFrame;
+}
+
+
+void welch_free (WELCH_STATE * st) {
+  if (st == NULL)
+    return;
+  free (st->buf);
+  free (st->hanning);
+  free (st->frame);
+  free (st->powSp);
+  free (st->avgPowSp);
+  free (st->sumPowSp);
+  free (st);
+}
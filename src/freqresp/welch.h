@@ -0,0 +1,78 @@
+/*                                                          17.Oct.2026 v1.0 */
+/*=============================================================================
+
+                          U    U   GGG    SSSS  TTTTT
+                          U    U  G       S       T
+                          U    U  G  GG   SSSS    T
+                          U    U  G   G       S   T
+                           UUU     GG     SSS     T
+
+                   ========================================
+                    ITU-T - USER'S GROUP ON SOFTWARE TOOLS
+                   ========================================
+
+       =============================================================
+       COPYRIGHT NOTE: This source code, and all of its derivations,
+       is subject to the "ITU-T General Public License". Please have
+       it  read  in    the  distribution  disk,   or  in  the  ITU-T
+       Recommendation G.191 on "SOFTWARE TOOLS FOR SPEECH AND  AUDIO
+       CODING STANDARDS".
+       =============================================================
+
+  DESCRIPTION :
+	Streaming computation of the average power spectrum of a signal, with
+  overlapping Hanning-windowed frames. The samples are given in blocks of
+  any length, and only the last nfft samples are kept, so that files of any
+  length can be analysed in one pass with bounded memory.
+
+  Two averaging modes are available:
+  - WELCH_RUNNING: running mean of the frame power spectra, as computed by
+    freqresp up to v1.3 (identical results);
+  - WELCH_AVERAGE: Welch averaging, i.e. sum of the frame power spectra in
+    double precision, normalized by the number of frames and by the power
+    of the window, so that the level does not depend on the window.
+
+  HISTORY :
+	17.Oct.26 v1.0  Created.
+
+  AUTHORS :
+	ITU-T STL contributors
+*/
+
+#define WELCH_RUNNING 0
+#define WELCH_AVERAGE 1
+
+typedef struct {
+  int nfft;                     /* number of samples in each FFT */
+  int hop;                      /* number of samples between two frames */
+  int mode;                     /* WELCH_RUNNING or WELCH_AVERAGE */
+  int fill;                     /* number of samples in buf */
+  long nbFrame;                 /* number of processed frames */
+  short *buf;                   /* last samples of the signal (nfft) */
+  float *hanning;               /* hanning window (nfft) */
+  float *frame;                 /* windowed frame (nfft) */
+  float *powSp;                 /* power spectrum of a frame (nfft/2+1) */
+  float *avgPowSp;              /* running mean (nfft/2) */
+  double *sumPowSp;             /* sum for the Welch average (nfft/2) */
+  double winPow;                /* mean square of the window */
+} WELCH_STATE;
+
+/* This routine allocates and initializes the state for nfft-point frames overlapping by nb_samples_ov samples */
+WELCH_STATE *welch_init (int nfft,      /* number of samples in each FFT (power of 2) */
+                         int nb_samples_ov,     /* number of samples shared by consecutive frames (0..nfft-1) */
+                         int mode       /* WELCH_RUNNING or WELCH_AVERAGE */
+  );
+
+/* This routine adds n samples of the signal; every complete frame is analysed */
+void welch_feed (WELCH_STATE * st,      /* state */
+                 short *x,      /* input samples */
+                 long n         /* number of samples */
+  );
+
+/* This routine returns the average power spectrum of the frames processed so far (nfft/2 values) */
+long welch_result (WELCH_STATE * st,    /* state */
+                   float *avgPowSp      /* output average power spectrum */
+  );
+
+/* This routine releases the state */
+void welch_free (WELCH_STATE * st);
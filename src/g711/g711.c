@@ -1,4 +1,4 @@
-/*                                                 Version 3.01 - 31.Jan.2000
+/*                                                 Version 3.02 - 17.Oct.2026
 =============================================================================
 
                           U    U   GGG    SSS  TTTTT
@@ -54,6 +54,12 @@ ulaw_expand: ..... expands 1 vector of u-law samples to linear PCM
                    use 8 Least Sig. Bits (LSBs) from input and
                    14 Most Sig.Bits (MSBs) on output.
 
+g711_engine: ..... selects the implementation used by the four functions
+                   above (reference, table-driven or SIMD); all of them
+                   give identical results.
+
+g711_engine_name:  name of the implementation in use.
+
 PROTOTYPES: in g711.h
 
 HISTORY:
@@ -64,6 +70,13 @@ Apr/91       1.0   First version of the G711 module
 08/Feb/1992  3.0   Demo as separate file;
 31/Jan/2000  3.01  Updated documentation text; no change in functions
                    <simao.campos@labs.comsat.com>
+17/Oct/2026  3.02  Added table-driven and SIMD (AVX2) implementations,
+                   selected by g711_engine(); bit-exact with the original
+                   functions, which remain available as the reference.
+17/Oct/2026  3.03  Tables of the table-driven engine made constant
+                   (g711tab.h, generated by g711tab.c), removing the lazy
+                   initialisation on the first call, which raced when
+                   the module was first used from several threads.
 =============================================================================
 */
 
@@ -74,6 +87,52 @@ Apr/91       1.0   First version of the G711 module
 /* Global prototype functions */
 #include "g711.h"
 
+/* SIMD instruction sets usable by the SIMD engine; AVX2 is compiled with
+   target attributes and selected by cpuid */
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && !defined(__INTEL_COMPILER)
+#define G711_HAVE_AVX2
+#include <immintrin.h>
+#endif
+
+/* Engine used when g711_engine() has not been called */
+#ifndef G711_DEFAULT_ENGINE
+#define G711_DEFAULT_ENGINE G711_ENGINE_TABLE
+#endif
+
+/*
+ *	.......... L O C A L   D A T A ..........
+ */
+
+/* Selected engine; only written by g711_engine() */
+static int g711_eng = G711_DEFAULT_ENGINE;
+
+/* SIMD engine usable on this CPU (tested where it is dispatched, so that
+   no state has to be initialised on the first call) */
+#ifdef G711_HAVE_AVX2
+#define G711_SIMD_OK (__builtin_cpu_supports ("avx2"))
+#else
+#define G711_SIMD_OK 0
+#endif
+
+/* Constant tables of the table-driven engine, generated by g711tab.c from
+   the reference functions */
+#include "g711tab.h"
+
+static void alaw_compress_ref ARGS ((long lseg, short *linbuf, short *logbuf));
+static void alaw_expand_ref ARGS ((long lseg, short *logbuf, short *linbuf));
+static void ulaw_compress_ref ARGS ((long lseg, short *linbuf, short *logbuf));
+static void ulaw_expand_ref ARGS ((long lseg, short *logbuf, short *linbuf));
+static void alaw_compress_table ARGS ((long lseg, short *linbuf, short *logbuf));
+static void alaw_expand_table ARGS ((long lseg, short *logbuf, short *linbuf));
+static void ulaw_compress_table ARGS ((long lseg, short *linbuf, short *logbuf));
+static void ulaw_expand_table ARGS ((long lseg, short *logbuf, short *linbuf));
+#ifdef G711_HAVE_AVX2
+static void alaw_compress_avx2 ARGS ((long lseg, short *linbuf, short *logbuf));
+static void alaw_expand_avx2 ARGS ((long lseg, short *logbuf, short *linbuf));
+static void ulaw_compress_avx2 ARGS ((long lseg, short *linbuf, short *logbuf));
+static void ulaw_expand_avx2 ARGS ((long lseg, short *logbuf, short *linbuf));
+#endif
+
 /*
  *	.......... F U N C T I O N S ..........
  */
@@ -99,10 +158,12 @@ Apr/91       1.0   First version of the G711 module
 
    HISTORY:
    10.Dec.91	1.0	Separated A-law compression function
+   17.Oct.26	1.1	Dispatch to the engine selected by g711_engine()
 
   ==========================================================================
 */
-void alaw_compress (long lseg, short *linbuf, short *logbuf) {
+/* Reference implementation; also used to build the tables */
+static void alaw_compress_ref (long lseg, short *linbuf, short *logbuf) {
   short ix, iexp;
   long n;
 
@@ -129,6 +190,19 @@ void alaw_compress (long lseg, short *linbuf, short *logbuf) {
   }
 }
 
+void alaw_compress (long lseg, short *linbuf, short *logbuf) {
+#ifdef G711_HAVE_AVX2
+  if (g711_eng == G711_ENGINE_SIMD && G711_SIMD_OK) {
+    alaw_compress_avx2 (lseg, linbuf, logbuf);
+    return;
+  }
+#endif
+  if (g711_eng == G711_ENGINE_REFERENCE)
+    alaw_compress_ref (lseg, linbuf, logbuf);
+  else
+    alaw_compress_table (lseg, linbuf, logbuf);
+}
+
 /* ................... End of alaw_compress() ..................... */
 
 
@@ -152,10 +226,12 @@ void alaw_compress (long lseg, short *linbuf, short *logbuf) {
 
    HISTORY:
    10.Dec.91	1.0	Separated A-law expansion function
+   17.Oct.26	1.1	Dispatch to the engine selected by g711_engine()
 
   ============================================================================
 */
-void alaw_expand (long lseg, short *logbuf, short *linbuf) {
+/* Reference implementation; also used to build the tables */
+static void alaw_expand_ref (long lseg, short *logbuf, short *linbuf) {
   short ix, mant, iexp;
   long n;
 
@@ -178,6 +254,19 @@ void alaw_expand (long lseg, short *logbuf, short *linbuf) {
   }
 }
 
+void alaw_expand (long lseg, short *logbuf, short *linbuf) {
+#ifdef G711_HAVE_AVX2
+  if (g711_eng == G711_ENGINE_SIMD && G711_SIMD_OK) {
+    alaw_expand_avx2 (lseg, logbuf, linbuf);
+    return;
+  }
+#endif
+  if (g711_eng == G711_ENGINE_REFERENCE)
+    alaw_expand_ref (lseg, logbuf, linbuf);
+  else
+    alaw_expand_table (lseg, logbuf, linbuf);
+}
+
 /* ................... End of alaw_expand() ..................... */
 
 
@@ -202,10 +291,12 @@ void alaw_expand (long lseg, short *logbuf, short *linbuf) {
 
    HISTORY:
    10.Dec.91	1.0	Separated mu-law compression function
+   17.Oct.26	1.1	Dispatch to the engine selected by g711_engine()
 
   ==========================================================================
 */
-void ulaw_compress (long lseg, short *linbuf, short *logbuf) {
+/* Reference implementation; also used to build the tables */
+static void ulaw_compress_ref (long lseg, short *linbuf, short *logbuf) {
   long n;                       /* samples's count */
   short i;                      /* aux.var. */
   short absno;                  /* absolute value of linear (input) sample */
@@ -251,6 +342,19 @@ void ulaw_compress (long lseg, short *linbuf, short *logbuf) {
   }
 }
 
+void ulaw_compress (long lseg, short *linbuf, short *logbuf) {
+#ifdef G711_HAVE_AVX2
+  if (g711_eng == G711_ENGINE_SIMD && G711_SIMD_OK) {
+    ulaw_compress_avx2 (lseg, linbuf, logbuf);
+    return;
+  }
+#endif
+  if (g711_eng == G711_ENGINE_REFERENCE)
+    ulaw_compress_ref (lseg, linbuf, logbuf);
+  else
+    ulaw_compress_table (lseg, linbuf, logbuf);
+}
+
 /* ................... End of ulaw_compress() ..................... */
 
 
@@ -275,11 +379,13 @@ void ulaw_compress (long lseg, short *linbuf, short *logbuf) {
 
    HISTORY:
    10.Dec.91	1.0	Separated mu law expansion function
+   17.Oct.26	1.1	Dispatch to the engine selected by g711_engine()
 
   ============================================================================
 */
 
-void ulaw_expand (long lseg, short *logbuf, short *linbuf) {
+/* Reference implementation; also used to build the tables */
+static void ulaw_expand_ref (long lseg, short *logbuf, short *linbuf) {
   long n;                       /* aux.var. */
   short segment;                /* segment (Table 2/G711, column 1) */
   short mantissa;               /* low nibble of log companded sample */
@@ -306,4 +412,279 @@ void ulaw_expand (long lseg, short *logbuf, short *linbuf) {
   }
 }
 
+void ulaw_expand (long lseg, short *logbuf, short *linbuf) {
+#ifdef G711_HAVE_AVX2
+  if (g711_eng == G711_ENGINE_SIMD && G711_SIMD_OK) {
+    ulaw_expand_avx2 (lseg, logbuf, linbuf);
+    return;
+  }
+#endif
+  if (g711_eng == G711_ENGINE_REFERENCE)
+    ulaw_expand_ref (lseg, logbuf, linbuf);
+  else
+    ulaw_expand_table (lseg, logbuf, linbuf);
+}
+
 /* ................... End of ulaw_expand() ..................... */
+
+
+/* ................... Begin of g711_engine() ..................... */
+/*
+  ==========================================================================
+
+   FUNCTION NAME: g711_engine
+
+   DESCRIPTION: Select the implementation used by alaw_compress(),
+                alaw_expand(), ulaw_compress() and ulaw_expand():
+
+                G711_ENGINE_REFERENCE ... original per-sample functions
+                G711_ENGINE_TABLE ....... table look-up: 256-entry tables
+                                          for the expansion, tables indexed
+                                          by the 12 (A-law) or 14 (u-law)
+                                          MSBs of the sample for the
+                                          compression
+                G711_ENGINE_SIMD ........ vector kernels (AVX2) for the
+                                          bulk of the buffer, the table
+                                          engine for the remaining samples;
+                                          same as G711_ENGINE_TABLE when
+                                          the CPU has no AVX2
+
+                All engines give identical results for any input. Unless
+                this function is called, the engine G711_DEFAULT_ENGINE
+                is used: G711_ENGINE_TABLE, unless defined otherwise at
+                compile time (the SIMD kernels are only faster than the
+                tables in optimized builds). The tables are constant
+                (g711tab.h) and the engine needs no initialisation, so
+                the module may be used from several threads; the
+                selection is global to the module, though, and should be
+                made before starting threads that use it.
+
+   PROTOTYPE: int g711_engine(int engine)
+
+   PARAMETERS:
+     engine:	(In)  one of G711_ENGINE_xxx
+
+   RETURN VALUE: the engine now in use (G711_ENGINE_TABLE when
+                 G711_ENGINE_SIMD is not available), or -1 if engine is
+                 invalid (in which case the selection is left unchanged).
+
+   HISTORY:
+   17.Oct.26	1.0	Created
+   17.Oct.26	1.1	Constant tables, no lazy initialisation
+
+  ==========================================================================
+*/
+int g711_engine (int engine) {
+  if (engine != G711_ENGINE_REFERENCE && engine != G711_ENGINE_TABLE && engine != G711_ENGINE_SIMD)
+    return -1;
+
+  g711_eng = engine;
+  return engine == G711_ENGINE_SIMD && !G711_SIMD_OK ? G711_ENGINE_TABLE : engine;
+}
+
+/* ................... End of g711_engine() ..................... */
+
+
+/* ................... Begin of g711_engine_name() ..................... */
+/*
+  ==========================================================================
+
+   FUNCTION NAME: g711_engine_name
+
+   DESCRIPTION: Name of the engine in use (see g711_engine()), e.g.
+                "reference", "table" or "simd/avx2".
+
+   PROTOTYPE: char *g711_engine_name(void)
+
+   RETURN VALUE: pointer to a static string.
+
+   HISTORY:
+   17.Oct.26	1.0	Created
+
+  ==========================================================================
+*/
+char *g711_engine_name (void) {
+  if (g711_eng == G711_ENGINE_SIMD && G711_SIMD_OK)
+    return "simd/avx2";
+  return g711_eng == G711_ENGINE_REFERENCE ? "reference" : "table";
+}
+
+/* ................... End of g711_engine_name() ..................... */
+
+
+/*
+ *	.......... T A B L E - D R I V E N   E N G I N E ..........
+ *
+ * The compression output only depends on the sample shifted right by 4
+ * (A-law) or 2 (u-law) bits, so the tables are indexed by these bits.
+ * Log samples outside 0..255 are passed to the reference functions, which
+ * define the result for them.
+ */
+static void alaw_compress_table (long lseg, short *linbuf, short *logbuf) {
+  long n;
+
+  for (n = 0; n < lseg; n++)
+    logbuf[n] = alaw_comp_tab[(unsigned short) linbuf[n] >> 4];
+}
+
+static void ulaw_compress_table (long lseg, short *linbuf, short *logbuf) {
+  long n;
+
+  for (n = 0; n < lseg; n++)
+    logbuf[n] = ulaw_comp_tab[(unsigned short) linbuf[n] >> 2];
+}
+
+static void alaw_expand_table (long lseg, short *logbuf, short *linbuf) {
+  long n;
+
+  for (n = 0; n < lseg; n++)
+    if ((unsigned short) logbuf[n] < 256)
+      linbuf[n] = alaw_exp_tab[logbuf[n]];
+    else
+      alaw_expand_ref (1, logbuf + n, linbuf + n);
+}
+
+static void ulaw_expand_table (long lseg, short *logbuf, short *linbuf) {
+  long n;
+
+  for (n = 0; n < lseg; n++)
+    if ((unsigned short) logbuf[n] < 256)
+      linbuf[n] = ulaw_exp_tab[logbuf[n]];
+    else
+      ulaw_expand_ref (1, logbuf + n, linbuf + n);
+}
+
+
+/*
+ *	.......... S I M D   E N G I N E ..........
+ *
+ * 16 samples per iteration, in the 16-bit lanes of an AVX2 register, with
+ * the same operations as the reference functions and no branches: the
+ * exponent (segment) is counted with comparisons, and the variable shifts
+ * are multiplications by a power of 2 taken from a byte table (vpshufb).
+ * The results are exact for any 16-bit input. The last lseg % 16 samples
+ * are processed by the table engine.
+ */
+#ifdef G711_HAVE_AVX2
+
+/* Powers of 2 selected by the lanes of idx (0..15): byte idx of tab,
+   zero-extended to 16 bits */
+#define G711_POW2(tab, idx) \
+  _mm256_shuffle_epi8 (tab, _mm256_or_si256 (idx, _mm256_set1_epi16 ((short) 0x8000)))
+
+#define G711_BYTES(b0, b1, b2, b3, b4, b5, b6, b7, b8) \
+  _mm256_setr_epi8 (b0, b1, b2, b3, b4, b5, b6, b7, b8, 0, 0, 0, 0, 0, 0, 0, \
+                    b0, b1, b2, b3, b4, b5, b6, b7, b8, 0, 0, 0, 0, 0, 0, 0)
+
+/* Count of the thresholds t, 2t+1, 4t+3, ... (7 of them) exceeded by x */
+__attribute__ ((target ("avx2")))
+static __m256i g711_count_avx2 (__m256i x, short t) {
+  __m256i n = _mm256_setzero_si256 ();
+  int k;
+
+  for (k = 0; k < 7; k++, t = 2 * t + 1)
+    n = _mm256_sub_epi16 (n, _mm256_cmpgt_epi16 (x, _mm256_set1_epi16 (t)));
+  return n;
+}
+
+__attribute__ ((target ("avx2")))
+static __m256i alaw_compress_lanes (__m256i x) {
+  __m256i s, ix, iexp, mant;
+
+  s = _mm256_srai_epi16 (x, 15);        /* -1 for negative samples */
+  ix = _mm256_xor_si256 (_mm256_srai_epi16 (x, 4), s);  /* 0 <= ix < 2048 */
+  iexp = g711_count_avx2 (ix, 15);
+  /* mantissa: (ix >> (iexp - 1)) & 15, as ((ix << (7 - iexp)) >> 6) & 15 */
+  mant = _mm256_mullo_epi16 (ix, G711_POW2 (G711_BYTES (64, 32, 16, 8, 4, 2, 1, 0, 0), _mm256_subs_epu16 (iexp, _mm256_set1_epi16 (1))));
+  mant = _mm256_and_si256 (_mm256_srli_epi16 (mant, 6), _mm256_set1_epi16 (15));
+  ix = _mm256_add_epi16 (mant, _mm256_slli_epi16 (iexp, 4));
+  ix = _mm256_or_si256 (ix, _mm256_andnot_si256 (s, _mm256_set1_epi16 (0x80)));
+  return _mm256_xor_si256 (ix, _mm256_set1_epi16 (0x55));
+}
+
+__attribute__ ((target ("avx2")))
+static __m256i ulaw_compress_lanes (__m256i x) {
+  __m256i s, absno, segno, low;
+
+  s = _mm256_srai_epi16 (x, 15);
+  absno = _mm256_add_epi16 (_mm256_xor_si256 (_mm256_srai_epi16 (x, 2), s), _mm256_set1_epi16 (33));
+  absno = _mm256_min_epi16 (absno, _mm256_set1_epi16 (0x1FFF));
+  segno = _mm256_add_epi16 (g711_count_avx2 (absno, 63), _mm256_set1_epi16 (1));
+  /* low nibble: (absno >> segno) & 15, as ((absno << (8 - segno)) >> 8) & 15 */
+  low = _mm256_mullo_epi16 (absno, G711_POW2 (G711_BYTES (0, (char) 128, 64, 32, 16, 8, 4, 2, 1), segno));
+  low = _mm256_and_si256 (_mm256_srli_epi16 (low, 8), _mm256_set1_epi16 (15));
+  low = _mm256_sub_epi16 (_mm256_set1_epi16 (15), low);
+  low = _mm256_or_si256 (low, _mm256_slli_epi16 (_mm256_sub_epi16 (_mm256_set1_epi16 (8), segno), 4));
+  return _mm256_or_si256 (low, _mm256_andnot_si256 (s, _mm256_set1_epi16 (0x80)));
+}
+
+__attribute__ ((target ("avx2")))
+static __m256i alaw_expand_lanes (__m256i x) {
+  __m256i ix, iexp, mant;
+
+  ix = _mm256_and_si256 (_mm256_xor_si256 (x, _mm256_set1_epi16 (0x55)), _mm256_set1_epi16 (0x7F));
+  iexp = _mm256_srli_epi16 (ix, 4);
+  mant = _mm256_and_si256 (ix, _mm256_set1_epi16 (15));
+  mant = _mm256_add_epi16 (mant, _mm256_and_si256 (_mm256_cmpgt_epi16 (iexp, _mm256_setzero_si256 ()), _mm256_set1_epi16 (16)));
+  mant = _mm256_add_epi16 (_mm256_slli_epi16 (mant, 4), _mm256_set1_epi16 (8));
+  mant = _mm256_mullo_epi16 (mant, G711_POW2 (G711_BYTES (1, 2, 4, 8, 16, 32, 64, 0, 0), _mm256_subs_epu16 (iexp, _mm256_set1_epi16 (1))));
+  /* invert, if negative sample */
+  return _mm256_blendv_epi8 (_mm256_sub_epi16 (_mm256_setzero_si256 (), mant), mant, _mm256_cmpgt_epi16 (x, _mm256_set1_epi16 (127)));
+}
+
+__attribute__ ((target ("avx2")))
+static __m256i ulaw_expand_lanes (__m256i x) {
+  __m256i m, exponent, val;
+
+  m = _mm256_xor_si256 (x, _mm256_set1_epi16 (-1));
+  exponent = _mm256_and_si256 (_mm256_srli_epi16 (m, 4), _mm256_set1_epi16 (7));
+  m = _mm256_and_si256 (m, _mm256_set1_epi16 (15));
+  /* (0x80 << exp) + (8 << exp) * mant + (4 << exp) - 4 * 33 */
+  val = _mm256_add_epi16 (_mm256_slli_epi16 (m, 3), _mm256_set1_epi16 (132));
+  val = _mm256_mullo_epi16 (val, G711_POW2 (G711_BYTES (1, 2, 4, 8, 16, 32, 64, (char) 128, 0), exponent));
+  val = _mm256_sub_epi16 (val, _mm256_set1_epi16 (132));
+  return _mm256_blendv_epi8 (val, _mm256_sub_epi16 (_mm256_setzero_si256 (), val), _mm256_cmpgt_epi16 (_mm256_set1_epi16 (0x80), x));
+}
+
+#define G711_LOAD(p)     _mm256_loadu_si256 ((__m256i *) (p))
+#define G711_STORE(p, v) _mm256_storeu_si256 ((__m256i *) (p), v)
+
+__attribute__ ((target ("avx2")))
+static void alaw_compress_avx2 (long lseg, short *linbuf, short *logbuf) {
+  long n;
+
+  for (n = 0; n + 16 <= lseg; n += 16)
+    G711_STORE (logbuf + n, alaw_compress_lanes (G711_LOAD (linbuf + n)));
+  alaw_compress_table (lseg - n, linbuf + n, logbuf + n);
+}
+
+__attribute__ ((target ("avx2")))
+static void ulaw_compress_avx2 (long lseg, short *linbuf, short *logbuf) {
+  long n;
+
+  for (n = 0; n + 16 <= lseg; n += 16)
+    G711_STORE (logbuf + n, ulaw_compress_lanes (G711_LOAD (linbuf + n)));
+  ulaw_compress_table (lseg - n, linbuf + n, logbuf + n);
+}
+
+__attribute__ ((target ("avx2")))
+static void alaw_expand_avx2 (long lseg, short *logbuf, short *linbuf) {
+  long n;
+
+  for (n = 0; n + 16 <= lseg; n += 16)
+    G711_STORE (linbuf + n, alaw_expand_lanes (G711_LOAD (logbuf + n)));
+  alaw_expand_table (lseg - n, logbuf + n, linbuf + n);
+}
+
+__attribute__ ((target ("avx2")))
+static void ulaw_expand_avx2 (long lseg, short *logbuf, short *linbuf) {
+  long n;
+
+  for (n = 0; n + 16 <= lseg; n += 16)
+    G711_STORE (linbuf + n, ulaw_expand_lanes (G711_LOAD (logbuf + n)));
+  ulaw_expand_table (lseg - n, logbuf + n, linbuf + n);
+}
+
+#endif /* G711_HAVE_AVX2 */
+
+/* ............................. End of G711.C ............................. */
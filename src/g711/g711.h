@@ -16,10 +16,11 @@
 			and <Volker.Springer@eedn.ericsson.se>
    31.Jan.2000  v3.01   [version no.aligned with g711.c] Updated list of 
                         compilers for smart prototypes
+   17.Oct.2026  v3.02   Added engine selection (g711_engine)
   ============================================================================
 */
 #ifndef G711_defined
-#define G711_defined 301
+#define G711_defined 302
 
 /* Smart function prototypes: for [ag]cc, VaxC, and [tb]cc */
 #if !defined(ARGS)
@@ -36,6 +37,13 @@ void alaw_compress ARGS ((long lseg, short *linbuf, short *logbuf));
 void alaw_expand ARGS ((long lseg, short *logbuf, short *linbuf));
 void ulaw_compress ARGS ((long lseg, short *linbuf, short *logbuf));
 void ulaw_expand ARGS ((long lseg, short *logbuf, short *linbuf));
+int g711_engine ARGS ((int engine));
+char *g711_engine_name ARGS ((void));
+
+/* Engines selectable with g711_engine(); all are bit-exact */
+#define G711_ENGINE_REFERENCE 0 /* original per-sample functions */
+#define G711_ENGINE_TABLE     1 /* look-up tables */
+#define G711_ENGINE_SIMD      2 /* SIMD bulk kernels, tables for the rest */
 
 /* Definitions for better user interface (?!) */
 #define IS_LIN 1
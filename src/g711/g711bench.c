@@ -0,0 +1,188 @@
+/*                                                           17.Oct.2026 v1.0
+  ===========================================================================
+
+  G711BENCH.C
+  ~~~~~~~~~~~
+
+  Description:
+  ~~~~~~~~~~~~
+
+  Micro-benchmark and equivalence check for the engines of the G711
+  module (see g711_engine() in g711.c). For each law and direction, a
+  pseudo-random signal is converted with the reference, the table-driven
+  and the SIMD engines; the throughput (Msamples per second of CPU time)
+  of each engine is reported, together with a flag telling whether the
+  outputs are identical to the reference.
+
+  The equivalence is also checked for all 65536 possible input values of
+  each function, processed in buffers of varying length so that the tail
+  handling of the SIMD kernels is exercised.
+
+  Usage:
+  ~~~~~~
+  $ g711bench [-options]
+
+  Options:
+  -n N ......... number of samples per conversion [default: 10000000]
+  -check ....... only check the engines (no timing), and return a
+                 non-zero exit code if any output differs
+
+  Original author:
+  ~~~~~~~~~~~~~~~~
+  ITU-T STL contributors
+
+  History:
+  ~~~~~~~~
+  17.Oct.2026 v1.0 Created.
+
+  ===========================================================================
+*/
+
+#include "ugstdemo.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "g711.h"
+
+/* Conversion functions of the module */
+typedef struct {
+  char *name;
+  int compress;                 /* input is linear */
+  void (*fn) ARGS ((long lseg, short *inp, short *out));
+} G711_ENTRY;
+
+static G711_ENTRY g711_list[] = {
+  {"A-law compress", 1, alaw_compress},
+  {"A-law expand", 0, alaw_expand},
+  {"u-law compress", 1, ulaw_compress},
+  {"u-law expand", 0, ulaw_expand},
+};
+
+#define N_FUNCS (sizeof (g711_list) / sizeof (g711_list[0]))
+
+static int engine_list[] = { G711_ENGINE_REFERENCE, G711_ENGINE_TABLE, G711_ENGINE_SIMD };
+
+#define N_ENGINES (sizeof (engine_list) / sizeof (engine_list[0]))
+
+/* Segment lengths cycled through when processing a buffer */
+static long seg_len[] = { 160, 1, 15, 17, 1024, 2, 31, 3, 4096, 641 };
+
+#define N_SEG (sizeof (seg_len) / sizeof (seg_len[0]))
+
+
+/*
+ * Convert the whole buffer x[0..n-1] into y[] in segments of varying
+ * length; returns the CPU time.
+ */
+double run_segments (G711_ENTRY * f, short *x, short *y, long n) {
+  long i, k, l;
+  clock_t t0;
+
+  t0 = clock ();
+  for (i = 0, k = 0; i < n; i += l, k++) {
+    l = seg_len[k % N_SEG];
+    if (l > n - i)
+      l = n - i;
+    f->fn (l, x + i, y + i);
+  }
+  return (double) (clock () - t0) / CLOCKS_PER_SEC;
+}
+
+
+void display_usage () {
+  printf ("G711BENCH.C - Version 1.0 of 17.Oct.2026\n\n");
+  printf (" Micro-benchmark and equivalence check of the G711 engines.\n\n");
+  printf (" Usage:\n");
+  printf (" $ g711bench [-options]\n\n");
+  printf (" Options:\n");
+  printf ("  -n N ....... number of samples per conversion [default: 10000000]\n");
+  printf ("  -check ..... only check the engines, no timing\n");
+  exit (-128);
+}
+
+
+int main (int argc, char *argv[]) {
+  long n = 10000000L, i, lcg = 12345, fail = 0;
+  unsigned f, e;
+  int check = 0, exact[N_ENGINES];
+  double cpu[N_ENGINES];
+  static short all[65536], all_ref[65536], all_out[65536];
+  short *x, *y_ref, *y;
+  clock_t t0;
+
+  /* Get options */
+  while (argc > 1 && argv[1][0] == '-')
+    if (strcmp (argv[1], "-n") == 0) {
+      n = atol (argv[2]);
+      argc -= 2;
+      argv += 2;
+    } else if (strcmp (argv[1], "-check") == 0) {
+      check = 1;
+      argc--;
+      argv++;
+    } else if (strcmp (argv[1], "-h") == 0 || strcmp (argv[1], "-?") == 0) {
+      display_usage ();
+    } else {
+      fprintf (stderr, "ERROR! Invalid option \"%s\" in command line\n\n", argv[1]);
+      display_usage ();
+    }
+
+  if (check)
+    n = 100000;
+  if (n < 1)
+    n = 1;
+  if ((x = (short *) malloc (n * sizeof (short))) == NULL || (y_ref = (short *) malloc (n * sizeof (short))) == NULL || (y = (short *) malloc (n * sizeof (short))) == NULL)
+    HARAKIRI ("Error allocating memory for signals\n", 3);
+
+  g711_engine (G711_ENGINE_SIMD);
+  printf ("SIMD engine: %s\n\n", g711_engine_name ());
+  printf ("%-16s %12s %12s %12s %8s %6s\n", "function", "ref[Ms/s]", "table[Ms/s]", "simd[Ms/s]", "speedup", "exact");
+
+  for (i = 0; i < 65536; i++)
+    all[i] = (short) i;
+
+  for (f = 0; f < N_FUNCS; f++) {
+    /* Pseudo-random signal: linear samples, or 8-bit log samples */
+    for (i = 0; i < n; i++) {
+      lcg = (lcg * 1103515245 + 12345) & 0x7FFFFFFF;
+      x[i] = g711_list[f].compress ? (short) ((lcg >> 15) - 32768) : (short) ((lcg >> 16) & 255);
+    }
+
+    for (e = 0; e < N_ENGINES; e++) {
+      g711_engine (engine_list[e]);
+
+      /* all possible 16-bit inputs */
+      run_segments (&g711_list[f], all, all_out, 65536);
+      if (e == 0)
+        memcpy (all_ref, all_out, sizeof (all_ref));
+      exact[e] = memcmp (all_ref, all_out, sizeof (all_ref)) == 0;
+
+      /* timing, one call for the whole signal */
+      t0 = clock ();
+      g711_list[f].fn (n, x, y);
+      cpu[e] = (double) (clock () - t0) / CLOCKS_PER_SEC;
+      if (e == 0)
+        memcpy (y_ref, y, n * sizeof (short));
+      exact[e] = exact[e] && memcmp (y_ref, y, n * sizeof (short)) == 0;
+      if (!exact[e])
+        fail++;
+    }
+
+    printf ("%-16s", g711_list[f].name);
+    if (check)
+      printf (" %12s %12s %12s %8s", "-", "-", "-", "-");
+    else
+      printf (" %12.1f %12.1f %12.1f %7.2fx", n / (cpu[0] + 1e-9) / 1e6, n / (cpu[1] + 1e-9) / 1e6, n / (cpu[2] + 1e-9) / 1e6, (cpu[0] + 1e-9) / (cpu[2] + 1e-9));
+    printf (" %6s\n", exact[1] && exact[2] ? "yes" : "NO");
+  }
+
+  free (x);
+  free (y_ref);
+  free (y);
+
+  if (fail)
+    fprintf (stderr, "%ld engine/function pair(s) failed the equivalence check\n", fail);
+  return fail ? 1 : 0;
+}
@@ -1,4 +1,4 @@
-/*                                                        02.Feb.2010 v3.3
+/*                                                        17.Oct.2026 v3.5
   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
   G711DEMO.C
@@ -39,6 +39,9 @@
                 read from a file.
   -skip         is the number of samples to skip before the beginning
                 of the 1st block.
+  -engine       implementation of the G711 functions: ref, table or
+                simd (see g711_engine() in g711.c); all give identical
+                results.
 
   Example:
   $ G711 u lili voice.ref voice.rel 256 3 45
@@ -146,6 +149,9 @@
                    size is not a multiple of the file
                    size. <simao.campos@labs.comsat.com>
   02.Feb.2010 v3.3 Modified maximum string length (y.hiwasaki)
+  17.Oct.2026 v3.4 Added option -engine.
+  17.Oct.2026 v3.5 File I/O with the ugst-io module (input file memory-
+                   mapped, output written in large blocks).
   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "ugstdemo.h"           /* UGST defines for demo programs */
 
@@ -156,17 +162,13 @@
 #include <stdlib.h>             /* General utility definitions */
 #include <math.h>
 
-/* Include OS dependent headers */
-#if defined(VMS)
-#include <stat.h>
-#else /* Others */
-#include <sys/stat.h>
-#endif
-
 
 /* G711 module functions */
 #include "g711.h"
 
+/* Block I/O of sample files */
+#include "ugst-io.h"
+
 
 /*
   --------------------------------------------------------------------------
@@ -179,7 +181,7 @@
   --------------------------------------------------------------------------
 */
 void display_usage () {
-  fprintf (stderr, "\n  G711DEMO.C   --- Version v3.3 of 02.Feb.2010 \n");
+  fprintf (stderr, "\n  G711DEMO.C   --- Version v3.5 of 17.Oct.2026 \n");
   fprintf (stderr, "\n");
   fprintf (stderr, "  Description:\n");
   fprintf (stderr, "  ~~~~~~~~~~~~\n");
@@ -208,6 +210,7 @@ void display_usage () {
   fprintf (stderr, "  -?         displays this message.\n");
   fprintf (stderr, "  -r         disables even-bit swap by A-law encoding and decoding.\n");
   fprintf (stderr, "  -skip      is the number of samples to skip.\n");
+  fprintf (stderr, "  -engine    ref, table or simd implementation [table].\n");
   fprintf (stderr, "\n");
 
   /* Quit program */
@@ -231,8 +234,7 @@ int main (int argc, char *argv[]) {
   short *log_buff;              /* compressed data */
   short *lon_buff;              /* quantized output samples */
   char inpfil[MAX_STRLEN], outfil[MAX_STRLEN];
-  FILE *Fi, *Fo;
-  int inp, out;
+  UGST_IO *Fi, *Fo;
   char law[MAX_STRLEN], lilo[MAX_STRLEN];
   short inp_type, out_type;
   char revert_even_bits = 1;
@@ -272,6 +274,18 @@ int main (int argc, char *argv[]) {
         /* Move argv over the option to the next argument */
         argv += 2;
 
+        /* Update argc */
+        argc -= 2;
+      } else if (strcmp (argv[1], "-engine") == 0) {
+        /* Select the implementation of the G711 functions */
+        if (g711_engine (strcmp (argv[2], "ref") == 0 ? G711_ENGINE_REFERENCE : strcmp (argv[2], "table") == 0 ? G711_ENGINE_TABLE : strcmp (argv[2], "simd") == 0 ? G711_ENGINE_SIMD : -1) < 0) {
+          fprintf (stderr, "Invalid engine \"%s\"\n", argv[2]);
+          exit (10);
+        }
+
+        /* Move argv over the option to the next argument */
+        argv += 2;
+
         /* Update argc */
         argc -= 2;
       } else if (argv[1][1] == '?') {
@@ -327,28 +341,24 @@ int main (int argc, char *argv[]) {
 #endif
 
   /* Open input file */
-  if ((Fi = fopen (inpfil, RB)) == NULL)
+  if ((Fi = ugst_io_open_read (inpfil, UGST_IO_NATIVE)) == NULL)
     KILL (inpfil, 2);
-  inp = fileno (Fi);
 
   /* Open (create) output file */
-  if ((Fo = fopen (outfil, WB)) == NULL)
+  if ((Fo = ugst_io_open_write (outfil, UGST_IO_NATIVE)) == NULL)
     KILL (outfil, 3);
-  out = fileno (Fo);
 
   /* Define starting byte in file */
   start_byte = (N1 * N + skip) * sizeof (short);
 
   /* ... and move file's pointer to 1st desired block */
-  if (fseek (Fi, (N1 * N + skip) * sizeof (short), 0) < 0l)
+  if (ugst_io_seek (Fi, N1 * N + skip) < 0l)
     KILL (inpfil, 4);
 
   /* Check whether is to process til end-of-file */
   if (N2 == 0) {
-    struct stat st;
     /* ... hey, need to skip the delayed samples! ... */
-    stat (inpfil, &st);
-    N2 = ceil ((st.st_size - start_byte) / (double) (N * sizeof (short)));
+    N2 = ugst_io_length (Fi) < 0 ? 0x7FFFFFFFL : (long) ceil ((ugst_io_length (Fi) * sizeof (short) - start_byte) / (double) (N * sizeof (short)));
   }
 
 
@@ -357,6 +367,7 @@ int main (int argc, char *argv[]) {
  */
   t1 = clock ();                /* measure CPU-time */
   tot_smpno = 0;
+  smpno = -1;                   /* no block read yet */
 
   switch (law[0]) {
     /* ......... Process A-law rule ......... */
@@ -364,39 +375,39 @@ int main (int argc, char *argv[]) {
 
     /* Input: LINEAR | Output: LOG */
     if (inp_type == IS_LIN && out_type == IS_LOG)
-      for (tot_smpno = cur_blk = 0; cur_blk < N2; cur_blk++, tot_smpno += smpno) {
-        if ((smpno = fread (lin_buff, sizeof (short), N, Fi)) < 0)
+      for (tot_smpno = cur_blk = 0; cur_blk < N2 && smpno != 0; cur_blk++, tot_smpno += smpno) {
+        if ((smpno = ugst_io_read (Fi, lin_buff, N)) < 0)
           KILL (inpfil, 5);
         alaw_compress (smpno, lin_buff, log_buff);
         if (!revert_even_bits)
           for (i = 0; i < smpno; i++)
             log_buff[i] ^= 0x0055;
 
-        if ((smpno = fwrite (log_buff, sizeof (short), smpno, Fo)) < 0)
+        if ((smpno = ugst_io_write (Fo, log_buff, smpno)) < 0)
           KILL (outfil, 6);
       }
 
     /* Input: LINEAR | Output: LINEAR */
     else if (inp_type == IS_LIN && out_type == IS_LIN)
-      for (tot_smpno = cur_blk = 0; cur_blk < N2; cur_blk++, tot_smpno += smpno) {
-        if ((smpno = fread (lin_buff, sizeof (short), N, Fi)) < 0)
+      for (tot_smpno = cur_blk = 0; cur_blk < N2 && smpno != 0; cur_blk++, tot_smpno += smpno) {
+        if ((smpno = ugst_io_read (Fi, lin_buff, N)) < 0)
           KILL (inpfil, 5);
         alaw_compress (smpno, lin_buff, log_buff);
         alaw_expand (smpno, log_buff, lon_buff);
-        if ((smpno = fwrite (lon_buff, sizeof (short), smpno, Fo)) < 0)
+        if ((smpno = ugst_io_write (Fo, lon_buff, smpno)) < 0)
           KILL (outfil, 6);
       }
 
     /* Input: LOG | Output: LINEAR */
     else if (inp_type == IS_LOG)
-      for (tot_smpno = cur_blk = 0; cur_blk < N2; cur_blk++, tot_smpno += smpno) {
-        if ((smpno = fread (log_buff, sizeof (short), N, Fi)) < 0)
+      for (tot_smpno = cur_blk = 0; cur_blk < N2 && smpno != 0; cur_blk++, tot_smpno += smpno) {
+        if ((smpno = ugst_io_read (Fi, log_buff, N)) < 0)
           KILL (inpfil, 5);
         if (!revert_even_bits)
           for (i = 0; i < smpno; i++)
             log_buff[i] ^= 0x0055;
         alaw_expand (smpno, log_buff, lon_buff);
-        if ((smpno = fwrite (lon_buff, sizeof (short), smpno, Fo)) < 0)
+        if ((smpno = ugst_io_write (Fo, lon_buff, smpno)) < 0)
           KILL (outfil, 6);
       }
     break;
@@ -406,27 +417,27 @@ int main (int argc, char *argv[]) {
   case 'U':
     /* Input: LINEAR | Output: LOG */
     if (inp_type == IS_LIN && out_type == IS_LOG)
-      for (tot_smpno = cur_blk = 0; cur_blk < N2; cur_blk++, tot_smpno += smpno) {
-        smpno = fread (lin_buff, sizeof (short), N, Fi);
+      for (tot_smpno = cur_blk = 0; cur_blk < N2 && smpno != 0; cur_blk++, tot_smpno += smpno) {
+        smpno = ugst_io_read (Fi, lin_buff, N);
         ulaw_compress (smpno, lin_buff, log_buff);
-        smpno = fwrite (log_buff, sizeof (short), smpno, Fo);
+        smpno = ugst_io_write (Fo, log_buff, smpno);
       }
 
     /* Input: LINEAR | Output: LINEAR */
     else if (inp_type == IS_LIN && out_type == IS_LIN)
-      for (tot_smpno = cur_blk = 0; cur_blk < N2; cur_blk++, tot_smpno += smpno) {
-        smpno = fread (lin_buff, sizeof (short), N, Fi);
+      for (tot_smpno = cur_blk = 0; cur_blk < N2 && smpno != 0; cur_blk++, tot_smpno += smpno) {
+        smpno = ugst_io_read (Fi, lin_buff, N);
         ulaw_compress (smpno, lin_buff, log_buff);
         ulaw_expand (smpno, log_buff, lon_buff);
-        smpno = fwrite (lon_buff, sizeof (short), smpno, Fo);
+        smpno = ugst_io_write (Fo, lon_buff, smpno);
       }
 
     /* Input: LOG | Output: LINEAR */
     else if (inp_type == IS_LOG)
-      for (tot_smpno = cur_blk = 0; cur_blk < N2; cur_blk++, tot_smpno += smpno) {
-        smpno = fread (log_buff, sizeof (short), N, Fi);
+      for (tot_smpno = cur_blk = 0; cur_blk < N2 && smpno != 0; cur_blk++, tot_smpno += smpno) {
+        smpno = ugst_io_read (Fi, log_buff, N);
         ulaw_expand (smpno, log_buff, lon_buff);
-        smpno = fwrite (lon_buff, sizeof (short), smpno, Fo);
+        smpno = ugst_io_write (Fo, lon_buff, smpno);
       }
     break;
   }
@@ -437,8 +448,9 @@ int main (int argc, char *argv[]) {
   t2 = clock ();
   printf ("Speed: %f sec CPU-time for %ld processed samples\n", (t2 - t1) / (double) CLOCKS_PER_SEC, tot_smpno);
 
-  fclose (Fi);
-  fclose (Fo);
+  ugst_io_close (Fi);
+  if (ugst_io_close (Fo) < 0)
+    KILL (outfil, 6);
 #ifndef VMS
   return (0);
 #endif
@@ -0,0 +1,93 @@
+/*                                                           17.Oct.2026 v1.0
+  ===========================================================================
+
+  G711TAB.C
+  ~~~~~~~~~
+
+  Description:
+  ~~~~~~~~~~~~
+
+  Generates g711tab.h, the constant tables of the table-driven engine of
+  the G711 module (see g711_engine() in g711.c), from the reference
+  functions of the module. The tables are compiled into g711.c, so that
+  they need no run-time initialisation and the module can be used from
+  several threads; this program is only needed to rebuild or check them.
+
+  Usage:
+  ~~~~~~
+  $ g711tab file
+
+  where file is the header to write (normally g711tab.h).
+
+  Original author:
+  ~~~~~~~~~~~~~~~~
+  ITU-T STL contributors
+
+  History:
+  ~~~~~~~~
+  17.Oct.2026 v1.0 Created.
+
+  ===========================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "g711.h"
+
+/* Write n table entries, 16 per line */
+static void put_table (FILE * fp, char *decl, short *tab, long n) {
+  long i;
+
+  fprintf (fp, "%s = {\n", decl);
+  for (i = 0; i < n; i++)
+    fprintf (fp, "%s%d%s", i % 16 ? " " : "  ", tab[i], i == n - 1 ? "\n" : i % 16 == 15 ? ",\n" : ",");
+  fprintf (fp, "};\n\n");
+}
+
+int main (int argc, char *argv[]) {
+  static short lin[16384], log_[16384];
+  long i;
+  FILE *fp;
+
+  if (argc < 2) {
+    fprintf (stderr, "Usage: g711tab file\n");
+    exit (1);
+  }
+  if ((fp = fopen (argv[1], "w")) == NULL) {
+    fprintf (stderr, "Could not create %s\n", argv[1]);
+    exit (1);
+  }
+
+  g711_engine (G711_ENGINE_REFERENCE);
+
+  fprintf (fp, "/* g711tab.h: tables of the table-driven engine of the G711 module,\n");
+  fprintf (fp, "   generated by g711tab.c from the reference functions (do not edit):\n");
+  fprintf (fp, "   - A-law compression, indexed by the 12 MSBs of the linear sample;\n");
+  fprintf (fp, "   - u-law compression, indexed by the 14 MSBs of the linear sample;\n");
+  fprintf (fp, "   - A/u-law expansion, indexed by the 8-bit log sample */\n\n");
+
+  /* Compression: the output only depends on the 12/14 MSBs */
+  for (i = 0; i < 4096; i++)
+    lin[i] = (short) (i << 4);
+  alaw_compress (4096, lin, log_);
+  put_table (fp, "static const unsigned char alaw_comp_tab[4096]", log_, 4096);
+
+  for (i = 0; i < 16384; i++)
+    lin[i] = (short) (i << 2);
+  ulaw_compress (16384, lin, log_);
+  put_table (fp, "static const unsigned char ulaw_comp_tab[16384]", log_, 16384);
+
+  /* Expansion of all 8-bit codes */
+  for (i = 0; i < 256; i++)
+    log_[i] = (short) i;
+  alaw_expand (256, log_, lin);
+  put_table (fp, "static const short alaw_exp_tab[256]", lin, 256);
+  ulaw_expand (256, log_, lin);
+  put_table (fp, "static const short ulaw_exp_tab[256]", lin, 256);
+
+  if (fclose (fp)) {
+    fprintf (stderr, "Error writing %s\n", argv[1]);
+    exit (1);
+  }
+  return 0;
+}
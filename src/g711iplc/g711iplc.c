@@ -1,4 +1,4 @@
-/*                                                        24.May.2005 v1.0
+/*                                                        17.Oct.2026 v1.1
   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
   g711iplc.c
@@ -15,11 +15,15 @@
 	Options:
 		-noplc		simulate silence insertion instead of concealment
 		-stats		print out concealed frame statistics
+		-rate r		sampling rate, 8000 to 48000 in steps of 8000
+				[default: 8000]
+		-framesz n	frame size in samples, a multiple of 10 msec
+				[default: 10 msec]
 
 	File Formats:
-		plcpattern	G.192 FER file
-		speechin	Headerless binary 8kHz 16-bit PCM file
-		speechout	Headerless binary 8kHz 16-bit PCM file
+		plcpattern	G.192 FER file, one flag per frame
+		speechin	Headerless binary 16-bit PCM file
+		speechout	Headerless binary 16-bit PCM file
 
 	Example:
 	$ g711iplc plcpattern speechin speechout
@@ -39,6 +43,7 @@
   ~~~~~~~~
   24.May.2005 v1.0 Release of 1st demo program for G711 PLC module <AT&T>.
 				   Integration of this module in STL2005 <Cyril Guillaume & Stephane Ragot - stephane.ragot@francetelecom.com>
+  17.Oct.2026 v1.1 Added options -rate and -framesz.
 
   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
@@ -49,7 +54,7 @@
 #include "lowcfe.h"
 
 char usage[] = "\
-G711IPLC Version 1.0 of 24/May/2005\n\
+G711IPLC Version 1.1 of 17/Oct/2026\n\
   UGST/ITU-T G.711 Appendix I Packet Loss Concealment module\n\
   (*) G711IPLC module: COPYRIGTH 1997-2001 AT&T Corp.\n\
 ANSI C Version\n\
@@ -59,10 +64,12 @@ Usage:\n\
 Options:\n\
 	-noplc		simulate silence insertion instead of concealment\n\
 	-stats		print out concealed frame statistics\n\
+	-rate r		sampling rate, 8000 to 48000 in steps of 8000 [8000]\n\
+	-framesz n	frame size in samples, a multiple of 10 msec [10 msec]\n\
 File Formats:\n\
-	plcpattern	G.192 FER file\n\
-	speechin	Headerless binary 8kHz 16-bit PCM file\n\
-	speechout	Headerless binary 8kHz 16-bit PCM file\
+	plcpattern	G.192 FER file, one flag per frame\n\
+	speechin	Headerless binary 16-bit PCM file\n\
+	speechout	Headerless binary 16-bit PCM file\
 ";
 
 int main (int argc, char *argv[]) {
@@ -74,9 +81,12 @@ int main (int argc, char *argv[]) {
   char *arg;
   FILE *fi;                     /* input file */
   FILE *fo;                     /* output file */
-  LowcFE_c lc;                  /* PLC simulation data */
+  long rate = 8000;             /* sampling rate */
+  int framesz = 0;              /* frame size, 0 for 10 msec */
+  int delay;                    /* algorithmic delay */
+  LowcFE_c *lc;                 /* PLC simulation data */
   readplcmask mask;             /* error pattern file reader */
-  short in[FRAMESZ];            /* i/o buffer */
+  short *in;                    /* i/o buffer */
 
   argc--;
   argv++;
@@ -86,7 +96,15 @@ int main (int argc, char *argv[]) {
       dofe = 0;
     else if (!strcmp ("-stats", arg))
       dostats = 1;
-    else {
+    else if (!strcmp ("-rate", arg) && argc > 1) {
+      rate = atol (argv[1]);
+      argc--;
+      argv++;
+    } else if (!strcmp ("-framesz", arg) && argc > 1) {
+      framesz = atoi (argv[1]);
+      argc--;
+      argv++;
+    } else {
       fprintf (stderr, "%s", usage);
       exit (EXIT_FAILURE);
     }
@@ -97,6 +115,17 @@ int main (int argc, char *argv[]) {
     fprintf (stderr, "%s", usage);
     exit (EXIT_FAILURE);
   }
+  if (framesz == 0)
+    framesz = (int) (rate / 100);
+  if ((lc = g711plc_create (rate, framesz)) == NULL) {
+    fprintf (stderr, "Unsupported rate %ld or frame size %d\n", rate, framesz);
+    exit (EXIT_FAILURE);
+  }
+  if ((in = (short *) malloc (framesz * sizeof (short))) == NULL) {
+    fprintf (stderr, "Out of memory\n");
+    exit (EXIT_FAILURE);
+  }
+  delay = lc->poverlapmax;
   readplcmask_open (&mask, argv[0]);    /* PLC pattern file */
   if ((fi = fopen (argv[1], "rb")) == NULL) {   /* input file */
     fprintf (stderr, "Can't open input file: %s", argv[1]);
@@ -107,29 +136,28 @@ int main (int argc, char *argv[]) {
     exit (EXIT_FAILURE);
   }
   nframes = nerased = 0;
-  g711plc_construct (&lc);
-  while (fread (in, sizeof (short), FRAMESZ, fi) == FRAMESZ) {
+  while (fread (in, sizeof (short), framesz, fi) == (size_t) framesz) {
     nframes++;
     if (readplcmask_erased (&mask)) {
       nerased++;                /* frame is erased */
       if (dofe)                 /* simulate concealment */
-        g711plc_dofe (&lc, in);
+        g711plc_dofe (lc, in);
       else {                    /* simulate silence insertion */
-        for (i = 0; i < FRAMESZ; i++)
+        for (i = 0; i < framesz; i++)
           in[i] = 0;
-        g711plc_addtohistory (&lc, in);
+        g711plc_addtohistory (lc, in);
       }
     } else
-      g711plc_addtohistory (&lc, in);   /* frame is not erased */
+      g711plc_addtohistory (lc, in);    /* frame is not erased */
     /* 
      * The concealment algorithm delays the signal by
-     * POVERLAPMAX samples. Remove the delay so the output
+     * poverlapmax samples. Remove the delay so the output
      * file is time-aligned with the input file.
      */
     if (nframes == 1)
-      fwrite (&in[POVERLAPMAX], sizeof (short), FRAMESZ - POVERLAPMAX, fo);
+      fwrite (&in[delay], sizeof (short), framesz - delay, fo);
     else
-      fwrite (in, sizeof (short), FRAMESZ, fo);
+      fwrite (in, sizeof (short), framesz, fo);
   }
   /* 
    * the following code outputs the delayed speech in the history buffer
@@ -137,10 +165,10 @@ int main (int argc, char *argv[]) {
    * the frame size.
    */
   if (nframes) {
-    for (i = 0; i < FRAMESZ; i++)
+    for (i = 0; i < framesz; i++)
       in[i] = 0;
-    g711plc_addtohistory (&lc, in);
-    fwrite (in, sizeof (short), POVERLAPMAX, fo);
+    g711plc_addtohistory (lc, in);
+    fwrite (in, sizeof (short), delay, fo);
   }
   if (dostats && nframes)
     printf ("%d of %d frames concealed = %.2f%%\n", nerased, nframes, (double) nerased / nframes * 100.);
@@ -148,5 +176,7 @@ int main (int argc, char *argv[]) {
   fclose (fo);
   fclose (fi);
   readplcmask_close (&mask);
+  g711plc_free (lc);
+  free (in);
   return 0;
 }
@@ -1,4 +1,4 @@
-/*                                                          24.May.2005 v.1.0
+/*                                                          17.Oct.2026 v.1.1
 =============================================================================
 
                           U    U   GGG    SSSS  TTTTT
@@ -28,7 +28,13 @@ ORIGINAL BY:    AT&T Corp.
 
 FUNCTIONS:
 
-g711plc_construct: ...... LowcFE Constructor.
+g711plc_construct: ...... LowcFE Constructor (8 kHz, 10 msec frames).
+
+g711plc_create: ......... Allocates a LowcFE instance for a sampling rate
+						  multiple of 8 kHz (up to 48 kHz) and a frame size
+						  multiple of 10 msec.
+
+g711plc_free: ........... Releases an instance from g711plc_create.
 
 g711plc_dofe: ........... Generate the synthetic signal.
 						  At the beginning of an erasure determine the pitch, and extract
@@ -47,16 +53,34 @@ HISTORY:
 
   24.May.05  v1.0  Release of 1st G711 PLC module <AT&T>.
 				   Integration of this module in STL2005 <Cyril Guillaume & Stephane Ragot - stephane.ragot@francetelecom.com>.
+  17.Oct.26  v1.1  Sampling rate and frame size chosen at construction
+				   (g711plc_create); the constants scale with rate/8000 and
+				   longer frames are processed in 10 msec units. The
+				   history is a ring buffer instead of being shifted every
+				   frame, and the pitch correlations are computed for
+				   several lags at a time (AVX when available). The sums
+				   keep their order, so 8 kHz output is bit-exact with v1.0.
 =============================================================================
 */
 
 #include <math.h>
+#include <stdlib.h>
 #include "lowcfe.h"
 
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(__INTEL_COMPILER)
+#define PLC_HAVE_AVX
+#include <immintrin.h>
+#endif
+
+static void g711plc_setup (LowcFE_c *, long rate, int framesz);
+static void g711plc_dofe_unit (LowcFE_c *, short *s);
+static void g711plc_addtohistory_unit (LowcFE_c *, short *s);
 static void g711plc_scalespeech (LowcFE_c *, short *out);
 static void g711plc_getfespeech (LowcFE_c *, short *out, int sz);
 static void g711plc_savespeech (LowcFE_c *, short *s);
+static void g711plc_histput (LowcFE_c *, int pos, short *s, int cnt);
 static int g711plc_findpitch (LowcFE_c *);
+static void g711plc_xcorr (Float * r, Float * l, int cnt, int nlag, Float * corr);
 static void g711plc_overlapadd (Float * l, Float * r, Float * o, int cnt);
 static void g711plc_overlapadds (short *l, short *r, short *o, int cnt);
 static void g711plc_overlapaddatend (LowcFE_c *, short *s, short *f, int cnt);
@@ -67,9 +91,82 @@ static void g711plc_copys (short *f, short *t, int cnt);
 static void g711plc_zeros (short *s, int cnt);
 
 void g711plc_construct (LowcFE_c * lc) {
+  lc->mem = NULL;
+  lc->pitchbuf = lc->pitchbuf8;
+  lc->lastq = lc->lastq8;
+  lc->xbuf = lc->xbuf8;
+  lc->history = lc->history8;
+  lc->sbuf = lc->sbuf8;
+  g711plc_setup (lc, 8000L, FRAMESZ);
+}
+
+/*
+ * Allocate an instance for rate = 8000*fac Hz, fac = 1..PLC_MAXFAC, and
+ * frames of framesz samples, a multiple of 10 msec. All the 8 kHz lengths
+ * are multiplied by fac. Returns NULL for unsupported parameters or when
+ * out of memory.
+ */
+LowcFE_c *g711plc_create (long rate, int framesz) {
+  LowcFE_c *lc;
+  int fac = (int) (rate / 8000), historylen, nfloat;
+
+  if (rate % 8000 || fac < 1 || fac > PLC_MAXFAC || framesz <= 0 || framesz % (FRAMESZ * fac))
+    return NULL;
+  if ((lc = (LowcFE_c *) malloc (sizeof (LowcFE_c))) == NULL)
+    return NULL;
+  if (fac == 1) {
+    g711plc_construct (lc);
+    g711plc_setup (lc, rate, framesz);
+    return lc;
+  }
+
+  /* pitch buffer, last quarter and correlation buffers, then the shorts */
+  historylen = HISTORYLEN * fac;
+  nfloat = historylen + POVERLAPMAX * fac + XBUFLEN * fac;
+  lc->mem = malloc (nfloat * sizeof (Float) + (2 * historylen + FRAMESZ * fac) * sizeof (short));
+  if (lc->mem == NULL) {
+    free (lc);
+    return NULL;
+  }
+  lc->pitchbuf = (Float *) lc->mem;
+  lc->lastq = lc->pitchbuf + historylen;
+  lc->xbuf = lc->lastq + POVERLAPMAX * fac;
+  lc->history = (short *) (lc->pitchbuf + nfloat);
+  lc->sbuf = lc->history + 2 * historylen;
+  g711plc_setup (lc, rate, framesz);
+  return lc;
+}
+
+void g711plc_free (LowcFE_c * lc) {
+  if (lc == NULL)
+    return;
+  if (lc->mem)
+    free (lc->mem);
+  free (lc);
+}
+
+/*
+ * Set the lengths for the rate and clear the state
+ */
+static void g711plc_setup (LowcFE_c * lc, long rate, int framesz) {
+  int fac = (int) (rate / 8000);
+
+  lc->rate = rate;
+  lc->framesz = framesz;
+  lc->unitsz = FRAMESZ * fac;
+  lc->pitchmin = PITCH_MIN * fac;
+  lc->pitchmax = PITCH_MAX * fac;
+  lc->poverlapmax = lc->pitchmax >> 2;
+  lc->historylen = lc->pitchmax * 3 + lc->poverlapmax;
+  lc->ndec = NDEC * fac;
+  lc->corrlen = CORRLEN * fac;
+  lc->eoverlapincr = EOVERLAPINCR * fac;
+  lc->attenincr = ATTENFAC / lc->unitsz;
+
   lc->erasecnt = 0;
-  lc->pitchbufend = &lc->pitchbuf[HISTORYLEN];
-  g711plc_zeros (lc->history, HISTORYLEN);
+  lc->hpos = 0;
+  lc->pitchbufend = &lc->pitchbuf[lc->historylen];
+  g711plc_zeros (lc->history, 2 * lc->historylen);
 }
 
 /*
@@ -93,12 +190,21 @@ static void g711plc_getfespeech (LowcFE_c * lc, short *out, int sz) {
 static void g711plc_scalespeech (LowcFE_c * lc, short *out) {
   int i;
   Float g = (Float) 1. - (lc->erasecnt - 1) * ATTENFAC;
-  for (i = 0; i < FRAMESZ; i++) {
+  for (i = 0; i < lc->unitsz; i++) {
     out[i] = (short) (out[i] * g);
-    g -= ATTENINCR;
+    g -= lc->attenincr;
   }
 }
 
+/*
+ * Synthesize an erased frame, one 10 msec unit at a time
+ */
+void g711plc_dofe (LowcFE_c * lc, short *out) {
+  int k;
+  for (k = 0; k < lc->framesz; k += lc->unitsz)
+    g711plc_dofe_unit (lc, &out[k]);
+}
+
 /*
  * Generate the synthetic signal.
  * At the beginning of an erasure determine the pitch, and extract
@@ -109,10 +215,10 @@ static void g711plc_scalespeech (LowcFE_c * lc, short *out) {
  * of an erasure, do an OLA with the start of the first good frame.
  * The gain decays as the erasure gets longer.
  */
-void g711plc_dofe (LowcFE_c * lc, short *out) {
+static void g711plc_dofe_unit (LowcFE_c * lc, short *out) {
   if (lc->erasecnt == 0) {
-    /* get history */
-    g711plc_convertsf (lc->history, lc->pitchbuf, HISTORYLEN);
+    /* get history, contiguous from the oldest sample */
+    g711plc_convertsf (&lc->history[lc->hpos], lc->pitchbuf, lc->historylen);
     lc->pitch = g711plc_findpitch (lc); /* find pitch */
     lc->poverlap = lc->pitch >> 2;      /* OLA 1/4 wavelength */
     /* save original last poverlap samples */
@@ -122,12 +228,13 @@ void g711plc_dofe (LowcFE_c * lc, short *out) {
     lc->pitchbufstart = lc->pitchbufend - lc->pitchblen;
     g711plc_overlapadd (lc->lastq, lc->pitchbufstart - lc->poverlap, lc->pitchbufend - lc->poverlap, lc->poverlap);
     /* update last 1/4 wavelength in history buffer */
-    g711plc_convertfs (lc->pitchbufend - lc->poverlap, &lc->history[HISTORYLEN - lc->poverlap], lc->poverlap);
+    g711plc_convertfs (lc->pitchbufend - lc->poverlap, lc->sbuf, lc->poverlap);
+    g711plc_histput (lc, lc->historylen - lc->poverlap, lc->sbuf, lc->poverlap);
     /* get synthesized speech */
-    g711plc_getfespeech (lc, out, FRAMESZ);
+    g711plc_getfespeech (lc, out, lc->unitsz);
   } else if (lc->erasecnt == 1 || lc->erasecnt == 2) {
     /* tail of previous pitch estimate */
-    short tmp[POVERLAPMAX];
+    short *tmp = lc->sbuf;
     int saveoffset = lc->poffset;       /* save offset for OLA */
     /* continue with old pitchbuf */
     g711plc_getfespeech (lc, tmp, lc->poverlap);
@@ -139,13 +246,13 @@ void g711plc_dofe (LowcFE_c * lc, short *out) {
     lc->pitchbufstart = lc->pitchbufend - lc->pitchblen;
     g711plc_overlapadd (lc->lastq, lc->pitchbufstart - lc->poverlap, lc->pitchbufend - lc->poverlap, lc->poverlap);
     /* overlap add old pitchbuffer with new */
-    g711plc_getfespeech (lc, out, FRAMESZ);
+    g711plc_getfespeech (lc, out, lc->unitsz);
     g711plc_overlapadds (tmp, out, out, lc->poverlap);
     g711plc_scalespeech (lc, out);
   } else if (lc->erasecnt > 5) {
-    g711plc_zeros (out, FRAMESZ);
+    g711plc_zeros (out, lc->unitsz);
   } else {
-    g711plc_getfespeech (lc, out, FRAMESZ);
+    g711plc_getfespeech (lc, out, lc->unitsz);
     g711plc_scalespeech (lc, out);
   }
   lc->erasecnt++;
@@ -154,33 +261,63 @@ void g711plc_dofe (LowcFE_c * lc, short *out) {
 
 /*
  * Save a frames worth of new speech in the history buffer.
- * Return the output speech delayed by POVERLAPMAX.
+ * Return the output speech delayed by poverlapmax.
  */
 static void g711plc_savespeech (LowcFE_c * lc, short *s) {
-  /* make room for new signal */
-  g711plc_copys (&lc->history[FRAMESZ], lc->history, HISTORYLEN - FRAMESZ);
-  /* copy in the new frame */
-  g711plc_copys (s, &lc->history[HISTORYLEN - FRAMESZ], FRAMESZ);
+  int hl = lc->historylen, n = lc->unitsz;
+
+  /* the new frame takes the place of the oldest samples */
+  g711plc_histput (lc, 0, s, n);
+  lc->hpos += n;
+  if (lc->hpos >= hl)
+    lc->hpos -= hl;
   /* copy out the delayed frame */
-  g711plc_copys (&lc->history[HISTORYLEN - FRAMESZ - POVERLAPMAX], s, FRAMESZ);
+  g711plc_copys (&lc->history[lc->hpos + hl - n - lc->poverlapmax], s, n);
+}
+
+/*
+ * Write cnt samples to the history ring buffer, starting pos samples
+ * after the oldest one. Every sample is stored at i and i+historylen, so
+ * the whole history is contiguous from &history[hpos].
+ */
+static void g711plc_histput (LowcFE_c * lc, int pos, short *s, int cnt) {
+  int i, hl = lc->historylen;
+  short *h = lc->history;
+
+  pos += lc->hpos;
+  if (pos >= hl)
+    pos -= hl;
+  for (i = 0; i < cnt; i++) {
+    h[pos] = h[pos + hl] = s[i];
+    if (++pos == hl)
+      pos = 0;
+  }
+}
+
+/*
+ * A good frame was received and decoded, one 10 msec unit at a time
+ */
+void g711plc_addtohistory (LowcFE_c * lc, short *s) {
+  int k;
+  for (k = 0; k < lc->framesz; k += lc->unitsz)
+    g711plc_addtohistory_unit (lc, &s[k]);
 }
 
 /*
- * A good frame was received and decoded.
  * If right after an erasure, do an overlap add with the synthetic signal.
  * Add the frame to history buffer.
  */
-void g711plc_addtohistory (LowcFE_c * lc, short *s) {
+static void g711plc_addtohistory_unit (LowcFE_c * lc, short *s) {
   if (lc->erasecnt) {
-    short overlapbuf[FRAMESZ];
+    short *overlapbuf = lc->sbuf;
     /* 
      * longer erasures require longer overlaps
      * to smooth the transition between the synthetic
      * and real signal.
      */
-    int olen = lc->poverlap + (lc->erasecnt - 1) * EOVERLAPINCR;
-    if (olen > FRAMESZ)
-      olen = FRAMESZ;
+    int olen = lc->poverlap + (lc->erasecnt - 1) * lc->eoverlapincr;
+    if (olen > lc->unitsz)
+      olen = lc->unitsz;
     g711plc_getfespeech (lc, overlapbuf, olen);
     g711plc_overlapaddatend (lc, s, overlapbuf, olen);
     lc->erasecnt = 0;
@@ -267,86 +404,147 @@ static void g711plc_overlapadds (short *l, short *r, short *o, int cnt) {
 /*
  * Estimate the pitch.
  * l - pointer to first sample in last 20 msec of speech.
- * r - points to the sample PITCH_MAX before l
+ * r - points to the sample pitchmax before l
+ * The coarse search runs on the signals decimated by ndec, so that the
+ * lags of the correlation are contiguous.
  */
 static int g711plc_findpitch (LowcFE_c * lc) {
   int i, j, k;
   int bestmatch;
   Float bestcorr;
-  Float corr;                   /* correlation */
   Float energy;                 /* running energy */
   Float scale;                  /* scale correlation by average power */
   Float *rp;                    /* segment to match */
-  Float *l = lc->pitchbufend - CORRLEN;
-  Float *r = lc->pitchbufend - CORRBUFLEN;
+  int ndec = lc->ndec, pitchdiff = lc->pitchmax - lc->pitchmin;
+  int nl = lc->corrlen / ndec, nr = (lc->corrlen + lc->pitchmax) / ndec;
+  Float *l = lc->pitchbufend - lc->corrlen;
+  Float *r = lc->pitchbufend - lc->corrlen - lc->pitchmax;
+  Float *rd = lc->xbuf, *ld = rd + nr, *corr = ld + nl;
 
   /* coarse search */
-  rp = r;
+  for (i = 0; i < nr; i++)
+    rd[i] = r[i * ndec];
+  for (i = 0; i < nl; i++)
+    ld[i] = l[i * ndec];
+  g711plc_xcorr (rd, ld, nl, pitchdiff / ndec + 1, corr);
   energy = (Float) 0.;
-  corr = (Float) 0.;
-  for (i = 0; i < CORRLEN; i += NDEC) {
-    energy += rp[i] * rp[i];
-    corr += rp[i] * l[i];
-  }
-  scale = energy;
-  if (scale < CORRMINPOWER)
-    scale = CORRMINPOWER;
-  corr = corr / (Float) sqrt (scale);
-  bestcorr = corr;
+  for (i = 0; i < nl; i++)
+    energy += rd[i] * rd[i];
+  bestcorr = (Float) 0.;
   bestmatch = 0;
-  for (j = NDEC; j <= PITCHDIFF; j += NDEC) {
-    energy -= rp[0] * rp[0];
-    energy += rp[CORRLEN] * rp[CORRLEN];
-    rp += NDEC;
-    corr = 0.f;
-    for (i = 0; i < CORRLEN; i += NDEC)
-      corr += rp[i] * l[i];
+  for (j = 0; j <= pitchdiff / ndec; j++) {
+    if (j) {
+      energy -= rd[j - 1] * rd[j - 1];
+      energy += rd[j - 1 + nl] * rd[j - 1 + nl];
+    }
     scale = energy;
     if (scale < CORRMINPOWER)
       scale = CORRMINPOWER;
-    corr /= (Float) sqrt (scale);
-    if (corr >= bestcorr) {
-      bestcorr = corr;
-      bestmatch = j;
+    corr[j] = corr[j] / (Float) sqrt (scale);
+    if (j == 0 || corr[j] >= bestcorr) {
+      bestcorr = corr[j];
+      bestmatch = j * ndec;
     }
   }
   /* fine search */
-  j = bestmatch - (NDEC - 1);
+  j = bestmatch - (ndec - 1);
   if (j < 0)
     j = 0;
-  k = bestmatch + (NDEC - 1);
-  if (k > PITCHDIFF)
-    k = PITCHDIFF;
+  k = bestmatch + (ndec - 1);
+  if (k > pitchdiff)
+    k = pitchdiff;
   rp = &r[j];
+  g711plc_xcorr (rp, l, lc->corrlen, k - j + 1, corr);
   energy = 0.f;
-  corr = 0.f;
-  for (i = 0; i < CORRLEN; i++) {
+  for (i = 0; i < lc->corrlen; i++)
     energy += rp[i] * rp[i];
-    corr += rp[i] * l[i];
-  }
-  scale = energy;
-  if (scale < CORRMINPOWER)
-    scale = CORRMINPOWER;
-  corr = corr / (Float) sqrt (scale);
-  bestcorr = corr;
+  bestcorr = (Float) 0.;
   bestmatch = j;
-  for (j++; j <= k; j++) {
-    energy -= rp[0] * rp[0];
-    energy += rp[CORRLEN] * rp[CORRLEN];
-    rp++;
-    corr = 0.f;
-    for (i = 0; i < CORRLEN; i++)
-      corr += rp[i] * l[i];
+  for (i = 0; i <= k - j; i++) {
+    if (i) {
+      energy -= rp[i - 1] * rp[i - 1];
+      energy += rp[i - 1 + lc->corrlen] * rp[i - 1 + lc->corrlen];
+    }
     scale = energy;
     if (scale < CORRMINPOWER)
       scale = CORRMINPOWER;
-    corr = corr / (Float) sqrt (scale);
-    if (corr > bestcorr) {
-      bestcorr = corr;
-      bestmatch = j;
+    corr[i] = corr[i] / (Float) sqrt (scale);
+    if (i == 0 || corr[i] > bestcorr) {
+      bestcorr = corr[i];
+      bestmatch = j + i;
     }
   }
-  return PITCH_MAX - bestmatch;
+  return lc->pitchmax - bestmatch;
+}
+
+#ifdef PLC_HAVE_AVX
+/* Lag-parallel correlation, one lag per lane (no FMA) */
+#ifdef USEDOUBLES
+#define PLC_NLANE 4
+__attribute__ ((target ("avx")))
+static int g711plc_xcorr_avx (Float * r, Float * l, int cnt, int nlag, Float * corr) {
+  int i, q;
+  __m256d acc;
+
+  for (q = 0; q + PLC_NLANE <= nlag; q += PLC_NLANE) {
+    acc = _mm256_setzero_pd ();
+    for (i = 0; i < cnt; i++)
+      acc = _mm256_add_pd (acc, _mm256_mul_pd (_mm256_loadu_pd (&r[q + i]), _mm256_set1_pd (l[i])));
+    _mm256_storeu_pd (&corr[q], acc);
+  }
+  return q;
+}
+#else
+#define PLC_NLANE 8
+__attribute__ ((target ("avx")))
+static int g711plc_xcorr_avx (Float * r, Float * l, int cnt, int nlag, Float * corr) {
+  int i, q;
+  __m256 acc;
+
+  for (q = 0; q + PLC_NLANE <= nlag; q += PLC_NLANE) {
+    acc = _mm256_setzero_ps ();
+    for (i = 0; i < cnt; i++)
+      acc = _mm256_add_ps (acc, _mm256_mul_ps (_mm256_loadu_ps (&r[q + i]), _mm256_set1_ps (l[i])));
+    _mm256_storeu_ps (&corr[q], acc);
+  }
+  return q;
+}
+#endif
+#endif
+
+/*
+ * corr[q] = sum r[q+i]*l[i], i = 0..cnt-1, for the lags q = 0..nlag-1.
+ * Several lags are accumulated side by side; each sum runs over i in
+ * order, as the one-lag-at-a-time loop did.
+ */
+static void g711plc_xcorr (Float * r, Float * l, int cnt, int nlag, Float * corr) {
+  int i, q = 0;
+  Float c0, c1, c2, c3, li;
+
+#ifdef PLC_HAVE_AVX
+  if (__builtin_cpu_supports ("avx"))
+    q = g711plc_xcorr_avx (r, l, cnt, nlag, corr);
+#endif
+  for (; q + 4 <= nlag; q += 4) {
+    c0 = c1 = c2 = c3 = (Float) 0.;
+    for (i = 0; i < cnt; i++) {
+      li = l[i];
+      c0 += r[q + i] * li;
+      c1 += r[q + i + 1] * li;
+      c2 += r[q + i + 2] * li;
+      c3 += r[q + i + 3] * li;
+    }
+    corr[q] = c0;
+    corr[q + 1] = c1;
+    corr[q + 2] = c2;
+    corr[q + 3] = c3;
+  }
+  for (; q < nlag; q++) {
+    c0 = (Float) 0.;
+    for (i = 0; i < cnt; i++)
+      c0 += r[q + i] * l[i];
+    corr[q] = c0;
+  }
 }
 
 static void g711plc_convertsf (short *f, Float * t, int cnt) {
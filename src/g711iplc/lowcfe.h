@@ -1,6 +1,6 @@
 /*
   ============================================================================
-   File: lowcfe.h                                            V.1.0-24.MAY-2005
+   File: lowcfe.h                                            V.1.1-17.OCT-2026
   ============================================================================
 
                      UGST/ITU-T G711 Appendix I PLC MODULE
@@ -10,6 +10,8 @@
    History:
    24.May.05	v1.0	First version <AT&T>
 						Integration in STL2005 <Cyril Guillaume & Stephane Ragot - stephane.ragot@francetelecom.com>
+   17.Oct.26	v1.1	Sampling rate and frame size chosen at construction
+						(g711plc_create); history kept in a ring buffer.
   ============================================================================
 */
 #ifndef __LOWCFE_C_H__
@@ -25,6 +27,7 @@ extern "C" {
   typedef float Float;
 #endif
 
+/* Defaults for 8 kHz; g711plc_create() scales them by rate/8000 */
 #define	PITCH_MIN	40      /* minimum allowed pitch, 200 Hz */
 #define PITCH_MAX	120     /* maximum allowed pitch, 66 Hz */
 #define	PITCHDIFF	(PITCH_MAX - PITCH_MIN)
@@ -38,22 +41,51 @@ extern "C" {
 #define	FRAMESZ		80      /* 10 msec at 8kHz */
 #define	ATTENFAC	((Float).2)     /* attenuation factor per 10ms frame */
 #define	ATTENINCR	(ATTENFAC/FRAMESZ)      /* attenuation per sample */
+#define	XBUFLEN		((CORRBUFLEN + CORRLEN) / NDEC + PITCHDIFF + 1)
+
+#define	PLC_MAXFAC	6       /* highest rate: 6 x 8 kHz = 48 kHz */
 
   typedef struct _LowcFE_c {
-    int erasecnt;               /* consecutive erased frames */
+    /* configuration; all the lengths are in samples at the given rate */
+    long rate;                  /* sampling rate, multiple of 8000 Hz */
+    int framesz;                /* frame size, multiple of unitsz */
+    int unitsz;                 /* 10 msec, the frame of the algorithm */
+    int pitchmin;               /* minimum allowed pitch */
+    int pitchmax;               /* maximum allowed pitch */
+    int poverlapmax;            /* maximum pitch OLA window */
+    int historylen;             /* history buffer length */
+    int ndec;                   /* decimation of the coarse pitch search */
+    int corrlen;                /* 20 msec correlation length */
+    int eoverlapincr;           /* end OLA increment per 10 msec */
+    Float attenincr;            /* attenuation per sample */
+    /* state */
+    int erasecnt;               /* consecutive erased 10 msec units */
     int poverlap;               /* overlap based on pitch */
     int poffset;                /* offset into pitch period */
     int pitch;                  /* pitch estimate */
     int pitchblen;              /* current pitch buffer length */
+    int hpos;                   /* ring position of the oldest history sample */
     Float *pitchbufend;         /* end of pitch buffer */
     Float *pitchbufstart;       /* start of pitch buffer */
-    Float pitchbuf[HISTORYLEN]; /* buffer for cycles of speech */
-    Float lastq[POVERLAPMAX];   /* saved last quarter wavelengh */
-    short history[HISTORYLEN];  /* history buffer */
+    Float *pitchbuf;            /* buffer for cycles of speech */
+    Float *lastq;               /* saved last quarter wavelengh */
+    Float *xbuf;                /* decimated signals and correlations */
+    short *history;             /* history ring buffer, stored twice */
+    short *sbuf;                /* scratch, one 10 msec unit */
+    void *mem;                  /* storage from g711plc_create(), or NULL */
+    /* storage of the 8 kHz instances set up by g711plc_construct() */
+    Float pitchbuf8[HISTORYLEN];
+    Float lastq8[POVERLAPMAX];
+    Float xbuf8[XBUFLEN];
+    short history8[2 * HISTORYLEN];
+    short sbuf8[FRAMESZ];
   } LowcFE_c;
 
-/* public functions */
-  void g711plc_construct (LowcFE_c *);  /* constructor */
+/* public functions; the instances hold pointers to themselves and must
+   not be copied */
+  void g711plc_construct (LowcFE_c *);  /* constructor, 8 kHz, 10 msec */
+  LowcFE_c *g711plc_create (long rate, int framesz);    /* any rate; NULL on error */
+  void g711plc_free (LowcFE_c *);       /* release a g711plc_create() instance */
   void g711plc_dofe (LowcFE_c *, short *s);     /* synthesize speech for erasure */
   void g711plc_addtohistory (LowcFE_c *, short *s);
   /* add a good frame to history buffer */
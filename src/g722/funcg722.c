@@ -42,6 +42,8 @@ History:
                       reformated <simao@ctd.comsat.com>
 10.Jan.07  v3.0       Updated with STL2005 v2.2 basic operators
                       <{balazs.kovesi,stephane.ragot}@orange-ftgroup.com>
+17.Oct.26  v3.1       QMF filters use the V_L_mac0_2() vector operator when
+                      compiled with ENH_VEC_OPERATOR (bit-exact, same WMOPS)
   ============================================================================
 */
 
@@ -1445,12 +1447,23 @@ void qmf_tx (Word16 xin0, Word16 xin1, Word16 * xl, Word16 * xh, g722_state * s)
   move16 ();
   move16 ();
 #endif
+#ifdef ENH_VEC_OPERATOR
+  {
+    /* even taps on accuma, odd taps on accumb, in one vector operator */
+    Word32 accum[2] = { 0, 0 };
+
+    V_L_mac0_2 (accum, pcoef, pdelayx, 24);
+    accuma = accum[0];
+    accumb = accum[1];
+  }
+#else
   accuma = L_mult0 (*pcoef++, *pdelayx++);
   accumb = L_mult0 (*pcoef++, *pdelayx++);
   for (i = 1; i < 12; i++) {
     accuma = L_mac0 (accuma, *pcoef++, *pdelayx++);
     accumb = L_mac0 (accumb, *pcoef++, *pdelayx++);
   }
+#endif
 
   /* Descaling and shift of the delay line */
   for (i = 0; i < 22; i++) {
@@ -1513,12 +1526,23 @@ void qmf_rx (Word16 rl, Word16 rh, Word16 * xout1, Word16 * xout2, g722_state *
   move16 ();
   move16 ();
 #endif
+#ifdef ENH_VEC_OPERATOR
+  {
+    /* even taps on accuma, odd taps on accumb, in one vector operator */
+    Word32 accum[2] = { 0, 0 };
+
+    V_L_mac0_2 (accum, pcoef, pdelayx, 24);
+    accuma = accum[0];
+    accumb = accum[1];
+  }
+#else
   accuma = L_mult0 (*pcoef++, *pdelayx++);
   accumb = L_mult0 (*pcoef++, *pdelayx++);
   for (i = 1; i < 12; i++) {
     accuma = L_mac0 (accuma, *pcoef++, *pdelayx++);
     accumb = L_mac0 (accumb, *pcoef++, *pdelayx++);
   }
+#endif
 
   /* shift delay line */
   for (i = 0; i < 22; i++) {
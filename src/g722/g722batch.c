@@ -0,0 +1,538 @@
+/*                     v1.1 - 17/Oct/2026
+============================================================================
+
+G722BATCH.C
+~~~~~~~~~~~
+
+Description:
+~~~~~~~~~~~~
+
+Batch driver for the UGST/ITU-T G.722 module: encodes or decodes all the
+files of a list with a pool of worker threads, each file with its own
+g722_state, and reports the aggregate throughput.
+
+The output files are byte-identical to the ones of encg722 and decg722
+with the same options. The program is built against the inline,
+counting-free (BASOP_INLINE) and thread-safe (BASOP_THREAD_SAFE) basic
+operators.
+
+The list file has one pair "InpFile OutFile" per line; "#" starts a
+comment. Every thread takes the next file of the list as soon as it is
+free (see ugst-batch.c).
+
+Usage:
+~~~~~~
+$ G722BATCH [-options] ListFile
+
+Options:
+-enc        Encode the listed files (default)
+-dec        Decode the listed files
+-mode   #   Operating mode (1,2,3) (or rate 64, 56, 48 in kbps). Default is
+            mode 1 (= 64 kbps)
+-fsize  #   Number of 16 kHz samples per frame (must be an even number).
+            Default is 160 samples (16 kHz) (10 ms)
+-byte       Legacy byte oriented bit streams (default is g192)
+-plc    #   Decoder PLC algorithm for g192 frame erasures, as in decg722
+            (0,1,2,3). Default is 0
+-threads #  Number of worker threads. Default is 4
+-q          Quiet operation: only the summary is printed
+-h/-help    print help message
+
+Output:
+~~~~~~~
+One CSV line per file (file,output,frames,samples,status), in the order
+of the list, followed by the number of files, the audio duration, the
+wall-clock and CPU times and the speed relative to real time.
+
+Exit value:
+~~~~~~~~~~~
+0 when all the files were processed, 1 otherwise.
+
+History:
+~~~~~~~~
+17.Oct.26  v1.0       Created.
+17.Oct.26  v1.1       List, threads and clock from ugst-batch.c: monotonic
+                      wall clock, files taken from a shared queue.
+============================================================================
+*/
+
+
+/* Standard prototypes */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* G.722- and UGST-specific prototypes */
+#include "g722.h"
+#include "ugstdemo.h"
+#include "g722_com.h"
+
+#include "stl.h"
+
+/* Batch processing of lists of files */
+#include "ugst-batch.h"
+
+/* Parameters common to all the files of a batch */
+typedef struct {
+  int decode;                   /* 0 for encoding, 1 for decoding */
+  short mode;                   /* operating mode 1, 2 or 3 */
+  short N;                      /* frame size, 16 kHz samples */
+  long g192;                    /* 0 for legacy byte streams */
+  long plc;                     /* decoder PLC algorithm */
+} G722B_PARAM;
+
+/* One file of a batch */
+typedef struct {
+  char *FileIn, *FileOut;
+  long frames;                  /* processed frames */
+  int status;                   /* UGST_BATCH_OK, or an error status */
+} G722B_JOB;
+
+/* Data shared by the worker threads */
+typedef struct {
+  G722B_PARAM *par;
+  G722B_JOB *job;
+} G722B_BATCH;
+
+
+void display_usage () {
+  printf ("\n\n");
+  printf ("\n***************************************************************");
+  printf ("\n* BATCH PROCESSING OF THE ITU-T G.722 WIDEBAND SPEECH CODER  *");
+  printf ("\n***************************************************************\n\n");
+
+  printf ("USAGE: \n");
+  printf ("  g722batch [-enc|-dec] [-mode #] [-fsize N] [-byte] [-plc #]\n");
+  printf ("            [-threads #] [-q] ListFile\n\n");
+  printf ("  ListFile has one pair \"InpFile OutFile\" per line.\n\n");
+
+  exit (-128);
+}
+
+/* .................... End of display_usage() ........................... */
+
+
+/*
+  ============================================================================
+
+       void encode_file (G722B_PARAM *par, G722B_JOB *job);
+       ~~~~~~~~~~~~~~~~
+
+       Encodes one file of a batch, frame by frame, in the output format
+       of encg722.
+
+       Log of changes
+       ~~~~~~~~~~~~~~
+       17.Oct.26	v1.0	Creation.
+
+  ============================================================================
+*/
+void encode_file (G722B_PARAM * par, G722B_JOB * job) {
+  g722_state encoder;
+  short code[MAX_BYTESTREAM_BUFFER];    /* analysis data output buffer */
+  short incode[MAX_INPUT_SP_BUFFER];    /* speech input buffer */
+  short outp_frame[2 + MAX_BITLEN_SIZE];        /* g.192 output bit buffer */
+  short mask = (short) 0xFFFF;  /* mode 2, mode 3 bit-mask */
+  long N = par->N, i, j, k, bit, n;
+  FILE *F_inp, *F_cod;
+
+  if ((F_inp = fopen (job->FileIn, RB)) == NULL) {
+    job->status = UGST_BATCH_OPEN_ERROR;
+    return;
+  }
+  if ((F_cod = fopen (job->FileOut, WB)) == NULL) {
+    job->status = UGST_BATCH_CREATE_ERROR;
+    fclose (F_inp);
+    return;
+  }
+  if (par->mode == 2)
+    mask = (short) 0xFFFE;      /* b0 */
+  else if (par->mode == 3)
+    mask = (short) 0xFFFC;      /* b0, b1 */
+
+  g722_reset_encoder (&encoder);
+  while (fread (incode, sizeof (short), N, F_inp) == (size_t) N) {
+    g722_encode (incode, code, N, &encoder);
+    job->frames++;
+
+    if (!par->g192) {
+      /* every 16 kHz input sample yields an output 8 bit 8 kHz sample */
+      for (i = 0; i < (N / 2); i++)
+        code[i] = (code[i] & mask);
+      n = N / 2;
+      if (fwrite (code, sizeof (short), n, F_cod) != (size_t) n) {
+        job->status = UGST_BATCH_WRITE_ERROR;
+        break;
+      }
+    } else {
+      /* [b2*n, b3*n, b4*n, b5*n, b6*n, b7*n, b1*n, b0*n], as in encg722 */
+      outp_frame[0] = G192_SYNC;
+      outp_frame[1] = (short) ((N * (9 - par->mode)) / 2);
+      j = 0;
+      for (bit = 2; bit < 8; bit++)
+        for (i = 0; i < (N / 2); i++, j++)
+          outp_frame[2 + j] = ((code[i] >> bit) & 0x0001) ? G192_ONE : G192_ZERO;
+      k = par->mode - 1;        /* 0, 1 or 2 embedded bits dropped */
+      for (bit = 1; bit >= k; bit--)
+        for (i = 0; i < (N / 2); i++, j++)
+          outp_frame[2 + j] = ((code[i] >> bit) & 0x0001) ? G192_ONE : G192_ZERO;
+      n = 2 + outp_frame[1];
+      if (fwrite (outp_frame, sizeof (short), n, F_cod) != (size_t) n) {
+        job->status = UGST_BATCH_WRITE_ERROR;
+        break;
+      }
+    }
+  }
+
+  fclose (F_inp);
+  if (fclose (F_cod) != 0 && job->status == UGST_BATCH_OK)
+    job->status = UGST_BATCH_WRITE_ERROR;
+}
+
+/* ...................... End of encode_file() .......................... */
+
+
+/* Index memory operations of decg722 */
+static void set_index (short value, short *code, short n_shorts) {
+  long i;
+  for (i = 0; i < n_shorts; i++)
+    code[i] = value;
+}
+
+static void copy_index (short *from, short *to, short n_shorts) {
+  long i;
+  for (i = 0; i < n_shorts; i++)
+    to[i] = from[i];
+}
+
+
+/* Converts a g192 frame into the byte-oriented codewords, as g192_to_byte()
+   of decg722; returns the mode of the frame, or -1 when it has no data */
+static short unpack_g192 (short nb_bits, short *code_byte, short *inp_bits, short N) {
+  long i, j, k;
+  short bit, mask, mode = -1;
+
+  for (i = 0; i < N / 2; i++)
+    code_byte[i] = 0;
+  if (nb_bits == 0)
+    return -1;
+  if (nb_bits == (N / 2) * 8)
+    mode = 1;
+  if (nb_bits == (N / 2) * 7)
+    mode = 2;
+  if (nb_bits == (N / 2) * 6)
+    mode = 3;
+
+  /* hard decisions on the sign bit of the soft bits */
+  j = 0;
+  for (bit = 2; bit < 8; bit++) {
+    mask = (0x0001 << (bit));
+    for (i = 0; i < (N / 2); i++, j++)
+      if (inp_bits[j] & 0x0080)
+        code_byte[i] |= mask;
+  }
+  k = mode == 2 ? 1 : (mode == 3 ? 2 : 0);
+  for (bit = 1; bit >= k; bit--) {
+    mask = (0x0001 << (bit));
+    for (i = 0; i < (N / 2); i++, j++)
+      if (inp_bits[j] & 0x0080)
+        code_byte[i] |= mask;
+  }
+  return mode;
+}
+
+
+/*
+  ============================================================================
+
+       void decode_file (G722B_PARAM *par, G722B_JOB *job);
+       ~~~~~~~~~~~~~~~~
+
+       Decodes one file of a batch, frame by frame, with the index-domain
+       PLC of decg722 for the erased g192 frames.
+
+       Log of changes
+       ~~~~~~~~~~~~~~
+       17.Oct.26	v1.0	Creation.
+
+  ============================================================================
+*/
+void decode_file (G722B_PARAM * par, G722B_JOB * job) {
+  g722_state decoder;
+  short code[MAX_BYTESTREAM_BUFFER];    /* byte stream buffer */
+  short outcode[MAX_OUTPUT_SP_BUFFER];  /* speech buffer */
+  short inp_frame[2 + MAX_BITLEN_SIZE]; /* g192 frame, 1 bit per word */
+  short mem_code[PLC_MEM_SIZE][MAX_BYTESTREAM_BUFFER];  /* index history */
+  short mem_mode[PLC_MEM_SIZE]; /* decoding mode memory */
+  short header[2], N = par->N, local_mode, mode_frame;
+  long fr_size[N_MODES + 1];    /* frame sizes in bits for every mode */
+  long fer_cnt = 0, mem_zero = 0, i;
+  char tmp_type;
+  FILE *F_cod, *F_out;
+
+  if ((F_cod = fopen (job->FileIn, RB)) == NULL) {
+    job->status = UGST_BATCH_OPEN_ERROR;
+    return;
+  }
+  if (par->g192) {
+    /* needs g192 sync headers, checked as in decg722 */
+    if (check_eid_format (F_cod, job->FileIn, &tmp_type) != g192 || fread (header, sizeof (short), 2, F_cod) != 2 || fseek (F_cod, (long) (header[1]) * sizeof (short), SEEK_CUR) != 0 || fread (header, sizeof (short), 2, F_cod) != 2 || (header[0] & 0xFFF0) != (G192_FER & 0xFFF0)) {
+      job->status = UGST_BATCH_FORMAT_ERROR;
+      fclose (F_cod);
+      return;
+    }
+    fseek (F_cod, 0l, SEEK_SET);
+  }
+  if ((F_out = fopen (job->FileOut, WB)) == NULL) {
+    job->status = UGST_BATCH_CREATE_ERROR;
+    fclose (F_cod);
+    return;
+  }
+
+  for (i = 1; i < (N_MODES + 1); i++)
+    fr_size[i] = (N / 2) * (8 + 1 - i);
+  fr_size[0] = -1;
+  for (i = 0; i < PLC_MEM_SIZE; i++) {
+    set_index (ZERO_INDEX, mem_code[i], (short) (fr_size[1] / 8));
+    mem_mode[i] = 1;
+  }
+  g722_reset_decoder (&decoder);
+
+  while (job->status == UGST_BATCH_OK) {
+    if (!par->g192) {
+      /* always 64 kbps codewords, decoded in the mode of the command line */
+      if (fread (code, sizeof (short), N / 2, F_cod) != (size_t) (N / 2))
+        break;
+      local_mode = par->mode;
+    } else {
+      if (fread (header, sizeof (short), 2, F_cod) != 2)
+        break;
+      if (header[1] < 0 || header[1] > MAX_BITLEN_SIZE || fread (inp_frame, sizeof (short), header[1], F_cod) != (size_t) header[1]) {
+        job->status = UGST_BATCH_READ_ERROR;
+        break;
+      }
+      if (!((header[1] == 0) || (header[1] == fr_size[1]) || (header[1] == fr_size[2]) || (header[1] == fr_size[3]))) {
+        job->status = UGST_BATCH_FORMAT_ERROR;
+        break;
+      }
+      mode_frame = unpack_g192 (header[1], code, inp_frame, N);
+      local_mode = mode_frame == -1 ? par->mode : mode_frame;
+
+      /* PLC pre decoding index operations (see decg722) */
+      if (header[0] != G192_SYNC) {
+        fer_cnt++;
+        switch (par->plc) {
+        case 0:
+        case 1:
+          set_index (ZERO_INDEX, code, (short) (fr_size[1] / 8));
+          local_mode = 1;
+          break;
+        case 2:
+        case 3:
+          if (fer_cnt <= PLC_MEM_SIZE) {
+            copy_index (mem_code[fer_cnt - 1], code, (short) (fr_size[mem_mode[fer_cnt - 1]] / 8));
+            local_mode = mem_mode[fer_cnt - 1];
+          } else {
+            set_index (ZERO_INDEX, code, (short) (fr_size[1] / 8));
+            local_mode = 1;
+          }
+          break;
+        }
+        if (fer_cnt > PLC_MEM_SIZE)
+          for (i = 0; i < PLC_MEM_SIZE; i++) {
+            set_index (ZERO_INDEX, mem_code[i], (short) (fr_size[1] / 8));
+            mem_mode[i] = 1;
+          }
+      } else {
+        fer_cnt = 0;
+        for (i = (PLC_MEM_SIZE - 1); i >= 1; i--) {
+          set_index (ZERO_INDEX, mem_code[i], (short) (fr_size[1] / 8));
+          copy_index (mem_code[i - 1], mem_code[i], (short) (fr_size[mem_mode[i - 1]] / 8));
+          mem_mode[i] = mem_mode[i - 1];
+        }
+        copy_index (code, mem_code[0], (short) (fr_size[local_mode] / 8));
+        mem_mode[0] = local_mode;
+        set_index (ZERO_INDEX, code, (short) (mem_zero / 2));
+        mem_zero = 0;
+      }
+    }
+
+    g722_decode (code, outcode, local_mode, (short) (N / 2), &decoder);
+    job->frames++;
+
+    /* PLC post frame synthesis operations */
+    if (par->g192 && header[0] != G192_SYNC) {
+      mem_zero = 0;
+      if (par->plc == 1)
+        g722_reset_decoder (&decoder);
+      else if (par->plc == 3 && fer_cnt <= PLC_MEM_SIZE)
+        mem_zero = 10;          /* silence in the next good frame */
+    }
+
+    if (fwrite (outcode, sizeof (Word16), N, F_out) != (size_t) N)
+      job->status = UGST_BATCH_WRITE_ERROR;
+  }
+
+  fclose (F_cod);
+  if (fclose (F_out) != 0 && job->status == UGST_BATCH_OK)
+    job->status = UGST_BATCH_WRITE_ERROR;
+}
+
+/* ...................... End of decode_file() .......................... */
+
+
+/* Worker: codes the files handed out by the pool */
+static void batch_worker (UGST_BATCH * b) {
+  G722B_BATCH *data = (G722B_BATCH *) b->data;
+  long i;
+
+  while ((i = ugst_batch_next (b)) >= 0)
+    if (data->par->decode)
+      decode_file (data->par, &data->job[i]);
+    else
+      encode_file (data->par, &data->job[i]);
+}
+
+
+/*
+**************************************************************************
+***                                                                    ***
+***        Batch program for encoding or decoding lists of files       ***
+***                                                                    ***
+**************************************************************************
+*/
+int main (int argc, char *argv[]) {
+  G722B_PARAM par;
+  G722B_BATCH data;
+  UGST_BATCH b;
+  UGST_BATCH_FILE *files;
+  G722B_JOB *job;
+  long njob, frames = 0, i;
+  int threads = 4, fail = 0;
+  char quiet = 0;
+  double t0, wall, cpu, audio;
+  clock_t c0;
+
+  par.decode = 0;
+  par.mode = 1;
+  par.N = DEF_FR_SIZE;
+  par.g192 = 1;
+  par.plc = 0;
+
+  /* GETTING OPTIONS */
+  if (argc < 2)
+    display_usage ();
+  while (argc > 1 && argv[1][0] == '-')
+    if (strcmp (argv[1], "-enc") == 0 || strcmp (argv[1], "-dec") == 0) {
+      par.decode = argv[1][1] == 'd';
+      argv++;
+      argc--;
+    } else if (strcmp (argv[1], "-byte") == 0) {
+      par.g192 = 0;
+      argv++;
+      argc--;
+    } else if (strcmp (argv[1], "-q") == 0) {
+      quiet = 1;
+      argv++;
+      argc--;
+    } else if (strcmp (argv[1], "-mode") == 0 && argc > 2) {
+      switch (atoi (argv[2])) {
+      case 1:
+      case 64:
+        par.mode = 1;
+        break;
+      case 2:
+      case 56:
+        par.mode = 2;
+        break;
+      case 3:
+      case 48:
+        par.mode = 3;
+        break;
+      default:
+        fprintf (stderr, "ERROR! Invalid mode \"%s\" in command line\n\n", argv[2]);
+        display_usage ();
+      }
+      argv += 2;
+      argc -= 2;
+    } else if (strcmp (argv[1], "-fsize") == 0 && argc > 2) {
+      i = atoi (argv[2]);
+      if ((i > MAX_INPUT_SP_BUFFER) || (i <= 0) || (i & 0x0001)) {
+        fprintf (stderr, "ERROR! Invalid frame size \"%s\" in command line\n\n", argv[2]);
+        display_usage ();
+      }
+      par.N = (short) i;
+      argv += 2;
+      argc -= 2;
+    } else if (strcmp (argv[1], "-plc") == 0 && argc > 2) {
+      par.plc = atoi (argv[2]);
+      if ((par.plc < 0) || (par.plc > MAX_PLC)) {
+        fprintf (stderr, "ERROR! Invalid plc \"%s\" in command line\n\n", argv[2]);
+        display_usage ();
+      }
+      argv += 2;
+      argc -= 2;
+    } else if (strcmp (argv[1], "-threads") == 0 && argc > 2) {
+      threads = atoi (argv[2]);
+      if (threads < 1 || threads > UGST_BATCH_MAX_THREADS) {
+        fprintf (stderr, "ERROR! Invalid number of threads \"%s\" (1..%d)\n\n", argv[2], UGST_BATCH_MAX_THREADS);
+        display_usage ();
+      }
+      argv += 2;
+      argc -= 2;
+    } else if (strcmp (argv[1], "-h") == 0 || strcmp (argv[1], "-help") == 0) {
+      display_usage ();
+    } else {
+      fprintf (stderr, "ERROR! Invalid option \"%s\" in command line\n\n", argv[1]);
+      display_usage ();
+    }
+  if (argc != 2)
+    display_usage ();
+
+  /* Read the list of files */
+  if ((njob = ugst_batch_read_list (argv[1], &files)) < 0)
+    exit (1);
+  if ((job = (G722B_JOB *) calloc (njob + 1, sizeof (G722B_JOB))) == NULL)
+    HARAKIRI ("Can't allocate memory for the list of files\n", 1);
+  for (i = 0; i < njob; i++) {
+    job[i].FileIn = files[i].FileIn;
+    job[i].FileOut = files[i].FileOut;
+  }
+
+  /* Run the workers */
+  data.par = &par;
+  data.job = job;
+  t0 = ugst_batch_clock ();
+  c0 = clock ();
+  if ((threads = ugst_batch_run (&b, njob, threads, batch_worker, &data)) < 0)
+    HARAKIRI ("Unable to create thread\n", 1);
+  wall = ugst_batch_clock () - t0;
+  cpu = (double) (clock () - c0) / CLOCKS_PER_SEC;
+
+  /* Report, in the order of the list */
+  if (!quiet)
+    printf ("file,output,frames,samples,status\n");
+  for (i = 0; i < njob; i++) {
+    if (!quiet)
+      printf ("%s,%s,%ld,%ld,%s\n", job[i].FileIn, job[i].FileOut, job[i].frames, job[i].frames * par.N, ugst_batch_status (job[i].status));
+    if (job[i].status != UGST_BATCH_OK) {
+      if (quiet)
+        fprintf (stderr, "%s: %s\n", job[i].FileIn, ugst_batch_status (job[i].status));
+      fail++;
+    }
+    frames += job[i].frames;
+  }
+  audio = (double) frames *par.N / 16000.0;
+  printf ("# %s %ld files (%d failed), %ld frames, %.1f s of audio, %d threads\n", par.decode ? "Decoded" : "Encoded", njob, fail, frames, audio, threads);
+  printf ("# wall %.3f s, cpu %.3f s", wall, cpu);
+  if (wall > 0)
+    printf (", %.1f x real time", audio / wall);
+  printf ("\n");
+
+  free (job);
+  free (files);
+  return fail ? 1 : 0;
+}
+
+/* ............................. end of main() ............................. */
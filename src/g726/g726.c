@@ -39,6 +39,9 @@ HISTORY:
                   processing of test vector ri40fa. Corrected code
                   provided by Jayesh Patel <jayesh@dspse.com>.
 		  Verified by <simao.campos@labs.comsat.com>
+17.Oct.2026 v2.1  Added the multi-channel batch functions G726_batch_*().
+17.Oct.2026 v2.2  AVX2 path for the batch functions, 8 channels per
+                  vector, selected at run time.
 
 FUNCTIONS:
 Public:
@@ -46,6 +49,16 @@ Public:
 
   G726_decode ..... G726 decoder function;
 
+  G726_batch_init . allocate the state of a batch of channels;
+
+  G726_batch_reset  reset one channel of a batch;
+
+  G726_batch_free . release the state of a batch of channels;
+
+  G726_batch_encode G726 encoder function for a batch of channels;
+
+  G726_batch_decode G726 decoder function for a batch of channels;
+
 Private:
   G726_accum ...... addition of predictor outputs to form the partial
                     signal estimate (from the sixth order predictor) and
@@ -156,8 +169,16 @@ Private:
 /*
  *  .................. INCLUDES ..................
  */
+#include <stdlib.h>
 #include "g726.h"
 
+/* AVX2 path of the batch functions: compiled with a target attribute and
+   selected at run time, so the module still runs on any x86 processor */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(__INTEL_COMPILER)
+#define G726_HAVE_AVX2
+#include <immintrin.h>
+#endif
+
 
 /*
  *  .................. FUNCTIONS ..................
@@ -3224,4 +3245,1059 @@ void G726_sync (short rate, short *i, short *sp, short *dlnx, short *dsx, char *
 
 /* ........................ end of G726_sync() ........................  */
 
+
+/*
+ *  ............ MULTI-CHANNEL (BATCH) FUNCTIONS ............
+ *
+ * The functions below run the same algorithm as G726_encode() and
+ * G726_decode() for a batch of channels. The state of the batch is kept
+ * in structure-of-arrays layout (one array per state variable, indexed by
+ * channel) and the samples of all the channels are interleaved, so that
+ * all the channels are advanced together, one sample at a time. The
+ * blocks of G.726 are written out inline on plain integers. On processors
+ * with AVX2, the channels are coded 8 at a time in the lanes of a vector
+ * (G726_batch_avx2()); the remaining channels, and all of them on other
+ * processors, use the scalar loop. The results are bit-exact with the
+ * per-channel functions.
+ */
+
+/* Tables depending on the rate; the quantizer (4.2.2) and the
+   synchronous coding adjustment (4.2.8) use the same decision levels */
+typedef struct {
+  short shift;                  /* bits per ADPCM sample minus 1 */
+  short zfix;                   /* 1 if code 0 is replaced by the maximum */
+  short nthr;                   /* number of decision levels */
+  short thr[16];                /* decision levels for dln, increasing */
+  short quan[17];               /* quantizer output in each interval */
+  short sync[17];               /* `id' of Tables 16-19/G.726 in each interval */
+  short dqln[32];               /* reconstruction (G726_reconst) */
+  short wi[16];                 /* scale factor multiplier (G726_functw) */
+  short fi[16];                 /* F(I) (G726_functf) */
+} G726_RATE_TAB;
+
+static G726_RATE_TAB G726_rate_tab[4] = {
+  /* 16 kbit/s */
+  {1, 0, 2,
+   {261, 2048},
+   {0, 1, 0},
+   {2, 3, 2},
+   {116, 365, 365, 116},
+   {4074, 439},
+   {0, 7}},
+  /* 24 kbit/s */
+  {2, 1, 4,
+   {8, 218, 331, 2048},
+   {7, 1, 2, 3, 7},
+   {3, 5, 6, 7, 3},
+   {2048, 135, 273, 373, 373, 273, 135, 2048},
+   {4092, 30, 137, 582},
+   {0, 1, 2, 7}},
+  /* 32 kbit/s */
+  {3, 1, 8,
+   {80, 178, 246, 300, 349, 400, 2048, 3972},
+   {1, 2, 3, 4, 5, 6, 7, 15, 1},
+   {9, 10, 11, 12, 13, 14, 15, 7, 9},
+   {2048, 4, 135, 213, 273, 323, 373, 425, 425, 373, 323, 273, 213, 135, 4, 2048},
+   {4084, 18, 41, 64, 112, 198, 355, 1122},
+   {0, 0, 0, 1, 1, 1, 3, 7}},
+  /* 40 kbit/s */
+  {4, 1, 16,
+   {68, 139, 198, 250, 298, 339, 378, 413, 445, 475, 502, 528, 553, 2048, 3974, 4080},
+   {2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 31, 1, 2},
+   {18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 15, 17, 18},
+   {2048, 4030, 28, 104, 169, 224, 274, 318, 358, 395, 429, 459, 488, 514, 539, 566,
+    566, 539, 514, 488, 459, 429, 395, 358, 318, 274, 224, 169, 104, 28, 4030, 2048},
+   {14, 14, 24, 39, 40, 41, 58, 100, 141, 179, 219, 280, 358, 440, 529, 696},
+   {0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 2, 3, 4, 5, 6, 6}}
+};
+
+
+/* Number of significant bits of m (0 <= m < 32768): the exponent
+   computed by the if-chains of G726_floata(), G726_floatb() etc. */
+static int G726_nbits (int m) {
+  return (m >= 1) + (m >= 2) + (m >= 4) + (m >= 8) + (m >= 16) + (m >= 32) + (m >= 64) + (m >= 128) + (m >= 256) + (m >= 512) + (m >= 1024) + (m >= 2048) + (m >= 4096) + (m >= 8192) + (m >= 16384);
+}
+
+
+/* G726_fmult() on values */
+static int G726_bfmult (int An, int SRn) {
+  int an, ans, anmag, anexp, anmant, srn, wans, wanexp, wanmant, wanmag;
+
+  an = An & 65535;
+  srn = SRn & 65535;
+  ans = an >> 15;
+  anmag = (ans == 0) ? (an >> 2) : ((16384 - (an >> 2)) & 8191);
+  anexp = G726_nbits (anmag);
+  anmant = (anmag == 0) ? 32 : ((anmag << 6) >> anexp);
+
+  wans = (srn >> 10) ^ ans;
+  wanexp = ((srn >> 6) & 15) + anexp;
+  wanmant = (((srn & 63) * anmant) + 48) >> 4;
+  wanmag = (wanexp <= 26) ? ((wanmant << 7) >> (26 - wanexp)) : (((wanmant << 7) << (wanexp - 26)) & 32767);
+  return (short) ((wans == 0) ? wanmag : ((65536 - wanmag) & 65535));
+}
+
+
+/* G726_expand() on values */
+static int G726_bexpand (int s, int alaw) {
+  int s1, sig, iexp, mant, ss, sss, ssq;
+
+  s1 = s ^ 128;
+  if (alaw) {
+    sig = (s1 >= 128) ? 4096 : 0;
+    s1 = (s1 >= 128) ? s1 - 128 : s1;
+    iexp = s1 / 16;
+    mant = s1 - (iexp << 4);
+    ss = (iexp == 0) ? ((mant << 1) + 1 + sig) : ((1 << (iexp - 1)) * ((mant << 1) + 33) + sig);
+    sss = ss / 4096;
+    ssq = (ss & 4095) << 1;
+  } else {
+    sig = (s1 >= 128) ? 8192 : 0;
+    s1 = ((s1 >= 128) ? s1 - 128 : s1) ^ 127;
+    iexp = s1 / 16;
+    mant = s1 - (iexp << 4);
+    ss = (iexp == 0) ? ((mant << 1) + sig) : ((1 << iexp) * ((mant << 1) + 33) - 33 + sig);
+    sss = ss / 8192;
+    ssq = ss & 8191;
+  }
+  return (sss == 0) ? ssq : ((16384 - ssq) & 16383);
+}
+
+
+/* G726_subta() on values */
+static int G726_bsubta (int sl, int se) {
+  int sli, sei;
+
+  sli = ((sl >> 13) == 0) ? sl : (sl + 49152);
+  sei = ((se >> 14) == 0) ? se : (se + 32768);
+  return (short) ((sli + 65536 - sei) & 65535);
+}
+
+
+/* G726_log() on values: returns dl; the sign ds is (d >> 15) */
+static int G726_blog (int d) {
+  int dqm, exp_;
+
+  dqm = (d >> 15) ? ((65536 - d) & 32767) : d;
+  exp_ = G726_nbits (dqm >> 1);
+  return (exp_ << 7) + (((dqm << 7) >> exp_) & 127);
+}
+
+
+/* G726_floata()/G726_floatb() after the conversion to sign and magnitude */
+static int G726_bfloat (int sign, int mag) {
+  int exp_ = G726_nbits (mag);
+
+  return (sign << 10) + (exp_ << 6) + ((mag == 0) ? 32 : ((mag << 6) >> exp_));
+}
+
+
+/* G726_compress() on values */
+static int G726_bcompress (int sr, int alaw) {
+  int is, im, imag, iesp, nb, sh;
+
+  is = sr >> 15;
+  im = (is == 0) ? (sr & 65535) : ((65536 - (sr & 65535)) & 32767);
+  if (alaw) {
+    im = (sr == -32768) ? 2 : im;
+    imag = (is == 0) ? (im >> 1) : (((im + 1) >> 1) - 1);
+    imag = (imag > 4095) ? 4095 : imag;
+    /* the loop of G726_compress() shifts imag left until bit 12 is set,
+       at most 7 times; iesp is 8 minus the number of shifts */
+    nb = G726_nbits (imag);
+    sh = (nb >= 12) ? 1 : 13 - nb;
+    iesp = (sh > 7) ? 0 : 8 - sh;
+    imag = ((imag << ((sh > 7) ? 7 : sh)) & 4095) >> 8;
+    return ((is == 0) ? imag + (iesp << 4) : imag + (iesp << 4) + 128) ^ 128;
+  } else {
+    imag = ((im > 8158) ? 8158 : im) + 1;
+    /* segment: the loop of G726_compress() stops at the first iesp
+       for which imag <= 2^(iesp+6) - 33 */
+    iesp = G726_nbits (imag + 32) - 6;
+    imag = (imag - ((1 << (iesp + 5)) - 32)) >> (iesp + 1);
+    return ((is == 0) ? (imag + (iesp << 4)) : (imag + (iesp << 4) + 128)) ^ 255;
+  }
+}
+
+
+/* Part of G726_sync() after the computation of `id' and `im' */
+static int G726_bsync (int id, int im, int sp, int alaw) {
+  int ss, mask, gt, lt;
+
+  ss = (sp & 128) >> 7;
+  mask = sp & 127;
+  gt = id > im;
+  lt = id < im;
+  if (alaw) {
+    if (gt && ss == 1 && mask == 0)
+      ss = 0;
+    else if (gt && ss == 1 && mask != 0)
+      mask--;
+    else if (gt && ss == 0 && mask != 127)
+      mask++;
+    else if (lt && ss == 1 && mask != 127)
+      mask++;
+    else if (lt && ss == 0 && mask == 0)
+      ss = 1;
+    else if (lt && ss == 0 && mask != 0)
+      mask--;
+  } else {
+    if (gt && ss == 1 && mask == 127) {
+      ss = 0;
+      mask--;
+    } else if (gt && ss == 1 && mask != 127)
+      mask++;
+    else if (gt && ss == 0 && mask != 0)
+      mask--;
+    else if (lt && ss == 1 && mask != 0)
+      mask--;
+    else if (lt && ss == 0 && mask == 127)
+      ss = 1;
+    else if (lt && ss == 0 && mask != 127)
+      mask++;
+  }
+  return mask + (ss << 7);
+}
+
+
+/*
+  ----------------------------------------------------------------------------
+
+        G726_batch_state *G726_batch_init (long nch);
+        ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Allocate the state of a batch of `nch' G726 channels (either
+        encoders or decoders) and reset all of them.
+
+        Return value:
+        ~~~~~~~~~~~~~
+        Pointer to the state, or NULL if the memory could not be
+        allocated.
+
+        Prototype:      in file g726.h
+        ~~~~~~~~~~
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0  Created.
+
+ ----------------------------------------------------------------------------
+*/
+G726_batch_state *G726_batch_init (long nch) {
+  G726_batch_state *st;
+  int *p;
+  long k;
+  int n;
+
+  if (nch < 1 || (st = (G726_batch_state *) malloc (sizeof (G726_batch_state))) == NULL)
+    return NULL;
+  if ((st->mem = (int *) calloc (G726_BATCH_NVAR * nch, sizeof (int))) == NULL) {
+    free (st);
+    return NULL;
+  }
+  st->nch = nch;
+
+  p = st->mem;
+  st->sr0 = p, p += nch;
+  st->sr1 = p, p += nch;
+  st->a1r = p, p += nch;
+  st->a2r = p, p += nch;
+  for (n = 0; n < 6; n++)
+    st->br[n] = p, p += nch;
+  for (n = 0; n < 6; n++)
+    st->dq[n] = p, p += nch;
+  st->dmsp = p, p += nch;
+  st->dmlp = p, p += nch;
+  st->apr = p, p += nch;
+  st->yup = p, p += nch;
+  st->tdr = p, p += nch;
+  st->pk0 = p, p += nch;
+  st->pk1 = p, p += nch;
+  st->ylp = p;
+
+  for (k = 0; k < nch; k++)
+    G726_batch_reset (st, k);
+  return st;
+}
+
+/* ...................... end of G726_batch_init() ...................... */
+
+
+/*
+  ----------------------------------------------------------------------------
+
+        void G726_batch_reset (G726_batch_state *st, long ch);
+        ~~~~~~~~~~~~~~~~~~~~~
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Reset channel `ch' of a batch. The state is set to the values
+        that the delay blocks (G726_delaya() to G726_delayd()) output
+        when the reset is active, so that the next sample is processed
+        as G726_encode()/G726_decode() do with r equal to 1.
+
+        Return value:
+        ~~~~~~~~~~~~~
+        None.
+
+        Prototype:      in file g726.h
+        ~~~~~~~~~~
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0  Created.
+
+ ----------------------------------------------------------------------------
+*/
+void G726_batch_reset (G726_batch_state * st, long ch) {
+  int n;
+
+  st->sr0[ch] = st->sr1[ch] = 32;
+  st->a1r[ch] = st->a2r[ch] = 0;
+  for (n = 0; n < 6; n++) {
+    st->br[n][ch] = 0;
+    st->dq[n][ch] = 32;
+  }
+  st->dmsp[ch] = st->dmlp[ch] = st->apr[ch] = 0;
+  st->yup[ch] = 544;
+  st->ylp[ch] = 34816;
+  st->tdr[ch] = 0;
+  st->pk0[ch] = st->pk1[ch] = 0;
+}
+
+/* ...................... end of G726_batch_reset() ...................... */
+
+
+/*
+  ----------------------------------------------------------------------------
+
+        void G726_batch_free (G726_batch_state *st);
+        ~~~~~~~~~~~~~~~~~~~~
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Release the memory of the state of a batch of channels.
+
+        Return value:
+        ~~~~~~~~~~~~~
+        None.
+
+        Prototype:      in file g726.h
+        ~~~~~~~~~~
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0  Created.
+
+ ----------------------------------------------------------------------------
+*/
+void G726_batch_free (G726_batch_state * st) {
+  if (st != NULL) {
+    free (st->mem);
+    free (st);
+  }
+}
+
+/* ...................... end of G726_batch_free() ...................... */
+
+
+/* Parameters of a batch call: the tables of G726_rate_tab[] widened to
+   int, as the AVX2 path loads them with 32-bit gathers */
+typedef struct {
+  int shift, zfix, nthr, m, nmax, leak, param, alaw;
+  int thr[16], quan[17], sync[17], dqln[32], wi[16], fi[16];
+} G726_BATCH_PAR;
+
+
+#ifdef G726_HAVE_AVX2
+/*
+ * ......... AVX2 path: 8 channels in the lanes of a vector .........
+ *
+ * The functions below are the blocks of G726_batch_code() on 8 channels
+ * at a time, with a select (_mm256_blendv_epi8) wherever the scalar code
+ * has a conditional expression. All the values fit in 32-bit lanes.
+ */
+#define G726_AVX2 __attribute__ ((target ("avx2")))
+
+#define V_C(c)       _mm256_set1_epi32 (c)
+#define V_ADD(a, b)  _mm256_add_epi32 (a, b)
+#define V_SUB(a, b)  _mm256_sub_epi32 (a, b)
+#define V_MUL(a, b)  _mm256_mullo_epi32 (a, b)
+#define V_AND(a, c)  _mm256_and_si256 (a, V_C (c))
+#define V_OR(a, b)   _mm256_or_si256 (a, b)
+#define V_XOR(a, b)  _mm256_xor_si256 (a, b)
+#define V_SHL(a, n)  _mm256_slli_epi32 (a, n)
+#define V_SHR(a, n)  _mm256_srli_epi32 (a, n)
+#define V_SHLV(a, n) _mm256_sllv_epi32 (a, n)
+#define V_SHRV(a, n) _mm256_srlv_epi32 (a, n)
+#define V_EQ(a, b)   _mm256_cmpeq_epi32 (a, b)
+#define V_GT(a, b)   _mm256_cmpgt_epi32 (a, b)
+#define V_GE(a, b)   _mm256_cmpgt_epi32 (a, V_SUB (b, V_C (1)))
+#define V_NOT(a)     _mm256_xor_si256 (a, V_C (-1))
+#define V_SEL(m, a, b) _mm256_blendv_epi8 (b, a, m)     /* m ? a : b */
+#define V_BIT(m)     _mm256_srli_epi32 (m, 31)  /* mask to 0/1 */
+#define V_SHORT(a)   _mm256_srai_epi32 (_mm256_slli_epi32 (a, 16), 16)
+#define V_LOAD(p)    _mm256_loadu_si256 ((__m256i *) (p))
+#define V_STORE(p, a) _mm256_storeu_si256 ((__m256i *) (p), a)
+#define V_TAB(t, i)  _mm256_i32gather_epi32 (t, i, 4)
+
+
+/* G726_nbits(): the exponent of the float conversion, exact below 2^24 */
+static G726_AVX2 __m256i G726_vnbits (__m256i m) {
+  __m256i e = V_SUB (V_SHR (_mm256_castps_si256 (_mm256_cvtepi32_ps (m)), 23), V_C (126));
+
+  return _mm256_max_epi32 (e, V_C (0));
+}
+
+
+/* G726_bfmult() */
+static G726_AVX2 __m256i G726_vfmult (__m256i An, __m256i SRn) {
+  __m256i an, ans, anmag, anexp, anmant, srn, wans, wanexp, wanmant, wanmag;
+
+  an = V_AND (An, 65535);
+  srn = V_AND (SRn, 65535);
+  ans = V_SHR (an, 15);
+  anmag = V_SEL (V_EQ (ans, V_C (0)), V_SHR (an, 2), V_AND (V_SUB (V_C (16384), V_SHR (an, 2)), 8191));
+  anexp = G726_vnbits (anmag);
+  anmant = V_SEL (V_EQ (anmag, V_C (0)), V_C (32), V_SHRV (V_SHL (anmag, 6), anexp));
+
+  wans = V_XOR (V_SHR (srn, 10), ans);
+  wanexp = V_ADD (V_AND (V_SHR (srn, 6), 15), anexp);
+  wanmant = V_SHR (V_ADD (V_MUL (V_AND (srn, 63), anmant), V_C (48)), 4);
+  wanmag = V_SEL (V_GT (wanexp, V_C (26)), V_AND (V_SHLV (V_SHL (wanmant, 7), V_SUB (wanexp, V_C (26))), 32767), V_SHRV (V_SHL (wanmant, 7), V_SUB (V_C (26), wanexp)));
+  return V_SHORT (V_SEL (V_EQ (wans, V_C (0)), wanmag, V_AND (V_SUB (V_C (65536), wanmag), 65535)));
+}
+
+
+/* G726_bexpand() */
+static G726_AVX2 __m256i G726_vexpand (__m256i s, int alaw) {
+  __m256i s1, neg, sig, iexp, mant, ss, sss, ssq, zero = V_C (0);
+
+  s1 = V_XOR (s, V_C (128));
+  neg = V_GT (s1, V_C (127));
+  s1 = V_SEL (neg, V_SUB (s1, V_C (128)), s1);
+  if (alaw) {
+    sig = V_AND (neg, 4096);
+    iexp = V_SHR (s1, 4);
+    mant = V_AND (s1, 15);
+    ss = V_SEL (V_EQ (iexp, zero), V_ADD (V_ADD (V_SHL (mant, 1), V_C (1)), sig), V_ADD (V_SHLV (V_ADD (V_SHL (mant, 1), V_C (33)), V_SUB (iexp, V_C (1))), sig));
+    sss = V_SHR (ss, 12);
+    ssq = V_SHL (V_AND (ss, 4095), 1);
+  } else {
+    sig = V_AND (neg, 8192);
+    s1 = V_XOR (s1, V_C (127));
+    iexp = V_SHR (s1, 4);
+    mant = V_AND (s1, 15);
+    ss = V_SEL (V_EQ (iexp, zero), V_ADD (V_SHL (mant, 1), sig), V_ADD (V_SUB (V_SHLV (V_ADD (V_SHL (mant, 1), V_C (33)), iexp), V_C (33)), sig));
+    sss = V_SHR (ss, 13);
+    ssq = V_AND (ss, 8191);
+  }
+  return V_SEL (V_EQ (sss, zero), ssq, V_AND (V_SUB (V_C (16384), ssq), 16383));
+}
+
+
+/* G726_bsubta() */
+static G726_AVX2 __m256i G726_vsubta (__m256i sl, __m256i se) {
+  __m256i sli, sei, zero = V_C (0);
+
+  sli = V_SEL (V_EQ (V_SHR (sl, 13), zero), sl, V_ADD (sl, V_C (49152)));
+  sei = V_SEL (V_EQ (V_SHR (se, 14), zero), se, V_ADD (se, V_C (32768)));
+  return V_SHORT (V_AND (V_SUB (V_ADD (sli, V_C (65536)), sei), 65535));
+}
+
+
+/* G726_blog() */
+static G726_AVX2 __m256i G726_vlog (__m256i d) {
+  __m256i dqm, exp_;
+
+  dqm = V_SEL (V_GT (V_C (0), d), V_AND (V_SUB (V_C (65536), d), 32767), d);
+  exp_ = G726_vnbits (V_SHR (dqm, 1));
+  return V_ADD (V_SHL (exp_, 7), V_AND (V_SHRV (V_SHL (dqm, 7), exp_), 127));
+}
+
+
+/* G726_bfloat() */
+static G726_AVX2 __m256i G726_vfloat (__m256i sign, __m256i mag) {
+  __m256i exp_ = G726_vnbits (mag);
+
+  return V_ADD (V_ADD (V_SHL (sign, 10), V_SHL (exp_, 6)), V_SEL (V_EQ (mag, V_C (0)), V_C (32), V_SHRV (V_SHL (mag, 6), exp_)));
+}
+
+
+/* G726_bcompress() */
+static G726_AVX2 __m256i G726_vcompress (__m256i sr, int alaw) {
+  __m256i pos, im, imag, iesp, nb, sh;
+
+  pos = V_GT (sr, V_C (-1));
+  im = V_SEL (pos, V_AND (sr, 65535), V_AND (V_SUB (V_C (65536), V_AND (sr, 65535)), 32767));
+  if (alaw) {
+    im = V_SEL (V_EQ (sr, V_C (-32768)), V_C (2), im);
+    imag = V_SEL (pos, V_SHR (im, 1), V_SUB (V_SHR (V_ADD (im, V_C (1)), 1), V_C (1)));
+    imag = _mm256_min_epi32 (imag, V_C (4095));
+    nb = G726_vnbits (imag);
+    sh = V_SEL (V_GT (nb, V_C (11)), V_C (1), V_SUB (V_C (13), nb));
+    iesp = V_SEL (V_GT (sh, V_C (7)), V_C (0), V_SUB (V_C (8), sh));
+    imag = V_SHR (V_AND (V_SHLV (imag, _mm256_min_epi32 (sh, V_C (7))), 4095), 8);
+    return V_XOR (V_ADD (V_ADD (imag, V_SHL (iesp, 4)), _mm256_andnot_si256 (pos, V_C (128))), V_C (128));
+  } else {
+    imag = V_ADD (_mm256_min_epi32 (im, V_C (8158)), V_C (1));
+    iesp = V_SUB (G726_vnbits (V_ADD (imag, V_C (32))), V_C (6));
+    imag = V_SHRV (V_SUB (imag, V_SUB (V_SHLV (V_C (1), V_ADD (iesp, V_C (5))), V_C (32))), V_ADD (iesp, V_C (1)));
+    return V_XOR (V_ADD (V_ADD (imag, V_SHL (iesp, 4)), _mm256_andnot_si256 (pos, V_C (128))), V_C (255));
+  }
+}
+
+
+/* G726_bsync(): the cases of the if-chains are mutually exclusive */
+static G726_AVX2 __m256i G726_vsync (__m256i id, __m256i im, __m256i sp, int alaw) {
+  __m256i ss1, mask, gt, lt, m0, m127, inc, dec, set0, set1;
+
+  ss1 = V_EQ (V_AND (sp, 128), V_C (128));
+  mask = V_AND (sp, 127);
+  gt = V_GT (id, im);
+  lt = V_GT (im, id);
+  m0 = V_EQ (mask, V_C (0));
+  m127 = V_EQ (mask, V_C (127));
+  if (alaw) {
+    set0 = _mm256_and_si256 (_mm256_and_si256 (gt, ss1), m0);
+    set1 = _mm256_andnot_si256 (ss1, _mm256_and_si256 (lt, m0));
+    dec = _mm256_andnot_si256 (m0, V_OR (_mm256_and_si256 (gt, ss1), _mm256_andnot_si256 (ss1, lt)));
+    inc = _mm256_andnot_si256 (m127, V_OR (_mm256_andnot_si256 (ss1, gt), _mm256_and_si256 (lt, ss1)));
+  } else {
+    set0 = _mm256_and_si256 (_mm256_and_si256 (gt, ss1), m127);
+    set1 = _mm256_andnot_si256 (ss1, _mm256_and_si256 (lt, m127));
+    dec = V_OR (set0, _mm256_andnot_si256 (m0, V_OR (_mm256_andnot_si256 (ss1, gt), _mm256_and_si256 (lt, ss1))));
+    inc = _mm256_andnot_si256 (m127, V_OR (_mm256_and_si256 (gt, ss1), _mm256_andnot_si256 (ss1, lt)));
+  }
+  /* masks are -1: subtracting inc adds one */
+  mask = V_ADD (V_SUB (mask, inc), dec);
+  ss1 = _mm256_andnot_si256 (set0, V_OR (ss1, set1));
+  return V_ADD (mask, V_AND (ss1, 128));
+}
+
+
+/* Quantizer decision (G.726 4.2.2 and 4.2.8): interval of dln, mapped by tab[] */
+static G726_AVX2 __m256i G726_vquan (__m256i dln, G726_BATCH_PAR * p, int *tab) {
+  __m256i i = V_C (0);
+  int n;
+
+  for (n = 0; n < p->nthr; n++)
+    i = V_SUB (i, V_GE (dln, V_C (p->thr[n])));
+  return V_TAB (tab, i);
+}
+
+
+/*
+ * One sample of the channels 0 to 8*floor(nch/8)-1, as in the loop body
+ * of G726_batch_code(); returns the number of channels processed.
+ */
+static G726_AVX2 long G726_batch_avx2 (int enc, short *inp, short *out, G726_BATCH_PAR * p, G726_batch_state * st) {
+  long nch = st->nch, k;
+  int n;
+  __m256i zero = V_C (0), one = V_C (1), nmax = V_C (p->nmax), m = V_C (p->m);
+  __m256i sr1, sr2, a1, a2, wa1, wa2, dqo[6], b[6], sezi, sei, se, sez, d, dms, dml, ap, al;
+  __m256i yu, yl, dif, difs, difm, prod, y, i, dqln, dqs, dql, dq, dqmag, td, ylint, ylfrac, thr, tr;
+  __m256i is, im, fi, difsx, dmsp, dmlp, wi, yut, yup, pk0, pk1, pk2, dqi, dqsez, sigpk, sr, srneg;
+  __m256i sp, id, a11, a21, fa1, fa, uga2b, uga2, ula2, a2t, a2p, ula1, a1t, a1ul, a1ll, a1p;
+  __m256i tdp, ax, app, u, bb, ugb, ulb, tr0, dqsign;
+
+  for (k = 0; k + 8 <= nch; k += 8) {
+    /* Process `known-state' part of 4.2.6 */
+    sr2 = V_LOAD (st->sr1 + k);
+    sr1 = V_LOAD (st->sr0 + k);
+    V_STORE (st->sr1 + k, sr1);
+    a2 = V_LOAD (st->a2r + k);
+    a1 = V_LOAD (st->a1r + k);
+    wa2 = G726_vfmult (a2, sr2);
+    wa1 = G726_vfmult (a1, sr1);
+
+    /* dqo[n] is the quantized difference with delay n+1 after the shift */
+    for (n = 0; n < 6; n++)
+      dqo[n] = V_LOAD (st->dq[n] + k);
+    for (n = 5; n > 0; n--)
+      V_STORE (st->dq[n] + k, dqo[n - 1]);
+    for (n = 0; n < 6; n++)
+      b[n] = V_LOAD (st->br[n] + k);
+
+    /* G726_accum() */
+    sezi = V_AND (V_ADD (G726_vfmult (b[0], dqo[0]), G726_vfmult (b[1], dqo[1])), 65535);
+    for (n = 2; n < 6; n++)
+      sezi = V_AND (V_ADD (sezi, G726_vfmult (b[n], dqo[n])), 65535);
+    sei = V_AND (V_ADD (V_AND (V_ADD (sezi, wa2), 65535), wa1), 65535);
+    sez = V_SHR (sezi, 1);
+    se = V_SHR (sei, 1);
+
+    /* Process 4.2.1 (encoder) */
+    d = zero;
+    if (enc)
+      d = G726_vsubta (G726_vexpand (V_XOR (_mm256_cvtepi16_epi32 (_mm_loadu_si128 ((__m128i *) (inp + k))), V_C (p->alaw ? 85 : 0)), p->alaw), se);
+
+    /* Process delays and `know-state' part of 4.2.5 */
+    dms = V_LOAD (st->dmsp + k);
+    dml = V_LOAD (st->dmlp + k);
+    ap = V_LOAD (st->apr + k);
+    al = V_SEL (V_GT (ap, V_C (255)), V_C (64), V_SHR (ap, 2));
+
+    /* Process `know-state' parts of 4.2.4: G726_mix() */
+    yu = V_LOAD (st->yup + k);
+    yl = V_LOAD (st->ylp + k);
+    dif = V_AND (V_SUB (V_ADD (yu, V_C (16384)), V_SHR (yl, 6)), 16383);
+    difs = V_EQ (V_SHR (dif, 13), zero);
+    difm = V_SEL (difs, dif, V_AND (V_SUB (V_C (16384), dif), 8191));
+    prod = V_SHR (V_MUL (difm, al), 6);
+    prod = V_SEL (difs, prod, V_AND (V_SUB (V_C (16384), prod), 16383));
+    y = V_AND (V_ADD (V_SHR (yl, 6), prod), 8191);
+
+    if (enc) {
+      /* Process 4.2.2 */
+      i = G726_vquan (V_AND (V_SUB (V_ADD (G726_vlog (d), V_C (4096)), V_SHR (y, 2)), 4095), p, p->quan);
+      i = V_SEL (V_GT (zero, d), V_SUB (nmax, i), i);
+      if (p->zfix)
+        i = V_SEL (V_EQ (i, zero), nmax, i);
+      _mm_storeu_si128 ((__m128i *) (out + k), _mm_packs_epi32 (_mm256_castsi256_si128 (i), _mm256_extracti128_si256 (i, 1)));
+    } else
+      i = _mm256_cvtepi16_epi32 (_mm_loadu_si128 ((__m128i *) (inp + k)));
+
+    /* Process 4.2.3 */
+    dqln = V_TAB (p->dqln, V_AND (i, 31));
+    dqs = V_SHRV (i, V_C (p->shift));
+    dql = V_AND (V_ADD (dqln, V_SHR (y, 2)), 4095);
+    dq = V_SHRV (V_SHL (V_ADD (V_AND (dql, 127), V_C (128)), 7), V_SUB (V_C (14), V_AND (V_SHR (dql, 7), 15)));
+    dq = V_SEL (V_EQ (V_SHR (dql, 11), zero), dq, zero);
+    dq = V_SHORT (V_ADD (V_SHL (dqs, 15), dq));
+    dqmag = V_AND (dq, 32767);
+
+    /* Process `known-state' part of 4.2.7: G726_trans() */
+    td = V_LOAD (st->tdr + k);
+    ylint = V_SHR (yl, 15);
+    ylfrac = V_AND (V_SHR (yl, 10), 31);
+    thr = V_SEL (V_GT (ylint, V_C (9)), V_C (31744), V_SHLV (V_ADD (ylfrac, V_C (32)), ylint));
+    tr = _mm256_and_si256 (V_GT (dqmag, V_SHR (V_ADD (thr, V_SHR (thr, 1)), 1)), V_EQ (td, one));
+
+    /* Part of 4.2.5 */
+    is = V_SHRV (i, V_C (p->shift));
+    im = _mm256_and_si256 (V_SEL (V_EQ (is, zero), i, V_SUB (nmax, i)), m);
+    fi = V_TAB (p->fi, im);
+    dif = V_AND (V_SUB (V_ADD (V_SHL (fi, 9), V_C (8192)), dms), 8191);
+    difsx = V_SEL (V_EQ (V_SHR (dif, 12), zero), V_SHR (dif, 5), V_ADD (V_SHR (dif, 5), V_C (3840)));
+    dmsp = V_AND (V_ADD (difsx, dms), 4095);
+    V_STORE (st->dmsp + k, dmsp);
+    dif = V_AND (V_SUB (V_ADD (V_SHL (fi, 11), V_C (32768)), dml), 32767);
+    difsx = V_SEL (V_EQ (V_SHR (dif, 14), zero), V_SHR (dif, 7), V_ADD (V_SHR (dif, 7), V_C (16128)));
+    dmlp = V_AND (V_ADD (difsx, dml), 16383);
+    V_STORE (st->dmlp + k, dmlp);
+
+    /* Remaining part of 4.2.4 */
+    wi = V_TAB (p->wi, im);
+    dif = V_AND (V_SUB (V_ADD (V_SHL (wi, 5), V_C (131072)), y), 131071);
+    difsx = V_SEL (V_EQ (V_SHR (dif, 16), zero), V_SHR (dif, 5), V_ADD (V_SHR (dif, 5), V_C (4096)));
+    yut = V_AND (V_ADD (y, difsx), 8191);
+    yup = V_SEL (V_EQ (V_SHR (V_AND (V_ADD (yut, V_C (11264)), 16383), 13), zero), V_C (5120), yut);
+    yup = V_SEL (V_EQ (V_SHR (V_AND (V_ADD (yut, V_C (15840)), 16383), 13), zero), yup, V_C (544));
+    V_STORE (st->yup + k, yup);
+    dif = V_AND (V_ADD (yup, V_SHR (V_SUB (V_C (1048576), yl), 6)), 16383);
+    difsx = V_SEL (V_EQ (V_SHR (dif, 13), zero), dif, V_ADD (dif, V_C (507904)));
+    V_STORE (st->ylp + k, V_AND (V_ADD (yl, difsx), 524287));
+
+    /* More `known-state' parts of 4.2.6: update of `pk's (G726_addc) */
+    pk2 = V_LOAD (st->pk1 + k);
+    pk1 = V_LOAD (st->pk0 + k);
+    V_STORE (st->pk1 + k, pk1);
+    dqsign = V_AND (V_SHR (dq, 15), 1);
+    dqi = V_SEL (V_EQ (dqsign, zero), V_AND (dq, 65535), V_AND (V_SUB (V_C (65536), dqmag), 65535));
+    dqsez = V_AND (V_ADD (dqi, V_SEL (V_EQ (V_SHR (sez, 14), zero), sez, V_ADD (sez, V_C (32768)))), 65535);
+    pk0 = V_SHR (dqsez, 15);
+    V_STORE (st->pk0 + k, pk0);
+    sigpk = V_EQ (dqsez, zero);
+
+    /* 4.2.6: find sr0 (G726_addb, G726_floatb) */
+    sr = V_SHORT (V_AND (V_ADD (dqi, V_SEL (V_EQ (V_SHR (se, 14), zero), se, V_ADD (se, V_C (32768)))), 65535));
+    srneg = V_GT (zero, sr);
+    V_STORE (st->sr0 + k, G726_vfloat (V_BIT (srneg), V_SEL (srneg, V_AND (V_SUB (V_C (65536), V_AND (sr, 65535)), 32767), sr)));
+
+    /* 4.2.6: find dq0 (G726_floata) */
+    V_STORE (st->dq[0] + k, G726_vfloat (dqsign, dqmag));
+
+    /* Process 4.2.8 (decoder) */
+    if (!enc) {
+      sp = G726_vcompress (sr, p->alaw);
+      d = G726_vsubta (G726_vexpand (sp, p->alaw), se);
+      id = G726_vquan (V_AND (V_SUB (V_ADD (G726_vlog (d), V_C (4096)), V_SHR (y, 2)), 4095), p, p->sync);
+      id = V_SEL (V_GT (zero, d), V_SUB (nmax, id), id);
+      if (p->zfix)
+        id = V_SEL (V_EQ (id, V_ADD (m, one)), m, id);
+      id = V_XOR (G726_vsync (id, V_SEL (V_EQ (is, zero), V_ADD (i, V_ADD (m, one)), _mm256_and_si256 (i, m)), sp, p->alaw), V_C (p->alaw ? 85 : 0));
+      _mm_storeu_si128 ((__m128i *) (out + k), _mm_packs_epi32 (_mm256_castsi256_si128 (id), _mm256_extracti128_si256 (id, 1)));
+    }
+
+    /* 4.2.6: prepare a2(r) (G726_upa2, G726_limc) */
+    tr0 = V_EQ (tr, zero);
+    a11 = V_AND (a1, 65535);
+    a21 = V_AND (a2, 65535);
+    fa1 = V_SEL (V_GT (a1, V_C (-1)), V_SHL (_mm256_min_epi32 (a11, V_C (8191)), 2), V_SEL (V_GT (a11, V_C (57344)), V_AND (V_SHL (a11, 2), 131071), V_C (24577 << 2)));
+    fa = V_SEL (V_EQ (pk0, pk1), V_AND (V_SUB (V_C (131072), fa1), 131071), fa1);
+    uga2b = V_AND (V_ADD (V_SEL (V_EQ (pk0, pk2), V_C (16384), V_C (114688)), fa), 131071);
+    uga2 = V_SEL (V_EQ (V_SHR (uga2b, 16), zero), V_SHR (uga2b, 7), V_ADD (V_SHR (uga2b, 7), V_C (64512)));
+    uga2 = _mm256_andnot_si256 (sigpk, uga2);
+    ula2 = V_SEL (V_GT (a2, V_C (-1)), V_AND (V_SUB (V_C (65536), V_SHR (a21, 7)), 65535), V_AND (V_SUB (V_C (65536), V_ADD (V_SHR (a21, 7), V_C (65024))), 65535));
+    a2t = V_AND (V_ADD (a21, V_AND (V_ADD (uga2, ula2), 65535)), 65535);
+    a2p = V_SEL (_mm256_and_si256 (V_GT (a2t, V_C (32767)), V_GT (V_C (53249), a2t)), V_C (53248), V_SEL (_mm256_and_si256 (V_GT (a2t, V_C (12287)), V_GT (V_C (32768), a2t)), V_C (12288), a2t));
+    V_STORE (st->a2r + k, _mm256_and_si256 (tr0, V_SHORT (a2p)));
+
+    /* 4.2.6: prepare a1(r) (G726_upa1, G726_limd) */
+    ula1 = V_AND (V_SEL (V_EQ (V_SHR (a11, 15), zero), V_SUB (V_C (65536), V_SHR (a11, 8)), V_SUB (V_C (65536), V_ADD (V_SHR (a11, 8), V_C (65280)))), 65535);
+    a1t = _mm256_andnot_si256 (sigpk, V_SEL (V_EQ (pk0, pk1), V_C (192), V_C (65344)));
+    a1t = V_AND (V_ADD (a11, V_AND (V_ADD (a1t, ula1), 65535)), 65535);
+    a1ul = V_AND (V_SUB (V_C (15360 + 65536), a2p), 65535);
+    a1ll = V_AND (V_ADD (a2p, V_C (65536 - 15360)), 65535);
+    a1p = V_SEL (_mm256_and_si256 (V_GT (a1t, V_C (32767)), V_GE (a1ll, a1t)), a1ll, V_SEL (_mm256_and_si256 (V_GE (a1t, a1ul), V_GT (V_C (32768), a1t)), a1ul, a1t));
+    V_STORE (st->a1r + k, _mm256_and_si256 (tr0, V_SHORT (a1p)));
+
+    /* Remaining of 4.2.7 (G726_tone) */
+    tdp = V_BIT (_mm256_and_si256 (V_GT (a2p, V_C (32767)), V_GT (V_C (53760), a2p)));
+    V_STORE (st->tdr + k, _mm256_and_si256 (tr0, tdp));
+
+    /* Remaining of 4.2.5 (G726_subtc, G726_filtc, G726_triga) */
+    dif = V_AND (V_SUB (V_ADD (V_SHL (dmsp, 2), V_C (32768)), dmlp), 32767);
+    difm = V_SEL (V_EQ (V_SHR (dif, 14), zero), dif, V_AND (V_SUB (V_C (32768), dif), 16383));
+    ax = V_NOT (_mm256_and_si256 (_mm256_and_si256 (V_GT (y, V_C (1535)), V_GT (V_SHR (dmlp, 3), difm)), V_EQ (tdp, zero)));
+    dif = V_AND (V_SUB (V_ADD (V_SHL (V_BIT (ax), 9), V_C (2048)), ap), 2047);
+    difsx = V_SEL (V_EQ (V_SHR (dif, 10), zero), V_SHR (dif, 4), V_ADD (V_SHR (dif, 4), V_C (896)));
+    app = V_AND (V_ADD (difsx, ap), 1023);
+    V_STORE (st->apr + k, V_SEL (tr0, app, V_C (256)));
+
+    /* Remaining of 4.2.6: update of all `b's (G726_xor, G726_upb) */
+    for (n = 0; n < 6; n++) {
+      u = V_XOR (dqsign, V_SHR (dqo[n], 10));
+      bb = V_AND (b[n], 65535);
+      ugb = _mm256_andnot_si256 (V_EQ (dqmag, zero), V_SEL (V_EQ (u, zero), V_C (128), V_C (65408)));
+      ulb = V_SHRV (bb, V_C (p->leak));
+      ulb = V_AND (V_SUB (V_C (65536), V_SEL (V_EQ (V_SHR (bb, 15), zero), ulb, V_ADD (ulb, V_C (p->param)))), 65535);
+      V_STORE (st->br[n] + k, _mm256_and_si256 (tr0, V_SHORT (V_AND (V_ADD (bb, V_AND (V_ADD (ugb, ulb), 65535)), 65535))));
+    }
+  }
+  return k;
+}
+#endif /* G726_HAVE_AVX2 */
+
+
+/*
+ * Encoder (enc=1) or decoder (enc=0) of a batch: the loop body follows,
+ * block by block, G726_encode() and G726_decode(). The channels that fill whole AVX2
+ * vectors are coded by G726_batch_avx2() on processors that have it.
+ */
+static void G726_batch_code (int enc, short *inp_buf, short *out_buf, long smpno, char *law, short rate, short r, G726_batch_state * st) {
+  G726_RATE_TAB *t;
+  long nch = st->nch, j, k;
+  int alaw = (*law == '1');
+  int shift, nmax, m, leak, param, n;
+  int s, sl, d, dl, ds, dln, i, y, yu, al, ap, dms, dml, dqln, dqs, dql, dq, dqmag;
+  int sr, sr1, sr2, a1, a2, wa1, wa2, dq6, b[6], wb[6], sezi, sei, se, sez;
+  int fi, wi, is, im, dif, difs, difsx, difm, prod, yut, yup, td, tr;
+  int ylint, ylfrac, thr, dqi, dqsez, pk0, pk1, pk2, sigpk;
+  int a11, a21, fa1, fa, uga2b, uga2, ula2, a2t, a2p, a1t, a1p, a1ll, a1ul, ula1, tdp, ax, app;
+  int bb, ugb, ulb, dqn, u, sp, dlx, dsx, dlnx, id;
+  long yl, k0 = 0;
+  short *inp, *out;
+#ifdef G726_HAVE_AVX2
+  G726_BATCH_PAR par;
+  int avx2 = __builtin_cpu_supports ("avx2") && nch >= 8;
+#endif
+
+  /* Same choice of tables as in the per-channel functions */
+  t = &G726_rate_tab[(rate >= 2 && rate <= 4) ? rate - 2 : 3];
+  shift = t->shift;
+  m = (1 << shift) - 1;
+  nmax = (2 << shift) - 1;
+  leak = (rate != 5) ? 8 : 9;
+  param = (rate != 5) ? 65280 : 65408;
+
+#ifdef G726_HAVE_AVX2
+  if (avx2) {
+    par.shift = shift;
+    par.zfix = t->zfix;
+    par.nthr = t->nthr;
+    par.m = m;
+    par.nmax = nmax;
+    par.leak = leak;
+    par.param = param;
+    par.alaw = alaw;
+    for (n = 0; n < 32; n++) {
+      if (n < 16)
+        par.thr[n] = t->thr[n], par.wi[n] = t->wi[n], par.fi[n] = t->fi[n];
+      if (n < 17)
+        par.quan[n] = t->quan[n], par.sync[n] = t->sync[n];
+      par.dqln[n] = t->dqln[n];
+    }
+  }
+#endif
+
+  if (r)
+    for (k = 0; k < nch; k++)
+      G726_batch_reset (st, k);
+
+  for (j = 0; j < smpno; j++) {
+    inp = inp_buf + j * nch;
+    out = out_buf + j * nch;
+
+#ifdef G726_HAVE_AVX2
+    if (avx2)
+      k0 = G726_batch_avx2 (enc, inp, out, &par, st);
+#endif
+    for (k = k0; k < nch; k++) {
+      /* Process `known-state' part of 4.2.6 */
+      sr2 = st->sr1[k];
+      sr1 = st->sr1[k] = st->sr0[k];
+      a2 = st->a2r[k];
+      a1 = st->a1r[k];
+      wa2 = G726_bfmult (a2, sr2);
+      wa1 = G726_bfmult (a1, sr1);
+
+      dq6 = st->dq[5][k];
+      for (n = 5; n > 0; n--)
+        st->dq[n][k] = st->dq[n - 1][k];
+      for (n = 0; n < 6; n++) {
+        b[n] = st->br[n][k];
+        wb[n] = G726_bfmult (b[n], (n < 5) ? st->dq[n + 1][k] : dq6);
+      }
+
+      /* G726_accum() */
+      sezi = (wb[0] + wb[1]) & 65535;
+      for (n = 2; n < 6; n++)
+        sezi = (sezi + wb[n]) & 65535;
+      sei = (((sezi + wa2) & 65535) + wa1) & 65535;
+      sez = sezi >> 1;
+      se = sei >> 1;
+
+      /* Process 4.2.1 (encoder) */
+      if (enc) {
+        s = inp[k] ^ (alaw ? 85 : 0);
+        sl = G726_bexpand (s, alaw);
+        d = G726_bsubta (sl, se);
+      }
+
+      /* Process delays and `know-state' part of 4.2.5 */
+      dms = st->dmsp[k];
+      dml = st->dmlp[k];
+      ap = st->apr[k];
+      al = (ap >= 256) ? 64 : (ap >> 2);
+
+      /* Process `know-state' parts of 4.2.4: G726_mix() */
+      yu = st->yup[k];
+      yl = st->ylp[k];
+      dif = (yu + 16384 - (int) (yl >> 6)) & 16383;
+      difs = dif >> 13;
+      difm = (difs == 0) ? dif : ((16384 - dif) & 8191);
+      prod = (difm * al) >> 6;
+      prod = (difs == 0) ? prod : ((16384 - prod) & 16383);
+      y = ((int) (yl >> 6) + prod) & 8191;
+
+      if (enc) {
+        /* Process 4.2.2 */
+        dl = G726_blog (d);
+        ds = d >> 15;
+        dln = (dl + 4096 - (y >> 2)) & 4095;
+        for (n = 0, i = 0; n < t->nthr; n++)
+          i += (dln >= t->thr[n]);
+        i = t->quan[i];
+        i = ds ? nmax - i : i;
+        i = (t->zfix && i == 0) ? nmax : i;
+        out[k] = (short) i;
+      } else
+        i = inp[k];
+
+      /* Process 4.2.3 */
+      dqln = t->dqln[i];
+      dqs = i >> shift;
+      dql = (dqln + (y >> 2)) & 4095;
+      dq = (dql >> 11) ? 0 : ((((dql & 127) + 128) << 7) >> (14 - ((dql >> 7) & 15)));
+      dq = (short) ((short) (dqs << 15) + dq);
+      dqmag = dq & 32767;
+
+      /* Process `known-state' part of 4.2.7: G726_trans() */
+      td = st->tdr[k];
+      ylint = (int) (yl >> 15);
+      ylfrac = (int) (yl >> 10) & 31;
+      thr = (ylint > 9) ? 31744 : ((ylfrac + 32) << ylint);
+      tr = (dqmag > ((thr + (thr >> 1)) >> 1) && td == 1) ? 1 : 0;
+
+      /* Part of 4.2.5 */
+      is = i >> shift;
+      im = (is == 0) ? (i & m) : ((nmax - i) & m);
+      fi = t->fi[im];
+      dif = ((fi << 9) + 8192 - dms) & 8191;
+      difsx = (dif >> 12) ? ((dif >> 5) + 3840) : (dif >> 5);
+      st->dmsp[k] = (difsx + dms) & 4095;
+      dif = ((fi << 11) + 32768 - dml) & 32767;
+      difsx = (dif >> 14) ? ((dif >> 7) + 16128) : (dif >> 7);
+      st->dmlp[k] = (difsx + dml) & 16383;
+
+      /* Remaining part of 4.2.4 */
+      wi = t->wi[im];
+      dif = ((wi << 5) + 131072 - y) & 131071;
+      difsx = (dif >> 16) ? ((dif >> 5) + 4096) : (dif >> 5);
+      yut = (y + difsx) & 8191;
+      yup = (((yut + 15840) & 16383) >> 13) ? 544 : ((((yut + 11264) & 16383) >> 13) == 0) ? 5120 : yut;
+      st->yup[k] = yup;
+      dif = (yup + ((1048576 - (int) yl) >> 6)) & 16383;
+      difsx = (dif >> 13) ? (dif + 507904) : dif;
+      st->ylp[k] = (yl + difsx) & 524287;
+
+      /* More `known-state' parts of 4.2.6: update of `pk's (G726_addc) */
+      pk2 = st->pk1[k];
+      pk1 = st->pk1[k] = st->pk0[k];
+      dqi = ((dq >> 15) & 1) ? ((65536 - (dq & 32767)) & 65535) : (dq & 65535);
+      dqsez = (dqi + (((sez >> 14) == 0) ? sez : (sez + 32768))) & 65535;
+      pk0 = st->pk0[k] = dqsez >> 15;
+      sigpk = (dqsez == 0) ? 1 : 0;
+
+      /* 4.2.6: find sr0 (G726_addb, G726_floatb) */
+      sr = (short) ((dqi + (((se >> 14) == 0) ? se : (se + 32768))) & 65535);
+      st->sr0[k] = (sr & 32768) ? G726_bfloat (1, (65536 - (sr & 65535)) & 32767) : G726_bfloat (0, sr & 65535);
+
+      /* 4.2.6: find dq0 (G726_floata) */
+      st->dq[0][k] = G726_bfloat ((dq >> 15) & 1, dqmag);
+
+      /* Process 4.2.8 (decoder) */
+      if (!enc) {
+        sp = G726_bcompress (sr, alaw);
+        d = G726_bsubta (G726_bexpand (sp, alaw), se);
+        dlx = G726_blog (d);
+        dsx = d >> 15;
+        dlnx = (dlx + 4096 - (y >> 2)) & 4095;
+        for (n = 0, id = 0; n < t->nthr; n++)
+          id += (dlnx >= t->thr[n]);
+        id = t->sync[id];
+        id = dsx ? nmax - id : id;
+        id = (t->zfix && id == m + 1) ? m : id;
+        out[k] = (short) (G726_bsync (id, (is == 0) ? (i + m + 1) : (i & m), sp, alaw) ^ (alaw ? 85 : 0));
+      }
+
+      /* 4.2.6: prepare a2(r) (G726_upa2, G726_limc) */
+      a11 = a1 & 65535;
+      a21 = a2 & 65535;
+      if ((a1 >> 15) == 0)
+        fa1 = (a11 <= 8191) ? (a11 << 2) : (8191 << 2);
+      else
+        fa1 = (a11 >= 57345) ? ((a11 << 2) & 131071) : (24577 << 2);
+      fa = (pk0 ^ pk1) ? fa1 : ((131072 - fa1) & 131071);
+      uga2b = ((((pk0 ^ pk2) == 0) ? 16384 : 114688) + fa) & 131071;
+      uga2 = (sigpk == 1) ? 0 : ((uga2b >> 16) ? ((uga2b >> 7) + 64512) : (uga2b >> 7));
+      ula2 = ((a2 >> 15) == 0) ? ((65536 - (a21 >> 7)) & 65535) : ((65536 - ((a21 >> 7) + 65024)) & 65535);
+      a2t = (a21 + ((uga2 + ula2) & 65535)) & 65535;
+      a2p = (a2t >= 32768 && a2t <= 53248) ? 53248 : (a2t >= 12288 && a2t <= 32767) ? 12288 : a2t;
+      st->a2r[k] = tr ? 0 : (short) a2p;
+
+      /* 4.2.6: prepare a1(r) (G726_upa1, G726_limd) */
+      ula1 = (((a11 >> 15) == 0) ? (65536 - (a11 >> 8)) : (65536 - ((a11 >> 8) + 65280))) & 65535;
+      a1t = (a11 + ((((sigpk == 1) ? 0 : (((pk0 ^ pk1) == 0) ? 192 : 65344)) + ula1) & 65535)) & 65535;
+      a1ul = (15360 + 65536 - a2p) & 65535;
+      a1ll = (a2p + 65536 - 15360) & 65535;
+      a1p = (a1t >= 32768 && a1t <= a1ll) ? a1ll : (a1t >= a1ul && a1t <= 32767) ? a1ul : a1t;
+      st->a1r[k] = tr ? 0 : (short) a1p;
+
+      /* Remaining of 4.2.7 (G726_tone) */
+      tdp = (a2p >= 32768 && a2p < 53760) ? 1 : 0;
+      st->tdr[k] = tr ? 0 : tdp;
+
+      /* Remaining of 4.2.5 (G726_subtc, G726_filtc, G726_triga) */
+      dif = ((st->dmsp[k] << 2) + 32768 - st->dmlp[k]) & 32767;
+      difm = (dif >> 14) ? ((32768 - dif) & 16383) : dif;
+      ax = (y >= 1536 && difm < (st->dmlp[k] >> 3) && tdp == 0) ? 0 : 1;
+      dif = ((ax << 9) + 2048 - ap) & 2047;
+      difsx = (dif >> 10) ? ((dif >> 4) + 896) : (dif >> 4);
+      app = (difsx + ap) & 1023;
+      st->apr[k] = tr ? 256 : app;
+
+      /* Remaining of 4.2.6: update of all `b's (G726_xor, G726_upb) */
+      for (n = 0; n < 6; n++) {
+        dqn = (n < 5) ? st->dq[n + 1][k] : dq6;
+        u = ((dq >> 15) & 1) ^ (dqn >> 10);
+        bb = b[n] & 65535;
+        ugb = (dqmag == 0) ? 0 : ((u == 0) ? 128 : 65408);
+        ulb = ((bb >> 15) == 0) ? ((65536 - (bb >> leak)) & 65535) : ((65536 - ((bb >> leak) + param)) & 65535);
+        st->br[n][k] = tr ? 0 : (short) ((bb + ((ugb + ulb) & 65535)) & 65535);
+      }
+    }
+  }
+}
+
+
+/*
+  ----------------------------------------------------------------------------
+
+        void G726_batch_encode (short *inp_buf, short *out_buf, long smpno,
+        ~~~~~~~~~~~~~~~~~~~~~~  char *law, short rate, short r,
+                                G726_batch_state *st);
+
+        Description:
+        ~~~~~~~~~~~~
+
+        G726 encoder for a batch of channels, bit-exact with running
+        G726_encode() for each channel. `inp_buf' holds `smpno' A or mu
+        law samples of each channel, interleaved: sample j of channel c
+        is inp_buf[j * st->nch + c]; the ADPCM codes are saved in the
+        same layout in `out_buf'. All the channels are reset before the
+        first sample if r is 1 (see also G726_batch_reset()). Unlike
+        G726_encode(), the input buffer is not modified for A law.
+
+        Return value:
+        ~~~~~~~~~~~~~
+        None.
+
+        Prototype:      in file g726.h
+        ~~~~~~~~~~
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0  Created.
+
+ ----------------------------------------------------------------------------
+*/
+void G726_batch_encode (short *inp_buf, short *out_buf, long smpno, char *law, short rate, short r, G726_batch_state * st) {
+  G726_batch_code (1, inp_buf, out_buf, smpno, law, rate, r, st);
+}
+
+/* ..................... end of G726_batch_encode() ..................... */
+
+
+/*
+  ----------------------------------------------------------------------------
+
+        void G726_batch_decode (short *inp_buf, short *out_buf, long smpno,
+        ~~~~~~~~~~~~~~~~~~~~~~  char *law, short rate, short r,
+                                G726_batch_state *st);
+
+        Description:
+        ~~~~~~~~~~~~
+
+        G726 decoder for a batch of channels, bit-exact with running
+        G726_decode() for each channel. The ADPCM codes in `inp_buf'
+        and the A or mu law samples saved in `out_buf' are interleaved
+        as in G726_batch_encode().
+
+        Return value:
+        ~~~~~~~~~~~~~
+        None.
+
+        Prototype:      in file g726.h
+        ~~~~~~~~~~
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0  Created.
+
+ ----------------------------------------------------------------------------
+*/
+void G726_batch_decode (short *inp_buf, short *out_buf, long smpno, char *law, short rate, short r, G726_batch_state * st) {
+  G726_batch_code (0, inp_buf, out_buf, smpno, law, rate, r, st);
+}
+
+/* ..................... end of G726_batch_decode() ..................... */
+
 /* ************************* END OF G726.C ************************* */
@@ -10,6 +10,8 @@
    History:
    28.Feb.92	v1.0	First version <simao@cpqd.br>
    06.May.94    v2.0    Smart prototypes that work with many compilers <simao>
+   17.Oct.26    v2.1    Added the state and the functions for batches of
+                        channels (G726_batch_*)
   ============================================================================
 */
 #ifndef G726_defined
@@ -50,6 +52,26 @@ typedef struct {
   long ylp;                     /* Slow quantizer scale factor */
 } G726_state;
 
+/* State for a batch of G726 encoders or decoders, in structure-of-arrays
+   layout: each pointer addresses an array of nch entries, one per
+   channel, with the same meaning as the fields of G726_state */
+#define G726_BATCH_NVAR 26      /* number of arrays in the batch state */
+typedef struct {
+  long nch;                     /* Number of channels */
+  int *sr0, *sr1;               /* Reconstructed signal with delays 0 and 1 */
+  int *a1r, *a2r;               /* Triggered 2nd order predictor coeffs. */
+  int *br[6];                   /* Triggered 6nd order predictor coeffs b1..b6 */
+  int *dq[6];                   /* Quantized difference signal with delays 0 to 5 */
+  int *dmsp;                    /* Short term average of the F(I) sequence */
+  int *dmlp;                    /* Long term average of the F(I) sequence */
+  int *apr;                     /* Triggered unlimited speed control parameter */
+  int *yup;                     /* Fast quantizer scale factor */
+  int *tdr;                     /* Triggered tone detector */
+  int *pk0, *pk1;               /* sign of dq+sez with delays 0 and 1 */
+  int *ylp;                     /* Slow quantizer scale factor */
+  int *mem;                     /* Memory holding all the arrays */
+} G726_batch_state;
+
 /* Function prototypes */
 void G726_encode ARGS ((short *inp_buf, short *out_buf, long smpno, char *law, short rate, short r, G726_state * state));
 void G726_decode ARGS ((short *inp_buf, short *out_buf, long smpno, char *law, short rate, short r, G726_state * state));
@@ -95,6 +117,13 @@ void G726_trans ARGS ((short *td, long *yl, short *dq, short *tr));
 void G726_compress ARGS ((short *sr, char *law, short *sp));
 void G726_sync ARGS ((short rate, short *i, short *sp, short *dlnx, short *dsx, char *law, short *sd));
 
+/* Batch (multi-channel) functions; samples of the channels are interleaved */
+G726_batch_state *G726_batch_init ARGS ((long nch));
+void G726_batch_reset ARGS ((G726_batch_state * st, long ch));
+void G726_batch_free ARGS ((G726_batch_state * st));
+void G726_batch_encode ARGS ((short *inp_buf, short *out_buf, long smpno, char *law, short rate, short r, G726_batch_state * st));
+void G726_batch_decode ARGS ((short *inp_buf, short *out_buf, long smpno, char *law, short rate, short r, G726_batch_state * st));
+
 /* Definitions for better user interface (?!) */
 #ifndef IS_LOG
 #define IS_LOG   0
@@ -0,0 +1,401 @@
+/*                                                           17.Oct.2026 v1.0
+  ===========================================================================
+
+  G726BENCH.C
+  ~~~~~~~~~~~
+
+  Description:
+  ~~~~~~~~~~~~
+
+  Benchmark and equivalence check of the batch (multi-channel) functions
+  of the G726 module, G726_batch_encode() and G726_batch_decode().
+
+  In the benchmark mode, a number of channels of pseudo-random A or mu law
+  samples are encoded, and the resulting ADPCM codes decoded, once with
+  G726_encode()/G726_decode() called for each channel in turn, and once
+  with the batch functions for all the channels together. The throughput
+  is reported in channels x seconds of audio per second of CPU time (at
+  8 kHz), together with a flag telling whether the outputs are identical.
+
+  In the check mode, the test vectors of the module are processed as
+  batches: for each rate and law, all the encoder (resp. decoder) input
+  vectors are put into one batch, repeated a few times, and coded in
+  segments of varying length; the output of each channel must be
+  identical to the corresponding reference vector. Then random signals
+  are coded with a rate that changes from segment to segment, and the
+  batch output compared to the per-channel functions.
+
+  Usage:
+  ~~~~~~
+  $ g726bench [-options]
+
+  Options:
+  -ch N ........ number of channels [default: 256]
+  -sec s ....... seconds of audio per channel [default: 10]
+  -rate R ...... bit rate in kbit/s: 16, 24, 32 or 40 [default: 32]
+  -law l ....... A or u law [default: A]
+  -check ....... check mode (no timing), return a non-zero exit code if
+                 any output differs
+  -dir path .... directory of the test vectors [default: test_data]
+
+  Original author:
+  ~~~~~~~~~~~~~~~~
+  ITU-T STL contributors
+
+  History:
+  ~~~~~~~~
+  17.Oct.2026 v1.0 Created.
+
+  ===========================================================================
+*/
+
+#include "ugstdemo.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "g726.h"
+
+/* Segment lengths cycled through when coding */
+static long seg_len[] = { 160, 1, 37, 1024, 2, 80, 3, 4096, 641 };
+
+#define N_SEG (sizeof (seg_len) / sizeof (seg_len[0]))
+
+/* Number of copies of the test vectors in the check mode: at least 2
+   groups of 8 channels for the encoder (2 vectors), so that both the
+   AVX2 lanes and the scalar loop of the batch functions are used */
+#define N_COPY 9
+
+/* Maximum number of vectors of a check group */
+#define MAX_VEC 5
+
+
+/*
+ * Load a file of 16-bit samples; returns the number of samples.
+ */
+static long load_file (char *dir, char *name, short **buf) {
+  char path[512];
+  FILE *fp;
+  long n;
+
+  sprintf (path, "%s/%s", dir, name);
+  if ((fp = fopen (path, "rb")) == NULL) {
+    fprintf (stderr, "Unable to open test vector %s\n", path);
+    exit (5);
+  }
+  fseek (fp, 0L, SEEK_END);
+  n = ftell (fp) / sizeof (short);
+  rewind (fp);
+  if ((*buf = (short *) malloc (n * sizeof (short))) == NULL)
+    HARAKIRI ("Error allocating memory for test vectors\n", 3);
+  n = (long) fread (*buf, sizeof (short), n, fp);
+  fclose (fp);
+  return n;
+}
+
+
+/*
+ * Code the interleaved buffer inp[] of nch channels with the batch
+ * functions, in segments of varying length; the rate of each segment is
+ * rate, or taken from the segment number if rate is 0 (variable rate).
+ */
+static void run_batch (int enc, short *inp, short *out, long n, char *law, short rate, G726_batch_state * st) {
+  long i, k, l, nch = st->nch;
+
+  for (i = 0, k = 0; i < n; i += l, k++) {
+    l = seg_len[k % N_SEG];
+    if (l > n - i)
+      l = n - i;
+    if (enc)
+      G726_batch_encode (inp + i * nch, out + i * nch, l, law, rate ? rate : (short) (2 + k % 4), i == 0, st);
+    else
+      G726_batch_decode (inp + i * nch, out + i * nch, l, law, rate ? rate : (short) (2 + k % 4), i == 0, st);
+  }
+}
+
+
+/*
+ * Same as run_batch() for a single channel with the reference functions;
+ * x[] is modified (A law encoder).
+ */
+static void run_ref (int enc, short *x, short *y, long n, char *law, short rate, G726_state * st) {
+  long i, k, l;
+
+  for (i = 0, k = 0; i < n; i += l, k++) {
+    l = seg_len[k % N_SEG];
+    if (l > n - i)
+      l = n - i;
+    if (enc)
+      G726_encode (x + i, y + i, l, law, rate ? rate : (short) (2 + k % 4), i == 0, st);
+    else
+      G726_decode (x + i, y + i, l, law, rate ? rate : (short) (2 + k % 4), i == 0, st);
+  }
+}
+
+
+/*
+ * Check one group of test vectors: inp[v] must be coded into out[v].
+ * Returns the number of channels with differences.
+ */
+static long check_group (char *dir, int enc, char *law, short rate, char *inp[], char *out[], int nvec) {
+  short *x[MAX_VEC], *y[MAX_VEC], *bin, *bout;
+  long nx[MAX_VEC], ny, n = 0, nch = nvec * N_COPY, c, j, fail = 0;
+  G726_batch_state *st;
+  int v;
+
+  for (v = 0; v < nvec; v++) {
+    nx[v] = load_file (dir, inp[v], &x[v]);
+    ny = load_file (dir, out[v], &y[v]);
+    if (ny != nx[v])
+      HARAKIRI ("Test vectors of different lengths\n", 5);
+    if (nx[v] > n)
+      n = nx[v];
+  }
+
+  /* Interleave, padding the shorter vectors */
+  if ((bin = (short *) calloc (n * nch, sizeof (short))) == NULL || (bout = (short *) calloc (n * nch, sizeof (short))) == NULL)
+    HARAKIRI ("Error allocating memory for batches\n", 3);
+  for (c = 0; c < nch; c++)
+    for (j = 0; j < nx[c % nvec]; j++)
+      bin[j * nch + c] = x[c % nvec][j];
+
+  if ((st = G726_batch_init (nch)) == NULL)
+    HARAKIRI ("Error allocating the batch state\n", 3);
+  run_batch (enc, bin, bout, n, law, rate, st);
+  G726_batch_free (st);
+
+  for (c = 0; c < nch; c++) {
+    for (j = 0; j < nx[c % nvec]; j++)
+      if (bout[j * nch + c] != y[c % nvec][j])
+        break;
+    if (j < nx[c % nvec]) {
+      fprintf (stderr, "%s %s -> %s (channel %ld): differs at sample %ld\n", enc ? "Encoding" : "Decoding", inp[c % nvec], out[c % nvec], c, j);
+      fail++;
+    }
+  }
+
+  for (v = 0; v < nvec; v++) {
+    free (x[v]);
+    free (y[v]);
+  }
+  free (bin);
+  free (bout);
+  return fail;
+}
+
+
+/*
+ * Code random signals of nch channels at variable rate with the batch and
+ * the reference functions. Returns the number of channels with differences.
+ */
+static long check_random (char *law, long nch, long n) {
+  short *bin, *bout, *x, *y;
+  long c, i, j, k, l, lcg = 4711, fail = 0;
+  G726_batch_state *st;
+  G726_state ref;
+  int enc;
+
+  if ((bin = (short *) malloc (n * nch * sizeof (short))) == NULL || (bout = (short *) malloc (n * nch * sizeof (short))) == NULL || (x = (short *) malloc (n * sizeof (short))) == NULL || (y = (short *) malloc (n * sizeof (short))) == NULL)
+    HARAKIRI ("Error allocating memory for random signals\n", 3);
+  if ((st = G726_batch_init (nch)) == NULL)
+    HARAKIRI ("Error allocating the batch state\n", 3);
+
+  for (enc = 1; enc >= 0; enc--) {
+    /* law samples for the encoder; for the decoder, codes of as many
+       bits as the rate of their segment (see run_batch()) */
+    for (i = 0, k = 0; i < n; i += l, k++) {
+      l = seg_len[k % N_SEG];
+      if (l > n - i)
+        l = n - i;
+      for (j = i * nch; j < (i + l) * nch; j++) {
+        lcg = (lcg * 1103515245 + 12345) & 0x7FFFFFFF;
+        bin[j] = (short) ((lcg >> 16) & (enc ? 255 : (1 << (2 + k % 4)) - 1));
+      }
+    }
+    run_batch (enc, bin, bout, n, law, 0, st);
+
+    for (c = 0; c < nch; c++) {
+      for (j = 0; j < n; j++)
+        x[j] = bin[j * nch + c];
+      run_ref (enc, x, y, n, law, 0, &ref);
+      for (j = 0; j < n; j++)
+        if (bout[j * nch + c] != y[j])
+          break;
+      if (j < n) {
+        fprintf (stderr, "Random %s, %s law (channel %ld): differs at sample %ld\n", enc ? "encoding" : "decoding", *law == '1' ? "A" : "u", c, j);
+        fail++;
+      }
+    }
+  }
+
+  G726_batch_free (st);
+  free (bin);
+  free (bout);
+  free (x);
+  free (y);
+  return fail;
+}
+
+
+void display_usage () {
+  printf ("G726BENCH.C - Version 1.0 of 17.Oct.2026\n\n");
+  printf (" Benchmark and equivalence check of the batch G726 functions.\n\n");
+  printf (" Usage:\n");
+  printf (" $ g726bench [-options]\n\n");
+  printf (" Options:\n");
+  printf ("  -ch N ...... number of channels [default: 256]\n");
+  printf ("  -sec s ..... seconds of audio per channel [default: 10]\n");
+  printf ("  -rate R .... bit rate in kbit/s (16, 24, 32, 40) [default: 32]\n");
+  printf ("  -law l ..... A or u law [default: A]\n");
+  printf ("  -check ..... only check the batch functions, no timing\n");
+  printf ("  -dir path .. directory of the test vectors [default: test_data]\n");
+  exit (-128);
+}
+
+
+int main (int argc, char *argv[]) {
+  static char *name_law[2] = { "m", "a" };
+  char *dir = "test_data", law[2] = "1", *inp[MAX_VEC], *out[MAX_VEC];
+  char name[2][MAX_VEC][2][16];
+  double sec = 10, cpu_ref_enc, cpu_ref_dec, cpu_enc, cpu_dec, audio;
+  long nch = 256, n, c, j, lcg = 12345, fail = 0;
+  short rate = 4, R;
+  int check = 0, a, v, exact;
+  short *bin, *benc, *bdec, *x, *y, *z;
+  G726_batch_state *st;
+  G726_state ref;
+  clock_t t0;
+
+  /* Get options */
+  while (argc > 1 && argv[1][0] == '-')
+    if (strcmp (argv[1], "-ch") == 0) {
+      nch = atol (argv[2]);
+      argc -= 2;
+      argv += 2;
+    } else if (strcmp (argv[1], "-sec") == 0) {
+      sec = atof (argv[2]);
+      argc -= 2;
+      argv += 2;
+    } else if (strcmp (argv[1], "-rate") == 0) {
+      rate = (short) (atoi (argv[2]) / 8);
+      argc -= 2;
+      argv += 2;
+    } else if (strcmp (argv[1], "-law") == 0) {
+      law[0] = (argv[2][0] == 'a' || argv[2][0] == 'A') ? '1' : '0';
+      argc -= 2;
+      argv += 2;
+    } else if (strcmp (argv[1], "-dir") == 0) {
+      dir = argv[2];
+      argc -= 2;
+      argv += 2;
+    } else if (strcmp (argv[1], "-check") == 0) {
+      check = 1;
+      argc--;
+      argv++;
+    } else if (strcmp (argv[1], "-h") == 0 || strcmp (argv[1], "-?") == 0) {
+      display_usage ();
+    } else {
+      fprintf (stderr, "ERROR! Invalid option \"%s\" in command line\n\n", argv[1]);
+      display_usage ();
+    }
+
+  if (rate < 2 || rate > 5 || nch < 1)
+    HARAKIRI ("Invalid rate or number of channels\n", 5);
+
+  if (check) {
+    /* Test vectors, grouped by rate and law (see the tests in CMakeLists.txt) */
+    for (R = 2; R <= 5; R++)
+      for (a = 0; a <= 1; a++) {
+        law[0] = a ? '1' : '0';
+
+        /* encoder: nrm.x and ovr.x -> rnRfx.i and rvRfx.i */
+        for (v = 0; v < 2; v++) {
+          sprintf (name[0][v][0], "%s.%s", v ? "ovr" : "nrm", name_law[a]);
+          sprintf (name[0][v][1], "r%c%df%s.i", v ? 'v' : 'n', 8 * R, name_law[a]);
+          inp[v] = name[0][v][0];
+          out[v] = name[0][v][1];
+        }
+        fail += check_group (dir, 1, law, R, inp, out, 2);
+
+        /* decoder: ADPCM of both laws and the special sequence iR */
+        for (v = 0; v < 4; v++) {
+          sprintf (name[1][v][0], "r%c%df%s.i", (v & 1) ? 'v' : 'n', 8 * R, (v & 2) ? "m" : "a");
+          sprintf (name[1][v][1], "r%c%df%s.o", (v & 1) ? 'v' : 'n', 8 * R, (v & 2) ? (a ? "c" : "m") : (a ? "a" : "x"));
+          inp[v] = name[1][v][0];
+          out[v] = name[1][v][1];
+        }
+        sprintf (name[1][4][0], "i%d", 8 * R);
+        sprintf (name[1][4][1], "ri%df%s.o", 8 * R, name_law[a]);
+        inp[4] = name[1][4][0];
+        out[4] = name[1][4][1];
+        fail += check_group (dir, 0, law, R, inp, out, 5);
+
+        printf ("%d kbit/s, %s law: test vectors %s\n", 8 * R, a ? "A" : "u", fail ? "FAILED" : "identical");
+      }
+
+    /* Variable rate, random signals */
+    for (a = 0; a <= 1; a++) {
+      law[0] = a ? '1' : '0';
+      fail += check_random (law, 21, 4000);
+    }
+    printf ("Variable rate: %s\n", fail ? "FAILED" : "identical");
+
+    if (fail)
+      fprintf (stderr, "%ld channel(s) failed the batch equivalence check\n", fail);
+    return fail ? 1 : 0;
+  }
+
+  /* Pseudo-random law samples, interleaved */
+  n = (long) (sec * 8000);
+  if ((bin = (short *) malloc (n * nch * sizeof (short))) == NULL || (benc = (short *) malloc (n * nch * sizeof (short))) == NULL || (bdec = (short *) malloc (n * nch * sizeof (short))) == NULL || (x = (short *) malloc (n * sizeof (short))) == NULL || (y = (short *) malloc (n * sizeof (short))) == NULL || (z = (short *) malloc (n * sizeof (short))) == NULL)
+    HARAKIRI ("Error allocating memory for signals\n", 3);
+  for (j = 0; j < n * nch; j++) {
+    lcg = (lcg * 1103515245 + 12345) & 0x7FFFFFFF;
+    bin[j] = (short) ((lcg >> 16) & 255);
+  }
+
+  /* Batch: all the channels together, in 20 ms frames */
+  if ((st = G726_batch_init (nch)) == NULL)
+    HARAKIRI ("Error allocating the batch state\n", 3);
+  t0 = clock ();
+  for (j = 0; j < n; j += 160)
+    G726_batch_encode (bin + j * nch, benc + j * nch, n - j < 160 ? n - j : 160, law, rate, j == 0, st);
+  cpu_enc = (double) (clock () - t0) / CLOCKS_PER_SEC;
+  t0 = clock ();
+  for (j = 0; j < n; j += 160)
+    G726_batch_decode (benc + j * nch, bdec + j * nch, n - j < 160 ? n - j : 160, law, rate, j == 0, st);
+  cpu_dec = (double) (clock () - t0) / CLOCKS_PER_SEC;
+  G726_batch_free (st);
+
+  /* Reference: one channel after the other */
+  for (exact = 1, cpu_ref_enc = cpu_ref_dec = 0, c = 0; c < nch; c++) {
+    for (j = 0; j < n; j++)
+      x[j] = bin[j * nch + c];
+    t0 = clock ();
+    for (j = 0; j < n; j += 160)
+      G726_encode (x + j, y + j, n - j < 160 ? n - j : 160, law, rate, j == 0, &ref);
+    cpu_ref_enc += (double) (clock () - t0) / CLOCKS_PER_SEC;
+    t0 = clock ();
+    for (j = 0; j < n; j += 160)
+      G726_decode (y + j, z + j, n - j < 160 ? n - j : 160, law, rate, j == 0, &ref);
+    cpu_ref_dec += (double) (clock () - t0) / CLOCKS_PER_SEC;
+    for (j = 0; j < n; j++)
+      if (benc[j * nch + c] != y[j] || bdec[j * nch + c] != z[j])
+        exact = 0;
+  }
+
+  audio = nch * (double) n / 8000;
+  printf ("%ld channels, %.1f s, %d kbit/s, %s law [channels x s of audio per CPU-s]\n", nch, n / 8000.0, 8 * rate, law[0] == '1' ? "A" : "u");
+  printf ("%-8s %12s %12s %8s %6s\n", "", "reference", "batch", "speedup", "exact");
+  printf ("%-8s %12.1f %12.1f %7.2fx %6s\n", "encoder", audio / (cpu_ref_enc + 1e-9), audio / (cpu_enc + 1e-9), (cpu_ref_enc + 1e-9) / (cpu_enc + 1e-9), exact ? "yes" : "NO");
+  printf ("%-8s %12.1f %12.1f %7.2fx %6s\n", "decoder", audio / (cpu_ref_dec + 1e-9), audio / (cpu_dec + 1e-9), (cpu_ref_dec + 1e-9) / (cpu_dec + 1e-9), exact ? "yes" : "NO");
+
+  free (bin);
+  free (benc);
+  free (bdec);
+  free (x);
+  free (y);
+  free (z);
+  return exact ? 0 : 1;
+}
@@ -1,4 +1,4 @@
-/*                                                           03.Feb.2010 v1.4
+/*                                                           17.Oct.2026 v1.5
   ============================================================================
 
   G726DEMO.C
@@ -98,6 +98,8 @@
   03/Feb/2010 v1.4 Modified maximum string length, removed implicit
                    casting of toupper(), and type of "rate" is int
                    (y.hiwasaki)
+  17/Oct/2026 v1.5 File I/O with the ugst-io module (input file memory-
+                   mapped, output written in large blocks).
 ============================================================================
 */
 
@@ -112,15 +114,12 @@
 #include <ctype.h>
 #include <math.h>
 
-#if defined(VMS)
-#include <stat.h>
-#else /* Unix/DOS */
-#include <sys/stat.h>
-#endif
-
 /* ..... G.726 module as include functions ..... */
 #include "g726.h"
 
+/* ..... Block I/O of sample files ..... */
+#include "ugst-io.h"
+
 /*
  -------------------------------------------------------------------------
  void display_usage(void);
@@ -134,7 +133,7 @@
  -------------------------------------------------------------------------
 */
 void display_usage () {
-  printf ("G726DEMO - Version 1.4 of 03.Feb.2010 \n\n");
+  printf ("G726DEMO - Version 1.5 of 17.Oct.2026 \n\n");
 
   printf ("> Description:\n");
   printf ("   Demonstration program for UGST/ITU-T G.726 module. Takes the\n");
@@ -212,8 +211,7 @@ int main (int argc, char *argv[]) {
 
 /* File variables */
   char FileIn[MAX_STRLEN], FileOut[MAX_STRLEN], law[4], lilo[8];
-  FILE *Fi, *Fo;
-  int inp, out;
+  UGST_IO *Fi, *Fo;
   long start_byte;
 #ifdef VMS
   char mrs[15];
@@ -266,15 +264,6 @@ int main (int argc, char *argv[]) {
   /* Find starting byte in file */
   start_byte = sizeof (short) * (long) (--N1) * (long) N;
 
-  /* Check if is to process the whole file */
-  if (N2 == 0) {
-    struct stat st;
-
-    /* ... find the input file size ... */
-    stat (FileIn, &st);
-    N2 = ceil ((st.st_size - start_byte) / (double) (N * sizeof (short)));
-  }
-
   /* Classification of the conversion desired */
   inp_type = toupper ((int) lilo[1]) == 'O' ? IS_LOG : IS_ADPCM;
   out_type = toupper ((int) lilo[3]) == 'O' ? IS_LOG : IS_ADPCM;
@@ -318,22 +307,24 @@ int main (int argc, char *argv[]) {
  */
 
   /* Opening input file; abort if there's any problem */
-  if ((Fi = fopen (FileIn, "rb")) == NULL)
+  if ((Fi = ugst_io_open_read (FileIn, UGST_IO_NATIVE)) == NULL)
     KILL (FileIn, 2);
-  inp = fileno (Fi);
 
   /* Creates output file */
 #ifdef VMS
   sprintf (mrs, "mrs=%d", 512);
 #endif
-  if ((Fo = fopen (FileOut, WB)) == NULL)
+  if ((Fo = ugst_io_open_write (FileOut, UGST_IO_NATIVE)) == NULL)
     KILL (FileOut, 3);
-  out = fileno (Fo);
 
   /* Move pointer to 1st block of interest */
-  if (fseek (Fi, start_byte, 0) < 0l)
+  if (ugst_io_seek (Fi, start_byte / (long) sizeof (short)) < 0l)
     KILL (FileIn, 4);
 
+  /* Check if is to process the whole file (until its end, for pipes) */
+  if (N2 == 0)
+    N2 = ugst_io_length (Fi) < 0 ? 0x7FFFFFFFL : (long) ceil ((ugst_io_length (Fi) * sizeof (short) - start_byte) / (double) (N * sizeof (short)));
+
 /*
  * ......... PROCESSING ACCORDING TO ITU-T G.726 .........
  */
@@ -344,8 +335,10 @@ int main (int argc, char *argv[]) {
       fprintf (stderr, "%c\r", funny[cur_blk % 8]);
 
     /* Read a block of samples */
-    if ((smpno = fread (inp_buf, sizeof (short), N, Fi)) < 0)
+    if ((smpno = ugst_io_read (Fi, inp_buf, N)) < 0)
       KILL (FileIn, 5);
+    if (smpno == 0)
+      break;
 
     /* Check if reset is needed */
     reset = (reset == 1 && cur_blk == 0) ? 1 : 0;
@@ -361,7 +354,7 @@ int main (int argc, char *argv[]) {
     }
 
     /* Write ADPCM output word */
-    if ((smpno = fwrite (out_buf, sizeof (short), smpno, Fo)) < 0)
+    if ((smpno = ugst_io_write (Fo, out_buf, smpno)) < 0)
       KILL (FileOut, 6);
   }
 
@@ -370,8 +363,9 @@ int main (int argc, char *argv[]) {
  */
 
   /* Close input and output files */
-  fclose (Fi);
-  fclose (Fo);
+  ugst_io_close (Fi);
+  if (ugst_io_close (Fo) < 0)
+    KILL (FileOut, 6);
 
   /* Exit with success for non-vms systems */
 #ifndef VMS
@@ -1,4 +1,4 @@
-/*                                                          19.May.2000 v1.02
+/*                                                          17.Oct.2026 v1.03
 =============================================================================
 
                           U    U   GGG    SSSS  TTTTT
@@ -44,6 +44,7 @@ FUNCTIONS:
   G727_reset ...... G727 reset function;
   G727_encode ..... G727 encoder function;
   G727_decode ..... G727 decoder function;
+  G727_decode_multi G727 decoder of an embedded stream at several rates;
 
 HISTORY:
   01.Apr.1995  0.98  Version of the G727 module in C++ code
@@ -52,6 +53,8 @@ HISTORY:
   04.Aug.1997  1.01  Eliminated compilation warning about unused variables
                      as per revision from <Morgan.Lindqvist@era-t.ericsson.se>
   19.May.2000  v1.02 Corrected self-documentation of functions. <simao>
+  17.Oct.2026  v1.03 Added g727_decode_multi(), decoding an embedded ADPCM
+                     stream at several rates in one pass.
 =============================================================================
 */
 
@@ -330,6 +333,130 @@ void g727_decode_block (short *src, short *dst, short n, short law, short cbits,
 /* ...................... End of G727_decode_block() ..................... */
 
 
+/*
+  ----------------------------------------------------------------------------
+
+  void g727_decode_multi (short *src, short **dst, short n, short law,
+  ~~~~~~~~~~~~~~~~~~~~~~  short cbits, short ebits, short nrates,
+                          short *enh, g727_state *st);
+
+  Description:
+  ~~~~~~~~~~~~
+
+  Simulation of the ITU-T G.727 embedded ADPCM decoder, decoding one
+  ADPCM stream at several rates in a single pass. Takes the ADPCM input
+  array of shorts `src' of length `n', with cbits core bits and ebits
+  enhancement bits, and saves in `dst[k]' the samples (A or mu law)
+  decoded with only the enh[k] most significant enhancement bits, for
+  k = 0 .. nrates-1. Each output is identical to the one of
+  g727_decode_block() for the stream with the (ebits-enh[k]) least
+  significant bits dropped, with cbits core and enh[k] enhancement
+  bits.
+
+  The adaptation of the decoder (quantizer scale factor, speed control,
+  predictor and tone/transition detector) only uses the core bits
+  (G.727 feed-back path), so it is the same for all the rates of the
+  stream and is done once per sample, in `st'. Only the feed-forward
+  path (inverse quantizer at the full rate, reconstructed signal,
+  output PCM conversion and synchronous coding adjustment) is computed
+  for each rate.
+
+  The law is A if `law'=='1', and mu law if `law'=='0'.
+
+  Parameters:
+  ~~~~~~~~~~~
+  src .......... 16-bit right justified ADPCM-encoded samples with cbits
+                 core bits and ebits enhancement bits
+  dst .......... nrates arrays of A- or u-law 16-bit right justified
+                 decoded samples
+  n ............ Number of samples to decode.
+  law .......... encoding law (character '1'=A-law, character '0'=u-law).
+  cbits ........ number of core bits
+  ebits ........ number of enhancement bits of the input
+  nrates ....... number of output rates
+  enh .......... number of enhancement bits (0..ebits) of each output
+  g727_state ... G.727 state variable structure, shared by all rates
+
+  Return value:
+  ~~~~~~~~~~~~~
+  None.
+
+  Prototype:      in file g727.h
+  ~~~~~~~~~~
+
+  History:
+  ~~~~~~~~
+  17.Oct.26  1.03  Created from g727_decode_sample().
+ ----------------------------------------------------------------------------
+*/
+void g727_decode_multi (short *src, short **dst, short n, short law, short cbits, short ebits, short nrates, short *enh, g727_state * st) {
+  Int8 code;
+  Int8 ic;
+  Int8 al;
+  Int16 y;
+  Int32 yl;
+  Int16 dqfb;
+  Int16 se;
+  Int16 sez;
+  Int16 srfb;
+  Int8 pk0;
+  Int8 sigpk;
+  Int16 a2p;
+  Int8 tr;
+  Int8 tdp;
+  Int8 in;
+  Int16 dqff;
+  short rt;
+  short i, k;
+
+  assert (2 <= cbits && cbits <= 4 && ebits >= 0 && cbits + ebits <= 5);
+  for (k = 0; k < nrates; k++)
+    assert (0 <= enh[k] && enh[k] <= ebits);
+
+  /* Fix for compatibility with g726_decode() definitions */
+  if (law == '1')
+    law = 1;
+  else if (law == '0')
+    law = 0;
+
+  for (i = 0; i < n; i++) {
+    code = (Int8) src[i];
+
+    /* Feed-back path, common to all rates */
+    ic = g727_get_ic (code, ebits);
+
+    al = g727_get_al (&st->asc);
+
+    y = g727_get_y (&st->qsfa, al);
+    yl = g727_get_yl (&st->qsfa);
+
+    dqfb = g727_get_dq (y, ic, cbits);
+
+    g727_get_se_sez (&st->aprsc, &se, &sez);
+    srfb = g727_get_sr (dqfb, se);
+    a2p = g727_get_a2p (&st->aprsc, dqfb, sez, &pk0, &sigpk);
+
+    tr = g727_get_tr (&st->ttd, yl, dqfb);
+    tdp = g727_get_tdp (a2p);
+
+    /* Feed-forward path, once per rate; at the core rate dqff is dqfb */
+    for (k = 0; k < nrates; k++) {
+      in = code >> (ebits - enh[k]);
+      rt = cbits + enh[k];
+      dqff = enh[k] == 0 ? dqfb : g727_get_dq (y, in, rt);
+      dst[k][i] = g727_get_sd (g727_get_srff (dqff, se), se, in, y, law, rt);
+    }
+
+    g727_qsfa_transit (&st->qsfa, ic, y, cbits);
+    g727_asc_transit (&st->asc, ic, y, tr, tdp, cbits);
+    g727_aprsc_transit (&st->aprsc, dqfb, tr, srfb, a2p, pk0, sigpk);
+    g727_ttd_transit (&st->ttd, tr, tdp);
+  }
+}
+
+/* ...................... End of G727_decode_multi() ..................... */
+
+
 /*
   ----------------------------------------------------------------------------
 
@@ -1,4 +1,4 @@
-/*                                                          02.Feb.2010  v1.11
+/*                                                          17.Oct.2026  v1.12
   ============================================================================
 
   G727DEMO.C
@@ -22,6 +22,14 @@
   Output data will be generated in the same format as decribed
   above for the input data.
 
+  With option -rates, the ADPCM stream is decoded at each of the given
+  numbers of bits per sample (between Nc and Nc+Ne, each at most once)
+  in a single pass (see g727_decode_multi()), and the output of each
+  rate is saved in a file named as OutFile followed by a dot and the
+  number of bits, e.g. "-rates 5432" with OutFile "sp.o" gives sp.o.5,
+  sp.o.4, sp.o.3 and sp.o.2. Each file is identical to the decoding of the ADPCM stream
+  with its least significant bits dropped down to that rate.
+
   Usage:
   ~~~~~~
   $ G727demo [-options] InpFile OutFile
@@ -43,6 +51,8 @@
   -law l .... Law to use: A, u, l(inear) [default: A-law]
   -core # ... Number of core bits in sample (2, 3, 4, 5) [dft: 4]
   -enh # .... Number of enhancement bits (0, 1, 2, 3) [dft: 0]
+  -rates ### Decode at all the listed numbers of bits per sample in one
+             pass, e.g. 5432 [default: only Nc+Ne]
   -blk # .... Number of samples per processing block [def: 256]
   -frame # .. same as block size
   -start # ..  starting block to measure [default: first]
@@ -80,6 +90,8 @@
                      <simao.campos@labs.comsat.com>
   02.Feb.2010  1.11  Modified maximum string length, and implicit
                      casting of toupper() argument removed. (y.hiwasaki)
+  17.Oct.2026  1.12  Added option -rates for the one-pass decoding of the
+                     embedded stream at several rates.
   ============================================================================
 */
 
@@ -105,6 +117,9 @@
 #include "../g711/g711.h"
 
 
+/* Maximum number of rates decoded in one pass (2 to 5 bits) */
+#define MAX_RATES 4
+
 /* Global variables */
 FILE *in, *out;
 
@@ -157,6 +172,8 @@ void display_usage () {
   printf ("  -law l .... Law to use: A, u, l(inear) [default: A-law]\n");
   printf ("  -core # ... Number of core bits in sample (2, 3, 4, 5) [dft: 4]\n");
   printf ("  -enh # .... Number of enhancement bits (0, 1, 2, 3) [dft: 0]\n");
+  printf ("  -rates ### Decode at all the listed numbers of bits per sample in one\n");
+  printf ("             pass, e.g. 5432; outputs are OutFile.5, OutFile.4, ...\n");
   printf ("  -blk # .... Number of samples per processing block [def: 256]\n");
   printf ("  -frame # .. same as block size\n");
   printf ("  -start # ..  starting block to measure [default: first]\n");
@@ -193,14 +210,17 @@ int main (int argc, char **argv) {
   short inp_type, out_type;
   g727_state enc_state, dec_state;
   long N = 256, N1 = 1, N2 = 0, cur_blk, smpno;
+  short nr = 0, r_enh[MAX_RATES], *mr_buf[MAX_RATES];
+  char *rates = NULL;
+  int k;
 
   /* General-purpose, progress indication */
   static char quiet = 0, funny[9] = "|/-\\|/-\\";
   char encode = 1, decode = 1;  /* Default: encode+decode operation */
 
   /* File variables */
-  char FileIn[MAX_STRLEN], FileOut[MAX_STRLEN];
-  FILE *Fi, *Fo;
+  char FileIn[MAX_STRLEN], FileOut[MAX_STRLEN], FileMr[MAX_RATES][MAX_STRLEN + 3];
+  FILE *Fi, *Fo = NULL, *Fm[MAX_RATES];
   int inp, out;
   long start_byte;
 #ifdef VMS
@@ -317,6 +337,13 @@ int main (int argc, char **argv) {
         /* Define number of enhancement bits for operation */
         ne = atoi (argv[2]);
 
+        /* Move argv over the option to the next argument */
+        argv += 2;
+        argc -= 2;
+      } else if (strcmp (argv[1], "-rates") == 0) {
+        /* Define the numbers of bits of a multi-rate decoding */
+        rates = argv[2];
+
         /* Move argv over the option to the next argument */
         argv += 2;
         argc -= 2;
@@ -354,6 +381,26 @@ int main (int argc, char **argv) {
     exit (5);
   }
 
+  /* Rates of a multi-rate decoding, as numbers of enhancement bits */
+  if (rates != NULL) {
+    if (!decode)
+      HARAKIRI ("Option -rates needs decoding! Aborted...\n", 5);
+    for (; *rates; rates++) {
+      if (*rates == ',')
+        continue;
+      if (nr == MAX_RATES || *rates < '0' + nc || *rates > '0' + nc + ne) {
+        fprintf (stderr, "Invalid rates for (%d,%d): %d bits or more than %d rates-Aborted\n", nc, ne, *rates - '0', MAX_RATES);
+        exit (5);
+      }
+      for (k = 0; k < nr; k++)
+        if (r_enh[k] == *rates - '0' - nc) {
+          fprintf (stderr, "Invalid rates for (%d,%d): %d bits listed twice-Aborted\n", nc, ne, *rates - '0');
+          exit (5);
+        }
+      r_enh[nr++] = *rates - '0' - nc;
+    }
+  }
+
   /* Compose word length */
   wordLen = nc + ne;
 
@@ -416,6 +463,9 @@ int main (int argc, char **argv) {
   if ((tmp_buf = (short *) calloc (N, sizeof (short))) == NULL)
     HARAKIRI ("Error in memory allocation!\n", 1);
 #endif
+  for (k = 0; k < nr; k++)
+    if ((mr_buf[k] = (short *) calloc (N, sizeof (short))) == NULL)
+      HARAKIRI ("Error in memory allocation!\n", 1);
 
 /*
  * ......... FILE PREPARATION .........
@@ -430,9 +480,18 @@ int main (int argc, char **argv) {
 #ifdef VMS
   sprintf (mrs, "mrs=%d", 512);
 #endif
-  if ((Fo = fopen (FileOut, WB)) == NULL)
-    KILL (FileOut, 3);
-  out = fileno (Fo);
+  if (nr == 0) {
+    if ((Fo = fopen (FileOut, WB)) == NULL)
+      KILL (FileOut, 3);
+    out = fileno (Fo);
+  }
+
+  /* Creates one output file per rate, named OutFile.<bits> */
+  for (k = 0; k < nr; k++) {
+    sprintf (FileMr[k], "%s.%d", FileOut, nc + r_enh[k]);
+    if ((Fm[k] = fopen (FileMr[k], WB)) == NULL)
+      KILL (FileMr[k], 3);
+  }
 
   /* Move pointer to 1st block of interest */
   if (fseek (Fi, start_byte, 0) < 0l)
@@ -472,13 +531,30 @@ int main (int argc, char **argv) {
     /* Carry out the desired operation */
     if (encode && !decode)
       g727_encode (inp_buf, out_buf, smpno, law, nc, ne, &enc_state);
+    else if (decode && !encode && nr > 0)
+      g727_decode_multi (inp_buf, mr_buf, smpno, law, nc, ne, nr, r_enh, &dec_state);
     else if (decode && !encode)
       g727_decode (inp_buf, out_buf, smpno, law, nc, ne, &dec_state);
     else if (encode && decode) {
       g727_encode (inp_buf, tmp_buf, smpno, law, nc, ne, &enc_state);
-      g727_decode (tmp_buf, out_buf, smpno, law, nc, ne, &dec_state);
+      if (nr > 0)
+        g727_decode_multi (tmp_buf, mr_buf, smpno, law, nc, ne, nr, r_enh, &dec_state);
+      else
+        g727_decode (tmp_buf, out_buf, smpno, law, nc, ne, &dec_state);
     }
 
+    /* Expand and save the output of each rate of a multi-rate decoding */
+    for (k = 0; k < nr; k++) {
+      if (out_type == IS_LIN) {
+        alaw_expand (smpno, mr_buf[k], tmp_buf);
+        memcpy (mr_buf[k], tmp_buf, sizeof (short) * smpno);
+      }
+      if ((long) fwrite (mr_buf[k], sizeof (short), smpno, Fm[k]) < smpno)
+        KILL (FileMr[k], 6);
+    }
+    if (nr > 0)
+      continue;
+
     /* Expand linear input samples */
     if (out_type == IS_LIN) {
       /* Compress using A-law */
@@ -500,7 +576,12 @@ int main (int argc, char **argv) {
 
   /* Close input and output files */
   fclose (Fi);
-  fclose (Fo);
+  if (Fo != NULL)
+    fclose (Fo);
+  for (k = 0; k < nr; k++) {
+    fclose (Fm[k]);
+    free (mr_buf[k]);
+  }
 
   /* Exit with success for non-vms systems */
 #ifndef VMS
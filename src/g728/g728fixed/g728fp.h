@@ -101,6 +101,7 @@ extern "C" {
 #define	AFTERFEMAX	16      /* max number of 2.5msec frames to limit gain */
 #define	FEGAINMAX	1024    /* maximum gain growth after FE in dB, 2. Q9 */
 #define	Q_ETPAST	2
+#define	RANDLEN		17      /* Length of the random generator table */
 
   typedef struct Statelpc {
     Nshift q;
@@ -205,6 +206,9 @@ extern "C" {
     Float fscaleavg;            /* average scale factor for unvoiced frame */
     Nshift fscaleavgq;
     Float ogaindb;              /* old gain, for limiting gain growth */
+    long randary[RANDLEN];      /* random generator for unvoiced pitch */
+    int randi1;
+    int randi2;
       Float (*lgupdate) (Float, int, int);
     void (*scalecv) (int, int, Gain *, Statelpc *);
   } G728FpDecData;
@@ -260,7 +264,8 @@ extern "C" {
   extern void g728fp_erasedsetup (int kp, Float tap, int msec10, G728FpDecData * d);
   extern void g728fp_erasedex (Statelpc *, Float *, G728FpDecData * d);
   extern Short g728fp_log1010 (Gain *);
-  extern int g728fp_mrand (void);
+  extern void g728fp_mrandinit (G728FpDecData * d);
+  extern int g728fp_mrand (G728FpDecData * d);
 
   void WINAPIV error (char *, ...);
 
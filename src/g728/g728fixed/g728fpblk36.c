@@ -17,7 +17,7 @@
 #include "g728fp.h"
 
 /* weighting filter hybrid window */
-static Float wnrw[NSBWSZ] = {
+static const Float wnrw[NSBWSZ] = {
   1957, 3908, 5845, 7760, 9648,
   11502, 13314, 15079, 16790, 18441,
   20026, 21540, 22976, 24331, 25599,
@@ -17,7 +17,7 @@
 #include "g728fp.h"
 
 /* log-gain hybrid window */
-static Float wnrg[NSBGSZ] = {
+static const Float wnrg[NSBGSZ] = {
   3026, 6025, 8973, 11845, 14615,
   17261, 19759, 22088, 24228, 26162,
   27872, 29344, 30565, 31525, 32216,
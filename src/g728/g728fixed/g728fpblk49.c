@@ -17,7 +17,7 @@
 #include "g728fp.h"
 
 /* LPC filter hybrid window */
-static Float wnr[NSBSZ] = {
+static const Float wnr[NSBSZ] = {
   1565, 3127, 4681, 6225, 7755,
   9266, 10757, 12223, 13661, 15068,
   16441, 17776, 19071, 20322, 21526,
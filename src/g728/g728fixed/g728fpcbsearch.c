@@ -16,17 +16,17 @@
 
 #include "g728fp.h"
 
-static Float g2[NG] = {         /* 2*gq */
+static const Float g2[NG] = {         /* 2*gq */
   4224, 7392, 12936, 22638,
   -4224, -7392, -12936, -22638
 };
 
-static Float gsq[NG] = {        /* gq*gq */
+static const Float gsq[NG] = {        /* gq*gq */
   545, 1668, 5107, 15640,
   545, 1668, 5107, 15640
 };
 
-static Float gb[] = {           /* gain quantizer cell boundaries */
+static const Float gb[] = {           /* gain quantizer cell boundaries */
   5808, 10164, 17787
 };
 
@@ -31,7 +31,7 @@ static Float iwpfz[] = {
   1236, 803, 522, 339, 221
 };
 
-static Float fatten[LPC] = {    /* frame erasure LPC coef. attenuation, Q14 */
+static const Float fatten[LPC] = {    /* frame erasure LPC coef. attenuation, Q14 */
   15892, 15416, 14953, 14505, 14069,
   13647, 13238, 12841, 12456, 12082,
   11719, 11368, 11027, 10696, 10375,
@@ -117,6 +117,7 @@ void g728fp_decinit (G728FpDecData * d) {
   d->adcount = d->feframesz - 1;
   d->feframevectors = d->feframesz * 4;
   d->feframesamples = d->feframevectors * IDIM;
+  g728fp_mrandinit (d);
   d->lgupdate = g728fp_lgupdate;
   d->scalecv = g728fp_scalecv;
 }
@@ -24,12 +24,12 @@
 #define NUNVOICEDFEGAIN	6
 
 /* Scaling factors for 10 msec intervals in Q15 format */
-static Short voicedgain[NVOICEDFEGAIN] = {      /* voiced speech */
+static const Short voicedgain[NVOICEDFEGAIN] = {      /* voiced speech */
   /* .8, .8, .6, .4, .2 */
   26214, 26214, 19661, 13107, 6554
 };
 
-static Short unvoicedgain[NUNVOICEDFEGAIN] = {  /* unvoiced speech */
+static const Short unvoicedgain[NUNVOICEDFEGAIN] = {  /* unvoiced speech */
   /* 1., 1., .8, .6, .4, .2 */
   32767, 32767, 26214, 19661, 13107, 6554
 };
@@ -108,7 +108,7 @@ void g728fp_erasedex (Statelpc * et, Float * gaindb, G728FpDecData * d) {
      * to 0, skip the code below.
      */
     else if (d->fscale != 0) {
-      d->fdelay = g728fp_mrand () / 243;
+      d->fdelay = g728fp_mrand (d) / 243;
       for (f = 0, i = 0; i < IDIM; i++)
         f += abs (d->etpast[d->fdelay + i]);
       a = (Long) f;
@@ -17,7 +17,7 @@
 #include "g728fp.h"
 
 /* shape code book gain in dB */
-static Short y_db[NCWD] = {
+static const Short y_db[NCWD] = {
   -227, 10308, 6549, 7753, 7597,
   16563, 6406, 11933, 13569, 10569,
   16328, 6536, 15803, 11673, 21318,
@@ -47,7 +47,7 @@ static Short y_db[NCWD] = {
 };
 
 /* gain code book gain in dB */
-static Short gq_db[NG] = {
+static const Short gq_db[NG] = {
   -11783, -1828, 8127, 18082,
   -11783, -1828, 8127, 18082
 };
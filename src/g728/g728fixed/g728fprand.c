@@ -16,9 +16,13 @@
 
 #include "g728fp.h"
 
-#define	LENG	17
-static
-long ary[LENG] = {
+/*
+ * Initial table of the additive random generator. The table and its two
+ * indices are part of the decoder state, so that decoders running at the
+ * same time do not share the sequence.
+ */
+static const
+long ary0[RANDLEN] = {
   0x4B14EA50L,
   0x53C4A8E0L,
   0x67B1FA98L,
@@ -38,17 +42,21 @@ long ary[LENG] = {
   0x20A713ADL,
 };
 
-static
-int i1 = 0;
-static
-int i2 = 12;
+void g728fp_mrandinit (G728FpDecData * d) {
+  int i;
+
+  for (i = 0; i < RANDLEN; i++)
+    d->randary[i] = ary0[i];
+  d->randi1 = 0;
+  d->randi2 = 12;
+}
 
-int g728fp_mrand (void) {
+int g728fp_mrand (G728FpDecData * d) {
 
-  if (++i1 >= LENG)
-    i1 = 0;
-  if (++i2 >= LENG)
-    i2 = 0;
-  ary[i1] += ary[i2];
-  return ((ary[i1] >> 15) & 0x7FFF);
+  if (++d->randi1 >= RANDLEN)
+    d->randi1 = 0;
+  if (++d->randi2 >= RANDLEN)
+    d->randi2 = 0;
+  d->randary[d->randi1] += d->randary[d->randi2];
+  return ((d->randary[d->randi1] >> 15) & 0x7FFF);
 }
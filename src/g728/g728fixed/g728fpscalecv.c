@@ -16,12 +16,12 @@
 
 #include "g728fp.h"
 
-static Nshift ic2gq[NG] = {
+static const Nshift ic2gq[NG] = {
   3, 3, 2, 1,
   3, 3, 2, 1
 };
 
-static Float gq[NG] = {
+static const Float gq[NG] = {
   4224, 7392, 12936, 22638,
   -4224, -7392, -12936, -22638
 };
@@ -0,0 +1,288 @@
+/*                                                           17.Oct.2026 v1.0
+  ===========================================================================
+
+  G728FP_MT_TEST.C
+  ~~~~~~~~~~~~~~~~
+
+  Description:
+  ~~~~~~~~~~~~
+
+  Regression test of the re-entrancy of the fixed-point G.728 codec: all
+  of its state is kept in G728FpEncData/G728FpDecData, so any number of
+  encoders and decoders can run at the same time.
+
+  The job list covers the test vectors of ../test_data: encoding of
+  in1..in6, decoding of cw1..cw6 without post-filter, decoding of cw4
+  with post-filter, and decoding of cw1 and cw4 with the erasure mask
+  mask1 (the only path that uses the random generator of the decoder).
+  Every channel runs its own thread, and each thread runs the whole list
+  several times, starting at a different job, so that many instances are
+  active at the same time. Every output must be identical to the
+  reference: the coded/decoded test vectors for the first jobs, and the
+  files written by the g728fp program for the erasure jobs (see the PLC
+  tests in CMakeLists.txt).
+
+  Usage:
+  ~~~~~~
+  $ g728fp_mt_test [-dir path] [threads]
+
+  where path is the directory of the test vectors [default: ../test_data]
+  and threads is the number of channels/threads [default: 8]. Files are
+  little endian, as with the -little option of g728fp.
+
+  History:
+  ~~~~~~~~
+  17.Oct.2026 v1.0 Created.
+
+  ===========================================================================
+*/
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../g728fp.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#include <process.h>
+#else
+#include <pthread.h>
+#endif
+
+#define MAX_CHANNELS 64
+#define N_REPEAT     1
+#define FSZ          80         /* 10 ms frame, in samples */
+#define VSZ          (FSZ / IDIM)       /* frame, in codewords */
+
+#define J_ENC  0
+#define J_DEC  1
+#define J_POST 2
+#define J_PLC  3
+
+typedef struct {
+  int mode;
+  char *in;                     /* input file */
+  char *ref;                    /* expected output file */
+  Short *x;                     /* input data */
+  long nx;
+  Short *y;                     /* expected output */
+  long ny;
+  char *mask;                   /* erasure mask (J_PLC) */
+  long nmask;
+} JOB;
+
+static JOB job[] = {
+  {J_ENC, "in1.bin", "incw1g.bin"},
+  {J_ENC, "in2.bin", "incw2g.bin"},
+  {J_ENC, "in3.bin", "incw3g.bin"},
+  {J_ENC, "in4.bin", "incw4g.bin"},
+  {J_ENC, "in5.bin", "incw5g.bin"},
+  {J_ENC, "in6.bin", "incw6g.bin"},
+  {J_DEC, "cw1.bin", "outa1g.bin"},
+  {J_DEC, "cw2.bin", "outa2g.bin"},
+  {J_DEC, "cw3.bin", "outa3g.bin"},
+  {J_DEC, "cw4.bin", "outa4g.bin"},
+  {J_DEC, "cw5.bin", "outa5g.bin"},
+  {J_DEC, "cw6.bin", "outa6g.bin"},
+  {J_POST, "cw4.bin", "outb4g.bin"},
+  {J_PLC, "cw1.bin", "cw1-plc.bin.fp.out"},
+  {J_PLC, "cw4.bin", "cw4-plc.bin.fp.out"},
+};
+
+#define N_JOBS (int) (sizeof (job) / sizeof (job[0]))
+
+typedef struct {
+  int first;                    /* first job of the channel */
+  int mismatch;
+} CHANNEL;
+
+
+/* Fatal error, as in g728fp.c */
+void WINAPIV error (char *s, ...) {
+  va_list ap;
+  char *s2;
+
+  va_start (ap, s);
+  s2 = va_arg (ap, char *);
+  va_end (ap);
+  fprintf (stderr, s, s2);
+  fprintf (stderr, "\n");
+  exit (1);
+}
+
+
+/* Read a whole little-endian file of 16-bit words */
+static Short *load (char *dir, char *name, long *n) {
+  char path[1024];
+  FILE *fp;
+  Short *x;
+  unsigned char *p;
+  long i, size;
+
+  sprintf (path, "%.900s/%.100s", dir, name);
+  if ((fp = fopen (path, "rb")) == NULL)
+    error ("Can't open file %s", path);
+  fseek (fp, 0L, SEEK_END);
+  size = ftell (fp);
+  rewind (fp);
+  if ((x = (Short *) malloc (size + 1)) == NULL)
+    error ("Malloc failed");
+  if (fread (x, 1, size, fp) != (size_t) size)
+    error ("Can't read file %s", path);
+  fclose (fp);
+
+  /* to machine order */
+  for (p = (unsigned char *) x, i = 0; i < size / 2; i++, p += 2)
+    x[i] = (Short) (p[0] | (p[1] << 8));
+  *n = size / 2;
+  return x;
+}
+
+
+/* Run one job; returns 1 if the output differs from the reference */
+static int run_job (JOB * j) {
+  G728FpEncData *ed;
+  G728FpDecData *dd;
+  Short out[FSZ];
+  long i, o, m;
+  int c, differ = 0;
+
+  if (j->mode == J_ENC) {
+    if ((ed = (G728FpEncData *) malloc (sizeof (G728FpEncData))) == NULL)
+      error ("Malloc failed");
+    g728fp_encinit (ed);
+    for (i = 0, o = 0; i + FSZ <= j->nx; i += FSZ, o += VSZ) {
+      g728fp_encode (out, j->x + i, FSZ, ed);
+      differ |= o + VSZ > j->ny || memcmp (out, j->y + o, VSZ * sizeof (Short)) != 0;
+    }
+    free (ed);
+  } else {
+    if ((dd = (G728FpDecData *) malloc (sizeof (G728FpDecData))) == NULL)
+      error ("Malloc failed");
+    g728fp_decinit (dd);
+    if (j->mode == J_PLC)
+      g728fp_setfesize (4, dd);
+    else
+      g728fp_setpostf (j->mode == J_POST, dd);
+    for (i = 0, o = 0, m = 0; i + VSZ <= j->nx; i += VSZ, o += FSZ) {
+      if (j->mode == J_PLC) {
+        /* next 0/1 of the mask, rolling over as in g728fp */
+        do {
+          c = j->mask[m++ % j->nmask];
+        } while (c != '0' && c != '1');
+        if (c == '1')
+          g728fp_eraseframe (out, FSZ, dd);
+        else
+          g728fp_decode (out, j->x + i, FSZ, dd);
+      } else
+        g728fp_decode (out, j->x + i, FSZ, dd);
+      differ |= o + FSZ > j->ny || memcmp (out, j->y + o, FSZ * sizeof (Short)) != 0;
+    }
+    free (dd);
+  }
+  return differ;
+}
+
+
+#ifdef _WIN32
+static unsigned __stdcall channel_thread (void *arg)
+#else
+static void *channel_thread (void *arg)
+#endif
+{
+  CHANNEL *ch = (CHANNEL *) arg;
+  int k;
+
+  for (k = 0; k < N_REPEAT * N_JOBS; k++)
+    ch->mismatch += run_job (&job[(ch->first + k) % N_JOBS]);
+  return 0;
+}
+
+
+int main (int argc, char *argv[]) {
+  static CHANNEL ch[MAX_CHANNELS];
+  char *dir = "../test_data", *mask;
+  long nmask, k;
+  int n = 8, c, fail = 0;
+  FILE *fp;
+  char path[1024];
+#ifdef _WIN32
+  HANDLE tid[MAX_CHANNELS];
+#else
+  pthread_t tid[MAX_CHANNELS];
+#endif
+
+  if (argc > 2 && strcmp (argv[1], "-dir") == 0) {
+    dir = argv[2];
+    argc -= 2;
+    argv += 2;
+  }
+  if (argc > 1)
+    n = atoi (argv[1]);
+  if (n < 1 || n > MAX_CHANNELS) {
+    fprintf (stderr, "Number of threads must be between 1 and %d\n", MAX_CHANNELS);
+    return 2;
+  }
+
+  /* Erasure mask, as a string */
+  sprintf (path, "%.900s/mask1", dir);
+  if ((fp = fopen (path, "rb")) == NULL)
+    error ("Can't open file %s", path);
+  fseek (fp, 0L, SEEK_END);
+  nmask = ftell (fp);
+  rewind (fp);
+  if ((mask = (char *) malloc (nmask + 1)) == NULL || fread (mask, 1, nmask, fp) != (size_t) nmask)
+    error ("Can't read file %s", path);
+  fclose (fp);
+  for (k = 0; k < nmask; k++)
+    if (mask[k] == '0' || mask[k] == '1')
+      break;
+  if (k == nmask)
+    error ("Empty erasure mask %s", path);
+
+  /* Input and reference data */
+  for (k = 0; k < N_JOBS; k++) {
+    job[k].x = load (dir, job[k].in, &job[k].nx);
+    job[k].y = load (dir, job[k].ref, &job[k].ny);
+    job[k].mask = mask;
+    job[k].nmask = nmask;
+  }
+
+  /* Single instance, in the main thread */
+  for (k = 0; k < N_JOBS; k++)
+    if (run_job (&job[k])) {
+      fprintf (stderr, "%s -> %s: output differs from the reference\n", job[k].in, job[k].ref);
+      fail++;
+    }
+
+  /* One thread per channel */
+  for (c = 0; c < n; c++) {
+    ch[c].first = c % N_JOBS;
+    ch[c].mismatch = 0;
+#ifdef _WIN32
+    tid[c] = (HANDLE) _beginthreadex (NULL, 0, channel_thread, &ch[c], 0, NULL);
+    if (tid[c] == 0) {
+#else
+    if (pthread_create (&tid[c], NULL, channel_thread, &ch[c]) != 0) {
+#endif
+      fprintf (stderr, "Unable to create thread %d\n", c);
+      return 2;
+    }
+  }
+  for (c = 0; c < n; c++) {
+#ifdef _WIN32
+    WaitForSingleObject (tid[c], INFINITE);
+    CloseHandle (tid[c]);
+#else
+    pthread_join (tid[c], NULL);
+#endif
+    if (ch[c].mismatch) {
+      fprintf (stderr, "Channel %d: %d of %d jobs differ from the reference\n", c, ch[c].mismatch, N_REPEAT * N_JOBS);
+      fail++;
+    }
+  }
+
+  printf ("%d channels, %d jobs each: %s\n", n, N_REPEAT * N_JOBS, fail ? "FAILED" : "identical results");
+  return fail ? 1 : 0;
+}
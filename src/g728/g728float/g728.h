@@ -43,6 +43,10 @@ extern "C" {
  * Withough this option, a single-precision floating-point version is created.
  * The single-precision version runs faster, but use the double-precision
  * version for an exact match with the test vectors.
+ *
+ * -DG728_FAST_CBSEARCH
+ * Uses the vectorized codebook search g728_cbsearch16v() in the encoder
+ * instead of g728_cbsearch16(). Both return the same indices.
  */
 #ifdef USEDOUBLES
   typedef double Float;
@@ -305,6 +309,9 @@ extern "C" {
   extern void g728_wfilter (Float *, Float *, Float *, Float *);
   extern void g728_zirlpcf (Float *, Float *);
   extern void g728_cbsearch16 (Float *, Float *, Float *, int *, int *);
+  extern void g728_cbsearch16v (Float *, Float *, Float *, int *, int *);
+  extern void g728_cbsinit (void);
+  extern int g728_cbsimd (int);
 
 /* internal G.728 post-filter routines */
   extern void g728_decp (int *, Float *, Float *, Float *);
@@ -0,0 +1,162 @@
+/*                                                           17.Oct.2026 v1.0
+  ===========================================================================
+
+  G728CBBENCH.C
+  ~~~~~~~~~~~~~
+
+  Description:
+  ~~~~~~~~~~~~
+
+  Benchmark and equivalence check of the codebook searches of the
+  floating-point G.728 encoder: g728_cbsearch16() (reference) and
+  g728_cbsearch16v() (vectorized), the latter with its plain C and its
+  SIMD kernel. Pseudo-random targets and impulse responses are searched
+  with each version; the indices must be identical. Some degenerate
+  cases (zero target, zero impulse response, codevectors with zero
+  energy) are also included.
+
+  Usage:
+  ~~~~~~
+  $ g728cbbench [-options]
+
+  Options:
+  -n N ......... number of searches [default: 1000000]
+  -check ....... only check the searches (no timing), and return a
+                 non-zero exit code if any index differs
+
+  Original author:
+  ~~~~~~~~~~~~~~~~
+  ITU-T STL contributors
+
+  History:
+  ~~~~~~~~
+  17.Oct.2026 v1.0 Created.
+
+  ===========================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "g728.h"
+
+#define N_SETS 256              /* distinct target/impulse response sets */
+
+typedef struct {
+  Float t[IDIM];
+  Float h[IDIM];
+  Float y2[NCWD];
+} SEARCH_SET;
+
+typedef void (*CBSEARCH) (Float *, Float *, Float *, int *, int *);
+
+
+void WINAPIV error (char *s, ...) {
+  fprintf (stderr, "%s\n", s);
+  exit (1);
+}
+
+
+/* Run n searches over the sets; returns the CPU time */
+double run_search (CBSEARCH f, SEARCH_SET * set, long n, int *ig, int *is) {
+  long i;
+  clock_t t0;
+
+  t0 = clock ();
+  for (i = 0; i < n; i++) {
+    ig[i % N_SETS] = is[i % N_SETS] = -1;
+    f (set[i % N_SETS].t, set[i % N_SETS].h, set[i % N_SETS].y2, &ig[i % N_SETS], &is[i % N_SETS]);
+  }
+  return (double) (clock () - t0) / CLOCKS_PER_SEC;
+}
+
+
+void display_usage () {
+  printf ("G728CBBENCH.C - Version 1.0 of 17.Oct.2026\n\n");
+  printf (" Benchmark and equivalence check of the G.728 codebook searches.\n\n");
+  printf (" Usage:\n");
+  printf (" $ g728cbbench [-options]\n\n");
+  printf (" Options:\n");
+  printf ("  -n N ....... number of searches [default: 1000000]\n");
+  printf ("  -check ..... only check the searches, no timing\n");
+  exit (-128);
+}
+
+
+int main (int argc, char *argv[]) {
+  static SEARCH_SET set[N_SETS];
+  int ig_ref[N_SETS], is_ref[N_SETS], ig[N_SETS], is[N_SETS];
+  long n = 1000000L, lcg = 12345, fail = 0;
+  int s, k, check = 0, exact_c, exact_simd, have_simd;
+  double cpu_ref, cpu_c, cpu_simd;
+
+  /* Get options */
+  while (argc > 1 && argv[1][0] == '-')
+    if (strcmp (argv[1], "-n") == 0) {
+      n = atol (argv[2]);
+      argc -= 2;
+      argv += 2;
+    } else if (strcmp (argv[1], "-check") == 0) {
+      check = 1;
+      argc--;
+      argv++;
+    } else if (strcmp (argv[1], "-h") == 0 || strcmp (argv[1], "-?") == 0) {
+      display_usage ();
+    } else {
+      fprintf (stderr, "ERROR! Invalid option \"%s\" in command line\n\n", argv[1]);
+      display_usage ();
+    }
+  if (check || n < N_SETS)
+    n = N_SETS;
+
+  g728rominit ();
+
+  /* Pseudo-random sets, with a few degenerate ones */
+  for (s = 0; s < N_SETS; s++) {
+    for (k = 0; k < IDIM; k++) {
+      lcg = (lcg * 1103515245 + 12345) & 0x7FFFFFFF;
+      set[s].t[k] = (Float) ((lcg >> 8) - (1L << 22)) / (1L << 21);
+      lcg = (lcg * 1103515245 + 12345) & 0x7FFFFFFF;
+      set[s].h[k] = (Float) ((lcg >> 8) - (1L << 22)) / (1L << 22);
+    }
+    set[s].h[IDIM - 1] = (Float) 1.;
+    if (s == 1)
+      memset (set[s].t, 0, sizeof (set[s].t));
+    if (s == 2)
+      memset (set[s].h, 0, sizeof (set[s].h));
+    g728_normsq (g728rom.y, set[s].h, set[s].y2);
+    if (s == 3)
+      for (k = 0; k < NCWD; k += 3)
+        set[s].y2[k] = (Float) 0.;
+  }
+
+  run_search (g728_cbsearch16, set, N_SETS, ig_ref, is_ref);
+  cpu_ref = run_search (g728_cbsearch16, set, n, ig_ref, is_ref);
+
+  g728_cbsimd (0);
+  cpu_c = run_search (g728_cbsearch16v, set, n, ig, is);
+  exact_c = memcmp (ig, ig_ref, sizeof (ig)) == 0 && memcmp (is, is_ref, sizeof (is)) == 0;
+
+  have_simd = g728_cbsimd (1);
+  cpu_simd = run_search (g728_cbsearch16v, set, n, ig, is);
+  exact_simd = memcmp (ig, ig_ref, sizeof (ig)) == 0 && memcmp (is, is_ref, sizeof (is)) == 0;
+
+  fail = !exact_c + !exact_simd;
+
+  printf ("SIMD kernel: %s\n\n", have_simd ? "avx2" : "none (plain C)");
+  printf ("%-10s %12s %8s %6s\n", "search", "[ksearch/s]", "speedup", "exact");
+  if (check) {
+    printf ("%-10s %12s %8s %6s\n", "reference", "-", "-", "-");
+    printf ("%-10s %12s %8s %6s\n", "vector-c", "-", "-", exact_c ? "yes" : "NO");
+    printf ("%-10s %12s %8s %6s\n", "vector", "-", "-", exact_simd ? "yes" : "NO");
+  } else {
+    printf ("%-10s %12.1f %8s %6s\n", "reference", n / (cpu_ref + 1e-9) / 1e3, "-", "-");
+    printf ("%-10s %12.1f %7.2fx %6s\n", "vector-c", n / (cpu_c + 1e-9) / 1e3, (cpu_ref + 1e-9) / (cpu_c + 1e-9), exact_c ? "yes" : "NO");
+    printf ("%-10s %12.1f %7.2fx %6s\n", "vector", n / (cpu_simd + 1e-9) / 1e3, (cpu_ref + 1e-9) / (cpu_simd + 1e-9), exact_simd ? "yes" : "NO");
+  }
+
+  if (fail)
+    fprintf (stderr, "%ld vectorized search(es) differ from the reference\n", fail);
+  return fail ? 1 : 0;
+}
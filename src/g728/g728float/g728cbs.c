@@ -0,0 +1,177 @@
+#include "g728.h"
+/*
+ * NOTICE:
+ * This software source code ("Software"), and all of its derivations,
+ * is subject to the "ITU-T General Public License". It can be viewed
+ * in the distribution disk, or in the ITU-T Recommendation G.191 on
+ * "SOFTWARE TOOLS FOR SPEECH AND AUDIO CODING STANDARDS".
+ */
+
+/*
+ * Vectorized gain-shape VQ codebook search for the floating point
+ * LD-CELP, G728 coder.
+ *
+ * g728_cbsearch16v() returns the same indices as g728_cbsearch16():
+ * - the correlations of the backward-filtered target with all the
+ *   shape codevectors are computed as one matrix-vector product over
+ *   a transposed copy of g728rom.y, adding the products in the same
+ *   order as g728_vdotp();
+ * - the gain cell is found by counting the boundaries that are not
+ *   above |cor/y2| (the boundaries are increasing, and the count is 3
+ *   also for a NaN, as in the loop of g728_cbsearch16());
+ * - the best shape/gain pair is the first one with the smallest
+ *   distortion, and the indices are left untouched if no distortion is
+ *   below 1e30.
+ *
+ * With double precision (USEDOUBLES) on x86 processors with AVX2, four
+ * codevectors are processed at a time; otherwise a plain C version of
+ * the same algorithm is used.
+ */
+
+#if defined(USEDOUBLES) && (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && !defined(__INTEL_COMPILER)
+#define G728_HAVE_AVX2
+#include <immintrin.h>
+#endif
+
+/* Transposed shape code book, aligned for vector loads */
+#if defined(_MSC_VER)
+static __declspec (align (32))
+     Float yt[IDIM][NCWD];
+#elif defined(__GNUC__)
+static Float yt[IDIM][NCWD] __attribute__ ((aligned (32)));
+#else
+static Float yt[IDIM][NCWD];
+#endif
+
+static int simd = -1;           /* use the AVX2 kernel; -1: not set yet */
+
+/*
+ * Set up the transposed code book; called by g728rominit()
+ */
+void g728_cbsinit (void) {
+  int i, j;
+
+  for (j = 0; j < NCWD; j++)
+    for (i = 0; i < IDIM; i++)
+      yt[i][j] = g728rom.y[j][i];
+}
+
+/*
+ * Enable (on=1) or disable (on=0) the SIMD kernel of g728_cbsearch16v();
+ * returns 1 if the SIMD kernel is used, i.e. if it was enabled and the
+ * processor supports it.
+ */
+int g728_cbsimd (int on) {
+#ifdef G728_HAVE_AVX2
+  simd = on && __builtin_cpu_supports ("avx2");
+#else
+  simd = 0;
+#endif
+  return simd;
+}
+
+#ifdef G728_HAVE_AVX2
+__attribute__ ((target ("avx2")))
+static void cbsearch_avx2 (Float * ct, Float * y2, int *ig, int *is) {
+  __m256d c, q, y2v, g, d, lt, best;
+  __m256i idx, code, bcode, jv;
+  __m256d sign = _mm256_set1_pd (-0.);
+  __m256d zero = _mm256_setzero_pd ();
+  __m256d gb0 = _mm256_set1_pd (g728rom.gb[0]);
+  __m256d gb1 = _mm256_set1_pd (g728rom.gb[1]);
+  __m256d gb2 = _mm256_set1_pd (g728rom.gb[2]);
+  __m256i four = _mm256_set1_epi64x (4);
+  __m256i step = _mm256_set1_epi64x (4 * NG);
+  double bd[4];
+  long long bc[4];
+  int j, k, kbest;
+
+  best = _mm256_set1_pd (1e30);
+  bcode = _mm256_setzero_si256 ();
+  jv = _mm256_set_epi64x (3 * NG, 2 * NG, 1 * NG, 0);   /* shape index * NG */
+  for (j = 0; j < NCWD; j += 4) {
+    /* correlations of 4 codevectors */
+    c = _mm256_setzero_pd ();
+    for (k = 0; k < IDIM; k++)
+      c = _mm256_add_pd (c, _mm256_mul_pd (_mm256_set1_pd (ct[k]), _mm256_load_pd (&yt[k][j])));
+
+    /* gain cell: number of boundaries not above |cor/y2|, +4 if cor <= 0 */
+    y2v = _mm256_loadu_pd (&y2[j]);
+    q = _mm256_andnot_pd (sign, _mm256_div_pd (c, y2v));
+    idx = _mm256_sub_epi64 (_mm256_setzero_si256 (), _mm256_castpd_si256 (_mm256_cmp_pd (q, gb0, _CMP_NLT_UQ)));
+    idx = _mm256_sub_epi64 (idx, _mm256_castpd_si256 (_mm256_cmp_pd (q, gb1, _CMP_NLT_UQ)));
+    idx = _mm256_sub_epi64 (idx, _mm256_castpd_si256 (_mm256_cmp_pd (q, gb2, _CMP_NLT_UQ)));
+    idx = _mm256_add_epi64 (idx, _mm256_and_si256 (four, _mm256_castpd_si256 (_mm256_cmp_pd (c, zero, _CMP_LE_OQ))));
+
+    /* distortion for the gain, and running minimum per lane */
+    g = _mm256_i64gather_pd (g728rom.g2, idx, 8);
+    d = _mm256_mul_pd (g, c);
+    g = _mm256_i64gather_pd (g728rom.gsq, idx, 8);
+    d = _mm256_add_pd (d, _mm256_mul_pd (g, y2v));
+    lt = _mm256_cmp_pd (d, best, _CMP_LT_OQ);
+    best = _mm256_blendv_pd (best, d, lt);
+    code = _mm256_add_epi64 (jv, idx);
+    bcode = _mm256_castpd_si256 (_mm256_blendv_pd (_mm256_castsi256_pd (bcode), _mm256_castsi256_pd (code), lt));
+    jv = _mm256_add_epi64 (jv, step);
+  }
+
+  /* first codevector with the smallest distortion */
+  _mm256_storeu_pd (bd, best);
+  _mm256_storeu_si256 ((__m256i *) bc, bcode);
+  for (kbest = -1, k = 0; k < 4; k++)
+    if (bd[k] < (Float) 1e30 && (kbest < 0 || bd[k] < bd[kbest] || (bd[k] == bd[kbest] && bc[k] < bc[kbest])))
+      kbest = k;
+  if (kbest >= 0) {
+    *ig = (int) (bc[kbest] % NG);
+    *is = (int) (bc[kbest] / NG);
+  }
+}
+#endif
+
+/*
+ * gain-shape VQ codebook search
+ *	vectorized version of g728_cbsearch16()
+ */
+void g728_cbsearch16v (Float * t,       /* gain-normalized target */
+                       Float * h,       /* impulse response of LPC + weighting filter */
+                       Float * y2,      /* energy of filtered codevectors */
+                       int *ig, /* index of the best gain */
+                       int *is) {       /* index of the best shape codevector */
+  int i, j, k;
+  Float d;                      /* distortion */
+  Float dm = (Float) 1e30;      /* best distortion */
+  Float ct[IDIM];               /* backward convolution of target */
+  Float cor[NCWD], cor2;
+
+  for (j = 0; j < IDIM; j++)
+    ct[j] = g728_vdotp (&h[IDIM - 1 - j], t, j + 1);
+
+  if (simd < 0)
+    g728_cbsimd (1);
+#ifdef G728_HAVE_AVX2
+  if (simd) {
+    cbsearch_avx2 (ct, y2, ig, is);
+    return;
+  }
+#endif
+
+  /* correlations with all codevectors */
+  for (j = 0; j < NCWD; j++)
+    cor[j] = (Float) 0.;
+  for (k = 0; k < IDIM; k++)
+    for (j = 0; j < NCWD; j++)
+      cor[j] += ct[k] * yt[k][j];
+
+  for (j = 0; j < NCWD; j++) {
+    cor2 = cor[j] / y2[j];
+    if (cor2 < (Float) 0.)
+      cor2 = -cor2;
+    i = !(cor2 < g728rom.gb[0]) + !(cor2 < g728rom.gb[1]) + !(cor2 < g728rom.gb[2]) + ((cor[j] <= (Float) 0.) << 2);
+    d = g728rom.g2[i] * cor[j] + g728rom.gsq[i] * y2[j];
+    if (d < dm) {
+      dm = d;
+      *ig = i;
+      *is = j;
+    }
+  }
+}
@@ -56,7 +56,11 @@ void g728encinit (G728EncData * d) {
   /* bit-rate related */
   d->gq = g728rom.gq;
   d->gq_db = g728rom.gq_db;
+#ifdef G728_FAST_CBSEARCH
+  d->search = g728_cbsearch16v;
+#else
   d->search = g728_cbsearch16;
+#endif
   d->wpcfv = g728rom.wpcfv;
 }
 
@@ -327,6 +327,8 @@ void g728rominit (void) {
   /* Compute gain in db */
   for (i = 0; i < NG; i++)
     g728rom.gq_db[i] = (F) (10. * log10 (g728rom.gq[i] * g728rom.gq[i]));
+  /* Transposed code book for the vectorized search */
+  g728_cbsinit ();
   f = (Float) 1.;
   for (i = 0; i < LPC; i++) {
     f *= (F) FE_ATTEN;
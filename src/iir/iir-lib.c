@@ -1,4 +1,4 @@
-/*                                                           v3.1 - 22/Feb/1996
+/*                                                           v3.2 - 17/Oct/2026
   =============================================================================
 
                           U    U   GGG    SSSS  TTTTT
@@ -48,6 +48,12 @@ FUNCTIONS    : - stdpcm_kernel(...)   =  parallel-form IIR filter (kernel)
 	       - cascade_iir_kernel(...) = cascade-form IIR filter (kernel)
 	       - cascade_iir_free(...) = deallocate cascade filter memory
 	       - cascade_iir_reset(...) = clear cascade state variables
+	       - cascade_iir_mc_init(...) = multi-channel cascade filter
+	                                    from a cascade filter
+	       - cascade_iir_mc_kernel(...) = multi-channel cascade-form IIR
+	                                      filter (kernel)
+	       - cascade_iir_mc_reset(...) = clear multi-channel state variables
+	       - cascade_iir_mc_free(...) = deallocate multi-channel filter memory
 	       - direct_iir_kernel(...) = direct-form IIR filter (kernel)
 	       - direct_iir_free(...) = deallocate direct filter memory
 	       - direct_iir_reset(...) = clear direct state variables
@@ -61,6 +67,9 @@ HISTORY:
     22.Feb.96 v3.1 Changed inclusion of stdlib.h to inconditional, as
                    suggested by Kirchherr (FI/DBP Telekom) to run under
 		   OpenVMS/AXP <simao@ctd.comsat.com>
+    17.Oct.26 v3.2 Added multi-channel cascade-form IIR filtering, with
+                   the channels in SIMD lanes (AVX on x86-64, selected
+                   at run time).
 
   =============================================================================
 */
@@ -76,6 +85,13 @@ HISTORY:
 /* Definitions for IIR filters */
 #include "iirflt.h"
 
+/* SIMD kernels of the multi-channel cascade; on x86-64 the scalar float
+   arithmetic of the reference kernel is SSE, which the AVX kernels repeat */
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(__INTEL_COMPILER)
+#define IIR_HAVE_AVX
+#include <immintrin.h>
+#endif
+
 
 
 /*
@@ -910,6 +926,424 @@ void cascade_iir_free (CASCADE_IIR * iir_ptr) {
 /* ....................... End of cascade_iir_free() ....................... */
 
 
+/*
+  ============================================================================
+
+  Multi-channel cascade-form IIR filtering
+  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+  The nchan channels of an interleaved signal (or nchan independent signals)
+  run through the same cascade, each channel in one lane of the state
+  variables T[nblocks][4][nlane]. Each frame (one sample of every channel)
+  goes through all the stages; the output (the gain) is only computed for
+  the frames that are kept when down-sampling. The plain C kernels take
+  all the lanes one frame at a time; the AVX kernels take one group of 4
+  (exact) or 8 (fast) lanes at a time through the whole segment.
+
+  With CASCADE_ENGINE_EXACT, the kernels repeat for every lane the
+  arithmetic of cascade_form_iir_down/up_kernel(): float products and
+  denominator sum, double accumulation, states rounded to float; the output
+  of each channel is identical to that of cascade_iir_kernel(). With
+  CASCADE_ENGINE_FAST, all the arithmetic is in single precision.
+
+  History:
+  ~~~~~~~~
+  17.Oct.26 v1.0 Created.
+
+ ============================================================================
+*/
+
+/* Frame kernel of the exact engine, plain C */
+static void cascade_mc_exact_c (CASCADE_IIR_MC * mc, float *xin, float *out) {
+  long c, n, nlane = mc->nlane;
+  float (*a)[2] = mc->a, (*b)[2] = mc->b;
+  float *T0, *T1, *T2, *T3;
+  double *xj = mc->acc, yj;
+
+  for (c = 0; c < nlane; c++)
+    xj[c] = xin[c];
+  for (n = 0; n < mc->nblocks; n++) {
+    T0 = mc->T + 4 * n * nlane;
+    T1 = T0 + nlane;
+    T2 = T1 + nlane;
+    T3 = T2 + nlane;
+    for (c = 0; c < nlane; c++) {
+      yj = xj[c] + a[n][0] * T0[c] + a[n][1] * T1[c];
+      yj -= (b[n][0] * T2[c] + b[n][1] * T3[c]);
+      T1[c] = T0[c];
+      T0[c] = xj[c];
+      T3[c] = T2[c];
+      T2[c] = yj;
+      xj[c] = yj;
+    }
+  }
+  if (out != NULL)
+    for (c = 0; c < nlane; c++)
+      out[c] = xj[c] * mc->gain;
+}
+
+/* Frame kernel of the fast engine, plain C */
+static void cascade_mc_fast_c (CASCADE_IIR_MC * mc, float *xin, float *out) {
+  long c, n, nlane = mc->nlane;
+  float (*a)[2] = mc->a, (*b)[2] = mc->b;
+  float *T0, *T1, *T2, *T3, *xj = (float *) mc->acc, yj, gain = (float) mc->gain;
+
+  for (c = 0; c < nlane; c++)
+    xj[c] = xin[c];
+  for (n = 0; n < mc->nblocks; n++) {
+    T0 = mc->T + 4 * n * nlane;
+    T1 = T0 + nlane;
+    T2 = T1 + nlane;
+    T3 = T2 + nlane;
+    for (c = 0; c < nlane; c++) {
+      yj = xj[c] + a[n][0] * T0[c] + a[n][1] * T1[c] - (b[n][0] * T2[c] + b[n][1] * T3[c]);
+      T1[c] = T0[c];
+      T0[c] = xj[c];
+      T3[c] = T2[c];
+      T2[c] = yj;
+      xj[c] = yj;
+    }
+  }
+  if (out != NULL)
+    for (c = 0; c < nlane; c++)
+      out[c] = xj[c] * gain;
+}
+
+/* Filters lseg frames of x with the frame kernel of mc, one frame after
+   the other; returns the number of output frames */
+static long cascade_mc_frames (CASCADE_IIR_MC * mc, long lseg, float *x, float *y) {
+  long k, r, c, ky = 0, nchan = mc->nchan;
+  long iup = mc->hswitch == 'U' ? mc->idown : 1;
+  float *xin = mc->xin, *out = mc->out;
+
+  for (k = 0; k < lseg; k++, x += nchan) {
+    for (r = 0; r < iup; r++) {
+      /* The input frame; zeros between the samples when up-sampling */
+      if (r == 0)
+        for (c = 0; c < nchan; c++)
+          xin[c] = x[c];
+      else if (r == 1)
+        for (c = 0; c < nchan; c++)
+          xin[c] = 0;
+
+      /* When down-sampling, only every idown-th frame is output */
+      if (mc->k0 == 0) {
+        mc->frame (mc, xin, out);
+        for (c = 0; c < nchan; c++)
+          y[c] = out[c];
+        y += nchan;
+        ky++;
+      } else
+        mc->frame (mc, xin, (float *) 0);
+      if (iup == 1 && ++mc->k0 == mc->idown)
+        mc->k0 = 0;
+    }
+  }
+  return ky;
+}
+
+#ifdef IIR_HAVE_AVX
+/* The AVX kernels take one group of lanes at a time through the whole
+   segment; returns the number of output frames */
+
+/* Exact engine, 4 lanes per AVX register (no FMA) */
+__attribute__ ((target ("avx")))
+static long cascade_mc_exact_avx (CASCADE_IIR_MC * mc, long lseg, float *x, float *y) {
+  long c, w, i, k, r, n, ky = 0, k0 = mc->k0, nchan = mc->nchan, nlane = mc->nlane;
+  long iup = mc->hswitch == 'U' ? mc->idown : 1, idown = iup == 1 ? mc->idown : 1;
+  float (*a)[2] = mc->a, (*b)[2] = mc->b;
+  float *T, tmp[4];
+  __m256d xj, yj, gain = _mm256_set1_pd (mc->gain);
+  __m128 xin, t0, t1, t2, t3, den, zero = _mm_setzero_ps ();
+
+  for (c = 0; c < nchan; c += 4) {
+    w = nchan - c < 4 ? nchan - c : 4;  /* channels in this group */
+    k0 = mc->k0;
+    ky = 0;
+    for (k = 0; k < lseg; k++) {
+      if (w == 4)
+        xin = _mm_loadu_ps (x + k * nchan + c);
+      else {
+        for (i = 0; i < 4; i++)
+          tmp[i] = i < w ? x[k * nchan + c + i] : 0;
+        xin = _mm_loadu_ps (tmp);
+      }
+      for (r = 0; r < iup; r++) {
+        xj = _mm256_cvtps_pd (r == 0 ? xin : zero);
+        for (n = 0; n < mc->nblocks; n++) {
+          T = mc->T + 4 * n * nlane + c;
+          t0 = _mm_loadu_ps (T);
+          t1 = _mm_loadu_ps (T + nlane);
+          t2 = _mm_loadu_ps (T + 2 * nlane);
+          t3 = _mm_loadu_ps (T + 3 * nlane);
+
+          /* xj + a0*T0 + a1*T1 - (b0*T2 + b1*T3), products in float */
+          yj = _mm256_add_pd (xj, _mm256_cvtps_pd (_mm_mul_ps (_mm_set1_ps (a[n][0]), t0)));
+          yj = _mm256_add_pd (yj, _mm256_cvtps_pd (_mm_mul_ps (_mm_set1_ps (a[n][1]), t1)));
+          den = _mm_add_ps (_mm_mul_ps (_mm_set1_ps (b[n][0]), t2), _mm_mul_ps (_mm_set1_ps (b[n][1]), t3));
+          yj = _mm256_sub_pd (yj, _mm256_cvtps_pd (den));
+
+          _mm_storeu_ps (T + nlane, t0);
+          _mm_storeu_ps (T, _mm256_cvtpd_ps (xj));
+          _mm_storeu_ps (T + 3 * nlane, t2);
+          _mm_storeu_ps (T + 2 * nlane, _mm256_cvtpd_ps (yj));
+          xj = yj;
+        }
+
+        /* Only the output frames are scaled and stored */
+        if (k0 == 0) {
+          if (w == 4)
+            _mm_storeu_ps (y + ky * nchan + c, _mm256_cvtpd_ps (_mm256_mul_pd (xj, gain)));
+          else {
+            _mm_storeu_ps (tmp, _mm256_cvtpd_ps (_mm256_mul_pd (xj, gain)));
+            for (i = 0; i < w; i++)
+              y[ky * nchan + c + i] = tmp[i];
+          }
+          ky++;
+        }
+        if (++k0 == idown)
+          k0 = 0;
+      }
+    }
+  }
+  mc->k0 = k0;
+  return ky;
+}
+
+/* Fast engine, 8 lanes per AVX register */
+__attribute__ ((target ("avx")))
+static long cascade_mc_fast_avx (CASCADE_IIR_MC * mc, long lseg, float *x, float *y) {
+  long c, w, i, k, r, n, ky = 0, k0 = mc->k0, nchan = mc->nchan, nlane = mc->nlane;
+  long iup = mc->hswitch == 'U' ? mc->idown : 1, idown = iup == 1 ? mc->idown : 1;
+  float (*a)[2] = mc->a, (*b)[2] = mc->b;
+  float *T, tmp[8];
+  __m256 xin, xj, yj, t0, t1, t2, t3, gain = _mm256_set1_ps ((float) mc->gain);
+  __m256 zero = _mm256_setzero_ps ();
+
+  for (c = 0; c < nchan; c += 8) {
+    w = nchan - c < 8 ? nchan - c : 8;  /* channels in this group */
+    k0 = mc->k0;
+    ky = 0;
+    for (k = 0; k < lseg; k++) {
+      if (w == 8)
+        xin = _mm256_loadu_ps (x + k * nchan + c);
+      else {
+        for (i = 0; i < 8; i++)
+          tmp[i] = i < w ? x[k * nchan + c + i] : 0;
+        xin = _mm256_loadu_ps (tmp);
+      }
+      for (r = 0; r < iup; r++) {
+        xj = r == 0 ? xin : zero;
+        for (n = 0; n < mc->nblocks; n++) {
+          T = mc->T + 4 * n * nlane + c;
+          t0 = _mm256_loadu_ps (T);
+          t1 = _mm256_loadu_ps (T + nlane);
+          t2 = _mm256_loadu_ps (T + 2 * nlane);
+          t3 = _mm256_loadu_ps (T + 3 * nlane);
+          yj = _mm256_add_ps (xj, _mm256_mul_ps (_mm256_set1_ps (a[n][0]), t0));
+          yj = _mm256_add_ps (yj, _mm256_mul_ps (_mm256_set1_ps (a[n][1]), t1));
+          yj = _mm256_sub_ps (yj, _mm256_add_ps (_mm256_mul_ps (_mm256_set1_ps (b[n][0]), t2), _mm256_mul_ps (_mm256_set1_ps (b[n][1]), t3)));
+          _mm256_storeu_ps (T + nlane, t0);
+          _mm256_storeu_ps (T, xj);
+          _mm256_storeu_ps (T + 3 * nlane, t2);
+          _mm256_storeu_ps (T + 2 * nlane, yj);
+          xj = yj;
+        }
+        if (k0 == 0) {
+          if (w == 8)
+            _mm256_storeu_ps (y + ky * nchan + c, _mm256_mul_ps (xj, gain));
+          else {
+            _mm256_storeu_ps (tmp, _mm256_mul_ps (xj, gain));
+            for (i = 0; i < w; i++)
+              y[ky * nchan + c + i] = tmp[i];
+          }
+          ky++;
+        }
+        if (++k0 == idown)
+          k0 = 0;
+      }
+    }
+  }
+  mc->k0 = k0;
+  return ky;
+}
+#endif
+
+
+/*
+  ============================================================================
+
+  CASCADE_IIR_MC *cascade_iir_mc_init (CASCADE_IIR *iir_ptr, long nchan,
+  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  int engine);
+
+  Description:
+  ~~~~~~~~~~~~
+  Allocate & initialize a multi-channel filter with the cascade,
+  sampling factor and gain of iir_ptr (as returned by one of the
+  initialization routines; its state variables are not used, and it may be
+  released afterwards), for nchan interleaved channels.
+
+  Parameters:
+  ~~~~~~~~~~~
+  CASCADE_IIR *iir_ptr: ... the cascade filter
+  long nchan: ............. number of channels
+  int engine: ............. CASCADE_ENGINE_EXACT or CASCADE_ENGINE_FAST
+
+  Return value:
+  ~~~~~~~~~~~~~
+  Returns a pointer to struct CASCADE_IIR_MC, or 0 on failure.
+
+  History:
+  ~~~~~~~~
+  17.Oct.26 v1.0 Created.
+
+ ============================================================================
+*/
+CASCADE_IIR_MC *cascade_iir_mc_init (CASCADE_IIR * iir_ptr, long nchan, int engine) {
+  CASCADE_IIR_MC *mc;
+
+  if (nchan < 1 || (engine != CASCADE_ENGINE_EXACT && engine != CASCADE_ENGINE_FAST))
+    return 0;
+  if ((mc = (CASCADE_IIR_MC *) calloc (1, sizeof (CASCADE_IIR_MC))) == 0)
+    return 0;
+
+  mc->nchan = nchan;
+  mc->nlane = (nchan + 7) & ~7L;
+  mc->nblocks = iir_ptr->nblocks;
+  mc->idown = iir_ptr->idown;
+  mc->gain = iir_ptr->gain;
+  mc->a = iir_ptr->a;
+  mc->b = iir_ptr->b;
+  mc->hswitch = iir_ptr->hswitch == 'U' ? 'U' : 'D';
+  mc->engine = engine;
+
+  mc->T = (float *) calloc (4 * mc->nblocks * mc->nlane, sizeof (float));
+  mc->xin = (float *) calloc (mc->nlane, sizeof (float));
+  mc->out = (float *) calloc (mc->nlane, sizeof (float));
+  mc->acc = (double *) calloc (mc->nlane, sizeof (double));
+  if (mc->T == 0 || mc->xin == 0 || mc->out == 0 || mc->acc == 0) {
+    cascade_iir_mc_free (mc);
+    return 0;
+  }
+
+  /* Kernels */
+  mc->run = cascade_mc_frames;
+  if (engine == CASCADE_ENGINE_EXACT) {
+    mc->frame = cascade_mc_exact_c;
+    mc->kernel = "exact/c";
+  } else {
+    mc->frame = cascade_mc_fast_c;
+    mc->kernel = "fast/c";
+  }
+#ifdef IIR_HAVE_AVX
+  if (__builtin_cpu_supports ("avx")) {
+    if (engine == CASCADE_ENGINE_EXACT) {
+      mc->run = cascade_mc_exact_avx;
+      mc->kernel = "exact/avx";
+    } else {
+      mc->run = cascade_mc_fast_avx;
+      mc->kernel = "fast/avx";
+    }
+  }
+#endif
+
+  mc->k0 = 0;                   /* the first frame is an output frame */
+  return mc;
+}
+
+/* ..................... End of cascade_iir_mc_init() ..................... */
+
+
+/*
+  ============================================================================
+
+  long cascade_iir_mc_kernel (long lseg, float *x_ptr,
+  ~~~~~~~~~~~~~~~~~~~~~~~~~~  CASCADE_IIR_MC *mc_ptr, float *y_ptr);
+
+  Description:
+  ~~~~~~~~~~~~
+  Multi-channel cascade-form IIR filtering routine, for both up- and
+  down-sampling: filters lseg frames of nchan interleaved samples.
+
+  Parameters:
+  ~~~~~~~~~~~
+  lseg: ...... number of input frames
+  x_ptr: ..... input samples, lseg*nchan (interleaved)
+  mc_ptr: .... pointer to struct CASCADE_IIR_MC
+  y_ptr: ..... output samples (interleaved)
+
+  Return value:
+  ~~~~~~~~~~~~~
+  Returns the number of output frames.
+
+  History:
+  ~~~~~~~~
+  17.Oct.26 v1.0 Created.
+
+ ============================================================================
+*/
+long cascade_iir_mc_kernel (long lseg, float *x_ptr, CASCADE_IIR_MC * mc_ptr, float *y_ptr) {
+  return mc_ptr->run (mc_ptr, lseg, x_ptr, y_ptr);
+}
+
+/* .................... End of cascade_iir_mc_kernel() .................... */
+
+
+/*
+  ============================================================================
+
+  void cascade_iir_mc_reset (CASCADE_IIR_MC *mc_ptr);
+  ~~~~~~~~~~~~~~~~~~~~~~~~~
+
+  Description:
+  ~~~~~~~~~~~~
+  Clear the state variables of all the channels of a multi-channel filter.
+
+  History:
+  ~~~~~~~~
+  17.Oct.26 v1.0 Created.
+
+ ============================================================================
+*/
+void cascade_iir_mc_reset (CASCADE_IIR_MC * mc_ptr) {
+  long n;
+
+  for (n = 0; n < 4 * mc_ptr->nblocks * mc_ptr->nlane; n++)
+    mc_ptr->T[n] = 0.0;
+  mc_ptr->k0 = 0;
+}
+
+/* .................... End of cascade_iir_mc_reset() ..................... */
+
+
+/*
+  ============================================================================
+
+  void cascade_iir_mc_free (CASCADE_IIR_MC *mc_ptr);
+  ~~~~~~~~~~~~~~~~~~~~~~~~
+
+  Description:
+  ~~~~~~~~~~~~
+  Deallocate a multi-channel filter allocated by cascade_iir_mc_init().
+  The coefficients belong to the cascade filter, and are not released.
+
+  History:
+  ~~~~~~~~
+  17.Oct.26 v1.0 Created.
+
+ ============================================================================
+*/
+void cascade_iir_mc_free (CASCADE_IIR_MC * mc_ptr) {
+  free (mc_ptr->T);
+  free (mc_ptr->xin);
+  free (mc_ptr->out);
+  free (mc_ptr->acc);
+  free (mc_ptr);
+}
+
+/* ..................... End of cascade_iir_mc_free() ..................... */
+
+
 /* *********************************************************************** */
 
 /*
@@ -0,0 +1,247 @@
+/*                                                         17/Oct/2026 v1.0 */
+/*=============================================================================
+
+                          U    U   GGG    SSSS  TTTTT
+                          U    U  G       S       T
+                          U    U  G  GG   SSSS    T
+                          U    U  G   G       S   T
+                           UUU     GG     SSS     T
+
+                   ========================================
+                    ITU-T - USER'S GROUP ON SOFTWARE TOOLS
+                   ========================================
+
+       =============================================================
+       COPYRIGHT NOTE: This source code, and all of its derivations,
+       is subject to the "ITU-T General Public License". Please have
+       it  read  in    the  distribution  disk,   or  in  the  ITU-T
+       Recommendation G.191 on "SOFTWARE TOOLS FOR SPEECH AND  AUDIO
+       CODING STANDARDS".
+       =============================================================
+
+  DESCRIPTION :
+	Benchmark of the multi-channel cascade-form IIR filters: a pseudo-random
+	signal of nchan interleaved channels is filtered by each of the cascade
+	filters (G.712, IRS, 3:1 and 1:3 low-pass), one channel at a time by
+	cascade_iir_kernel() and all channels at once by cascade_iir_mc_kernel()
+	with the exact and the fast engines. The CPU time of each is reported,
+	with the largest difference to the one-channel filter (in LSB of 16 bit
+	samples).
+
+	The signal is passed to the kernels in chunks of varying length, to
+	exercise the handling of the down-sampling phase.
+
+  USAGE :
+	iirbench [-sec s] [-check] [nchan ...]
+
+	-sec s ...... seconds of signal (at 8 kHz) [default: 10]
+	-check ...... short signal; exit with an error if the exact engine is
+	              not bit-identical to the one-channel filter, or if the
+	              fast engine differs by more than 1 LSB
+	nchan ....... numbers of channels to test [default: 1 2 8]
+
+  HISTORY :
+	17.Oct.26 v1.0	Created
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+/* UGST modules */
+#include "ugstdemo.h"
+
+#include "iirflt.h"
+
+/* chunk lengths cycled through when calling the kernels */
+static long chunk[] = { 256, 1, 133, 2, 1024, 17 };
+
+#define N_CHUNK (sizeof (chunk) / sizeof (chunk[0]))
+
+/* the cascade filters */
+static struct {
+  char *name;
+  CASCADE_IIR *(*init) ARGS ((void));
+} filt[] = {
+  { "G.712 8 kHz", iir_G712_8khz_init },
+  { "IRS 8 kHz", iir_irs_8khz_init },
+  { "low-pass 3:1", iir_casc_lp_3_to_1_init },
+  { "low-pass 1:3", iir_casc_lp_1_to_3_init }
+};
+
+#define N_FILT (sizeof (filt) / sizeof (filt[0]))
+
+
+static void display_usage () {
+  printf ("IIRBENCH.C - Version 1.0 of 17.Oct.2026 \n\n");
+  printf (" Benchmark of the multi-channel cascade-form IIR filters\n\n");
+  printf (" Usage:\n");
+  printf (" $ iirbench [-sec s] [-check] [nchan ...]\n");
+  printf (" Options:\n");
+  printf ("  -sec s ....... seconds of signal (at 8 kHz) [default: 10]\n");
+  printf ("  -check ....... check mode: fail if the exact engine is not\n");
+  printf ("                 bit-identical, or the fast one differs by more\n");
+  printf ("                 than 1 LSB\n");
+  printf ("\n");
+}
+
+
+/* filters the nchan interleaved channels of x, one by one; returns the
+   number of output frames */
+static long run_mono (CASCADE_IIR * iir, float *x, long len, long nchan, float *y, float *xc, float *yc) {
+  long ch, i, k, c, count, n, ny = 0;
+
+  for (ch = 0; ch < nchan; ch++) {
+    for (i = 0; i < len; i++)
+      xc[i] = x[i * nchan + ch];
+    cascade_iir_reset (iir);
+    for (i = 0, c = 0, ny = 0; i < len; i += count, c++) {
+      count = len - i < chunk[c % N_CHUNK] ? len - i : chunk[c % N_CHUNK];
+      n = cascade_iir_kernel (count, xc + i, iir, yc + ny);
+      ny += n;
+    }
+    for (k = 0; k < ny; k++)
+      y[k * nchan + ch] = yc[k];
+  }
+  return ny;
+}
+
+
+/* filters the nchan interleaved channels of x at once */
+static long run_multi (CASCADE_IIR_MC * mc, float *x, long len, float *y) {
+  long i, c, count, ny = 0;
+
+  for (i = 0, c = 0; i < len; i += count, c++) {
+    count = len - i < chunk[c % N_CHUNK] ? len - i : chunk[c % N_CHUNK];
+    ny += cascade_iir_mc_kernel (count, x + i * mc->nchan, mc, y + ny * mc->nchan);
+  }
+  return ny;
+}
+
+
+/* largest difference, in LSB of 16-bit samples; -1 if the lengths differ */
+static double max_diff (float *y1, long n1, float *y2, long n2) {
+  double d, dmax = 0;
+  long i;
+
+  if (n1 != n2)
+    return -1;
+  for (i = 0; i < n1; i++)
+    if ((d = fabs ((double) y1[i] - y2[i]) * 32768.0) > dmax)
+      dmax = d;
+  return dmax;
+}
+
+
+int main (int argc, char *argv[]) {
+  static long dflt_nchan[] = { 1, 2, 8 };
+  CASCADE_IIR *iir;
+  CASCADE_IIR_MC *exact, *fast;
+  float *x, *ymono, *yexact, *yfast, *xc, *yc;
+  double sec = 10.0, cpuMono, cpuExact, cpuFast, dExact, dFast;
+  long *nchan = dflt_nchan, nn = 3, len, i, f, t, nmono, nexact, nfast, lcg = 4711, fail = 0;
+  int check = 0;
+  clock_t t0;
+
+  /* Check options */
+  while (argc > 1 && argv[1][0] == '-')
+    if (strcmp (argv[1], "-sec") == 0) {
+      sec = atof (argv[2]);
+      argc -= 2;
+      argv += 2;
+    } else if (strcmp (argv[1], "-check") == 0) {
+      check = 1;
+      argc--;
+      argv++;
+    } else {
+      display_usage ();
+      exit (argv[1][1] == 'h' || argv[1][1] == '?' ? 2 : -1);
+    }
+  if (argc > 1) {
+    nn = argc - 1;
+    nchan = (long *) malloc (nn * sizeof (long));
+    for (i = 0; i < nn; i++)
+      if ((nchan[i] = atol (argv[i + 1])) < 1) {
+        display_usage ();
+        exit (-1);
+      }
+  }
+  if (check)
+    sec = 0.5;
+  len = (long) (sec * 8000);
+
+  printf ("%-14s %5s %-10s %10s %10s %10s %8s %10s %10s\n", "filter", "nchan", "kernel", "mono[s]", "exact[s]", "fast[s]", "speedup", "exact-diff", "fast-diff");
+  for (t = 0; t < nn; t++) {
+    /* pseudo-random test signal; output space for up-sampling by 3 */
+    x = (float *) malloc (len * nchan[t] * sizeof (float));
+    ymono = (float *) malloc (3 * len * nchan[t] * sizeof (float));
+    yexact = (float *) malloc (3 * len * nchan[t] * sizeof (float));
+    yfast = (float *) malloc (3 * len * nchan[t] * sizeof (float));
+    xc = (float *) malloc (len * sizeof (float));
+    yc = (float *) malloc (3 * len * sizeof (float));
+    if (x == NULL || ymono == NULL || yexact == NULL || yfast == NULL || xc == NULL || yc == NULL) {
+      fprintf (stderr, "\nUnable to allocate enough memory\n");
+      exit (-1);
+    }
+    for (i = 0; i < len * nchan[t]; i++) {
+      lcg = (lcg * 1103515245 + 12345) & 0x7FFFFFFF;
+      x[i] = (float) (((lcg >> 16) - 16384) / 65536.0);
+    }
+
+    for (f = 0; f < (long) N_FILT; f++) {
+      if ((iir = filt[f].init ()) == NULL)
+        HARAKIRI ("Unable to initialize the filter\n", 1);
+      if ((exact = cascade_iir_mc_init (iir, nchan[t], CASCADE_ENGINE_EXACT)) == NULL || (fast = cascade_iir_mc_init (iir, nchan[t], CASCADE_ENGINE_FAST)) == NULL)
+        HARAKIRI ("Unable to initialize the multi-channel filter\n", 1);
+
+      t0 = clock ();
+      nmono = run_mono (iir, x, len, nchan[t], ymono, xc, yc);
+      cpuMono = (double) (clock () - t0) / CLOCKS_PER_SEC;
+
+      t0 = clock ();
+      nexact = run_multi (exact, x, len, yexact);
+      cpuExact = (double) (clock () - t0) / CLOCKS_PER_SEC;
+
+      t0 = clock ();
+      nfast = run_multi (fast, x, len, yfast);
+      cpuFast = (double) (clock () - t0) / CLOCKS_PER_SEC;
+
+      /* the exact engine must give the same floats */
+      dExact = max_diff (ymono, nmono * nchan[t], yexact, nexact * nchan[t]);
+      if (dExact == 0 && memcmp (ymono, yexact, nmono * nchan[t] * sizeof (float)) != 0)
+        dExact = -1;
+      dFast = max_diff (ymono, nmono * nchan[t], yfast, nfast * nchan[t]);
+      if (dExact != 0 || dFast < 0 || dFast > 1)
+        fail++;
+
+      printf ("%-14s %5ld %-10s %10.3f %10.3f %10.3f %7.1fx %10.4f %10.4f\n", filt[f].name, nchan[t], exact->kernel, cpuMono, cpuExact, cpuFast, (cpuMono + 1e-9) / (cpuExact + 1e-9), dExact, dFast);
+
+      /* reset gives the same output again */
+      if (check) {
+        cascade_iir_mc_reset (exact);
+        nexact = run_multi (exact, x, len, yexact);
+        if (nexact != nmono || memcmp (ymono, yexact, nmono * nchan[t] * sizeof (float)) != 0) {
+          fprintf (stderr, "%s, %ld channels: different output after reset\n", filt[f].name, nchan[t]);
+          fail++;
+        }
+      }
+
+      cascade_iir_mc_free (exact);
+      cascade_iir_mc_free (fast);
+      cascade_iir_free (iir);
+    }
+    free (x);
+    free (ymono);
+    free (yexact);
+    free (yfast);
+    free (xc);
+    free (yc);
+  }
+  if (check && fail) {
+    fprintf (stderr, "\n%ld filter(s) with differences\n", fail);
+    return 1;
+  }
+  return 0;
+}
@@ -1,6 +1,6 @@
 /*
   ============================================================================
-   File: IIRFLT.H                                     Version: 3.0 - 31.JUL.95
+   File: IIRFLT.H                                     Version: 3.1 - 17.OCT.26
   ============================================================================
 
                             UGST/ITU-T IIR FILTERS
@@ -12,6 +12,7 @@
    30.Oct.94	v2.0	Name changed to iirflt.h/included cascade-form 
                         IIR filters <simao@ctd.comsat.com>
    31.Jul.95	v3.0	Added direct-form IIR filters <simao@ctd.comsat.com>
+   17.Oct.26	v3.1	Added multi-channel cascade-form IIR filters
 
   ============================================================================
 */
@@ -78,6 +79,39 @@ typedef struct {
 } DIRECT_IIR;
 
 
+/*
+ * ..... State variable structure for multi-channel IIR filtering, cascade
+ *       form: interleaved channels (or independent signals) run through the
+ *       same cascade, one per SIMD lane .....
+ */
+
+/* Engines of the multi-channel cascade */
+#define CASCADE_ENGINE_EXACT 0  /* double accumulation; bit-identical to
+                                   cascade_iir_kernel() for each channel */
+#define CASCADE_ENGINE_FAST  1  /* single precision accumulation */
+
+typedef struct CASCADE_IIR_MC {
+  long nchan;                   /* number of interleaved channels */
+  long nlane;                   /* nchan rounded up to a multiple of 8 */
+  long nblocks;                 /* number of stages in cascade */
+  long idown;                   /* down/up sampling factor */
+  long k0;                      /* frames to the next output (down-sampling) */
+  double gain;                  /* gain factor */
+  float (*a)[2];                /* In : numerator coefficients */
+  float (*b)[2];                /* In : denominator coefficients */
+  float *T;                     /* In/Out : state variables, [nblocks][4][nlane] */
+  float *xin, *out;             /* one frame of input/output, nlane lanes */
+  double *acc;                  /* nlane accumulators */
+  int engine;                   /* CASCADE_ENGINE_xxx */
+  char *kernel;                 /* name of the kernel in use */
+  /* filters lseg frames, returns the number of output frames */
+  long (*run) ARGS ((struct CASCADE_IIR_MC * mc, long lseg, float *x, float *y));
+  /* one frame through all the stages (plain C kernels); out may be NULL */
+  void (*frame) ARGS ((struct CASCADE_IIR_MC * mc, float *xin, float *out));
+  char hswitch;                 /* "U": upsampling; else downsampling */
+} CASCADE_IIR_MC;
+
+
 /*
  * ..... Global function prototypes .....
  */
@@ -98,6 +132,12 @@ long cascade_iir_kernel ARGS ((long lseg, float *x_ptr, CASCADE_IIR * iir_ptr, f
 void cascade_iir_reset ARGS ((CASCADE_IIR * iir_ptr));
 void cascade_iir_free ARGS ((CASCADE_IIR * iir_ptr));
 
+/* Multi-channel cascade IIR basic functions */
+CASCADE_IIR_MC *cascade_iir_mc_init ARGS ((CASCADE_IIR * iir_ptr, long nchan, int engine));
+long cascade_iir_mc_kernel ARGS ((long lseg, float *x_ptr, CASCADE_IIR_MC * mc_ptr, float *y_ptr));
+void cascade_iir_mc_reset ARGS ((CASCADE_IIR_MC * mc_ptr));
+void cascade_iir_mc_free ARGS ((CASCADE_IIR_MC * mc_ptr));
+
 /* Additions to the STL92: cascade IIR filter initialization */
 CASCADE_IIR *iir_G712_8khz_init ARGS ((void));
 CASCADE_IIR *iir_irs_8khz_init ARGS ((void));
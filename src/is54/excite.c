@@ -28,8 +28,8 @@ Motorola Inc.
 /*	Written by: Matt Hartman*/
 /*-------------------------------------------------------------*/
 /*	inclusions*/
-#include "vparams.h"
-FTYPE EXCITE (int gsp0, int lag, FTYPE rs00, FTYPE rs11, FTYPE rs22, FTYPE * pVecPtr, FTYPE * x1VecPtr, FTYPE * x2VecPtr, FTYPE * oPtr) {
+#include "t_sub.h"
+FTYPE EXCITE (VSELP_STATE * st, int gsp0, int lag, FTYPE rs00, FTYPE rs11, FTYPE rs22, FTYPE * pVecPtr, FTYPE * x1VecPtr, FTYPE * x2VecPtr, FTYPE * oPtr) {
   FTYPE *gsp0Ptr;               /* points into the GSP0 quantization table to */
   /* retrieve values needed to determine gains */
   FTYPE beta;                   /* the pitch excitation gain */
@@ -43,7 +43,7 @@ FTYPE EXCITE (int gsp0, int lag, FTYPE rs00, FTYPE rs11, FTYPE rs22, FTYPE * pVe
 
 /*	Note: factor of 0.5 applied to gains offsets the factor of 2 in*/
 /*		the table entries*/
-  gsp0Ptr = GSP0_TABLE + GSP0_TERMS * gsp0;
+  gsp0Ptr = st->GSP0_TABLE + GSP0_TERMS * gsp0;
   if (lag)
     beta = 0.5 * rs00 * *gsp0Ptr;
   else
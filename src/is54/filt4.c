@@ -28,12 +28,13 @@ Motorola Inc.
 
 /*
  -------------------------------------------------------------
- void FILT4(FTYPE *inPtr, int len);
+ void FILT4(VSELP_STATE *st, FTYPE *inPtr, int len);
 
  Description:
  High-pass filter routine.
 
  Parameters:
+ st ...... State of the encoder, with the filter states.
  inPtr ... Pointer to sample buffer to be filtered.
  len ..... Number of samples to filter.
 
@@ -42,19 +43,19 @@ Motorola Inc.
 
  History:
  ??.???.?? v.10 Created by Matt Hartman
+ 17.Oct.26 v.11 Filter states kept in the encoder state.
  -------------------------------------------------------------
 */
-void FILT4 (FTYPE * inPtr, int len) {
+void FILT4 (VSELP_STATE * st, FTYPE * inPtr, int len) {
   /* coefs of HPF */
-  static double b[5] = { 0.898025036, -3.59010601, 5.38416243,
+  static const double b[5] = { 0.898025036, -3.59010601, 5.38416243,
     -3.59010601, 0.898024917
   };                            /* numerator */
-  static double a[5] = { 1.0, -3.78284979, 5.37379122, -3.39733505,
+  static const double a[5] = { 1.0, -3.78284979, 5.37379122, -3.39733505,
     0.806448996
   };                            /* denominator */
-
-  static double x[4] = { 0.0, 0.0, 0.0, 0.0 };  /* numerator state */
-  static double y[4] = { 0.0, 0.0, 0.0, 0.0 };  /* denominator state */
+  double *x = st->hpX;          /* numerator state */
+  double *y = st->hpY;          /* denominator state */
 
   double *endPtr, *iPtr, *oPtr, *tp1, *tp2;
   int i, j;
@@ -34,16 +34,16 @@ Motorola Inc.
 /*-------------------------------------------------------------*/
 /*	inclusions*/
 
-#include "vparams.h"
+#include "vselp.h"
 #include <assert.h>
 #include <stdio.h>
 /*#include "stdlib.h"*/
 #include <math.h>
 /*------------------------------------------------------------------------*/
 /*	FLATV -- calculates Rq0 and k's.*/
-static FTYPE QUANT (FTYPE val, int i);
+static FTYPE QUANT (VSELP_STATE * st, FTYPE val, int i);
 
-void FLATV () {
+void FLATV (VSELP_STATE * st) {
   FTYPE *sd;                    /* points to pre-emphasized input */
   /* speech buffer */
   FTYPE ac[NP + 1][NP + 1];     /* autocorrelation matrix */
@@ -75,7 +75,7 @@ void FLATV () {
 
 /*	first pre-emphasize one analysis length of speech, and put into*/
 /*	double-precision buffer*/
-  s = inBuf + INBUFSIZ - A_LEN;
+  s = st->inBuf + INBUFSIZ - A_LEN;
   tp = s - 1;
   freePtr = (FTYPE *) malloc (A_LEN * sizeof (FTYPE));
   sd = freePtr;
@@ -96,7 +96,7 @@ void FLATV () {
 /*	calculate and quantize sqrt(S_LEN * avg R0), assign to external*/
 /*	variable.*/
   avgR0 = sqrt ((S_LEN * (ac[0][0] + ac[NP][NP])) / (2.0 * (A_LEN - NP)));
-  T_NEW.rq0 = QUANT (avgR0, 0);
+  st->T_NEW.rq0 = QUANT (st, avgR0, 0);
 
 /*	initialize F, B, and C matricies from the ac matrix*/
 
@@ -109,7 +109,7 @@ void FLATV () {
   for (i = 0; i <= NP; i++) {
     for (j = 0; j <= NP - i; j++) {
       k = j + i;
-      temp = *(sst + i) * ac[j][k];
+      temp = *(st->sst + i) * ac[j][k];
       if (j < NP && k < NP)
         f[j][k] = temp;
       if (j > 0 && k > 0)
@@ -128,16 +128,16 @@ void FLATV () {
 /*	quantizes, and updates the f, b, and c matricies.  Matrix entries*/
 /*	f[i][k], b[i-1][k-1], c[i][k-1], and c[k][i-1], are updated*/
 /*	simultaneously using common terms.  The updates are done in place.*/
-  kPtr = T_NEW.k;
+  kPtr = st->T_NEW.k;
   for (j = 1; j <= NP; j++) {
     /* calculate denominator */
     temp = (f[0][0] + b[0][0] + f[NP - j][NP - j] + b[NP - j][NP - j]);
     if (temp == 0.0) {
       /* denominator is zero, set energy to lowest level and do nothing */
       /* with the rc's */
-      codes = codeBuf;
-      T_NEW.rq0 = QUANT (0.0, 0);
-      codes = codeBuf + NP + 1;
+      st->codes = st->codeBuf;
+      st->T_NEW.rq0 = QUANT (st, 0.0, 0);
+      st->codes = st->codeBuf + NP + 1;
       break;
     }
 
@@ -145,15 +145,15 @@ void FLATV () {
     temp2 = -2.0 * (c[0][0] + c[NP - j][NP - j]);
     if (fabs (temp2) >= temp) {
       /* reflection coef >= 1.0, fill all rc's with zero */
-      for (; codes < codeBuf + NP + 1; kPtr++)
-        *kPtr = QUANT (0.0, kPtr - T_NEW.k + 1);
-      fprintf (stderr, "WARNING FROM FLATV: k's unstable in frame %d\n", frCnt);
+      for (; st->codes < st->codeBuf + NP + 1; kPtr++)
+        *kPtr = QUANT (st, 0.0, kPtr - st->T_NEW.k + 1);
+      fprintf (stderr, "WARNING FROM FLATV: k's unstable in frame %d\n", st->frCnt);
       break;
     }
 
     /* calculate and quantize reflection coef */
     temp = temp2 / temp;
-    *kPtr = QUANT (temp, j);
+    *kPtr = QUANT (st, temp, j);
     if (j == NP)                /* exit here if done */
       break;
 
@@ -190,14 +190,14 @@ void FLATV () {
 
 /*	Note: if value to be quantized equals boundary value, this routine*/
 /*		rounds up*/
-static FTYPE QUANT (FTYPE val, int i) {
+static FTYPE QUANT (VSELP_STATE * st, FTYPE val, int i) {
   int offset;                   /* holds the address offset for the next binary search update */
 
   FTYPE *tmpPtr, *tmpPtr2, *begin;
 
-  tmpPtr = *(r0kAddr + i) - 1;
+  tmpPtr = *(st->r0kAddr + i) - 1;
   begin = tmpPtr;
-  offset = (*(r0kAddr + i + 1) - tmpPtr) / 2;
+  offset = (*(st->r0kAddr + i + 1) - tmpPtr) / 2;
   tmpPtr2 = tmpPtr + offset;
   offset /= 2;
 
@@ -207,19 +207,19 @@ static FTYPE QUANT (FTYPE val, int i) {
     tmpPtr2 = tmpPtr + offset;
     offset /= 2;
   }
-  *codes = ((tmpPtr2 - begin) / 2) & 0xff;
+  *st->codes = ((tmpPtr2 - begin) / 2) & 0xff;
 
-  codes++;
+  st->codes++;
   return *tmpPtr2;
 }                               /* end of quant */
 
 
 /*------------------------------------------------------------------------*/
 /*	lookup -- routine for decoding r0 and k's */
-FTYPE lookup (int i) {
+FTYPE lookup (VSELP_STATE * st, int i) {
   FTYPE rVal;
 
-  rVal = *(*(r0kAddr + i) + 2 * *codes);
-  codes++;
+  rVal = *(*(st->r0kAddr + i) + 2 * *st->codes);
+  st->codes++;
   return rVal;
 }                               /* end of lookup */
@@ -33,13 +33,12 @@ Motorola Inc.
 /*-------------------------------------------------------------*/
 /*	inclusions*/
 
-#include "vparams.h"
+#include "t_sub.h"
 /*#include "stdlib.h"*/
 /*	function declarations*/
-static FTYPE corr ();
-/*FTYPE *vec1Ptr, FTYPE *vec2Ptr*/
+static FTYPE corr (FTYPE * vec1Ptr, FTYPE * vec2Ptr);
 
-int G_QUANT (int lag, FTYPE rs00, FTYPE rs11, FTYPE rs22) {
+int G_QUANT (VSELP_STATE * st, int lag, FTYPE rs00, FTYPE rs11, FTYPE rs22) {
   FTYPE Rpc0;                   /* correlation between the weighted speech and the */
   /* weighted pitch excitation vector */
   FTYPE Rpc1;                   /* correlation between the weighted speech and the */
@@ -70,18 +69,18 @@ int G_QUANT (int lag, FTYPE rs00, FTYPE rs11, FTYPE rs22) {
 
 /* calculate correlations*/
   if (lag)
-    Rpc0 = corr (P, W_P_VEC);
-  Rpc1 = corr (P, W_X_VEC);
-  Rpc2 = corr (P, W_X_A_VEC);
+    Rpc0 = corr (st->P, st->W_P_VEC);
+  Rpc1 = corr (st->P, st->W_X_VEC);
+  Rpc2 = corr (st->P, st->W_X_A_VEC);
   if (lag) {
-    Rcc01 = corr (W_P_VEC, W_X_VEC);
-    Rcc02 = corr (W_P_VEC, W_X_A_VEC);
+    Rcc01 = corr (st->W_P_VEC, st->W_X_VEC);
+    Rcc02 = corr (st->W_P_VEC, st->W_X_A_VEC);
   }
-  Rcc12 = corr (W_X_VEC, W_X_A_VEC);
+  Rcc12 = corr (st->W_X_VEC, st->W_X_A_VEC);
   if (lag)
-    Rcc00 = corr (W_P_VEC, W_P_VEC);
-  Rcc11 = corr (W_X_VEC, W_X_VEC);
-  Rcc22 = corr (W_X_A_VEC, W_X_A_VEC);
+    Rcc00 = corr (st->W_P_VEC, st->W_P_VEC);
+  Rcc11 = corr (st->W_X_VEC, st->W_X_VEC);
+  Rcc22 = corr (st->W_X_A_VEC, st->W_X_A_VEC);
 
 /* compute error coefficients (factor of 2 for some coefs is figured*/
 /* into the table terms) */
@@ -103,7 +102,7 @@ int G_QUANT (int lag, FTYPE rs00, FTYPE rs11, FTYPE rs22) {
 
 /*	minimum error search loop */
   maxVal = -50.0;
-  tmpPtr = GSP0_TABLE;
+  tmpPtr = st->GSP0_TABLE;
   for (endPtr = tmpPtr + GSP0_TERMS * GSP0_NUM; tmpPtr < endPtr;) {
     /* combine error coefficients and table terms to get value to be */
     /* maximized */
@@ -124,7 +123,7 @@ int G_QUANT (int lag, FTYPE rs00, FTYPE rs11, FTYPE rs22) {
   }
 
 /*	get code for centroid from pointer and return*/
-  code = (savePtr - GSP0_TERMS - GSP0_TABLE) / GSP0_TERMS;
+  code = (savePtr - GSP0_TERMS - st->GSP0_TABLE) / GSP0_TERMS;
   free (errCoefs);
   return code;
 }                               /* end of G_QUANT */
@@ -32,13 +32,14 @@ Motorola Inc.
 /*---------------------------------------------------------------------------*/
 /*	Written by: Matt Hartman    */
 /*	Date: Sept 11, 1990.        */
+/*	17.Oct.2026: options and files returned in a VSELP_OPTIONS */
 /*----------------------------------*/
 /* Includes */
 #include <stdio.h>
-#include "vparams.h"
+#include "vselp.h"
 #include "ugstdemo.h"
 
-void getParams (FILE * fpget) {
+void getParams (FILE * fpget, VSELP_OPTIONS * opt) {
   int choice;
   char filename[128];
 #ifdef VMS
@@ -47,55 +48,55 @@ void getParams (FILE * fpget) {
 
   fprintf (stderr, "\nSystem options? [Encoder/decoder = 0, Decoder only = 1]: ");
   fscanf (fpget, "%d", &choice);
-  decode_only = choice;
+  opt->decode_only = choice;
 
-  if (!decode_only) {
+  if (!opt->decode_only) {
     fprintf (stderr, "\nPut out packed ASCII hex coded stream? [0=no 1=yes]: .. ");
     fscanf (fpget, "%d", &choice);
-    packedStream = choice;
+    opt->packedStream = choice;
 
     fprintf (stderr, "\nCalculate performance measures? [0=no 1=yes]: ......... ");
     fscanf (fpget, "%d", &choice);
-    performMeas = choice;
+    opt->performMeas = choice;
   }
 
   fprintf (stderr, "\nCreate log file? [0=no 1=yes]: ........................ ");
   fscanf (fpget, "%d", &choice);
-  makeLog = choice;
+  opt->makeLog = choice;
 
   fprintf (stderr, "\nApply post-filter to synthesis? [0=no 1=yes]: ......... ");
   fscanf (fpget, "%d", &choice);
-  apply_postfilter = choice;
+  opt->apply_postfilter = choice;
 
-  if (!decode_only) {
+  if (!opt->decode_only) {
     fprintf (stderr, "\nEnter input speech file: ");
     fscanf (fpget, "%s", filename);
-    if ((fpin = fopen (filename, RB)) == NULL)
+    if ((opt->fpin = fopen (filename, RB)) == NULL)
       HARAKIRI ("***ERROR Input File Specification\n", 2);
   }
 
   fprintf (stderr, "\nEnter output speech file: ");
   fscanf (fpget, "%s", filename);
-  if ((fpout = fopen (filename, WB)) == NULL)
+  if ((opt->fpout = fopen (filename, WB)) == NULL)
     HARAKIRI ("***ERROR Output File Specification\n", 1);
 
-  if (decode_only && fpcode == NULL) {
+  if (opt->decode_only && opt->fpcode == NULL) {
     fprintf (stderr, "\nEnter input bit-stream file: ");
     fscanf (fpget, "%s", filename);
-    if ((fpcode = fopen (filename, "r")) == NULL)
+    if ((opt->fpcode = fopen (filename, "r")) == NULL)
       HARAKIRI ("***ERROR Code File Specification\n", 1);
   }
 
-  if (makeLog || performMeas && fplog == NULL) {
+  if (opt->makeLog || opt->performMeas && opt->fplog == NULL) {
     fprintf (stderr, "\nEnter output filename for diagnostics: ");
     fscanf (fpget, "%s", filename);
-    fplog = fopen (filename, "w");
+    opt->fplog = fopen (filename, "w");
   }
 
-  if (packedStream && fpstream == NULL) {
+  if (opt->packedStream && opt->fpstream == NULL) {
     fprintf (stderr, "\nEnter packed, coded output filename: ");
     fscanf (fpget, "%s", filename);
-    fpstream = fopen (filename, "w");
+    opt->fpstream = fopen (filename, "w");
   }
   fprintf (stderr, "\n OK: all options read; Processing now ... \n");
 }
@@ -31,6 +31,8 @@ Motorola Inc.
 /*                    in run-time! UNIX/VMS allow big tables, but */
 /*                    DOS doesn't; so, treat accordingly! */
 /*-------------------------------------------------------------*/
+/*	17.Oct.2026: tables and buffers allocated per VSELP_STATE */
+/*-------------------------------------------------------------*/
 #if (defined(MSDOS) || defined(__MSDOS__)) && !defined(__GNUC__)
 /* ------------------------------------------------------
  *  You need to customize this, poor 16-bit DOS user ... 
@@ -56,7 +58,7 @@ Motorola Inc.
 #endif
 
 /* inclusions */
-#include "vparams.h"
+#include "vselp.h"
 
 /* #include "stdlib.h" */
 #include <math.h>
@@ -71,8 +73,9 @@ Motorola Inc.
 #define STEP	2.0             /* dB step between quant levels for R0 */
 
 /* initTables initializes lookup tables and allocates storage for some */
-/* arrays */
-void initTables () {
+/* arrays of the state st; the inline tables below fill the locals with */
+/* the names of the former externals, which are then stored in st */
+void initTables (VSELP_STATE * st) {
   FTYPE DB = -66.0;             /* db value of R0 quantization step */
   int numDecisionVals;          /* number of entries in R0 and rc quant tables */
   int nb;                       /* used to create table of sst coefs for FLATV() */
@@ -82,6 +85,11 @@ void initTables () {
   int grayMask;                 /* used to generate gray code table */
   int grayVal;                  /* used to generate gray code table */
   int bit;                      /* used to generate gray code table */
+  FTYPE **r0kAddr = st->r0kAddr;        /* quantization tables */
+  FTYPE *sst, *P_SST;           /* sst coefficients */
+  FTYPE *BASIS, *BASIS_A;       /* basis vectors */
+  FTYPE *GSP0_TABLE;            /* GSP0 quantization table */
+  int *TABLE;                   /* gray code table */
 
   FTYPE *tmpPtr, *endPtr, temp;
   int i, *intPtr, *iePtr;
@@ -92,12 +100,12 @@ void initTables () {
 
   /* allocate input speech buffer, interpolated coef buffer, and residual */
   /* energy estimate buffer */
-  inBuf = (FTYPE *) malloc (INBUFSIZ * sizeof (FTYPE));
-  I_CBUFF = (FTYPE *) malloc ((NP * 3 * N_SUB) * sizeof (FTYPE));
-  RS_BUFF = (FTYPE *) malloc ((2 * N_SUB) * sizeof (FTYPE));
+  st->inBuf = (FTYPE *) calloc (INBUFSIZ, sizeof (FTYPE));
+  st->I_CBUFF = (FTYPE *) calloc (NP * 3 * N_SUB, sizeof (FTYPE));
+  st->RS_BUFF = (FTYPE *) calloc (2 * N_SUB, sizeof (FTYPE));
 
   /* initialize codes to zero (in case 1st denominator in FLAT is zero) */
-  codeBuf = (int *) calloc (numCodes, sizeof (int));
+  st->codeBuf = (int *) calloc (numCodes, sizeof (int));
 
   /* FLATV() and QUANT() allocations */
   /* numDecisionVals is the amount of storage needed for the r0 and rc */
@@ -113,25 +121,25 @@ void initTables () {
   sst = (FTYPE *) malloc ((NP + 1) * sizeof (FTYPE));
 
   /* T_SUB() and R_SUB() allocations */
-  T_STATE = (FTYPE *) malloc (NP * sizeof (FTYPE));
-  T_VEC = (FTYPE *) malloc (S_LEN * sizeof (FTYPE));
-  P = (FTYPE *) malloc (S_LEN * sizeof (FTYPE));
-  P_VEC = (FTYPE *) malloc (S_LEN * sizeof (FTYPE));
-  W_P_VEC = (FTYPE *) malloc (S_LEN * sizeof (FTYPE));
+  st->T_STATE = (FTYPE *) calloc (NP, sizeof (FTYPE));
+  st->T_VEC = (FTYPE *) calloc (S_LEN, sizeof (FTYPE));
+  st->P = (FTYPE *) calloc (S_LEN, sizeof (FTYPE));
+  st->P_VEC = (FTYPE *) calloc (S_LEN, sizeof (FTYPE));
+  st->W_P_VEC = (FTYPE *) calloc (S_LEN, sizeof (FTYPE));
   BASIS = (FTYPE *) malloc (S_LEN * C_BITS * sizeof (FTYPE));
   BASIS_A = (FTYPE *) malloc (S_LEN * C_BITS_A * sizeof (FTYPE));
-  W_BASIS = (FTYPE *) malloc (S_LEN * C_BITS * sizeof (FTYPE));
-  BITS = (FTYPE *) malloc (C_BITS * sizeof (FTYPE));
-  X_VEC = (FTYPE *) malloc (S_LEN * sizeof (FTYPE));
-  W_X_VEC = (FTYPE *) malloc (S_LEN * sizeof (FTYPE));
-  X_A_VEC = (FTYPE *) malloc (S_LEN * sizeof (FTYPE));
-  W_X_A_VEC = (FTYPE *) malloc (S_LEN * sizeof (FTYPE));
-  T_P_STATE = (FTYPE *) calloc (LMAX, sizeof (FTYPE));
-  xmtExPtr = T_P_STATE + LMAX - S_LEN;
+  st->W_BASIS = (FTYPE *) calloc (S_LEN * C_BITS, sizeof (FTYPE));
+  st->BITS = (FTYPE *) calloc (C_BITS, sizeof (FTYPE));
+  st->X_VEC = (FTYPE *) calloc (S_LEN, sizeof (FTYPE));
+  st->W_X_VEC = (FTYPE *) calloc (S_LEN, sizeof (FTYPE));
+  st->X_A_VEC = (FTYPE *) calloc (S_LEN, sizeof (FTYPE));
+  st->W_X_A_VEC = (FTYPE *) calloc (S_LEN, sizeof (FTYPE));
+  st->T_P_STATE = (FTYPE *) calloc (LMAX, sizeof (FTYPE));
+  st->xmtExPtr = st->T_P_STATE + LMAX - S_LEN;
   TABLE = (int *) malloc (((1 << C_BITS) - 2) * sizeof (int));
   GSP0_TABLE = (FTYPE *) malloc (GSP0_TERMS * GSP0_NUM * sizeof (FTYPE));
-  R_P_STATE = (FTYPE *) calloc (LMAX, sizeof (FTYPE));
-  outBuf = (FTYPE *) malloc (S_LEN * sizeof (FTYPE));
+  st->R_P_STATE = (FTYPE *) calloc (LMAX, sizeof (FTYPE));
+  st->outBuf = (FTYPE *) calloc (S_LEN, sizeof (FTYPE));
 
   /* fill r0 quantization table */
   temp = sqrt ((double) S_LEN); /* sqrt (S_LEN * max amplitude squared) */
@@ -246,6 +254,13 @@ void initTables () {
   *++P_SST = 0.000102;
   P_SST -= NP;
 
+  st->sst = sst;
+  st->P_SST = P_SST;
+  st->BASIS = BASIS;
+  st->BASIS_A = BASIS_A;
+  st->GSP0_TABLE = GSP0_TABLE;
+  st->TABLE = TABLE;
+
   free (line);
 }
 
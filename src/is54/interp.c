@@ -30,26 +30,19 @@ Motorola Inc.
 /*	inclusions*/
 #include <assert.h>
 #include <math.h>
-#include "vparams.h"
-
-int ATORC ();                   /* from paramConv.c */
-                /* FTYPE *a, FTYPE *k */
-void I_MOV (struct coefSet defSet, int numSets, FTYPE rq0);
-
-FTYPE RES_ENG (FTYPE rq0, FTYPE * k);
-
-static FTYPE *aPtr;             /* points (in I_CBUFF) to the beginning of the interpolated direct-form coefs for the current subframe */
-static FTYPE *rsPtr;            /* points (in rsBuf) to the next spot to be filled by an rs value */
-
+#include "vselp.h"
 
+/* The interpolation pointers are kept in the state st: st->aPtr points */
+/* (in I_CBUFF) to the beginning of the interpolated direct-form coefs */
+/* for the current subframe, st->rsPtr (in RS_BUFF) to the next spot to */
+/* be filled by an rs value, and st->intCoefPtr (in I_CBUFF) to the next */
+/* spot for an interpolated coef */
 
 /*
  *      INTERPOLATE interpolates between coef sets based on the subframe
  *	index.
  */
-int INTERPOLATE (struct coefSet defCoefs, int numSets, struct coefSet oCoefs, int i, FTYPE rq0) {
-  static FTYPE *intCoefPtr;     /* points (in I_CBUFF) to the next spot for */
-  /* an interpolated coef */
+int INTERPOLATE (VSELP_STATE * st, struct coefSet defCoefs, int numSets, struct coefSet oCoefs, int i, FTYPE rq0) {
   FTYPE defPct;                 /* percentage that defCoefs contribute to */
   /* interpolated coefficients */
   FTYPE oPct;                   /* percentage that oCoefs contribute to interpolated */
@@ -73,16 +66,16 @@ int INTERPOLATE (struct coefSet defCoefs, int numSets, struct coefSet oCoefs, in
 
 /*	interpolate coef sets*/
   if (i == 0) {
-    intCoefPtr = I_CBUFF;
-    aPtr = I_CBUFF;
-    rsPtr = RS_BUFF;
+    st->intCoefPtr = st->I_CBUFF;
+    st->aPtr = st->I_CBUFF;
+    st->rsPtr = st->RS_BUFF;
   }
 
   defPtr = defCoefs.a;
   oPtr = oCoefs.a;
   for (endPtr = defPtr + numSets * NP; defPtr < endPtr; defPtr++) {
-    *intCoefPtr = *defPtr * defPct + *oPtr * oPct;
-    intCoefPtr++;
+    *st->intCoefPtr = *defPtr * defPct + *oPtr * oPct;
+    st->intCoefPtr++;
     oPtr++;
   }
 
@@ -90,13 +83,13 @@ int INTERPOLATE (struct coefSet defCoefs, int numSets, struct coefSet oCoefs, in
 /*	(i.e., the last or current set) and calculate residual estimate*/
 /*	based on that set.  If stable, calculate residual based on*/
 /*	interpolated set.*/
-  if ((unstableFlag = ATORC (aPtr, kPtr)) == 1)
-    I_MOV (defCoefs, numSets, rq0);
+  if ((unstableFlag = ATORC (st->aPtr, kPtr)) == 1)
+    I_MOV (st, defCoefs, numSets, rq0);
   else {
-    *rsPtr = RES_ENG (rq0, kPtr);
-    rsPtr += 2;
+    *st->rsPtr = RES_ENG (rq0, kPtr);
+    st->rsPtr += 2;
   }
-  aPtr += numSets * NP;
+  st->aPtr += numSets * NP;
   free (kPtr);
   return unstableFlag;
 }
@@ -104,15 +97,15 @@ int INTERPOLATE (struct coefSet defCoefs, int numSets, struct coefSet oCoefs, in
 
 /*	I_MOV moves a set of coefs into the I_CBUFF buffer and calculates*/
 /*	an RS value based on that set*/
-void I_MOV (struct coefSet defSet, int numSets, FTYPE rq0) {
+void I_MOV (VSELP_STATE * st, struct coefSet defSet, int numSets, FTYPE rq0) {
   FTYPE *tmpPtr, *tmpPtr2, *endPtr;
 
 /*	calculate residual estimate*/
-  *rsPtr = RES_ENG (rq0, defSet.k);
-  rsPtr += 2;
+  *st->rsPtr = RES_ENG (rq0, defSet.k);
+  st->rsPtr += 2;
 
 /*	move default coef set to interpolated set buffer.*/
-  tmpPtr = aPtr;
+  tmpPtr = st->aPtr;
   tmpPtr2 = defSet.a - 1;
   for (endPtr = tmpPtr + numSets * NP; tmpPtr < endPtr; tmpPtr++)
     *tmpPtr = *++tmpPtr2;
@@ -120,10 +113,7 @@ void I_MOV (struct coefSet defSet, int numSets, FTYPE rq0) {
 
 
 /*	RES_ENG calculates a residual energy estimate*/
-FTYPE RES_ENG (rq0, k)
-     FTYPE rq0;
-     FTYPE *k;
-{
+FTYPE RES_ENG (FTYPE rq0, FTYPE * k) {
   FTYPE *endPtr /* , tmp = 1.0 */ , ftmp;
   double tmp = 1.0;
 
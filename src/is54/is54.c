@@ -0,0 +1,384 @@
+/**************************************************************************
+
+                (C) Copyright 1990, Motorola Inc., U.S.A.
+
+Note:  Reproduction and use for the development of North American digital
+       cellular standards or development of digital speech coding
+       standards within the International Telecommunications Union -
+       Telecommunications Standardization Sector is authorized by Motorola
+       Inc.  No other use is intended or authorized.
+
+       The availability of this material does not provide any license
+       by implication, estoppel, or otherwise under any patent rights
+       of Motorola Inc. or others covering any use of the contents
+       herein.
+
+       Any copies or derivative works must incude this and all other
+       proprietary notices.
+
+       Permision has been granted to include this software in ITU-T
+       Software Tool Library, for the only purpose of helping the
+       development of new ITU standards.
+
+
+Systems Research Laboratories
+Chicago Corporate Research and Development Center
+Motorola Inc.
+
+************************************************************************* */
+
+/*
+  -------------------------------------------------------------------------
+  is54.c
+  ~~~~~~
+  Instance API of the IS54 VSELP speech coder: the frame processing of the
+  encoder and of the decoder, formerly the main loop of vselp.c, working
+  on a VSELP_STATE instead of external variables. See is54.h.
+
+  Functions:
+  vselp_init_enc() .. allocates and initializes an encoder
+  vselp_init_dec() .. allocates and initializes a decoder
+  vselp_prime() ..... loads the look-ahead samples of the encoder
+  vselp_encode() .... encodes one frame of speech
+  vselp_decode() .... decodes one frame of coded parameters
+  vselp_delete() .... releases an encoder or a decoder
+
+  History:
+  17.Oct.26 v.1.0  Created from vselp.c.
+ -------------------------------------------------------------------------
+*/
+
+/* Include files */
+#include "vselp.h"
+
+/* Scale factor used to convert integer input samples to floating point */
+/* fractions */
+#define IN_SCALE ((FTYPE) (1.0 / 32768.0))
+
+
+/* ------------------------------------------------------------------------ */
+/* Allocation of coefficient space and initialization of pointers into */
+/* this space */
+static void initState (VSELP_STATE * st) {
+
+  st->T_NEW.k = (FTYPE *) calloc (14 * NP, sizeof (FTYPE));     /* Note: it is */
+  st->T_NEW.a = st->T_NEW.k + NP;       /* necessary that these coef sets be */
+  st->T_NEW.widen = st->T_NEW.a + NP;   /* stored sequentially. DONT REARRANGE. */
+
+  st->T_OLD.k = st->T_NEW.widen + NP;   /* Note: it is necessary that these */
+  st->T_OLD.a = st->T_OLD.k + NP;       /* coef sets be stored sequentially. */
+  st->T_OLD.widen = st->T_OLD.a + NP;   /* DONT REARRANGE. */
+
+  st->R_NEW.k = st->T_OLD.widen + NP;   /* Note: it is necessary that these */
+  st->R_NEW.a = st->R_NEW.k + NP;       /* coef sets be stored sequentially. */
+  st->R_NEW.widen = st->R_NEW.a + NP;   /* DONT REARRANGE. */
+  st->R_NEW.sst = st->R_NEW.widen + NP;
+
+  st->R_OLD.k = st->R_NEW.sst + NP;     /* Note: it is necessary that these */
+  st->R_OLD.a = st->R_OLD.k + NP;       /* coef sets be stored sequentially. */
+  st->R_OLD.widen = st->R_OLD.a + NP;   /* DONT REARRANGE. */
+  st->R_OLD.sst = st->R_OLD.widen + NP;
+  st->coefBuf = st->T_NEW.k;
+}
+
+/* ......................... End of initState() ............................ */
+
+
+/* ------------------------------------------------------------------------ */
+static VSELP_STATE *vselp_init (void) {
+  VSELP_STATE *st;
+
+  if ((st = (VSELP_STATE *) calloc (1, sizeof (VSELP_STATE))) == NULL)
+    return NULL;
+  initTables (st);
+  initState (st);
+  st->frCnt = 1;
+  return st;
+}
+
+
+VSELP_STATE *vselp_init_enc (int performMeas) {
+  VSELP_STATE *st;
+
+  if ((st = vselp_init ()) != NULL)
+    st->performMeas = performMeas;
+  return st;
+}
+
+
+VSELP_STATE *vselp_init_dec (int postfilter) {
+  VSELP_STATE *st;
+
+  if ((st = vselp_init ()) != NULL)
+    st->apply_postfilter = postfilter;
+  return st;
+}
+
+/* ....................... End of vselp_init_xxx() ......................... */
+
+
+/* ------------------------------------------------------------------------ */
+void vselp_delete (VSELP_STATE * st) {
+  if (st == NULL)
+    return;
+  free (st->coefBuf);
+  free (st->inBuf);
+  free (st->I_CBUFF);
+  free (st->RS_BUFF);
+  free (st->codeBuf);
+  free (*st->r0kAddr);
+  free (st->sst);
+  free (st->T_STATE);
+  free (st->T_VEC);
+  free (st->P);
+  free (st->P_VEC);
+  free (st->W_P_VEC);
+  free (st->BASIS);
+  free (st->BASIS_A);
+  free (st->W_BASIS);
+  free (st->BITS);
+  free (st->X_VEC);
+  free (st->W_X_VEC);
+  free (st->X_A_VEC);
+  free (st->W_X_A_VEC);
+  free (st->T_P_STATE);
+  free (st->TABLE);
+  free (st->GSP0_TABLE);
+  free (st->P_SST);
+  free (st->R_P_STATE);
+  free (st->outBuf);
+  free (st);
+}
+
+/* ......................... End of vselp_delete() ......................... */
+
+
+/* ------------------------------------------------------------------------ */
+/* Fills the input buffer, excluding last frame, with the first */
+/* VSELP_DELAY samples (this doesn't get high-passed with the frames) */
+void vselp_prime (VSELP_STATE * st, short *inp_buf) {
+  FTYPE *tmpPtr, *endPtr;
+  short *shPtr;
+
+  tmpPtr = st->inBuf;
+  shPtr = inp_buf - 1;
+  for (endPtr = tmpPtr + INBUFSIZ - F_LEN; tmpPtr < endPtr; tmpPtr++)
+    *tmpPtr = *++shPtr * IN_SCALE;
+  FILT4 (st, st->inBuf, INBUFSIZ - F_LEN);      /* HPF 1st INBUFSIZ-F_LEN points */
+}
+
+/* ......................... End of vselp_prime() .......................... */
+
+
+/* ------------------------------------------------------------------------ */
+/* Encodes the F_LEN samples of inp_buf into numCodes parameters */
+void vselp_encode (VSELP_STATE * st, short *inp_buf, int *code_buf) {
+  FTYPE RQ_TMP;                 /* R0q value that gets passed to RES_ENG() */
+  int us;                       /* Unstable flag returned by INTERPOLATE(), determines whether another RS will need to be calculated */
+  FTYPE *tmpPtr, *tmpPtr2, *endPtr;
+  short *shPtr;
+  int i;
+
+  /* scale and transfer one frame into the floating-point input buffer */
+  tmpPtr = st->inBuf + INBUFSIZ - F_LEN;
+  shPtr = inp_buf - 1;
+  for (endPtr = tmpPtr + F_LEN; tmpPtr < endPtr; tmpPtr++)
+    *tmpPtr = *++shPtr * IN_SCALE;
+
+  st->codes = st->codeBuf;      /* reset code pointer to beginning of buffer */
+
+  /* hpf the last F_LEN of input */
+  FILT4 (st, st->inBuf + INBUFSIZ - F_LEN, F_LEN);
+
+  FLATV (st);                   /* get reflection coefs and rq0. */
+
+  /* get direct-form coef's from rc's, calculate bandwidth- */
+  /* widened coefs */
+  RCTOA (st->T_NEW.k, st->T_NEW.a);
+  widen (st, W_ALPHA, 't');
+
+  /* This for loop does coefficient interpolation (stored in I_CBUFF) */
+  /* and calculates the residual energy estimate, RS (stored in RS_BUFF), */
+  /* for all subframes.  */
+  for (i = 0; i < N_SUB; i++) {
+    if (i == N_SUB - 1) {
+      /* Final subframe, no interpolation done. Move coefs and */
+      /* calculate RS.  Store a duplicate of RS in RS_BUFF */
+      RQ_TMP = st->T_NEW.rq0;
+      I_MOV (st, st->T_NEW, 2, RQ_TMP);
+      *(st->RS_BUFF + 2 * N_SUB - 1) = *(st->RS_BUFF + 2 * N_SUB - 2);  /* copy last rs. */
+    } else if (i * 2 == N_SUB - 2) {
+      /* Middle subframe.  Interpolate coefs.  If result is */
+      /* unstable, use coefs from frame with larger energy. */
+      /* Perform a geometric average on last and current Rq's, */
+      /* use this value to calculate RS. */
+      /* Calculate another RS based on last or current rc's */
+      /* (if it has not been calculated already due to instability, */
+      /* if that is so, just copy it). */
+      RQ_TMP = sqrt (st->T_NEW.rq0 * st->T_OLD.rq0);
+
+      if (st->T_NEW.rq0 > st->T_OLD.rq0) {
+        us = INTERPOLATE (st, st->T_NEW, 2, st->T_OLD, i, RQ_TMP);
+        if (us)
+          *(st->RS_BUFF + 2 * i + 1) = *(st->RS_BUFF + 2 * i);
+        else
+          *(st->RS_BUFF + 2 * i + 1) = RES_ENG (RQ_TMP, st->T_NEW.k);
+      } else {
+        us = INTERPOLATE (st, st->T_OLD, 2, st->T_NEW, i, RQ_TMP);
+        if (us)
+          *(st->RS_BUFF + 2 * i + 1) = *(st->RS_BUFF + 2 * i);
+        else
+          *(st->RS_BUFF + 2 * i + 1) = RES_ENG (RQ_TMP, st->T_OLD.k);
+      }
+    } else if (i * 2 < N_SUB - 2) {
+      /* Subframe closer to last frame.  Interpolate coefs. */
+      /* If result is unstable, use last frame's coefs. */
+      /* Calculate RS based on last frame's Rq.  Calculate */
+      /* another RS based on last rc's (if it has */
+      /* not been calculated already due to instability, if that */
+      /* is so, just copy it) */
+      RQ_TMP = st->T_OLD.rq0;
+      us = INTERPOLATE (st, st->T_OLD, 2, st->T_NEW, i, RQ_TMP);
+      if (us)
+        *(st->RS_BUFF + 2 * i + 1) = *(st->RS_BUFF + 2 * i);
+      else
+        *(st->RS_BUFF + 2 * i + 1) = RES_ENG (RQ_TMP, st->T_OLD.k);
+    } else {
+      /* Subframe closer to current frame.  Interpolate coefs. */
+      /* If result is unstable, use current frame's coefs. */
+      /* Calculate RS based on current frame's Rq.  Calculate */
+      /* another RS based on current rc's (if it has */
+      /* not been calculated already due to instability, if that */
+      /* is so, just copy it) */
+      RQ_TMP = st->T_NEW.rq0;
+      us = INTERPOLATE (st, st->T_NEW, 2, st->T_OLD, i, RQ_TMP);
+      if (us)
+        *(st->RS_BUFF + 2 * i + 1) = *(st->RS_BUFF + 2 * i);
+      else
+        *(st->RS_BUFF + 2 * i + 1) = RES_ENG (RQ_TMP, st->T_NEW.k);
+    }
+  }
+
+  for (i = 0; i < N_SUB; i++) {
+    /* Load/point-to the values that */
+    /* are needed in the subframe processing. */
+    st->RS = *(st->RS_BUFF + i * 2);
+    st->COEF = st->I_CBUFF + i * 2 * NP;
+    st->W_COEF = st->COEF + NP;
+
+    T_SUB (st, i);              /* Do subframe processing. */
+  }
+
+  /* perform delay on input buffer. */
+  tmpPtr2 = st->inBuf + F_LEN - 1;
+  tmpPtr = st->inBuf;
+  for (endPtr = tmpPtr + (INBUFSIZ - F_LEN); tmpPtr < endPtr; tmpPtr++)
+    *tmpPtr = *++tmpPtr2;
+
+  /* update xmt old values and pointers, */
+  /* new pointers set to old space. */
+  st->T_OLD.rq0 = st->T_NEW.rq0;
+  tmpPtr = st->T_OLD.k;
+  st->T_OLD.k = st->T_NEW.k;
+  st->T_NEW.k = tmpPtr;
+  tmpPtr = st->T_OLD.a;
+  st->T_OLD.a = st->T_NEW.a;
+  st->T_NEW.a = tmpPtr;
+  tmpPtr = st->T_OLD.widen;
+  st->T_OLD.widen = st->T_NEW.widen;
+  st->T_NEW.widen = tmpPtr;
+
+  /* the code buffer keeps the codes of the last frame for FLATV() */
+  for (i = 0; i < numCodes; i++)
+    code_buf[i] = st->codeBuf[i];
+  st->frCnt++;
+}
+
+/* ......................... End of vselp_encode() ......................... */
+
+
+/* ------------------------------------------------------------------------ */
+/* Decodes the numCodes parameters of code_buf into F_LEN samples */
+void vselp_decode (VSELP_STATE * st, int *code_buf, short *out_buf) {
+  FTYPE RQ_HOLD;                /* Temporary storage for the R0q value to use in the middle subframe on the receive side */
+  FTYPE *tmpPtr, *endPtr, f1;
+  short *shPtr;
+  int i;
+
+  for (i = 0; i < numCodes; i++)
+    st->codeBuf[i] = code_buf[i];
+
+  /* get Rq0 and rc's from codes */
+  st->codes = st->codeBuf;
+  st->R_NEW.rq0 = lookup (st, 0);
+  tmpPtr = st->R_NEW.k;
+  for (endPtr = tmpPtr + NP, i = 1; tmpPtr < endPtr; tmpPtr++, i++)
+    *tmpPtr = lookup (st, i);
+
+  /* get direct-form coef's from rc's, calculate bandwidth- */
+  /* widened coefs (denominator of spectral post-filter) and spectrally- */
+  /* smoothed numerator coefs. */
+  RCTOA (st->R_NEW.k, st->R_NEW.a);
+  widen (st, POST_W_D, 'r');
+  A_SST (st, st->R_NEW.widen, st->R_NEW.sst);
+
+  /* Calculate geometric average of Rq0's. */
+  RQ_HOLD = sqrt (st->R_NEW.rq0 * st->R_OLD.rq0);
+
+  /* Calculate interpolated coefs for all subframes */
+  for (i = 0; i < N_SUB; i++) {
+    if (i == N_SUB - 1)
+      I_MOV (st, st->R_NEW, 3, st->R_NEW.rq0);
+    else if (i * 2 == N_SUB - 2) {
+      if (st->R_NEW.rq0 > st->R_OLD.rq0)
+        INTERPOLATE (st, st->R_NEW, 3, st->R_OLD, i, RQ_HOLD);
+      else
+        INTERPOLATE (st, st->R_OLD, 3, st->R_NEW, i, RQ_HOLD);
+    } else if (i * 2 < N_SUB - 2)
+      INTERPOLATE (st, st->R_OLD, 3, st->R_NEW, i, st->R_OLD.rq0);
+    else
+      INTERPOLATE (st, st->R_NEW, 3, st->R_OLD, i, st->R_NEW.rq0);
+  }
+
+  shPtr = out_buf - 1;
+  for (i = 0; i < N_SUB; i++) {
+    /* Load/point-to values needed for */
+    /* subframe processing. */
+    st->RS = *(st->RS_BUFF + 2 * i);
+    st->COEF = st->I_CBUFF + i * 3 * NP;
+    st->W_COEF = st->COEF + NP;
+    st->N_COEF = st->W_COEF + NP;
+
+    R_SUB (st);                 /* Do subframe processing. */
+
+    /* Scale and transfer synthesized speech to the output buffer. */
+    tmpPtr = st->outBuf;
+    for (endPtr = tmpPtr + S_LEN; tmpPtr < endPtr; tmpPtr++) {
+      if (*tmpPtr >= 0.0) {
+        f1 = *tmpPtr * 32768.0 + 0.5;
+        *++shPtr = (f1 >= 32768.0) ? 32767 : (short) f1;
+      } else {
+        f1 = *tmpPtr * 32768.0 - 0.5;
+        *++shPtr = (f1 <= -32769.0) ? -32768 : (short) f1;
+      }
+    }
+  }
+
+  /* update rcv pointers */
+  st->R_OLD.rq0 = st->R_NEW.rq0;
+  tmpPtr = st->R_OLD.k;
+  st->R_OLD.k = st->R_NEW.k;
+  st->R_NEW.k = tmpPtr;
+  tmpPtr = st->R_OLD.a;
+  st->R_OLD.a = st->R_NEW.a;
+  st->R_NEW.a = tmpPtr;
+  tmpPtr = st->R_OLD.widen;
+  st->R_OLD.widen = st->R_NEW.widen;
+  st->R_NEW.widen = tmpPtr;
+  tmpPtr = st->R_OLD.sst;
+  st->R_OLD.sst = st->R_NEW.sst;
+  st->R_NEW.sst = tmpPtr;
+  st->frCnt++;
+}
+
+/* ......................... End of vselp_decode() ......................... */
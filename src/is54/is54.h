@@ -0,0 +1,55 @@
+/*                                                         v1.0 - 17/Oct/2026
+  ============================================================================
+
+  IS54.H
+  ~~~~~~
+
+  Description:
+  ~~~~~~~~~~~~
+
+  Instance API of the IS54 VSELP speech coder. All the state of an encoder
+  or of a decoder is kept in its own VSELP_STATE, allocated by
+  vselp_init_enc() or vselp_init_dec(), so that any number of streams can
+  be processed at the same time, each in its own thread. The functions do
+  no file I/O: the encoder takes 16-bit linear samples and gives one frame
+  of VSELP_CODES coded parameters, the decoder does the reverse.
+
+  The analysis window of the encoder looks VSELP_DELAY samples ahead of
+  the frame: the first VSELP_DELAY samples of a stream are given to
+  vselp_prime() before the first call to vselp_encode(), and every
+  vselp_encode() call then takes the next VSELP_FRAME_LEN samples.
+
+  History:
+  ~~~~~~~~
+  17.Oct.26  v1.0       Created from the main loop of vselp.c.
+  ============================================================================
+*/
+
+#ifndef IS54_H
+#define IS54_H 100
+
+#include <stdio.h>
+
+/* Frame length, look-ahead and number of coded parameters per frame */
+#define VSELP_FRAME_LEN 160
+#define VSELP_DELAY      65
+#define VSELP_CODES      27
+
+/* State of one encoder or decoder (see vparams.h) */
+typedef struct vselp_state VSELP_STATE;
+
+/* Encoder: performMeas enables the weighted SNR measurements */
+VSELP_STATE *vselp_init_enc (int performMeas);
+void vselp_prime (VSELP_STATE * st, short *inp_buf);
+void vselp_encode (VSELP_STATE * st, short *inp_buf, int *code_buf);
+void vselp_print_snr (VSELP_STATE * st, FILE * fplog);
+
+/* Decoder: postfilter enables the adaptive post-filter */
+VSELP_STATE *vselp_init_dec (int postfilter);
+void vselp_decode (VSELP_STATE * st, int *code_buf, short *out_buf);
+
+/* Releases an encoder or a decoder */
+void vselp_delete (VSELP_STATE * st);
+
+#endif /* IS54_H */
+/* .......................... End of file is54.h .......................... */
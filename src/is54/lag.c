@@ -33,14 +33,13 @@ Motorola Inc.
 /*-------------------------------------------------------------*/
 /*	inclusions*/
 
-#include "vparams.h"
+#include "t_sub.h"
 /*#include "stdlib.h"*/
 /*	function declarations*/
-static void i_resp ();
-/*FTYPE *htPtr*/
+static void i_resp (VSELP_STATE * st, FTYPE * htPtr);
 
 
-int LAG_SEARCH () {
+int LAG_SEARCH (VSELP_STATE * st) {
   FTYPE *ht;                    /* Points to truncated impulse response */
   FTYPE *zl;                    /* Points to zl vector, the weighted section of the */
   /* ltp state that will be overlapped and added to */
@@ -68,10 +67,10 @@ int LAG_SEARCH () {
   ht = (FTYPE *) malloc (PLEN * sizeof (FTYPE));
   zl = (FTYPE *) calloc (S_LEN, sizeof (FTYPE));
   bl = (FTYPE *) malloc (S_LEN * sizeof (FTYPE));
-  r = T_P_STATE + LMAX;
+  r = st->T_P_STATE + LMAX;
 
 /*	compute truncated impulse response of H(z)*/
-  i_resp (ht);
+  i_resp (st, ht);
 
 /*	compute initial zl array*/
   for (n = 0; n < LMIN; n++) {
@@ -114,7 +113,7 @@ int LAG_SEARCH () {
     /* compute cross-correlation between weighted speech and bl */
     Cl = 0.0;
     tmpPtr = bl;
-    tmpPtr2 = P;
+    tmpPtr2 = st->P;
     for (endPtr = tmpPtr + S_LEN; tmpPtr < endPtr; tmpPtr++, tmpPtr2++)
       Cl += *tmpPtr * *tmpPtr2;
 
@@ -175,7 +174,7 @@ int LAG_SEARCH () {
 
 
 /*	truncated impulse response function */
-static void i_resp (FTYPE * htPtr) {
+static void i_resp (VSELP_STATE * st, FTYPE * htPtr) {
   FTYPE *cP, *tmpPtr, *endPtr, *freePtr, impulse = 1.0;
   int i;
 
@@ -185,7 +184,7 @@ static void i_resp (FTYPE * htPtr) {
 
 /*	calculate response*/
   for (endPtr = tmpPtr + PLEN; tmpPtr < endPtr; tmpPtr++) {
-    cP = W_COEF - 1;
+    cP = st->W_COEF - 1;
     for (i = 1; i <= NP; i++)
       *tmpPtr -= *(cP + i) * *(tmpPtr - i);
     *tmpPtr += impulse;
@@ -34,23 +34,20 @@ Motorola Inc.
 /*-------------------------------------------------------------*/
 /*	inclusions*/
 
-#include "vparams.h"
+#include "vselp.h"
 /*#include "stdlib.h"*/
-/*	from paramConv.c */
-int ATORC ();
-/*FTYPE *a, FTYPE *k*/
 
-void widen (FTYPE lambda, char side) {
+void widen (VSELP_STATE * st, FTYPE lambda, char side) {
   FTYPE term;                   /* holds lambda**i term (widening factor for Ai) */
 
   FTYPE *tp, *tp2, *ep;
 
   if (side == 't') {
-    tp2 = T_NEW.a;
-    tp = T_NEW.widen;
+    tp2 = st->T_NEW.a;
+    tp = st->T_NEW.widen;
   } else {
-    tp2 = R_NEW.a;
-    tp = R_NEW.widen;
+    tp2 = st->R_NEW.a;
+    tp = st->R_NEW.widen;
   }
   term = lambda;
   for (ep = tp + NP; tp < ep; tp++) {
@@ -66,16 +63,11 @@ void widen (FTYPE lambda, char side) {
 /*		 coefficients*/
 
 /*	function declarations */
-void ATOCOR ();
-/*FTYPE *k, FTYPE *ac*/
-void LEVINSON ();
-/*FTYPE *ac, FTYPE *a*/
+void ATOCOR (FTYPE * k, FTYPE * ac);
+void LEVINSON (FTYPE * ac, FTYPE * a);
 
 /*	function definition*/
-void A_SST (wCoefPtr, ssCoefPtr)
-     FTYPE *wCoefPtr;
-     FTYPE *ssCoefPtr;
-{
+void A_SST (VSELP_STATE * st, FTYPE * wCoefPtr, FTYPE * ssCoefPtr) {
   FTYPE *tmpKs;                 /* points to temporary reflection coef buffer */
   FTYPE *tmpAcs;                /* points to temp autocorrelation buffer */
   FTYPE *tp, *tp2, *ep;
@@ -96,7 +88,7 @@ void A_SST (wCoefPtr, ssCoefPtr)
 
 /*	do spectral smoothing (apply envelope to autocorrelations)*/
   tp = tmpAcs;
-  tp2 = P_SST;
+  tp2 = st->P_SST;
   for (ep = tp + NP + 1; tp < ep; tp++, tp2++)
     *tp *= *tp2;
 
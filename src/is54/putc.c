@@ -30,7 +30,7 @@ Motorola Inc.
 /* Written by: Matt Hartman */
 /*-------------------------------------------------------------*/
 /* inclusions */
-#include "vparams.h"
+#include "vselp.h"
 
 
 /* from cunpack0_.c */
@@ -202,7 +202,7 @@ long getCodesBin (FILE * fpcode, int *codePtr) {
 
 
 /* ------------------------------------------------------------------------ */
-void putCodesLog () {
+void putCodesLog (FILE * fplog, int frCnt, int *codeBuf) {
   int *tip, *eip, index, code;
 
   /* print out codes for one frame. */
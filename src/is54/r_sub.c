@@ -31,12 +31,7 @@ Motorola Inc.
  /* inclusions */
 #include "r_sub.h"
 
-void R_SUB () {
-  static FTYPE SYN_STATE[NP];   /* synthesis filter state */
-  static FTYPE POST_STATE_N[NP];        /* post-filter numerator state */
-  static FTYPE POST_STATE_D[NP];        /* post-filter denominator state */
-  static FTYPE POST_STATE_E;    /* post-emphasis filter state */
-  static FTYPE runningGain;     /* post-filter agc gain applied on sample-by-sample basis */
+void R_SUB (VSELP_STATE * st) {
   FTYPE beta;                   /* pitch excitation gain */
   FTYPE preEnergy;              /* energy before filter (both agc's) */
   FTYPE postEnergy;             /* energy after filter (both agc's) */
@@ -49,96 +44,96 @@ void R_SUB () {
   FTYPE *tmpPtr, *tmpPtr2, *endPtr, temp1, temp2;
 
   /* retrieve codes from code buffer */
-  if (*codes)
-    R_LAG = *codes + LMIN - 1;
+  if (*st->codes)
+    R_LAG = *st->codes + LMIN - 1;
   else
     R_LAG = 0;
-  codes++;
-  R_CODE = *codes;
-  codes++;
-  R_CODE_A = *codes;
-  codes++;
-  R_GSP0 = *codes;
-  codes++;
+  st->codes++;
+  R_CODE = *st->codes;
+  st->codes++;
+  R_CODE_A = *st->codes;
+  st->codes++;
+  R_GSP0 = *st->codes;
+  st->codes++;
 
   /* construct pitch vector */
   if (R_LAG)
-    P_EX (P_VEC, R_P_STATE, R_LAG);
+    P_EX (st->P_VEC, st->R_P_STATE, R_LAG);
 
   /* construct 1st-codebook excitation */
-  B_CON (R_CODE, C_BITS, BITS);
-  V_CON (BASIS, BITS, C_BITS, X_VEC);
+  B_CON (R_CODE, C_BITS, st->BITS);
+  V_CON (st->BASIS, st->BITS, C_BITS, st->X_VEC);
 
   /* construct 2nd-codebook excitation */
-  B_CON (R_CODE_A, C_BITS_A, BITS);
-  V_CON (BASIS_A, BITS, C_BITS_A, X_A_VEC);
+  B_CON (R_CODE_A, C_BITS_A, st->BITS);
+  V_CON (st->BASIS_A, st->BITS, C_BITS_A, st->X_A_VEC);
 
   /* if there is a pitch vector, get sqrt(rs/energy in pitch) */
   if (R_LAG)
-    RS00 = RS_RR (P_VEC, RS);
+    st->RS00 = RS_RR (st->P_VEC, st->RS);
 
   /* get sqrt(rs/energy in 1st-codebook excitation) */
-  RS11 = RS_RR (X_VEC, RS);
+  st->RS11 = RS_RR (st->X_VEC, st->RS);
 
   /* get sqrt(rs/energy in 2nd-codebook excitation) */
-  RS22 = RS_RR (X_A_VEC, RS);
+  st->RS22 = RS_RR (st->X_A_VEC, st->RS);
 
   /* scale and combine excitations, put result in T_VEC */
-  beta = EXCITE (R_GSP0, R_LAG, RS00, RS11, RS22, P_VEC, X_VEC, X_A_VEC, T_VEC);
+  beta = EXCITE (st, R_GSP0, R_LAG, st->RS00, st->RS11, st->RS22, st->P_VEC, st->X_VEC, st->X_A_VEC, st->T_VEC);
 
   /* perform one subframe's worth of delay on R_P_STATE */
-  tmpPtr = R_P_STATE;
-  tmpPtr2 = R_P_STATE + S_LEN;
-  for (endPtr = R_P_STATE + LMAX; tmpPtr2 < endPtr; tmpPtr2++, tmpPtr++)
+  tmpPtr = st->R_P_STATE;
+  tmpPtr2 = st->R_P_STATE + S_LEN;
+  for (endPtr = st->R_P_STATE + LMAX; tmpPtr2 < endPtr; tmpPtr2++, tmpPtr++)
     *tmpPtr = *tmpPtr2;
 
   /* update the last subframe's worth of data in R_P_STATE with excitation */
-  tmpPtr2 = T_VEC;
+  tmpPtr2 = st->T_VEC;
   for (; tmpPtr < endPtr; tmpPtr++, tmpPtr2++)
     *tmpPtr = *tmpPtr2;
 
   /* synthesize speech and put in output buffer */
-  DIR (T_VEC, outBuf, SYN_STATE, COEF, S_LEN);
+  DIR (st->T_VEC, st->outBuf, st->SYN_STATE, st->COEF, S_LEN);
 
   /* adaptive postfilter */
   /* compute original energy in output speech for agc */
   preEnergy = 0.0;
-  tmpPtr = outBuf;
+  tmpPtr = st->outBuf;
   for (endPtr = tmpPtr + S_LEN; tmpPtr < endPtr; tmpPtr++)
     preEnergy += *tmpPtr * *tmpPtr;
 
-  if (apply_postfilter) {
+  if (st->apply_postfilter) {
     /* implement spectral postfilter */
-    I_DIR (outBuf, outBuf, POST_STATE_N, N_COEF, S_LEN);
-    DIR (outBuf, outBuf, POST_STATE_D, W_COEF, S_LEN);
+    I_DIR (st->outBuf, st->outBuf, st->POST_STATE_N, st->N_COEF, S_LEN);
+    DIR (st->outBuf, st->outBuf, st->POST_STATE_D, st->W_COEF, S_LEN);
 
     /* first order emphasis filter (boosts high frequencies) */
-    tmpPtr = outBuf;
+    tmpPtr = st->outBuf;
     tmpPtr2 = tmpPtr;
-    temp1 = *tmpPtr - POST_EMPH * POST_STATE_E;
+    temp1 = *tmpPtr - POST_EMPH * st->POST_STATE_E;
     tmpPtr++;
-    for (endPtr = outBuf + S_LEN; tmpPtr < endPtr; tmpPtr++, tmpPtr2++) {
+    for (endPtr = st->outBuf + S_LEN; tmpPtr < endPtr; tmpPtr++, tmpPtr2++) {
       temp2 = *tmpPtr - POST_EMPH * *tmpPtr2;
       *tmpPtr2 = temp1;
       temp1 = temp2;
     }
-    POST_STATE_E = *tmpPtr2;
+    st->POST_STATE_E = *tmpPtr2;
     *tmpPtr2 = temp1;
 
     /* compute energy in post-filtered speech, compute new gain, scale */
     /* speech, and leave in outBuf */
     postEnergy = 0.0;
-    tmpPtr = outBuf;
+    tmpPtr = st->outBuf;
     for (endPtr = tmpPtr + S_LEN; tmpPtr < endPtr; tmpPtr++)
       postEnergy += *tmpPtr * *tmpPtr;
 
     gain = (postEnergy == 0.0) ? 0.0 : sqrt (preEnergy / postEnergy);
 
     temp1 = 1.0 - POST_AGC_COEF;
-    tmpPtr = outBuf;
+    tmpPtr = st->outBuf;
     for (endPtr = tmpPtr + S_LEN; tmpPtr < endPtr; tmpPtr++) {
-      runningGain = gain * temp1 + runningGain * POST_AGC_COEF;
-      *tmpPtr *= runningGain;
+      st->runningGain = gain * temp1 + st->runningGain * POST_AGC_COEF;
+      *tmpPtr *= st->runningGain;
     }
   }
 }
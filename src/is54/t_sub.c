@@ -34,12 +34,18 @@ Motorola Inc.
 /*	inclusions*/
 
 #include "t_sub.h"
-void T_SUB (int sfIndex) {
-  static FTYPE *I_PTR;          /* points to beginning of current subframe */
-  /* of input speech */
-  static FTYPE W_STATE_N[NP];   /* speech weighting filter numerator state */
-  static FTYPE W_STATE_D[NP];   /* speech weighting filter denominator state */
-  static FTYPE SYN_STATE_W[NP]; /* weighted synthesis filter state */
+
+/*	codebook search: vectorized with IS54_FAST_VSRCH (v_srchv.c), both*/
+/*	searches compared with IS54_CHECK_VSRCH (vsrchbench.c)*/
+#if defined(IS54_CHECK_VSRCH)
+#define CB_SEARCH V_SRCHC
+#elif defined(IS54_FAST_VSRCH)
+#define CB_SEARCH V_SRCHV
+#else
+#define CB_SEARCH V_SRCH
+#endif
+
+void T_SUB (VSELP_STATE * st, int sfIndex) {
   int T_LAG;                    /* holds the chosen lag */
   int T_CODE;                   /* holds the chosen codeword from the 1st */
   /* codebook */
@@ -50,77 +56,76 @@ void T_SUB (int sfIndex) {
 
   FTYPE *tmpPtr, *tmpPtr2, *tmpPtr3, *endPtr, *endPtr2;
 
-  static FTYPE tState[NP];      /* needed for performance analysis */
   FTYPE *tVec;                  /* needed for performance analysis */
 
-  if (performMeas)
+  if (st->performMeas)
     tVec = (FTYPE *) malloc (S_LEN * sizeof (FTYPE));
 
   if (sfIndex == 0)
-    I_PTR = inBuf;
+    st->I_PTR = st->inBuf;
   else
-    I_PTR += S_LEN;
+    st->I_PTR += S_LEN;
 
 /*	apply W(z) to input speech, and get the zero-input response of H(z)*/
-  tmpPtr = T_STATE;
-  tmpPtr2 = SYN_STATE_W - 1;
+  tmpPtr = st->T_STATE;
+  tmpPtr2 = st->SYN_STATE_W - 1;
   for (endPtr = tmpPtr + NP; tmpPtr < endPtr; tmpPtr++)
     *tmpPtr = *++tmpPtr2;
-  I_DIR (I_PTR, T_VEC, W_STATE_N, COEF, S_LEN);
-  DIR (T_VEC, P, W_STATE_D, W_COEF, S_LEN);
-  ZI_DIR (T_VEC, T_STATE, W_COEF, S_LEN);
+  I_DIR (st->I_PTR, st->T_VEC, st->W_STATE_N, st->COEF, S_LEN);
+  DIR (st->T_VEC, st->P, st->W_STATE_D, st->W_COEF, S_LEN);
+  ZI_DIR (st->T_VEC, st->T_STATE, st->W_COEF, S_LEN);
 
 /*	subtract zero-input response from weighted speech*/
-  tmpPtr = P;
-  tmpPtr2 = T_VEC - 1;
+  tmpPtr = st->P;
+  tmpPtr2 = st->T_VEC - 1;
   for (endPtr = tmpPtr + S_LEN; tmpPtr < endPtr; tmpPtr++)
     *tmpPtr -= *++tmpPtr2;
 
 /*	do lag search; if lag is not zero, contruct pitch vector excitation*/
 /*	and send it thru weighting filter*/
-  if ((T_LAG = LAG_SEARCH ()) != 0) {
-    P_EX (P_VEC, T_P_STATE, T_LAG);
-    tmpPtr = T_STATE;
+  if ((T_LAG = LAG_SEARCH (st)) != 0) {
+    P_EX (st->P_VEC, st->T_P_STATE, T_LAG);
+    tmpPtr = st->T_STATE;
     for (endPtr = tmpPtr + NP; tmpPtr < endPtr; tmpPtr++)
       *tmpPtr = 0.0;
-    DIR (P_VEC, W_P_VEC, T_STATE, W_COEF, S_LEN);
+    DIR (st->P_VEC, st->W_P_VEC, st->T_STATE, st->W_COEF, S_LEN);
   }
 
 /*	weight the basis vectors*/
-  tmpPtr = BASIS;
-  tmpPtr2 = W_BASIS;
+  tmpPtr = st->BASIS;
+  tmpPtr2 = st->W_BASIS;
   for (endPtr = tmpPtr + S_LEN * C_BITS; tmpPtr < endPtr; tmpPtr += S_LEN) {
-    tmpPtr3 = T_STATE;
+    tmpPtr3 = st->T_STATE;
     for (endPtr2 = tmpPtr3 + NP; tmpPtr3 < endPtr2; tmpPtr3++)
       *tmpPtr3 = 0.0;
-    DIR (tmpPtr, tmpPtr2, T_STATE, W_COEF, S_LEN);
+    DIR (tmpPtr, tmpPtr2, st->T_STATE, st->W_COEF, S_LEN);
     tmpPtr2 += S_LEN;
   }
 
 /*	if there is a pitch vector, decorrelate the weighted basis vectors*/
 /*	from it, and put them back in W_BASIS*/
   if (T_LAG)
-    DECORR (W_P_VEC, W_BASIS, C_BITS);
+    DECORR (st->W_P_VEC, st->W_BASIS, C_BITS);
 
 /*	do the VSELP codebook search on the weighted, decorrelated basis*/
 /*	vectors.*/
-  T_CODE = V_SRCH (P, W_BASIS, C_BITS);
+  T_CODE = CB_SEARCH (st, st->P, st->W_BASIS, C_BITS);
 
 /*	construct the chosen VSELP code vector from the basis vectors*/
-  B_CON (T_CODE, C_BITS, BITS);
-  V_CON (BASIS, BITS, C_BITS, X_VEC);
+  B_CON (T_CODE, C_BITS, st->BITS);
+  V_CON (st->BASIS, st->BITS, C_BITS, st->X_VEC);
 
 /*	construct the weighted, decorrelated, 1st-codebook vector*/
-  V_CON (W_BASIS, BITS, C_BITS, W_X_VEC);
+  V_CON (st->W_BASIS, st->BITS, C_BITS, st->W_X_VEC);
 
 /*	weight the 2nd basis vector set*/
-  tmpPtr = BASIS_A;
-  tmpPtr2 = W_BASIS;
+  tmpPtr = st->BASIS_A;
+  tmpPtr2 = st->W_BASIS;
   for (endPtr = tmpPtr + S_LEN * C_BITS_A; tmpPtr < endPtr; tmpPtr += S_LEN) {
-    tmpPtr3 = T_STATE;
+    tmpPtr3 = st->T_STATE;
     for (endPtr2 = tmpPtr3 + NP; tmpPtr3 < endPtr2; tmpPtr3++)
       *tmpPtr3 = 0.0;
-    DIR (tmpPtr, tmpPtr2, T_STATE, W_COEF, S_LEN);
+    DIR (tmpPtr, tmpPtr2, st->T_STATE, st->W_COEF, S_LEN);
     tmpPtr2 += S_LEN;
   }
 
@@ -128,79 +133,79 @@ void T_SUB (int sfIndex) {
 /*	vectors from it, and put them back in W_BASIS*/
 /*    */
   if (T_LAG)
-    DECORR (W_P_VEC, W_BASIS, C_BITS_A);
+    DECORR (st->W_P_VEC, st->W_BASIS, C_BITS_A);
 
 /*	decorrelate the 2nd set of weighted, decorrelated-from-pitch-vector*/
 /*	basis vectors from the weighted, 1st-codebook excitation*/
-  DECORR (W_X_VEC, W_BASIS, C_BITS_A);
+  DECORR (st->W_X_VEC, st->W_BASIS, C_BITS_A);
 
 /*	do the VSELP codebook search on the weighted, decorrelated,*/
 /*	2nd-codebook vectors*/
-  T_CODE_A = V_SRCH (P, W_BASIS, C_BITS_A);
+  T_CODE_A = CB_SEARCH (st, st->P, st->W_BASIS, C_BITS_A);
 
 /*	construct the chosen VSELP code vector from the 2nd set of*/
 /*	basis vectors*/
-  B_CON (T_CODE_A, C_BITS_A, BITS);
-  V_CON (BASIS_A, BITS, C_BITS_A, X_A_VEC);
+  B_CON (T_CODE_A, C_BITS_A, st->BITS);
+  V_CON (st->BASIS_A, st->BITS, C_BITS_A, st->X_A_VEC);
 
 /*	weight the 1st-codebook vector*/
-  tmpPtr = T_STATE;
+  tmpPtr = st->T_STATE;
   for (endPtr = tmpPtr + NP; tmpPtr < endPtr; tmpPtr++)
     *tmpPtr = 0.0;
-  DIR (X_VEC, W_X_VEC, T_STATE, W_COEF, S_LEN);
+  DIR (st->X_VEC, st->W_X_VEC, st->T_STATE, st->W_COEF, S_LEN);
 
 /*	weight the 2nd-codebook vector*/
-  tmpPtr = T_STATE;
+  tmpPtr = st->T_STATE;
   for (endPtr = tmpPtr + NP; tmpPtr < endPtr; tmpPtr++)
     *tmpPtr = 0.0;
-  DIR (X_A_VEC, W_X_A_VEC, T_STATE, W_COEF, S_LEN);
+  DIR (st->X_A_VEC, st->W_X_A_VEC, st->T_STATE, st->W_COEF, S_LEN);
 
 /*	if there is a pitch vector, get sqrt(rs/energy in pitch)*/
   if (T_LAG)
-    RS00 = RS_RR (P_VEC, RS);
+    st->RS00 = RS_RR (st->P_VEC, st->RS);
 
 /*	get sqrt(rs/energy in 1st-codebook excitation)*/
-  RS11 = RS_RR (X_VEC, RS);
+  st->RS11 = RS_RR (st->X_VEC, st->RS);
 
 /*	get sqrt(rs/energy in 2nd-codebook excitation)*/
-  RS22 = RS_RR (X_A_VEC, RS);
+  st->RS22 = RS_RR (st->X_A_VEC, st->RS);
 
 /*	do gain quantization*/
-  T_GSP0 = G_QUANT (T_LAG, RS00, RS11, RS22);
+  T_GSP0 = G_QUANT (st, T_LAG, st->RS00, st->RS11, st->RS22);
 
 /*	put codes into code buffer*/
   if (T_LAG)
-    *codes = (T_LAG - LMIN + 1) & 0xff;
+    *st->codes = (T_LAG - LMIN + 1) & 0xff;
   else
-    *codes = 0;
-  codes++;
-  *codes = T_CODE & 0xff;
-  codes++;
-  *codes = T_CODE_A & 0xff;
-  codes++;
-  *codes = T_GSP0 & 0xff;
-  codes++;
+    *st->codes = 0;
+  st->codes++;
+  *st->codes = T_CODE & 0xff;
+  st->codes++;
+  *st->codes = T_CODE_A & 0xff;
+  st->codes++;
+  *st->codes = T_GSP0 & 0xff;
+  st->codes++;
 
 /*	perform one subframe's worth of delay on ltp state, T_P_STATE*/
-  tmpPtr = T_P_STATE;
-  tmpPtr2 = T_P_STATE + S_LEN;
-  for (endPtr = T_P_STATE + LMAX; tmpPtr2 < endPtr; tmpPtr2++) {
+  tmpPtr = st->T_P_STATE;
+  tmpPtr2 = st->T_P_STATE + S_LEN;
+  for (endPtr = st->T_P_STATE + LMAX; tmpPtr2 < endPtr; tmpPtr2++) {
     *tmpPtr = *tmpPtr2;
     tmpPtr++;
   }
 
 /*	scale and combine excitations, put result at end of ltp state*/
-  EXCITE (T_GSP0, T_LAG, RS00, RS11, RS22, P_VEC, X_VEC, X_A_VEC, xmtExPtr);
+  EXCITE (st, T_GSP0, T_LAG, st->RS00, st->RS11, st->RS22, st->P_VEC, st->X_VEC, st->X_A_VEC, st->xmtExPtr);
 
 /*	perform weighting filter, H(z), only to get state*/
-  DIR (xmtExPtr, T_VEC, SYN_STATE_W, W_COEF, S_LEN);
-  if (performMeas) {
-    tmpPtr = T_STATE;
+  DIR (st->xmtExPtr, st->T_VEC, st->SYN_STATE_W, st->W_COEF, S_LEN);
+  if (st->performMeas) {
+    tmpPtr = st->T_STATE;
     for (endPtr = tmpPtr + NP; tmpPtr < endPtr; tmpPtr++)
       *tmpPtr = 0.0;
-    DIR (xmtExPtr, T_VEC, T_STATE, W_COEF, S_LEN);      /* weight combined excit */
-    DIR (xmtExPtr, tVec, tState, COEF, S_LEN);  /* synthesize speech */
-    runningSnr (I_PTR, tVec, P, T_VEC); /* compute performance */
+    DIR (st->xmtExPtr, st->T_VEC, st->T_STATE, st->W_COEF, S_LEN);      /* weight combined excit */
+    DIR (st->xmtExPtr, tVec, st->tState, st->COEF, S_LEN);  /* synthesize speech */
+    runningSnr (st, st->I_PTR, tVec, st->P, st->T_VEC); /* compute performance */
     free (tVec);
   }
 }                               /* end of T_SUB */
@@ -32,59 +32,47 @@ Motorola Inc.
 
 /*#include "stdlib.h"*/
 
-/*	externals (defined in externDef.i, malloc'd in calcParams.c)*/
-extern FTYPE RS00, RS11, RS22;
-
 /*-------------------------------------------------------------------------*/
 /* Function declarations ...  */
 /* ... from filters.c*/
-void I_DIR ();
-/*FTYPE *inPtr, FTYPE *oPtr, FTYPE *stPtr, FTYPE *coefPtr, int len*/
-void DIR ();
-/*FTYPE *inPtr, FTYPE *oPtr, FTYPE *stPtr, FTYPE *coefPtr, int len*/
-void ZI_DIR ();
-/*FTYPE *oPtr, FTYPE *stPtr, FTYPE *coefPtr, int len*/
+void I_DIR (FTYPE * inPtr, FTYPE * oPtr, FTYPE * stPtr, FTYPE * coefPtr, int len);
+void DIR (FTYPE * inPtr, FTYPE * oPtr, FTYPE * stPtr, FTYPE * coefPtr, int len);
+void ZI_DIR (FTYPE * oPtr, FTYPE * stPtr, FTYPE * coefPtr, int len);
 
 /* ... from lag_search.c*/
-int LAG_SEARCH ();
-/*void*/
+int LAG_SEARCH (VSELP_STATE * st);
 
 /* ... from p_ex.c*/
-void P_EX ();
-/*FTYPE *oPtr, FTYPE *psPtr, int lag*/
+void P_EX (FTYPE * oPtr, FTYPE * psPtr, int lag);
 
 /* ... from decorr.c*/
-void DECORR ();
-/*FTYPE *vecPtr, FTYPE *basisPtr, int numBasis*/
+void DECORR (FTYPE * vecPtr, FTYPE * basisPtr, int numBasis);
 
 /* ... from v_srch.c*/
-int V_SRCH ();
-/*FTYPE *wiPtr, FTYPE *wBasisPtr, int numBasis*/
+int V_SRCH (VSELP_STATE * st, FTYPE * wiPtr, FTYPE * wBasisPtr, int numBasis);
+
+/* ... from v_srchv.c*/
+int V_SRCHV (VSELP_STATE * st, FTYPE * wiPtr, FTYPE * wBasisPtr, int numBasis);
+
+/* ... from vsrchbench.c (IS54_CHECK_VSRCH only)*/
+int V_SRCHC (VSELP_STATE * st, FTYPE * wiPtr, FTYPE * wBasisPtr, int numBasis);
 
 /* ... from b_con.c*/
-void B_CON ();
-/*int codeWord, int numBits, FTYPE *bitArray*/
+void B_CON (int codeWord, int numBits, FTYPE * bitArray);
 
 /* ... from v_con.c*/
-void V_CON ();
-/*FTYPE *basisPtr, FTYPE *bitArray, int numBasis, FTYPE *oPtr*/
+void V_CON (FTYPE * basisPtr, FTYPE * bitArray, int numBasis, FTYPE * oPtr);
 
 /* ... from rs_rr.c*/
-FTYPE RS_RR ();
-/*FTYPE *vecPtr, FTYPE rs*/
+FTYPE RS_RR (FTYPE * vecPtr, FTYPE rs);
 
 /* ... from g_quant.c*/
-int G_QUANT ();
-/*int lag, FTYPE rs00, FTYPE rs11, FTYPE rs22*/
+int G_QUANT (VSELP_STATE * st, int lag, FTYPE rs00, FTYPE rs11, FTYPE rs22);
 
 /* ... from excite.c*/
-FTYPE EXCITE ();
-/*int gsp0, int lag, FTYPE rs00, FTYPE rs11, FTYPE rs22,
-		FTYPE *pVecPtr, FTYPE *x1VecPtr, FTYPE *x2VecPtr,
-		FTYPE *oPtr*/
+FTYPE EXCITE (VSELP_STATE * st, int gsp0, int lag, FTYPE rs00, FTYPE rs11, FTYPE rs22, FTYPE * pVecPtr, FTYPE * x1VecPtr, FTYPE * x2VecPtr, FTYPE * oPtr);
 
 /* ... from weightedSnr.c*/
-void runningSnr ();
-/*FTYPE *speech, FTYPE *syn, FTYPE *wSpeech, FTYPE *wsyn*/
+void runningSnr (VSELP_STATE * st, FTYPE * speech, FTYPE * syn, FTYPE * wSpeech, FTYPE * wsyn);
 
 /* ......................... End of file t_sub.h ........................... */
@@ -33,9 +33,9 @@ Motorola Inc.
 /*-------------------------------------------------------------*/
 /*	inclusions*/
 
-#include "vparams.h"
+#include "t_sub.h"
 /*#include "stdlib.h"*/
-int V_SRCH (FTYPE * wiPtr, FTYPE * wBasisPtr, int numBasis) {
+int V_SRCH (VSELP_STATE * st, FTYPE * wiPtr, FTYPE * wBasisPtr, int numBasis) {
   FTYPE *R;                     /* array of Rm values, the cross correlations between */
   /* the weighted speech and weighted basis vectors */
   FTYPE *D;                     /* matrix of Dmj values, the cross correlations */
@@ -103,7 +103,7 @@ int V_SRCH (FTYPE * wiPtr, FTYPE * wBasisPtr, int numBasis) {
   cSqrdBest = C * C;
   gBest = G;
   wordSave = 0;
-  intPtr = TABLE;
+  intPtr = st->TABLE;
   for (iePtr = intPtr + (1 << numBasis) - 2; intPtr < iePtr; intPtr++) {
     codeWord = *intPtr;
     bitChanged = *++intPtr;     /* bitChanged is in [0,numBasis-1] */
@@ -0,0 +1,300 @@
+/*                                                         v1.1 - 17/Oct/2026
+  ============================================================================
+
+  V_SRCHV.C
+  ~~~~~~~~~
+
+  Description:
+  ~~~~~~~~~~~~
+
+  Vectorized VSELP codebook search. V_SRCHV() does the search of V_SRCH()
+  (v_srch.c), but instead of walking the Gray-code table one
+  bit flip at a time it evaluates C (correlation with the weighted speech)
+  and G (energy) of four codewords at a time, the ones that differ only in
+  their two lowest bits:
+
+  - the correlations Rm and Dmj are computed with the basis vectors in
+    lanes, each one adding its products in the same order as V_SRCH();
+  - with sm = +1 or -1 for bit m-1 of the codeword, C and G are split into
+    the contribution of the two low bits (Clo, Glo, one lane per sign
+    pattern), the one of the high bits (Chi, Ghi, per block of four
+    codewords), and the cross terms Xj = 2 (s1 D1j + s2 D2j) of each high
+    basis vector j, precomputed in lanes; then, for each block,
+    C = Clo + Chi and G = Glo + Ghi + sum sj Xj;
+  - the codewords are then compared in the order of the Gray-code table,
+    with the comparison of V_SRCH() (C**2 Gbest > Cbest**2 G), four
+    positions at a time: each lane keeps its first best, and the first
+    best of the four lanes is taken, so that the same codeword is kept
+    among equal C**2/G. As this needs G > 0, the codewords are compared
+    one by one if some G is not (degenerate basis vectors).
+
+  C and G are computed directly instead of by the add/subtract recursion
+  of V_SRCH(), so they round differently, and the rounding errors of the
+  recursion grow along the table. The two searches are therefore not
+  guaranteed to choose the same codeword: they may not when the best
+  C**2/G are close, which the exact comparison does not bound. vsrchbench
+  -check compares them on every subframe of the speech test files; this
+  is why the encoder only uses V_SRCHV() when compiled with
+  IS54_FAST_VSRCH.
+
+  The four lanes use SSE on x86 processors when FTYPE is float; otherwise
+  the same operations are done in plain C.
+
+  History:
+  ~~~~~~~~
+  17.Oct.26  v1.0       Created.
+  17.Oct.26  v1.1       Documented that the choice may differ from V_SRCH().
+  ============================================================================
+*/
+
+#include "t_sub.h"
+
+#if !defined(USEDOUBLES) && (defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1))
+#define VS_HAVE_SSE
+#include <xmmintrin.h>
+#endif
+
+#define VS_MAXB   8             /* maximum number of basis vectors */
+#define VS_BLOCKS (1 << (VS_MAXB - 3))  /* blocks of four codewords */
+
+/* Four lanes and the operations on them */
+#ifdef VS_HAVE_SSE
+typedef __m128 V4;
+#define V4_SET1(x)   _mm_set1_ps (x)
+#define V4_LOAD(p)   _mm_loadu_ps (p)
+#define V4_STORE(p,a) _mm_storeu_ps (p, a)
+#define V4_ADD(a,b)  _mm_add_ps (a, b)
+#define V4_MUL(a,b)  _mm_mul_ps (a, b)
+#define V4_GT(a,b)   _mm_cmpgt_ps (a, b)
+#define V4_SEL(m,a,b) _mm_or_ps (_mm_and_ps (m, a), _mm_andnot_ps (m, b))
+#define V4_ALL(m)    (_mm_movemask_ps (m) == 15)
+#else
+typedef struct {
+  FTYPE v[4];
+} V4;
+
+static V4 V4_SET1 (FTYPE x) {
+  V4 r;
+  r.v[0] = r.v[1] = r.v[2] = r.v[3] = x;
+  return r;
+}
+
+static V4 V4_LOAD (FTYPE * p) {
+  V4 r;
+  r.v[0] = p[0], r.v[1] = p[1], r.v[2] = p[2], r.v[3] = p[3];
+  return r;
+}
+
+static void V4_STORE (FTYPE * p, V4 a) {
+  p[0] = a.v[0], p[1] = a.v[1], p[2] = a.v[2], p[3] = a.v[3];
+}
+
+static V4 V4_ADD (V4 a, V4 b) {
+  a.v[0] += b.v[0], a.v[1] += b.v[1], a.v[2] += b.v[2], a.v[3] += b.v[3];
+  return a;
+}
+
+static V4 V4_MUL (V4 a, V4 b) {
+  a.v[0] *= b.v[0], a.v[1] *= b.v[1], a.v[2] *= b.v[2], a.v[3] *= b.v[3];
+  return a;
+}
+
+/* Comparison masks hold 1 (true) or 0 (false) */
+static V4 V4_GT (V4 a, V4 b) {
+  int i;
+  for (i = 0; i < 4; i++)
+    a.v[i] = a.v[i] > b.v[i];
+  return a;
+}
+
+static V4 V4_SEL (V4 m, V4 a, V4 b) {
+  int i;
+  for (i = 0; i < 4; i++)
+    if (m.v[i] == 0)
+      a.v[i] = b.v[i];
+  return a;
+}
+
+static int V4_ALL (V4 m) {
+  return m.v[0] != 0 && m.v[1] != 0 && m.v[2] != 0 && m.v[3] != 0;
+}
+#endif
+
+/* Positions of the first four codewords of the table */
+static FTYPE VS_POS[4] = { 0.0, 1.0, 2.0, 3.0 };
+
+/* Adds bt[k][m] times the lanes b to the row a of Dmj */
+#define VS_ROW(a,m)  a = V4_ADD (a, V4_MUL (V4_SET1 (bt[k][m]), b))
+
+
+int V_SRCHV (VSELP_STATE * st, FTYPE * wiPtr, FTYPE * wBasisPtr, int numBasis) {
+  FTYPE bt[S_LEN][VS_MAXB];     /* weighted basis vectors, transposed */
+  FTYPE R[VS_MAXB];             /* Rm, cross correlations with the weighted speech */
+  FTYPE D[VS_MAXB][VS_MAXB];    /* Dmj, cross correlations of the basis vectors */
+  FTYPE dd[VS_MAXB];            /* Dmm, energies of the basis vectors */
+  FTYPE sg[VS_MAXB][VS_BLOCKS]; /* sign of each high basis vector per block */
+  FTYPE chi[VS_BLOCKS], ghi[VS_BLOCKS]; /* contribution of the high bits */
+  FTYPE X[VS_MAXB][4];          /* cross terms of the high basis vectors */
+  FTYPE cw[4 * VS_BLOCKS];      /* C of each codeword */
+  FTYPE gw[4 * VS_BLOCKS];      /* G of each codeword */
+  FTYPE cg[4 * VS_BLOCKS];      /* C in the order of the table */
+  FTYPE gg[4 * VS_BLOCKS];      /* G in the order of the table */
+  FTYPE lc2[4], lg[4], lp[4];   /* best C**2, G and position of each lane */
+  FTYPE s0, s1, G, cSave, cSqrdBest, gBest;
+  V4 r0, r1, d0, d1, w, b, clo, glo, c, g, zero, pos, bc2, bg, bp;
+  V4 a00, a01, a02;             /* rows 0..2 of Dmj, lanes j = 0..3 */
+  V4 a10, a11, a12, a13, a14, a15, a16; /* rows 0..6 of Dmj, lanes j = 4..7 */
+  int wordSave, numBlocks, numWords, h, j, k, m, l, p;
+  int *intPtr;
+
+  if (numBasis < 3 || numBasis > VS_MAXB)
+    return V_SRCH (st, wiPtr, wBasisPtr, numBasis);
+
+/*	transpose the weighted basis vectors, unused lanes set to zero*/
+  for (m = 0; m < VS_MAXB; m++)
+    if (m < numBasis)
+      for (k = 0; k < S_LEN; k++)
+        bt[k][m] = wBasisPtr[m * S_LEN + k];
+    else
+      for (k = 0; k < S_LEN; k++)
+        bt[k][m] = 0.0;
+
+/*	Rm, Dmm, and the Dmj of rows m < 3 (lanes j = 0..3) and of all the*/
+/*	rows (lanes j = 4..7), each summed over the samples in order*/
+  r0 = r1 = d0 = d1 = V4_SET1 (0.0);
+  a00 = a01 = a02 = V4_SET1 (0.0);
+  a10 = a11 = a12 = a13 = a14 = a15 = a16 = V4_SET1 (0.0);
+  for (k = 0; k < S_LEN; k++) {
+    w = V4_SET1 (wiPtr[k]);
+    b = V4_LOAD (&bt[k][0]);
+    r0 = V4_ADD (r0, V4_MUL (b, w));
+    d0 = V4_ADD (d0, V4_MUL (b, b));
+    VS_ROW (a00, 0);
+    VS_ROW (a01, 1);
+    VS_ROW (a02, 2);
+    b = V4_LOAD (&bt[k][4]);
+    r1 = V4_ADD (r1, V4_MUL (b, w));
+    d1 = V4_ADD (d1, V4_MUL (b, b));
+    VS_ROW (a10, 0);
+    VS_ROW (a11, 1);
+    VS_ROW (a12, 2);
+    VS_ROW (a13, 3);
+    VS_ROW (a14, 4);
+    VS_ROW (a15, 5);
+    VS_ROW (a16, 6);
+  }
+  V4_STORE (&R[0], r0);
+  V4_STORE (&R[4], r1);
+  V4_STORE (&dd[0], d0);
+  V4_STORE (&dd[4], d1);
+  V4_STORE (&D[0][0], a00);
+  V4_STORE (&D[1][0], a01);
+  V4_STORE (&D[2][0], a02);
+  V4_STORE (&D[0][4], a10);
+  V4_STORE (&D[1][4], a11);
+  V4_STORE (&D[2][4], a12);
+  V4_STORE (&D[3][4], a13);
+  V4_STORE (&D[4][4], a14);
+  V4_STORE (&D[5][4], a15);
+  V4_STORE (&D[6][4], a16);
+  G = 0.0;
+  for (m = 0; m < numBasis; m++)
+    G += dd[m];
+
+/*	contribution of the two low bits, lane l = codeword & 3*/
+  for (l = 0; l < 4; l++) {
+    s0 = (l & 1) ? 1.0 : -1.0;
+    s1 = (l & 2) ? 1.0 : -1.0;
+    cw[l] = s0 * R[0] + s1 * R[1];
+    gw[l] = G + 2 * s0 * s1 * D[0][1];
+    for (j = 2; j < numBasis; j++)
+      X[j][l] = 2 * (s0 * D[0][j] + s1 * D[1][j]);
+  }
+  clo = V4_LOAD (cw);
+  glo = V4_LOAD (gw);
+
+/*	contribution of the high bits, block h = codeword >> 2, four blocks*/
+/*	at a time; the top bit is always zero in the table*/
+  numBlocks = 1 << (numBasis - 3);
+  for (j = 2; j < numBasis; j++)
+    for (h = 0; h < numBlocks; h++)
+      sg[j][h] = (j < numBasis - 1 && (h & (1 << (j - 2)))) ? 1.0 : -1.0;
+  for (h = 0; h < numBlocks; h += 4) {
+    c = g = V4_SET1 (0.0);
+    for (j = 2; j < numBasis; j++) {
+      b = V4_LOAD (&sg[j][h]);
+      c = V4_ADD (c, V4_MUL (b, V4_SET1 (R[j])));
+      for (m = j + 1; m < numBasis; m++)
+        g = V4_ADD (g, V4_MUL (V4_MUL (b, V4_LOAD (&sg[m][h])), V4_SET1 (2 * D[j][m])));
+    }
+    V4_STORE (&chi[h], c);
+    V4_STORE (&ghi[h], g);
+  }
+
+/*	C and G of the four codewords of each block*/
+  for (h = 0; h < numBlocks; h++) {
+    c = V4_ADD (clo, V4_SET1 (chi[h]));
+    g = V4_ADD (glo, V4_SET1 (ghi[h]));
+    for (j = 2; j < numBasis; j++)
+      g = V4_ADD (g, V4_MUL (V4_LOAD (X[j]), V4_SET1 (sg[j][h])));
+    V4_STORE (&cw[4 * h], c);
+    V4_STORE (&gw[4 * h], g);
+  }
+
+/*	C and G in the order of the Gray-code table*/
+  numWords = 1 << (numBasis - 1);
+  cg[0] = cw[0];
+  gg[0] = gw[0];
+  intPtr = st->TABLE;
+  for (p = 1; p < numWords; p++, intPtr += 2) {
+    cg[p] = cw[*intPtr];
+    gg[p] = gw[*intPtr];
+  }
+
+/*	if all G > 0, each lane keeps the first best of the positions*/
+/*	p = l mod 4 of the table, then the first best of the lanes is taken;*/
+/*	otherwise the codewords are compared one by one, as in V_SRCH()*/
+  zero = V4_SET1 (0.0);
+  for (p = 0, l = 1; p < numWords; p += 4)
+    l = l && V4_ALL (V4_GT (V4_LOAD (&gg[p]), zero));
+  if (l) {
+    pos = V4_LOAD (VS_POS);
+    bc2 = V4_MUL (V4_LOAD (cg), V4_LOAD (cg));
+    bg = V4_LOAD (gg);
+    bp = pos;
+    for (p = 4; p < numWords; p += 4) {
+      pos = V4_ADD (pos, V4_SET1 (4.0));
+      c = V4_LOAD (&cg[p]);
+      g = V4_LOAD (&gg[p]);
+      c = V4_MUL (c, c);
+      b = V4_GT (V4_MUL (c, bg), V4_MUL (bc2, g));
+      bc2 = V4_SEL (b, c, bc2);
+      bg = V4_SEL (b, g, bg);
+      bp = V4_SEL (b, pos, bp);
+    }
+    V4_STORE (lc2, bc2);
+    V4_STORE (lg, bg);
+    V4_STORE (lp, bp);
+    for (k = 0, l = 1; l < 4; l++)
+      if (lc2[l] * lg[k] > lc2[k] * lg[l] || (!(lc2[k] * lg[l] > lc2[l] * lg[k]) && lp[l] < lp[k]))
+        k = l;
+    p = (int) lp[k];
+  } else {
+    cSqrdBest = cg[0] * cg[0];
+    gBest = gg[0];
+    for (p = 0, k = 1; k < numWords; k++)
+      if (cg[k] * cg[k] * gBest > cSqrdBest * gg[k]) {
+        cSqrdBest = cg[k] * cg[k];
+        gBest = gg[k];
+        p = k;
+      }
+  }
+  wordSave = p ? st->TABLE[2 * (p - 1)] : 0;
+  cSave = cg[p];
+
+/*	if Cbest is negative, invert codeword*/
+  if (cSave < 0.0)
+    wordSave = wordSave ^ ((1 << numBasis) - 1);
+
+  return wordSave;
+}
@@ -41,6 +41,7 @@ typedef float FTYPE;
 /* Inclusions */
 #include <stdio.h>
 #include <stdlib.h>
+#include "is54.h"
 
 /*-------------------------------------------------------------*/
 /* Parameter definitions */
@@ -52,6 +53,32 @@ typedef float FTYPE;
 #define	PREEMPH	0.0             /* Input speech pre-emphasis coefficient, used in FLATV() */
 #define	SRATE	8000.0          /* The sampling rate in Hertz */
 
+/* Parameters determined by the system rate (formerly set in calcParams()) */
+#define N_SUB	4               /* Number of subframes per frame */
+#define W_ALPHA	((FTYPE) 0.8)   /* Weighting coefficient used to get weighted direct-form coefficients in widen() */
+#define C_BITS	7               /* Number of bits in codeword of 1st codebook */
+#define C_BITS_A	7       /* Number of bits in codeword of 2nd codebook */
+#define PLEN	21              /* Number of samples in truncated impulse response, used in LAG_SEARCH() */
+#define POST_W_D	((FTYPE) 0.8)   /* Weighting coefficient for the post-filter denominator coefficients */
+#define POST_BEQ_N	((FTYPE) 1200)  /* Bandwidth widening factor for the post-filter numerator coefficients */
+#define POST_EMPH	((FTYPE) 0.4)   /* Post-emphasis coefficient used in R_SUB() */
+#define POST_AGC_COEF	((FTYPE) 0.9875)        /* Coefficient which determines the agc time constant in R_SUB() */
+#define GSP0_NUM	256     /* Number of GSP0 centroids */
+#define GSP0_TERMS	9       /* Number of terms in GSP0 quantizer error equation, used in G_QUANT() */
+
+/* Long-term predictor parameters */
+#define LMIN	20              /* Minimum lag value, used in LAG_SEARCH() */
+#define LMAX	146             /* Maximum lag value, used in LAG_SEARCH() */
+
+/* Lengths in samples: frame, analysis (FLATV()), subframe, input buffer */
+#define F_LEN	VSELP_FRAME_LEN
+#define A_LEN	(F_LEN + ALENPL)
+#define S_LEN	(F_LEN / N_SUB)
+#define INBUFSIZ	(F_LEN + A_LEN / 2 - S_LEN / 2)
+
+/* Number of coded parameters in one frame */
+#define numCodes	VSELP_CODES
+
 /*---------------------------------------------------------------*/
 /*	structure definitions */
 #ifndef DONE_STRUCTS
@@ -66,34 +93,86 @@ struct coefSet {
 #endif
 
 /*-------------------------------------------------------------*/
-/* System flags*/
-extern int apply_postfilter, encode_only, decode_only, makeLog, packedStream, performMeas;
-
-/* File pointers */
-extern FILE *fpin, *fpout, *fpcode, *fplog, *fpstream, *fpxtest;
-
-/* Constant externals */
-extern int N_SUB, C_BITS, C_BITS_A, PLEN, LMIN, LMAX;
-extern FTYPE F_TIME, W_ALPHA, POST_W_D, POST_BEQ_N, POST_EMPH, POST_AGC_COEF;
-
-/* These are also constant, but must be calculated. */
-extern int GSP0_TERMS, GSP0_NUM, F_LEN, A_LEN, S_LEN, INBUFSIZ, numCodes;
-
-/* Other externals. */
-extern int *codes, *codeBuf;
-extern FTYPE *inBuf, *I_CBUFF, *RS_BUFF, *COEF, *W_COEF, *N_COEF, RS, *xmtExPtr;
-extern struct coefSet T_NEW, T_OLD, R_NEW, R_OLD;
-
-/* External declarations for allocations to be freed */
-extern FTYPE *sst, *r0kAddr[];  /* from flatv.c */
-extern FTYPE *T_STATE, *T_VEC, *P, *P_VEC, *W_P_VEC, *BASIS, *BASIS_A, *W_BASIS, *BITS, *X_VEC, *W_X_VEC, *X_A_VEC, *W_X_A_VEC, *T_P_STATE, *GSP0_TABLE, *R_P_STATE;
-extern int *TABLE;
-extern FTYPE *P_SST;            /* from A_SST */
-extern FTYPE *outBuf;
-
-/* DIAGnostic variables for debugging */
-extern int frCnt, sfCnt;
-extern char printAll, showr0k, showlag, showcode, showgsp0;
+/* State of one encoder or decoder; the buffers are allocated in */
+/* initTables() and initState(), which also fill the tables */
+struct vselp_state {
+  /* System flags */
+  int performMeas;              /* calculate performance measures in T_SUB() */
+  int apply_postfilter;         /* apply the post-filter in R_SUB() */
+
+  /* Quantization tables for R0 and reflection coefficients (FLATV(), */
+  /* QUANT() and lookup()) and sst coefficients for FLATV() and A_SST() */
+  FTYPE *r0kAddr[NP + 2];
+  FTYPE *sst;
+  FTYPE *P_SST;
+
+  /* Codebook basis vectors, GSP0 quantization table and Gray code */
+  /* table for V_SRCH() */
+  FTYPE *BASIS;
+  FTYPE *BASIS_A;
+  FTYPE *GSP0_TABLE;
+  int *TABLE;
+
+  /* Frame processing */
+  int *codes;                   /* Points to the next spot in the code buffer */
+  int *codeBuf;                 /* Points to the beginning of the code buffer */
+  FTYPE *inBuf;                 /* Input speech buffer */
+  FTYPE *I_CBUFF;               /* Interpolated coef buffer */
+  FTYPE *RS_BUFF;               /* Residual energy estimate (RS) buffer */
+  FTYPE *COEF;                  /* Direct form coefficients for the subframe */
+  FTYPE *W_COEF;                /* Weighted coefficients (transmit side), */
+  /* post-filter denominator coefficients (receive side) */
+  FTYPE *N_COEF;                /* Post-filter numerator coefficients */
+  FTYPE RS;                     /* RS value for the subframe */
+  struct coefSet T_NEW, T_OLD;  /* new and old coefs and Rq on xmit side */
+  struct coefSet R_NEW, R_OLD;  /* new and old coefs and Rq on rcv side */
+  FTYPE *coefBuf;               /* Memory of the four coefficient sets */
+  FTYPE *aPtr;                  /* INTERPOLATE(): current subframe in I_CBUFF */
+  FTYPE *rsPtr;                 /* INTERPOLATE(): next spot in RS_BUFF */
+  FTYPE *intCoefPtr;            /* INTERPOLATE(): next interpolated coef */
+  double hpX[4], hpY[4];        /* FILT4() numerator and denominator states */
+
+  /* Used in both T_SUB() and R_SUB() */
+  FTYPE *T_STATE;               /* Temporary filter state buffer */
+  FTYPE *T_VEC;                 /* Temporary vector buffer */
+  FTYPE *P_VEC;                 /* Pitch excitation vector */
+  FTYPE *X_VEC;                 /* 1st codebook excitation vector */
+  FTYPE *X_A_VEC;               /* 2nd codebook excitation vector */
+  FTYPE *BITS;                  /* 1.0 or -1.0 values for constructing */
+  /* codebook excitation */
+  FTYPE RS00, RS11, RS22;       /* Sqrt(residual energy / energy in the */
+  /* pitch, 1st and 2nd codebook excitations) */
+
+  /* Used only in T_SUB() */
+  FTYPE *P;                     /* Weighted speech */
+  FTYPE *W_P_VEC;               /* Weighted pitch excitation vector */
+  FTYPE *W_BASIS;               /* Weighted basis vectors */
+  FTYPE *W_X_VEC;               /* Weighted 1st codebook excitation vector */
+  FTYPE *W_X_A_VEC;             /* Weighted 2nd codebook excitation vector */
+  FTYPE *T_P_STATE;             /* Long-term predictor state */
+  FTYPE *xmtExPtr;              /* Current subframe's excitation in T_P_STATE */
+  FTYPE *I_PTR;                 /* Current subframe of input speech */
+  FTYPE W_STATE_N[NP];          /* Speech weighting filter numerator state */
+  FTYPE W_STATE_D[NP];          /* Speech weighting filter denominator state */
+  FTYPE SYN_STATE_W[NP];        /* Weighted synthesis filter state */
+  FTYPE tState[NP];             /* Synthesis state for performance analysis */
+
+  /* Performance measures (runningSnr()) */
+  FTYPE sEngTotal, weEngTotal, eEngTotal, sumwSegSnr, sumSegSnr;
+  int numSegs;
+
+  /* Used only in R_SUB() */
+  FTYPE *R_P_STATE;             /* Long-term predictor state */
+  FTYPE *outBuf;                /* Output synthesized speech buffer */
+  FTYPE SYN_STATE[NP];          /* Synthesis filter state */
+  FTYPE POST_STATE_N[NP];       /* Post-filter numerator state */
+  FTYPE POST_STATE_D[NP];       /* Post-filter denominator state */
+  FTYPE POST_STATE_E;           /* Post-emphasis filter state */
+  FTYPE runningGain;            /* Post-filter agc gain */
+
+  /* Frame counter, for the diagnostics */
+  int frCnt;
+};
 
 #endif /* VPARAMS_H */
 /* ........................ End of file VPARAMS.H ........................ */
@@ -69,13 +69,15 @@ Motorola Inc.
   22/Feb/96 v.1.2  Adapted code for operation in a DEC Alpha/APX (after
                    STEGMANN, FI/DBP Telekom)
   02/Feb/10 v.1.3  Modified maximum string length (y.hiwasaki)
+  17/Oct/26 v.1.4  Codec moved to the instance API of is54.c; this is now
+                   only the command line driver. Full prototypes for the
+                   functions with float parameters.
  -------------------------------------------------------------------------
 */
 
 /* Include files */
 #include "vselp.h"
 #include "ugstdemo.h"
-#include "vparams.h"
 
 #ifdef __TURBOC__
 unsigned _stklen = 50000;       /* Set Stack Size for Turbo C */
@@ -86,10 +88,6 @@ unsigned _stklen = 50000;       /* Set Stack Size for Turbo C */
 #define WT "w"                  /* Plain write file definition for fopen() in VMS */
 #endif
 
-/* Global vars for communication with other routines */
-int apply_postfilter, encode_only, decode_only;
-
-
 /* ------------------------------------------------------------------------ */
 long swap_byte (short *shPtr, long n) {
   short *s_Ptr;
@@ -106,31 +104,6 @@ long swap_byte (short *shPtr, long n) {
 /* ......................... End of swap_byte() ............................ */
 
 
-/* ------------------------------------------------------------------------ */
-void initState () {
-
-  T_NEW.k = (FTYPE *) calloc (14 * NP, sizeof (FTYPE)); /* Note: it is */
-  T_NEW.a = T_NEW.k + NP;       /* necessary that these coef sets be */
-  T_NEW.widen = T_NEW.a + NP;   /* stored sequentially. DONT REARRANGE. */
-
-  T_OLD.k = T_NEW.widen + NP;   /* Note: it is necessary that these */
-  T_OLD.a = T_OLD.k + NP;       /* coef sets be stored sequentially. */
-  T_OLD.widen = T_OLD.a + NP;   /* DONT REARRANGE. */
-
-  R_NEW.k = T_OLD.widen + NP;   /* Note: it is necessary that these */
-  R_NEW.a = R_NEW.k + NP;       /* coef sets be stored sequentially. */
-  R_NEW.widen = R_NEW.a + NP;   /* DONT REARRANGE. */
-  R_NEW.sst = R_NEW.widen + NP;
-
-  R_OLD.k = R_NEW.sst + NP;     /* Note: it is necessary that these */
-  R_OLD.a = R_OLD.k + NP;       /* coef sets be stored sequentially. */
-  R_OLD.widen = R_OLD.a + NP;   /* DONT REARRANGE. */
-  R_OLD.sst = R_OLD.widen + NP;
-
-}
-
-/* ......................... End of initState() ............................ */
-
 /* ------------------------------------------------------------------------ */
 void display_usage () {
   printf ("  vselp: version 1.10 of 14/Mar/1994 \n\n");
@@ -176,18 +149,17 @@ void display_usage () {
 /* main program*/
 int main (int argc, char *argv[]) {
   /* Main's automatic variables */
-  FTYPE *coefBuf;               /* Points to memory allocated for T_NEW, T_OLD, R_NEW, and R_OLD coefficient storage */
-  FTYPE RQ_HOLD;                /* Temporary storage for the R0q value to use in the middle subframe on the receive side */
-  FTYPE RQ_TMP;                 /* R0q value that gets passed to RES_ENG() */
-  FTYPE inScale = 1.0 / 32768.0;        /* Scale factor used to convert integer input samples to floating point fractions */
-  int us;                       /* Unstable flag returned by INTERPOLATE(), determines whether another RS will need to be calculated */
+  VSELP_OPTIONS opt;            /* Options and files */
+  VSELP_STATE *enc = NULL;      /* Encoder state */
+  VSELP_STATE *dec = NULL;      /* Decoder state */
+  int codeBuf[numCodes];        /* Coded parameters of one frame */
   short *shBuf;                 /* points to beginning of short I/O buffer */
   FILE *fpprm;                  /* points to parameter set-up file (if given) */
+  int frCnt = 1;                /* Frame counter */
 
-  FTYPE *tmpPtr, *tmpPtr2, *endPtr, f1;
   int i, numRead;
   short *shPtr;
-  long (*get_codes) (), (*put_codes) ();
+  long (*get_codes) (FILE *, int *), (*put_codes) (FILE *, int *);
   long bs_read = 0, bs_saved = 0;
   char use_user_resp_file = 0;  /* Don't use user's response file */
   char InpFile[MAX_STRLEN], OutFile[MAX_STRLEN], LogFile[MAX_STRLEN], PackedFile[MAX_STRLEN];
@@ -207,15 +179,17 @@ int main (int argc, char *argv[]) {
 
 
   /* SETTING DEFAULT OPTIONS */
-  decode_only = 0;              /* run encoder and decoder */
-  encode_only = 0;
-  packedStream = 1;             /* generate HEX-packed bitstreams */
-  performMeas = 1;              /* calculate performance measures */
-  makeLog = 1;
-  apply_postfilter = 0;
+  opt.decode_only = 0;          /* run encoder and decoder */
+  opt.encode_only = 0;
+  opt.packedStream = 1;         /* generate HEX-packed bitstreams */
+  opt.performMeas = 1;          /* calculate performance measures */
+  opt.makeLog = 1;
+  opt.apply_postfilter = 0;
   quiet = 0;
   finalCnt = 0;                 /* always process the complete file */
-  fpin = fpout = fpcode = fplog = fpstream = NULL;
+  opt.fpin = opt.fpout = opt.fpcode = opt.fplog = opt.fpstream = NULL;
+  for (i = 0; i < numCodes; i++)
+    codeBuf[i] = 0;
 
 #ifdef VMS
   sprintf (mrs, "mrs=%d", 512);
@@ -231,7 +205,7 @@ int main (int argc, char *argv[]) {
         /* User response file */
         use_user_resp_file = 1;
         fpprm = fopen (argv[2], "r");
-        getParams (fpprm);
+        getParams (fpprm, &opt);
         fclose (fpprm);
 
         /* Update argc/argv to next valid option/argument */
@@ -239,39 +213,39 @@ int main (int argc, char *argv[]) {
         argc -= 2;
       } else if (strcmp (argv[1], "-dec") == 0) {
         /* Run only the decoder */
-        decode_only = 1;
+        opt.decode_only = 1;
 
         /* Move argv over the option to the next argument */
         argv++;
         argc--;
       } else if (strcmp (argv[1], "-enc") == 0) {
         /* Run only the encoder */
-        encode_only = 1;
+        opt.encode_only = 1;
 
         /* Move argv over the option to the next argument */
         argv++;
         argc--;
       } else if (strcmp (argv[1], "-bin") == 0) {
         /* Save bitstream as an binary, 16-bit-word oriented file */
-        packedStream = 0;
+        opt.packedStream = 0;
 
         /* Move argv over the option to the next argument */
         argv++;
         argc--;
       } else if (strcmp (argv[1], "-hex") == 0) {
         /* Save bitstream as an ascii HEXadecimal file */
-        packedStream = 1;
+        opt.packedStream = 1;
 
         /* Move argv over the option to the next argument */
         argv++;
         argc--;
       } else if (strcmp (argv[1], "-log") == 0) {
         /* Do create log file (default) */
-        makeLog = 1;
+        opt.makeLog = 1;
 
         /* Scan log file name */
         strcpy (LogFile, argv[2]);
-        if ((fplog = fopen (argv[2], "w")) == NULL)
+        if ((opt.fplog = fopen (argv[2], "w")) == NULL)
           HARAKIRI ("ERROR creating log file\n", 2);
 
         /* Move argv over the option to the next argument */
@@ -279,15 +253,15 @@ int main (int argc, char *argv[]) {
         argc -= 2;
       } else if (strcmp (argv[1], "-nolog") == 0) {
         /* Don't create log file */
-        makeLog = 0;
-        fplog = stderr;
+        opt.makeLog = 0;
+        opt.fplog = stderr;
 
         /* Move argv over the option to the next argument */
         argv++;
         argc--;
       } else if (strcmp (argv[1], "-pf") == 0) {
         /* Apply post-filtering in the decoder */
-        apply_postfilter = 1;
+        opt.apply_postfilter = 1;
 
         /* Move argv over the option to the next argument */
         argv++;
@@ -321,78 +295,70 @@ int main (int argc, char *argv[]) {
   /* - dec-only: read inp-bitstream-file out-lin-file logfile */
   if (!use_user_resp_file) {
     i = 1;
-    if (!decode_only && fpin == NULL) {
+    if (!opt.decode_only && opt.fpin == NULL) {
       GET_PAR_S (i, "Input speech file: ........ ", InpFile);
-      if ((fpin = fopen (InpFile, RB)) == NULL)
+      if ((opt.fpin = fopen (InpFile, RB)) == NULL)
         KILL (InpFile, 2);
       i++;
     }
 
-    if (decode_only && fpstream == NULL) {
+    if (opt.decode_only && opt.fpstream == NULL) {
       GET_PAR_S (i, "Input bit-stream file: .... ", InpFile);
       i++;
-      if (packedStream) {
-        if ((fpstream = fopen (InpFile, "r")) == NULL)
+      if (opt.packedStream) {
+        if ((opt.fpstream = fopen (InpFile, "r")) == NULL)
           HARAKIRI ("Error opening code file\n", 2);
       } else {
-        if ((fpstream = fopen (InpFile, RB)) == NULL)
+        if ((opt.fpstream = fopen (InpFile, RB)) == NULL)
           HARAKIRI ("Error opening code file\n", 2);
       }
     }
 
-    if (encode_only && fpstream == NULL) {
+    if (opt.encode_only && opt.fpstream == NULL) {
       GET_PAR_S (i, "Output bit-stream file: ... ", OutFile);
       i++;
-      if (packedStream) {
-        if ((fpstream = fopen (OutFile, "w")) == NULL)
+      if (opt.packedStream) {
+        if ((opt.fpstream = fopen (OutFile, "w")) == NULL)
           HARAKIRI ("Error creating code file\n", 2);
       } else {
-        if ((fpstream = fopen (OutFile, WB)) == NULL)
+        if ((opt.fpstream = fopen (OutFile, WB)) == NULL)
           HARAKIRI ("Error creating code file\n", 2);
       }
     }
 
-    if (!encode_only && fpout == NULL) {
+    if (!opt.encode_only && opt.fpout == NULL) {
       GET_PAR_S (i, "Output speech file: ....... ", OutFile);
-      if ((fpout = fopen (OutFile, WB)) == NULL)
+      if ((opt.fpout = fopen (OutFile, WB)) == NULL)
         KILL (OutFile, 3);
       i++;
     }
 
-    if (makeLog || performMeas && fplog == NULL) {
+    if (opt.makeLog || opt.performMeas && opt.fplog == NULL) {
       GET_PAR_S (i, "Log file name: .............", LogFile);
       i++;
-      fplog = fopen (LogFile, "w");
+      opt.fplog = fopen (LogFile, "w");
     }
   }
 
   /* Define bitstream read/write functions */
-  get_codes = packedStream ? getCodesHex : getCodesBin;
-  put_codes = packedStream ? putCodesHex : putCodesBin;
-
-  /* Initialize parameters that are fixed but need to be calculated */
-  calcParams ();
+  get_codes = opt.packedStream ? getCodesHex : getCodesBin;
+  put_codes = opt.packedStream ? putCodesHex : putCodesBin;
 
-  /* Allocate short data buffer, allocate buffers and fill tables */
+  /* Allocate short data buffer, the encoder and the decoder */
   shBuf = (short *) calloc ((long) F_LEN, sizeof (short));
-  initTables ();
-
-  /* allocation of coefficient space and initialization of pointers into */
-  /* this space */
-  initState ();
+  if (!opt.decode_only && (enc = vselp_init_enc (opt.performMeas)) == NULL)
+    HARAKIRI ("Error creating the encoder\n", 1);
+  if (!opt.encode_only && (dec = vselp_init_dec (opt.apply_postfilter)) == NULL)
+    HARAKIRI ("Error creating the decoder\n", 1);
 
   /* fill input buffer, excluding last frame (this doesn't get high-passed) */
-  if (!decode_only) {
-    fread (shBuf, sizeof (short), INBUFSIZ - F_LEN, fpin);
-    tmpPtr = inBuf;
-    shPtr = shBuf - 1;
+  if (!opt.decode_only) {
+    fread (shBuf, sizeof (short), INBUFSIZ - F_LEN, opt.fpin);
 #if INTEL_FORMAT
-    swap_byte (shPtr, (long) (INBUFSIZ - F_LEN));
+    swap_byte (shBuf, (long) (INBUFSIZ - F_LEN));
 #endif
-    for (endPtr = tmpPtr + INBUFSIZ - F_LEN; tmpPtr < endPtr; tmpPtr++)
-      *tmpPtr = *++shPtr * inScale;
+    vselp_prime (enc, shBuf);
   }
-  FILT4 (inBuf, INBUFSIZ - F_LEN);      /* HPF 1st INBUFSIZ-F_LEN points */
 
   /*-------------------------------------------------------------------------*/
   /* main loop */
@@ -400,144 +366,32 @@ int main (int argc, char *argv[]) {
     if (!quiet)
       fprintf (stderr, "%c\r", funny[frCnt % 8]);
 
-    if (decode_only)
-      goto receiveLabel;
-
-    if (feof (fpin))
-      break;
-
-    /* read one frame into short buffer, scale, and transfer into floating- */
-    /* point input buffer */
-    if ((numRead = fread (shBuf, sizeof (short), F_LEN, fpin)) < F_LEN) {
-      /* Zero-pad the input buffer when no.of samples less than F_LEN */
-      short *eshPtr = shBuf + F_LEN;
-      shPtr = shBuf + numRead;
-      for (; shPtr < eshPtr; shPtr++)
-        *shPtr = 0;
-    }
-    tmpPtr = inBuf + INBUFSIZ - F_LEN;
-    shPtr = shBuf - 1;
-
+    if (!opt.decode_only) {
+      if (feof (opt.fpin))
+        break;
+
+      /* read one frame into short buffer */
+      if ((numRead = fread (shBuf, sizeof (short), F_LEN, opt.fpin)) < F_LEN) {
+        /* Zero-pad the input buffer when no.of samples less than F_LEN */
+        short *eshPtr = shBuf + F_LEN;
+        shPtr = shBuf + numRead;
+        for (; shPtr < eshPtr; shPtr++)
+          *shPtr = 0;
+      }
 #if INTEL_FORMAT
-    swap_byte (shBuf, F_LEN);
+      swap_byte (shBuf, F_LEN);
 #endif
-    for (endPtr = tmpPtr + F_LEN; tmpPtr < endPtr; tmpPtr++)
-      *tmpPtr = *++shPtr * inScale;
-
-    /* ENCODER SIDE */
-    codes = codeBuf;            /* reset code pointer to beginning of buffer */
-
-    /* hpf the last F_LEN of input */
-    FILT4 (inBuf + INBUFSIZ - F_LEN, F_LEN);
-
-    FLATV ();                   /* get reflection coefs and rq0. */
-
-    /* get direct-form coef's from rc's, calculate bandwidth- */
-    /* widened coefs */
-    RCTOA (T_NEW.k, T_NEW.a);
-    widen (W_ALPHA, 't');
-
-    /* This for loop does coefficient interpolation (stored in I_CBUFF) */
-    /* and calculates the residual energy estimate, RS (stored in RS_BUFF), */
-    /* for all subframes.  */
-    for (i = 0; i < N_SUB; i++) {
-      if (i == N_SUB - 1) {
-        /* Final subframe, no interpolation done. Move coefs and */
-        /* calculate RS.  Store a duplicate of RS in RS_BUFF */
-        RQ_TMP = T_NEW.rq0;
-        I_MOV (T_NEW, 2, RQ_TMP);
-        *(RS_BUFF + 2 * N_SUB - 1) = *(RS_BUFF + 2 * N_SUB - 2);        /* copy last rs. */
-      } else if (i * 2 == N_SUB - 2) {
-        /* Middle subframe.  Interpolate coefs.  If result is */
-        /* unstable, use coefs from frame with larger energy. */
-        /* Perform a geometric average on last and current Rq's, */
-        /* use this value to calculate RS. */
-        /* Calculate another RS based on last or current rc's */
-        /* (if it has not been calculated already due to instability, */
-        /* if that is so, just copy it). */
-        RQ_TMP = sqrt (T_NEW.rq0 * T_OLD.rq0);
-
-        if (T_NEW.rq0 > T_OLD.rq0) {
-          us = INTERPOLATE (T_NEW, 2, T_OLD, i, RQ_TMP);
-          if (us)
-            *(RS_BUFF + 2 * i + 1) = *(RS_BUFF + 2 * i);
-          else
-            *(RS_BUFF + 2 * i + 1) = RES_ENG (RQ_TMP, T_NEW.k);
-        } else {
-          us = INTERPOLATE (T_OLD, 2, T_NEW, i, RQ_TMP);
-          if (us)
-            *(RS_BUFF + 2 * i + 1) = *(RS_BUFF + 2 * i);
-          else
-            *(RS_BUFF + 2 * i + 1) = RES_ENG (RQ_TMP, T_OLD.k);
-        }
-      } else if (i * 2 < N_SUB - 2) {
-        /* Subframe closer to last frame.  Interpolate coefs. */
-        /* If result is unstable, use last frame's coefs. */
-        /* Calculate RS based on last frame's Rq.  Calculate */
-        /* another RS based on last rc's (if it has */
-        /* not been calculated already due to instability, if that */
-        /* is so, just copy it) */
-        RQ_TMP = T_OLD.rq0;
-        us = INTERPOLATE (T_OLD, 2, T_NEW, i, RQ_TMP);
-        if (us)
-          *(RS_BUFF + 2 * i + 1) = *(RS_BUFF + 2 * i);
-        else
-          *(RS_BUFF + 2 * i + 1) = RES_ENG (RQ_TMP, T_OLD.k);
-      } else {
-        /* Subframe closer to current frame.  Interpolate coefs. */
-        /* If result is unstable, use current frame's coefs. */
-        /* Calculate RS based on current frame's Rq.  Calculate */
-        /* another RS based on current rc's (if it has */
-        /* not been calculated already due to instability, if that */
-        /* is so, just copy it) */
-        RQ_TMP = T_NEW.rq0;
-        us = INTERPOLATE (T_NEW, 2, T_OLD, i, RQ_TMP);
-        if (us)
-          *(RS_BUFF + 2 * i + 1) = *(RS_BUFF + 2 * i);
-        else
-          *(RS_BUFF + 2 * i + 1) = RES_ENG (RQ_TMP, T_NEW.k);
-      }
-    }
-
-    for (i = 0; i < N_SUB; i++) {
-      sfCnt = i + 1;
-      /* Load/point-to the values that */
-      /* are needed in the subframe processing. */
-      RS = *(RS_BUFF + i * 2);
-      COEF = I_CBUFF + i * 2 * NP;
-      W_COEF = COEF + NP;
 
-      T_SUB (i);                /* Do subframe processing. */
-    }
+      /* ENCODER SIDE */
+      vselp_encode (enc, shBuf, codeBuf);
 
-    /* perform delay on input buffer. */
-    tmpPtr2 = inBuf + F_LEN - 1;
-    tmpPtr = inBuf;
-    for (endPtr = tmpPtr + (INBUFSIZ - F_LEN); tmpPtr < endPtr; tmpPtr++)
-      *tmpPtr = *++tmpPtr2;
-
-    /* update xmt old values and pointers, */
-    /* new pointers set to old space. */
-    T_OLD.rq0 = T_NEW.rq0;
-    tmpPtr = T_OLD.k;
-    T_OLD.k = T_NEW.k;
-    T_NEW.k = tmpPtr;
-    tmpPtr = T_OLD.a;
-    T_OLD.a = T_NEW.a;
-    T_NEW.a = tmpPtr;
-    tmpPtr = T_OLD.widen;
-    T_OLD.widen = T_NEW.widen;
-    T_NEW.widen = tmpPtr;
-
-    /* output routine for packed ascii-hex output. */
-    if (encode_only)
-      bs_saved += put_codes (fpstream, codeBuf);
-
-  receiveLabel:
-    if (decode_only) {
-      if ((i = get_codes (fpstream, codeBuf)) == 0) {
+      /* output routine for packed ascii-hex output. */
+      if (opt.encode_only)
+        bs_saved += put_codes (opt.fpstream, codeBuf);
+    } else {
+      if ((i = get_codes (opt.fpstream, codeBuf)) == 0) {
         /* Quit on end of file OR abort on error */
-        if (feof (fpstream))
+        if (feof (opt.fpstream))
           break;
         else
           HARAKIRI ("Error reading bitstream file\n", 3);
@@ -546,102 +400,29 @@ int main (int argc, char *argv[]) {
     }
 
     /* output routine for diagnostic code output */
-    if (makeLog)
-      putCodesLog ();
-
-
-    /*------------------------------------------------------------------------*/
-    /* --- DECODER SIDE --- */
-    if (!encode_only) {
-      /* get Rq0 and rc's from codes */
-      codes = codeBuf;
-      R_NEW.rq0 = lookup (0);
-      tmpPtr = R_NEW.k;
-      for (endPtr = tmpPtr + NP, i = 1; tmpPtr < endPtr; tmpPtr++, i++)
-        *tmpPtr = lookup (i);
-
-      /* get direct-form coef's from rc's, calculate bandwidth- */
-      /* widened coefs (denominator of spectral post-filter) and spectrally- */
-      /* smoothed numerator coefs. */
-      RCTOA (R_NEW.k, R_NEW.a);
-      widen (POST_W_D, 'r');
-      A_SST (R_NEW.widen, R_NEW.sst);
-
-      /* Calculate geometric average of Rq0's. */
-      RQ_HOLD = sqrt (R_NEW.rq0 * R_OLD.rq0);
-
-      /* Calculate interpolated coefs for all subframes */
-      for (i = 0; i < N_SUB; i++) {
-        if (i == N_SUB - 1)
-          I_MOV (R_NEW, 3, R_NEW.rq0);
-        else if (i * 2 == N_SUB - 2) {
-          if (R_NEW.rq0 > R_OLD.rq0)
-            INTERPOLATE (R_NEW, 3, R_OLD, i, RQ_HOLD);
-          else
-            INTERPOLATE (R_OLD, 3, R_NEW, i, RQ_HOLD);
-        } else if (i * 2 < N_SUB - 2)
-          INTERPOLATE (R_OLD, 3, R_NEW, i, R_OLD.rq0);
-        else
-          INTERPOLATE (R_NEW, 3, R_OLD, i, R_NEW.rq0);
-      }
+    if (opt.makeLog)
+      putCodesLog (opt.fplog, frCnt, codeBuf);
 
-      for (i = 0; i < N_SUB; i++) {
-        sfCnt = i + 1;
-        /* Load/point-to values needed for */
-        /* subframe processing. */
-        RS = *(RS_BUFF + 2 * i);
-        COEF = I_CBUFF + i * 3 * NP;
-        W_COEF = COEF + NP;
-        N_COEF = W_COEF + NP;
-
-        R_SUB ();               /* Do subframe processing. */
-
-        /* Scale and transfer synthesized speech to short buffer.  Write to */
-        /* output file. */
-        tmpPtr = outBuf;
-        shPtr = shBuf - 1;
-        for (endPtr = tmpPtr + S_LEN; tmpPtr < endPtr; tmpPtr++) {
-          if (*tmpPtr >= 0.0) {
-            f1 = *tmpPtr * 32768.0 + 0.5;
-            *++shPtr = (f1 >= 32768.0) ? 32767 : (short) f1;
-          } else {
-            f1 = *tmpPtr * 32768.0 - 0.5;
-            *++shPtr = (f1 <= -32769.0) ? -32768 : (short) f1;
-          }
-        }
-        fwrite (shBuf, sizeof (short), S_LEN, fpout);
-      }
+    /* DECODER SIDE */
+    if (!opt.encode_only) {
+      vselp_decode (dec, codeBuf, shBuf);
+      fwrite (shBuf, sizeof (short), F_LEN, opt.fpout);
     }
 
-    /* update rcv pointers */
-    R_OLD.rq0 = R_NEW.rq0;
-    tmpPtr = R_OLD.k;
-    R_OLD.k = R_NEW.k;
-    R_NEW.k = tmpPtr;
-    tmpPtr = R_OLD.a;
-    R_OLD.a = R_NEW.a;
-    R_NEW.a = tmpPtr;
-    tmpPtr = R_OLD.widen;
-    R_OLD.widen = R_NEW.widen;
-    R_NEW.widen = tmpPtr;
-    tmpPtr = R_OLD.sst;
-    R_OLD.sst = R_NEW.sst;
-    R_NEW.sst = tmpPtr;
-
     if (frCnt == finalCnt) {
       break;
     }
     frCnt++;
   }                             /* main loop end */
 
-  if (performMeas && !decode_only)
-    printSnr (fplog);
+  if (opt.performMeas && !opt.decode_only)
+    vselp_print_snr (enc, opt.fplog);
 
   frCnt--;
 
-  if (encode_only) {
+  if (opt.encode_only) {
     fprintf (stderr, "VSELP: %ld input samples encoded as %ld IS54 codes\n", (long) frCnt * (long) F_LEN, bs_saved);
-  } else if (decode_only) {
+  } else if (opt.decode_only) {
     fprintf (stderr, "VSELP: %ld IS54 codes generated %ld output samples\n", bs_read, (long) frCnt * (long) F_LEN);
   } else {
     fprintf (stderr, "VSELP: %ld samples processed\n", (long) frCnt * (long) F_LEN);
@@ -649,8 +430,8 @@ int main (int argc, char *argv[]) {
 
   /* Free memory */
   free (shBuf);
-  free (T_NEW.k);
-  freeSpace ();
+  vselp_delete (enc);
+  vselp_delete (dec);
 
 #ifdef VMS
   /*
@@ -660,7 +441,7 @@ int main (int argc, char *argv[]) {
   if ((((long) frCnt * (long) F_LEN) % 256) != 0) {
     zero_values = 256 - (((long) frCnt * (long) F_LEN) % 256);
     zero_vector = (short *) calloc (zero_values, sizeof (short));
-    lwrite = fwrite (zero_vector, sizeof (short), zero_values, fpout);
+    lwrite = fwrite (zero_vector, sizeof (short), zero_values, opt.fpout);
     if (lwrite != zero_values) {
       printf (" Error writing zero vector \n");
       exit (1);
@@ -669,16 +450,16 @@ int main (int argc, char *argv[]) {
 #endif
 
   /* Close files, if open */
-  if (fpin)
-    fclose (fpin);
-  if (fpout)
-    fclose (fpout);
-  if (fpcode)
-    fclose (fpcode);
-  if (fplog)
-    fclose (fplog);
-  if (fpstream)
-    fclose (fpstream);
+  if (opt.fpin)
+    fclose (opt.fpin);
+  if (opt.fpout)
+    fclose (opt.fpout);
+  if (opt.fpcode)
+    fclose (opt.fpcode);
+  if (opt.fplog)
+    fclose (opt.fplog);
+  if (opt.fpstream)
+    fclose (opt.fpstream);
 
   /* Return OK status to the OS */
   return 0;
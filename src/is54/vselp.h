@@ -23,10 +23,11 @@ Motorola Inc.
 
   ************************************************************************* */
 /*-------------------------------------------------------------------------*/
-/*	vselp.h -- function declarations, external variable declarations */
-/*			and definitions for vselp.c. */
+/*	vselp.h -- function declarations for vselp.c and the modules of */
+/*			the instance API (is54.c). */
 /*	Written by: Matt Hartman */
 /*	Date: July 3, 1990. */
+/*	17.Oct.2026: full prototypes; state passed in a VSELP_STATE */
 /*-------------------------------------------------------------------------*/
 
 #ifndef VSELP_H
@@ -36,79 +37,54 @@ Motorola Inc.
 #include <math.h>
 #include "vparams.h"            /* needed for struct definitions.  */
 
+/*-------------------------------------------------------------------------*/
+/* Options and files of the vselp program, set in main() or getParams() */
+typedef struct {
+  int decode_only, encode_only;
+  int packedStream, performMeas, makeLog, apply_postfilter;
+  FILE *fpin, *fpout, *fpcode, *fplog, *fpstream;
+} VSELP_OPTIONS;
+
 /*-------------------------------------------------------------------------*/
 /* Function declarations ...  */
 /* ... from getParams.c */
-void getParams ();
-/*FILE *fpget */
-
-/* ... from calcParams.c */
-void calcParams ();
+void getParams (FILE * fpget, VSELP_OPTIONS * opt);
 
 /* ... from initTables.c */
-void initTables ();
+void initTables (VSELP_STATE * st);
 
 /* ... from filt4.c */
-void FILT4 ();
-/*FTYPE *inPtr, int len */
+void FILT4 (VSELP_STATE * st, FTYPE * inPtr, int len);
 
 /* ... from flatv.c */
-void FLATV ();
-FTYPE lookup ();
-/*int i */
+void FLATV (VSELP_STATE * st);
+FTYPE lookup (VSELP_STATE * st, int i);
 
 /* ... from paramConv.c */
-int ATORC ();
-/*FTYPE *a, FTYPE *k */
-int RCTOA ();
-/*FTYPE *k, FTYPE *a */
+int ATORC (FTYPE * a, FTYPE * k);
+int RCTOA (FTYPE * k, FTYPE * a);
 
 /* ... from interpolate.c */
-int INTERPOLATE ();
-/*struct coefSet defCoefs,
-		int numSets,
-		struct coefSet oCoefs,
-		int i,
-		FTYPE rq0 */
-
-void I_MOV ();
-/*struct coefSet defSet,
-	  int numSets,
-	  FTYPE	rq0 */
-
-FTYPE RES_ENG ();
-/*FTYPE rq0, FTYPE *k */
+int INTERPOLATE (VSELP_STATE * st, struct coefSet defCoefs, int numSets, struct coefSet oCoefs, int i, FTYPE rq0);
+void I_MOV (VSELP_STATE * st, struct coefSet defSet, int numSets, FTYPE rq0);
+FTYPE RES_ENG (FTYPE rq0, FTYPE * k);
 
 /* ... from t_sub.c */
-void T_SUB ();
-/*int sfIndex */
+void T_SUB (VSELP_STATE * st, int sfIndex);
 
 /* ... from putCodesEtc.c */
-long putCodesHex ();
-long putCodesBin ();
-/*int *paramP */
-long getCodesHex ();
-long getCodesBin ();
-/*int *codePtr */
-void putCodesLog ();
+long putCodesHex (FILE * fpstream, int *paramP);
+long putCodesBin (FILE * fpstream, int *codePtr);
+long getCodesHex (FILE * fpcode, int *codePtr);
+long getCodesBin (FILE * fpcode, int *codePtr);
+void putCodesLog (FILE * fplog, int frCnt, int *codeBuf);
 
 /* ... from makeCoefs.c */
-void widen ();
-/*FTYPE lambda, char side */
-void A_SST ();
-/*FTYPE *wCoefPtr, FTYPE *ssCoefPtr */
+void widen (VSELP_STATE * st, FTYPE lambda, char side);
+void A_SST (VSELP_STATE * st, FTYPE * wCoefPtr, FTYPE * ssCoefPtr);
 
 /* ... from r_sub.c */
-void R_SUB ();
-
-/* ... from weightedSnr.c */
-void printSnr ();
-
-/* ... from freeSpace.c */
-void freeSpace ();
-
-/* external definitions */
-#include "edef.i"
+void R_SUB (VSELP_STATE * st);
 
 #endif /* VSELP_H */
 /* ......................... End of file vselp.h ........................... */
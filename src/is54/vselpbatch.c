@@ -0,0 +1,304 @@
+/*                                                         v1.1 - 17/Oct/2026
+  ============================================================================
+
+  VSELPBATCH.C
+  ~~~~~~~~~~~~
+
+  Description:
+  ~~~~~~~~~~~~
+
+  Batch driver for the IS54 VSELP speech coder: encodes or decodes all the
+  files of a list with a pool of worker threads, and reports the aggregate
+  throughput. Every file has its own encoder or decoder state (is54.h), so
+  the files of all the threads are processed at the same time.
+
+  The output files are identical to the ones of uvselp -enc and
+  uvselp -dec with the same -bin/-hex and -pf options.
+
+  The list file has one pair "InpFile OutFile" per line; "#" starts a
+  comment. Every thread takes the next file of the list as soon as it is
+  free (see ugst-batch.c).
+
+  Usage:
+  ~~~~~~
+  $ vselpbatch [-options] ListFile
+
+  Options:
+  -enc        Encode the listed speech files (default)
+  -dec        Decode the listed bitstream files
+  -hex        Bitstreams as ascii hex files (default)
+  -bin        Bitstreams as binary, 16-bit-word oriented files
+  -pf         Use the post-filter in the decoder
+  -threads #  Number of worker threads. Default is 4
+  -q          Quiet operation: only the summary is printed
+  -h/-help    print help message
+
+  Output:
+  ~~~~~~~
+  One CSV line per file (file,output,frames,status), in the order of the
+  list, followed by the number of files, the audio duration, the
+  wall-clock and CPU times and the speed relative to real time.
+
+  Exit value:
+  ~~~~~~~~~~~
+  0 when all the files were processed, 1 otherwise.
+
+  History:
+  ~~~~~~~~
+  17.Oct.26  v1.0       Created.
+  17.Oct.26  v1.1       List, threads and clock from ugst-batch.c; the
+                        files are taken from a shared queue.
+  ============================================================================
+*/
+
+
+/* ..... General definitions for UGST demo programs ..... */
+#include "ugstdemo.h"
+
+/* ..... General include ..... */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* ..... VSELP module definitions ..... */
+#include "vselp.h"
+
+/* ..... Batch processing of lists of files ..... */
+#include "ugst-batch.h"
+
+/* Parameters common to all the files of a batch */
+typedef struct {
+  int decode;                   /* 0 for encoding, 1 for decoding */
+  int packedStream;             /* 1 for ascii hex bitstreams, 0 for binary */
+  int postfilter;               /* 1 to apply the post-filter */
+} VSB_PARAM;
+
+/* One file of a batch */
+typedef struct {
+  char *FileIn, *FileOut;
+  long frames;                  /* processed frames */
+  int status;                   /* UGST_BATCH_OK, or an error status */
+} VSB_JOB;
+
+/* Data shared by the worker threads */
+typedef struct {
+  VSB_PARAM *par;
+  VSB_JOB *job;
+} VSB_BATCH;
+
+
+void display_usage () {
+  printf ("\n\n");
+  printf ("\n***************************************************************");
+  printf ("\n* BATCH PROCESSING OF THE IS54 VSELP SPEECH CODER             *");
+  printf ("\n***************************************************************\n\n");
+
+  printf ("USAGE: \n");
+  printf ("  vselpbatch [-enc|-dec] [-hex|-bin] [-pf] [-threads #] [-q] ListFile\n\n");
+  printf ("  ListFile has one pair \"InpFile OutFile\" per line.\n\n");
+
+  exit (-128);
+}
+
+/* .................... End of display_usage() ........................... */
+
+
+/*
+  ============================================================================
+
+       void process_file (VSB_PARAM *par, VSB_JOB *job);
+       ~~~~~~~~~~~~~~~~~
+
+       Encodes or decodes one file of the list with its own state, in the
+       same way as the main loop of vselp.c.
+
+       Log of changes
+       ~~~~~~~~~~~~~~
+       17.Oct.26	v1.0	Creation.
+
+  ============================================================================
+*/
+void process_file (VSB_PARAM * par, VSB_JOB * job) {
+  VSELP_STATE *st;
+  FILE *Fi, *Fo;
+  short shBuf[VSELP_FRAME_LEN];
+  int codeBuf[VSELP_CODES];
+  long (*get_codes) (FILE *, int *), (*put_codes) (FILE *, int *);
+  size_t numRead;
+  int i;
+
+  get_codes = par->packedStream ? getCodesHex : getCodesBin;
+  put_codes = par->packedStream ? putCodesHex : putCodesBin;
+
+  /* The bitstreams in hex format are text files */
+  if ((Fi = fopen (job->FileIn, (par->decode && par->packedStream) ? "r" : RB)) == NULL) {
+    job->status = UGST_BATCH_OPEN_ERROR;
+    return;
+  }
+  if ((Fo = fopen (job->FileOut, (!par->decode && par->packedStream) ? "w" : WB)) == NULL) {
+    job->status = UGST_BATCH_CREATE_ERROR;
+    fclose (Fi);
+    return;
+  }
+  st = par->decode ? vselp_init_dec (par->postfilter) : vselp_init_enc (0);
+  if (st == NULL) {
+    job->status = UGST_BATCH_STATE_ERROR;
+    fclose (Fi);
+    fclose (Fo);
+    return;
+  }
+  memset (shBuf, 0, sizeof (shBuf));
+  memset (codeBuf, 0, sizeof (codeBuf));
+
+  if (!par->decode) {
+    /* Look-ahead, then frames until the end of file, the last one padded */
+    fread (shBuf, sizeof (short), VSELP_DELAY, Fi);
+    vselp_prime (st, shBuf);
+    while (!feof (Fi)) {
+      numRead = fread (shBuf, sizeof (short), VSELP_FRAME_LEN, Fi);
+      for (i = (int) numRead; i < VSELP_FRAME_LEN; i++)
+        shBuf[i] = 0;
+      vselp_encode (st, shBuf, codeBuf);
+      job->frames++;
+      if (put_codes (Fo, codeBuf) == 0) {
+        job->status = UGST_BATCH_WRITE_ERROR;
+        break;
+      }
+    }
+  } else {
+    while (get_codes (Fi, codeBuf) != 0) {
+      vselp_decode (st, codeBuf, shBuf);
+      job->frames++;
+      if (fwrite (shBuf, sizeof (short), VSELP_FRAME_LEN, Fo) != VSELP_FRAME_LEN) {
+        job->status = UGST_BATCH_WRITE_ERROR;
+        break;
+      }
+    }
+  }
+
+  vselp_delete (st);
+  fclose (Fi);
+  if (fclose (Fo) != 0 && job->status == UGST_BATCH_OK)
+    job->status = UGST_BATCH_WRITE_ERROR;
+}
+
+/* ...................... End of process_file() ........................... */
+
+
+/* Worker: codes the files handed out by the pool */
+static void batch_worker (UGST_BATCH * b) {
+  VSB_BATCH *data = (VSB_BATCH *) b->data;
+  long i;
+
+  while ((i = ugst_batch_next (b)) >= 0)
+    process_file (data->par, &data->job[i]);
+}
+
+
+/*
+**************************************************************************
+***                                                                    ***
+***        Batch program for encoding or decoding lists of files       ***
+***                                                                    ***
+**************************************************************************
+*/
+int main (int argc, char *argv[]) {
+  VSB_PARAM par;
+  VSB_BATCH data;
+  UGST_BATCH b;
+  UGST_BATCH_FILE *files;
+  VSB_JOB *job;
+  long njob, frames = 0, i;
+  int threads = 4, fail = 0;
+  char quiet = 0;
+  double t0, wall, cpu, audio;
+  clock_t c0;
+
+  par.decode = 0;
+  par.packedStream = 1;
+  par.postfilter = 0;
+
+  /* GETTING OPTIONS */
+  if (argc < 2)
+    display_usage ();
+  while (argc > 1 && argv[1][0] == '-')
+    if (strcmp (argv[1], "-enc") == 0 || strcmp (argv[1], "-dec") == 0) {
+      par.decode = argv[1][1] == 'd';
+      argv++;
+      argc--;
+    } else if (strcmp (argv[1], "-hex") == 0 || strcmp (argv[1], "-bin") == 0) {
+      par.packedStream = argv[1][1] == 'h';
+      argv++;
+      argc--;
+    } else if (strcmp (argv[1], "-pf") == 0) {
+      par.postfilter = 1;
+      argv++;
+      argc--;
+    } else if (strcmp (argv[1], "-q") == 0) {
+      quiet = 1;
+      argv++;
+      argc--;
+    } else if (strcmp (argv[1], "-threads") == 0 && argc > 2) {
+      threads = atoi (argv[2]);
+      if (threads < 1 || threads > UGST_BATCH_MAX_THREADS) {
+        fprintf (stderr, "ERROR! Invalid number of threads \"%s\" (1..%d)\n\n", argv[2], UGST_BATCH_MAX_THREADS);
+        display_usage ();
+      }
+      argv += 2;
+      argc -= 2;
+    } else if (strcmp (argv[1], "-h") == 0 || strcmp (argv[1], "-help") == 0) {
+      display_usage ();
+    } else {
+      fprintf (stderr, "ERROR! Invalid option \"%s\" in command line\n\n", argv[1]);
+      display_usage ();
+    }
+  if (argc != 2)
+    display_usage ();
+
+  /* Read the list of files */
+  if ((njob = ugst_batch_read_list (argv[1], &files)) < 0)
+    exit (1);
+  if ((job = (VSB_JOB *) calloc (njob + 1, sizeof (VSB_JOB))) == NULL)
+    HARAKIRI ("Can't allocate memory for the list of files\n", 1);
+  for (i = 0; i < njob; i++) {
+    job[i].FileIn = files[i].FileIn;
+    job[i].FileOut = files[i].FileOut;
+  }
+
+  /* Run the workers */
+  data.par = &par;
+  data.job = job;
+  t0 = ugst_batch_clock ();
+  c0 = clock ();
+  if ((threads = ugst_batch_run (&b, njob, threads, batch_worker, &data)) < 0)
+    HARAKIRI ("Unable to create thread\n", 1);
+  wall = ugst_batch_clock () - t0;
+  cpu = (double) (clock () - c0) / CLOCKS_PER_SEC;
+
+  /* Report, in the order of the list */
+  if (!quiet)
+    printf ("file,output,frames,status\n");
+  for (i = 0; i < njob; i++) {
+    if (!quiet)
+      printf ("%s,%s,%ld,%s\n", job[i].FileIn, job[i].FileOut, job[i].frames, ugst_batch_status (job[i].status));
+    if (job[i].status != UGST_BATCH_OK) {
+      if (quiet)
+        fprintf (stderr, "%s: %s\n", job[i].FileIn, ugst_batch_status (job[i].status));
+      fail++;
+    }
+    frames += job[i].frames;
+  }
+  audio = (double) frames *VSELP_FRAME_LEN / 8000.0;
+  printf ("# %s %ld files (%d failed), %ld frames, %.1f s of audio, %d threads\n", par.decode ? "Decoded" : "Encoded", njob, fail, frames, audio, threads);
+  printf ("# wall %.3f s, cpu %.3f s", wall, cpu);
+  if (wall > 0)
+    printf (", %.1f x real time", audio / wall);
+  printf ("\n");
+
+  free (job);
+  free (files);
+  return fail ? 1 : 0;
+}
+
+/* ............................. end of main() ............................. */
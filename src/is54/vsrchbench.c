@@ -0,0 +1,236 @@
+/*                                                         v1.1 - 17/Oct/2026
+  ============================================================================
+
+  VSRCHBENCH.C
+  ~~~~~~~~~~~~
+
+  Description:
+  ~~~~~~~~~~~~
+
+  Benchmark and equivalence check of the VSELP codebook searches of the
+  IS54 encoder: V_SRCH() (reference, Gray-code recursion) and V_SRCHV()
+  (vectorized). Pseudo-random weighted speech subframes and weighted basis
+  vectors are searched with both versions; the codewords must be
+  identical. Some degenerate cases (zero speech, zero basis vectors,
+  repeated basis vectors) are also included.
+
+  V_SRCHV() computes C and G directly rather than by the recursion of
+  V_SRCH(), so the two may round differently and, for two codewords of
+  nearly equal C**2/G, choose differently. The speech files given with
+  -check are therefore encoded, and both searches are compared on every
+  subframe (both codebooks); the encoding goes on with the codeword of
+  V_SRCH(). This needs the encoder of this program, which is compiled
+  with IS54_CHECK_VSRCH.
+
+  The time is reported per search and per subframe (two searches, one in
+  each codebook).
+
+  Usage:
+  ~~~~~~
+  $ vsrchbench [-options] [file ...]
+
+  where:
+  file ......... 16-bit speech files (host byte order, as uvselp) to be
+                 encoded with -check
+
+  Options:
+  -n N ......... number of searches [default: 1000000]
+  -check ....... only check the searches (no timing), and return a
+                 non-zero exit code if any codeword differs
+
+  History:
+  ~~~~~~~~
+  17.Oct.26  v1.0       Created.
+  17.Oct.26  v1.1       -check compares the searches on every subframe of
+                        the speech files given.
+  ============================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "t_sub.h"
+
+#define N_SETS 256              /* distinct speech/basis sets */
+
+typedef struct {
+  FTYPE wi[S_LEN];
+  FTYPE wBasis[C_BITS * S_LEN];
+} SEARCH_SET;
+
+typedef int (*CBSEARCH) (VSELP_STATE *, FTYPE *, FTYPE *, int);
+
+/* Searches of the encoder compared by V_SRCHC(), and differences */
+static long n_check = 0, n_differ = 0;
+static char *check_file;
+static long check_frame;
+
+
+/* Codebook search of the encoder (IS54_CHECK_VSRCH): both searches,
+   compared; returns the codeword of the reference */
+int V_SRCHC (VSELP_STATE * st, FTYPE * wiPtr, FTYPE * wBasisPtr, int numBasis) {
+  int code_ref, code;
+
+  code_ref = V_SRCH (st, wiPtr, wBasisPtr, numBasis);
+  code = V_SRCHV (st, wiPtr, wBasisPtr, numBasis);
+  n_check++;
+  if (code != code_ref) {
+    if (n_differ < 10)
+      fprintf (stderr, "%s, frame %ld: codeword %d instead of %d\n", check_file, check_frame, code, code_ref);
+    n_differ++;
+  }
+  return code_ref;
+}
+
+
+/* Encode a speech file, checking every codebook search; returns 0 if
+   the file can't be read */
+int check_file_search (char *file) {
+  short buf[F_LEN];
+  int code_buf[numCodes];
+  VSELP_STATE *enc;
+  FILE *fp;
+  size_t n;
+
+  if ((fp = fopen (file, "rb")) == NULL) {
+    perror (file);
+    return 0;
+  }
+  if ((enc = vselp_init_enc (0)) == NULL) {
+    fprintf (stderr, "Can't allocate an encoder\n");
+    fclose (fp);
+    return 0;
+  }
+  check_file = file;
+
+  /* Same framing as uvselp: the first samples prime the input buffer,
+     the last frame is zero-padded */
+  memset (buf, 0, sizeof (buf));
+  fread (buf, sizeof (short), INBUFSIZ - F_LEN, fp);
+  vselp_prime (enc, buf);
+  for (check_frame = 0; !feof (fp); check_frame++) {
+    n = fread (buf, sizeof (short), F_LEN, fp);
+    memset (buf + n, 0, (F_LEN - n) * sizeof (short));
+    vselp_encode (enc, buf, code_buf);
+  }
+  vselp_delete (enc);
+  fclose (fp);
+  return 1;
+}
+
+
+/* Run n searches over the sets; returns the CPU time */
+double run_search (CBSEARCH f, VSELP_STATE * st, SEARCH_SET * set, long n, int *code) {
+  long i;
+  clock_t t0;
+
+  t0 = clock ();
+  for (i = 0; i < n; i++)
+    code[i % N_SETS] = f (st, set[i % N_SETS].wi, set[i % N_SETS].wBasis, C_BITS);
+  return (double) (clock () - t0) / CLOCKS_PER_SEC;
+}
+
+
+void display_usage () {
+  printf ("VSRCHBENCH.C - Version 1.1 of 17.Oct.2026\n\n");
+  printf (" Benchmark and equivalence check of the IS54 VSELP codebook searches.\n\n");
+  printf (" Usage:\n");
+  printf (" $ vsrchbench [-options] [file ...]\n\n");
+  printf (" where:\n");
+  printf ("  file ....... 16-bit speech files encoded with -check\n\n");
+  printf (" Options:\n");
+  printf ("  -n N ....... number of searches [default: 1000000]\n");
+  printf ("  -check ..... only check the searches, no timing, and also on\n");
+  printf ("               every subframe of the speech files\n");
+  exit (-128);
+}
+
+
+int main (int argc, char *argv[]) {
+  static SEARCH_SET set[N_SETS];
+  int code_ref[N_SETS], code[N_SETS];
+  long n = 1000000L, lcg = 12345, fail = 0;
+  int s, k, check = 0;
+  double cpu_ref, cpu_v;
+  VSELP_STATE *st;
+
+  /* Get options */
+  while (argc > 1 && argv[1][0] == '-')
+    if (strcmp (argv[1], "-n") == 0 && argc > 2) {
+      n = atol (argv[2]);
+      argc -= 2;
+      argv += 2;
+    } else if (strcmp (argv[1], "-check") == 0) {
+      check = 1;
+      argc--;
+      argv++;
+    } else if (strcmp (argv[1], "-h") == 0 || strcmp (argv[1], "-?") == 0) {
+      display_usage ();
+    } else {
+      fprintf (stderr, "ERROR! Invalid option \"%s\" in command line\n\n", argv[1]);
+      display_usage ();
+    }
+  if (argc > 1 && !check) {
+    fprintf (stderr, "ERROR! Speech files are only encoded with -check\n\n");
+    display_usage ();
+  }
+  if (check || n < N_SETS)
+    n = N_SETS;
+
+  /* The Gray-code table of an encoder */
+  if ((st = vselp_init_enc (0)) == NULL) {
+    fprintf (stderr, "Can't allocate an encoder\n");
+    return 1;
+  }
+
+  /* Pseudo-random sets, with a few degenerate ones */
+  for (s = 0; s < N_SETS; s++) {
+    for (k = 0; k < S_LEN; k++) {
+      lcg = (lcg * 1103515245 + 12345) & 0x7FFFFFFF;
+      set[s].wi[k] = (FTYPE) ((lcg >> 8) - (1L << 22)) / (1L << 12);
+    }
+    for (k = 0; k < C_BITS * S_LEN; k++) {
+      lcg = (lcg * 1103515245 + 12345) & 0x7FFFFFFF;
+      set[s].wBasis[k] = (FTYPE) ((lcg >> 8) - (1L << 22)) / (1L << 22);
+    }
+    if (s == 1)
+      memset (set[s].wi, 0, sizeof (set[s].wi));
+    if (s == 2)
+      memset (set[s].wBasis, 0, sizeof (set[s].wBasis));
+    if (s == 3)
+      memset (&set[s].wBasis[2 * S_LEN], 0, 3 * S_LEN * sizeof (FTYPE));
+    if (s == 4)
+      memcpy (&set[s].wBasis[S_LEN], set[s].wBasis, S_LEN * sizeof (FTYPE));
+  }
+
+  run_search (V_SRCH, st, set, N_SETS, code_ref);
+  cpu_ref = run_search (V_SRCH, st, set, n, code_ref);
+  cpu_v = run_search (V_SRCHV, st, set, n, code);
+  for (s = 0; s < N_SETS; s++)
+    fail += code[s] != code_ref[s];
+  vselp_delete (st);
+
+  printf ("%-10s %12s %12s %8s %6s\n", "search", "[ns/search]", "[ns/subfr]", "speedup", "exact");
+  if (check) {
+    printf ("%-10s %12s %12s %8s %6s\n", "reference", "-", "-", "-", "-");
+    printf ("%-10s %12s %12s %8s %6s\n", "vector", "-", "-", "-", fail ? "NO" : "yes");
+  } else {
+    printf ("%-10s %12.1f %12.1f %8s %6s\n", "reference", cpu_ref / n * 1e9, 2 * cpu_ref / n * 1e9, "-", "-");
+    printf ("%-10s %12.1f %12.1f %7.2fx %6s\n", "vector", cpu_v / n * 1e9, 2 * cpu_v / n * 1e9, (cpu_ref + 1e-9) / (cpu_v + 1e-9), fail ? "NO" : "yes");
+  }
+
+  if (fail)
+    fprintf (stderr, "%ld vectorized search(es) differ from the reference\n", fail);
+
+  /* Every subframe of the speech files */
+  if (check && argc > 1) {
+    for (k = 1; k < argc; k++)
+      if (!check_file_search (argv[k]))
+        return 1;
+    printf ("%-10s %ld searches in %d file(s), %ld differ\n", "speech", n_check, argc - 1, n_differ);
+    if (n_differ)
+      fprintf (stderr, "%ld vectorized search(es) differ from the reference on speech\n", n_differ);
+  }
+  return fail || n_differ ? 1 : 0;
+}
@@ -33,17 +33,15 @@ Motorola Inc.
 /*-------------------------------------------------------------*/
 /*	inclusions*/
 
-#include "vparams.h"
+#include "t_sub.h"
 #include <math.h>
 /*#include "stdlib.h"*/
-/*	static externals*/
-static FTYPE sEngTotal, weEngTotal, eEngTotal, sumwSegSnr, sumSegSnr;
-static int numSegs;
+/*	the accumulators are kept in the encoder state st*/
 
 
 /*----------------------------------------*/
 /*	snr and weighted prediction gains */
-void runningSnr (FTYPE * speech, FTYPE * syn, FTYPE * wSpeech, FTYPE * wsyn) {
+void runningSnr (VSELP_STATE * st, FTYPE * speech, FTYPE * syn, FTYPE * wSpeech, FTYPE * wsyn) {
   FTYPE sEng, weEng, eEng, temp, *tfp1, *tfp2, *tfp3, *tfp4, *efp;
 
 /*	update subframe energies */
@@ -62,23 +60,23 @@ void runningSnr (FTYPE * speech, FTYPE * syn, FTYPE * wSpeech, FTYPE * wsyn) {
     weEng += temp * temp;
   }
 
-  sEngTotal += sEng;
-  weEngTotal += weEng;
-  eEngTotal += eEng;
+  st->sEngTotal += sEng;
+  st->weEngTotal += weEng;
+  st->eEngTotal += eEng;
   if (sEng > 0.0) {
-    sumwSegSnr += 10.0 * log10 (sEng / weEng);
-    sumSegSnr += 10.0 * log10 (sEng / eEng);
-    numSegs++;
+    st->sumwSegSnr += 10.0 * log10 (sEng / weEng);
+    st->sumSegSnr += 10.0 * log10 (sEng / eEng);
+    st->numSegs++;
   }
 }                               /* end of runningSnr */
 
 
 /*------------------------------------------------*/
-/*	print final results */
-void printSnr (FILE * fplog) {
-  fprintf (fplog, "\nNUMBER OF FRAMES IN SNR COMPUTATION: %d\n", numSegs);
-  fprintf (fplog, "\nAVG WEIGHTED SEG SNR          -> %8.5f\n", sumwSegSnr / numSegs);
-  fprintf (fplog, "TOTAL WEIGHTED SNR            -> %8.5f\n", 10.0 * log10 (sEngTotal / weEngTotal));
-  fprintf (fplog, "AVG SEG SNR                   -> %8.5f\n", sumSegSnr / numSegs);
-  fprintf (fplog, "TOTAL SNR                     -> %8.5f\n", 10.0 * log10 (sEngTotal / eEngTotal));
+/*	print final results of the encoder st */
+void vselp_print_snr (VSELP_STATE * st, FILE * fplog) {
+  fprintf (fplog, "\nNUMBER OF FRAMES IN SNR COMPUTATION: %d\n", st->numSegs);
+  fprintf (fplog, "\nAVG WEIGHTED SEG SNR          -> %8.5f\n", st->sumwSegSnr / st->numSegs);
+  fprintf (fplog, "TOTAL WEIGHTED SNR            -> %8.5f\n", 10.0 * log10 (st->sEngTotal / st->weEngTotal));
+  fprintf (fplog, "AVG SEG SNR                   -> %8.5f\n", st->sumSegSnr / st->numSegs);
+  fprintf (fplog, "TOTAL SNR                     -> %8.5f\n", 10.0 * log10 (st->sEngTotal / st->eEngTotal));
 }
@@ -27,10 +27,14 @@
 	Global (have prototype in reverb-lib.h)
 		shift(...)		:		Shift coefficients of the input buffer for next block filtering
 		conv(...)		:		Convolves the impulse response of a room with the input file
+		pconv_init(...)	:		Initializes the partitioned FFT convolution engine
+		pconv(...)		:		Same as conv(), using the partitioned FFT convolution engine
+		pconv_free(...)	:		Releases the partitioned FFT convolution engine
 
   HISTORY :
 	02.Feb.05	v1.0	First Beta version
     10.jul.08   v1.01   Added 16 bit saturation and saturation warning
+	17.Oct.26   v1.02   Added uniformly partitioned overlap-save FFT convolution
 
   AUTHORS :
 	v1.0 Cyril Guillaume & Stephane Ragot -- stephane.ragot@francetelecom.com
@@ -38,6 +42,11 @@
 
 */
 
+#include <stdlib.h>
+#include <string.h>
+
+#include "reverb-lib.h"
+#include "fft.h"
 
 
 /* this routine replaces the first N-1 samples of a buffer by the last N-1 samples */
@@ -97,3 +106,130 @@ void conv_old (float *IR, short *buffIn, short *buffRvb, float alignFact, long N
     buffRvb[k] = (short) (alignFact * tmpRvb + 0.5);    /* +0.5 : rounding during the 'short' truncation */
   }
 }
+
+
+/* this routine allocates and initializes the partitioned convolution engine */
+/* the impulse response is cut into P partitions of B samples, and the spectrum of each partition, zero-padded to 2B, is stored */
+PCONV_STATE *pconv_init (float *IR, long N, long B) {
+  PCONV_STATE *st;
+  long p, k, len, nip;
+
+  /* default block size: about a tenth of the impulse response, within [64, 4096] */
+  if (B <= 0)
+    for (B = 64; B < 4096 && 10 * B < N; B <<= 1);
+  for (k = 4; k < B; k <<= 1);
+  if (k != B || N <= 0)
+    return NULL;                /* B must be a power of 2 */
+
+  if ((st = (PCONV_STATE *) calloc (1, sizeof (PCONV_STATE))) == NULL)
+    return NULL;
+  st->N = N;
+  st->B = B;
+  st->P = (N + B - 1) / B;
+  st->nfft = 2 * B;
+  for (nip = 1; nip * nip < B; nip <<= 1);
+  st->H = (float *) calloc (st->P * st->nfft, sizeof (float));
+  st->X = (float *) calloc (st->P * st->nfft, sizeof (float));
+  st->buf = (float *) calloc (st->nfft, sizeof (float));
+  st->Y = (float *) calloc (st->nfft, sizeof (float));
+  st->ip = (int *) calloc (2 + 2 * nip, sizeof (int));
+  st->w = (float *) calloc (B, sizeof (float));
+  if (st->H == NULL || st->X == NULL || st->buf == NULL || st->Y == NULL || st->ip == NULL || st->w == NULL) {
+    pconv_free (st);
+    return NULL;
+  }
+
+  /* spectra of the impulse response partitions */
+  for (p = 0; p < st->P; p++) {
+    len = N - p * B < B ? N - p * B : B;
+    memcpy (st->H + p * st->nfft, IR + p * B, len * sizeof (float));
+    actrdft ((int) st->nfft, 1, st->H + p * st->nfft, st->ip, st->w);
+  }
+  st->pos = 0;
+  st->fill = 0;
+
+  return st;
+}
+
+
+/* this routine computes the output for the current (possibly partial) input block */
+/* Y = sum over the partitions p of X[block-p] * H[p], with the spectra in the packed format of actrdft(): a[0]=Re(0), a[1]=Re(nfft/2), a[2k],a[2k+1]=Re(k),Im(k) */
+static void pconv_block (PCONV_STATE * st) {
+  long p, k, slot, n = st->nfft;
+  float *X, *H, *Y = st->Y;
+
+  memcpy (st->X + st->pos * n, st->buf, n * sizeof (float));
+  actrdft ((int) n, 1, st->X + st->pos * n, st->ip, st->w);
+
+  memset (Y, 0, n * sizeof (float));
+  for (p = 0, slot = st->pos; p < st->P; p++, slot = slot == 0 ? st->P - 1 : slot - 1) {
+    X = st->X + slot * n;
+    H = st->H + p * n;
+    Y[0] += X[0] * H[0];
+    Y[1] += X[1] * H[1];
+    for (k = 2; k < n; k += 2) {
+      Y[k] += X[k] * H[k] - X[k + 1] * H[k + 1];
+      Y[k + 1] += X[k] * H[k + 1] + X[k + 1] * H[k];
+    }
+  }
+  actrdft ((int) n, -1, Y, st->ip, st->w);
+}
+
+
+/* this routine convolves buffIn with the impulse response, by uniformly partitioned overlap-save convolution */
+/* a partial block is computed with the missing samples set to zero, and computed again when the block is completed by the next call */
+long pconv (PCONV_STATE * st, short *buffIn, short *buffRvb, float alignFact, long L) {
+  long k, m, done, B = st->B;
+  float tmpRvb;
+  long sat_warning;
+
+  sat_warning = -1;
+  for (done = 0; done < L; done += m) {
+    /* append new samples to the current block */
+    m = B - st->fill < L - done ? B - st->fill : L - done;
+    for (k = 0; k < m; k++)
+      st->buf[B + st->fill + k] = buffIn[done + k];
+
+    pconv_block (st);
+
+    /* the last B samples of the circular convolution are the valid ones (overlap-save) */
+    for (k = 0; k < m; k++) {
+      tmpRvb = (float) (alignFact * st->Y[B + st->fill + k] + 0.5);     /* +0.5 : rounding for the 'short' truncation */
+
+      /* perform 16 bit saturation */
+      if (tmpRvb < -32768.0) {
+        buffRvb[done + k] = -32768;
+        sat_warning = done + k;
+      } else if (tmpRvb > 32767.0) {
+        buffRvb[done + k] = 32767;
+        sat_warning = done + k;
+      } else {
+        buffRvb[done + k] = (short) tmpRvb;
+      }
+    }
+
+    st->fill += m;
+    if (st->fill == B) {
+      /* block complete: it becomes the previous block */
+      memcpy (st->buf, st->buf + B, B * sizeof (float));
+      memset (st->buf + B, 0, B * sizeof (float));
+      st->pos = (st->pos + 1) % st->P;
+      st->fill = 0;
+    }
+  }
+  return sat_warning;
+}
+
+
+/* this routine releases the memory of the partitioned convolution engine */
+void pconv_free (PCONV_STATE * st) {
+  if (st == NULL)
+    return;
+  free (st->H);
+  free (st->X);
+  free (st->buf);
+  free (st->Y);
+  free (st->ip);
+  free (st->w);
+  free (st);
+}
@@ -28,10 +28,14 @@
 	Global (have prototype in reverb-lib.h)
 		shift(...)		:		Shift coefficients of the input buffer for next block filtering
 		conv(...)		:		Convolves the impulse response of a room with the input file
+		pconv_init(...)	:		Initializes the partitioned FFT convolution engine
+		pconv(...)		:		Same as conv(), using the partitioned FFT convolution engine
+		pconv_free(...)	:		Releases the partitioned FFT convolution engine
 
   HISTORY :
 	02.Feb.05	v1.0	First Beta version
 	10.jul.08   v1.01   Added 16 bit saturation and saturation warning
+	17.Oct.26   v1.02   Added uniformly partitioned overlap-save FFT convolution
 
 
   AUTHORS :
@@ -54,3 +58,44 @@ long conv (float *IR,           /* impulse response buffer */
            long N,              /* length of the impulse response */
            long L               /* length of the input buffer to process */
   );
+
+
+/* State of the uniformly partitioned overlap-save convolution engine */
+typedef struct {
+  long N;                       /* length of the impulse response */
+  long B;                       /* block size (= partition length) */
+  long P;                       /* number of partitions of the impulse response */
+  long nfft;                    /* FFT size, 2*B */
+  float *H;                     /* spectra of the P partitions of the impulse response */
+  float *X;                     /* spectra of the last P input blocks (circular) */
+  long pos;                     /* position of the current input block in X */
+  float *buf;                   /* previous and current input block */
+  long fill;                    /* number of samples in the current input block */
+  float *Y;                     /* output spectrum / output block */
+  int *ip;                      /* FFT bit reversal work area */
+  float *w;                     /* FFT cos/sin table */
+} PCONV_STATE;
+
+
+/* this routine allocates and initializes the partitioned convolution engine for the impulse response IR */
+/* B is the block size, a power of 2 (B<=0 selects a default size for the IR length); returns NULL on failure */
+PCONV_STATE *pconv_init (float *IR,     /* impulse response buffer */
+                         long N,        /* length of the impulse response */
+                         long B         /* block size */
+  );
+
+
+/* this routine convolves buffIn with the impulse response given to pconv_init() and stores the result into buffRvb */
+/* unlike conv(), buffIn holds only the L new samples: the past samples are kept in the state */
+/* any L can be used, but calls with L a multiple of the block size are the most efficient */
+/* alignFact and the returned saturation flag are the same as for conv() */
+long pconv (PCONV_STATE * st,   /* engine state */
+            short *buffIn,      /* input buffer */
+            short *buffRvb,     /* reverberated data */
+            float alignFact,    /* energy alignment factor */
+            long L              /* length of the input buffer to process */
+  );
+
+
+/* this routine releases the memory of the partitioned convolution engine */
+void pconv_free (PCONV_STATE * st);
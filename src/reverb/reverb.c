@@ -1,4 +1,4 @@
-/*                                                         02/Feb/2010 v1.02 */
+/*                                                         17/Oct/2026 v1.04 */
 /*=============================================================================
 
                           U    U   GGG    SSSS  TTTTT
@@ -26,6 +26,10 @@
 	02.Feb.05	v1.0	First Beta version
 	10.Jul.08 v1.01 Added 16 bit saturation and saturation warning
 	02.Feb.10 v1.02 Modified maximum string length to avoid buffer overrun
+	17.Oct.26 v1.03 Uses the partitioned FFT convolution engine (pconv) by
+	                default; the direct convolution is kept under -direct
+	17.Oct.26 v1.04 Input and output samples through the ugst-io module
+	                (memory-mapped input, block-buffered output)
 
   AUTHORS :
 	v1.0  Cyril Guillaume & Stephane Ragot -- stephane.ragot@francetelecom.com
@@ -39,11 +43,12 @@
 
 /* UGST modules */
 #include "ugstdemo.h"
+#include "ugst-io.h"
 
 #include "reverb-lib.h"
 
 static void display_usage () {
-  printf ("REVERB.C - Version 1.02 of 02.Feb.2010 \n\n");
+  printf ("REVERB.C - Version 1.04 of 17.Oct.2026 \n\n");
 
   printf (" Program to add reverberation to a signal\n");
   printf (" This program convolves a signal with the impulse response of a room\n");
@@ -61,6 +66,9 @@ static void display_usage () {
   printf (" Options:\n");
   printf ("  -align A...... multiplicative factor to apply to the reverberated sound\n");
   printf ("				   in order to align its energy level with a second file\n");
+  printf ("  -direct ...... use the direct (time-domain) convolution instead of the\n");
+  printf ("				   partitioned FFT convolution; the results may differ by 1 LSB\n");
+  printf ("  -block B...... block size for the FFT convolution (power of 2) [default: from IR length]\n");
   printf ("\n");
 }
 
@@ -68,8 +76,8 @@ static void display_usage () {
 
 int main (int argc, char *argv[]) {
   /* File variables */
-  FILE *ptr_fileIn;
-  FILE *ptr_fileOut;
+  UGST_IO *ptr_fileIn;
+  UGST_IO *ptr_fileOut;
   FILE *ptr_fileIR;
   char FileIn[MAX_STRLEN];
   char FileIR[MAX_STRLEN];
@@ -86,6 +94,10 @@ int main (int argc, char *argv[]) {
   long N;                       /* length of the impulse response */
   long count, global_count;
   long local_sat_pos;
+  int direct = 0;               /* flag for the direct convolution */
+  long B = 0;                   /* block size of the FFT convolution */
+  long blk;                     /* number of samples read per block */
+  PCONV_STATE *pconv_state = NULL;
 
   global_count = 0;
   local_sat_pos = -1;           /* local position of last saturation */
@@ -102,6 +114,20 @@ int main (int argc, char *argv[]) {
         /* Set the energy alignment factor */
         alignFact = (float) atof (argv[2]);
 
+        /* Move arg{c,v} over the option to the next argument */
+        argc -= 2;
+        argv += 2;
+      } else if (strcmp (argv[1], "-direct") == 0) {
+        /* Use the direct convolution */
+        direct = 1;
+
+        /* Move arg{c,v} over the option to the next argument */
+        argc--;
+        argv++;
+      } else if (strcmp (argv[1], "-block") == 0) {
+        /* Set the block size of the FFT convolution */
+        B = atol (argv[2]);
+
         /* Move arg{c,v} over the option to the next argument */
         argc -= 2;
         argv += 2;
@@ -149,21 +175,31 @@ int main (int argc, char *argv[]) {
   fclose (ptr_fileIR);
 
   /* open the input file */
-  ptr_fileIn = fopen (FileIn, "rb");
+  ptr_fileIn = ugst_io_open_read (FileIn, UGST_IO_NATIVE);
   if (ptr_fileIn == NULL) {
     fprintf (stderr, "\nUnable to open Input file\n");
     exit (-1);
   }
 
   /* open the output file */
-  ptr_fileOut = fopen (FileOut, "wb");
+  ptr_fileOut = ugst_io_open_write (FileOut, UGST_IO_NATIVE);
   if (ptr_fileOut == NULL) {
     fprintf (stderr, "\nUnable to open Output file\n");
     exit (-1);
   }
+  /* initialize the FFT convolution; blocks of several partitions are read at once */
+  if (!direct) {
+    if ((pconv_state = pconv_init (IR, N, B)) == NULL) {
+      fprintf (stderr, "\nUnable to initialize the FFT convolution (block size must be a power of 2)\n");
+      exit (-1);
+    }
+    blk = pconv_state->B * 8;
+  } else
+    blk = N;
+
   /* allocate memory for the buffers */
-  buffIn = (short *) calloc (2 * N - 1, sizeof (short));        /* allocate memory for a block of the input file */
-  buffRvb = (short *) malloc (N * sizeof (short));      /* allocate memory for the processed block */
+  buffIn = (short *) calloc (N - 1 + blk, sizeof (short));      /* allocate memory for a block of the input file */
+  buffRvb = (short *) malloc (blk * sizeof (short));    /* allocate memory for the processed block */
 
   /* check consistency */
   if ((buffIn == NULL) || (buffRvb == NULL)) {
@@ -178,16 +214,30 @@ int main (int argc, char *argv[]) {
   /* .......FILTERING OPERATION ........ */
 
   /* Filter the sound File */
-  while (!feof (ptr_fileIn)) {
-    count = (long) fread (buffIn + N - 1, sizeof (short), N, ptr_fileIn);       /* read a block of the input file */
-
-    local_sat_pos = conv (IR, buffIn, buffRvb, alignFact, N, count);    /* convolves a block of the input file with the impulse response */
+  for (;;) {
+    if (direct) {
+      count = ugst_io_read (ptr_fileIn, buffIn + N - 1, N);  /* read a block of the input file */
+      if (count == 0)
+        break;
+
+      local_sat_pos = conv (IR, buffIn, buffRvb, alignFact, N, count);  /* convolves a block of the input file with the impulse response */
+    } else {
+      count = ugst_io_read (ptr_fileIn, buffIn, blk);  /* read a block of the input file */
+      if (count == 0)
+        break;
+
+      local_sat_pos = pconv (pconv_state, buffIn, buffRvb, alignFact, count);   /* the past samples are kept in the state */
+    }
     if (local_sat_pos >= 0) {
       fprintf (stderr, "\nWarning warning!! Saturation(s) in output file.  In  sample %ld\n", local_sat_pos + global_count);
     }
     global_count += count;
-    fwrite (buffRvb, sizeof (short), count, ptr_fileOut);       /* output the processed block */
-    shift (buffIn, N);          /* shift a part of the input buffer (to keep the N-1 last samples of the input file for the next processing) */
+    if (ugst_io_write (ptr_fileOut, buffRvb, count) < 0) {      /* output the processed block */
+      fprintf (stderr, "\nError writing Output file\n");
+      exit (-1);
+    }
+    if (direct)
+      shift (buffIn, N);        /* shift a part of the input buffer (to keep the N-1 last samples of the input file for the next processing) */
   }
 
 
@@ -200,9 +250,13 @@ int main (int argc, char *argv[]) {
   free (buffIn);
   free (buffRvb);
   free (IR);
+  pconv_free (pconv_state);
   /* close the opened files */
-  fclose (ptr_fileIn);
-  fclose (ptr_fileOut);
+  ugst_io_close (ptr_fileIn);
+  if (ugst_io_close (ptr_fileOut) < 0) {
+    fprintf (stderr, "\nError writing Output file\n");
+    exit (-1);
+  }
 
 
   return (0);
@@ -0,0 +1,213 @@
+/*                                                         17/Oct/2026 v1.1 */
+/*=============================================================================
+
+                          U    U   GGG    SSSS  TTTTT
+                          U    U  G       S       T
+                          U    U  G  GG   SSSS    T
+                          U    U  G   G       S   T
+                           UUU     GG     SSS     T
+
+                   ========================================
+                    ITU-T - USER'S GROUP ON SOFTWARE TOOLS
+                   ========================================
+
+       =============================================================
+       COPYRIGHT NOTE: This source code, and all of its derivations,
+       is subject to the "ITU-T General Public License". Please have
+       it  read  in    the  distribution  disk,   or  in  the  ITU-T
+       Recommendation G.191 on "SOFTWARE TOOLS FOR SPEECH AND  AUDIO
+       CODING STANDARDS".
+       =============================================================
+
+  DESCRIPTION :
+	Benchmark of the reverberation tool: a pseudo-random signal is convolved
+	with each of the given impulse responses by the direct convolution conv()
+	and by the partitioned FFT convolution pconv(), and the wall-clock time of both
+	and the largest difference between their outputs are reported. For a
+	stereo impulse response, give both the .L and .R files.
+
+	The input is passed to pconv() in chunks of varying length, to exercise
+	the handling of partial blocks.
+
+  USAGE :
+	rvbbench [-sec s] [-block B] [-check] FileIR [FileIR ...]
+
+	-sec s ...... seconds of signal (at 32 kHz) [default: 2]
+	-block B .... block size of the FFT convolution [default: from IR length]
+	-check ...... short signal; exit with an error if the outputs differ by
+	              more than 1 LSB
+
+  HISTORY :
+	17.Oct.26 v1.0	Created
+	17.Oct.26 v1.1	Times measured with a monotonic wall clock
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+/* UGST modules */
+#include "ugstdemo.h"
+
+#include "reverb-lib.h"
+
+/* chunk lengths cycled through when calling pconv() */
+static long chunk[] = { 4096, 1, 333, 8192, 17, 1024 };
+
+#define N_CHUNK (sizeof (chunk) / sizeof (chunk[0]))
+
+
+/* Monotonic wall-clock time in seconds */
+static double wall_clock (void) {
+#ifdef _WIN32
+  LARGE_INTEGER f, t;
+  QueryPerformanceFrequency (&f);
+  QueryPerformanceCounter (&t);
+  return (double) t.QuadPart / (double) f.QuadPart;
+#else
+  struct timespec ts;
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+#endif
+}
+
+
+static void display_usage () {
+  printf ("RVBBENCH.C - Version 1.0 of 17.Oct.2026 \n\n");
+  printf (" Benchmark of the direct and the partitioned FFT convolution of the\n");
+  printf (" reverberation tool\n\n");
+  printf (" Usage:\n");
+  printf (" $ rvbbench [-sec s] [-block B] [-check] FileIR [FileIR ...]\n");
+  printf (" Options:\n");
+  printf ("  -sec s ....... seconds of signal (at 32 kHz) [default: 2]\n");
+  printf ("  -block B ..... block size of the FFT convolution\n");
+  printf ("  -check ....... check mode: fail if the outputs differ by more than 1 LSB\n");
+  printf ("\n");
+}
+
+
+/* load an impulse response file (native floats); returns the number of taps */
+static long load_IR (char *FileIR, float **IR) {
+  FILE *fp;
+  long N;
+
+  if ((fp = fopen (FileIR, "rb")) == NULL) {
+    fprintf (stderr, "\nUnable to open impulse response file %s\n", FileIR);
+    exit (-1);
+  }
+  fseek (fp, 0L, SEEK_END);
+  N = ftell (fp) / sizeof (float);
+  rewind (fp);
+  if ((*IR = (float *) calloc (N, sizeof (float))) == NULL) {
+    fprintf (stderr, "\nUnable to allocate enough memory\n");
+    exit (-1);
+  }
+  N = (long) fread (*IR, sizeof (float), N, fp);
+  fclose (fp);
+  return N;
+}
+
+
+int main (int argc, char *argv[]) {
+  float *IR;
+  short *sig, *buffIn, *outDirect, *outFFT;
+  double sec = 2.0, wallDirect, wallFFT;
+  long B = 0, N, len, i, k, c, count, maxdiff, diff, lcg = 4711, fail = 0;
+  int check = 0;
+  double t0;
+  PCONV_STATE *st;
+
+  /* Check options */
+  while (argc > 1 && argv[1][0] == '-')
+    if (strcmp (argv[1], "-sec") == 0) {
+      sec = atof (argv[2]);
+      argc -= 2;
+      argv += 2;
+    } else if (strcmp (argv[1], "-block") == 0) {
+      B = atol (argv[2]);
+      argc -= 2;
+      argv += 2;
+    } else if (strcmp (argv[1], "-check") == 0) {
+      check = 1;
+      argc--;
+      argv++;
+    } else {
+      display_usage ();
+      exit (argv[1][1] == 'h' || argv[1][1] == '?' ? 2 : -1);
+    }
+  if (argc < 2) {
+    display_usage ();
+    exit (-1);
+  }
+  if (check)
+    sec = 0.25;
+
+  /* pseudo-random test signal */
+  len = (long) (sec * 32000);
+  sig = (short *) malloc (len * sizeof (short));
+  outDirect = (short *) malloc (len * sizeof (short));
+  outFFT = (short *) malloc (len * sizeof (short));
+  if (sig == NULL || outDirect == NULL || outFFT == NULL) {
+    fprintf (stderr, "\nUnable to allocate enough memory\n");
+    exit (-1);
+  }
+  for (i = 0; i < len; i++) {
+    lcg = (lcg * 1103515245 + 12345) & 0x7FFFFFFF;
+    sig[i] = (short) ((lcg >> 16) - 16384) / 4;
+  }
+
+  printf ("%-40s %6s %5s %12s %12s %8s %8s\n", "impulse response", "taps", "block", "direct[s]", "fft[s]", "speedup", "maxdiff");
+  for (; argc > 1; argc--, argv++) {
+    N = load_IR (argv[1], &IR);
+
+    /* direct convolution, in blocks of N samples as in reverb.c */
+    buffIn = (short *) calloc (2 * N - 1, sizeof (short));
+    t0 = wall_clock ();
+    for (i = 0; i < len; i += count) {
+      count = len - i < N ? len - i : N;
+      memcpy (buffIn + N - 1, sig + i, count * sizeof (short));
+      conv (IR, buffIn, outDirect + i, 1.0, N, count);
+      shift (buffIn, N);
+    }
+    wallDirect = wall_clock () - t0;
+    free (buffIn);
+
+    /* partitioned FFT convolution */
+    if ((st = pconv_init (IR, N, B)) == NULL) {
+      fprintf (stderr, "\nUnable to initialize the FFT convolution (block size must be a power of 2)\n");
+      exit (-1);
+    }
+    t0 = wall_clock ();
+    for (i = 0, c = 0; i < len; i += count, c++) {
+      count = len - i < chunk[c % N_CHUNK] ? len - i : chunk[c % N_CHUNK];
+      pconv (st, sig + i, outFFT + i, 1.0, count);
+    }
+    wallFFT = wall_clock () - t0;
+
+    for (maxdiff = 0, k = 0; k < len; k++)
+      if ((diff = labs ((long) outFFT[k] - outDirect[k])) > maxdiff)
+        maxdiff = diff;
+    if (maxdiff > 1)
+      fail++;
+
+    printf ("%-40s %6ld %5ld %12.3f %12.3f %7.1fx %8ld\n", argv[1], N, st->B, wallDirect, wallFFT, (wallDirect + 1e-9) / (wallFFT + 1e-9), maxdiff);
+
+    pconv_free (st);
+    free (IR);
+  }
+
+  free (sig);
+  free (outDirect);
+  free (outFFT);
+
+  if (check && fail) {
+    fprintf (stderr, "\n%ld impulse response(s) with differences above 1 LSB\n", fail);
+    return 1;
+  }
+  return 0;
+}
@@ -25,6 +25,53 @@ extern char *memcpy P ((char *, char *, int));
  *  4.2 FIXED POINT IMPLEMENTATION OF THE RPE-LTP CODER
  */
 
+/*
+ *  Procedures 4.2.11 to 4.2.18, four times per frame, on the short term
+ *  residual signal d[0..159] of one channel.
+ */
+static void Gsm_Coder_subframes P7 ((S, d, Nc, bc, Mc, xmaxc, xMc), struct gsm_state *S, word * d,     /* [0..159] residual signal IN */
+                                    word * Nc,  /* [0..3] LTP lag OUT */
+                                    word * bc,  /* [0..3] coded LTP gain OUT */
+                                    word * Mc,  /* [0..3] RPE grid selection OUT */
+                                    word * xmaxc,       /* [0..3] Coded maximum amplitude OUT */
+                                    word * xMc  /* [13*4] normalized RPE samples OUT */
+  ) {
+  int k;
+  word *dp = S->dp0 + 120;      /* [ -120...-1 ] */
+  word *dpp = dp;               /* [ 0...39 ] */
+
+  /* e[-5..-1] and e[40..44] stay zero; local, so that several states can
+     be used at the same time by different threads */
+  word e[50] = { 0 };
+
+  for (k = 0; k <= 3; k++, xMc += 13) {
+
+    Gsm_Long_Term_Predictor (S, d + k * 40,     /* d [0..39] IN */
+                             dp,        /* dp [-120..-1] IN */
+                             e + 5,     /* e [0..39] OUT */
+                             dpp,       /* dpp [0..39] OUT */
+                             Nc++, bc++);
+
+    Gsm_RPE_Encoding (S, e + 5, /* e ][0..39][ IN/OUT */
+                      xmaxc++, Mc++, xMc);
+    /*
+     * Gsm_Update_of_reconstructed_short_time_residual_signal
+     *                      ( dpp, e + 5, dp );
+     */
+
+    {
+      register int i;
+      register longword ltmp;
+      for (i = 0; i <= 39; i++)
+        dp[i] = GSM_ADD (e[5 + i], dpp[i]);
+    }
+    dp += 40;
+    dpp += 40;
+
+  }
+  (void) memcpy ((char *) S->dp0, (char *) (S->dp0 + 160), 120 * sizeof (*S->dp0));
+}
+
 void Gsm_Coder P8 ((S, s, LARc, Nc, bc, Mc, xmaxc, xMc), struct gsm_state *S, word * s, /* [0..159] samples IN */
 /*
  * The RPE-LTD coder works on a frame by frame basis.  The length of
@@ -47,42 +94,41 @@ void Gsm_Coder P8 ((S, s, LARc, Nc, bc, Mc, xmaxc, xMc), struct gsm_state *S, wo
                    word * xmaxc,        /* [0..3] Coded maximum amplitude OUT */
                    word * xMc   /* [13*4] normalized RPE samples OUT */
   ) {
-  int k;
-  word *dp = S->dp0 + 120;      /* [ -120...-1 ] */
-  word *dpp = dp;               /* [ 0...39 ] */
-
-  static word e[50] = { 0 };
-
   word so[160];
 
   Gsm_Preprocess (S, s, so);
   Gsm_LPC_Analysis (S, so, LARc);
   Gsm_Short_Term_Analysis_Filter (S, LARc, so);
 
-  for (k = 0; k <= 3; k++, xMc += 13) {
+  Gsm_Coder_subframes (S, so, Nc, bc, Mc, xmaxc, xMc);
+}
 
-    Gsm_Long_Term_Predictor (S, so + k * 40,    /* d [0..39] IN */
-                             dp,        /* dp [-120..-1] IN */
-                             e + 5,     /* e [0..39] OUT */
-                             dpp,       /* dpp [0..39] OUT */
-                             Nc++, bc++);
+/*
+ *  Gsm_Coder() of n channels, each with its own state S[c]: the short
+ *  term analysis filters of GSM_LANES channels run together.
+ */
+void Gsm_Coder_N P9 ((S, n, s, LARc, Nc, bc, Mc, xmaxc, xMc), struct gsm_state **S, int n, word * s,   /* [n][160] samples IN */
+                     word * LARc,       /* [n][8] LAR coefficients OUT */
+                     word * Nc, /* [n][4] LTP lag OUT */
+                     word * bc, /* [n][4] coded LTP gain OUT */
+                     word * Mc, /* [n][4] RPE grid selection OUT */
+                     word * xmaxc,      /* [n][4] Coded maximum amplitude OUT */
+                     word * xMc /* [n][13*4] normalized RPE samples OUT */
+  ) {
+  int c, m;
+  word so[160 * GSM_LANES];
 
-    Gsm_RPE_Encoding (S, e + 5, /* e ][0..39][ IN/OUT */
-                      xmaxc++, Mc++, xMc);
-    /*
-     * Gsm_Update_of_reconstructed_short_time_residual_signal
-     *                      ( dpp, e + 5, dp );
-     */
+  for (; n > 0; n -= m, S += m, s += 160 * m, LARc += 8 * m, Nc += 4 * m, bc += 4 * m, Mc += 4 * m, xmaxc += 4 * m, xMc += 52 * m) {
+    m = n < GSM_LANES ? n : GSM_LANES;
 
-    {
-      register int i;
-      register longword ltmp;
-      for (i = 0; i <= 39; i++)
-        dp[i] = GSM_ADD (e[5 + i], dpp[i]);
+    for (c = 0; c < m; c++) {
+      Gsm_Preprocess (S[c], s + 160 * c, so + 160 * c);
+      Gsm_LPC_Analysis (S[c], so + 160 * c, LARc + 8 * c);
     }
-    dp += 40;
-    dpp += 40;
 
+    Gsm_Short_Term_Analysis_Filter_N (S, m, LARc, so);
+
+    for (c = 0; c < m; c++)
+      Gsm_Coder_subframes (S[c], so + 160 * c, Nc + 4 * c, bc + 4 * c, Mc + 4 * c, xmaxc + 4 * c, xMc + 52 * c);
   }
-  (void) memcpy ((char *) S->dp0, (char *) (S->dp0 + 160), 120 * sizeof (*S->dp0));
 }
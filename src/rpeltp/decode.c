@@ -58,3 +58,40 @@ void Gsm_Decoder P8 ((S, LARcr, Ncr, bcr, Mcr, xmaxcr, xMcr, s), struct gsm_stat
   Gsm_Short_Term_Synthesis_Filter (S, LARcr, wt, s);
   Postprocessing (S, s);
 }
+
+/*
+ *  Gsm_Decoder() of n channels, each with its own state S[c]: the short
+ *  term synthesis filters of GSM_LANES channels run together.
+ */
+void Gsm_Decoder_N P9 ((S, n, LARcr, Ncr, bcr, Mcr, xmaxcr, xMcr, s), struct gsm_state **S, int n, word * LARcr,        /* [n][8] IN */
+                       word * Ncr,      /* [n][4] IN */
+                       word * bcr,      /* [n][4] IN */
+                       word * Mcr,      /* [n][4] IN */
+                       word * xmaxcr,   /* [n][4] IN */
+                       word * xMcr,     /* [n][13*4] IN */
+                       word * s) {      /* [n][160] OUT */
+  int c, j, k, m;
+  word erp[40], wt[160 * GSM_LANES];
+  word *drp;
+
+  for (; n > 0; n -= m, S += m, LARcr += 8 * m, Ncr += 4 * m, bcr += 4 * m, Mcr += 4 * m, xmaxcr += 4 * m, xMcr += 52 * m, s += 160 * m) {
+    m = n < GSM_LANES ? n : GSM_LANES;
+
+    for (c = 0; c < m; c++) {
+      drp = S[c]->dp0 + 120;
+      for (j = 0; j <= 3; j++) {
+
+        Gsm_RPE_Decoding (S[c], xmaxcr[4 * c + j], Mcr[4 * c + j], xMcr + 52 * c + 13 * j, erp);
+        Gsm_Long_Term_Synthesis_Filtering (S[c], Ncr[4 * c + j], bcr[4 * c + j], erp, drp);
+
+        for (k = 0; k <= 39; k++)
+          wt[160 * c + j * 40 + k] = drp[k];
+      }
+    }
+
+    Gsm_Short_Term_Synthesis_Filter_N (S, m, LARcr, wt, s);
+
+    for (c = 0; c < m; c++)
+      Postprocessing (S[c], s + 160 * c);
+  }
+}
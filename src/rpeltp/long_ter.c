@@ -14,6 +14,11 @@
 #include "gsm.h"
 #include "proto.h"
 
+/* SSE2 lag search of the integer version (see below), unless GSM_SCALAR */
+#ifdef GSM_HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
 /* Prevent improper operation for 16-bit systems */
 #if defined(MSDOS) || defined(__MSDOS__)
 #ifdef USE_TABLE_MUL
@@ -120,6 +125,43 @@ static void Calculation_of_the_LTP_parameters P4 ((d, dp, bc_out, Nc_out), regis
   L_max = 0;
   Nc = 40;                      /* index for the maximum cross-correlation */
 
+#ifdef GSM_HAVE_SSE2
+
+  /* |wt[k]| <= 512 after the scaling above, so every product is below 2^24
+     and the sum of the 40 products below 2^30: the 16-bit multiply-adds
+     with 32-bit sums give exactly the L_result of the loop below. */
+  {
+    __m128i w0, w1, w2, w3, w4, acc;
+    register word *p;
+    register longword L_result;
+
+    w0 = _mm_loadu_si128 ((const __m128i *) &wt[0]);
+    w1 = _mm_loadu_si128 ((const __m128i *) &wt[8]);
+    w2 = _mm_loadu_si128 ((const __m128i *) &wt[16]);
+    w3 = _mm_loadu_si128 ((const __m128i *) &wt[24]);
+    w4 = _mm_loadu_si128 ((const __m128i *) &wt[32]);
+
+    for (lambda = 40; lambda <= 120; lambda++) {
+      p = dp - lambda;
+      acc = _mm_madd_epi16 (w0, _mm_loadu_si128 ((const __m128i *) &p[0]));
+      acc = _mm_add_epi32 (acc, _mm_madd_epi16 (w1, _mm_loadu_si128 ((const __m128i *) &p[8])));
+      acc = _mm_add_epi32 (acc, _mm_madd_epi16 (w2, _mm_loadu_si128 ((const __m128i *) &p[16])));
+      acc = _mm_add_epi32 (acc, _mm_madd_epi16 (w3, _mm_loadu_si128 ((const __m128i *) &p[24])));
+      acc = _mm_add_epi32 (acc, _mm_madd_epi16 (w4, _mm_loadu_si128 ((const __m128i *) &p[32])));
+      acc = _mm_add_epi32 (acc, _mm_shuffle_epi32 (acc, 0x4E));
+      acc = _mm_add_epi32 (acc, _mm_shuffle_epi32 (acc, 0xB1));
+      L_result = _mm_cvtsi128_si32 (acc);
+
+      if (L_result > L_max) {
+
+        Nc = lambda;
+        L_max = L_result;
+      }
+    }
+  }
+
+#else /* GSM_HAVE_SSE2 */
+
   for (lambda = 40; lambda <= 120; lambda++) {
 
 #ifdef STEP
@@ -182,6 +224,8 @@ static void Calculation_of_the_LTP_parameters P4 ((d, dp, bc_out, Nc_out), regis
     }
   }
 
+#endif /* GSM_HAVE_SSE2 */
+
   *Nc_out = Nc;
 
   L_max <<= 1;
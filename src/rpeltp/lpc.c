@@ -14,6 +14,10 @@
 #include "gsm.h"
 #include "proto.h"
 
+#ifdef GSM_HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
 #undef	P
 
 /*
@@ -91,6 +95,32 @@ static void Autocorrelation P2 ((s, L_ACF), word * s,   /* [0..159] IN/OUT */
 #endif
 
   /* Compute the L_ACF[..]. */
+#ifdef GSM_HAVE_SSE2
+
+  /* |s[k]| <= 2048 after the scaling above, so every product is below
+     2^22 and the sum of the 160 products below 2^30: the 16-bit
+     multiply-adds with 32-bit sums give exactly the L_ACF[] of the STEP()
+     chain below. The samples before s[0] are taken as zero. */
+  {
+    word z[8 + 160];
+    __m128i acc;
+
+    for (i = 0; i < 8; i++)
+      z[i] = 0;
+    for (i = 0; i <= 159; i++)
+      z[8 + i] = s[i];
+
+    for (k = 0; k <= 8; k++) {
+      acc = _mm_setzero_si128 ();
+      for (i = 0; i <= 159; i += 8)
+        acc = _mm_add_epi32 (acc, _mm_madd_epi16 (_mm_loadu_si128 ((const __m128i *) &z[8 + i]), _mm_loadu_si128 ((const __m128i *) &z[8 + i - k])));
+      acc = _mm_add_epi32 (acc, _mm_shuffle_epi32 (acc, 0x4E));
+      acc = _mm_add_epi32 (acc, _mm_shuffle_epi32 (acc, 0xB1));
+      L_ACF[k] = (longword) _mm_cvtsi128_si32 (acc) << 1;
+    }
+  }
+
+#else /* GSM_HAVE_SSE2 */
   {
 #ifdef	USE_FLOAT_MUL
     register float *sp = float_s;
@@ -168,6 +198,7 @@ static void Autocorrelation P2 ((s, L_ACF), word * s,   /* [0..159] IN/OUT */
     for (k = 9; k--; L_ACF[k] <<= 1);
 
   }
+#endif /* GSM_HAVE_SSE2 */
   /* Rescaling of the array s[0..159] */
   if (scalauto > 0) {
     assert (scalauto <= 4);
@@ -59,6 +59,19 @@ struct gsm_state {
 /* >> is a signed arithmetic shift right */
 #define	SASR(x, by)	((x) >> (by))
 
+/*
+ *  SSE2 code of the integer version (long_ter.c, lpc.c, short_te.c),
+ *  unless GSM_SCALAR is defined
+ */
+#if !defined(USE_TABLE_MUL) && !defined(USE_FLOAT_MUL) && !defined(GSM_SCALAR) && \
+    (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define	GSM_HAVE_SSE2
+#endif
+
+/* Channels processed together by the short term filters of the
+   multi-channel coder and decoder (Gsm_Coder_N, Gsm_Decoder_N) */
+#define	GSM_LANES	8
+
 
 #include "proto.h"
 
@@ -201,6 +214,33 @@ extern void Gsm_Update_of_reconstructed_short_time_residual_signal P ((word * dp
                                                                        word * ep,       /* [0...39] IN */
                                                                        word * dp));     /* [-120...-1] IN/OUT */
 
+/*
+ *  Multi-channel versions: n channels, each with its own state S[c], and
+ *  the arrays of the channels one after the other (e.g. s[160*c+k])
+ */
+extern void Gsm_Coder_N P ((struct gsm_state ** S, int n, word * s,     /* [n][160] samples IN */
+                            word * LARc,        /* [n][8] LAR coefficients OUT */
+                            word * Nc,  /* [n][4] LTP lag OUT */
+                            word * bc,  /* [n][4] coded LTP gain OUT */
+                            word * Mc,  /* [n][4] RPE grid selection OUT */
+                            word * xmaxc,       /* [n][4] Coded maximum amplitude OUT */
+                            word * xMc /* [n][13*4] normalized RPE samples OUT */ ));
+
+extern void Gsm_Decoder_N P ((struct gsm_state ** S, int n, word * LARcr,       /* [n][8] IN */
+                              word * Ncr,       /* [n][4] IN */
+                              word * bcr,       /* [n][4] IN */
+                              word * Mcr,       /* [n][4] IN */
+                              word * xmaxcr,    /* [n][4] IN */
+                              word * xMcr,      /* [n][13*4] IN */
+                              word * s));       /* [n][160] OUT */
+
+extern void Gsm_Short_Term_Analysis_Filter_N P ((struct gsm_state ** S, int n, word * LARc,     /* [n][8] IN */
+                                                 word * d /* [n][160] IN/OUT */ ));
+
+extern void Gsm_Short_Term_Synthesis_Filter_N P ((struct gsm_state ** S, int n, word * LARcr,   /* [n][8] IN */
+                                                  word * wt,    /* [n][160] IN */
+                                                  word * s));   /* [n][160] OUT */
+
 /*
  *  Tables from table.c
  */
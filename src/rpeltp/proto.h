@@ -41,6 +41,7 @@
 #undef	P6
 #undef	P7
 #undef	P8
+#undef	P9
 #endif /* gnuc prototypes */
 
 #ifdef NeedFunctionPrototypes
@@ -56,6 +57,7 @@
 #	define	P6(x, a, b, c, d, e, f)		(a, b, c, d, e, f)
 #	define	P7(x, a, b, c, d, e, f, g)	(a, b, c, d, e, f, g)
 #	define	P8(x, a, b, c, d, e, f, g, h)	(a, b, c, d, e, f, g, h)
+#	define	P9(x, a, b, c, d, e, f, g, h, i)	(a, b, c, d, e, f, g, h, i)
 
 #else /* !NeedFunctionPrototypes */
 
@@ -70,6 +72,7 @@
 #	define	P6(x, a, b, c, d, e, f)		x a; b; c; d; e; f;
 #	define	P7(x, a, b, c, d, e, f, g)	x a; b; c; d; e; f; g;
 #	define	P8(x, a, b, c, d, e, f, g, h)	x a; b; c; d; e; f; g; h;
+#	define	P9(x, a, b, c, d, e, f, g, h, i)	x a; b; c; d; e; f; g; h; i;
 
 #endif /* !NeedFunctionPrototypes */
 
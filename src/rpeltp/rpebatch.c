@@ -0,0 +1,368 @@
+/*                                                         v1.1 - 17/Oct/2026
+  ============================================================================
+
+  RPEBATCH.C
+  ~~~~~~~~~~
+
+  Description:
+  ~~~~~~~~~~~~
+
+  Batch driver for the UGST/ITU-T RPE-LTP module: encodes or decodes all
+  the files of a list with a pool of worker threads, and reports the
+  aggregate throughput.
+
+  Every worker keeps up to 8 files open at the same time, each with its
+  own state variable, and processes one frame of each of them with one
+  call to rpeltp_encode_n() or rpeltp_decode_n(), so that the short term
+  filters of the files run together in SIMD lanes. When a file ends, the
+  next file of the worker takes its place.
+
+  The output files are identical to the ones of rpedemo -enc and
+  rpedemo -dec with the same format option: only the complete blocks of
+  160 samples (encoder) or of 76 words (decoder) are processed.
+
+  The list file has one pair "InpFile OutFile" per line; "#" starts a
+  comment. A worker takes the next file of the list whenever one of its
+  lanes is free (see ugst-batch.c).
+
+  Usage:
+  ~~~~~~
+  $ rpebatch [-options] ListFile
+
+  Options:
+  -enc        Encode the listed files (default)
+  -dec        Decode the listed files
+  -l          Samples in linear format (default)
+  -A          Samples in A-law (G.711) format
+  -u          Samples in u-law (G.711) format
+  -threads #  Number of worker threads. Default is 4
+  -q          Quiet operation: only the summary is printed
+  -h/-help    print help message
+
+  Output:
+  ~~~~~~~
+  One CSV line per file (file,output,frames,status), in the order of the
+  list, followed by the number of files, the audio duration, the
+  wall-clock and CPU times and the speed relative to real time.
+
+  Exit value:
+  ~~~~~~~~~~~
+  0 when all the files were processed, 1 otherwise.
+
+  History:
+  ~~~~~~~~
+  17.Oct.26  v1.0       Created.
+  17.Oct.26  v1.1       List, threads and clock from ugst-batch.c; the
+                        files are taken from a shared queue.
+  ============================================================================
+*/
+
+
+/* ..... General definitions for UGST demo programs ..... */
+#include "ugstdemo.h"
+
+/* ..... General include ..... */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* ..... RPE-LTP module definitions ..... */
+#include "private.h"
+#include "gsm.h"
+#include "rpeltp.h"
+
+/* ..... G.711 module definitions ..... */
+#include "g711.h"
+
+/* ..... Batch processing of lists of files ..... */
+#include "ugst-batch.h"
+
+/* ..... Local definitions ..... */
+#define LINEAR 0                /* binary: 00 */
+#define U_LAW 1                 /* binary: 01 */
+#define A_LAW 3                 /* binary: 11 */
+
+/* Parameters common to all the files of a batch */
+typedef struct {
+  int decode;                   /* 0 for encoding, 1 for decoding */
+  char format;                  /* LINEAR, U_LAW or A_LAW */
+} RPEB_PARAM;
+
+/* One file of a batch */
+typedef struct {
+  char *FileIn, *FileOut;
+  long frames;                  /* processed frames */
+  int status;                   /* UGST_BATCH_OK, or an error status */
+} RPEB_JOB;
+
+/* Data shared by the worker threads */
+typedef struct {
+  RPEB_PARAM *par;
+  RPEB_JOB *job;
+} RPEB_BATCH;
+
+/* A file being processed by a worker */
+typedef struct {
+  RPEB_JOB *job;                /* NULL when the lane is free */
+  FILE *Fi, *Fo;
+  gsm state;
+} RPEB_LANE;
+
+
+void display_usage () {
+  printf ("\n\n");
+  printf ("\n***************************************************************");
+  printf ("\n* BATCH PROCESSING OF THE GSM 06.10 RPE-LTP SPEECH CODER      *");
+  printf ("\n***************************************************************\n\n");
+
+  printf ("USAGE: \n");
+  printf ("  rpebatch [-enc|-dec] [-l|-A|-u] [-threads #] [-q] ListFile\n\n");
+  printf ("  ListFile has one pair \"InpFile OutFile\" per line.\n\n");
+
+  exit (-128);
+}
+
+/* .................... End of display_usage() ........................... */
+
+
+/* Opens the files of a job in a free lane; returns 0 on failure */
+static int open_lane (RPEB_LANE * lane, RPEB_JOB * job) {
+  if ((lane->Fi = fopen (job->FileIn, RB)) == NULL) {
+    job->status = UGST_BATCH_OPEN_ERROR;
+    return 0;
+  }
+  if ((lane->Fo = fopen (job->FileOut, WB)) == NULL) {
+    job->status = UGST_BATCH_CREATE_ERROR;
+    fclose (lane->Fi);
+    return 0;
+  }
+  if ((lane->state = rpeltp_init ()) == NULL) {
+    job->status = UGST_BATCH_STATE_ERROR;
+    fclose (lane->Fi);
+    fclose (lane->Fo);
+    return 0;
+  }
+  lane->job = job;
+  return 1;
+}
+
+/* Closes the files of a lane and frees it */
+static void close_lane (RPEB_LANE * lane) {
+  fclose (lane->Fi);
+  if (fclose (lane->Fo) != 0 && lane->job->status == UGST_BATCH_OK)
+    lane->job->status = UGST_BATCH_WRITE_ERROR;
+  rpeltp_delete (lane->state);
+  lane->job = NULL;
+}
+
+
+/*
+  ============================================================================
+
+       void process_files (UGST_BATCH *b);
+       ~~~~~~~~~~~~~~~~~~
+
+       Worker of the pool: encodes or decodes the files handed out by
+       ugst_batch_next(), one frame of up to GSM_LANES files per call of
+       rpeltp_encode_n() or rpeltp_decode_n().
+
+       Log of changes
+       ~~~~~~~~~~~~~~
+       17.Oct.26	v1.0	Creation.
+       17.Oct.26	v1.1	Files taken from the shared queue of b.
+
+  ============================================================================
+*/
+void process_files (UGST_BATCH * b) {
+  RPEB_PARAM *par = ((RPEB_BATCH *) b->data)->par;
+  RPEB_JOB *job = ((RPEB_BATCH *) b->data)->job;
+  RPEB_LANE lane[GSM_LANES];
+  gsm state[GSM_LANES];
+  int used[GSM_LANES];          /* lane of each channel of the call */
+  short inp_buf[GSM_LANES * RPE_WIND_SIZE], out_buf[GSM_LANES * RPE_WIND_SIZE];
+  short rpe_frame[GSM_LANES * RPE_FRAME_SIZE], tmp_buf[RPE_WIND_SIZE];
+  long next, inp_len, out_len;
+  int l, n, busy;
+  short *inp, *out;
+
+  /* G.711 Compression/expansion function pointers */
+  void (*compress) () = NULL, (*expand) () = NULL;
+
+  if (par->format == A_LAW) {
+    expand = alaw_expand;
+    compress = alaw_compress;
+  } else if (par->format == U_LAW) {
+    expand = ulaw_expand;
+    compress = ulaw_compress;
+  }
+  inp_len = par->decode ? RPE_FRAME_SIZE : RPE_WIND_SIZE;
+  out_len = par->decode ? RPE_WIND_SIZE : RPE_FRAME_SIZE;
+  inp = par->decode ? rpe_frame : inp_buf;
+  out = par->decode ? out_buf : rpe_frame;
+
+  for (l = 0; l < GSM_LANES; l++)
+    lane[l].job = NULL;
+
+  for (;;) {
+    /* Give the next files to the free lanes */
+    busy = 0;
+    for (l = 0; l < GSM_LANES; l++) {
+      while (lane[l].job == NULL && (next = ugst_batch_next (b)) >= 0)
+        open_lane (&lane[l], &job[next]);
+      busy += lane[l].job != NULL;
+    }
+    if (busy == 0)
+      break;
+
+    /* Read a block of every file; the files without a complete block end */
+    for (l = n = 0; l < GSM_LANES; l++) {
+      if (lane[l].job == NULL)
+        continue;
+      if (fread (inp + n * inp_len, sizeof (short), inp_len, lane[l].Fi) != (size_t) inp_len) {
+        close_lane (&lane[l]);
+        continue;
+      }
+      if (!par->decode && par->format) {
+        memcpy (tmp_buf, inp + n * inp_len, sizeof (short) * RPE_WIND_SIZE);
+        expand (RPE_WIND_SIZE, tmp_buf, inp + n * inp_len);
+      }
+      state[n] = lane[l].state;
+      used[n++] = l;
+    }
+    if (n == 0)
+      continue;
+
+    /* One frame of every file */
+    if (par->decode)
+      rpeltp_decode_n (state, rpe_frame, out_buf, n);
+    else
+      rpeltp_encode_n (state, inp_buf, rpe_frame, n);
+
+    /* Save the frames or the samples */
+    for (l = 0; l < n; l++) {
+      if (par->decode && par->format) {
+        memcpy (tmp_buf, out + l * out_len, sizeof (short) * RPE_WIND_SIZE);
+        compress (RPE_WIND_SIZE, tmp_buf, out + l * out_len);
+      }
+      lane[used[l]].job->frames++;
+      if (fwrite (out + l * out_len, sizeof (short), out_len, lane[used[l]].Fo) != (size_t) out_len) {
+        lane[used[l]].job->status = UGST_BATCH_WRITE_ERROR;
+        close_lane (&lane[used[l]]);
+      }
+    }
+  }
+}
+
+/* ...................... End of process_files() .......................... */
+
+
+/*
+**************************************************************************
+***                                                                    ***
+***        Batch program for encoding or decoding lists of files       ***
+***                                                                    ***
+**************************************************************************
+*/
+int main (int argc, char *argv[]) {
+  RPEB_PARAM par;
+  RPEB_BATCH data;
+  UGST_BATCH b;
+  UGST_BATCH_FILE *files;
+  RPEB_JOB *job;
+  long njob, frames = 0, i;
+  int threads = 4, fail = 0;
+  char quiet = 0;
+  double t0, wall, cpu, audio;
+  clock_t c0;
+
+  par.decode = 0;
+  par.format = LINEAR;
+
+  /* GETTING OPTIONS */
+  if (argc < 2)
+    display_usage ();
+  while (argc > 1 && argv[1][0] == '-')
+    if (strcmp (argv[1], "-enc") == 0 || strcmp (argv[1], "-dec") == 0) {
+      par.decode = argv[1][1] == 'd';
+      argv++;
+      argc--;
+    } else if (strcmp (argv[1], "-l") == 0) {
+      par.format = LINEAR;
+      argv++;
+      argc--;
+    } else if (strcmp (argv[1], "-A") == 0 || strcmp (argv[1], "-a") == 0) {
+      par.format = A_LAW;
+      argv++;
+      argc--;
+    } else if (strcmp (argv[1], "-u") == 0) {
+      par.format = U_LAW;
+      argv++;
+      argc--;
+    } else if (strcmp (argv[1], "-q") == 0) {
+      quiet = 1;
+      argv++;
+      argc--;
+    } else if (strcmp (argv[1], "-threads") == 0 && argc > 2) {
+      threads = atoi (argv[2]);
+      if (threads < 1 || threads > UGST_BATCH_MAX_THREADS) {
+        fprintf (stderr, "ERROR! Invalid number of threads \"%s\" (1..%d)\n\n", argv[2], UGST_BATCH_MAX_THREADS);
+        display_usage ();
+      }
+      argv += 2;
+      argc -= 2;
+    } else if (strcmp (argv[1], "-h") == 0 || strcmp (argv[1], "-help") == 0) {
+      display_usage ();
+    } else {
+      fprintf (stderr, "ERROR! Invalid option \"%s\" in command line\n\n", argv[1]);
+      display_usage ();
+    }
+  if (argc != 2)
+    display_usage ();
+
+  /* Read the list of files */
+  if ((njob = ugst_batch_read_list (argv[1], &files)) < 0)
+    exit (1);
+  if ((job = (RPEB_JOB *) calloc (njob + 1, sizeof (RPEB_JOB))) == NULL)
+    HARAKIRI ("Can't allocate memory for the list of files\n", 1);
+  for (i = 0; i < njob; i++) {
+    job[i].FileIn = files[i].FileIn;
+    job[i].FileOut = files[i].FileOut;
+  }
+
+  /* Run the workers */
+  data.par = &par;
+  data.job = job;
+  t0 = ugst_batch_clock ();
+  c0 = clock ();
+  if ((threads = ugst_batch_run (&b, njob, threads, process_files, &data)) < 0)
+    HARAKIRI ("Unable to create thread\n", 1);
+  wall = ugst_batch_clock () - t0;
+  cpu = (double) (clock () - c0) / CLOCKS_PER_SEC;
+
+  /* Report, in the order of the list */
+  if (!quiet)
+    printf ("file,output,frames,status\n");
+  for (i = 0; i < njob; i++) {
+    if (!quiet)
+      printf ("%s,%s,%ld,%s\n", job[i].FileIn, job[i].FileOut, job[i].frames, ugst_batch_status (job[i].status));
+    if (job[i].status != UGST_BATCH_OK) {
+      if (quiet)
+        fprintf (stderr, "%s: %s\n", job[i].FileIn, ugst_batch_status (job[i].status));
+      fail++;
+    }
+    frames += job[i].frames;
+  }
+  audio = (double) frames *RPE_WIND_SIZE / 8000.0;
+  printf ("# %s %ld files (%d failed), %ld frames, %.1f s of audio, %d threads\n", par.decode ? "Decoded" : "Encoded", njob, fail, frames, audio, threads);
+  printf ("# wall %.3f s, cpu %.3f s", wall, cpu);
+  if (wall > 0)
+    printf (", %.1f x real time", audio / wall);
+  printf ("\n");
+
+  free (job);
+  free (files);
+  return fail ? 1 : 0;
+}
+
+/* ............................. end of main() ............................. */
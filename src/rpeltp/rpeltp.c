@@ -54,6 +54,14 @@ rpeltp_encode ......... Entry-level function for the encoding algorithm.
 
 rpeltp_decode ......... Entry-level function for the decoding algorithm.
 
+rpeltp_encode_n ....... Encodes one frame of each of n channels.
+
+rpeltp_decode_n ....... Decodes one frame of each of n channels.
+
+HISTORY:
+  17.Oct.2026 v1.1  Added the multi-channel rpeltp_encode_n() and
+                    rpeltp_decode_n().
+
 ============================================================================
 */
 #include <stdio.h>              /* For NULL */
@@ -277,4 +285,155 @@ void rpeltp_decode (rpe_state, rpe_frame, out_buf)
 
 /* ................... End of rpeltp_decode() ......................... */
 
+/* Number of bits of the 76 parameters of a frame (Table 1.1 of GSM 06.10) */
+static int rpe_bits[RPE_FRAME_SIZE] = {
+  6, 6, 5, 5, 4, 4, 3, 3,
+  7, 2, 2, 6, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  7, 2, 2, 6, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  7, 2, 2, 6, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  7, 2, 2, 6, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3
+};
+
+
+/*
+  ------------------------------------------------------------------------
+  void rpeltp_encode_n (gsm *rpe_state, short *inp_buf, short *rpe_frame,
+  ~~~~~~~~~~~~~~~~~~~~  int n);
+
+  Description:
+  ~~~~~~~~~~~~
+  Encodes one frame of each of n channels, as n calls to rpeltp_encode()
+  with the state rpe_state[c], the input inp_buf+160*c and the frame
+  rpe_frame+76*c; the frames are identical to the ones of rpeltp_encode().
+  The short term analysis filters of 8 channels run together in SIMD
+  lanes, when the SSE2 instructions are available.
+
+  The states must be different from each other, but the channels may be
+  at different positions of their signals.
+
+  Variables:
+  ~~~~~~~~~~
+  rpe_state ... n state variables initialized by rpeltp_init()
+  inp_buf ..... n buffers of 160 16-bit, left aligned samples
+  rpe_frame ... n rpe-ltp encoded frame buffers of 76 right-aligned samples
+  n ........... number of channels
+
+  Return value:
+  ~~~~~~~~~~~~~
+  None.
+
+  Prototype: in rpeltp.h
+  ~~~~~~~~~~
+
+  Log of changes:
+  ~~~~~~~~~~~~~~~
+  17.Oct.26  v.1.0	created.
+
+  ------------------------------------------------------------------------
+*/
+void rpeltp_encode_n (rpe_state, inp_buf, rpe_frame, n)
+     gsm *rpe_state;
+     short *inp_buf, *rpe_frame;
+     int n;
+{
+  word LARc[8 * GSM_LANES], Nc[4 * GSM_LANES], bc[4 * GSM_LANES];
+  word Mc[4 * GSM_LANES], xmaxc[4 * GSM_LANES], xmc[52 * GSM_LANES];
+  word *par;
+  int c, i, j, m;
+
+  for (; n > 0; n -= m, rpe_state += m, inp_buf += m * RPE_WIND_SIZE) {
+    m = n < GSM_LANES ? n : GSM_LANES;
+
+    Gsm_Coder_N (rpe_state, m, inp_buf, LARc, Nc, bc, Mc, xmaxc, xmc);
+
+    /* Parameters in the order of Table 1.1, as gsm_encode() and gsm_explode() */
+    for (c = 0; c < m; c++, rpe_frame += RPE_FRAME_SIZE) {
+      for (i = 0; i < 8; i++)
+        rpe_frame[i] = LARc[8 * c + i];
+      for (j = 0; j < 4; j++) {
+        par = rpe_frame + 8 + 17 * j;
+        par[0] = Nc[4 * c + j];
+        par[1] = bc[4 * c + j];
+        par[2] = Mc[4 * c + j];
+        par[3] = xmaxc[4 * c + j];
+        for (i = 0; i < 13; i++)
+          par[4 + i] = xmc[52 * c + 13 * j + i];
+      }
+      for (i = 0; i < RPE_FRAME_SIZE; i++)
+        rpe_frame[i] &= (1 << rpe_bits[i]) - 1;
+    }
+  }
+}
+
+/* ................... End of rpeltp_encode_n() ......................... */
+
+
+/*
+  ------------------------------------------------------------------------
+  void rpeltp_decode_n (gsm *rpe_state, short *rpe_frame, short *out_buf,
+  ~~~~~~~~~~~~~~~~~~~~  int n);
+
+  Description:
+  ~~~~~~~~~~~~
+  Decodes one frame of each of n channels, as n calls to rpeltp_decode()
+  with the state rpe_state[c], the frame rpe_frame+76*c and the output
+  out_buf+160*c; the decoded samples are identical to the ones of
+  rpeltp_decode(). The short term synthesis filters of 8 channels run
+  together in SIMD lanes, when the SSE2 instructions are available.
+
+  Variables:
+  ~~~~~~~~~~
+  rpe_state ... n state variables initialized by rpeltp_init()
+  rpe_frame ... n rpe-ltp encoded frame buffers of 76 right-aligned samples
+  out_buf ..... n buffers for 160 decoded 16-bit, left aligned samples
+  n ........... number of channels
+
+  Return value:
+  ~~~~~~~~~~~~~
+  None.
+
+  Prototype: in rpeltp.h
+  ~~~~~~~~~~
+
+  Log of changes:
+  ~~~~~~~~~~~~~~~
+  17.Oct.26  v.1.0	created.
+
+  ------------------------------------------------------------------------
+*/
+void rpeltp_decode_n (rpe_state, rpe_frame, out_buf, n)
+     gsm *rpe_state;
+     short *rpe_frame, *out_buf;
+     int n;
+{
+  word LARc[8 * GSM_LANES], Nc[4 * GSM_LANES], bc[4 * GSM_LANES];
+  word Mc[4 * GSM_LANES], xmaxc[4 * GSM_LANES], xmc[52 * GSM_LANES];
+  word par[RPE_FRAME_SIZE];
+  int c, i, j, m;
+
+  for (; n > 0; n -= m, rpe_state += m, out_buf += m * RPE_WIND_SIZE) {
+    m = n < GSM_LANES ? n : GSM_LANES;
+
+    /* Only the bits of each parameter are kept, as gsm_implode() */
+    for (c = 0; c < m; c++, rpe_frame += RPE_FRAME_SIZE) {
+      for (i = 0; i < RPE_FRAME_SIZE; i++)
+        par[i] = rpe_frame[i] & ((1 << rpe_bits[i]) - 1);
+      for (i = 0; i < 8; i++)
+        LARc[8 * c + i] = par[i];
+      for (j = 0; j < 4; j++) {
+        Nc[4 * c + j] = par[8 + 17 * j];
+        bc[4 * c + j] = par[9 + 17 * j];
+        Mc[4 * c + j] = par[10 + 17 * j];
+        xmaxc[4 * c + j] = par[11 + 17 * j];
+        for (i = 0; i < 13; i++)
+          xmc[52 * c + 13 * j + i] = par[12 + 17 * j + i];
+      }
+    }
+
+    Gsm_Decoder_N (rpe_state, m, LARc, Nc, bc, Mc, xmaxc, xmc, out_buf);
+  }
+}
+
+/* ................... End of rpeltp_decode_n() ......................... */
+
 /* -------------------------- END OF RPELTP.C ------------------------ */
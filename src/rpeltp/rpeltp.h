@@ -23,6 +23,11 @@ gsm rpeltp_init ARGS ((void));
 void rpeltp_encode ARGS ((gsm rpe_state, short *inp_buf, short *rpe_frame));
 void rpeltp_decode ARGS ((gsm rpe_state, short *rpe_frame, short *out_buf));
 
+/* One frame of each of n channels: inp_buf and out_buf have n*160 samples,
+   rpe_frame n*76 words, and every channel has its own state rpe_state[c] */
+void rpeltp_encode_n ARGS ((gsm * rpe_state, short *inp_buf, short *rpe_frame, int n));
+void rpeltp_decode_n ARGS ((gsm * rpe_state, short *rpe_frame, short *out_buf, int n));
+
 /* Alias-function definition */
 #define rpeltp_delete gsm_destroy
 
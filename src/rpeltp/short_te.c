@@ -7,6 +7,7 @@
 /* $Header: /home/kbs/jutta/src/gsm/gsm-1.0/src/RCS/short_term.c,v 1.1 1992/10/28 00:15:50 jutta Exp $ */
 
 #include <stdio.h>
+#include <string.h>
 #include <assert.h>
 
 #include "private.h"
@@ -14,6 +15,10 @@
 #include "gsm.h"
 #include "proto.h"
 
+#ifdef GSM_HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
 /*
  *  SHORT TERM ANALYSIS FILTERING SECTION
  */
@@ -364,3 +369,211 @@ void Gsm_Short_Term_Synthesis_Filter P4 ((S, LARcr, wt, s), struct gsm_state *S,
   LARp_to_rp (LARp);
   FILTER (S, LARp, 120, wt + 40, s + 40);
 }
+
+/*
+ *  MULTI-CHANNEL SHORT TERM FILTERING
+ *
+ *  The filters of up to GSM_LANES channels run together, one channel in
+ *  each 16-bit lane: the samples of the channels are interleaved, and the
+ *  reflection coefficients and the filter states u[0..7] and v[0..8] are
+ *  vectors with one element per channel. The operations of every lane are
+ *  those of Short_term_analysis_filtering() and
+ *  Short_term_synthesis_filtering(), so each channel gets exactly the
+ *  signal of the single-channel filter.
+ */
+
+#ifdef GSM_HAVE_SSE2
+
+/* Segments of the frame with their own interpolated coefficients */
+static int seg_start[4] = { 0, 13, 27, 40 };
+static int seg_len[4] = { 13, 14, 13, 120 };
+
+/* The four sets of reflection coefficients of one frame (4.2.8, 4.2.9) */
+static void Interpolated_rp P3 ((S, LARc, rp), struct gsm_state *S, word * LARc,        /* coded log area ratio [0..7] IN */
+                                word rp[4][8]) {        /* rp of the 4 segments OUT */
+  word *LARpp_j = S->LARpp[S->j];
+  word *LARpp_j_1 = S->LARpp[S->j ^= 1];
+
+  Decoding_of_the_coded_Log_Area_Ratios (LARc, LARpp_j);
+
+  Coefficients_0_12 (LARpp_j_1, LARpp_j, rp[0]);
+  LARp_to_rp (rp[0]);
+  Coefficients_13_26 (LARpp_j_1, LARpp_j, rp[1]);
+  LARp_to_rp (rp[1]);
+  Coefficients_27_39 (LARpp_j_1, LARpp_j, rp[2]);
+  LARp_to_rp (rp[2]);
+  Coefficients_40_159 (LARpp_j, rp[3]);
+  LARp_to_rp (rp[3]);
+}
+
+/*
+ *  GSM_MULT_R() of 8 lanes: the high half of the product, doubled, with
+ *  bit 15 and the rounding bit 14 of the low half. Only MIN_WORD * MIN_WORD
+ *  saturates the doubling, to MAX_WORD as gsm_mult_r(). The rp[] of
+ *  LARp_to_rp() are never MIN_WORD, so the other products are exact.
+ */
+static __m128i Mult_r_8 P2 ((a, b), __m128i a, __m128i b) {
+  __m128i hi = _mm_mulhi_epi16 (a, b);
+  __m128i lo = _mm_mullo_epi16 (a, b);
+  __m128i r = _mm_or_si128 (_mm_adds_epi16 (hi, hi), _mm_srli_epi16 (lo, 15));
+
+  return _mm_adds_epi16 (r, _mm_and_si128 (_mm_srli_epi16 (lo, 14), _mm_set1_epi16 (1)));
+}
+
+/* Short_term_analysis_filtering() of 8 interleaved channels */
+static void Short_term_analysis_filtering_8 P4 ((u, rp, k_n, s), __m128i * u, /* [0..7] IN/OUT */
+                                                word rp[8][GSM_LANES],  /* [0..7] IN */
+                                                int k_n,        /* k_end - k_start */
+                                                word * s        /* [0..n-1][lanes] IN/OUT */
+  ) {
+  __m128i r[8], di, sav, ui;
+  int i;
+
+  for (i = 0; i < 8; i++)
+    r[i] = _mm_loadu_si128 ((const __m128i *) rp[i]);
+
+  for (; k_n--; s += GSM_LANES) {
+
+    di = sav = _mm_loadu_si128 ((const __m128i *) s);
+
+    for (i = 0; i < 8; i++) {
+      ui = u[i];
+      u[i] = sav;
+      sav = _mm_adds_epi16 (ui, Mult_r_8 (r[i], di));
+      di = _mm_adds_epi16 (di, Mult_r_8 (r[i], ui));
+    }
+
+    _mm_storeu_si128 ((__m128i *) s, di);
+  }
+}
+
+/* Short_term_synthesis_filtering() of 8 interleaved channels */
+static void Short_term_synthesis_filtering_8 P5 ((v, rrp, k, wt, sr), __m128i * v,    /* [0..8] IN/OUT */
+                                                 word rrp[8][GSM_LANES],        /* [0..7] IN */
+                                                 int k, /* k_end - k_start */
+                                                 word * wt,     /* [0..k-1][lanes] IN */
+                                                 word * sr      /* [0..k-1][lanes] OUT */
+  ) {
+  __m128i r[8], sri;
+  int i;
+
+  for (i = 0; i < 8; i++)
+    r[i] = _mm_loadu_si128 ((const __m128i *) rrp[i]);
+
+  for (; k--; wt += GSM_LANES, sr += GSM_LANES) {
+    sri = _mm_loadu_si128 ((const __m128i *) wt);
+    for (i = 8; i--;) {
+      sri = _mm_subs_epi16 (sri, Mult_r_8 (r[i], v[i]));
+      v[i + 1] = _mm_adds_epi16 (v[i], Mult_r_8 (r[i], sri));
+    }
+    _mm_storeu_si128 ((__m128i *) sr, v[0] = sri);
+  }
+}
+
+/* Interleaves the 160 samples of n channels; the unused lanes are zero */
+static void Interleave P3 ((n, x, xi), int n, word * x, /* [n][160] IN */
+                           word * xi) { /* [160][lanes] OUT */
+  int c, k;
+
+  for (k = 0; k < 160; k++)
+    for (c = 0; c < GSM_LANES; c++)
+      xi[k * GSM_LANES + c] = c < n ? x[c * 160 + k] : 0;
+}
+
+static void Deinterleave P3 ((n, xi, x), int n, word * xi,      /* [160][lanes] IN */
+                             word * x) {        /* [n][160] OUT */
+  int c, k;
+
+  for (c = 0; c < n; c++)
+    for (k = 0; k < 160; k++)
+      x[c * 160 + k] = xi[k * GSM_LANES + c];
+}
+
+#endif /* GSM_HAVE_SSE2 */
+
+void Gsm_Short_Term_Analysis_Filter_N P4 ((S, n, LARc, s), struct gsm_state **S, int n, word * LARc,   /* coded log area ratios [n][8] IN */
+                                          word * s      /* signals [n][160] IN/OUT */
+  ) {
+#ifdef GSM_HAVE_SSE2
+  word rp[4][8], rpl[4][8][GSM_LANES], ul[8][GSM_LANES], si[160 * GSM_LANES];
+  __m128i u[8];
+  int c, g, i, m;
+
+  for (; n > 0; n -= m, S += m, LARc += 8 * m, s += 160 * m) {
+    m = n < GSM_LANES ? n : GSM_LANES;
+
+    memset ((char *) rpl, 0, sizeof (rpl));
+    memset ((char *) ul, 0, sizeof (ul));
+    for (c = 0; c < m; c++) {
+      Interpolated_rp (S[c], LARc + 8 * c, rp);
+      for (g = 0; g < 4; g++)
+        for (i = 0; i < 8; i++)
+          rpl[g][i][c] = rp[g][i];
+      for (i = 0; i < 8; i++)
+        ul[i][c] = S[c]->u[i];
+    }
+    for (i = 0; i < 8; i++)
+      u[i] = _mm_loadu_si128 ((const __m128i *) ul[i]);
+
+    Interleave (m, s, si);
+    for (g = 0; g < 4; g++)
+      Short_term_analysis_filtering_8 (u, rpl[g], seg_len[g], si + seg_start[g] * GSM_LANES);
+    Deinterleave (m, si, s);
+
+    for (i = 0; i < 8; i++)
+      _mm_storeu_si128 ((__m128i *) ul[i], u[i]);
+    for (c = 0; c < m; c++)
+      for (i = 0; i < 8; i++)
+        S[c]->u[i] = ul[i][c];
+  }
+#else
+  int c;
+
+  for (c = 0; c < n; c++)
+    Gsm_Short_Term_Analysis_Filter (S[c], LARc + 8 * c, s + 160 * c);
+#endif /* GSM_HAVE_SSE2 */
+}
+
+void Gsm_Short_Term_Synthesis_Filter_N P5 ((S, n, LARcr, wt, s), struct gsm_state **S, int n, word * LARcr,    /* received log area ratios [n][8] IN */
+                                           word * wt,   /* received d [n][160] IN */
+                                           word * s     /* signals s [n][160] OUT */
+  ) {
+#ifdef GSM_HAVE_SSE2
+  word rp[4][8], rpl[4][8][GSM_LANES], vl[9][GSM_LANES], wti[160 * GSM_LANES], si[160 * GSM_LANES];
+  __m128i v[9];
+  int c, g, i, m;
+
+  for (; n > 0; n -= m, S += m, LARcr += 8 * m, wt += 160 * m, s += 160 * m) {
+    m = n < GSM_LANES ? n : GSM_LANES;
+
+    memset ((char *) rpl, 0, sizeof (rpl));
+    memset ((char *) vl, 0, sizeof (vl));
+    for (c = 0; c < m; c++) {
+      Interpolated_rp (S[c], LARcr + 8 * c, rp);
+      for (g = 0; g < 4; g++)
+        for (i = 0; i < 8; i++)
+          rpl[g][i][c] = rp[g][i];
+      for (i = 0; i < 9; i++)
+        vl[i][c] = S[c]->v[i];
+    }
+    for (i = 0; i < 9; i++)
+      v[i] = _mm_loadu_si128 ((const __m128i *) vl[i]);
+
+    Interleave (m, wt, wti);
+    for (g = 0; g < 4; g++)
+      Short_term_synthesis_filtering_8 (v, rpl[g], seg_len[g], wti + seg_start[g] * GSM_LANES, si + seg_start[g] * GSM_LANES);
+    Deinterleave (m, si, s);
+
+    for (i = 0; i < 9; i++)
+      _mm_storeu_si128 ((__m128i *) vl[i], v[i]);
+    for (c = 0; c < m; c++)
+      for (i = 0; i < 9; i++)
+        S[c]->v[i] = vl[i][c];
+  }
+#else
+  int c;
+
+  for (c = 0; c < n; c++)
+    Gsm_Short_Term_Synthesis_Filter (S[c], LARcr + 8 * c, wt + 160 * c, s + 160 * c);
+#endif /* GSM_HAVE_SSE2 */
+}
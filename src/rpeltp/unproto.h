@@ -19,5 +19,6 @@
 #undef	P6
 #undef	P7
 #undef	P8
+#undef	P9
 
 #endif /* PROTO_H */
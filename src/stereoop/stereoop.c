@@ -17,6 +17,10 @@ v1.02 Sept 4, 2009:
                                            Jonas Svedberg, Ericsson AB
 v1.03 Feb  2, 2010:
   modified maximum filename length to avoid buffer overruns (y.hiwasaki)
+
+v1.04 Oct 17, 2026:
+  files read and written in large blocks with the ugst-io module (input
+  files memory-mapped), instead of one sample per fread/fwrite call
 */
 
 #include "ugstdemo.h"           /* general UGST definitions and DEFINES */
@@ -25,14 +29,16 @@ v1.03 Feb  2, 2010:
 #include <math.h>
 #include <stdlib.h>
 #include <string.h>             /* memset, strcmp */
+#include "ugst-io.h"            /* block I/O of sample files */
 
 /* ..... Definitions used by the program ..... */
-#define VERSION        "stereoop.c 1.03 Feb 2, 2010"
+#define VERSION        "stereoop.c 1.04 Oct 17, 2026"
 #define MAX_STR        1024
 #define MAX_OFILES     2
 #define MAX_IFILES     2
 #define MAX16      32767
 #define MIN16     -32768
+#define BLOCK_LEN  UGST_IO_BLOCK   /* samples per channel and block */
 
 enum Mode { NONE = -1,
   INTER,
@@ -98,16 +104,18 @@ short n_infiles[N_MODES] = { 2, 1, 1, 1, 1, 1 };
 short n_outfiles[N_MODES] = { 1, 2, 1, 1, 1, 1 };
 
 int main (int argc, char *argv[]) {
-  FILE *Fif[MAX_IFILES];        /* Pointer to input files */
-  FILE *Fof[MAX_OFILES];        /* Pointer to output files */
+  UGST_IO *Fif[MAX_IFILES];     /* Pointer to input files */
+  UGST_IO *Fof[MAX_OFILES];     /* Pointer to output files */
   char ifname[MAX_IFILES][MAX_STRLEN];  /* Input file names */
   char ofname[MAX_OFILES][MAX_STRLEN];  /* Output file names */
   char tmp_str[MAX_STR];
   long cnt_samples = 0;
   int quiet = 0;
   enum Mode mode = NONE;
-  int i, n_in, n_out;
-  short tmp_short[2], tmp_short_1ch[1];
+  int i;
+  long k, n_in, n_in2;
+  short *in_l, *in_lr;          /* input blocks */
+  short *out_1, *out_2;         /* output blocks */
   double tmp_f;
 
   /* Check options */
@@ -180,91 +188,105 @@ int main (int argc, char *argv[]) {
 
   /* Open files */
   for (i = 0; i < n_infiles[mode]; i++) {
-    if ((Fif[i] = fopen (ifname[i], RB)) == NULL) {
+    if ((Fif[i] = ugst_io_open_read (ifname[i], UGST_IO_NATIVE)) == NULL) {
       sprintf (tmp_str, "Could not open input file %d,(%s)\n", i + 1, ifname[i]);
       HARAKIRI (tmp_str, 1);
     }
   }
   for (i = 0; i < n_outfiles[mode]; i++) {
-    if ((Fof[i] = fopen (ofname[i], WB)) == NULL) {
+    if ((Fof[i] = ugst_io_open_write (ofname[i], UGST_IO_NATIVE)) == NULL) {
       sprintf (tmp_str, "Could not create output file %d,(%s)\n", i + 1, ofname[i]);
       HARAKIRI (tmp_str, 1);
     }
   }
 
+  /* Allocate the output blocks */
+  if ((out_1 = (short *) malloc (2 * BLOCK_LEN * sizeof (short))) == NULL || (out_2 = (short *) malloc (BLOCK_LEN * sizeof (short))) == NULL) {
+    HARAKIRI ("Error, could not allocate the sample buffers\n", 1);
+  }
+
   /* start of actual operation */
-  memset (tmp_short, 0, sizeof (short) * 2);
   if (mode == INTER) {          /* read two mono file samples */
-    while ((n_in = fread (tmp_short, sizeof (short), 1, Fif[0])) == 1) {
-      if ((n_in = fread (&tmp_short[1], sizeof (short), 1, Fif[1])) != 1) {
+    while ((in_l = ugst_io_block (Fif[0], BLOCK_LEN, &n_in)) != NULL && n_in > 0) {
+      if ((n_in2 = ugst_io_read (Fif[1], out_2, n_in)) != n_in) {
         HARAKIRI ("Error, 1ch input file 2(right), shorter than 1ch input file 1(Left)\n", 1);
       }
-      if ((n_out = fwrite (tmp_short, sizeof (short), 2, Fof[0])) != 2) {
+      for (k = 0; k < n_in; k++) {
+        out_1[2 * k] = in_l[k];
+        out_1[2 * k + 1] = out_2[k];
+      }
+      if (ugst_io_write (Fof[0], out_1, 2 * n_in) != 2 * n_in) {
         HARAKIRI ("Error, could not write to 2ch output stereo file \n", 1);
       }
-      cnt_samples++;
-      memset (tmp_short, 0, sizeof (short) * 2);
+      cnt_samples += n_in;
     }                           /* while (1ch,1ch)->2ch */
 
     /* check if samples are still available in right channel */
-    if ((n_in = fread (&tmp_short[1], sizeof (short), 1, Fif[1])) != 0) {
+    if (ugst_io_read (Fif[1], out_2, 1) != 0) {
       HARAKIRI ("Error, 1ch input file 1(Left), shorter than 1ch input file 2(right)!\n", 1);
     }
   } else {
     /* reading of 2ch stereo file input samples */
-    while ((n_in = fread (tmp_short, sizeof (short), 2, Fif[0])) == 2) {
+    while ((in_lr = ugst_io_block (Fif[0], 2 * BLOCK_LEN, &n_in2)) != NULL && n_in2 > 0) {
+      n_in = n_in2 / 2;         /* complete sample pairs */
 
-      if (mode == SPLIT) {
-        if ((n_out = fwrite (tmp_short, sizeof (short), 1, Fof[0])) != 1) {
-          HARAKIRI ("Error, could not write to 1ch output file 1 (Left)\n", 1);
+      switch (mode) {
+      case SPLIT:
+        for (k = 0; k < n_in; k++) {
+          out_1[k] = in_lr[2 * k];
+          out_2[k] = in_lr[2 * k + 1];
         }
-        if ((n_out = fwrite (&tmp_short[1], sizeof (short), 1, Fof[1])) != 1) {
+        if (ugst_io_write (Fof[1], out_2, n_in) != n_in) {
           HARAKIRI ("Error, could not write to 1ch output file 2 (Right)\n", 1);
         }
-      } else {                  /* all 2ch to 1ch options */
-        tmp_short_1ch[0] = 0;
-        switch (mode) {
-        case LEFT:
-          tmp_short_1ch[0] = tmp_short[0];
-          break;
-        case RIGHT:
-          tmp_short_1ch[0] = tmp_short[1];
-          break;
-        case MAXENVAL:         /* select value(sample) with maximum energy */
-          if (abs (tmp_short[0]) > abs (tmp_short[1])) {
-            tmp_short_1ch[0] = tmp_short[0];
+        break;
+      case LEFT:
+        for (k = 0; k < n_in; k++)
+          out_1[k] = in_lr[2 * k];
+        break;
+      case RIGHT:
+        for (k = 0; k < n_in; k++)
+          out_1[k] = in_lr[2 * k + 1];
+        break;
+      case MAXENVAL:           /* select value(sample) with maximum energy */
+        for (k = 0; k < n_in; k++) {
+          if (abs (in_lr[2 * k]) > abs (in_lr[2 * k + 1])) {
+            out_1[k] = in_lr[2 * k];
           } else {
-            tmp_short_1ch[0] = tmp_short[1];
+            out_1[k] = in_lr[2 * k + 1];
           }
-          break;
-        case MONO:             /* M=(L+R)/2, with 16 bit saturation and rounding */
-          tmp_f = ((double) tmp_short[0] + (double) tmp_short[1]) * 0.5;
+        }
+        break;
+      case MONO:               /* M=(L+R)/2, with 16 bit saturation and rounding */
+        for (k = 0; k < n_in; k++) {
+          tmp_f = ((double) in_lr[2 * k] + (double) in_lr[2 * k + 1]) * 0.5;
           tmp_f += ((tmp_f > 0) ? 0.5 : -0.5);  /* rounding */
 
           if (tmp_f >= (double) MAX16) {
-            tmp_short_1ch[0] = MAX16;
+            out_1[k] = MAX16;
           } else if (tmp_f <= (double) MIN16) {
-            tmp_short_1ch[0] = MIN16;
+            out_1[k] = MIN16;
           } else {
-            tmp_short_1ch[0] = (short) tmp_f;
+            out_1[k] = (short) tmp_f;
           }
-          break;
-        default:
-          HARAKIRI ("Error, illegal mode option\n", 1);
-          break;
-        }
-        if ((n_out = fwrite (tmp_short_1ch, sizeof (short), 1, Fof[0])) != 1) {
-          HARAKIRI ("Error, could not write to 1ch output file 1\n", 1);
         }
+        break;
+      default:
+        HARAKIRI ("Error, illegal mode option\n", 1);
+        break;
       }
-      cnt_samples++;
-      memset (tmp_short, 0, sizeof (short) * 2);
-    }                           /* while 2ch input */
+      if (ugst_io_write (Fof[0], out_1, n_in) != n_in) {
+        HARAKIRI (mode == SPLIT ? "Error, could not write to 1ch output file 1 (Left)\n" : "Error, could not write to 1ch output file 1\n", 1);
+      }
+      cnt_samples += n_in;
 
-    /* check consistecy of 2ch stereo file reading */
-    if (n_in != 0) {
-      HARAKIRI ("Error, 2ch input file has odd number of samples !! \n", 1);
-    }
+      /* check consistecy of 2ch stereo file reading (only the last block can be short) */
+      if (n_in2 % 2 != 0) {
+        for (i = 0; i < n_outfiles[mode]; i++)
+          ugst_io_close (Fof[i]);
+        HARAKIRI ("Error, 2ch input file has odd number of samples !! \n", 1);
+      }
+    }                           /* while 2ch input */
   }                             /* mode=INTER */
 
   /* finalization */
@@ -273,10 +295,14 @@ int main (int argc, char *argv[]) {
     fprintf (stdout, "(Total %ld samples processed)\n\n", cnt_samples);
   }
   for (i = 0; i < n_infiles[mode]; i++) {
-    fclose (Fif[i]);
+    ugst_io_close (Fif[i]);
   }
   for (i = 0; i < n_outfiles[mode]; i++) {
-    fclose (Fof[i]);
+    if (ugst_io_close (Fof[i]) != 0) {
+      HARAKIRI ("Error, could not write to output file\n", 1);
+    }
   }
+  free (out_1);
+  free (out_2);
   return 0;
 }
@@ -0,0 +1,1237 @@
+/*                                                            v1.1  17.Oct.26
+=============================================================================
+
+                          U    U   GGG    SSSS  TTTTT
+                          U    U  G       S       T
+                          U    U  G  GG   SSSS    T
+                          U    U  G   G       S   T
+                           UUU     GG     SSS     T
+
+                   ========================================
+                    ITU-T - USER'S GROUP ON SOFTWARE TOOLS
+                   ========================================
+
+
+       =============================================================
+       COPYRIGHT NOTE: This source code, and all of its derivations,
+       is subject to the "ITU-T General Public License". Please have
+       it  read  in    the  distribution  disk,   or  in  the  ITU-T
+       Recommendation G.191 on "SOFTWARE TOOLS FOR SPEECH AND  AUDIO
+       CODING STANDARDS".
+       =============================================================
+
+
+MODULE:         PIPE-LIB.C, IN-MEMORY PROCESSING CHAINS OF STL STAGES
+
+ORIGINAL BY:    ITU-T STL contributors
+
+PROTOTYPE:     in pipe-lib.h
+
+DESCRIPTION:
+
+    A pipeline is a chain of stages, each one calling the module of one
+    of the STL demo programs, with the same options and the same results
+    as the program itself. The samples go from stage to stage in memory,
+    in blocks: no intermediate file is written and no process is started.
+
+    A pipeline is described by a text: the stages are separated by "|"
+    or by new lines, and each stage is written as the command line of the
+    demo program, without the file names and block parameters. Text from
+    "#" to the end of the line is ignored. Example:
+
+      filter -up hq2 | sv56demo -lev -26 | mnrudemo 20 | filter -down hq2
+
+    Stages (see pipe_stage_list()):
+
+      filter [-mod] [-up|-down] type ........ FIR/IIR filters of filter
+      g711demo [-r] law lilo|lili|loli ..... G.711 A/u-law
+      g726demo [-noreset] law op rate ...... G.726 ADPCM (op: load, adlo,
+                                             lolo)
+      sv56demo [-lev dB] [-sf f] [-rms] [-bits n]
+                                             P.56 level equalization
+      mnrudemo [-noise|-signal|-mod] Q ..... P.810 MNRU
+      reverb [-align f] [-block B] IRfile .. reverberation (FFT
+                                             convolution)
+      eid [-bits n] [-gamma g] [-seed s] ber
+                                             bit errors on the n low bits
+                                             of each sample (eg. G.711 or
+                                             G.726 codes)
+
+    Stages that change the sampling rate (filter -up/-down) change the
+    length of the blocks. sv56demo needs the level of the whole signal
+    before scaling its first sample: it keeps all the samples, and
+    outputs them at the end of the input.
+
+FUNCTIONS:
+
+    pipe_stage_create: .. creates one stage from its command line
+    pipe_graph_parse: ... creates a pipeline from its text description
+    pipe_graph_push: .... processes a block of input samples
+    pipe_graph_flush: ... outputs the samples kept by the stages at the
+                          end of the input
+    pipe_graph_run: ..... processes a whole file
+    pipe_graph_report: .. prints a summary of each stage
+    pipe_graph_free: .... releases a pipeline
+    pipe_stage_list: .... short description of the stages
+
+HISTORY:
+
+  17.Oct.26 v1.0 Created.
+  17.Oct.26 v1.1 eid: bits serialized LSB first, as by spdemo.
+=============================================================================
+*/
+
+/*
+ * .................... INCLUDES ....................
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include <time.h>
+
+#include "pipe-lib.h"
+
+/* STL modules */
+#include "ugst-utl.h"
+#include "firflt.h"
+#include "iirflt.h"
+#include "g711.h"
+#include "g726.h"
+#include "sv-p56.h"
+#include "mnru.h"
+#include "eid.h"
+#include "reverb-lib.h"
+
+/* Number of words of the sync header of soft bit frames */
+#ifdef STL92
+#define PIPE_EID_HEADER 1
+#else
+#define PIPE_EID_HEADER 2
+#endif
+
+
+/*
+ * .................... LOCAL FUNCTIONS ....................
+ */
+
+/* Grows the float buffer *x to n samples; returns 0 on failure */
+static int pipe_grow (float **x, long *len, long n) {
+  float *p;
+
+  if (n <= *len)
+    return 1;
+  if ((p = (float *) realloc (*x, n * sizeof (float))) == NULL)
+    return 0;
+  *x = p;
+  *len = n;
+  return 1;
+}
+
+/* Grows the short buffer *x to n samples; returns 0 on failure */
+static int pipe_grow_short (short **x, long *len, long n) {
+  short *p;
+
+  if (n <= *len)
+    return 1;
+  if ((p = (short *) realloc (*x, n * sizeof (short))) == NULL)
+    return 0;
+  *x = p;
+  *len = n;
+  return 1;
+}
+
+/* Case-insensitive comparison of two names */
+static int pipe_same (char *a, char *b) {
+  for (; *a && *b; a++, b++)
+    if (tolower ((int) *a) != tolower ((int) *b))
+      return 0;
+  return *a == *b;
+}
+
+/* Allocates a stage, with the given name and state */
+static PIPE_STAGE *pipe_stage_new (char *name, void *state) {
+  PIPE_STAGE *st;
+
+  if ((st = (PIPE_STAGE *) calloc (1, sizeof (PIPE_STAGE))) == NULL)
+    return NULL;
+  strncpy (st->name, name, sizeof (st->name) - 1);
+  st->num = st->den = 1;
+  st->state = state;
+  return st;
+}
+
+
+/*
+ * .................... FILTER ....................
+ */
+
+#define FLT_FIR      0
+#define FLT_PARALLEL 1
+#define FLT_CASCADE  2
+#define FLT_DIRECT   3
+
+typedef struct {
+  int kind;                     /* FLT_xxx */
+  SCD_FIR *fir;
+  SCD_IIR *parallel;
+  CASCADE_IIR *cascade;
+  DIRECT_IIR *direct;
+  float *x, *y;                 /* float input and output */
+  long x_len, y_len;
+  long satur;                   /* saturated samples */
+} PIPE_FILTER;
+
+static long filter_process (PIPE_STAGE * st, short *inp, long n, short *out) {
+  PIPE_FILTER *f = (PIPE_FILTER *) st->state;
+  long m = 0;
+
+  if (!pipe_grow (&f->x, &f->x_len, n) || !pipe_grow (&f->y, &f->y_len, st->out_len))
+    return 0;
+
+  /* as filter: normalized 16-bit conversion, with rounding back */
+  sh2fl_16bit (n, inp, f->x, 1);
+  switch (f->kind) {
+  case FLT_FIR:
+    m = hq_kernel (n, f->x, f->fir, f->y);
+    break;
+  case FLT_PARALLEL:
+    m = stdpcm_kernel (n, f->x, f->parallel, f->y);
+    break;
+  case FLT_CASCADE:
+    m = cascade_iir_kernel (n, f->x, f->cascade, f->y);
+    break;
+  case FLT_DIRECT:
+    m = direct_iir_kernel (n, f->x, f->direct, f->y);
+    break;
+  }
+  f->satur += fl2sh_16bit (m, f->y, out, 1);
+  return m;
+}
+
+static void filter_report (PIPE_STAGE * st, FILE * fp) {
+  fprintf (fp, "saturated samples: %ld", ((PIPE_FILTER *) st->state)->satur);
+}
+
+static void filter_release (PIPE_STAGE * st) {
+  PIPE_FILTER *f = (PIPE_FILTER *) st->state;
+
+  if (f->fir)
+    hq_free (f->fir);
+  if (f->parallel)
+    stdpcm_free (f->parallel);
+  if (f->cascade)
+    cascade_iir_free (f->cascade);
+  if (f->direct)
+    direct_iir_free (f->direct);
+  free (f->x);
+  free (f->y);
+  free (f);
+}
+
+/* filter [-mod] [-up|-down] type: the filters of filter.c */
+static PIPE_STAGE *filter_create (int argc, char **argv, char *err) {
+  PIPE_FILTER *f;
+  PIPE_STAGE *st;
+  char *type = NULL, *name = argv[0];
+  int mod = 0, up = 0;
+  long factor = 1;
+
+  for (argc--, argv++; argc > 0; argc--, argv++)
+    if (strcmp (argv[0], "-mod") == 0)
+      mod = 1;
+    else if (strcmp (argv[0], "-up") == 0)
+      up = 1;
+    else if (strcmp (argv[0], "-down") == 0)
+      up = 0;
+    else if (argv[0][0] != '-' && type == NULL)
+      type = argv[0];
+    else {
+      sprintf (err, "filter: invalid argument \"%.64s\"", argv[0]);
+      return NULL;
+    }
+  if (type == NULL) {
+    sprintf (err, "filter: no filter type");
+    return NULL;
+  }
+  if ((f = (PIPE_FILTER *) calloc (1, sizeof (PIPE_FILTER))) == NULL)
+    return NULL;
+  f->kind = FLT_FIR;
+
+  if (pipe_same (type, "irs8") && !mod)
+    f->fir = irs_8khz_init ();
+  else if (pipe_same (type, "irs16"))
+    f->fir = mod ? mod_irs_16khz_init () : irs_16khz_init ();
+  else if (pipe_same (type, "irs48"))
+    f->fir = mod_irs_48khz_init ();
+  else if (pipe_same (type, "rxirs8"))
+    f->fir = rx_mod_irs_8khz_init ();
+  else if (pipe_same (type, "rxirs16"))
+    f->fir = rx_mod_irs_16khz_init ();
+  else if (pipe_same (type, "hirs16"))
+    f->fir = ht_irs_16khz_init ();
+  else if (pipe_same (type, "tirs"))
+    f->fir = tia_irs_8khz_init ();
+  else if (pipe_same (type, "dsm"))
+    f->fir = delta_sm_16khz_init ();
+  else if (pipe_same (type, "pso"))
+    f->fir = psophometric_8khz_init ();
+  else if (pipe_same (type, "gsm1") || pipe_same (type, "msin"))
+    f->fir = msin_16khz_init ();
+  else if (pipe_same (type, "flat1"))
+    f->fir = linear_phase_pb_1_to_1_init ();
+  else if (pipe_same (type, "flat"))
+    f->fir = up ? linear_phase_pb_1_to_2_init () : linear_phase_pb_2_to_1_init ();
+  else if (pipe_same (type, "hq2"))
+    f->fir = up ? hq_up_1_to_2_init () : hq_down_2_to_1_init ();
+  else if (pipe_same (type, "hq3"))
+    f->fir = up ? hq_up_1_to_3_init () : hq_down_3_to_1_init ();
+  else if (pipe_same (type, "p341"))
+    f->fir = p341_16khz_init ();
+  else if (pipe_same (type, "5kbp"))
+    f->fir = bp5k_16khz_init ();
+  else if (pipe_same (type, "100_5kbp"))
+    f->fir = bp100_5k_16khz_init ();
+  else if (pipe_same (type, "14kbp"))
+    f->fir = bp14k_32khz_init ();
+  else if (pipe_same (type, "20kbp"))
+    f->fir = bp20k_48khz_init ();
+  else if (pipe_same (type, "lp1p5"))
+    f->fir = LP1p5_48kHz_init ();
+  else if (pipe_same (type, "lp35"))
+    f->fir = LP35_48kHz_init ();
+  else if (pipe_same (type, "lp7"))
+    f->fir = LP7_48kHz_init ();
+  else if (pipe_same (type, "lp10"))
+    f->fir = LP10_48kHz_init ();
+  else if (pipe_same (type, "lp12"))
+    f->fir = LP12_48kHz_init ();
+  else if (pipe_same (type, "lp14"))
+    f->fir = LP14_48kHz_init ();
+  else if (pipe_same (type, "lp20"))
+    f->fir = LP20_48kHz_init ();
+  else if (pipe_same (type, "pcm1")) {
+    f->kind = FLT_PARALLEL;
+    f->parallel = stdpcm_16khz_init ();
+  } else if (pipe_same (type, "pcm")) {
+    f->kind = FLT_PARALLEL;
+    f->parallel = up ? stdpcm_1_to_2_init () : stdpcm_2_to_1_init ();
+  } else if (pipe_same (type, "iflat")) {
+    f->kind = FLT_CASCADE;
+    f->cascade = up ? iir_casc_lp_1_to_3_init () : iir_casc_lp_3_to_1_init ();
+  } else if (pipe_same (type, "dc")) {
+    f->kind = FLT_DIRECT;
+    f->direct = iir_dir_dc_removal_init ();
+  } else {
+    sprintf (err, "filter: invalid filter type \"%.64s\"", type);
+    free (f);
+    return NULL;
+  }
+  if (f->fir == NULL && f->parallel == NULL && f->cascade == NULL && f->direct == NULL) {
+    sprintf (err, "filter: can't initialize filter \"%.64s\"", type);
+    free (f);
+    return NULL;
+  }
+
+  if ((st = pipe_stage_new (name, f)) == NULL) {
+    PIPE_STAGE tmp;
+
+    tmp.state = f;
+    filter_release (&tmp);
+    return NULL;
+  }
+  switch (f->kind) {
+  case FLT_FIR:
+    hq_engine (f->fir, HQ_ENGINE_POLYPHASE);
+    factor = f->fir->dwn_up;
+    up = f->fir->hswitch == 'U';
+    break;
+  case FLT_PARALLEL:
+    factor = f->parallel->idown;
+    up = f->parallel->hswitch == 'U';
+    break;
+  case FLT_CASCADE:
+    factor = f->cascade->idown;
+    up = f->cascade->hswitch == 'U';
+    break;
+  case FLT_DIRECT:
+    factor = f->direct->idown;
+    up = f->direct->hswitch == 'U';
+    break;
+  }
+  if (up)
+    st->num = factor;
+  else
+    st->den = factor;
+  st->process = filter_process;
+  st->report = filter_report;
+  st->release = filter_release;
+  return st;
+}
+
+
+/*
+ * .................... G711DEMO ....................
+ */
+
+typedef struct {
+  char law;                     /* 'A' or 'U' */
+  int inp_log, out_log;         /* 1 for log samples */
+  int swap_even;                /* 1 to swap the even bits of A-law codes (-r) */
+  short *tmp;
+  long tmp_len;
+} PIPE_G711;
+
+static long g711_process (PIPE_STAGE * st, short *inp, long n, short *out) {
+  PIPE_G711 *g = (PIPE_G711 *) st->state;
+  short *log_buf;
+  long i;
+
+  if (!pipe_grow_short (&g->tmp, &g->tmp_len, n))
+    return 0;
+
+  /* as g711demo: with -r, the even bits of the A-law codes are swapped */
+  if (!g->inp_log) {
+    log_buf = g->out_log ? out : g->tmp;
+    if (g->law == 'A') {
+      alaw_compress (n, inp, log_buf);
+      if (g->out_log && g->swap_even)
+        for (i = 0; i < n; i++)
+          log_buf[i] ^= 0x0055;
+      else if (!g->out_log)
+        alaw_expand (n, log_buf, out);
+    } else {
+      ulaw_compress (n, inp, log_buf);
+      if (!g->out_log)
+        ulaw_expand (n, log_buf, out);
+    }
+  } else if (g->law == 'A' && g->swap_even) {
+    for (i = 0; i < n; i++)
+      g->tmp[i] = inp[i] ^ 0x0055;
+    alaw_expand (n, g->tmp, out);
+  } else if (g->law == 'A')
+    alaw_expand (n, inp, out);
+  else
+    ulaw_expand (n, inp, out);
+  return n;
+}
+
+static void g711_release (PIPE_STAGE * st) {
+  free (((PIPE_G711 *) st->state)->tmp);
+  free (st->state);
+}
+
+/* g711demo [-r] law lilo|lili|loli */
+static PIPE_STAGE *g711_create (int argc, char **argv, char *err) {
+  PIPE_G711 *g;
+  PIPE_STAGE *st;
+  char law, *name = argv[0];
+  int swap_even = 0;
+
+  if (argc > 1 && strcmp (argv[1], "-r") == 0) {
+    swap_even = 1;
+    argc--;
+    argv++;
+  }
+  if (argc != 3 || strlen (argv[2]) != 4) {
+    sprintf (err, "g711demo: usage: g711demo [-r] law lilo|lili|loli");
+    return NULL;
+  }
+  law = toupper ((int) argv[1][0]);
+  if (law != 'A' && law != 'U') {
+    sprintf (err, "g711demo: invalid law \"%.64s\"", argv[1]);
+    return NULL;
+  }
+  if ((g = (PIPE_G711 *) calloc (1, sizeof (PIPE_G711))) == NULL)
+    return NULL;
+  g->law = law;
+  g->swap_even = swap_even;
+  g->inp_log = toupper ((int) argv[2][1]) == 'O';
+  g->out_log = toupper ((int) argv[2][3]) == 'O';
+  if (g->inp_log && g->out_log) {
+    sprintf (err, "g711demo: invalid conversion \"%.64s\"", argv[2]);
+    free (g);
+    return NULL;
+  }
+  if ((st = pipe_stage_new (name, g)) == NULL) {
+    free (g);
+    return NULL;
+  }
+  st->process = g711_process;
+  st->release = g711_release;
+  return st;
+}
+
+
+/*
+ * .................... G726DEMO ....................
+ */
+
+typedef struct {
+  char law[2];                  /* "1" for A-law, "0" for u-law */
+  short rate;                   /* 2..5 bits per sample */
+  int inp_log, out_log;         /* 1 for log samples, 0 for ADPCM codes */
+  short reset;                  /* reset at the first block */
+  G726_state enc, dec;
+  short *tmp;
+  long tmp_len;
+} PIPE_G726;
+
+static long g726_process (PIPE_STAGE * st, short *inp, long n, short *out) {
+  PIPE_G726 *g = (PIPE_G726 *) st->state;
+
+  if (!pipe_grow_short (&g->tmp, &g->tmp_len, n))
+    return 0;
+  if (g->inp_log && !g->out_log)
+    G726_encode (inp, out, n, g->law, g->rate, g->reset, &g->enc);
+  else if (!g->inp_log)
+    G726_decode (inp, out, n, g->law, g->rate, g->reset, &g->dec);
+  else {
+    G726_encode (inp, g->tmp, n, g->law, g->rate, g->reset, &g->enc);
+    G726_decode (g->tmp, out, n, g->law, g->rate, g->reset, &g->dec);
+  }
+  g->reset = 0;
+  return n;
+}
+
+static void g726_release (PIPE_STAGE * st) {
+  free (((PIPE_G726 *) st->state)->tmp);
+  free (st->state);
+}
+
+/* g726demo [-noreset] law lolo|load|adlo rate */
+static PIPE_STAGE *g726_create (int argc, char **argv, char *err) {
+  PIPE_G726 *g;
+  PIPE_STAGE *st;
+  char *name = argv[0];
+  short reset = 1, rate;
+
+  if (argc > 1 && strcmp (argv[1], "-noreset") == 0) {
+    reset = 0;
+    argc--;
+    argv++;
+  }
+  if (argc != 4 || strlen (argv[2]) != 4) {
+    sprintf (err, "g726demo: usage: g726demo [-noreset] law lolo|load|adlo rate");
+    return NULL;
+  }
+  if ((g = (PIPE_G726 *) calloc (1, sizeof (PIPE_G726))) == NULL)
+    return NULL;
+  g->reset = reset;
+  g->inp_log = toupper ((int) argv[2][1]) == 'O';
+  g->out_log = toupper ((int) argv[2][3]) == 'O';
+  rate = (short) atoi (argv[3]);
+  g->rate = rate >= 16 ? rate / 8 : rate;
+  if (toupper ((int) argv[1][0]) == 'A')
+    g->law[0] = '1';
+  else if (toupper ((int) argv[1][0]) == 'U')
+    g->law[0] = '0';
+  else
+    sprintf (err, "g726demo: invalid law \"%.64s\"", argv[1]);
+  if (!g->inp_log && !g->out_log)
+    sprintf (err, "g726demo: invalid conversion \"%.64s\"", argv[2]);
+  if (g->rate < 2 || g->rate > 5 || (rate >= 16 && rate % 8 != 0))
+    sprintf (err, "g726demo: invalid rate \"%.64s\"", argv[3]);
+  if (*err || (st = pipe_stage_new (name, g)) == NULL) {
+    free (g);
+    return NULL;
+  }
+  st->process = g726_process;
+  st->release = g726_release;
+  return st;
+}
+
+
+/*
+ * .................... SV56DEMO ....................
+ */
+
+typedef struct {
+  double lev;                   /* desired level, dBov */
+  double sf;                    /* sampling frequency */
+  long bitno;                   /* resolution of the samples */
+  int use_active_level;         /* 0 to equalize the RMS level */
+  short *all;                   /* the whole signal */
+  long all_len, nall;
+  long pos;                     /* next sample to output */
+  double factor;                /* equalization factor */
+  double active_dB;             /* active speech level */
+  SVP56_state state;
+  float *x;
+  long x_len;
+  long satur;                   /* clipped samples */
+} PIPE_SV56;
+
+static long sv56_process (PIPE_STAGE * st, short *inp, long n, short *out) {
+  PIPE_SV56 *s = (PIPE_SV56 *) st->state;
+  long len = s->all_len;
+
+  /* keep the samples: the level of the whole signal is needed first */
+  if (s->nall + n > len && !pipe_grow_short (&s->all, &s->all_len, 2 * len > s->nall + n ? 2 * len : s->nall + n))
+    return 0;
+  memcpy (s->all + s->nall, inp, n * sizeof (short));
+  s->nall += n;
+  return 0;
+}
+
+static long sv56_flush (PIPE_STAGE * st, short *out, long max) {
+  static unsigned mask[5] = { 0xFFFF, 0xFFFE, 0xFFFB, 0xFFF8, 0xFFF0 };
+  PIPE_SV56 *s = (PIPE_SV56 *) st->state;
+  long i, l, n;
+
+  if (!pipe_grow (&s->x, &s->x_len, max > PIPE_BLOCK ? max : PIPE_BLOCK))
+    return 0;
+
+  /* first call: measurement, in blocks of the length used by sv56demo */
+  if (s->pos == 0 && s->factor == 0) {
+    init_speech_voltmeter (&s->state, s->sf);
+    s->active_dB = 0;
+    for (i = 0; i < s->nall; i += l) {
+      l = s->nall - i < PIPE_BLOCK ? s->nall - i : PIPE_BLOCK;
+      sh2fl (l, s->all + i, s->x, s->bitno, 1);
+      s->active_dB = speech_voltmeter_fast (s->x, l, &s->state);
+    }
+    if (s->use_active_level)
+      s->factor = pow (10.0, (s->lev - s->active_dB) / 20.0);
+    else
+      s->factor = pow (10.0, (s->lev - SVP56_get_rms_dB (s->state)) / 20.0);
+  }
+
+  /* equalization: hard clipping, with truncation */
+  n = s->nall - s->pos < max ? s->nall - s->pos : max;
+  sh2fl (n, s->all + s->pos, s->x, s->bitno, 1);
+  scale (s->x, n, s->factor);
+  s->satur += fl2sh (n, s->x, out, 0.0, mask[16 - s->bitno]);
+  s->pos += n;
+  return n;
+}
+
+static void sv56_report (PIPE_STAGE * st, FILE * fp) {
+  PIPE_SV56 *s = (PIPE_SV56 *) st->state;
+
+  fprintf (fp, "active level: %.3f dBov, activity: %.3f%%, gain: %.3f, clipped samples: %ld", s->active_dB, SVP56_get_activity (s->state), s->factor, s->satur);
+}
+
+static void sv56_release (PIPE_STAGE * st) {
+  PIPE_SV56 *s = (PIPE_SV56 *) st->state;
+
+  free (s->all);
+  free (s->x);
+  free (s);
+}
+
+/* sv56demo [-lev dB] [-sf f] [-rms] [-bits n] */
+static PIPE_STAGE *sv56_create (int argc, char **argv, char *err) {
+  PIPE_SV56 *s;
+  PIPE_STAGE *st;
+  char *name = argv[0];
+
+  if ((s = (PIPE_SV56 *) calloc (1, sizeof (PIPE_SV56))) == NULL)
+    return NULL;
+  s->lev = -26;
+  s->sf = 16000;
+  s->bitno = 16;
+  s->use_active_level = 1;
+  for (argc--, argv++; argc > 0; argc--, argv++)
+    if (strcmp (argv[0], "-lev") == 0 && argc > 1) {
+      s->lev = atof (argv[1]);
+      argc--, argv++;
+    } else if (strcmp (argv[0], "-sf") == 0 && argc > 1) {
+      s->sf = atof (argv[1]);
+      argc--, argv++;
+    } else if (strcmp (argv[0], "-bits") == 0 && argc > 1) {
+      s->bitno = atol (argv[1]);
+      argc--, argv++;
+    } else if (strcmp (argv[0], "-rms") == 0)
+      s->use_active_level = 0;
+    else {
+      sprintf (err, "sv56demo: invalid argument \"%.64s\"", argv[0]);
+      break;
+    }
+  if (s->bitno < 12 || s->bitno > 16)
+    sprintf (err, "sv56demo: resolution must be 12 to 16 bits");
+  if (*err || (st = pipe_stage_new (name, s)) == NULL) {
+    free (s);
+    return NULL;
+  }
+  st->process = sv56_process;
+  st->flush = sv56_flush;
+  st->report = sv56_report;
+  st->release = sv56_release;
+  return st;
+}
+
+
+/*
+ * .................... MNRUDEMO ....................
+ */
+
+typedef struct {
+  char mode;                    /* MOD_NOISE, SIGNAL_ONLY or NOISE_ONLY */
+  double Q;                     /* Q, in dB */
+  long chunk;                   /* length of the first block */
+  int started;
+  MNRU_state state;
+  float *x, *y;
+  long x_len, y_len;
+  long over;                    /* saturated samples */
+} PIPE_MNRU;
+
+static long mnru_process (PIPE_STAGE * st, short *inp, long n, short *out) {
+  PIPE_MNRU *m = (PIPE_MNRU *) st->state;
+  long i, l;
+
+  if (!pipe_grow (&m->x, &m->x_len, n) || !pipe_grow (&m->y, &m->y_len, n))
+    return 0;
+  sh2fl_16bit (n, inp, m->x, 1);
+
+  /* MNRU_process() can't be given more samples than at its start */
+  for (i = 0; i < n; i += l) {
+    if (!m->started) {
+      m->chunk = n;
+      m->started = 1;
+      if (MNRU_process (MNRU_START, &m->state, m->x, m->y, n, (long) 314159265, m->mode, m->Q) == NULL)
+        return 0;
+      l = n;
+    } else {
+      l = n - i < m->chunk ? n - i : m->chunk;
+      MNRU_process (MNRU_CONTINUE, &m->state, m->x + i, m->y + i, l, (long) 314159265, m->mode, m->Q);
+    }
+  }
+  m->over += fl2sh_16bit (n, m->y, out, 1);
+  return n;
+}
+
+static long mnru_flush (PIPE_STAGE * st, short *out, long max) {
+  PIPE_MNRU *m = (PIPE_MNRU *) st->state;
+
+  /* release the memory of the module */
+  if (m->started) {
+    MNRU_process (MNRU_STOP, &m->state, m->x, m->y, 0L, (long) 314159265, m->mode, m->Q);
+    m->started = 0;
+  }
+  return 0;
+}
+
+static void mnru_report (PIPE_STAGE * st, FILE * fp) {
+  PIPE_MNRU *m = (PIPE_MNRU *) st->state;
+
+  fprintf (fp, "overflow samples: %ld, clipped noise samples: %ld", m->over, m->state.clip);
+}
+
+static void mnru_release (PIPE_STAGE * st) {
+  PIPE_MNRU *m = (PIPE_MNRU *) st->state;
+
+  mnru_flush (st, NULL, 0);
+  free (m->x);
+  free (m->y);
+  free (m);
+}
+
+/* mnrudemo [-noise|-signal|-mod] Q */
+static PIPE_STAGE *mnru_create (int argc, char **argv, char *err) {
+  PIPE_MNRU *m;
+  PIPE_STAGE *st;
+  char *name = argv[0];
+  int nq = 0;
+
+  if ((m = (PIPE_MNRU *) calloc (1, sizeof (PIPE_MNRU))) == NULL)
+    return NULL;
+  m->mode = MOD_NOISE;
+  for (argc--, argv++; argc > 0; argc--, argv++)
+    if (strcmp (argv[0], "-noise") == 0)
+      m->mode = NOISE_ONLY;
+    else if (strcmp (argv[0], "-signal") == 0)
+      m->mode = SIGNAL_ONLY;
+    else if (strcmp (argv[0], "-mod") == 0)
+      m->mode = MOD_NOISE;
+    else if (nq++ == 0)
+      m->Q = atof (argv[0]);
+    else {
+      sprintf (err, "mnrudemo: invalid argument \"%.64s\"", argv[0]);
+      break;
+    }
+  if (nq == 0)
+    sprintf (err, "mnrudemo: no Q value");
+  if (*err || (st = pipe_stage_new (name, m)) == NULL) {
+    free (m);
+    return NULL;
+  }
+  st->process = mnru_process;
+  st->flush = mnru_flush;
+  st->report = mnru_report;
+  st->release = mnru_release;
+  return st;
+}
+
+
+/*
+ * .................... REVERB ....................
+ */
+
+typedef struct {
+  float *IR;
+  float align;
+  PCONV_STATE *pconv;
+  long satur;                   /* blocks with saturation */
+} PIPE_REVERB;
+
+static long reverb_process (PIPE_STAGE * st, short *inp, long n, short *out) {
+  PIPE_REVERB *r = (PIPE_REVERB *) st->state;
+
+  if (pconv (r->pconv, inp, out, r->align, n) >= 0)
+    r->satur++;
+  return n;
+}
+
+static void reverb_report (PIPE_STAGE * st, FILE * fp) {
+  fprintf (fp, "blocks with saturation: %ld", ((PIPE_REVERB *) st->state)->satur);
+}
+
+static void reverb_release (PIPE_STAGE * st) {
+  PIPE_REVERB *r = (PIPE_REVERB *) st->state;
+
+  pconv_free (r->pconv);
+  free (r->IR);
+  free (r);
+}
+
+/* reverb [-align f] [-block B] IRfile */
+static PIPE_STAGE *reverb_create (int argc, char **argv, char *err) {
+  PIPE_REVERB *r;
+  PIPE_STAGE *st;
+  FILE *fp = NULL;
+  char *name = argv[0], *file = NULL;
+  long B = 0, N = 0, l;
+  float tmp[1024];
+
+  if ((r = (PIPE_REVERB *) calloc (1, sizeof (PIPE_REVERB))) == NULL)
+    return NULL;
+  r->align = 1.0;
+  for (argc--, argv++; argc > 0; argc--, argv++)
+    if (strcmp (argv[0], "-align") == 0 && argc > 1) {
+      r->align = (float) atof (argv[1]);
+      argc--, argv++;
+    } else if (strcmp (argv[0], "-block") == 0 && argc > 1) {
+      B = atol (argv[1]);
+      argc--, argv++;
+    } else if (argv[0][0] != '-' && file == NULL)
+      file = argv[0];
+    else {
+      sprintf (err, "reverb: invalid argument \"%.64s\"", argv[0]);
+      break;
+    }
+
+  /* the impulse response, as reverb */
+  if (!*err && file == NULL)
+    sprintf (err, "reverb: no impulse response file");
+  if (!*err && (fp = fopen (file, "rb")) == NULL)
+    sprintf (err, "reverb: can't open \"%.64s\"", file);
+  if (!*err) {
+    while ((l = (long) fread (tmp, sizeof (float), 1024, fp)) > 0)
+      N += l;
+    if (N == 0 || (r->IR = (float *) calloc (N, sizeof (float))) == NULL)
+      sprintf (err, "reverb: empty impulse response \"%.64s\"", file);
+    else {
+      rewind (fp);
+      if ((long) fread (r->IR, sizeof (float), N, fp) != N)
+        sprintf (err, "reverb: can't read \"%.64s\"", file);
+    }
+  }
+  if (fp)
+    fclose (fp);
+  if (!*err && (r->pconv = pconv_init (r->IR, N, B)) == NULL)
+    sprintf (err, "reverb: can't initialize the FFT convolution (block size must be a power of 2)");
+  if (*err || (st = pipe_stage_new (name, r)) == NULL) {
+    if (r->pconv)
+      pconv_free (r->pconv);
+    free (r->IR);
+    free (r);
+    return NULL;
+  }
+  st->process = reverb_process;
+  st->report = reverb_report;
+  st->release = reverb_release;
+  return st;
+}
+
+
+/*
+ * .................... EID ....................
+ */
+
+typedef struct {
+  SCD_EID *eid;
+  int bits;                     /* bits per sample */
+  short *x, *y, *ep;            /* soft bit frames and error pattern */
+  long x_len, y_len, ep_len;
+  double dist, nbits;           /* distorted and processed bits */
+} PIPE_EID;
+
+static long eid_process (PIPE_STAGE * st, short *inp, long n, short *out) {
+  PIPE_EID *e = (PIPE_EID *) st->state;
+  long lseg = n * e->bits, i, k;
+  int b;
+  short *bit;
+
+  if (!pipe_grow_short (&e->x, &e->x_len, lseg + PIPE_EID_HEADER) || !pipe_grow_short (&e->y, &e->y_len, lseg + PIPE_EID_HEADER)
+      || !pipe_grow_short (&e->ep, &e->ep_len, lseg))
+    return 0;
+
+  /* soft bit frame of the n low bits of the samples, LSB first as in
+     serialize_right_justified() (spdemo), so that the errors hit the same
+     bits as with spdemo, gen-patt and eid-xor */
+  e->x[0] = 0x6B21;
+#if PIPE_EID_HEADER > 1
+  e->x[1] = (short) lseg;
+#endif
+  bit = e->x + PIPE_EID_HEADER;
+  for (i = 0; i < n; i++)
+    for (b = 0; b < e->bits; b++)
+      *bit++ = (inp[i] >> b) & 1 ? 0x0081 : 0x007F;
+
+  e->dist += BER_generator (e->eid, lseg, e->ep);
+  e->nbits += lseg;
+  BER_insertion (lseg + PIPE_EID_HEADER, e->x, e->y, e->ep);
+
+  bit = e->y + PIPE_EID_HEADER;
+  for (i = 0; i < n; i++) {
+    for (k = 0, b = 0; b < e->bits; b++)
+      k |= (*bit++ == 0x0081) << b;
+    out[i] = (short) ((inp[i] & ~((1 << e->bits) - 1)) | k);
+  }
+  return n;
+}
+
+static void eid_report (PIPE_STAGE * st, FILE * fp) {
+  PIPE_EID *e = (PIPE_EID *) st->state;
+
+  fprintf (fp, "bit error rate: %.6f (%.0f of %.0f bits)", e->nbits > 0 ? e->dist / e->nbits : 0.0, e->dist, e->nbits);
+}
+
+static void eid_release (PIPE_STAGE * st) {
+  PIPE_EID *e = (PIPE_EID *) st->state;
+
+  if (e->eid)
+    close_eid (e->eid);
+  free (e->x);
+  free (e->y);
+  free (e->ep);
+  free (e);
+}
+
+/* eid [-bits n] [-gamma g] [-seed s] ber */
+static PIPE_STAGE *eid_create (int argc, char **argv, char *err) {
+  PIPE_EID *e;
+  PIPE_STAGE *st;
+  char *name = argv[0];
+  double ber = -1, gamma = 0;
+  unsigned long seed = 314159265;
+
+  if ((e = (PIPE_EID *) calloc (1, sizeof (PIPE_EID))) == NULL)
+    return NULL;
+  e->bits = 8;
+  for (argc--, argv++; argc > 0; argc--, argv++)
+    if (strcmp (argv[0], "-bits") == 0 && argc > 1) {
+      e->bits = atoi (argv[1]);
+      argc--, argv++;
+    } else if (strcmp (argv[0], "-gamma") == 0 && argc > 1) {
+      gamma = atof (argv[1]);
+      argc--, argv++;
+    } else if (strcmp (argv[0], "-seed") == 0 && argc > 1) {
+      seed = strtoul (argv[1], NULL, 10);
+      argc--, argv++;
+    } else if (argv[0][0] != '-' && ber < 0)
+      ber = atof (argv[0]);
+    else {
+      sprintf (err, "eid: invalid argument \"%.64s\"", argv[0]);
+      break;
+    }
+  if (!*err && (ber < 0 || ber > 0.5))
+    sprintf (err, "eid: bit error rate must be between 0 and 0.5");
+  if (!*err && (e->bits < 1 || e->bits > 16))
+    sprintf (err, "eid: 1 to 16 bits per sample");
+  if (!*err && (e->eid = open_eid (ber, gamma)) == NULL)
+    sprintf (err, "eid: can't initialize the error model");
+  if (*err || (st = pipe_stage_new (name, e)) == NULL) {
+    if (e->eid)
+      close_eid (e->eid);
+    free (e);
+    return NULL;
+  }
+  set_RAN_seed (e->eid, seed);
+  st->process = eid_process;
+  st->report = eid_report;
+  st->release = eid_release;
+  return st;
+}
+
+
+/*
+ * .................... GLOBAL FUNCTIONS ....................
+ */
+
+/* Table of the stages */
+static struct {
+  char *name;
+  PIPE_STAGE *(*create) ARGS ((int argc, char **argv, char *err));
+  char *usage;
+} pipe_stages[] = {
+  { "filter", filter_create, "filter [-mod] [-up|-down] type" },
+  { "g711demo", g711_create, "g711demo [-r] law lilo|lili|loli" },
+  { "g726demo", g726_create, "g726demo [-noreset] law lolo|load|adlo rate" },
+  { "sv56demo", sv56_create, "sv56demo [-lev dB] [-sf f] [-rms] [-bits n]" },
+  { "mnrudemo", mnru_create, "mnrudemo [-noise|-signal|-mod] Q" },
+  { "reverb", reverb_create, "reverb [-align f] [-block B] IRfile" },
+  { "eid", eid_create, "eid [-bits n] [-gamma g] [-seed s] ber" },
+};
+
+#define PIPE_N_STAGES (sizeof (pipe_stages) / sizeof (pipe_stages[0]))
+
+
+/*
+  ----------------------------------------------------------------------------
+  char *pipe_stage_list (void);
+  ~~~~~~~~~~~~~~~~~~~~~
+  Returns the list of the stages and of their arguments, one per line.
+  ----------------------------------------------------------------------------
+*/
+char *pipe_stage_list (void) {
+  static char list[1024];
+  size_t k;
+
+  for (list[0] = 0, k = 0; k < PIPE_N_STAGES; k++) {
+    strcat (list, "  ");
+    strcat (list, pipe_stages[k].usage);
+    strcat (list, "\n");
+  }
+  return list;
+}
+
+
+/*
+  ----------------------------------------------------------------------------
+  PIPE_STAGE *pipe_stage_create (int argc, char **argv, char *err);
+  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  Creates the stage given by its command line argv[0..argc-1] (argv[0]
+  is the name of the stage). Returns NULL on failure, with a message in
+  err[] (PIPE_MAX_ERR characters) if the command line is not valid.
+  ----------------------------------------------------------------------------
+*/
+PIPE_STAGE *pipe_stage_create (int argc, char **argv, char *err) {
+  size_t k;
+
+  *err = 0;
+  for (k = 0; k < PIPE_N_STAGES; k++)
+    if (strcmp (argv[0], pipe_stages[k].name) == 0)
+      return pipe_stages[k].create (argc, argv, err);
+  sprintf (err, "unknown stage \"%.64s\"", argv[0]);
+  return NULL;
+}
+
+
+/*
+  ----------------------------------------------------------------------------
+  PIPE_GRAPH *pipe_graph_parse (char *text, long blk, char *err);
+  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  Creates the pipeline described by text, for input blocks of up to blk
+  samples. Returns NULL on failure, with a message in err[]
+  (PIPE_MAX_ERR characters).
+  ----------------------------------------------------------------------------
+*/
+PIPE_GRAPH *pipe_graph_parse (char *text, long blk, char *err) {
+  PIPE_GRAPH *g;
+  PIPE_STAGE *st;
+  char *copy, *p, *seg, *argv[PIPE_MAX_ARG];
+  int argc;
+  long len;
+
+  *err = 0;
+  if ((g = (PIPE_GRAPH *) calloc (1, sizeof (PIPE_GRAPH))) == NULL || (copy = (char *) malloc (strlen (text) + 1)) == NULL) {
+    free (g);
+    sprintf (err, "out of memory");
+    return NULL;
+  }
+  strcpy (copy, text);
+  g->blk = blk;
+
+  /* remove the comments */
+  for (p = copy; (p = strchr (p, '#')) != NULL;)
+    for (; *p && *p != '\n'; p++)
+      *p = ' ';
+
+  /* split into stages at "|" and new lines, and each stage into words */
+  for (p = copy; !*err && *p;) {
+    for (seg = p; *p && *p != '|' && *p != '\n'; p++);
+    if (*p)
+      *p++ = 0;
+    for (argc = 0, seg = strtok (seg, " \t\r"); seg != NULL && argc < PIPE_MAX_ARG; seg = strtok (NULL, " \t\r"))
+      argv[argc++] = seg;
+    if (seg != NULL)
+      sprintf (err, "%.64s: too many arguments", argv[0]);
+    else if (argc == 0)
+      continue;
+    else if (g->nstage == PIPE_MAX_STAGE)
+      sprintf (err, "more than %d stages", PIPE_MAX_STAGE);
+    else if ((st = pipe_stage_create (argc, argv, err)) != NULL)
+      g->stage[g->nstage++] = st;
+    else if (*err == 0)
+      sprintf (err, "%.64s: out of memory", argv[0]);
+  }
+  free (copy);
+  if (!*err && g->nstage == 0)
+    sprintf (err, "empty pipeline");
+
+  /* block buffers, from the rate changes */
+  for (len = blk, argc = 0; !*err && argc < g->nstage; argc++) {
+    st = g->stage[argc];
+    st->inp_len = len;
+    st->out_len = (len * st->num + st->den - 1) / st->den + st->num;
+    if ((st->out = (short *) malloc (st->out_len * sizeof (short))) == NULL)
+      sprintf (err, "out of memory");
+    len = st->out_len;
+  }
+  if (*err) {
+    pipe_graph_free (g);
+    return NULL;
+  }
+  return g;
+}
+
+
+/* Passes n samples through the stages from the k-th one */
+static long pipe_forward (PIPE_GRAPH * g, int k, short *x, long n, short **y) {
+  PIPE_STAGE *st;
+  clock_t t0;
+
+  for (; k < g->nstage && n > 0; k++) {
+    st = g->stage[k];
+    t0 = clock ();
+    st->nin += n;
+    n = st->process (st, x, n, st->out);
+    st->nout += n;
+    st->cpu += (double) (clock () - t0) / CLOCKS_PER_SEC;
+    x = st->out;
+  }
+  *y = x;
+  return k < g->nstage ? 0 : n;
+}
+
+
+/*
+  ----------------------------------------------------------------------------
+  long pipe_graph_push (PIPE_GRAPH *g, short *x, long n, short **y);
+  ~~~~~~~~~~~~~~~~~~~~
+  Processes the n (up to g->blk) input samples x[] through all the
+  stages. Returns the number of output samples, which are in *y until
+  the next call.
+  ----------------------------------------------------------------------------
+*/
+long pipe_graph_push (PIPE_GRAPH * g, short *x, long n, short **y) {
+  return pipe_forward (g, 0, x, n, y);
+}
+
+
+/*
+  ----------------------------------------------------------------------------
+  long pipe_graph_flush (PIPE_GRAPH *g, short **y);
+  ~~~~~~~~~~~~~~~~~~~~~
+  To be called repeatedly at the end of the input, until it returns 0:
+  outputs the samples kept by the stages (eg. sv56demo). Returns the
+  number of output samples, which are in *y until the next call.
+  ----------------------------------------------------------------------------
+*/
+long pipe_graph_flush (PIPE_GRAPH * g, short **y) {
+  PIPE_STAGE *st;
+  clock_t t0;
+  long n;
+
+  while (g->flushing < g->nstage) {
+    st = g->stage[g->flushing];
+    n = 0;
+    if (st->flush) {
+      t0 = clock ();
+      n = st->flush (st, st->out, st->out_len);
+      st->nout += n;
+      st->cpu += (double) (clock () - t0) / CLOCKS_PER_SEC;
+    }
+    if (n == 0)
+      g->flushing++;
+    else if ((n = pipe_forward (g, g->flushing + 1, st->out, n, y)) > 0)
+      return n;
+  }
+  return 0;
+}
+
+
+/*
+  ----------------------------------------------------------------------------
+  long pipe_graph_run (PIPE_GRAPH *g, UGST_IO *inp, UGST_IO *out);
+  ~~~~~~~~~~~~~~~~~~~
+  Processes the whole input file inp into the output file out. Returns
+  the number of output samples, or -1 on write error.
+  ----------------------------------------------------------------------------
+*/
+long pipe_graph_run (PIPE_GRAPH * g, UGST_IO * inp, UGST_IO * out) {
+  short *x, *y;
+  long n, total = 0;
+
+  while ((x = ugst_io_block (inp, g->blk, &n)) != NULL && n > 0)
+    if ((n = pipe_graph_push (g, x, n, &y)) > 0) {
+      if (ugst_io_write (out, y, n) != n)
+        return -1;
+      total += n;
+    }
+  while ((n = pipe_graph_flush (g, &y)) > 0) {
+    if (ugst_io_write (out, y, n) != n)
+      return -1;
+    total += n;
+  }
+  return total;
+}
+
+
+/*
+  ----------------------------------------------------------------------------
+  void pipe_graph_report (PIPE_GRAPH *g, FILE *fp);
+  ~~~~~~~~~~~~~~~~~~~~~~
+  Prints the samples processed by each stage, its processing time, and
+  its own summary.
+  ----------------------------------------------------------------------------
+*/
+void pipe_graph_report (PIPE_GRAPH * g, FILE * fp) {
+  PIPE_STAGE *st;
+  int k;
+
+  for (k = 0; k < g->nstage; k++) {
+    st = g->stage[k];
+    fprintf (fp, "%2d %-9s in %9ld out %9ld  %8.3f s  ", k + 1, st->name, st->nin, st->nout, st->cpu);
+    if (st->report)
+      st->report (st, fp);
+    fprintf (fp, "\n");
+  }
+}
+
+
+/*
+  ----------------------------------------------------------------------------
+  void pipe_graph_free (PIPE_GRAPH *g);
+  ~~~~~~~~~~~~~~~~~~~~
+  Releases the pipeline g and its stages.
+  ----------------------------------------------------------------------------
+*/
+void pipe_graph_free (PIPE_GRAPH * g) {
+  int k;
+
+  if (g == NULL)
+    return;
+  for (k = 0; k < g->nstage; k++) {
+    if (g->stage[k]->release)
+      g->stage[k]->release (g->stage[k]);
+    free (g->stage[k]->out);
+    free (g->stage[k]);
+  }
+  free (g);
+}
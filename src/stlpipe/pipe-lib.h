@@ -0,0 +1,77 @@
+/*
+  ============================================================================
+   File: PIPE-LIB.H                                                17.Oct.26
+  ============================================================================
+
+                         UGST/ITU-T STL PIPELINE MODULE
+
+               IN-MEMORY PROCESSING CHAINS OF STL STAGES: DEFINITIONS
+
+   History:
+   17.Oct.26    v1.0    Created.
+  ============================================================================
+*/
+#ifndef PIPE_LIB_defined
+#define PIPE_LIB_defined 100
+
+#include "ugst-io.h"
+
+/* macros for smart prototypes */
+#ifndef ARGS
+#if (defined(__STDC__) || defined(VMS) || defined(__DECC)  || defined(MSDOS) || defined(__MSDOS__))
+#define ARGS(x) x
+#else /* Unix: no parameters in prototype! */
+#define ARGS(x) ()
+#endif
+#endif
+
+/* Default block length of the pipeline, in samples (as the demo programs) */
+#define PIPE_BLOCK      256L
+
+/* Maximum number of stages, and of words in a stage description */
+#define PIPE_MAX_STAGE  32
+#define PIPE_MAX_ARG    16
+
+/* Length of the error messages */
+#define PIPE_MAX_ERR    256
+
+/* One processing stage */
+typedef struct PIPE_STAGE {
+  char name[32];                /* name of the stage (as the tool) */
+  long num, den;                /* rate change: num output samples for den input samples */
+  long inp_len;                 /* maximum length of the input blocks */
+  long out_len;                 /* length of out */
+  short *out;                   /* output block */
+  long nin, nout;               /* samples processed and produced so far */
+  double cpu;                   /* processing time, in seconds */
+
+  /* processes n input samples into out[], returns the number of output samples */
+  long (*process) ARGS ((struct PIPE_STAGE * st, short *inp, long n, short *out));
+  /* at the end of the input: produces up to max remaining samples, 0 when done (may be NULL) */
+  long (*flush) ARGS ((struct PIPE_STAGE * st, short *out, long max));
+  /* prints a summary of the stage into fp (may be NULL) */
+  void (*report) ARGS ((struct PIPE_STAGE * st, FILE * fp));
+  /* releases state (may be NULL) */
+  void (*release) ARGS ((struct PIPE_STAGE * st));
+  void *state;                  /* state of the stage */
+} PIPE_STAGE;
+
+/* A chain of stages, connected by fixed-size blocks */
+typedef struct {
+  int nstage;                   /* number of stages */
+  PIPE_STAGE *stage[PIPE_MAX_STAGE];    /* the stages, from input to output */
+  long blk;                     /* length of the input blocks */
+  int flushing;                 /* first stage not yet flushed */
+} PIPE_GRAPH;
+
+/* Prototypes */
+PIPE_STAGE *pipe_stage_create ARGS ((int argc, char **argv, char *err));
+PIPE_GRAPH *pipe_graph_parse ARGS ((char *text, long blk, char *err));
+long pipe_graph_push ARGS ((PIPE_GRAPH * g, short *x, long n, short **y));
+long pipe_graph_flush ARGS ((PIPE_GRAPH * g, short **y));
+long pipe_graph_run ARGS ((PIPE_GRAPH * g, UGST_IO * inp, UGST_IO * out));
+void pipe_graph_report ARGS ((PIPE_GRAPH * g, FILE * fp));
+void pipe_graph_free ARGS ((PIPE_GRAPH * g));
+char *pipe_stage_list ARGS ((void));
+
+#endif /* PIPE_LIB_defined */
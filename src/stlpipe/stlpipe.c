@@ -0,0 +1,174 @@
+/*                                                           17.Oct.2026 v1.0
+  ===========================================================================
+
+  STLPIPE.C
+  ~~~~~~~~~
+
+  Description:
+  ~~~~~~~~~~~~
+
+  Runs a chain of STL processing stages on a file of 16-bit samples, in
+  memory: the samples go from stage to stage in blocks, without any
+  intermediate file. Each stage is written as the command line of the
+  corresponding demo program, without the file names and the block
+  parameters, and gives the same samples as the program (see pipe-lib.c).
+  For example, the shell script
+
+    filter -q -up hq2 in.src a.tmp
+    sv56demo -q -lev -26 a.tmp b.tmp
+    mnrudemo b.tmp c.tmp 256 1 0 20
+    filter -q -down hq2 c.tmp out.src
+
+  is equivalent to
+
+    stlpipe "filter -up hq2 | sv56demo -lev -26 | mnrudemo 20
+             | filter -down hq2" in.src out.src
+
+  Usage:
+  ~~~~~~
+  $ stlpipe [-options] "pipeline" InpFile OutFile
+  $ stlpipe [-options] -f PipeFile InpFile OutFile
+
+  where:
+  pipeline ..... description of the pipeline: stages separated by "|" or
+                 new lines, "#" starts a comment
+  InpFile ...... input file ("-" for the standard input)
+  OutFile ...... output file ("-" for the standard output)
+
+  Options:
+  -f file ...... read the description of the pipeline from file
+  -blk N ....... length of the input blocks [default: 256]
+  -q ........... quiet operation: no summary of the stages
+  -list ........ list the available stages
+
+  Original author:
+  ~~~~~~~~~~~~~~~~
+  ITU-T STL contributors
+
+  History:
+  ~~~~~~~~
+  17.Oct.2026 v1.0 Created.
+
+  ===========================================================================
+*/
+
+#include "ugstdemo.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ugst-io.h"
+#include "pipe-lib.h"
+
+
+void display_usage () {
+  printf ("STLPIPE.C - Version 1.0 of 17.Oct.2026\n\n");
+  printf (" Runs a chain of STL processing stages in memory.\n\n");
+  printf (" Usage:\n");
+  printf (" $ stlpipe [-options] \"pipeline\" InpFile OutFile\n");
+  printf (" $ stlpipe [-options] -f PipeFile InpFile OutFile\n\n");
+  printf (" where pipeline is a list of stages separated by \"|\" or new lines\n");
+  printf (" (\"#\" starts a comment), each written as the command line of the\n");
+  printf (" demo program without the file names and block parameters, eg.\n");
+  printf ("   \"filter -up hq2 | sv56demo -lev -26 | filter -down hq2\"\n\n");
+  printf (" Options:\n");
+  printf ("  -f file .... read the pipeline from file\n");
+  printf ("  -blk N ..... length of the input blocks [default: 256]\n");
+  printf ("  -q ......... quiet operation\n");
+  printf ("  -list ...... list the available stages\n");
+  exit (-128);
+}
+
+
+/* Reads the whole text file name */
+char *read_text (char *name) {
+  FILE *fp;
+  char *text;
+  long len;
+
+  if ((fp = fopen (name, "r")) == NULL)
+    return NULL;
+  fseek (fp, 0L, SEEK_END);
+  len = ftell (fp);
+  rewind (fp);
+  if (len < 0 || (text = (char *) calloc (len + 1, 1)) == NULL) {
+    fclose (fp);
+    return NULL;
+  }
+  len = (long) fread (text, 1, len, fp);
+  text[len] = 0;
+  fclose (fp);
+  return text;
+}
+
+
+int main (int argc, char *argv[]) {
+  char *text = NULL, *pipe_file = NULL, err[PIPE_MAX_ERR];
+  long blk = PIPE_BLOCK, n;
+  int quiet = 0;
+  PIPE_GRAPH *g;
+  UGST_IO *inp, *out;
+
+  /* Get options */
+  while (argc > 1 && argv[1][0] == '-' && argv[1][1] != 0)
+    if (strcmp (argv[1], "-f") == 0) {
+      pipe_file = argv[2];
+      argc -= 2;
+      argv += 2;
+    } else if (strcmp (argv[1], "-blk") == 0) {
+      blk = atol (argv[2]);
+      argc -= 2;
+      argv += 2;
+    } else if (strcmp (argv[1], "-q") == 0) {
+      quiet = 1;
+      argc--;
+      argv++;
+    } else if (strcmp (argv[1], "-list") == 0) {
+      printf ("%s", pipe_stage_list ());
+      exit (0);
+    } else if (strcmp (argv[1], "-h") == 0 || strcmp (argv[1], "-?") == 0) {
+      display_usage ();
+    } else {
+      fprintf (stderr, "ERROR! Invalid option \"%s\" in command line\n\n", argv[1]);
+      display_usage ();
+    }
+
+  /* The pipeline */
+  if (pipe_file != NULL) {
+    if ((text = read_text (pipe_file)) == NULL)
+      KILL (pipe_file, 2);
+  } else if (argc > 1) {
+    text = argv[1];
+    argc--;
+    argv++;
+  }
+  if (text == NULL || argc < 3)
+    display_usage ();
+  if (blk <= 0)
+    HARAKIRI ("Block length must be positive\n", 1);
+  if ((g = pipe_graph_parse (text, blk, err)) == NULL) {
+    fprintf (stderr, "Invalid pipeline: %s\n", err);
+    exit (1);
+  }
+
+  /* Files */
+  if ((inp = ugst_io_open_read (argv[1], UGST_IO_NATIVE)) == NULL)
+    KILL (argv[1], 2);
+  if ((out = ugst_io_open_write (argv[2], UGST_IO_NATIVE)) == NULL)
+    KILL (argv[2], 3);
+
+  /* Processing */
+  if ((n = pipe_graph_run (g, inp, out)) < 0 || ugst_io_close (out) < 0)
+    KILL (argv[2], 6);
+  ugst_io_close (inp);
+
+  if (!quiet) {
+    pipe_graph_report (g, stderr);
+    fprintf (stderr, "%ld samples written\n", n);
+  }
+
+  pipe_graph_free (g);
+  if (pipe_file != NULL)
+    free (text);
+  return 0;
+}
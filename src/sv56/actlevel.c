@@ -1,4 +1,4 @@
-/*                                                              V2.4 10.Jun.98
+/*                                                              V2.5 17.Oct.26
   ============================================================================
 
   ACTLEVEL.C
@@ -69,7 +69,7 @@
   ~~~~~~~~~~~~~
   > sv-P56.c:   contains the functions related to active speech
 	        level measurement according to P.56,
-	        init_speech_voltmeter(), speech_voltmeter() and
+	        init_speech_voltmeter(), speech_voltmeter_fast() and
 	        bin_interp(). Their prototypesare in `sv-p56.h'.
   > ugst-utl.c: utility functions; here are used the gain/loss
 	        (scaling) algorithm of scale() and the data type
@@ -125,6 +125,7 @@
                            characters and changing strcpy() to
                            strncpy() in the filename copy process.
                            <simao>
+  17.Oct.26     2.5        Level measured with speech_voltmeter_fast()
   ============================================================================
 */
 
@@ -592,7 +593,7 @@ int main (int argc, char *argv[]) {
         sh2fl ((long) l, buffer, Buf, bitno, 1);
 
         /* ... Get the active level */
-        ActiveLeveldB = speech_voltmeter (Buf, (long) l, &state);
+        ActiveLeveldB = speech_voltmeter_fast (Buf, (long) l, &state);
 
         /* Print progress flag */
         if (!quiet)
@@ -0,0 +1,238 @@
+/*                                                         17/Oct/2026 v1.0 */
+/*=============================================================================
+
+                          U    U   GGG    SSSS  TTTTT
+                          U    U  G       S       T
+                          U    U  G  GG   SSSS    T
+                          U    U  G   G       S   T
+                           UUU     GG     SSS     T
+
+                   ========================================
+                    ITU-T - USER'S GROUP ON SOFTWARE TOOLS
+                   ========================================
+
+       =============================================================
+       COPYRIGHT NOTE: This source code, and all of its derivations,
+       is subject to the "ITU-T General Public License". Please have
+       it  read  in    the  distribution  disk,   or  in  the  ITU-T
+       Recommendation G.191 on "SOFTWARE TOOLS FOR SPEECH AND  AUDIO
+       CODING STANDARDS".
+       =============================================================
+
+  DESCRIPTION :
+	Benchmark of the P.56 speech voltmeter: each of the given files of
+	16-bit samples is measured by speech_voltmeter() and by
+	speech_voltmeter_fast(), and the CPU time of both is reported. The
+	state (activity and hangover counts, envelope, sums, extremes and
+	statistics) and the active level of both must be identical.
+
+	With -check, there is no timing: each file, its byte-swapped version
+	and a synthetic signal with bursts over the whole range of thresholds
+	are measured in blocks of several lengths (1 to the whole signal),
+	and the program fails if any of the results differ.
+
+  USAGE :
+	p56bench [-rep n] [-sf f] [-check] File [File ...]
+
+	-rep n ...... number of measurements of each file [default: 50]
+	-sf f ....... sampling frequency, in Hz [default: 16000]
+	-check ...... equivalence check; exit with an error on any difference
+
+  HISTORY :
+	17.Oct.26 v1.0	Created
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* UGST modules */
+#include "ugstdemo.h"
+#include "ugst-utl.h"
+#include "sv-p56.h"
+
+/* block lengths of the check mode; 0 is the whole signal */
+static long block[] = { 256, 1, 7, 160, 4097, 0 };
+
+#define N_BLOCK (sizeof (block) / sizeof (block[0]))
+
+/* samples of the synthetic signal of the check mode */
+#define N_SYNTH 48000L
+
+
+static void display_usage () {
+  printf ("P56BENCH.C - Version 1.0 of 17.Oct.2026 \n\n");
+  printf (" Benchmark of the reference and the fast P.56 speech voltmeter\n\n");
+  printf (" Usage:\n");
+  printf (" $ p56bench [-rep n] [-sf f] [-check] File [File ...]\n");
+  printf (" Options:\n");
+  printf ("  -rep n ....... number of measurements of each file [default: 50]\n");
+  printf ("  -sf f ........ sampling frequency, in Hz [default: 16000]\n");
+  printf ("  -check ....... equivalence check: fail on any difference\n");
+  printf ("\n");
+}
+
+
+/* load a file of 16-bit samples; returns the number of samples */
+static long load_file (char *name, short **x) {
+  FILE *fp;
+  long n;
+
+  if ((fp = fopen (name, "rb")) == NULL) {
+    fprintf (stderr, "\nUnable to open file %s\n", name);
+    exit (-1);
+  }
+  fseek (fp, 0L, SEEK_END);
+  n = ftell (fp) / sizeof (short);
+  rewind (fp);
+  if ((*x = (short *) calloc (n + 1, sizeof (short))) == NULL) {
+    fprintf (stderr, "\nUnable to allocate enough memory\n");
+    exit (-1);
+  }
+  n = (long) fread (*x, sizeof (short), n, fp);
+  fclose (fp);
+  return n;
+}
+
+
+/* measures x[0..n-1] in blocks of blk samples (all at once if 0) */
+static double measure (float *x, long n, long blk, double sf, int fast, SVP56_state * state) {
+  double level = -100.0;
+  long i, l;
+
+  init_speech_voltmeter (state, sf);
+  if (blk <= 0)
+    blk = n;
+  for (i = 0; i < n; i += l) {
+    l = n - i < blk ? n - i : blk;
+    level = fast ? speech_voltmeter_fast (x + i, l, state) : speech_voltmeter (x + i, l, state);
+  }
+  return level;
+}
+
+
+/* returns 1 if both states and levels are identical */
+static int same_state (SVP56_state * r, SVP56_state * f, double lr, double lf) {
+  int j;
+
+  for (j = 0; j < 15; j++)
+    if (r->a[j] != f->a[j] || r->hang[j] != f->hang[j] || r->c[j] != f->c[j])
+      return 0;
+  return lr == lf && r->n == f->n && r->s == f->s && r->sq == f->sq && r->p == f->p && r->q == f->q && r->max == f->max && r->maxP == f->maxP && r->maxN == f->maxN && r->rmsdB == f->rmsdB && r->DClevel == f->DClevel && r->ActivityFactor == f->ActivityFactor;
+}
+
+
+/* checks x[0..n-1] with all block lengths; returns the number of failures */
+static long check_signal (char *name, float *x, long n, double sf) {
+  SVP56_state ref, fast;
+  double lr, lf;
+  long b, fail = 0;
+
+  for (b = 0; b < (long) N_BLOCK; b++) {
+    lr = measure (x, n, block[b], sf, 0, &ref);
+    lf = measure (x, n, block[b], sf, 1, &fast);
+    if (!same_state (&ref, &fast, lr, lf)) {
+      fprintf (stderr, "%s, blocks of %ld: results differ (%f / %f dB)\n", name, block[b], lr, lf);
+      fail++;
+    }
+  }
+  printf ("%-40s %8ld samples %8.3f dB %s\n", name, n, lr, fail ? "FAILED" : "ok");
+  return fail;
+}
+
+
+int main (int argc, char *argv[]) {
+  short *sig;
+  float *x;
+  double sf = 16000, lr = 0, lf = 0, cpuRef, cpuFast, amp;
+  long rep = 50, n, i, r, lcg = 4711, fail = 0;
+  int check = 0;
+  clock_t t0;
+  SVP56_state ref, fast;
+  char name[300];
+
+  /* Check options */
+  while (argc > 1 && argv[1][0] == '-')
+    if (strcmp (argv[1], "-rep") == 0) {
+      rep = atol (argv[2]);
+      argc -= 2;
+      argv += 2;
+    } else if (strcmp (argv[1], "-sf") == 0) {
+      sf = atof (argv[2]);
+      argc -= 2;
+      argv += 2;
+    } else if (strcmp (argv[1], "-check") == 0) {
+      check = 1;
+      argc--;
+      argv++;
+    } else {
+      display_usage ();
+      exit (argv[1][1] == 'h' || argv[1][1] == '?' ? 2 : -1);
+    }
+  if (argc < 2) {
+    display_usage ();
+    exit (-1);
+  }
+
+  if (check) {
+    /* bursts of noise from full scale down to below the lowest threshold,
+       separated by silences longer and shorter than the hangover */
+    if ((x = (float *) malloc (N_SYNTH * sizeof (float))) == NULL) {
+      fprintf (stderr, "\nUnable to allocate enough memory\n");
+      exit (-1);
+    }
+    for (amp = 1.0, i = 0; i < N_SYNTH; i++) {
+      if (i % 3000 == 0)
+        amp /= 2.0;
+      lcg = (lcg * 1103515245 + 12345) & 0x7FFFFFFF;
+      x[i] = (i % 3000) < ((i / 3000) % 2 ? 1000 : 2600) ? (float) (amp * ((lcg >> 15) - 32768) / 32768.0) : 0;
+    }
+    fail += check_signal ("(synthetic bursts)", x, N_SYNTH, sf);
+    free (x);
+  } else
+    printf ("%-40s %8s %12s %12s %8s %10s\n", "file", "samples", "ref[s]", "fast[s]", "speedup", "level[dB]");
+
+  for (; argc > 1; argc--, argv++) {
+    n = load_file (argv[1], &sig);
+    if ((x = (float *) malloc ((n + 1) * sizeof (float))) == NULL) {
+      fprintf (stderr, "\nUnable to allocate enough memory\n");
+      exit (-1);
+    }
+    sh2fl (n, sig, x, 16, 1);
+
+    if (check) {
+      fail += check_signal (argv[1], x, n, sf);
+
+      /* the same samples, byte-swapped */
+      for (i = 0; i < n; i++)
+        sig[i] = (short) (((sig[i] >> 8) & 0x00FF) | (sig[i] << 8));
+      sh2fl (n, sig, x, 16, 1);
+      sprintf (name, "%.280s (swapped)", argv[1]);
+      fail += check_signal (name, x, n, sf);
+    } else {
+      t0 = clock ();
+      for (r = 0; r < rep; r++)
+        lr = measure (x, n, 256, sf, 0, &ref);
+      cpuRef = (double) (clock () - t0) / CLOCKS_PER_SEC;
+
+      t0 = clock ();
+      for (r = 0; r < rep; r++)
+        lf = measure (x, n, 256, sf, 1, &fast);
+      cpuFast = (double) (clock () - t0) / CLOCKS_PER_SEC;
+
+      if (!same_state (&ref, &fast, lr, lf))
+        fail++;
+      printf ("%-40s %8ld %12.3f %12.3f %7.1fx %10.3f%s\n", argv[1], n, cpuRef, cpuFast, (cpuRef + 1e-9) / (cpuFast + 1e-9), lr, same_state (&ref, &fast, lr, lf) ? "" : " DIFFERENT");
+    }
+
+    free (x);
+    free (sig);
+  }
+
+  if (fail) {
+    fprintf (stderr, "\n%ld measurement(s) with different results\n", fail);
+    return 1;
+  }
+  return 0;
+}
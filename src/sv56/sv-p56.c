@@ -1,4 +1,4 @@
-/*                                                             v2.3 19.MAY.05
+/*                                                             v2.4 17.OCT.26
 =============================================================================
 
                           U    U   GGG    SSSS  TTTTT
@@ -40,6 +40,11 @@ speech_voltmeter .............. measurement of the active speech level of
                                 data in a buffer according to P.56. Other
 				relevant statistics are also available.
 
+speech_voltmeter_fast ......... same as speech_voltmeter, with the envelope
+                                located among the thresholds once per sample
+                                and the activity and hangover counts
+                                updated once per run of samples.
+
 HISTORY:
 
    07.Oct.91 v1.0 Release of 1st version to UGST.
@@ -57,6 +62,8 @@ HISTORY:
 				  suggested by Mr Kabal.
 				  Upper and lower bounds are updated during the interpolation.
 						<Cyril Guillaume & Stephane Ragot -- stephane.ragot@francetelecom.com>
+   17.Oct.26 v2.4 Added speech_voltmeter_fast(); the statistics at the end
+                  of speech_voltmeter() moved to svp56_statistics().
 
 =============================================================================
 */
@@ -346,11 +353,60 @@ void init_speech_voltmeter (SVP56_state * state, double sampl_freq) {
 /* Hooked to eliminate sigularity with log(0.0) (happens w/all-0 data blocks */
 #define MIN_LOG_OFFSET 1.0e-20
 
+/* Computes the statistics of state after the measurement, and returns the
+   active speech level (common to both speech voltmeter functions) */
+static double svp56_statistics (SVP56_state * state) {
+  int j;
+  double AdB, CdB, AmdB, CmdB, ActiveSpeechLevel;
+  double LongTermLevel, Delta[15];
+
+  /* Computes the statistics */
+  state->DClevel = (state->s) / (state->n);
+  LongTermLevel = 10 * log10 ((state->sq) / (state->n) + MIN_LOG_OFFSET);
+  state->rmsdB = LongTermLevel - state->refdB;
+  state->ActivityFactor = 0;
+  ActiveSpeechLevel = -100.0;
+
+  /* Test the lower active counter; if 0, is silence */
+  if (state->a[0] == 0)
+    return (ActiveSpeechLevel);
+  else
+    AdB = 10 * log10 (((state->sq) / state->a[0]) + MIN_LOG_OFFSET);
+
+  /* Test if the lower act.counter is below the margin: if yes, is silence */
+  CdB = 20 * log10 ((double) state->c[0]);
+  if (AdB - CdB < M)
+    return (ActiveSpeechLevel);
+
+  /* Proceed serially for steps 2 and up -- this is the most common case */
+  for (j = 1; j < THRES_NO; j++) {
+    if (state->a[j] != 0) {
+      AdB = 10 * log10 (((state->sq) / state->a[j]) + MIN_LOG_OFFSET);
+      CdB = 20 * log10 (((double) state->c[j]) + MIN_LOG_OFFSET);
+      Delta[j] = AdB - CdB;
+      if (Delta[j] <= M) {      /* then interpolates to find the active */
+        /* level and the activity factor and exits */
+        /* AmdB is AdB for j-1, CmdB is CdB for j-1 */
+        AmdB = 10 * log10 (((state->sq) / state->a[j - 1]) + MIN_LOG_OFFSET);
+        CmdB = 20 * log10 (((double) state->c[j - 1] + MIN_LOG_OFFSET));
+
+        ActiveSpeechLevel = bin_interp (AdB, AmdB, CdB, CmdB, M, 0.5 /* dB */ );
+
+        state->ActivityFactor = pow (10.0, ((LongTermLevel - ActiveSpeechLevel) / 10));
+        ActiveSpeechLevel -= (state->refdB);
+        break;
+      }
+    }
+  }
+
+  return (ActiveSpeechLevel);
+}
+
+
 double speech_voltmeter (float *buffer, long smpno, SVP56_state * state) {
   int I, j;
   long k;
-  double g, x, AdB, CdB, AmdB, CmdB, ActiveSpeechLevel;
-  double LongTermLevel, Delta[15];
+  double g, x;
 
 
   /* Some initializations */
@@ -393,46 +449,147 @@ double speech_voltmeter (float *buffer, long smpno, SVP56_state * state) {
     }                           /* [j] */
   }                             /* [k] */
 
-  /* Computes the statistics */
-  state->DClevel = (state->s) / (state->n);
-  LongTermLevel = 10 * log10 ((state->sq) / (state->n) + MIN_LOG_OFFSET);
-  state->rmsdB = LongTermLevel - state->refdB;
-  state->ActivityFactor = 0;
-  ActiveSpeechLevel = -100.0;
+  return svp56_statistics (state);
+}
 
-  /* Test the lower active counter; if 0, is silence */
-  if (state->a[0] == 0)
-    return (ActiveSpeechLevel);
-  else
-    AdB = 10 * log10 (((state->sq) / state->a[0]) + MIN_LOG_OFFSET);
+/* .................... End of speech_voltmeter() ........................ */
 
-  /* Test if the lower act.counter is below the margin: if yes, is silence */
-  CdB = 20 * log10 ((double) state->c[0]);
-  if (AdB - CdB < M)
-    return (ActiveSpeechLevel);
 
-  /* Proceed serially for steps 2 and up -- this is the most common case */
-  for (j = 1; j < THRES_NO; j++) {
-    if (state->a[j] != 0) {
-      AdB = 10 * log10 (((state->sq) / state->a[j]) + MIN_LOG_OFFSET);
-      CdB = 20 * log10 (((double) state->c[j]) + MIN_LOG_OFFSET);
-      Delta[j] = AdB - CdB;
-      if (Delta[j] <= M) {      /* then interpolates to find the active */
-        /* level and the activity factor and exits */
-        /* AmdB is AdB for j-1, CmdB is CdB for j-1 */
-        AmdB = 10 * log10 (((state->sq) / state->a[j - 1]) + MIN_LOG_OFFSET);
-        CmdB = 20 * log10 (((double) state->c[j - 1] + MIN_LOG_OFFSET));
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
-        ActiveSpeechLevel = bin_interp (AdB, AmdB, CdB, CmdB, M, 0.5 /* dB */ );
+        double speech_voltmeter_fast (float *buffer, long smpno,
+        ~~~~~~~~~~~~~~~~~~~~~~~~~~~~  SVP56_state *state);
 
-        state->ActivityFactor = pow (10.0, ((LongTermLevel - ActiveSpeechLevel) / 10));
-        ActiveSpeechLevel -= (state->refdB);
-        break;
-      }
-    }
+        Description:
+        ~~~~~~~~~~~~
+
+        Same as speech_voltmeter(), giving identical results in `state'
+        and the same active speech level, with fewer operations per
+        sample:
+
+        > since the thresholds c[] increase, the thresholds exceeded by
+          the envelope q are c[0..m-1]; m is found by a branch-free
+          binary search (4 compares instead of 30);
+        > the envelope changes slowly, so m stays the same for runs of
+          samples; the activity and hangover counts are updated once
+          per run: for j<m, a[j] grows by the run length and hang[j]
+          is reset, for j>=m, both a[j] and hang[j] grow until hang[j]
+          reaches the hangover I.
+
+        If the thresholds in `state' do not increase (they always do
+        after init_speech_voltmeter()), speech_voltmeter() is used.
+
+        Variables:
+        ~~~~~~~~~~
+        Name:         Type:   Use:
+        buffer          I        input samples vector
+        smpno           I        number of samples in vector `buffer'
+        state          I/O       state variable associated with `buffer'
+
+        Value returned:
+        ~~~~~~~~~~~~~~~
+        Returns the active speech level, in dBov, as a double.
+
+        Prototype:   in sv-p56.h
+        ~~~~~~~~~~
+
+        Log of changes:
+        ~~~~~~~~~~~~~~~
+        17.Oct.26     1.0       Created.
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+*/
+
+/* Updates the activity and hangover counts for `run' samples whose envelope
+   exceeds the thresholds c[0..m-1] only */
+static void svp56_count (SVP56_state * state, int m, long run, int I) {
+  unsigned long inc;
+  int j;
+
+  if (run == 0)
+    return;
+  for (j = 0; j < m; j++) {
+    state->a[j] += run;
+    state->hang[j] = 0;
   }
+  for (; j < THRES_NO; j++)
+    if (state->hang[j] < (unsigned long) I) {
+      inc = I - state->hang[j];
+      if (inc > (unsigned long) run)
+        inc = run;
+      state->a[j] += inc;
+      state->hang[j] += inc;
+    }
+}
 
-  return (ActiveSpeechLevel);
+
+double speech_voltmeter_fast (float *buffer, long smpno, SVP56_state * state) {
+  int I, j, m, run_m;
+  long k, run;
+  double g, x, ax, p, q, s, sq, max, maxP, maxN, *c = state->c;
+
+  /* The threshold search needs increasing thresholds */
+  for (j = 1; j < THRES_NO; j++)
+    if (!(c[j] > c[j - 1]))
+      return speech_voltmeter (buffer, smpno, state);
+
+  /* Some initializations */
+  I = floor (H * state->f + 0.5);
+  g = exp (-1.0 / (state->f * T));
+  p = state->p;
+  q = state->q;
+  s = state->s;
+  sq = state->sq;
+  max = state->max;
+  maxP = state->maxP;
+  maxN = state->maxN;
+  run = 0;
+  run_m = 0;
+
+  for (k = 0; k < smpno; k++) {
+    x = (double) buffer[k];
+    ax = fabs (x);
+    if (ax > max)
+      max = ax;
+    if (x > maxP)
+      maxP = x;
+    if (x < maxN)
+      maxN = x;
+
+    /* Process 1 of P.56 */
+    sq += x * x;
+    s += x;
+
+    /* Process 2 of P.56 */
+    p = g * p + (1 - g) * ((x > 0) ? x : -x);
+    q = g * q + (1 - g) * p;
+
+    /* Number of thresholds not above q (the search reads c[0..14] only) */
+    m = (q >= c[7]) << 3;
+    m += (q >= c[m + 3]) << 2;
+    m += (q >= c[m + 1]) << 1;
+    m += (q >= c[m]);
+
+    /* Counts are updated at the end of each run of the same m */
+    if (m != run_m) {
+      svp56_count (state, run_m, run, I);
+      run_m = m;
+      run = 0;
+    }
+    run++;
+  }
+  svp56_count (state, run_m, run, I);
+
+  state->p = p;
+  state->q = q;
+  state->s = s;
+  state->sq = sq;
+  state->n += smpno;
+  state->max = max;
+  state->maxP = maxP;
+  state->maxN = maxN;
+
+  return svp56_statistics (state);
 }
 
 #undef MIN_LOG_OFFSET
@@ -440,4 +597,4 @@ double speech_voltmeter (float *buffer, long smpno, SVP56_state * state) {
 #undef H
 #undef T
 #undef THRES_NO
-/* .................... End of speech_voltmeter() ........................ */
+/* ................. End of speech_voltmeter_fast() ..................... */
@@ -23,6 +23,7 @@
                         <tdsimao@venus.cpqd.ansp.br>
    01.Sep.95    v2.2    Updated version number to match sv-p56.c and added 
                         smart prototypes <simao@ctd.comsat.com>
+   17.Oct.26    v2.4    Prototype of speech_voltmeter_fast
 
   ============================================================================
 */
@@ -61,6 +62,7 @@ typedef struct {
 double bin_interp ARGS ((double upcount, double lwcount, double upthr, double lwthr, double Margin, double tol));
 void init_speech_voltmeter ARGS ((SVP56_state * state, double sampl_freq));
 double speech_voltmeter ARGS ((float *buffer, long smpno, SVP56_state * state));
+double speech_voltmeter_fast ARGS ((float *buffer, long smpno, SVP56_state * state));
 
 
 /* Definitions for getting statistics from a `SVP56_state' variable */
@@ -1,4 +1,4 @@
-/*                                                              v3.5 02.Feb.10
+/*                                                             v3.10 17.Oct.26
   ============================================================================
 
   SV56DEMO.C
@@ -45,6 +45,7 @@
   $ sv56demo [-options] FileIn FileOut
              [BlockSize [1stBlock [NoOfBlocks [DesiredLevel
              [SampleRate [Resolution] ] ] ] ] ]
+  $ sv56demo [-options] -batch ListFile
   where:
   FileIn           is the input file to be analysed and equalized;
   FileOut          is the output equalized file
@@ -81,12 +82,21 @@
   -end eb ........ define `eb' as the last block to be measured
   -n nb .......... define `nb' as the number of blocks to be measured;
                    equivalent to parameter N2 above [default: whole file]
+  -onepass ....... read the input file only once: the measured samples are
+                   kept in memory and equalized from there (the input may
+                   then be a pipe, or "-" for the standard input; without
+                   -onepass, such an input is rejected)
+  -batch file .... normalize all the files listed in `file', one pair
+                   "FileIn FileOut" per line ("#" starts a comment), each
+                   read only once; the other options apply to all of them.
+                   The statistics are printed as CSV, one line per file
+  -threads n ..... number of worker threads of -batch [default: 4]
 
   Modules used:
   ~~~~~~~~~~~~~
   > sv-P56.c: contains the functions related to active speech
               level measurement according to P.56,
-              init_speech_voltmeter(), speech_voltmeter() and
+              init_speech_voltmeter(), speech_voltmeter_fast() and
               bin_interp(). Their prototypesare in `sv-p56.h'.
   > ugst-utl.c: utility functions; here are used the gain/loss
               (scaling) algorithm of scale() and the data type
@@ -155,6 +165,18 @@
                            a multiple of the block size <simao>.
   02.Feb.10     3.5        Modified maximum string length to avoid
                            buffer overruns (y.hiwasaki)
+  17.Oct.26     3.6        File I/O with the ugst-io module: the input
+                           file is memory-mapped and the level
+                           measurement pass reads the samples in
+                           place; file size found from the open file
+  17.Oct.26     3.7        Level measured with speech_voltmeter_fast()
+  17.Oct.26     3.8        Added -onepass (input read once, kept in memory)
+                           and -batch (lists of files normalized by
+                           worker threads, CSV statistics)
+  17.Oct.26     3.9        Non-seekable input rejected in two passes
+                           (was silently giving an empty output)
+  17.Oct.26     3.10       -batch built on ugst-batch.c: the files of
+                           the list are taken from a shared queue
 
   ============================================================================
 */
@@ -171,9 +193,7 @@
 #if defined(VMS)
 #include <perror.h>
 #include <file.h>
-#include <stat.h>
 #else /* Unix/DOS */
-#include <sys/stat.h>
 #if defined(MSDOS)
 #include <fcntl.h>
 #include <io.h>
@@ -185,9 +205,40 @@
 
 /* ... Include of utilities ... */
 #include "ugst-utl.h"
+#include "ugst-io.h"
+#include "ugst-batch.h"
 
 /* Local definitions */
 #define MIN_LOG_OFFSET 1.0e-20  /* To avoid sigularity with log(0.0) */
+#define MAX_BLK 4096            /* Longest block converted to float at once */
+
+/* Parameters common to all the files of a batch */
+typedef struct {
+  long N;                       /* block length */
+  long start;                   /* first sample */
+  long nmax;                    /* samples to process; 0 for all */
+  long bitno;                   /* resolution */
+  double sf;                    /* sampling frequency */
+  double NdB;                   /* desired level */
+  int use_active_level;         /* 0 for the RMS level */
+  short mask;                   /* truncation mask for bitno bits */
+} SV56_PARAM;
+
+/* One file of a batch */
+typedef struct {
+  char *FileIn, *FileOut;
+  SVP56_state state;            /* P.56 statistics of the file */
+  double level;                 /* active level, dB */
+  double factor;                /* equalization factor */
+  long NrSat;                   /* number of clipped samples */
+  int status;                   /* UGST_BATCH_OK, or an error status */
+} SV56_JOB;
+
+/* Data shared by the worker threads of -batch */
+typedef struct {
+  SV56_PARAM *par;
+  SV56_JOB *job;
+} SV56_BATCH;
 
 /*
  -------------------------------------------------------------------------
@@ -202,7 +253,7 @@
  -------------------------------------------------------------------------
 */
 void display_usage () {
-  printf ("SV56DEMO.C: Version 3.5 of 02.Feb.2010 \n\n");
+  printf ("SV56DEMO.C: Version 3.9 of 17.Oct.2026 \n\n");
   printf ("  Program to level-equalize a speech file \"NdB\" dBs below\n");
   printf ("  the overload point for a linear n-bit (default: 16 bit) system.\n");
   printf ("  using the P.56 speech voltmeter algorithm.\n");
@@ -211,6 +262,7 @@ void display_usage () {
   printf ("  $ sv56demo [-options] FileIn FileOut \n");
   printf ("             [BlockSize [1stBlock [NoOfBlocks [DesiredLevel\n");
   printf ("             [SampleRate [Resolution] ] ] ] ] ]\n");
+  printf ("  $ sv56demo [-options] -batch ListFile\n");
   printf ("  FileIn: ..... is the input file to be analysed and equalized;\n");
   printf ("  FileOut: .... is the output equalized file\n");
   printf ("  BlockSize: .. is the block size [default: 256 samples]\n");
@@ -243,6 +295,11 @@ void display_usage () {
   printf ("  -q .......... quiet operation - does not print the progress flag.\n");
   printf ("                Saves time and avoids trash in batch processings.\n");
   printf ("  -qq ......... print short statistics summary; no progress flag.\n");
+  printf ("  -onepass .... read the input only once, keeping it in memory\n");
+  printf ("                (FileIn may then be a pipe or \"-\")\n");
+  printf ("  -batch file . normalize the files listed in `file', one pair\n");
+  printf ("                \"FileIn FileOut\" per line; CSV statistics\n");
+  printf ("  -threads n .. number of worker threads of -batch [default: 4]\n");
 
   /* Quit program */
   exit (-128);
@@ -411,6 +468,274 @@ void print_p56_short_summary (FILE * out, char *file, SVP56_state state, double
 /* ................... End of print_p56_short_summary() .................... */
 
 
+/*
+  ============================================================================
+
+       short *load_samples (UGST_IO *Fi, long nmax, long *n);
+       ~~~~~~~~~~~~~~~~~~~
+
+       Reads up to nmax samples of the input file Fi (all the remaining
+       ones if nmax is 0) into one buffer, sized to the file when its length
+       is known and grown as needed otherwise (pipes).
+
+       Returns
+       ~~~~~~~
+       The buffer (to be released with free()) and its number of samples in
+       *n; NULL if there is not enough memory.
+
+       Log of changes
+       ~~~~~~~~~~~~~~
+       17.Oct.26	v1.0	Creation.
+
+  ============================================================================
+*/
+short *load_samples (UGST_IO * Fi, long nmax, long *n) {
+  short *x, *y;
+  long size, got;
+
+  size = ugst_io_length (Fi);
+  if (size <= 0)
+    size = UGST_IO_BLOCK;
+  if (nmax > 0 && nmax < size)
+    size = nmax;
+  if ((x = (short *) malloc (size * sizeof (short))) == NULL)
+    return NULL;
+
+  for (*n = 0; nmax <= 0 || *n < nmax; *n += got) {
+    if (*n == size) {
+      size = nmax > 0 && 2 * size > nmax ? nmax : 2 * size;
+      if ((y = (short *) realloc (x, size * sizeof (short))) == NULL) {
+        free (x);
+        return NULL;
+      }
+      x = y;
+    }
+    if ((got = ugst_io_read (Fi, x + *n, size - *n)) <= 0)
+      break;
+  }
+  return x;
+}
+
+/* ....................... End of load_samples() ........................... */
+
+
+/*
+  ============================================================================
+
+       double measure_samples (short *x, long n, long N, long bitno,
+       ~~~~~~~~~~~~~~~~~~~~~~  SVP56_state *state);
+
+       Measures the n samples in x with the speech voltmeter, in blocks of
+       N samples, as the measurement pass of the program.
+
+       Returns
+       ~~~~~~~
+       The active level, in dB.
+
+       Log of changes
+       ~~~~~~~~~~~~~~
+       17.Oct.26	v1.0	Creation.
+
+  ============================================================================
+*/
+double measure_samples (short *x, long n, long N, long bitno, SVP56_state * state) {
+  float Buf[MAX_BLK];
+  double ActiveLeveldB = -100.0;
+  long i, l;
+
+  for (i = 0; i < n; i += l) {
+    l = n - i < N ? n - i : N;
+    if (l > MAX_BLK)
+      l = MAX_BLK;
+    sh2fl (l, x + i, Buf, bitno, 1);
+    ActiveLeveldB = speech_voltmeter_fast (Buf, l, state);
+  }
+  return ActiveLeveldB;
+}
+
+/* ..................... End of measure_samples() ......................... */
+
+
+/*
+  ============================================================================
+
+       long equalize_samples (short *x, long n, long N, long bitno,
+       ~~~~~~~~~~~~~~~~~~~~~  short mask, double factor, UGST_IO *Fo);
+
+       Equalizes the n samples in x (in place) by factor, with hard
+       clipping and truncation to bitno bits (mask), as the equalization
+       pass of the program, and writes them to Fo.
+
+       Returns
+       ~~~~~~~
+       The number of clipped samples, or -1 on write errors.
+
+       Log of changes
+       ~~~~~~~~~~~~~~
+       17.Oct.26	v1.0	Creation.
+
+  ============================================================================
+*/
+long equalize_samples (short *x, long n, long N, long bitno, short mask, double factor, UGST_IO * Fo) {
+  float Buf[MAX_BLK];
+  long i, l, NrSat = 0;
+
+  for (i = 0; i < n; i += l) {
+    l = n - i < N ? n - i : N;
+    if (l > MAX_BLK)
+      l = MAX_BLK;
+    sh2fl (l, x + i, Buf, bitno, 1);
+    scale (Buf, l, factor);
+    NrSat += fl2sh (l, Buf, x + i, (double) 0.0, mask);
+  }
+  if (ugst_io_write (Fo, x, n) < 0)
+    return -1;
+  return NrSat;
+}
+
+/* .................... End of equalize_samples() ......................... */
+
+
+/*
+  ============================================================================
+
+       void normalize_file (SV56_PARAM *par, SV56_JOB *job);
+       ~~~~~~~~~~~~~~~~~~~
+
+       Normalizes one file of a batch, reading it only once. Nothing is
+       printed: the statistics and the status (UGST_BATCH_OK, or an
+       error status of ugst-batch.h) are left in job.
+
+       Log of changes
+       ~~~~~~~~~~~~~~
+       17.Oct.26	v1.0	Creation.
+
+  ============================================================================
+*/
+void normalize_file (SV56_PARAM * par, SV56_JOB * job) {
+  UGST_IO *Fi, *Fo;
+  short *x;
+  long n;
+
+  init_speech_voltmeter (&job->state, par->sf);
+  job->level = -100.0;
+  job->factor = 1.0;
+  job->NrSat = 0;
+
+  if ((Fi = ugst_io_open_read (job->FileIn, UGST_IO_NATIVE)) == NULL) {
+    job->status = UGST_BATCH_OPEN_ERROR;
+    return;
+  }
+  if (ugst_io_seek (Fi, par->start) < 0) {
+    job->status = UGST_BATCH_SEEK_ERROR;
+    ugst_io_close (Fi);
+    return;
+  }
+  x = load_samples (Fi, par->nmax, &n);
+  ugst_io_close (Fi);
+  if (x == NULL || (par->nmax > 0 && n <= par->nmax - par->N)) {
+    job->status = UGST_BATCH_READ_ERROR;
+    free (x);
+    return;
+  }
+
+  job->level = measure_samples (x, n, par->N, par->bitno, &job->state);
+  if (par->use_active_level)
+    job->factor = pow (10.0, (par->NdB - job->level) / 20.0);
+  else
+    job->factor = pow (10.0, (par->NdB - SVP56_get_rms_dB (job->state)) / 20.0);
+
+  if ((Fo = ugst_io_open_write (job->FileOut, UGST_IO_NATIVE)) == NULL)
+    job->status = UGST_BATCH_CREATE_ERROR;
+  else {
+    job->NrSat = equalize_samples (x, n, par->N, par->bitno, par->mask, job->factor, Fo);
+    if (ugst_io_close (Fo) < 0 || job->NrSat < 0)
+      job->status = UGST_BATCH_WRITE_ERROR;
+  }
+  free (x);
+}
+
+/* ...................... End of normalize_file() .......................... */
+
+
+/* Worker of -batch: normalizes the files handed out by the pool */
+static void batch_worker (UGST_BATCH * b) {
+  SV56_BATCH *data = (SV56_BATCH *) b->data;
+  long i;
+
+  while ((i = ugst_batch_next (b)) >= 0)
+    normalize_file (data->par, &data->job[i]);
+}
+
+
+/*
+  ============================================================================
+
+       int normalize_batch (char *list, SV56_PARAM *par, int threads,
+       ~~~~~~~~~~~~~~~~~~~  double ratio, FILE *out);
+
+       Normalizes all the files listed in the text file list (one pair
+       "FileIn FileOut" per line, "#" starts a comment) with the given
+       number of worker threads, each file with its own speech voltmeter
+       state, and prints one CSV line of statistics per file into out, in
+       the order of the list. ratio converts the normalized values to PCM.
+
+       Returns
+       ~~~~~~~
+       The number of files that could not be normalized.
+
+       Log of changes
+       ~~~~~~~~~~~~~~
+       17.Oct.26	v1.0	Creation.
+       17.Oct.26	v1.1	List and threads from ugst-batch.c.
+
+  ============================================================================
+*/
+int normalize_batch (char *list, SV56_PARAM * par, int threads, double ratio, FILE * out) {
+  SV56_BATCH data;
+  UGST_BATCH b;
+  UGST_BATCH_FILE *files;
+  SV56_JOB *job;
+  long njob, i;
+  int fail = 0;
+
+  /* Read the list of files */
+  if ((njob = ugst_batch_read_list (list, &files)) < 0)
+    exit (1);
+  if ((job = (SV56_JOB *) calloc (njob + 1, sizeof (SV56_JOB))) == NULL)
+    HARAKIRI ("Can't allocate memory for the list of files\n", 1);
+  for (i = 0; i < njob; i++) {
+    job[i].FileIn = files[i].FileIn;
+    job[i].FileOut = files[i].FileOut;
+  }
+
+  /* Run the workers */
+  data.par = par;
+  data.job = job;
+  if (ugst_batch_run (&b, njob, threads, batch_worker, &data) < 0)
+    HARAKIRI ("Unable to create thread\n", 1);
+
+  /* Report, in the order of the list */
+  fprintf (out, "file,output,samples,min,max,dc,rms_dB,active_dB,activity,gain,clipped,status\n");
+  for (i = 0; i < njob; i++) {
+    fprintf (out, "%s,%s,%lu,", job[i].FileIn, job[i].FileOut, job[i].state.n);
+    if (job[i].state.n == 0)
+      fprintf (out, ",,,,,,,,");
+    else
+      fprintf (out, "%.0f,%.0f,%.2f,%.3f,%.3f,%.3f,%.4f,%ld,", ratio * job[i].state.maxN, ratio * job[i].state.maxP, ratio * job[i].state.DClevel, job[i].state.rmsdB, job[i].level, SVP56_get_activity (job[i].state), job[i].factor, job[i].NrSat);
+    fprintf (out, "%s\n", ugst_batch_status (job[i].status));
+    if (job[i].status != UGST_BATCH_OK)
+      fail++;
+  }
+
+  free (job);
+  free (files);
+  return fail;
+}
+
+/* ..................... End of normalize_batch() .......................... */
+
+
 /*
    **************************************************************************
    ***                                                                    ***
@@ -432,15 +757,18 @@ int main (int argc, char *argv[]) {
 
   /* File-related variables */
   char FileIn[MAX_STRLEN], FileOut[MAX_STRLEN];
-  FILE *Fi, *Fo;                /* input/output file pointers */
+  UGST_IO *Fi, *Fo;             /* input/output files */
   FILE *out = stdout;           /* where to print the statistical results */
 #ifdef VMS
   char mrs[15];
 #endif
 
   /* Other variables */
-  char quiet = 0, use_active_level = 1, long_summary = 1;
-  short buffer[4096];
+  char quiet = 0, use_active_level = 1, long_summary = 1, onepass = 0;
+  char *batch = NULL;
+  int threads = 4;
+  SV56_PARAM par;
+  short buffer[4096], *blk, *x = NULL;
   float Buf[4096];
   long NrSat = 0, start_byte, bitno = 16;
   double sf = 16000, factor;
@@ -455,7 +783,7 @@ int main (int argc, char *argv[]) {
   if (argc < 2)
     display_usage ();
   else {
-    while (argc > 1 && argv[1][0] == '-')
+    while (argc > 1 && argv[1][0] == '-' && argv[1][1] != 0)
       if (strcmp (argv[1], "-lev") == 0) {
         /* Change default level normalization */
         NdB = atof (argv[2]);
@@ -537,6 +865,29 @@ int main (int argc, char *argv[]) {
         /* Move argv over the option to the next argument */
         argv++;
         argc--;
+      } else if (strcmp (argv[1], "-onepass") == 0) {
+        /* Read the input file once, keeping it in memory */
+        onepass = 1;
+
+        /* Move argv over the option to the next argument */
+        argv++;
+        argc--;
+      } else if (strcmp (argv[1], "-batch") == 0) {
+        /* Normalize a list of files */
+        batch = argv[2];
+
+        /* Update argc/argv to next valid option/argument */
+        argv += 2;
+        argc -= 2;
+      } else if (strcmp (argv[1], "-threads") == 0) {
+        /* Number of worker threads of -batch */
+        threads = atoi (argv[2]);
+        if (threads < 1 || threads > UGST_BATCH_MAX_THREADS)
+          HARAKIRI ("Invalid number of threads\n", 1);
+
+        /* Update argc/argv to next valid option/argument */
+        argv += 2;
+        argc -= 2;
       } else if (strcmp (argv[1], "-?") == 0 || strstr (argv[1], "-help")) {
         /* Print help */
         display_usage ();
@@ -547,6 +898,24 @@ int main (int argc, char *argv[]) {
   }
 
 
+  /* Batch mode: the options apply to all the files of the list */
+  if (batch != NULL) {
+    if (N1 < 1 || N < 1)
+      HARAKIRI ("Invalid block parameters\n", 1);
+    par.N = N;
+    par.start = (N1 - 1) * N;
+    par.nmax = N2 * N;
+    par.bitno = bitno;
+    par.sf = sf;
+    par.NdB = NdB;
+    par.use_active_level = use_active_level;
+    par.mask = (short) mask[16 - bitno];
+    i = normalize_batch (batch, &par, threads, pow ((double) 2.0, (double) (bitno - 1)), out);
+    if (out != stdout)
+      fclose (out);
+    return (i ? 1 : 0);
+  }
+
   /* Reads parameters for processing */
   GET_PAR_S (1, "_Input File: ........................... ", FileIn);
   GET_PAR_S (2, "_Output File: .......................... ", FileOut);
@@ -562,15 +931,6 @@ int main (int argc, char *argv[]) {
   start_byte = --N1;
   start_byte *= N * sizeof (short);
 
-  /* Check if is to process the whole file */
-  if (N2 == 0) {
-    struct stat st;
-
-    /* ... find the input file size ... */
-    stat (FileIn, &st);
-    N2 = ceil ((st.st_size - start_byte) / (double) (N * sizeof (short)));
-  }
-
   /* Overflow (saturation) point */
   Overflow = pow ((double) 2.0, (double) (bitno - 1));
 
@@ -586,15 +946,23 @@ int main (int argc, char *argv[]) {
 #ifdef VMS
   sprintf (mrs, "mrs=%d", 2 * N);
 #endif
-  if ((Fi = fopen (FileIn, RB)) == NULL)
+  if ((Fi = ugst_io_open_read (FileIn, UGST_IO_NATIVE)) == NULL)
     KILL (FileIn, 2);
 
   /* Creates output file */
-  if ((Fo = fopen (FileOut, WB)) == NULL)
+  if ((Fo = ugst_io_open_write (FileOut, UGST_IO_NATIVE)) == NULL)
     KILL (FileOut, 3);
 
+  /* Two passes read the input twice: it must be seekable (not a pipe) */
+  if (!onepass && ugst_io_length (Fi) < 0)
+    HARAKIRI ("Input is not seekable (pipe or standard input): use -onepass\n", 4);
+
+  /* Check if is to process the whole file (found when reading, in one pass) */
+  if (N2 == 0 && !onepass)
+    N2 = ceil ((ugst_io_length (Fi) * sizeof (short) - start_byte) / (double) (N * sizeof (short)));
+
   /* Move pointer to 1st block of interest */
-  if (fseek (Fi, start_byte, 0) < 0l)
+  if (ugst_io_seek (Fi, start_byte / (long) sizeof (short)) < 0)
     KILL (FileIn, 4);
 
 
@@ -604,15 +972,23 @@ int main (int argc, char *argv[]) {
   if (!quiet)
     printf ("  Processing \r");
 
+  /* In one pass, keep the selected blocks in memory */
+  if (onepass) {
+    if ((x = load_samples (Fi, N2 * N, &l)) == NULL || l <= (N2 - 1) * N)
+      KILL (FileIn, 5);
+    N2 = (l + N - 1) / N;
+    ActiveLeveldB = measure_samples (x, l, N, bitno, &state);
+  }
+
   /* Process selected blocks */
-  for (i = 0; i < N2; i++) {
+  for (i = 0; i < N2 && !onepass; i++) {
     /* Read samples ... */
-    if ((l = fread (buffer, sizeof (short), N, Fi)) > 0) {
+    if ((blk = ugst_io_block (Fi, N, &l)) != NULL && l > 0) {
       /* ... Convert samples to float */
-      sh2fl ((long) l, buffer, Buf, bitno, 1);
+      sh2fl ((long) l, blk, Buf, bitno, 1);
 
       /* ... Get the active level */
-      ActiveLeveldB = speech_voltmeter (Buf, (long) l, &state);
+      ActiveLeveldB = speech_voltmeter_fast (Buf, (long) l, &state);
 
       /* Print some preliminary information */
       if (!quiet)
@@ -644,13 +1020,20 @@ int main (int argc, char *argv[]) {
 
   /* EQUALIZATION: hard clipping (with truncation) */
 
+  /* In one pass, from memory */
+  if (onepass) {
+    if ((NrSat = equalize_samples (x, l, N, bitno, (short) mask[16 - bitno], factor, Fo)) < 0)
+      KILL (FileOut, 6);
+    free (x);
+  }
+
   /* Move pointer to 1st desired block */
-  if (fseek (Fi, start_byte, 0) < 0l)
+  else if (ugst_io_seek (Fi, start_byte / (long) sizeof (short)) < 0)
     KILL (FileIn, 4);
 
   /* Get data of interest, equalize and de-normalize */
-  for (i = 0; i < N2; i++) {
-    if ((l = fread (buffer, sizeof (short), N, Fi)) > 0) {
+  for (i = 0; i < N2 && !onepass; i++) {
+    if ((l = ugst_io_read (Fi, buffer, N)) > 0) {
       /* convert samples to float */
       sh2fl ((long) l, buffer, Buf, bitno, 1);
 
@@ -661,7 +1044,7 @@ int main (int argc, char *argv[]) {
       NrSat += fl2sh ((long) l, Buf, buffer, (double) 0.0, mask[16 - bitno]);
 
       /* write equalized, de-normalized and hard-clipped samples to file */
-      if ((l = fwrite (buffer, sizeof (short), l, Fo)) < 0)
+      if ((l = ugst_io_write (Fo, buffer, l)) < 0)
         KILL (FileOut, 6);
     } else {
       KILL (FileIn, 5);
@@ -680,8 +1063,9 @@ int main (int argc, char *argv[]) {
     printf ("---> DONE    \n");
 
   /* Close files ... */
-  fclose (Fi);
-  fclose (Fo);
+  ugst_io_close (Fi);
+  if (ugst_io_close (Fo) < 0)
+    KILL (FileOut, 6);
   if (out != stdout)
     fclose (out);
 #if !defined(VMS)
@@ -0,0 +1,353 @@
+/*                                                           17.Oct.2026 v1.0
+  ===========================================================================
+
+  IOBENCH.C
+  ~~~~~~~~~
+
+  Description:
+  ~~~~~~~~~~~~
+
+  Benchmark and check of the block I/O module ugst-io. A file of
+  pseudo-random 16-bit samples is written, then read and written again:
+
+  - with one fread()/fwrite() per sample (as stereoop up to v1.03);
+  - with one fread()/fwrite() per block of 256 samples (as most demos);
+  - with ugst_io_read()/ugst_io_write() on blocks of 256 samples;
+  - with ugst_io_block() on large blocks (samples used in place);
+  - with ugst_io_read() on a byte-swapped file;
+  - with ugst_io_read() on the standard input (buffered fallback used for
+    pipes).
+
+  The throughput (millions of samples per second of CPU time) is reported.
+
+  With -check, a short file is used, no timing is done, and it is verified
+  that all the methods give the same samples, that ugst_io_seek() and
+  ugst_io_length() are consistent, and that a file written byte-swapped
+  reads back unchanged.
+
+  Usage:
+  ~~~~~~
+  $ iobench [-options] file
+
+  where file is the name of the temporary file (overwritten, then removed).
+
+  Options:
+  -mb M ........ size of the file in MBytes [default: 256]
+  -check ....... only check the module (no timing), and return a non-zero
+                 exit code if any check fails
+
+  Original author:
+  ~~~~~~~~~~~~~~~~
+  ITU-T STL contributors
+
+  History:
+  ~~~~~~~~
+  17.Oct.2026 v1.0 Created.
+
+  ===========================================================================
+*/
+
+#include "ugstdemo.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ugst-io.h"
+
+#define BLOCK_LEN 256
+
+static long lcg = 12345;
+
+
+/* Pseudo-random samples */
+void gen_samples (short *x, long n) {
+  long i;
+
+  for (i = 0; i < n; i++) {
+    lcg = (lcg * 1103515245 + 12345) & 0x7FFFFFFF;
+    x[i] = (short) ((lcg >> 15) - 32768);
+  }
+}
+
+
+/* Checksum of n samples */
+unsigned long checksum (unsigned long sum, short *x, long n) {
+  long i;
+
+  for (i = 0; i < n; i++)
+    sum = sum * 31 + (unsigned short) x[i];
+  return sum;
+}
+
+
+/* Reads the file with one fread per sample */
+unsigned long read_sample (char *name, long *n) {
+  FILE *fp;
+  short s;
+  unsigned long sum = 0;
+
+  if ((fp = fopen (name, RB)) == NULL)
+    KILL (name, 2);
+  for (*n = 0; fread (&s, sizeof (short), 1, fp) == 1; (*n)++)
+    sum = checksum (sum, &s, 1);
+  fclose (fp);
+  return sum;
+}
+
+
+/* Reads the file with one fread per block */
+unsigned long read_fread (char *name, long *n) {
+  FILE *fp;
+  short buf[BLOCK_LEN];
+  unsigned long sum = 0;
+  long l;
+
+  if ((fp = fopen (name, RB)) == NULL)
+    KILL (name, 2);
+  for (*n = 0; (l = (long) fread (buf, sizeof (short), BLOCK_LEN, fp)) > 0; *n += l)
+    sum = checksum (sum, buf, l);
+  fclose (fp);
+  return sum;
+}
+
+
+/* Reads the file (or the standard input, with name "-") with ugst_io_read */
+unsigned long read_io (char *name, int swap, long *n) {
+  UGST_IO *f;
+  short buf[BLOCK_LEN];
+  unsigned long sum = 0;
+  long l;
+
+  if ((f = ugst_io_open_read (name, swap)) == NULL)
+    KILL (name, 2);
+  for (*n = 0; (l = ugst_io_read (f, buf, BLOCK_LEN)) > 0; *n += l)
+    sum = checksum (sum, buf, l);
+  ugst_io_close (f);
+  return sum;
+}
+
+
+/* Reads the file with ugst_io_block */
+unsigned long read_block (char *name, long *n) {
+  UGST_IO *f;
+  short *x;
+  unsigned long sum = 0;
+  long l;
+
+  if ((f = ugst_io_open_read (name, UGST_IO_NATIVE)) == NULL)
+    KILL (name, 2);
+  for (*n = 0; (x = ugst_io_block (f, UGST_IO_BLOCK, &l)) != NULL && l > 0; *n += l)
+    sum = checksum (sum, x, l);
+  ugst_io_close (f);
+  return sum;
+}
+
+
+/* Writes x[0..n-1] with one fwrite per sample (len=1), per block (len>1) */
+void write_fwrite (char *name, short *x, long n, long len) {
+  FILE *fp;
+  long i, l;
+
+  if ((fp = fopen (name, WB)) == NULL)
+    KILL (name, 3);
+  for (i = 0; i < n; i += l) {
+    l = n - i < len ? n - i : len;
+    if (fwrite (x + i, sizeof (short), l, fp) != (size_t) l)
+      KILL (name, 6);
+  }
+  fclose (fp);
+}
+
+
+/* Writes x[0..n-1] with ugst_io_write on blocks of len samples */
+void write_io (char *name, short *x, long n, long len, int swap) {
+  UGST_IO *f;
+  long i, l;
+
+  if ((f = ugst_io_open_write (name, swap)) == NULL)
+    KILL (name, 3);
+  for (i = 0; i < n; i += l) {
+    l = n - i < len ? n - i : len;
+    if (ugst_io_write (f, x + i, l) != l)
+      KILL (name, 6);
+  }
+  if (ugst_io_close (f) < 0)
+    KILL (name, 6);
+}
+
+
+/* Reads the file from stdin, through the buffered path */
+unsigned long read_stdin (char *name, long *n) {
+  if (freopen (name, RB, stdin) == NULL)
+    KILL (name, 2);
+  return read_io ("-", UGST_IO_NATIVE, n);
+}
+
+
+void display_usage () {
+  printf ("IOBENCH.C - Version 1.0 of 17.Oct.2026\n\n");
+  printf (" Benchmark and check of the block I/O module ugst-io.\n\n");
+  printf (" Usage:\n");
+  printf (" $ iobench [-options] file\n\n");
+  printf (" where file is the temporary file (overwritten, then removed)\n\n");
+  printf (" Options:\n");
+  printf ("  -mb M ...... size of the file in MBytes [default: 256]\n");
+  printf ("  -check ..... only check the module, no timing\n");
+  exit (-128);
+}
+
+
+int main (int argc, char *argv[]) {
+  static long seg_len[] = { 1, 4095, 17, 65537, 160, 3 };
+  char *name;
+  long n, i, l, nr, fail = 0;
+  double mb = 256, cpu;
+  int check = 0;
+  short *x, *y;
+  unsigned long ref, sum;
+  UGST_IO *f;
+  clock_t t0;
+
+  /* Get options */
+  while (argc > 1 && argv[1][0] == '-' && argv[1][1] != 0)
+    if (strcmp (argv[1], "-mb") == 0) {
+      mb = atof (argv[2]);
+      argc -= 2;
+      argv += 2;
+    } else if (strcmp (argv[1], "-check") == 0) {
+      check = 1;
+      argc--;
+      argv++;
+    } else if (strcmp (argv[1], "-h") == 0 || strcmp (argv[1], "-?") == 0) {
+      display_usage ();
+    } else {
+      fprintf (stderr, "ERROR! Invalid option \"%s\" in command line\n\n", argv[1]);
+      display_usage ();
+    }
+  if (argc < 2)
+    display_usage ();
+  name = argv[1];
+
+  /* an odd number of samples, not a multiple of any block length */
+  n = check ? 300001 : (long) (mb * 1048576 / sizeof (short)) | 1;
+  if ((x = (short *) malloc (n * sizeof (short))) == NULL || (y = (short *) malloc (n * sizeof (short))) == NULL)
+    HARAKIRI ("Error allocating memory for the samples\n", 3);
+  gen_samples (x, n);
+  ref = checksum (0, x, n);
+
+  if (check) {
+    /* written in blocks of varying length */
+    if ((f = ugst_io_open_write (name, UGST_IO_NATIVE)) == NULL)
+      KILL (name, 3);
+    for (i = 0, l = 0; i < n; i += l) {
+      l = seg_len[(i / 7) % (sizeof (seg_len) / sizeof (seg_len[0]))];
+      if (l > n - i)
+        l = n - i;
+      if (ugst_io_write (f, x + i, l) != l)
+        KILL (name, 6);
+    }
+    if (ugst_io_close (f) < 0)
+      KILL (name, 6);
+
+    /* all the readers give the same samples */
+    sum = read_fread (name, &nr);
+    printf ("fread ............. %s\n", sum == ref && nr == n ? "ok" : "DIFFERS");
+    fail += sum != ref || nr != n;
+    if ((f = ugst_io_open_read (name, UGST_IO_NATIVE)) == NULL)
+      KILL (name, 2);
+    sum = read_io (name, UGST_IO_NATIVE, &nr);
+    printf ("ugst_io_read ...... %s (%s)\n", sum == ref && nr == n ? "ok" : "DIFFERS", ugst_io_mapped (f) ? "mapped" : "buffered");
+    fail += sum != ref || nr != n;
+    sum = read_block (name, &nr);
+    printf ("ugst_io_block ..... %s\n", sum == ref && nr == n ? "ok" : "DIFFERS");
+    fail += sum != ref || nr != n;
+    sum = read_stdin (name, &nr);
+    printf ("standard input .... %s\n", sum == ref && nr == n ? "ok" : "DIFFERS");
+    fail += sum != ref || nr != n;
+
+    /* length, seek, and reads of varying length */
+    nr = ugst_io_length (f) == n;
+    nr = nr && ugst_io_seek (f, n - 5) == 0 && ugst_io_read (f, y, 10) == 5 && memcmp (y, x + n - 5, 5 * sizeof (short)) == 0;
+    nr = nr && ugst_io_seek (f, 0) == 0;
+    for (i = 0, l = 0; i < n; i += l) {
+      l = seg_len[(i / 3) % (sizeof (seg_len) / sizeof (seg_len[0]))];
+      if ((l = ugst_io_read (f, y + i, l)) <= 0)
+        break;
+    }
+    ugst_io_close (f);
+    nr = nr && i == n && memcmp (x, y, n * sizeof (short)) == 0;
+    printf ("seek and length ... %s\n", nr ? "ok" : "DIFFERS");
+    fail += !nr;
+
+    /* swapped file: the bytes are reversed on disk, and read back unchanged */
+    write_io (name, x, n, 4093, UGST_IO_SWAPPED);
+    sum = read_io (name, UGST_IO_SWAPPED, &nr);
+    memcpy (y, x, n * sizeof (short));
+    ugst_io_swap (y, n);
+    i = sum == ref && nr == n && read_fread (name, &nr) == checksum (0, y, n);
+    printf ("byte swapping ..... %s\n", i ? "ok" : "DIFFERS");
+    fail += !i;
+  } else {
+    printf ("%.0f MBytes, %ld samples\n\n", n * sizeof (short) / 1048576.0, n);
+    printf ("%-26s %12s\n", "method", "[Msamples/s]");
+
+    t0 = clock ();
+    write_fwrite (name, x, n, 1);
+    cpu = (double) (clock () - t0) / CLOCKS_PER_SEC;
+    printf ("%-26s %12.1f\n", "write, fwrite per sample", n / 1e6 / (cpu + 1e-9));
+
+    t0 = clock ();
+    write_fwrite (name, x, n, BLOCK_LEN);
+    cpu = (double) (clock () - t0) / CLOCKS_PER_SEC;
+    printf ("%-26s %12.1f\n", "write, fwrite per block", n / 1e6 / (cpu + 1e-9));
+
+    t0 = clock ();
+    write_io (name, x, n, BLOCK_LEN, UGST_IO_NATIVE);
+    cpu = (double) (clock () - t0) / CLOCKS_PER_SEC;
+    printf ("%-26s %12.1f\n", "write, ugst_io_write", n / 1e6 / (cpu + 1e-9));
+
+    t0 = clock ();
+    sum = read_sample (name, &nr);
+    cpu = (double) (clock () - t0) / CLOCKS_PER_SEC;
+    printf ("%-26s %12.1f\n", "read, fread per sample", nr / 1e6 / (cpu + 1e-9));
+    fail += sum != ref;
+
+    t0 = clock ();
+    sum = read_fread (name, &nr);
+    cpu = (double) (clock () - t0) / CLOCKS_PER_SEC;
+    printf ("%-26s %12.1f\n", "read, fread per block", nr / 1e6 / (cpu + 1e-9));
+    fail += sum != ref;
+
+    t0 = clock ();
+    sum = read_io (name, UGST_IO_NATIVE, &nr);
+    cpu = (double) (clock () - t0) / CLOCKS_PER_SEC;
+    printf ("%-26s %12.1f\n", "read, ugst_io_read", nr / 1e6 / (cpu + 1e-9));
+    fail += sum != ref;
+
+    t0 = clock ();
+    sum = read_block (name, &nr);
+    cpu = (double) (clock () - t0) / CLOCKS_PER_SEC;
+    printf ("%-26s %12.1f\n", "read, ugst_io_block", nr / 1e6 / (cpu + 1e-9));
+    fail += sum != ref;
+
+    t0 = clock ();
+    sum = read_stdin (name, &nr);
+    cpu = (double) (clock () - t0) / CLOCKS_PER_SEC;
+    printf ("%-26s %12.1f\n", "read, standard input", nr / 1e6 / (cpu + 1e-9));
+    fail += sum != ref;
+
+    t0 = clock ();
+    read_io (name, UGST_IO_SWAPPED, &nr);
+    cpu = (double) (clock () - t0) / CLOCKS_PER_SEC;
+    printf ("%-26s %12.1f\n", "read, swapped", nr / 1e6 / (cpu + 1e-9));
+  }
+
+  remove (name);
+  free (x);
+  free (y);
+
+  if (fail)
+    fprintf (stderr, "%ld check(s) failed\n", fail);
+  return fail ? 1 : 0;
+}
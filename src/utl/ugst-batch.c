@@ -0,0 +1,314 @@
+/*                                                            v1.0  17.Oct.26
+=============================================================================
+
+                          U    U   GGG    SSSS  TTTTT
+                          U    U  G       S       T
+                          U    U  G  GG   SSSS    T
+                          U    U  G   G       S   T
+                           UUU     GG     SSS     T
+
+                   ========================================
+                    ITU-T - USER'S GROUP ON SOFTWARE TOOLS
+                   ========================================
+
+
+       =============================================================
+       COPYRIGHT NOTE: This source code, and all of its derivations,
+       is subject to the "ITU-T General Public License". Please have
+       it  read  in    the  distribution  disk,   or  in  the  ITU-T
+       Recommendation G.191 on "SOFTWARE TOOLS FOR SPEECH AND  AUDIO
+       CODING STANDARDS".
+       =============================================================
+
+
+MODULE:         UGST-BATCH.C, BATCH PROCESSING OF LISTS OF FILES
+
+ORIGINAL BY:    ITU-T STL contributors
+
+PROTOTYPE:     in ugst-batch.h
+
+DESCRIPTION:
+
+    Common part of the batch drivers (sv56demo -batch, g722batch,
+    rpebatch, vselpbatch), which process all the files of a list with a
+    pool of worker threads. The list file has one pair "FileIn FileOut"
+    per line; "#" starts a comment. Every thread takes the next job of
+    the list from a shared counter as soon as it is free, so that a long
+    file does not hold back the jobs behind it.
+
+FUNCTIONS:
+
+    ugst_batch_read_list: .. reads the pairs of file names of a list
+    ugst_batch_run: ........ runs a worker function on a pool of threads
+    ugst_batch_next: ....... hands out the next job to a worker
+    ugst_batch_clock: ...... monotonic wall-clock time
+    ugst_batch_status: ..... text of the status of a job
+
+HISTORY:
+
+  17.Oct.26 v1.0 Created.
+=============================================================================
+*/
+
+/*
+ * .................... INCLUDES ....................
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "ugst-batch.h"
+
+#ifdef _WIN32
+#include <process.h>
+#endif
+
+/*
+ * .................... LOCAL DATA ....................
+ */
+
+static char *status_text[8] = { "ok", "open-error", "create-error", "state-error", "format-error", "seek-error", "read-error", "write-error" };
+
+
+/*
+ * .................... FUNCTIONS ....................
+ */
+
+/*
+  ============================================================================
+
+       long ugst_batch_read_list (char *list, UGST_BATCH_FILE **files);
+       ~~~~~~~~~~~~~~~~~~~~~~~~~
+
+       Reads the pairs "FileIn FileOut" of the list file, in order, into
+       a new array *files, to be released with free(). Names longer than
+       MAX_STRLEN-1 characters are truncated.
+
+       Returns
+       ~~~~~~~
+       The number of pairs, or -1 (with a message on stderr) when the list
+       cannot be read, a line has no output file, or memory is short.
+
+       Log of changes
+       ~~~~~~~~~~~~~~
+       17.Oct.26	v1.0	Creation.
+
+  ============================================================================
+*/
+long ugst_batch_read_list (char *list, UGST_BATCH_FILE ** files) {
+  UGST_BATCH_FILE *f = NULL, *tmp;
+  char line[2 * MAX_STRLEN + 2], fmt[32], *p;
+  FILE *fp;
+  long n = 0, size = 0;
+  int i;
+
+  *files = NULL;
+  if ((fp = fopen (list, "r")) == NULL) {
+    perror (list);
+    return -1;
+  }
+  sprintf (fmt, "%%%ds %%%ds", MAX_STRLEN - 1, MAX_STRLEN - 1);
+  while (fgets (line, sizeof (line), fp) != NULL) {
+    if ((p = strchr (line, '#')) != NULL)
+      *p = 0;
+    if (n == size) {
+      size = size ? 2 * size : 64;
+      if ((tmp = (UGST_BATCH_FILE *) realloc (f, size * sizeof (UGST_BATCH_FILE))) == NULL) {
+        fprintf (stderr, "Can't allocate memory for the list of files\n");
+        break;
+      }
+      f = tmp;
+    }
+    i = sscanf (line, fmt, f[n].FileIn, f[n].FileOut);
+    if (i == 2)
+      n++;
+    else if (i == 1) {
+      fprintf (stderr, "Missing output file for %s in %s\n", f[n].FileIn, list);
+      break;
+    }
+  }
+  if (!feof (fp)) {
+    fclose (fp);
+    free (f);
+    return -1;
+  }
+  fclose (fp);
+  *files = f;
+  return n;
+}
+
+/* ................... End of ugst_batch_read_list() ..................... */
+
+
+/* Worker thread */
+#ifdef _WIN32
+static unsigned __stdcall batch_thread (void *arg)
+#else
+static void *batch_thread (void *arg)
+#endif
+{
+  UGST_BATCH *b = (UGST_BATCH *) arg;
+
+  b->worker (b);
+  return 0;
+}
+
+
+/*
+  ============================================================================
+
+       int ugst_batch_run (UGST_BATCH *b, long njob, int threads,
+       ~~~~~~~~~~~~~~~~~~  void (*worker) (UGST_BATCH *b), void *data);
+
+       Runs worker(b) on threads threads (at most njob, and at least one;
+       with a single thread, in the calling thread) and waits for all of
+       them. The worker gets its jobs, numbered from 0 to njob-1, with
+       ugst_batch_next(); data is left in b->data for it.
+
+       Returns
+       ~~~~~~~
+       The number of threads used, or -1 if a thread could not be
+       created; the threads already started are then waited for.
+
+       Log of changes
+       ~~~~~~~~~~~~~~
+       17.Oct.26	v1.0	Creation.
+
+  ============================================================================
+*/
+int ugst_batch_run (UGST_BATCH * b, long njob, int threads, void (*worker) (UGST_BATCH * b), void *data) {
+#ifdef _WIN32
+  HANDLE tid[UGST_BATCH_MAX_THREADS];
+#else
+  pthread_t tid[UGST_BATCH_MAX_THREADS];
+#endif
+  int t, started;
+
+  if (threads > njob)
+    threads = (int) njob;
+  if (threads > UGST_BATCH_MAX_THREADS)
+    threads = UGST_BATCH_MAX_THREADS;
+  if (threads < 1)
+    threads = 1;
+
+  b->njob = njob;
+  b->next = 0;
+  b->worker = worker;
+  b->data = data;
+  if (threads == 1) {
+    worker (b);
+    return 1;
+  }
+
+#ifdef _WIN32
+  InitializeCriticalSection (&b->lock);
+#else
+  pthread_mutex_init (&b->lock, NULL);
+#endif
+  for (started = 0; started < threads; started++) {
+#ifdef _WIN32
+    tid[started] = (HANDLE) _beginthreadex (NULL, 0, batch_thread, b, 0, NULL);
+    if (tid[started] == 0)
+#else
+    if (pthread_create (&tid[started], NULL, batch_thread, b) != 0)
+#endif
+      break;
+  }
+  for (t = 0; t < started; t++) {
+#ifdef _WIN32
+    WaitForSingleObject (tid[t], INFINITE);
+    CloseHandle (tid[t]);
+#else
+    pthread_join (tid[t], NULL);
+#endif
+  }
+#ifdef _WIN32
+  DeleteCriticalSection (&b->lock);
+#else
+  pthread_mutex_destroy (&b->lock);
+#endif
+  return started == threads ? threads : -1;
+}
+
+/* ...................... End of ugst_batch_run() ........................ */
+
+
+/*
+  ============================================================================
+
+       long ugst_batch_next (UGST_BATCH *b);
+       ~~~~~~~~~~~~~~~~~~~~
+
+       Hands out the next job of the batch to the calling worker.
+
+       Returns
+       ~~~~~~~
+       The number of the job, or -1 when all the jobs have been handed out.
+
+       Log of changes
+       ~~~~~~~~~~~~~~
+       17.Oct.26	v1.0	Creation.
+
+  ============================================================================
+*/
+long ugst_batch_next (UGST_BATCH * b) {
+  long i;
+
+  if (b->njob == 0)
+    return -1;
+#ifdef _WIN32
+  EnterCriticalSection (&b->lock);
+#else
+  pthread_mutex_lock (&b->lock);
+#endif
+  i = b->next < b->njob ? b->next++ : -1;
+#ifdef _WIN32
+  LeaveCriticalSection (&b->lock);
+#else
+  pthread_mutex_unlock (&b->lock);
+#endif
+  return i;
+}
+
+/* ...................... End of ugst_batch_next() ....................... */
+
+
+/*
+  ============================================================================
+
+       double ugst_batch_clock (void);
+       ~~~~~~~~~~~~~~~~~~~~~~~
+
+       Monotonic wall-clock time, in seconds from an arbitrary origin, for
+       timing a batch (CLOCK_MONOTONIC; QueryPerformanceCounter on
+       Windows).
+
+       Log of changes
+       ~~~~~~~~~~~~~~
+       17.Oct.26	v1.0	Creation.
+
+  ============================================================================
+*/
+double ugst_batch_clock (void) {
+#ifdef _WIN32
+  LARGE_INTEGER f, t;
+  QueryPerformanceFrequency (&f);
+  QueryPerformanceCounter (&t);
+  return (double) t.QuadPart / (double) f.QuadPart;
+#else
+  struct timespec ts;
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+#endif
+}
+
+/* ..................... End of ugst_batch_clock() ....................... */
+
+
+/* Text of a UGST_BATCH_... status, as printed in the reports */
+char *ugst_batch_status (int status) {
+  return status >= 0 && status < 8 ? status_text[status] : "error";
+}
+
+/* ................... End of file ugst-batch.c ........................... */
@@ -0,0 +1,77 @@
+/*
+  ============================================================================
+   File: UGST-BATCH.H                                              17.Oct.26
+  ============================================================================
+
+                         UGST/ITU-T UTILITIES MODULE
+
+                  BATCH PROCESSING OF LISTS OF FILES: DEFINITIONS
+
+   History:
+   17.Oct.26    v1.0    Created.
+  ============================================================================
+*/
+#ifndef UGST_BATCH_defined
+#define UGST_BATCH_defined 100
+
+#include <stdio.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+/* macros for smart prototypes */
+#ifndef ARGS
+#if (defined(__STDC__) || defined(VMS) || defined(__DECC)  || defined(MSDOS) || defined(__MSDOS__))
+#define ARGS(x) x
+#else /* Unix: no parameters in prototype! */
+#define ARGS(x) ()
+#endif
+#endif
+
+/* Same as in ugstdemo.h */
+#ifndef MAX_STRLEN
+#define MAX_STRLEN 1024
+#endif
+
+/* Maximum number of worker threads */
+#define UGST_BATCH_MAX_THREADS 64
+
+/* Status of a file of a batch; see ugst_batch_status() */
+#define UGST_BATCH_OK           0
+#define UGST_BATCH_OPEN_ERROR   1       /* input file not opened */
+#define UGST_BATCH_CREATE_ERROR 2       /* output file not created */
+#define UGST_BATCH_STATE_ERROR  3       /* coder state not allocated */
+#define UGST_BATCH_FORMAT_ERROR 4       /* invalid input file */
+#define UGST_BATCH_SEEK_ERROR   5       /* start sample not reached */
+#define UGST_BATCH_READ_ERROR   6       /* input file not read */
+#define UGST_BATCH_WRITE_ERROR  7       /* output file not written */
+
+/* One line "FileIn FileOut" of a list file */
+typedef struct {
+  char FileIn[MAX_STRLEN], FileOut[MAX_STRLEN];
+} UGST_BATCH_FILE;
+
+/* Pool of worker threads sharing the jobs of a batch */
+typedef struct UGST_BATCH_s {
+  long njob;                    /* number of jobs */
+  long next;                    /* next job to be handed out */
+  void (*worker) ARGS ((struct UGST_BATCH_s * b));      /* run by every thread */
+  void *data;                   /* data of the caller */
+#ifdef _WIN32
+  CRITICAL_SECTION lock;
+#else
+  pthread_mutex_t lock;
+#endif
+} UGST_BATCH;
+
+/* Prototypes */
+long ugst_batch_read_list ARGS ((char *list, UGST_BATCH_FILE ** files));
+int ugst_batch_run ARGS ((UGST_BATCH * b, long njob, int threads, void (*worker) (UGST_BATCH * b), void *data));
+long ugst_batch_next ARGS ((UGST_BATCH * b));
+double ugst_batch_clock ARGS ((void));
+char *ugst_batch_status ARGS ((int status));
+
+#endif /* UGST_BATCH_defined */
@@ -0,0 +1,439 @@
+/*                                                            v1.0  17.Oct.26
+=============================================================================
+
+                          U    U   GGG    SSSS  TTTTT
+                          U    U  G       S       T
+                          U    U  G  GG   SSSS    T
+                          U    U  G   G       S   T
+                           UUU     GG     SSS     T
+
+                   ========================================
+                    ITU-T - USER'S GROUP ON SOFTWARE TOOLS
+                   ========================================
+
+
+       =============================================================
+       COPYRIGHT NOTE: This source code, and all of its derivations,
+       is subject to the "ITU-T General Public License". Please have
+       it  read  in    the  distribution  disk,   or  in  the  ITU-T
+       Recommendation G.191 on "SOFTWARE TOOLS FOR SPEECH AND  AUDIO
+       CODING STANDARDS".
+       =============================================================
+
+
+MODULE:         UGST-IO.C, BLOCK I/O OF 16-BIT SAMPLE FILES
+
+ORIGINAL BY:    ITU-T STL contributors
+
+PROTOTYPE:     in ugst-io.h
+
+DESCRIPTION:
+
+    Reading and writing of files of 16-bit samples in large blocks.
+    Regular input files are memory-mapped where the system supports it
+    (POSIX mmap), so that the samples can be used in place, without any
+    copy or system call per block; other inputs (pipes, terminals, or
+    systems without mmap) are read with large freads. Output files are
+    written in large blocks. Files whose byte order differs from the one
+    of the machine are byte-swapped in bulk. The name "-" stands for the
+    standard input or output.
+
+    Compiling with -DUGST_IO_NO_MMAP disables the memory mapping.
+
+FUNCTIONS:
+
+    ugst_io_little_endian: . tells whether the machine is little endian
+    ugst_io_open_read: ..... opens an input file
+    ugst_io_open_write: .... creates an output file
+    ugst_io_mapped: ........ tells whether an input file is mapped
+    ugst_io_length: ........ number of samples of an input file
+    ugst_io_seek: .......... moves to a given sample of an input file
+    ugst_io_read: .......... copies samples from an input file
+    ugst_io_block: ......... returns a block of samples of an input
+                             file, in place when possible
+    ugst_io_write: ......... writes samples to an output file
+    ugst_io_close: ......... flushes and closes a file
+    ugst_io_swap: .......... swaps the bytes of an array of samples
+
+HISTORY:
+
+  17.Oct.26 v1.0 Created.
+=============================================================================
+*/
+
+/*
+ * .................... INCLUDES ....................
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ugst-io.h"
+
+#if !defined(UGST_IO_NO_MMAP) && (defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__)))
+#define UGST_IO_MMAP
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#if defined(_WIN32)
+#include <io.h>
+#include <fcntl.h>
+#endif
+
+/* Alignment of the block buffers, in bytes */
+#define UGST_IO_ALIGN 64
+
+
+/*
+ * .................... LOCAL FUNCTIONS ....................
+ */
+
+/* (Re)allocate the block buffer of f for n samples, aligned; returns 0 on failure */
+static int ugst_io_alloc (UGST_IO * f, long n) {
+  char *raw;
+
+  if (f->buf != NULL && f->buf_len >= n)
+    return 1;
+  if (f->buf != NULL)
+    free (((char **) f->buf)[-1]);
+  f->buf = NULL;
+  f->buf_len = 0;
+  if ((raw = (char *) malloc (n * sizeof (short) + UGST_IO_ALIGN + sizeof (char *))) == NULL)
+    return 0;
+  f->buf = (short *) (raw + sizeof (char *) + UGST_IO_ALIGN - ((size_t) (raw + sizeof (char *)) % UGST_IO_ALIGN));
+  ((char **) f->buf)[-1] = raw;
+  f->buf_len = n;
+  return 1;
+}
+
+
+/* Write the waiting samples of an output file; returns 0 on failure */
+static int ugst_io_flush (UGST_IO * f) {
+  if (f->buf_cnt > 0 && fwrite (f->buf, sizeof (short), f->buf_cnt, f->fp) != (size_t) f->buf_cnt)
+    f->error = 1;
+  f->buf_cnt = 0;
+  return !f->error;
+}
+
+
+/* Allocate and clear the state of a file */
+static UGST_IO *ugst_io_new (int swap, int output) {
+  UGST_IO *f;
+
+  if ((f = (UGST_IO *) calloc (1, sizeof (UGST_IO))) == NULL)
+    return NULL;
+  f->swap = swap;
+  f->output = output;
+  if (!ugst_io_alloc (f, UGST_IO_BLOCK)) {
+    free (f);
+    return NULL;
+  }
+  return f;
+}
+
+
+/*
+ * .................... FUNCTIONS ....................
+ */
+
+/*
+  ----------------------------------------------------------------------------
+  int ugst_io_little_endian (void);
+  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  Returns 1 if the machine is little endian, 0 otherwise. Files in the
+  other byte order are opened with UGST_IO_SWAPPED.
+  ----------------------------------------------------------------------------
+*/
+int ugst_io_little_endian (void) {
+  short tmp = 0x0001;
+
+  return *(char *) &tmp == 1;
+}
+
+
+/*
+  ----------------------------------------------------------------------------
+  void ugst_io_swap (short *x, long n);
+  ~~~~~~~~~~~~~~~~~
+  Swaps the two bytes of the n samples of x[].
+  ----------------------------------------------------------------------------
+*/
+void ugst_io_swap (short *x, long n) {
+  unsigned short *u = (unsigned short *) x;
+  long i;
+
+  for (i = 0; i < n; i++)
+    u[i] = (unsigned short) ((u[i] >> 8) | (u[i] << 8));
+}
+
+
+/*
+  ----------------------------------------------------------------------------
+  UGST_IO *ugst_io_open_read (char *name, int swap);
+  ~~~~~~~~~~~~~~~~~~~~~~~~~~
+  Opens the input file name ("-" for the standard input), with samples
+  in the machine byte order (swap=UGST_IO_NATIVE) or in the opposite one
+  (swap=UGST_IO_SWAPPED). Regular files are memory-mapped if possible.
+  Returns NULL if the file cannot be opened.
+  ----------------------------------------------------------------------------
+*/
+UGST_IO *ugst_io_open_read (char *name, int swap) {
+  UGST_IO *f;
+#ifdef UGST_IO_MMAP
+  struct stat st;
+  void *map;
+  int fd;
+#endif
+
+  if ((f = ugst_io_new (swap, 0)) == NULL)
+    return NULL;
+
+  if (strcmp (name, "-") == 0) {
+    f->fp = stdin;
+#if defined(_WIN32)
+    _setmode (_fileno (stdin), _O_BINARY);
+#endif
+    return f;
+  }
+
+#ifdef UGST_IO_MMAP
+  if ((fd = open (name, O_RDONLY)) >= 0) {
+    if (fstat (fd, &st) == 0 && S_ISREG (st.st_mode) && st.st_size >= (off_t) sizeof (short)
+        && (off_t) (size_t) st.st_size == st.st_size && (map = mmap (NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0)) != MAP_FAILED) {
+#ifdef MADV_SEQUENTIAL
+      madvise (map, (size_t) st.st_size, MADV_SEQUENTIAL);
+#endif
+      close (fd);
+      f->map = (char *) map;
+      f->map_len = (size_t) st.st_size;
+      f->nsam = (long) (st.st_size / sizeof (short));
+      return f;
+    }
+    close (fd);
+  }
+#endif
+
+  /* not mapped: buffered reads */
+  if ((f->fp = fopen (name, "rb")) == NULL) {
+    ugst_io_close (f);
+    return NULL;
+  }
+  return f;
+}
+
+
+/*
+  ----------------------------------------------------------------------------
+  UGST_IO *ugst_io_open_write (char *name, int swap);
+  ~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  Creates the output file name ("-" for the standard output); swap as for
+  ugst_io_open_read(). Returns NULL if the file cannot be created.
+  ----------------------------------------------------------------------------
+*/
+UGST_IO *ugst_io_open_write (char *name, int swap) {
+  UGST_IO *f;
+
+  if ((f = ugst_io_new (swap, 1)) == NULL)
+    return NULL;
+
+  if (strcmp (name, "-") == 0) {
+    f->fp = stdout;
+#if defined(_WIN32)
+    _setmode (_fileno (stdout), _O_BINARY);
+#endif
+  } else if ((f->fp = fopen (name, "wb")) == NULL) {
+    ugst_io_close (f);
+    return NULL;
+  } else
+    setvbuf (f->fp, NULL, _IONBF, 0);
+  return f;
+}
+
+
+/*
+  ----------------------------------------------------------------------------
+  int ugst_io_mapped (UGST_IO *f);
+  ~~~~~~~~~~~~~~~~~~
+  Returns 1 if the input file f is memory-mapped.
+  ----------------------------------------------------------------------------
+*/
+int ugst_io_mapped (UGST_IO * f) {
+  return f->map != NULL;
+}
+
+
+/*
+  ----------------------------------------------------------------------------
+  long ugst_io_length (UGST_IO *f);
+  ~~~~~~~~~~~~~~~~~~~
+  Returns the number of samples of the input file f, or -1 if it is not
+  known (pipes).
+  ----------------------------------------------------------------------------
+*/
+long ugst_io_length (UGST_IO * f) {
+  long cur, end;
+
+  if (f->map != NULL)
+    return f->nsam;
+  if (f->fp == NULL || (cur = ftell (f->fp)) < 0 || fseek (f->fp, 0L, SEEK_END) != 0)
+    return -1;
+  end = ftell (f->fp);
+  fseek (f->fp, cur, SEEK_SET);
+  return end < 0 ? -1 : end / (long) sizeof (short);
+}
+
+
+/*
+  ----------------------------------------------------------------------------
+  int ugst_io_seek (UGST_IO *f, long sample);
+  ~~~~~~~~~~~~~~~~
+  Moves the input file f to the given sample, counted from the start of
+  the file. Pipes can only move forward (the samples are skipped).
+  Returns 0 on success, -1 on failure.
+  ----------------------------------------------------------------------------
+*/
+int ugst_io_seek (UGST_IO * f, long sample) {
+  long n, got;
+
+  if (sample < 0)
+    return -1;
+  if (f->map != NULL) {
+    f->pos = sample < f->nsam ? sample : f->nsam;
+    return 0;
+  }
+  if (fseek (f->fp, sample * (long) sizeof (short), SEEK_SET) == 0)
+    return 0;
+
+  /* not seekable: skip forward */
+  for (n = sample; n > 0; n -= got)
+    if ((got = (long) fread (f->buf, sizeof (short), n < f->buf_len ? n : f->buf_len, f->fp)) <= 0)
+      return -1;
+  return 0;
+}
+
+
+/*
+  ----------------------------------------------------------------------------
+  long ugst_io_read (UGST_IO *f, short *x, long n);
+  ~~~~~~~~~~~~~~~~~
+  Copies up to n samples of the input file f into x[], in the machine
+  byte order. Returns the number of samples read (0 at the end of the
+  file).
+  ----------------------------------------------------------------------------
+*/
+long ugst_io_read (UGST_IO * f, short *x, long n) {
+  long got;
+
+  if (n <= 0)
+    return 0;
+  if (f->map != NULL) {
+    got = f->nsam - f->pos < n ? f->nsam - f->pos : n;
+    memcpy (x, f->map + f->pos * sizeof (short), got * sizeof (short));
+    f->pos += got;
+  } else
+    got = (long) fread (x, sizeof (short), n, f->fp);
+  if (f->swap)
+    ugst_io_swap (x, got);
+  return got;
+}
+
+
+/*
+  ----------------------------------------------------------------------------
+  short *ugst_io_block (UGST_IO *f, long n, long *got);
+  ~~~~~~~~~~~~~~~~~~~~
+  Returns a pointer to the next (up to) n samples of the input file f, in
+  the machine byte order, and their number in *got (0 at the end of the
+  file). For a mapped file in the machine byte order, the pointer is into
+  the mapping itself (no copy); otherwise the samples are read into the
+  aligned block buffer of f. The samples must not be modified, and are
+  valid until the next call.
+  ----------------------------------------------------------------------------
+*/
+short *ugst_io_block (UGST_IO * f, long n, long *got) {
+  short *x;
+
+  if (f->map != NULL && !f->swap) {
+    *got = f->nsam - f->pos < n ? f->nsam - f->pos : n;
+    if (*got < 0)
+      *got = 0;
+    x = (short *) (f->map + f->pos * sizeof (short));
+    f->pos += *got;
+    return x;
+  }
+  if (!ugst_io_alloc (f, n)) {
+    *got = 0;
+    return NULL;
+  }
+  *got = ugst_io_read (f, f->buf, n);
+  return f->buf;
+}
+
+
+/*
+  ----------------------------------------------------------------------------
+  long ugst_io_write (UGST_IO *f, short *x, long n);
+  ~~~~~~~~~~~~~~~~~~
+  Writes the n samples of x[] (in the machine byte order) to the output
+  file f. The samples are kept in the block buffer of f until it is
+  full; long blocks in the machine byte order are written directly.
+  Returns n, or -1 if a write failed.
+  ----------------------------------------------------------------------------
+*/
+long ugst_io_write (UGST_IO * f, short *x, long n) {
+  long i, l;
+
+  if (!f->swap && n >= f->buf_len) {
+    if (ugst_io_flush (f) && fwrite (x, sizeof (short), n, f->fp) != (size_t) n)
+      f->error = 1;
+    return f->error ? -1 : n;
+  }
+  for (i = 0; i < n; i += l) {
+    l = f->buf_len - f->buf_cnt < n - i ? f->buf_len - f->buf_cnt : n - i;
+    memcpy (f->buf + f->buf_cnt, x + i, l * sizeof (short));
+    if (f->swap)
+      ugst_io_swap (f->buf + f->buf_cnt, l);
+    f->buf_cnt += l;
+    if (f->buf_cnt == f->buf_len)
+      ugst_io_flush (f);
+  }
+  return f->error ? -1 : n;
+}
+
+
+/*
+  ----------------------------------------------------------------------------
+  int ugst_io_close (UGST_IO *f);
+  ~~~~~~~~~~~~~~~~~
+  Writes the waiting samples of an output file, closes the file f and
+  releases its state. Returns 0 on success, -1 if a write failed.
+  ----------------------------------------------------------------------------
+*/
+int ugst_io_close (UGST_IO * f) {
+  int ret;
+
+  if (f == NULL)
+    return 0;
+  if (f->output && f->fp != NULL) {
+    ugst_io_flush (f);
+    if (fflush (f->fp) != 0)
+      f->error = 1;
+  }
+  ret = f->error ? -1 : 0;
+#ifdef UGST_IO_MMAP
+  if (f->map != NULL)
+    munmap (f->map, f->map_len);
+#endif
+  if (f->fp != NULL && f->fp != stdin && f->fp != stdout && fclose (f->fp) != 0 && f->output)
+    ret = -1;
+  if (f->buf != NULL)
+    free (((char **) f->buf)[-1]);
+  free (f);
+  return ret;
+}
+
+/* ......................... End of ugst-io.c ......................... */
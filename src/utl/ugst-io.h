@@ -0,0 +1,64 @@
+/*
+  ============================================================================
+   File: UGST-IO.H                                                 17.Oct.26
+  ============================================================================
+
+                         UGST/ITU-T UTILITIES MODULE
+
+                  BLOCK I/O OF 16-BIT SAMPLE FILES: DEFINITIONS
+
+   History:
+   17.Oct.26    v1.0    Created.
+  ============================================================================
+*/
+#ifndef UGST_IO_defined
+#define UGST_IO_defined 100
+
+#include <stdio.h>
+#include <stddef.h>
+
+/* macros for smart prototypes */
+#ifndef ARGS
+#if (defined(__STDC__) || defined(VMS) || defined(__DECC)  || defined(MSDOS) || defined(__MSDOS__))
+#define ARGS(x) x
+#else /* Unix: no parameters in prototype! */
+#define ARGS(x) ()
+#endif
+#endif
+
+/* Byte order of the samples in the file */
+#define UGST_IO_NATIVE  0       /* as the machine: no swapping */
+#define UGST_IO_SWAPPED 1       /* opposite of the machine: swapped in bulk */
+
+/* Default block length, in samples */
+#define UGST_IO_BLOCK   65536L
+
+/* State of an input or output sample file */
+typedef struct {
+  FILE *fp;                     /* stream (not mapped, or output) */
+  char *map;                    /* mapped input file, or NULL */
+  size_t map_len;               /* length of the mapping, in bytes */
+  long nsam;                    /* number of samples of the mapped file */
+  long pos;                     /* current sample of the mapped file */
+  short *buf;                   /* aligned block buffer */
+  long buf_len;                 /* length of buf, in samples */
+  long buf_cnt;                 /* samples waiting in buf (output) */
+  int swap;                     /* UGST_IO_NATIVE or UGST_IO_SWAPPED */
+  int output;                   /* 1 for an output file */
+  int error;                    /* set on write errors */
+} UGST_IO;
+
+/* Prototypes */
+int ugst_io_little_endian ARGS ((void));
+UGST_IO *ugst_io_open_read ARGS ((char *name, int swap));
+UGST_IO *ugst_io_open_write ARGS ((char *name, int swap));
+int ugst_io_mapped ARGS ((UGST_IO * f));
+long ugst_io_length ARGS ((UGST_IO * f));
+int ugst_io_seek ARGS ((UGST_IO * f, long sample));
+long ugst_io_read ARGS ((UGST_IO * f, short *x, long n));
+short *ugst_io_block ARGS ((UGST_IO * f, long n, long *got));
+long ugst_io_write ARGS ((UGST_IO * f, short *x, long n));
+int ugst_io_close ARGS ((UGST_IO * f));
+void ugst_io_swap ARGS ((short *x, long n));
+
+#endif /* UGST_IO_defined */